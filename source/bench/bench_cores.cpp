@@ -0,0 +1,309 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Per engine / mode benchmarks of the sound generators and processors.
+//
+//   vbmi-bench --benchmark_filter='plaits/engine:1[0-9]/sr:48000'
+//   vbmi-bench --benchmark_out=bench.json --benchmark_out_format=json
+
+
+#include "module_bench.h"
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+vbmi::Module* vbmi_create_plaits();
+vbmi::Module* vbmi_create_rings();
+vbmi::Module* vbmi_create_elements();
+vbmi::Module* vbmi_create_clouds();
+vbmi::Module* vbmi_create_warps();
+vbmi::Module* vbmi_create_braids();
+vbmi::Module* vbmi_create_plaits_f32();
+vbmi::Module* vbmi_create_rings_f32();
+vbmi::Module* vbmi_create_elements_f32();
+}
+
+namespace vbmi {
+
+namespace {
+
+// Engines registered in plaits::Voice::Init().
+const int kNumPlaitsEngines = 24;
+
+// plaits::kMaxPolyphony
+const int kMaxPlaitsVoices = 16;
+
+// rings::RESONATOR_MODEL_LAST and rings::kMaxPolyphony
+const int kNumRingsModels = 6;
+const int kMaxRingsPolyphony = 4;
+
+// clouds::PLAYBACK_MODE_LAST
+const int kNumCloudsModes = 4;
+
+// The 'algo' knob of wrps~ has 8 detents, 0 and 8 included. The first 6
+// are cross-modulation algorithms, the others the vocoder.
+const int kNumWarpsAlgorithms = 9;
+const int kNumWarpsXmodAlgorithms = 6;
+
+// braids::MACRO_OSC_SHAPE_LAST
+const int kNumBraidsShapes = 48;
+
+// plaits engines with a resonator (string and modal), and the signal inlet
+// of plts~ that triggers them
+const int kPlaitsStringEngine = 11;
+const int kPlaitsModalEngine = 12;
+const int kPlaitsTriggerInlet = 6;
+
+// elements::RESONATOR_MODEL_LAST
+const int kNumElementsModels = 3;
+
+BenchMessage Msg(const char* selector, double value, int inlet = 0) {
+  BenchMessage message = { selector, inlet, std::vector<double>(1, value) };
+  return message;
+}
+
+// Poly mode with every voice holding a note.
+std::vector<BenchSetup> PlaitsPolySetups() {
+  std::vector<BenchSetup> setups;
+  for (int engine = 0; engine < kNumPlaitsEngines; ++engine) {
+    for (int voices = 4; voices <= kMaxPlaitsVoices; voices *= 2) {
+      BenchSetup setup;
+      setup.label = "engine:" + std::to_string(engine) +
+          "/voices:" + std::to_string(voices);
+      setup.messages.push_back(Msg("voices", voices));
+      setup.messages.push_back(Msg("engine", engine));
+      for (int i = 0; i < voices; ++i) {
+        BenchMessage note = { "midinote", 0, std::vector<double>(2, 100.0) };
+        note.args[0] = 36 + i * 3;
+        setup.messages.push_back(note);
+      }
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+std::vector<BenchSetup> RingsSetups() {
+  std::vector<BenchSetup> setups;
+  for (int model = 0; model < kNumRingsModels; ++model) {
+    for (int polyphony = 1; polyphony <= kMaxRingsPolyphony; ++polyphony) {
+      BenchSetup setup;
+      setup.label = "model:" + std::to_string(model) +
+          "/polyphony:" + std::to_string(polyphony);
+      setup.messages.push_back(Msg("polyphony", polyphony));
+      setup.messages.push_back(Msg("model", model));
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+std::vector<BenchSetup> ElementsSetups() {
+  std::vector<BenchSetup> setups;
+  for (int bow = 0; bow <= 1; ++bow) {
+    for (int blow = 0; blow <= 1; ++blow) {
+      BenchSetup setup;
+      setup.label = "bow:" + std::to_string(bow) +
+          "/blow:" + std::to_string(blow);
+      setup.messages.push_back(Msg("bow", bow));
+      setup.messages.push_back(Msg("blow", blow));
+      setup.messages.push_back(Msg("play", 1));
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+// Granular mode at full density with the smooth (table based) window, with
+// the number of grains of the module and with more.
+std::vector<BenchSetup> CloudsDenseSetups() {
+  std::vector<BenchSetup> setups;
+  for (int grains = 0; grains <= 256; grains = grains ? grains * 2 : 64) {
+    BenchSetup setup;
+    setup.label = "grains:" + std::to_string(grains);
+    setup.messages.push_back(Msg("grains", grains));
+    setup.messages.push_back(Msg("mode", 0));
+    setup.messages.push_back(Msg("density", 1.0));
+    setup.messages.push_back(Msg("texture", 0.8));
+    setup.messages.push_back(Msg("size", 0.6));
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+// Cross-modulation algorithms with each oversampling ratio, 0 is auto.
+std::vector<BenchSetup> WarpsOversamplingSetups() {
+  const int kRatios[] = { 1, 2, 4, 6, 0 };
+  std::vector<BenchSetup> setups;
+  for (int algo = 0; algo < kNumWarpsXmodAlgorithms; ++algo) {
+    for (size_t i = 0; i < sizeof(kRatios) / sizeof(kRatios[0]); ++i) {
+      BenchSetup setup;
+      setup.label = "algo:" + std::to_string(algo) +
+          "/oversampling:" + std::to_string(kRatios[i]);
+      setup.messages.push_back(Msg("level1", 1.0));
+      setup.messages.push_back(Msg("level2", 1.0));
+      setup.messages.push_back(Msg("oversampling", kRatios[i]));
+      setup.messages.push_back(Msg("algo", algo));
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+// The vocoder (last algorithm) with each number of bands.
+std::vector<BenchSetup> WarpsVocoderSetups() {
+  const int kBands[] = { 20, 39 };
+  std::vector<BenchSetup> setups;
+  for (size_t i = 0; i < sizeof(kBands) / sizeof(kBands[0]); ++i) {
+    BenchSetup setup;
+    setup.label = "bands:" + std::to_string(kBands[i]);
+    setup.messages.push_back(Msg("level1", 1.0));
+    setup.messages.push_back(Msg("level2", 1.0));
+    setup.messages.push_back(Msg("bands", kBands[i]));
+    setup.messages.push_back(Msg("algo", kNumWarpsAlgorithms - 1));
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+// Resonators ringing out after a single excitation, see
+// RegisterTailBenchmarks().
+std::vector<BenchSetup> PlaitsTailSetups() {
+  const int kEngines[] = { kPlaitsStringEngine, kPlaitsModalEngine };
+  std::vector<BenchSetup> setups;
+  for (size_t i = 0; i < sizeof(kEngines) / sizeof(kEngines[0]); ++i) {
+    BenchSetup setup;
+    setup.label = "engine:" + std::to_string(kEngines[i]);
+    setup.messages.push_back(Msg("engine", kEngines[i]));
+    // use the trigger input
+    setup.messages.push_back(Msg("int", 1, kPlaitsTriggerInlet));
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+// The resonator excited by the audio input (int 1 to the first inlet turns
+// the internal exciter off).
+std::vector<BenchSetup> RingsTailSetups() {
+  std::vector<BenchSetup> setups;
+  for (int model = 0; model < kNumRingsModels; ++model) {
+    BenchSetup setup;
+    setup.label = "model:" + std::to_string(model);
+    setup.messages.push_back(Msg("int", 1));
+    setup.messages.push_back(Msg("model", model));
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+// A noise burst on the strike input, with the reverb.
+std::vector<BenchSetup> ElementsTailSetups() {
+  std::vector<BenchSetup> setups;
+  for (int model = 0; model < kNumElementsModels; ++model) {
+    BenchSetup setup;
+    setup.label = "model:" + std::to_string(model);
+    setup.messages.push_back(Msg("model", model));
+    setup.messages.push_back(Msg("space", 0.7));
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+// The reverb of the granular mode.
+std::vector<BenchSetup> CloudsTailSetups() {
+  BenchSetup setup;
+  setup.label = "reverb";
+  setup.messages.push_back(Msg("reverb", 0.8));
+  return std::vector<BenchSetup>(1, setup);
+}
+
+// Creating and initialising an instance, what loading a patch with many
+// plts~ costs per object.
+void PlaitsInstantiate(benchmark::State& state) {
+  for (auto _ : state) {
+    Module* module = vbmi_create_plaits();
+    benchmark::DoNotOptimize(module->Init(48000.0));
+    delete module;
+  }
+}
+
+int RegisterAll() {
+  benchmark::RegisterBenchmark("plaits/instantiate", &PlaitsInstantiate);
+  RegisterModuleBenchmarks("plaits", &vbmi_create_plaits,
+      MakeSetups("engine", 0, kNumPlaitsEngines - 1));
+  RegisterModuleBenchmarks("plaits_poly", &vbmi_create_plaits,
+      PlaitsPolySetups());
+  RegisterModuleBenchmarks("rings", &vbmi_create_rings, RingsSetups());
+  RegisterModuleBenchmarks("clouds", &vbmi_create_clouds,
+      MakeSetups("mode", 0, kNumCloudsModes - 1));
+  RegisterModuleBenchmarks("clouds_dense", &vbmi_create_clouds,
+      CloudsDenseSetups());
+
+  std::vector<BenchMessage> warps_levels;
+  warps_levels.push_back(Msg("level1", 1.0));
+  warps_levels.push_back(Msg("level2", 1.0));
+  RegisterModuleBenchmarks("warps", &vbmi_create_warps,
+      MakeSetups("algo", 0, kNumWarpsAlgorithms - 1, warps_levels));
+  RegisterModuleBenchmarks("warps_oversampling", &vbmi_create_warps,
+      WarpsOversamplingSetups());
+  RegisterModuleBenchmarks("warps_vocoder", &vbmi_create_warps,
+      WarpsVocoderSetups());
+
+  RegisterModuleBenchmarks("braids", &vbmi_create_braids,
+      MakeSetups("model", 0, kNumBraidsShapes - 1));
+  RegisterModuleBenchmarks("elements", &vbmi_create_elements,
+      ElementsSetups());
+
+  // single precision builds, see vbmi-precision for what they cost in
+  // accuracy
+  RegisterModuleBenchmarks("plaits_f32", &vbmi_create_plaits_f32,
+      MakeSetups("engine", 0, kNumPlaitsEngines - 1));
+  RegisterModuleBenchmarks("plaits_poly_f32", &vbmi_create_plaits_f32,
+      PlaitsPolySetups());
+  RegisterModuleBenchmarks("rings_f32", &vbmi_create_rings_f32,
+      RingsSetups());
+  RegisterModuleBenchmarks("elements_f32", &vbmi_create_elements_f32,
+      ElementsSetups());
+
+  // 30 s into the tail, with and without flush-to-zero
+  RegisterTailBenchmarks("plaits", &vbmi_create_plaits, PlaitsTailSetups(),
+      kPlaitsTriggerInlet);
+  RegisterTailBenchmarks("plaits_f32", &vbmi_create_plaits_f32,
+      PlaitsTailSetups(), kPlaitsTriggerInlet);
+  RegisterTailBenchmarks("rings", &vbmi_create_rings, RingsTailSetups());
+  RegisterTailBenchmarks("rings_f32", &vbmi_create_rings_f32,
+      RingsTailSetups());
+  RegisterTailBenchmarks("elements", &vbmi_create_elements,
+      ElementsTailSetups());
+  RegisterTailBenchmarks("elements_f32", &vbmi_create_elements_f32,
+      ElementsTailSetups());
+  RegisterTailBenchmarks("clouds", &vbmi_create_clouds, CloudsTailSetups());
+  return 0;
+}
+
+int registered = RegisterAll();
+
+}  // namespace
+
+}  // namespace vbmi
@@ -0,0 +1,98 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+
+// The FFT backends of the clouds phase vocoder (vb.mi.pvoc~ and the
+// spectral mode of vb.mi.clds~), a forward and an inverse real transform
+// per iteration, as done for every frame:
+//
+//   vbmi-bench --benchmark_filter='fft/'
+
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "stmlib/fft/shy_fft.h"
+#include "stmlib/fft/simd_fft.h"
+
+namespace vbmi {
+
+namespace {
+
+// clouds::kMaxFftSize
+const size_t kMaxFftSize = 4096;
+
+typedef stmlib::ShyFFT<float, kMaxFftSize, stmlib::RotationPhasor> ShyFFT;
+typedef stmlib::SimdFFT<kMaxFftSize> SimdFFT;
+
+template<typename FFT>
+void FftRoundTrip(benchmark::State& state, size_t num_passes) {
+  static FFT fft;
+  fft.Init();
+
+  size_t size = 1 << num_passes;
+  std::vector<float> signal(size);
+  std::vector<float> in(size);
+  std::vector<float> out(size);
+  for (size_t i = 0; i < size; ++i) {
+    signal[i] = sinf(0.1f * i) + 0.25f * sinf(0.37f * i);
+  }
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    // Both transforms use their input as workspace.
+    std::copy(signal.begin(), signal.end(), in.begin());
+    fft.Direct(&in[0], &out[0], num_passes);
+    fft.Inverse(&out[0], &in[0], num_passes);
+    benchmark::DoNotOptimize(in[size - 1]);
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  // Computed here: a rate counter would be printed in seconds.
+  state.counters["ns_per_point"] = elapsed.count() /
+      (static_cast<double>(state.iterations()) * size);
+}
+
+int RegisterAll() {
+  for (size_t passes = 10; passes <= 12; ++passes) {
+    char name[64];
+    snprintf(name, sizeof(name), "fft/shy/size:%d", 1 << passes);
+    benchmark::RegisterBenchmark(name, &FftRoundTrip<ShyFFT>, passes);
+    snprintf(name, sizeof(name), "fft/simd/size:%d", 1 << passes);
+    benchmark::RegisterBenchmark(name, &FftRoundTrip<SimdFFT>, passes);
+  }
+  return 0;
+}
+
+int registered = RegisterAll();
+
+}  // namespace
+
+}  // namespace vbmi
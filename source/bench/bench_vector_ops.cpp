@@ -0,0 +1,136 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+
+
+// The vector operations of the perform routines, with each instruction set
+// the cpu can run, on signal vectors of 16 to 2048 samples:
+//
+//   vbmi-bench --benchmark_filter='vector_ops/'
+
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "vector_ops.h"
+
+namespace vbmi {
+
+namespace {
+
+enum Op {
+  OP_SUM,
+  OP_MAX_ABS,
+  OP_FLOAT_TO_DOUBLE,
+  OP_DOUBLE_TO_FLOAT,
+  OP_SCALE_ADD,
+  OP_CLAMP,
+  OP_CROSSFADE,
+  OP_LAST
+};
+
+const char* const kOpNames[] = {
+  "sum", "max_abs", "float_to_double", "double_to_float", "scale_add",
+  "clamp", "crossfade"
+};
+
+void VectorOp(benchmark::State& state, Op op, vec::Isa isa) {
+  size_t size = state.range(0);
+  std::vector<double> a(size);
+  std::vector<double> b(size);
+  std::vector<double> out(size);
+  std::vector<float> f(size);
+  for (size_t i = 0; i < size; ++i) {
+    a[i] = sin(0.1 * i);
+    b[i] = 1.5 * cos(0.37 * i);
+    f[i] = static_cast<float>(b[i]);
+  }
+
+  vec::Isa previous = vec::isa();
+  vec::set_isa(isa);
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    switch (op) {
+      case OP_SUM:
+        benchmark::DoNotOptimize(vec::Sum(&a[0], size));
+        break;
+      case OP_MAX_ABS:
+        benchmark::DoNotOptimize(vec::MaxAbs(&a[0], size));
+        break;
+      case OP_FLOAT_TO_DOUBLE:
+        vec::Convert(&f[0], &out[0], size);
+        break;
+      case OP_DOUBLE_TO_FLOAT:
+        vec::Convert(&a[0], &f[0], size);
+        break;
+      case OP_SCALE_ADD:
+        vec::ScaleAdd(&a[0], 1e-3, &out[0], size);
+        break;
+      case OP_CLAMP:
+        vec::Clamp(&b[0], -1.0, 1.0, &out[0], size);
+        break;
+      case OP_CROSSFADE:
+        vec::Crossfade(&a[0], &b[0], 0.3, &out[0], size);
+        break;
+      default:
+        break;
+    }
+    benchmark::ClobberMemory();
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  vec::set_isa(previous);
+
+  // Computed here: a rate counter would be printed in seconds.
+  state.counters["ns_per_sample"] = elapsed.count() /
+      (static_cast<double>(state.iterations()) * size);
+}
+
+int RegisterAll() {
+  for (int isa = 0; isa < vec::ISA_LAST; ++isa) {
+    if (!vec::supported(static_cast<vec::Isa>(isa))) {
+      continue;
+    }
+    for (int op = 0; op < OP_LAST; ++op) {
+      char name[64];
+      snprintf(name, sizeof(name), "vector_ops/%s/%s", kOpNames[op],
+               vec::isa_name(static_cast<vec::Isa>(isa)));
+      benchmark::RegisterBenchmark(
+          name, &VectorOp, static_cast<Op>(op), static_cast<vec::Isa>(isa))
+          ->RangeMultiplier(4)->Range(16, 2048);
+    }
+  }
+  return 0;
+}
+
+int registered = RegisterAll();
+
+}  // namespace
+
+}  // namespace vbmi
@@ -0,0 +1,315 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+#include "module_bench.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "denormals.h"
+
+namespace vbmi {
+
+namespace {
+
+const double kSampleRates[] = { 44100.0, 48000.0, 96000.0 };
+const int kMinBlockSize = 16;
+const int kMaxBlockSize = 2048;
+
+// Audio processed before timing starts, so that parameter smoothing and
+// envelopes have settled.
+const double kWarmUpTime = 0.25;
+
+// The tail benchmarks excite the module for kExciteTime, let it ring out
+// into silence for kTailTime and then time kTailBlocks blocks.
+const double kExciteTime = 0.01;
+const double kTailTime = 30.0;
+const int kTailBlocks = 2000;
+const double kTailSampleRate = 48000.0;
+const int kTailBlockSize = 64;
+
+void FillNoise(double* buffer, long size, uint32_t* state) {
+  for (long i = 0; i < size; ++i) {
+    *state = *state * 1664525L + 1013904223L;
+    buffer[i] = (static_cast<double>(*state) / 4294967296.0 - 0.5) * 0.5;
+  }
+}
+
+// A module with its input and output buffers. Process() runs one block
+// the way the perform routines do, with flush-to-zero, unless
+// flush_denormals is false.
+class ModuleRunner {
+ public:
+  ModuleRunner(ModuleFactory factory, bool flush_denormals)
+      : module_(factory()),
+        flush_denormals_(flush_denormals) { }
+
+  // Returns an error message, empty if the module is ready.
+  std::string Init(
+      const BenchSetup& setup,
+      double sample_rate,
+      int block_size,
+      int trigger_inlet) {
+    if (!module_->Init(sample_rate)) {
+      return "Init() failed";
+    }
+    block_size_ = block_size;
+    int num_inputs = module_->num_inputs();
+    int num_outputs = module_->num_outputs();
+    for (int i = 0; i < num_inputs; ++i) {
+      module_->Connect(i, i < module_->num_audio_inputs() ||
+                          i == trigger_inlet);
+    }
+    for (size_t i = 0; i < setup.messages.size(); ++i) {
+      const BenchMessage& message = setup.messages[i];
+      if (!module_->Message(message.selector, message.inlet,
+                            static_cast<int>(message.args.size()),
+                            message.args.empty() ? NULL : &message.args[0])) {
+        return std::string("unknown message '") + message.selector + "'";
+      }
+    }
+
+    in_buffers_.assign(num_inputs, std::vector<double>(block_size, 0.0));
+    out_buffers_.assign(num_outputs, std::vector<double>(block_size, 0.0));
+    ins_.resize(num_inputs);
+    outs_.resize(num_outputs);
+    for (int i = 0; i < num_inputs; ++i) {
+      ins_[i] = &in_buffers_[i][0];
+    }
+    for (int i = 0; i < num_outputs; ++i) {
+      outs_[i] = &out_buffers_[i][0];
+    }
+    return std::string();
+  }
+
+  // Noise on the audio inputs, a pulse on trigger_inlet, or silence.
+  void SetInputs(bool excite, int trigger_inlet) {
+    uint32_t seed = 0x21;
+    for (size_t i = 0; i < ins_.size(); ++i) {
+      if (excite && static_cast<int>(i) < module_->num_audio_inputs()) {
+        FillNoise(ins_[i], block_size_, &seed);
+      } else {
+        double value = excite && static_cast<int>(i) == trigger_inlet
+            ? 1.0 : 0.0;
+        std::fill(in_buffers_[i].begin(), in_buffers_[i].end(), value);
+      }
+    }
+  }
+
+  void Process() {
+    if (flush_denormals_) {
+      ScopedFlushDenormals flush_denormals;
+      module_->Process(&ins_[0], &outs_[0], block_size_);
+    } else {
+      module_->Process(&ins_[0], &outs_[0], block_size_);
+    }
+  }
+
+  // Processes one block and returns its wall time in microseconds.
+  double TimedProcess() {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    Process();
+    benchmark::DoNotOptimize(outs_[0][block_size_ - 1]);
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+  }
+
+ private:
+  std::unique_ptr<Module> module_;
+  bool flush_denormals_;
+  int block_size_;
+  std::vector<std::vector<double> > in_buffers_;
+  std::vector<std::vector<double> > out_buffers_;
+  std::vector<double*> ins_;
+  std::vector<double*> outs_;
+};
+
+void ReportCounters(
+    benchmark::State& state,
+    std::vector<double>* block_times,
+    double sample_rate,
+    int block_size) {
+  if (block_times->empty()) {
+    return;
+  }
+  // Computed here rather than as rate counters, which google benchmark
+  // would print as times in seconds.
+  double samples = static_cast<double>(block_times->size()) * block_size;
+  double seconds = std::accumulate(
+      block_times->begin(), block_times->end(), 0.0) * 1e-6;
+  double load = seconds / (samples / sample_rate);
+  state.counters["ns_per_sample"] = seconds * 1e9 / samples;
+  state.counters["cpu_per_voice_second"] = load;
+  state.counters["voices_per_core"] = 1.0 / load;
+
+  // The slowest block is mostly the scheduler's doing, the 99.9th
+  // percentile shows the spikes of the module itself.
+  std::vector<double>::iterator p999 = block_times->begin() +
+      block_times->size() * 999 / 1000;
+  std::nth_element(block_times->begin(), p999, block_times->end());
+  state.counters["block_us_p999"] = *p999;
+}
+
+void RunModule(
+    benchmark::State& state,
+    ModuleFactory factory,
+    const BenchSetup& setup,
+    double sample_rate,
+    int block_size) {
+  ModuleRunner runner(factory, true);
+  std::string error = runner.Init(setup, sample_rate, block_size, -1);
+  if (!error.empty()) {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+  runner.SetInputs(true, -1);
+
+  long warm_up_blocks = static_cast<long>(
+      kWarmUpTime * sample_rate / block_size) + 1;
+  for (long i = 0; i < warm_up_blocks; ++i) {
+    runner.Process();
+  }
+
+  std::vector<double> block_times;
+  for (auto _ : state) {
+    block_times.push_back(runner.TimedProcess());
+  }
+  ReportCounters(state, &block_times, sample_rate, block_size);
+}
+
+void RunTail(
+    benchmark::State& state,
+    ModuleFactory factory,
+    const BenchSetup& setup,
+    int trigger_inlet,
+    bool flush_denormals) {
+  double sample_rate = kTailSampleRate;
+  int block_size = kTailBlockSize;
+  ModuleRunner runner(factory, flush_denormals);
+  std::string error = runner.Init(setup, sample_rate, block_size,
+                                  trigger_inlet);
+  if (!error.empty()) {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  long excite_blocks = static_cast<long>(
+      kExciteTime * sample_rate / block_size) + 1;
+  runner.SetInputs(true, trigger_inlet);
+  for (long i = 0; i < excite_blocks; ++i) {
+    runner.Process();
+  }
+  long tail_blocks = static_cast<long>(kTailTime * sample_rate / block_size);
+  runner.SetInputs(false, trigger_inlet);
+  for (long i = 0; i < tail_blocks; ++i) {
+    runner.Process();
+  }
+
+  std::vector<double> block_times;
+  for (auto _ : state) {
+    block_times.push_back(runner.TimedProcess());
+  }
+  ReportCounters(state, &block_times, sample_rate, block_size);
+}
+
+}  // namespace
+
+void RegisterModuleBenchmarks(
+    const char* core,
+    ModuleFactory factory,
+    const std::vector<BenchSetup>& setups) {
+  std::unique_ptr<Module> probe(factory());
+  int module_block_size = probe->block_size();
+
+  for (size_t s = 0; s < setups.size(); ++s) {
+    for (size_t r = 0; r < sizeof(kSampleRates) / sizeof(kSampleRates[0]); ++r) {
+      for (int block = kMinBlockSize; block <= kMaxBlockSize; block *= 2) {
+        if (block % module_block_size) {
+          continue;
+        }
+        char name[128];
+        snprintf(name, sizeof(name), "%s/%s/sr:%g/block:%d",
+                 core, setups[s].label.c_str(), kSampleRates[r], block);
+        BenchSetup setup = setups[s];
+        double sample_rate = kSampleRates[r];
+        benchmark::RegisterBenchmark(name,
+            [factory, setup, sample_rate, block](benchmark::State& state) {
+              RunModule(state, factory, setup, sample_rate, block);
+            })->Unit(benchmark::kMicrosecond);
+      }
+    }
+  }
+}
+
+void RegisterTailBenchmarks(
+    const char* core,
+    ModuleFactory factory,
+    const std::vector<BenchSetup>& setups,
+    int trigger_inlet) {
+  for (size_t s = 0; s < setups.size(); ++s) {
+    for (int ftz = 0; ftz <= 1; ++ftz) {
+      char name[128];
+      snprintf(name, sizeof(name), "tail/%s/%s/ftz:%d",
+               core, setups[s].label.c_str(), ftz);
+      BenchSetup setup = setups[s];
+      bool flush_denormals = ftz != 0;
+      // the 30 s of tail are rendered again for every run, a fixed number
+      // of iterations keeps it to one
+      benchmark::RegisterBenchmark(name,
+          [factory, setup, trigger_inlet, flush_denormals](
+              benchmark::State& state) {
+            RunTail(state, factory, setup, trigger_inlet, flush_denormals);
+          })->Unit(benchmark::kMicrosecond)->Iterations(kTailBlocks);
+    }
+  }
+}
+
+std::vector<BenchSetup> MakeSetups(
+    const char* selector,
+    int first,
+    int last,
+    const std::vector<BenchMessage>& common) {
+  std::vector<BenchSetup> setups;
+  for (int i = first; i <= last; ++i) {
+    BenchSetup setup;
+    char label[64];
+    snprintf(label, sizeof(label), "%s:%d", selector, i);
+    setup.label = label;
+    setup.messages = common;
+    BenchMessage message = { selector, 0, std::vector<double>(1, i) };
+    setup.messages.push_back(message);
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+}  // namespace vbmi
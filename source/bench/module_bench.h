@@ -0,0 +1,90 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Benchmarks the DSP cores through the same module interface vbmi-render
+// uses. Every benchmark processes blocks of 'block' samples at 'sr' and
+// reports
+//
+//   ns_per_sample         processing time per output sample
+//   cpu_per_voice_second  seconds spent per second of audio, i.e. the
+//                         fraction of a core one instance needs
+//   voices_per_core       how many instances fit on a core (the inverse)
+//   block_us_p999         99.9th percentile of the wall time per block,
+//                         the spikes that cause dropouts at small vector
+//                         sizes
+
+
+#ifndef VBMI_BENCH_MODULE_BENCH_H_
+#define VBMI_BENCH_MODULE_BENCH_H_
+
+#include <string>
+#include <vector>
+
+#include "module.h"
+
+namespace vbmi {
+
+struct BenchMessage {
+  const char* selector;
+  int inlet;
+  std::vector<double> args;
+};
+
+// One configuration (engine, mode, ...) of a module.
+struct BenchSetup {
+  std::string label;  // e.g. "engine:3"
+  std::vector<BenchMessage> messages;
+};
+
+// Registers 'core/<label>/sr:<sr>/block:<block>' for every setup, at 44.1,
+// 48 and 96 kHz and block sizes from 16 to 2048 samples. Block sizes that
+// aren't a multiple of the module's internal block size are skipped.
+void RegisterModuleBenchmarks(
+    const char* core,
+    ModuleFactory factory,
+    const std::vector<BenchSetup>& setups);
+
+// Registers 'tail/<core>/<label>/ftz:<0|1>': the module is excited with
+// noise on its audio inputs and a pulse on trigger_inlet (-1 for none),
+// rings out into silence for 30 s at 48 kHz, and then blocks of 64 samples
+// are timed, with (ftz:1) and without (ftz:0) flush-to-zero. Resonators
+// and reverbs reach the denormal range in their tails, ftz:0 shows what
+// that costs. All other benchmarks run with flush-to-zero, as the perform
+// routines of the externals do.
+void RegisterTailBenchmarks(
+    const char* core,
+    ModuleFactory factory,
+    const std::vector<BenchSetup>& setups,
+    int trigger_inlet = -1);
+
+// Shorthand for setups that only differ in one numeric message.
+std::vector<BenchSetup> MakeSetups(
+    const char* selector,
+    int first,
+    int last,
+    const std::vector<BenchMessage>& common = std::vector<BenchMessage>());
+
+}  // namespace vbmi
+
+#endif  // VBMI_BENCH_MODULE_BENCH_H_
@@ -0,0 +1,121 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Max-independent wrapper around one of the mutable instruments cores.
+//
+// A Module mirrors a vb.mi external: it has the same signal inlets and
+// outlets, understands the same messages and runs the same per-vector
+// parameter handling as the external's perform64 routine, so offline
+// renders match what the object does inside Max.
+
+
+#ifndef VBMI_HEADLESS_MODULE_H_
+#define VBMI_HEADLESS_MODULE_H_
+
+#if defined(_WIN32)
+#define VBMI_EXPORT __declspec(dllexport)
+#else
+#define VBMI_EXPORT __attribute__((visibility("default")))
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+// Name of the factory a module exports: vbmi_create_<core>, with an _f32
+// suffix when a mutableSources64 core is built in single precision, so both
+// builds can be loaded side by side.
+#ifdef STMLIB_SINGLE_PRECISION
+#define VBMI_FACTORY(core) vbmi_create_##core##_f32
+#else
+#define VBMI_FACTORY(core) vbmi_create_##core
+#endif  // STMLIB_SINGLE_PRECISION
+
+namespace vbmi {
+
+template<typename T>
+inline T Clamp(T x, T lo, T hi) {
+  return x < lo ? lo : (x > hi ? hi : x);
+}
+
+class Module {
+ public:
+  virtual ~Module() { }
+
+  // object_alloc() hands out zeroed memory and the externals rely on it,
+  // so modules are zeroed before their constructor runs. For C++ the
+  // object only exists once the constructor starts, GCC removes the memset
+  // unless the cores and modules are built with -fno-lifetime-dse (see
+  // source/cores).
+  static void* operator new(size_t size) {
+    void* p = ::operator new(size);
+    memset(p, 0, size);
+    return p;
+  }
+  static void operator delete(void* p) {
+    ::operator delete(p);
+  }
+
+  virtual const char* name() const = 0;
+
+  // Signal inlets and outlets, in Max order.
+  virtual int num_inputs() const = 0;
+  virtual int num_outputs() const = 0;
+
+  // Inlets [0, num_audio_inputs()) take audio, the others control signals.
+  virtual int num_audio_inputs() const = 0;
+
+  // Internal block size of the core. Process() accepts any multiple of it.
+  virtual int block_size() const = 0;
+
+  // Equivalent of myObj_new() followed by dsp64 at the given rate.
+  virtual bool Init(double sample_rate) = 0;
+
+  // Equivalent of the 'count' array passed to dsp64.
+  virtual void Connect(int inlet, bool connected) = 0;
+
+  // Sends a message with 'argc' numeric arguments to the module. 'int' and
+  // 'float' selectors are dispatched on the inlet, like proxy_getinlet()
+  // does in Max. Returns false if the selector is unknown.
+  virtual bool Message(const char* selector, int inlet,
+                       int argc, const double* argv) = 0;
+
+  // Equivalent of perform64.
+  virtual void Process(double** ins, double** outs, long size) = 0;
+};
+
+typedef Module* (*ModuleFactory)();
+
+// Cores the modules hold by pointer start out zeroed as well. The result
+// can be released with delete.
+template<typename T>
+inline T* NewZeroed() {
+  void* p = ::operator new(sizeof(T));
+  memset(p, 0, sizeof(T));
+  return new (p) T;
+}
+
+}  // namespace vbmi
+
+#endif  // VBMI_HEADLESS_MODULE_H_
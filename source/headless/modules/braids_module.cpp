@@ -0,0 +1,315 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.brds~
+//
+// The oscillator runs at 96 kHz and is resampled to the host rate with the
+// polyphase resampler, or with libsamplerate for rates it can't handle. If
+// neither is available it runs at the host rate, like the external does with
+// the 'resamp' attribute switched off.
+
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+
+#include "module.h"
+
+#include "stmlib/utils/dsp.h"
+
+#include "braids/macro_oscillator.h"
+#include "braids/quantizer.h"
+#include "braids/quantizer_scales.h"
+#include "braids/vco_jitter_source.h"
+#include "stmlib/dsp/polyphase_resampler.h"
+#include "stmlib/utils/random.h"
+#include "vector_ops.h"
+
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+#include "samplerate.h"
+#endif
+
+
+namespace vbmi {
+
+const uint32_t kSampleRate = 96000;        // original sampling rate
+const uint16_t kAudioBlockSize = 32;
+const float kSampScale = (float)(1.0 / 32767.0);
+
+class BraidsModule : public Module {
+ public:
+  BraidsModule() {
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+    src_state_ = NULL;
+#endif
+  }
+  ~BraidsModule() {
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+    if (src_state_) {
+      src_delete(src_state_);
+    }
+#endif
+  }
+
+  const char* name() const { return "brds"; }
+  int num_inputs() const { return 5; }
+  int num_outputs() const { return 1; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return kAudioBlockSize; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    sr_ = sample_rate;
+    ratio_ = sr_ / kSampleRate;
+
+    osc_.Init(kSampleRate);
+    osc_.set_pitch((48 << 7));
+    shape_ = 0;
+    osc_.set_shape(braids::MACRO_OSC_SHAPE_CSAW);
+
+    quantizer_.Init();
+    quantizer_.Configure(braids::scales[0]);
+    scale_ = 0;
+    jitter_source_.Init();
+    memset(sync_buffer_, 0, sizeof(sync_buffer_));
+
+    midi_pitch_ = 60 << 7;
+    root_ = 0;
+    timbre_pot_ = 0.0;
+    color_pot_ = 0.0;
+    drift_ = 0;
+    auto_trig_ = true;
+    trigger_flag_ = false;
+    last_trig_ = false;
+    trig_connected_ = false;
+
+    polyphase_ = resampler_.Init(static_cast<double>(kSampleRate), sr_);
+    num_resampled_ = 0;
+    resamp_ = polyphase_;
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+    resamp_ = true;
+    int error;
+    src_state_ = src_callback_new(SrcInputCallback, SRC_SINC_FASTEST, 1, &error, this);
+    if (!src_state_) {
+      return false;
+    }
+#endif
+    Prepare();
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    // the external checks the first signal inlet for the trigger
+    if (inlet == 0) {
+      trig_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    if (!strcmp(s, "float")) {
+      switch (inlet) {
+        case 0: SetNote(m); break;
+        case 1: timbre_pot_ = Clamp(m, 0., 1.); break;
+        case 2: color_pot_ = Clamp(m, 0., 1.); break;
+        default: break;
+      }
+    } else if (!strcmp(s, "timbre")) {
+      timbre_pot_ = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "color")) {
+      color_pot_ = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "coarse")) {
+      m = Clamp(m, -4., 4.) * 12.0 + 60.0;   // +/-4 octaves around middle C
+      int16_t pit = (int)m;
+      double frac = m - pit;
+      midi_pitch_ = (pit << 7) + (int)(frac * 128.0);
+    } else if (!strcmp(s, "note")) {
+      SetNote(m);
+    } else if (!strcmp(s, "bang")) {
+      trigger_flag_ = true;
+    } else if (!strcmp(s, "model")) {
+      shape_ = Clamp(n, 0L, static_cast<long>(braids::MACRO_OSC_SHAPE_LAST - 1));
+    } else if (!strcmp(s, "scale")) {
+      scale_ = Clamp(n, 0L, 48L);
+      quantizer_.Configure(braids::scales[scale_]);
+    } else if (!strcmp(s, "drift")) {
+      drift_ = Clamp(n, 0L, 15L);
+    } else if (!strcmp(s, "auto_trig")) {
+      auto_trig_ = n != 0;
+    } else if (!strcmp(s, "root")) {
+      root_ = Clamp(n, 0L, 11L);
+    } else if (!strcmp(s, "resamp")) {
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+      resamp_ = n != 0;
+#else
+      resamp_ = n != 0 && polyphase_;
+#endif
+      Prepare();
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+    double* out = outs[0];
+    if (resamp_) {
+      if (samples_.size() < static_cast<size_t>(vs)) {
+        samples_.resize(vs);
+      }
+      for (long count = 0; count < vs; count += kAudioBlockSize) {
+        SetParameters(ins, count);
+        if (polyphase_) {
+          ResamplePolyphase(&samples_[count]);
+        } else {
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+          src_callback_read(src_state_, ratio_, kAudioBlockSize, &samples_[count]);
+#endif
+        }
+      }
+      vbmi::vec::Convert(&samples_[0], out, vs);
+      return;
+    }
+    for (long count = 0; count < vs; count += kAudioBlockSize) {
+      SetParameters(ins, count);
+      osc_.Render(sync_buffer_, buffer_, kAudioBlockSize);
+      for (size_t i = 0; i < kAudioBlockSize; ++i) {
+        out[count + i] = buffer_[i] / 32756.0;
+      }
+    }
+  }
+
+ private:
+  // equivalent of what dsp64 does before adding the perform routine
+  void Prepare() {
+    osc_.Init(resamp_ ? kSampleRate : sr_);
+  }
+
+  void SetNote(double n) {
+    n = Clamp(n, 0., 127.);
+    int pit = (int)n;
+    double frac = n - pit;
+    midi_pitch_ = (pit << 7) + (int)(frac * 128.0);
+    if (auto_trig_) {
+      trigger_flag_ = true;
+    }
+  }
+
+  void SetParameters(double** ins, long count) {
+    double* pitch_cv = ins[0];
+    double* timbre_cv = ins[1];
+    double* color_cv = ins[2];
+    double* model_cv = ins[3];
+    double* trigger_cv = ins[4];
+
+    int16_t timbre = Clamp(timbre_pot_ + timbre_cv[count], 0.0, 1.0) * 32767.0;
+    int16_t color = Clamp(color_pot_ + color_cv[count], 0.0, 1.0) * 32767.0;
+    osc_.set_parameters(timbre, color);
+
+    uint8_t shape = ((int)(model_cv[count] * braids::MACRO_OSC_SHAPE_LAST) + shape_) & 63;
+    if (shape >= braids::MACRO_OSC_SHAPE_LAST) {
+      shape -= braids::MACRO_OSC_SHAPE_LAST;
+    }
+    osc_.set_shape(static_cast<braids::MacroOscillatorShape>(shape));
+
+    int32_t pitch = midi_pitch_;
+    pitch += (int)(pitch_cv[count] * 128.0 * 12.0);    // V/OCT add pitch in half tone steps
+    pitch = quantizer_.Process(pitch, (60 + root_) << 7);
+    pitch += jitter_source_.Render(drift_);
+    osc_.set_pitch(Clamp(pitch, 0, 16383));
+
+    if (trig_connected_) {
+      double sum = vbmi::vec::Sum(trigger_cv + count, kAudioBlockSize);
+      bool trigger = sum != 0.0;
+      trigger_flag_ |= (trigger && (!last_trig_));
+      last_trig_ = trigger;
+    }
+    if (trigger_flag_) {
+      osc_.Strike();
+      trigger_flag_ = false;
+    }
+  }
+
+  static long SrcInputCallback(void* cb_data, float** audio) {
+    BraidsModule* self = static_cast<BraidsModule*>(cb_data);
+    self->osc_.Render(self->sync_buffer_, self->buffer_, kAudioBlockSize);
+    for (size_t i = 0; i < kAudioBlockSize; ++i) {
+      self->samps_[i] = self->buffer_[i] * kSampScale;
+    }
+    *audio = &self->samps_[0];
+    return kAudioBlockSize;
+  }
+
+  // renders blocks at 96 kHz until one block at the host rate is ready, like
+  // src_callback_read() does
+  void ResamplePolyphase(float* output) {
+    long n = num_resampled_;
+    while (n < kAudioBlockSize) {
+      float* audio;
+      long input_frames = SrcInputCallback(this, &audio);
+      n += resampler_.Process(audio, resampled_ + n, input_frames);
+    }
+    std::copy(resampled_, resampled_ + kAudioBlockSize, output);
+    std::copy(resampled_ + kAudioBlockSize, resampled_ + n, resampled_);
+    num_resampled_ = n - kAudioBlockSize;
+  }
+
+#ifdef VBMI_HAVE_LIBSAMPLERATE
+  SRC_STATE* src_state_;
+#endif
+  stmlib::PolyphaseResampler resampler_;
+  bool polyphase_;
+  float resampled_[kAudioBlockSize * 6];
+  long num_resampled_;
+  float samps_[kAudioBlockSize];
+  std::vector<float> samples_;
+
+  braids::MacroOscillator osc_;
+  braids::Quantizer quantizer_;
+  braids::VcoJitterSource jitter_source_;
+
+  int16_t buffer_[kAudioBlockSize];
+  uint8_t sync_buffer_[kAudioBlockSize];
+
+  double timbre_pot_, color_pot_;
+  uint8_t shape_, drift_, root_, scale_;
+  bool trigger_flag_, auto_trig_;
+  bool last_trig_, trig_connected_;
+  bool resamp_;
+  int32_t midi_pitch_;
+  double sr_;
+  double ratio_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_braids() {
+  return new vbmi::BraidsModule;
+}
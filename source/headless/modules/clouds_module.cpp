@@ -0,0 +1,322 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.clds~
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#include "module.h"
+
+#include "clouds/dsp/granular_processor.h"
+#include "stmlib/utils/random.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
+
+
+namespace vbmi {
+
+// original sample rate is 32 kHz
+const uint16_t kAudioBlockSize = 32;
+
+enum ModParams {
+  PARAM_PITCH,
+  PARAM_POSITION,
+  PARAM_SIZE,
+  PARAM_DENSITY,
+  PARAM_TEXTURE,
+  PARAM_DRYWET,
+  PARAM_CHANNEL_LAST
+};
+
+class CloudsModule : public Module {
+ public:
+  CloudsModule()
+      : processor_(NULL), large_buffer_(NULL), small_buffer_(NULL) { }
+  ~CloudsModule() {
+    delete processor_;
+    free(large_buffer_);
+    free(small_buffer_);
+  }
+
+  const char* name() const { return "clds"; }
+  int num_inputs() const { return 10; }
+  int num_outputs() const { return 2; }
+  int num_audio_inputs() const { return 2; }
+  int block_size() const { return kAudioBlockSize; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    sr_ = sample_rate;
+    bypass_ = false;
+    freeze_ = false;
+    gate_connected_ = false;
+    trig_connected_ = false;
+
+    int large_buffer_size = 118784;
+    int small_buffer_size = 65536 - 128;
+    large_buffer_ = static_cast<uint8_t*>(calloc(large_buffer_size, 1));
+    small_buffer_ = static_cast<uint8_t*>(calloc(small_buffer_size, 1));
+    if (!large_buffer_ || !small_buffer_) {
+      return false;
+    }
+
+    processor_ = NewZeroed<clouds::GranularProcessor>();
+    processor_->Init(large_buffer_, large_buffer_size,
+                     small_buffer_, small_buffer_size);
+    processor_->set_sample_rate(sr_);
+    processor_->set_num_channels(2);       // always use stereo setup (!)
+    processor_->set_low_fidelity(false);
+    processor_->set_playback_mode(clouds::PLAYBACK_MODE_GRANULAR);
+
+    pot_value_[PARAM_PITCH] = smoothed_value_[PARAM_PITCH] = 0.f;
+    pot_value_[PARAM_POSITION] = smoothed_value_[PARAM_POSITION] = 0.f;
+    pot_value_[PARAM_SIZE] = smoothed_value_[PARAM_SIZE] = 0.5f;
+    pot_value_[PARAM_DENSITY] = smoothed_value_[PARAM_DENSITY] = 0.1f;
+    pot_value_[PARAM_TEXTURE] = smoothed_value_[PARAM_TEXTURE] = 0.5f;
+    pot_value_[PARAM_DRYWET] = smoothed_value_[PARAM_DRYWET] = 1.f;
+
+    processor_->mutable_parameters()->stereo_spread = 0.5f;
+    processor_->mutable_parameters()->reverb = 0.f;
+    processor_->mutable_parameters()->feedback = 0.f;
+
+    in_gain_ = 1.0f;
+    coef_ = 0.1f;
+    previous_trig_ = false;
+
+    buffer_size_ = large_buffer_size;
+    sleep_time_ = kDefaultSleepTime;
+    sleep_detector_.Init(sr_);
+    UpdateSleepTime();
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 8) {
+      gate_connected_ = connected;
+    } else if (inlet == 9) {
+      trig_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    clouds::Parameters* p = processor_->mutable_parameters();
+    if (!strcmp(s, "int")) {
+      if (inlet == 2) {
+        pot_value_[PARAM_PITCH] = n;
+      } else if (inlet == 8) {
+        freeze_ = n != 0;
+      }
+    } else if (!strcmp(s, "float")) {
+      if (inlet == 2) {
+        pot_value_[PARAM_PITCH] = m;
+      } else if (inlet >= 3 && inlet <= 7) {
+        pot_value_[PARAM_POSITION + inlet - 3] = Clamp(m, 0., 1.);
+      }
+    } else if (!strcmp(s, "bang")) {
+      p->trigger = true;
+    } else if (!strcmp(s, "position")) {
+      pot_value_[PARAM_POSITION] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "size")) {
+      pot_value_[PARAM_SIZE] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "pitch")) {
+      pot_value_[PARAM_PITCH] = m;
+    } else if (!strcmp(s, "density")) {
+      pot_value_[PARAM_DENSITY] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "texture")) {
+      pot_value_[PARAM_TEXTURE] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "drywet")) {
+      pot_value_[PARAM_DRYWET] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "spread")) {
+      p->stereo_spread = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "reverb")) {
+      p->reverb = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "feedback")) {
+      p->feedback = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "in_gain")) {
+      in_gain_ = pow(10.0, Clamp(m, -18.0, 18.0) / 20.0);
+    } else if (!strcmp(s, "mode")) {
+      n = Clamp(n, 0L, static_cast<long>(clouds::PLAYBACK_MODE_LAST - 1));
+      processor_->set_playback_mode(static_cast<clouds::PlaybackMode>(n));
+    } else if (!strcmp(s, "freeze")) {
+      freeze_ = n != 0;
+    } else if (!strcmp(s, "lofi")) {
+      processor_->set_low_fidelity(n != 0);
+    } else if (!strcmp(s, "grains")) {
+      processor_->set_max_num_grains(
+          Clamp(n, 0L, static_cast<long>(clouds::kMaxNumGrains)));
+    } else if (!strcmp(s, "bypass")) {
+      bypass_ = n != 0;
+    } else if (!strcmp(s, "smooth")) {
+      m = 1.f - Clamp(m, 0., 1.0) * 0.9;
+      coef_ = m * m * m * m;
+    } else if (!strcmp(s, "sleep")) {
+      sleep_detector_.set_enabled(n != 0);
+    } else if (!strcmp(s, "sleep_threshold")) {
+      sleep_detector_.set_threshold(Clamp(m, -140., 0.));
+    } else if (!strcmp(s, "sleep_time")) {
+      sleep_time_ = Clamp(m, 10., 60000.);
+      UpdateSleepTime();
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+    double* inL = ins[0];
+    double* inR = ins[1];
+    double* gate_in = ins[8];
+    double* trig_in = ins[9];
+    double* outL = outs[0];
+    double* outR = outs[1];
+
+    if (bypass_) {
+      std::copy(&inL[0], &inL[vs], &outL[0]);
+      std::copy(&inR[0], &inR[vs], &outR[0]);
+      return;
+    }
+
+    float* pot_value = pot_value_;
+    float* smoothed_value = smoothed_value_;
+    float value;
+    float coef = coef_;
+    float in_gain = in_gain_;
+    clouds::GranularProcessor* gp = processor_;
+    clouds::Parameters* p = gp->mutable_parameters();
+
+    for (long count = 0; count < vs; count += kAudioBlockSize) {
+      for (int i = 0; i < kAudioBlockSize; ++i) {
+        input_[i].l = inL[i + count] * in_gain;
+        input_[i].r = inR[i + count] * in_gain;
+      }
+
+      // combine pot and cv inputs
+      value = pot_value[PARAM_PITCH] + ins[2][count];
+      CONSTRAIN(value, -48.0f, 48.0f);
+      smoothed_value[PARAM_PITCH] += coef * (value - smoothed_value[PARAM_PITCH]);
+      p->pitch = smoothed_value[PARAM_PITCH];
+
+      for (int i = 1; i < PARAM_CHANNEL_LAST; ++i) {
+        value = pot_value[i] + ins[i + 2][count];
+        CONSTRAIN(value, 0.0f, 1.0f);
+        smoothed_value[i] += coef * (value - smoothed_value[i]);
+      }
+      p->position = smoothed_value[PARAM_POSITION];
+      p->size = smoothed_value[PARAM_SIZE];
+      p->density = smoothed_value[PARAM_DENSITY];
+      p->texture = smoothed_value[PARAM_TEXTURE];
+      p->dry_wet = smoothed_value[PARAM_DRYWET];
+
+      // gate & trigger
+      if (gate_connected_) {
+        double gate_sum = vbmi::vec::Sum(gate_in + count, kAudioBlockSize);
+        p->freeze = (gate_sum != 0.0) || freeze_;
+      } else {
+        p->freeze = freeze_;
+      }
+
+      if (trig_connected_) {
+        double trig_sum = vbmi::vec::Sum(trig_in + count, kAudioBlockSize);
+        bool trigger = trig_sum != 0.0;
+        p->trigger = (trigger && !previous_trig_);
+        previous_trig_ = trigger;
+      }
+
+      // a frozen buffer keeps the grains playing
+      double in_peak = std::max(
+          vbmi::vec::MaxAbs(inL + count, kAudioBlockSize),
+          vbmi::vec::MaxAbs(inR + count, kAudioBlockSize)) * in_gain;
+      if (!sleep_detector_.Awake(in_peak, p->trigger || p->freeze)) {
+        memset(outL + count, 0, kAudioBlockSize * sizeof(double));
+        memset(outR + count, 0, kAudioBlockSize * sizeof(double));
+        continue;
+      }
+
+      gp->Process(input_, output_, kAudioBlockSize);
+      gp->Prepare();
+
+      if (p->trigger) {
+        p->trigger = false;
+      }
+
+      float out_peak = 0.f;
+      for (int i = 0; i < kAudioBlockSize; ++i) {
+        outL[i + count] = output_[i].l;
+        outR[i + count] = output_[i].r;
+        out_peak = std::max(out_peak,
+            std::max(fabsf(output_[i].l), fabsf(output_[i].r)));
+      }
+      sleep_detector_.Update(out_peak, kAudioBlockSize);
+    }
+  }
+
+ private:
+  // clds~ only sleeps once the recording buffer holds nothing but silence,
+  // see update_sleep_time() of the external.
+  void UpdateSleepTime() {
+    double buffer_ms = buffer_size_ * 1000.0 / sr_;
+    sleep_detector_.set_hang_time(std::max(sleep_time_, buffer_ms));
+  }
+
+
+  clouds::GranularProcessor* processor_;
+  uint8_t* large_buffer_;
+  uint8_t* small_buffer_;
+
+  float in_gain_;
+  bool freeze_;
+  bool previous_trig_;
+  float pot_value_[PARAM_CHANNEL_LAST];
+  float smoothed_value_[PARAM_CHANNEL_LAST];
+  float coef_;
+
+  clouds::FloatFrame input_[kAudioBlockSize];
+  clouds::FloatFrame output_[kAudioBlockSize];
+
+  SleepDetector sleep_detector_;
+  double sleep_time_;
+  long buffer_size_;
+
+  double sr_;
+  bool bypass_;
+  bool gate_connected_;
+  bool trig_connected_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_clouds() {
+  return new vbmi::CloudsModule;
+}
@@ -0,0 +1,258 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.elmnts~
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#include "module.h"
+
+#include "elements/dsp/dsp.h"
+#include "elements/dsp/part.h"
+#include "stmlib/utils/random.h"
+
+#include "read_inputs.hpp"
+#include "sleep_detector.h"
+#include "vector_ops.h"
+
+
+
+namespace vbmi {
+
+const size_t kBlockSize = elements::kMaxBlockSize;
+
+// float inlets 5 - 14 set the attenuverters
+const elements::Potentiometer kAttenuverters[] = {
+  elements::POT_EXCITER_BOW_TIMBRE_ATTENUVERTER,
+  elements::POT_EXCITER_BLOW_META_ATTENUVERTER,
+  elements::POT_EXCITER_BLOW_TIMBRE_ATTENUVERTER,
+  elements::POT_EXCITER_STRIKE_META_ATTENUVERTER,
+  elements::POT_EXCITER_STRIKE_TIMBRE_ATTENUVERTER,
+  elements::POT_RESONATOR_DAMPING_ATTENUVERTER,
+  elements::POT_RESONATOR_GEOMETRY_ATTENUVERTER,
+  elements::POT_RESONATOR_POSITION_ATTENUVERTER,
+  elements::POT_RESONATOR_BRIGHTNESS_ATTENUVERTER,
+  elements::POT_SPACE_ATTENUVERTER
+};
+
+struct PotMessage {
+  const char* selector;
+  elements::Potentiometer pot;
+  double min;
+  double scale;
+  double offset;
+};
+
+const PotMessage kPotMessages[] = {
+  { "contour", elements::POT_EXCITER_ENVELOPE_SHAPE, 0.0, 1.0, 0.0 },
+  { "bow", elements::POT_EXCITER_BOW_LEVEL, 0.0, 1.0, 0.0 },
+  { "blow", elements::POT_EXCITER_BLOW_LEVEL, 0.0, 1.0, 0.0 },
+  { "strike", elements::POT_EXCITER_STRIKE_LEVEL, 0.0, 1.0, 0.0 },
+  { "flow", elements::POT_EXCITER_BLOW_META, 0.0, 1.0, 0.0 },
+  { "mallet", elements::POT_EXCITER_STRIKE_META, 0.0, 1.0, 0.0 },
+  { "bow_timbre", elements::POT_EXCITER_BOW_TIMBRE, 0.0, 1.0, 0.0 },
+  { "blow_timbre", elements::POT_EXCITER_BLOW_TIMBRE, 0.0, 1.0, 0.0 },
+  { "strike_timbre", elements::POT_EXCITER_STRIKE_TIMBRE, 0.0, 1.0, 0.0 },
+  { "coarse", elements::POT_RESONATOR_COARSE, 0.0, 60.0, 39.0 },
+  { "fine", elements::POT_RESONATOR_FINE, -1.0, 1.0, 0.0 },
+  { "fm", elements::POT_RESONATOR_FM_ATTENUVERTER, -1.0, 1.0, 0.0 },
+  { "geometry", elements::POT_RESONATOR_GEOMETRY, 0.0, 1.0, 0.0 },
+  { "brightness", elements::POT_RESONATOR_BRIGHTNESS, 0.0, 1.0, 0.0 },
+  { "damping", elements::POT_RESONATOR_DAMPING, 0.0, 1.0, 0.0 },
+  { "position", elements::POT_RESONATOR_POSITION, 0.0, 1.0, 0.0 },
+  { "space", elements::POT_SPACE, 0.0, 1.11, 0.0 },
+};
+
+class ElementsModule : public Module {
+ public:
+  ElementsModule() : part_(NULL), reverb_buffer_(NULL) { }
+  ~ElementsModule() {
+    delete part_;
+    free(reverb_buffer_);
+  }
+
+  const char* name() const { return "elmnts"; }
+  int num_inputs() const { return 16; }
+  int num_outputs() const { return 2; }
+  int num_audio_inputs() const { return 2; }
+  int block_size() const { return kBlockSize; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    uigate_ = false;
+    gate_connected_ = false;
+    memset(&ps_, 0, sizeof(ps_));
+
+    reverb_buffer_ = static_cast<uint16_t*>(calloc(32768, sizeof(uint16_t)));
+    if (!reverb_buffer_) {
+      return false;
+    }
+    read_inputs_.Init();
+
+    // Init and seed the random parameters and generators with the serial number.
+    part_ = NewZeroed<elements::Part>();
+    part_->Init(reverb_buffer_, elements::Dsp());
+    // The hardware passes the 3 words of its unique id (at 0x1fff7a10).
+    uint32_t seed[3] = { 0x1fff7a10, 0, 0 };
+    part_->Seed(seed, 3);
+    part_->set_easter_egg(false);
+
+    if (sample_rate != part_->dsp().getSr()) {
+      part_->Init(reverb_buffer_, elements::Dsp(sample_rate));
+    }
+    sleep_detector_.Init(part_->dsp().getSr());
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 15) {
+      gate_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    for (size_t i = 0; i < sizeof(kPotMessages) / sizeof(kPotMessages[0]); ++i) {
+      const PotMessage& pot = kPotMessages[i];
+      if (!strcmp(s, pot.selector)) {
+        m = Clamp(m, pot.min, 1.);
+        read_inputs_.ReadPanelPot(pot.pot, m * pot.scale + pot.offset);
+        return true;
+      }
+    }
+    if (!strcmp(s, "float")) {
+      if (inlet >= 5 && inlet <= 14) {
+        read_inputs_.ReadPanelPot(kAttenuverters[inlet - 5], Clamp(m, -1., 1.));
+      }
+    } else if (!strcmp(s, "int")) {
+      // nothing to do
+    } else if (!strcmp(s, "note")) {
+      read_inputs_.ReadPanelPot(elements::POT_RESONATOR_COARSE, m);
+    } else if (!strcmp(s, "play")) {
+      uigate_ = n != 0;
+    } else if (!strcmp(s, "model")) {
+      n = Clamp(n, 0L, 2L);
+      part_->set_resonator_model(static_cast<elements::ResonatorModel>(n));
+      read_inputs_.set_resonator_model(part_->resonator_model());
+    } else if (!strcmp(s, "bypass")) {
+      part_->set_bypass(n != 0);
+    } else if (!strcmp(s, "easteregg")) {
+      part_->set_easter_egg(n != 0);
+    } else if (!strcmp(s, "sleep")) {
+      sleep_detector_.set_enabled(n != 0);
+    } else if (!strcmp(s, "sleep_threshold")) {
+      sleep_detector_.set_threshold(Clamp(m, -140., 0.));
+    } else if (!strcmp(s, "sleep_time")) {
+      sleep_detector_.set_hang_time(Clamp(m, 10., 60000.));
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+    double* blow_in = ins[0];
+    double* strike_in = ins[1];
+    double* outL = outs[0];
+    double* outR = outs[1];
+    double* gate_in = ins[15];
+    size_t size = kBlockSize;
+
+    double* cvinputs = read_inputs_.cv_floats;
+    int numcvs = elements::CV_ADC_CHANNEL_LAST;
+    elements::PerformanceState* ps = &ps_;
+
+    ps->gate = uigate_;
+
+    for (long count = 0; count < vs; count += size) {
+      // read 'cv' input signals, store only first value of a block
+      for (int j = 0; j < numcvs; ++j) {
+        cvinputs[j] = ins[j + 2][count];
+      }
+      if (gate_connected_) {
+        double trigger = vbmi::vec::Sum(gate_in + count, size);
+        ps->gate |= trigger != 0.0;
+      }
+      read_inputs_.Read(part_->mutable_patch(), ps);
+
+      // a held gate keeps the voice awake
+      double in_peak = std::max(vbmi::vec::MaxAbs(blow_in + count, size),
+                                vbmi::vec::MaxAbs(strike_in + count, size));
+      if (!sleep_detector_.Awake(in_peak, ps->gate)) {
+        memset(outL + count, 0, size * sizeof(double));
+        memset(outR + count, 0, size * sizeof(double));
+        continue;
+      }
+
+      vbmi::vec::Convert(blow_in + count, blow_, size);
+      vbmi::vec::Convert(strike_in + count, strike_, size);
+      part_->Process(*ps, blow_, strike_, main_, aux_, size);
+      vbmi::vec::Convert(main_, outL + count, size);
+      vbmi::vec::Convert(aux_, outR + count, size);
+
+      double out_peak = std::max(vbmi::vec::MaxAbs(outL + count, size),
+                                 vbmi::vec::MaxAbs(outR + count, size));
+      sleep_detector_.Update(out_peak, size);
+    }
+    SoftLimit(outL, vs);
+    SoftLimit(outR, vs);
+  }
+
+ private:
+  static void SoftLimit(double* inout, size_t size) {
+    while (size--) {
+      double x = *inout * 0.5;
+      double x2 = x * x;
+      *inout++ = x * (27.0 + x2) / (27.0 + 9.0 * x2);
+    }
+  }
+
+  elements::Part* part_;
+  elements::PerformanceState ps_;
+  elements::ReadInputs read_inputs_;
+  SleepDetector sleep_detector_;
+  uint16_t* reverb_buffer_;
+  real_t blow_[kBlockSize];
+  real_t strike_[kBlockSize];
+  real_t main_[kBlockSize];
+  real_t aux_[kBlockSize];
+  bool uigate_;
+  bool gate_connected_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* VBMI_FACTORY(elements)() {
+  return new vbmi::ElementsModule;
+}
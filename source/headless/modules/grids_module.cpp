@@ -0,0 +1,238 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.grds~
+
+
+#include <cstring>
+
+#include "module.h"
+
+#include "avrlib/op.h"
+#include "grids/clock.h"
+#include "grids/pattern_generator.h"
+
+
+namespace vbmi {
+
+const uint8_t kCountMax = 4;
+const uint8_t ticks_granularity[] = { 6, 3, 1 };
+
+class GridsModule : public Module {
+ public:
+  GridsModule() { }
+  ~GridsModule() { }
+
+  const char* name() const { return "grds"; }
+  int num_inputs() const { return 8; }
+  int num_outputs() const { return 8; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return 1; }
+
+  bool Init(double sample_rate) {
+    sr_ = sample_rate;
+    c_ = ((1LL << 32) * 8) / (120 * sr_ / kCountMax);
+    clock_.Init(c_);
+    pattern_generator_.Init();
+
+    swing_amount_ = 0;
+    count_ = 0;
+    previous_clock_in_ = previous_reset_in_ = false;
+    reset_connected_ = false;
+    ext_clock_ = 0;
+    start_ = false;
+
+    grids::PatternGeneratorSettings* settings = pattern_generator_.mutable_settings();
+    settings->options.drums.x = 128;
+    settings->options.drums.y = 128;
+    settings->options.drums.randomness = 128;
+    settings->density[0] = 64;
+    settings->density[1] = 128;
+    settings->density[2] = 192;
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 7) {
+      reset_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    grids::PatternGeneratorSettings* settings = pattern_generator_.mutable_settings();
+    if (!strcmp(s, "int")) {
+      if (inlet == 0) {
+        start_ = n != 0;
+      }
+    } else if (!strcmp(s, "float")) {
+      if (inlet == 0) {
+        double bpm = Clamp(m, 20.0, 511.0);
+        if (bpm != clock_.bpm() && !clock_.locked()) {
+          clock_.Update_f(bpm, c_, pattern_generator_.clock_resolution());
+        }
+      } else if (inlet < 7) {
+        uint8_t mm = m * 255.0;
+        if (inlet == 1)
+          settings->options.drums.x = mm;
+        else if (inlet == 2)
+          settings->options.drums.y = mm;
+        else if (inlet == 3)
+          settings->options.drums.randomness = mm;
+        else
+          settings->density[inlet - 4] = mm;
+      }
+    } else if (!strcmp(s, "bang")) {
+      pattern_generator_.Reset();    // stay in time
+      if (clock_.locked()) {
+        clock_.Reset();            // if externally clocked, reset immediately!
+      }
+    } else if (!strcmp(s, "reset")) {
+      pattern_generator_.Reset();
+      clock_.Reset();
+    } else if (!strcmp(s, "euclid")) {
+      if (argc < 3) {
+        return false;
+      }
+      uint8_t index = Clamp(static_cast<long>(argv[0]), 0L, 2L);
+      uint8_t steps = Clamp(static_cast<long>(argv[1]), 1L, 32L);
+      uint8_t notes = Clamp(static_cast<long>(argv[2]), 0L, 32L);
+      settings->options.euclidean_length[index] = (steps - 1) << 3;
+      settings->density[index] = ((float)notes / (float)steps) * 255.0;
+    } else if (!strcmp(s, "mode")) {
+      pattern_generator_.set_output_mode(n == 0);
+    } else if (!strcmp(s, "swing")) {
+      pattern_generator_.set_swing(n != 0);
+    } else if (!strcmp(s, "ext_clock")) {
+      ext_clock_ = n != 0;
+    } else if (!strcmp(s, "config")) {
+      pattern_generator_.set_output_clock(n != 0);
+    } else if (!strcmp(s, "resolution")) {
+      pattern_generator_.set_clock_resolution(Clamp(n, 0L, 2L));
+      clock_.Update_f(clock_.bpm(), c_, pattern_generator_.clock_resolution());
+      pattern_generator_.Reset();
+    } else if (!strcmp(s, "gate_mode")) {
+      pattern_generator_.set_gate_mode(n != 0);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    double* clock_input = ins[0];
+    double* reset_input = ins[7];
+
+    if (!start_) {
+      for (int k = 0; k < 8; ++k) {
+        memset(outs[k], 0, vs * sizeof(double));
+      }
+      return;
+    }
+
+    grids::Clock* clock = &clock_;
+    grids::PatternGenerator* pattern_generator = &pattern_generator_;
+    uint8_t state = pattern_generator->state();
+    uint8_t count = count_;
+    bool previous_clock_in = previous_clock_in_;
+    bool previous_reset_in = previous_reset_in_;
+    uint8_t increment = ticks_granularity[pattern_generator->clock_resolution()];
+    uint16_t sum_clock_in = 0;
+    uint16_t sum_reset_in = 0;
+
+    for (long i = 0; i < vs; ++i) {
+      sum_clock_in += (clock_input[i] > 0.1);
+      sum_reset_in += (reset_input[i] > 0.1);
+
+      if (count >= kCountMax) {
+        count = 0;
+        uint8_t num_ticks = 0;
+
+        if (ext_clock_) {
+          bool clock_in = (sum_clock_in > 0);
+          if (clock_in && !previous_clock_in) {
+            num_ticks = increment;
+          } else if (!clock_in && previous_clock_in) {
+            pattern_generator->ClockFallingEdge();
+            sum_clock_in = 0;
+          }
+          previous_clock_in = clock_in;
+        } else {
+          clock->Tick();
+          clock->Wrap(swing_amount_);
+          if (clock->raising_edge()) {
+            num_ticks = increment;
+          }
+          if (clock->past_falling_edge()) {
+            pattern_generator->ClockFallingEdge();
+          }
+        }
+
+        if (reset_connected_) {
+          bool reset_in = (sum_reset_in > 0);
+          if (reset_in && !previous_reset_in)
+            pattern_generator->Reset();
+          else if (!reset_in && previous_reset_in)
+            sum_reset_in = 0;
+          previous_reset_in = reset_in;
+        }
+
+        if (num_ticks) {
+          swing_amount_ = pattern_generator->swing_amount();
+          pattern_generator->TickClock(num_ticks);
+        }
+        state = pattern_generator->state();
+        pattern_generator->IncrementPulseCounter();
+      }
+      count++;
+
+      // decode 'state' into output triggers/gates
+      for (int k = 0; k < 8; ++k) {
+        outs[k][i] = (state >> k) & 1;
+      }
+    }
+    count_ = count;
+    previous_clock_in_ = previous_clock_in;
+    previous_reset_in_ = previous_reset_in;
+  }
+
+ private:
+  grids::Clock clock_;
+  grids::PatternGenerator pattern_generator_;
+  uint8_t swing_amount_;
+  uint8_t count_;
+  double sr_;
+  double c_;
+  bool previous_clock_in_, previous_reset_in_;
+  bool reset_connected_;
+  uint8_t ext_clock_;
+  bool start_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_grids() {
+  return new vbmi::GridsModule;
+}
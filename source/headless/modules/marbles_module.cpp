@@ -0,0 +1,433 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.mrbls~
+//
+// The external seeds its random generator with time(NULL). Offline renders
+// should be reproducible, so a fixed seed is used instead, which can be
+// changed with the 'seed' message.
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "module.h"
+
+#include "dsp.h"
+#include "read_inputs.hpp"
+#include "vector_ops.h"
+
+#include "marbles/ramp/ramp_extractor.h"
+#include "marbles/random/random_generator.h"
+#include "marbles/random/random_stream.h"
+#include "marbles/random/t_generator.h"
+#include "marbles/random/x_y_generator.h"
+#include "marbles/resources.h"
+#include "marbles/scale_recorder.h"
+#include "marbles/settings.h"
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/utils/gate_flags.h"
+
+
+namespace vbmi {
+
+using namespace marbles;
+
+const uint32_t kDefaultSeed = 0x21;
+
+static const Ratio y_divider_ratios[] = {
+  { 1, 64 },
+  { 1, 48 },
+  { 1, 32 },
+  { 1, 24 },
+  { 1, 16 },
+  { 1, 12 },
+  { 1, 8 },
+  { 1, 6 },
+  { 1, 4 },
+  { 1, 3 },
+  { 1, 2 },
+  { 1, 1 },
+};
+
+class MarblesModule : public Module {
+ public:
+  MarblesModule() { }
+  ~MarblesModule() { }
+
+  const char* name() const { return "mrbls"; }
+  int num_inputs() const { return 10; }
+  int num_outputs() const { return 7; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return ::kBlockSize; }
+
+  bool Init(double sample_rate) {
+    sr_ = sample_rate > 0 ? sample_rate : 44100.0f;
+    record_scale_ = false;
+    clock_connected_[0] = clock_connected_[1] = false;
+    std::fill(&parameters_[0], &parameters_[kNumParameters], 0.0f);
+    memset(&block_, 0, sizeof(block_));
+    memset(&x_, 0, sizeof(x_));
+    memset(&y_, 0, sizeof(y_));
+    memset(voltages_, 0, sizeof(voltages_));
+    memset(ramp_buffer_, 0, sizeof(ramp_buffer_));
+    memset(gates_, 0, sizeof(gates_));
+
+    settings_.Init();
+    read_inputs_.Init(settings_.mutable_calibration_data());
+    scale_recorder_.Init();
+    Seed(kDefaultSeed);
+
+    // init paramters
+    block_.adc_value[ADC_CHANNEL_T_RATE] = 0.5f;
+    block_.adc_value[ADC_CHANNEL_T_BIAS] = 0.5f;
+    block_.adc_value[ADC_CHANNEL_T_JITTER] = 0.0f;
+    block_.adc_value[ADC_CHANNEL_DEJA_VU_AMOUNT] = 0.0f;
+    block_.adc_value[ADC_CHANNEL_DEJA_VU_LENGTH] = 0.0f;
+    block_.adc_value[ADC_CHANNEL_X_SPREAD] = 0.5f;
+    block_.adc_value[ADC_CHANNEL_X_BIAS] = 0.5f;
+    block_.adc_value[ADC_CHANNEL_X_STEPS] = 0.5f;
+
+    x_.length = 5;
+    x_.ratio.p = 1;
+    x_.ratio.q = 1;
+
+    y_.bias = 0.5f;
+    y_.spread = 0.5f;
+    y_.steps = 0.0f;
+    y_.ratio = y_divider_ratios[6];
+    y_.control_mode = CONTROL_MODE_IDENTICAL;
+    y_.deja_vu = 0.f;
+    y_.length = 1;
+    y_.register_mode = false;
+    y_.register_value = 0.0f;
+    y_.voltage_range = VOLTAGE_RANGE_FULL;
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 0) {
+      clock_connected_[0] = connected;
+    } else if (inlet == ADC_CHANNEL_LAST + 1) {
+      clock_connected_[1] = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    float* adc_value = block_.adc_value;
+    State* state = settings_.mutable_state();
+    if (!strcmp(s, "int")) {
+      if (inlet == 0) {
+        block_.input_patched[0] = n != 0;
+      } else if (inlet == 5) {
+        SetLength(n);
+      } else if (inlet == 9) {
+        block_.input_patched[1] = n != 0;
+      }
+    } else if (!strcmp(s, "float")) {
+      static const int kFloatInlets[] = {
+        -1, ADC_CHANNEL_T_RATE, ADC_CHANNEL_T_BIAS, ADC_CHANNEL_T_JITTER,
+        ADC_CHANNEL_DEJA_VU_AMOUNT, -1, ADC_CHANNEL_X_SPREAD,
+        ADC_CHANNEL_X_BIAS, ADC_CHANNEL_X_STEPS, -1
+      };
+      if (inlet >= 0 && inlet < 10 && kFloatInlets[inlet] >= 0) {
+        adc_value[kFloatInlets[inlet]] = Clamp(m, 0., 1.);
+      }
+    } else if (!strcmp(s, "rate")) {
+      adc_value[ADC_CHANNEL_T_RATE] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "bpm")) {
+      double bpm = Clamp(m, 10., 800.) * 0.008333;
+      adc_value[ADC_CHANNEL_T_RATE] = (log2(bpm) * 12.0 + 60) * 0.008333;
+    } else if (!strcmp(s, "t_bias")) {
+      adc_value[ADC_CHANNEL_T_BIAS] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "jitter")) {
+      adc_value[ADC_CHANNEL_T_JITTER] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "dejavu")) {
+      adc_value[ADC_CHANNEL_DEJA_VU_AMOUNT] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "length")) {
+      SetLength(n);
+    } else if (!strcmp(s, "spread")) {
+      adc_value[ADC_CHANNEL_X_SPREAD] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "xbias")) {
+      adc_value[ADC_CHANNEL_X_BIAS] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "steps")) {
+      adc_value[ADC_CHANNEL_X_STEPS] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "t")) {
+      state->t_deja_vu = n == 1 ? DEJA_VU_ON : (n == 2 ? DEJA_VU_LOCKED : DEJA_VU_OFF);
+    } else if (!strcmp(s, "x")) {
+      state->x_deja_vu = n == 1 ? DEJA_VU_ON : (n == 2 ? DEJA_VU_LOCKED : DEJA_VU_OFF);
+    } else if (!strcmp(s, "x_ext")) {
+      state->x_register_mode = n != 0;
+      x_.register_mode = n != 0;
+    } else if (!strcmp(s, "set_scale")) {
+      SetScale(argc, argv);
+    } else if (!strcmp(s, "record_scale")) {
+      RecordScale(n != 0);
+    } else if (!strcmp(s, "t_model")) {
+      n = Clamp(n, 0L, 2L);
+      state->t_model = n;
+      t_generator_.set_model(TGeneratorModel(n));
+    } else if (!strcmp(s, "t_range")) {
+      n = Clamp(n, 0L, 2L);
+      state->t_range = n;
+      t_generator_.set_range(TGeneratorRange(n));
+    } else if (!strcmp(s, "x_mode")) {
+      n = Clamp(n, 0L, 2L);
+      state->x_control_mode = n;
+      x_.control_mode = ControlMode(n);
+    } else if (!strcmp(s, "x_range")) {
+      n = Clamp(n, 0L, 2L);
+      state->x_range = n;
+      SetXRange(n);
+    } else if (!strcmp(s, "x_scale")) {
+      n = Clamp(n, 0L, 5L);
+      state->x_scale = n;
+      x_.scale_index = y_.scale_index = n;
+    } else if (!strcmp(s, "y_div")) {
+      m = Clamp(m, 0., 1.);
+      y_.ratio = y_divider_ratios[static_cast<uint16_t>((m * 11.0) + 0.5)];
+    } else if (!strcmp(s, "y_spread")) {
+      y_.spread = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "y_bias")) {
+      y_.bias = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "y_steps")) {
+      y_.steps = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "seed")) {
+      Seed(static_cast<uint32_t>(n));
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    for (long count = 0; count < vs; count += ::kBlockSize) {
+      Render(ins, outs, ::kBlockSize, count);
+    }
+  }
+
+ private:
+  void Seed(uint32_t seed) {
+    random_generator_.Init(seed);
+    random_stream_.Init(&random_generator_);
+    t_generator_.Init(&random_stream_, sr_);
+    xy_generator_.Init(&random_stream_, sr_);
+    for (size_t i = 0; i < kNumScales; ++i) {
+      xy_generator_.LoadScale(i, settings_.persistent_data().scale[i]);
+    }
+  }
+
+  void SetLength(long m) {
+    m = Clamp(static_cast<int>(m), 1, 16);
+    t_generator_.set_length(m);
+    x_.length = m;
+  }
+
+  void SetXRange(long m) {
+    for (size_t i = 0; i < kNumXChannels; ++i) {
+      OutputChannel& channel = xy_generator_.output_channel_[i];
+      switch (m) {
+        case VOLTAGE_RANGE_NARROW:
+          channel.set_scale_offset(ScaleOffset(2.0f, 0.0f));
+          break;
+        case VOLTAGE_RANGE_POSITIVE:
+          channel.set_scale_offset(ScaleOffset(5.0f, 0.0f));
+          break;
+        case VOLTAGE_RANGE_FULL:
+          channel.set_scale_offset(ScaleOffset(10.0f, -5.0f));
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  void RecordScale(bool record) {
+    if (record) {
+      record_scale_ = true;
+      scale_recorder_.Clear();
+    } else {
+      int scale_index = settings_.state().x_scale;
+      record_scale_ = false;
+      if (scale_recorder_.ExtractScale(settings_.mutable_scale(scale_index))) {
+        settings_.set_dirty_scale_index(scale_index);
+      }
+    }
+  }
+
+  void SetScale(int argc, const double* argv) {
+    int scale_index = settings_.state().x_scale;
+    argc = std::min(argc, 256);
+    if (argc > 0) {
+      scale_recorder_.Clear();
+      for (int i = 0; i < argc; ++i) {
+        float voltage = argv[i] / 12.0f;
+        scale_recorder_.NewNote(voltage);
+        scale_recorder_.UpdateVoltage(voltage);
+        scale_recorder_.AcceptNote();
+      }
+      if (!scale_recorder_.ExtractScale(settings_.mutable_scale(scale_index))) {
+        return;
+      }
+    } else {
+      settings_.ResetScale(scale_index);
+    }
+    settings_.set_dirty_scale_index(scale_index);
+  }
+
+  void Render(double** ins, double** outs, size_t size, long offset) {
+    float* parameters = parameters_;
+    Block* block = &block_;
+    Ramps ramps;
+    GroupSettings x = x_;
+    GroupSettings y = y_;
+
+    stmlib::GateFlags* t_clock = block->input[0];
+    stmlib::GateFlags* xy_clock = block->input[1];
+
+    // just copy first value from cv inputs
+    for (int i = 0; i < ADC_CHANNEL_LAST; ++i) {
+      block->adc_value[i + ADC_GROUP_CV] = ins[i + 1][offset];
+    }
+    // apply scaling for cv rate input
+    block->adc_value[ADC_CHANNEL_T_RATE + ADC_GROUP_CV] *= 60.0f;
+
+    ClockSource xy_clock_source = CLOCK_SOURCE_INTERNAL_T1_T2_T3;
+    uint8_t in_clocks[2] = { 0, 0 };
+
+    if (clock_connected_[0] && block->input_patched[0]) {
+      double vectorsum = vbmi::vec::Sum(ins[0] + offset, size);
+      if (vectorsum > 0.5) in_clocks[0] = 255;
+    }
+    if (clock_connected_[1] && block->input_patched[1]) {
+      xy_clock_source = CLOCK_SOURCE_EXTERNAL;
+      double vectorsum = vbmi::vec::Sum(ins[ADC_CHANNEL_LAST + 1] + offset, size);
+      if (vectorsum > 0.5) in_clocks[1] = 255;
+    }
+    read_inputs_.ReadClocks(block, size, in_clocks);
+    read_inputs_.Process(&block->adc_value[0], parameters);
+
+    float deja_vu = parameters[ADC_CHANNEL_DEJA_VU_AMOUNT];
+    //  Deadband near 12 o'clock for the deja vu parameter.
+    if (deja_vu < 0.47f) {
+      deja_vu *= 1.06382978723f;
+    } else if (deja_vu > 0.53f) {
+      deja_vu = 0.5f + (deja_vu - 0.53f) * 1.06382978723f;
+    } else {
+      deja_vu = 0.5f;
+    }
+
+    ramps.master = &ramp_buffer_[0];
+    ramps.external = &ramp_buffer_[::kBlockSize];
+    ramps.slave[0] = &ramp_buffer_[::kBlockSize * 2];
+    ramps.slave[1] = &ramp_buffer_[::kBlockSize * 3];
+
+    const State& state = settings_.state();
+    t_generator_.set_rate(parameters[ADC_CHANNEL_T_RATE]);
+    t_generator_.set_bias(parameters[ADC_CHANNEL_T_BIAS]);
+    t_generator_.set_jitter(parameters[ADC_CHANNEL_T_JITTER]);
+    t_generator_.set_deja_vu(state.t_deja_vu == DEJA_VU_LOCKED
+                             ? 0.5f
+                             : (state.t_deja_vu == DEJA_VU_ON ? deja_vu : 0.0f));
+    t_generator_.Process(block->input_patched[0], t_clock, ramps, gates_, size);
+
+    // only take external voltages from x_spread_2 input, vb
+    float note_cv = read_inputs_.channel(ADC_CHANNEL_X_SPREAD_2).scaled_raw_cv();
+    float u = 0.5f * (note_cv + 1.0f);
+
+    if (record_scale_) {
+      float voltage = (u - 0.5f) * 10.0f;
+      for (size_t i = 0; i < size; ++i) {
+        stmlib::GateFlags gate = block->input_patched[1]
+            ? block->input[1][i]
+            : static_cast<stmlib::GateFlags>(stmlib::GATE_FLAG_LOW);
+        if (gate & stmlib::GATE_FLAG_RISING) {
+          scale_recorder_.NewNote(voltage);
+        }
+        if (gate & stmlib::GATE_FLAG_HIGH) {
+          scale_recorder_.UpdateVoltage(voltage);
+        }
+        if (gate & stmlib::GATE_FLAG_FALLING) {
+          scale_recorder_.AcceptNote();
+        }
+      }
+      std::fill(&voltages_[0], &voltages_[4 * size], voltage);
+    } else {
+      x.register_value = u;
+      x.spread = parameters[ADC_CHANNEL_X_SPREAD];
+      x.bias = parameters[ADC_CHANNEL_X_BIAS];
+      x.steps = parameters[ADC_CHANNEL_X_STEPS];
+      x.deja_vu = state.x_deja_vu == DEJA_VU_LOCKED
+          ? 0.5f
+          : (state.x_deja_vu == DEJA_VU_ON ? deja_vu : 0.0f);
+
+      if (settings_.dirty_scale_index() != -1) {
+        int i = settings_.dirty_scale_index();
+        xy_generator_.LoadScale(i, settings_.persistent_data().scale[i]);
+        settings_.set_dirty_scale_index(-1);
+      }
+      xy_generator_.Process(xy_clock_source, x, y, xy_clock, ramps, voltages_, size);
+    }
+
+    const float* v = voltages_;
+    const bool* g = gates_;
+    for (size_t i = 0; i < size; ++i) {
+      long idx = i + offset;
+      outs[0][idx] = *g++;  // t1
+      outs[1][idx] = ramps.master[i] < 0.5f;    // t2
+      outs[2][idx] = *g++;  // t3
+      outs[4][idx] = *v++;  // X1
+      outs[5][idx] = *v++;  // X2
+      outs[6][idx] = *v++;  // X3
+      outs[3][idx] = *v++;  // y
+    }
+  }
+
+  ReadInputs read_inputs_;
+  Block block_;
+  ScaleRecorder scale_recorder_;
+  Settings settings_;
+  RandomGenerator random_generator_;
+  RandomStream random_stream_;
+  TGenerator t_generator_;
+  XYGenerator xy_generator_;
+  GroupSettings x_, y_;
+
+  float voltages_[::kBlockSize * 4];
+  float ramp_buffer_[::kBlockSize * 4];
+  bool gates_[::kBlockSize * 2];
+  bool record_scale_;
+  bool clock_connected_[2];
+  float parameters_[kNumParameters];
+  float sr_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_marbles() {
+  return new vbmi::MarblesModule;
+}
@@ -0,0 +1,277 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.plts~
+
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+#include "module.h"
+
+#include "stmlib/utils/buffer_allocator.h"
+#include "stmlib/dsp/dsp.h"
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/voice.h"
+#include "plaits/dsp/poly_voice.h"
+#include "stmlib/utils/random.h"
+#include "vector_ops.h"
+
+namespace vbmi {
+
+const size_t kBlockSize = plaits::kBlockSize;
+const size_t kSharedBufferSize = 32768;
+const size_t kPoolSizePerVoice = 17408;  // 17 kB
+
+class PlaitsModule : public Module {
+ public:
+  PlaitsModule()
+      : voice_(NULL),
+        poly_(NULL),
+        poly_voices_(NULL),
+        shared_buffer_(NULL) { }
+  ~PlaitsModule() { Free(); }
+
+  const char* name() const { return "plts"; }
+  int num_inputs() const { return 8; }
+  int num_outputs() const { return 2; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return kBlockSize; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    sr_ = sample_rate > 0.0 ? sample_rate : 44100.0;
+
+    memset(&patch_, 0, sizeof(patch_));
+    memset(&modulations_, 0, sizeof(modulations_));
+
+    // init some params
+    transposition_ = 0.;
+    octave_ = 0.5;
+    patch_.note = 48.0;
+    patch_.harmonics = 0.1;
+    patch_.decay = 0.333;
+    patch_.lpg_colour = 0.5;
+    morph_pot_ = 0.0;
+    harm_pot_ = 0.0;
+    timb_pot_ = 0.0;
+    trigger_connected_ = false;
+    trigger_toggle_ = false;
+
+    return Allocate(1, kSharedBufferSize);
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 6) {
+      trigger_connected_ = connected;
+      modulations_.trigger_patched = trigger_toggle_ && trigger_connected_;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    if (!strcmp(s, "int")) {
+      switch (inlet) {
+        case 0: patch_.engine = Clamp(n, 0L, 23L); break;
+        case 2: modulations_.frequency_patched = n != 0; break;
+        case 4: modulations_.timbre_patched = n != 0; break;
+        case 5: modulations_.morph_patched = n != 0; break;
+        case 6:
+          trigger_toggle_ = n != 0;
+          modulations_.trigger_patched = trigger_toggle_ && trigger_connected_;
+          break;
+        case 7: modulations_.level_patched = n != 0; break;
+        default: break;
+      }
+    } else if (!strcmp(s, "float")) {
+      switch (inlet) {
+        case 1:
+          transposition_ = Clamp(m, -1., 1.);
+          CalcNote();
+          break;
+        case 3: harm_pot_ = Clamp(m, 0., 1.); break;
+        case 4: timb_pot_ = Clamp(m, 0., 1.); break;
+        case 5: morph_pot_ = Clamp(m, 0., 1.); break;
+        default: break;
+      }
+    } else if (!strcmp(s, "engine")) {
+      patch_.engine = n;
+    } else if (!strcmp(s, "frequency")) {
+      transposition_ = Clamp(m, -1., 1.);
+      CalcNote();
+    } else if (!strcmp(s, "harmonics")) {
+      harm_pot_ = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "timbre")) {
+      timb_pot_ = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "morph")) {
+      morph_pot_ = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "morph_mod")) {
+      patch_.morph_modulation_amount = Clamp(m, -1., 1.);
+    } else if (!strcmp(s, "timbre_mod")) {
+      patch_.timbre_modulation_amount = Clamp(m, -1., 1.);
+    } else if (!strcmp(s, "freq_mod")) {
+      patch_.frequency_modulation_amount = Clamp(m, -1., 1.);
+    } else if (!strcmp(s, "octave")) {
+      octave_ = Clamp(m, 0., 1.);
+      CalcNote();
+    } else if (!strcmp(s, "lpg_colour")) {
+      patch_.lpg_colour = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "decay")) {
+      patch_.decay = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "note")) {
+      patch_.note = m;
+    } else if (!strcmp(s, "voices")) {
+      // the object's arguments: number of voices, engine pool size in kB
+      long num_voices = Clamp(n, 1L, long(plaits::kMaxPolyphony));
+      size_t pool_size = argc > 1
+          ? static_cast<size_t>(argv[1]) * 1024
+          : num_voices * kPoolSizePerVoice;
+      Free();
+      return Allocate(num_voices, pool_size);
+    } else if (!strcmp(s, "midinote")) {
+      if (poly_ && argc > 1) {
+        if (argv[1] > 0.0) {
+          poly_->NoteOn(m, Clamp(argv[1], 0., 127.) / 127.);
+        } else {
+          poly_->NoteOff(m);
+        }
+      }
+    } else if (!strcmp(s, "flush")) {
+      if (poly_) {
+        poly_->AllNotesOff();
+      }
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+    double* out = outs[0];
+    double* aux = outs[1];
+    double* trig_input = ins[6];
+    size_t size = kBlockSize;
+    plaits::Patch* p = &patch_;
+
+    // copy first value of signal inlets into corresponding params
+    real_t* destination = &modulations_.engine;
+
+    for (long count = 0; count < vs; count += size) {
+      // parameter smoothing
+      ONE_POLE(p->morph, morph_pot_, 0.012);
+      ONE_POLE(p->harmonics, harm_pot_, 0.012);
+      ONE_POLE(p->timbre, timb_pot_, 0.012);
+
+      for (int i = 0; i < 8; ++i) {
+        destination[i] = ins[i][count];
+      }
+
+      if (modulations_.trigger_patched) {
+        double vectorsum = vbmi::vec::Sum(trig_input + count, size);
+        modulations_.trigger = vectorsum;
+      }
+      if (poly_) {
+        poly_->Render(*p, modulations_, out_, aux_, size);
+      } else {
+        voice_->Render(*p, modulations_, out_, aux_, size);
+      }
+      vbmi::vec::Convert(out_, out + count, size);
+      vbmi::vec::Convert(aux_, aux + count, size);
+    }
+  }
+
+ private:
+  bool Allocate(long num_voices, size_t pool_size) {
+    pool_size = std::max(pool_size, kSharedBufferSize);
+    if (num_voices == 1) {
+      pool_size = kSharedBufferSize;
+    }
+    shared_buffer_ = static_cast<char*>(calloc(pool_size, 1));
+    if (!shared_buffer_) {
+      return false;
+    }
+    if (num_voices > 1) {
+      poly_voices_ = new plaits::Voice[num_voices];
+      poly_ = new plaits::PolyVoice;
+      return poly_->Init(poly_voices_, num_voices, shared_buffer_, pool_size,
+                         plaits::Dsp(sr_));
+    }
+    stmlib::BufferAllocator allocator(shared_buffer_, kSharedBufferSize);
+    voice_ = new plaits::Voice;
+    voice_->Init(&allocator, plaits::Dsp(sr_));
+    return true;
+  }
+
+  void Free() {
+    delete voice_;
+    delete poly_;
+    delete[] poly_voices_;
+    free(shared_buffer_);
+    voice_ = NULL;
+    poly_ = NULL;
+    poly_voices_ = NULL;
+    shared_buffer_ = NULL;
+  }
+
+  void CalcNote() {
+    int octave = static_cast<int>(octave_ * 9.0);
+    if (octave < 8) {
+      const double fine = transposition_ * 7.0;
+      patch_.note = fine + static_cast<double>(octave) * 12.0 + 12.0;
+    } else {
+      patch_.note = 60.0 + transposition_ * 48.0;
+    }
+  }
+
+  plaits::Voice* voice_;
+  plaits::PolyVoice* poly_;
+  plaits::Voice* poly_voices_;
+  plaits::Modulations modulations_;
+  plaits::Patch patch_;
+  char* shared_buffer_;
+  real_t out_[kBlockSize];
+  real_t aux_[kBlockSize];
+
+  double transposition_;
+  double octave_;
+  double morph_pot_;
+  double harm_pot_;
+  double timb_pot_;
+  double sr_;
+  bool trigger_connected_;
+  bool trigger_toggle_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* VBMI_FACTORY(plaits)() {
+  return new vbmi::PlaitsModule;
+}
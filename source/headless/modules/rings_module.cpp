@@ -0,0 +1,266 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.rngs~
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#include "module.h"
+
+#include "read_inputs.h"
+#include "control_inputs.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
+
+#include "rings/dsp/part.h"
+#include "rings/dsp/strummer.h"
+#include "rings/dsp/string_synth_part.h"
+#include "rings/dsp/dsp.h"
+#include "stmlib/utils/random.h"
+
+namespace vbmi {
+
+const int kBlockSize = rings::kMaxBlockSize;
+
+class RingsModule : public Module {
+ public:
+  RingsModule() : reverb_buffer_(NULL) { }
+  ~RingsModule() { free(reverb_buffer_); }
+
+  const char* name() const { return "rngs"; }
+  int num_inputs() const { return 8; }
+  int num_outputs() const { return 2; }
+  int num_audio_inputs() const { return 1; }
+  int block_size() const { return kBlockSize; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    sr_ = sample_rate > 0.0 ? sample_rate : 48000.0;
+
+    performance_state_.internal_exciter = true;
+    performance_state_.internal_strum = true;
+    performance_state_.internal_note = true;
+
+    for (int i = 0; i < rings::ADC_CHANNEL_LAST + 1; ++i) {
+      cvinputs_[i] = 0.0;
+    }
+    cvinputs_[rings::ADC_CHANNEL_POT_FREQUENCY] = 0.33;
+    cvinputs_[rings::ADC_CHANNEL_POT_STRUCTURE] = 0.25;
+    cvinputs_[rings::ADC_CHANNEL_POT_BRIGHTNESS] = 0.5;
+    cvinputs_[rings::ADC_CHANNEL_POT_DAMPING] = 0.75;
+    cvinputs_[rings::ADC_CHANNEL_POT_POSITION] = 0.25;
+    // init attenuverters
+    for (int i = 11; i < 16; ++i) {
+      cvinputs_[i] = 0.5;
+    }
+
+    reverb_buffer_ = static_cast<uint16_t*>(calloc(65536, sizeof(uint16_t)));
+    if (!reverb_buffer_) {
+      return false;
+    }
+
+    // part_, string_synth_ and strummer_ are zeroed by Module::operator new
+    Reinit();
+    read_inputs_.Init();
+    controls_.Init(CONTROL_RATE_BLOCK);
+    sleep_detector_.Init(sr_);
+
+    part_.set_polyphony(1);
+    part_.set_model(rings::RESONATOR_MODEL_MODAL);
+    string_synth_.set_polyphony(1);
+    string_synth_.set_fx(rings::FX_FORMANT);
+
+    easter_egg_ = false;
+    strum_connected_ = false;
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 7) {
+      strum_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    if (!strcmp(s, "int")) {
+      switch (inlet) {
+        case 0: performance_state_.internal_exciter = (n == 0); break;
+        case 6: performance_state_.internal_note = (n == 0); break;
+        case 7: performance_state_.internal_strum = (n == 0); break;
+        default: break;
+      }
+    } else if (!strcmp(s, "float")) {
+      if (inlet >= 1 && inlet <= 5) {
+        cvinputs_[rings::ADC_CHANNEL_POT_FREQUENCY + inlet - 1] = Clamp(m, 0., 1.);
+      }
+    } else if (!strcmp(s, "frequency")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_FREQUENCY] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "structure")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_STRUCTURE] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "brightness")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_BRIGHTNESS] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "damping")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_DAMPING] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "position")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_POSITION] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "note")) {
+      cvinputs_[rings::ADC_CHANNEL_POT_FREQUENCY] = (m - 12.0) / 60.0;
+    } else if (!strcmp(s, "polyphony")) {
+      n = Clamp(n, 1L, 4L);
+      part_.set_polyphony(n);
+      string_synth_.set_polyphony(n);
+    } else if (!strcmp(s, "model")) {
+      n = Clamp(n, 0L, 5L);
+      part_.set_model(static_cast<rings::ResonatorModel>(n));
+      string_synth_.set_fx(static_cast<rings::FxType>(n));
+    } else if (!strcmp(s, "bypass")) {
+      part_.set_bypass(n != 0);
+    } else if (!strcmp(s, "reset")) {
+      Reinit();
+    } else if (!strcmp(s, "cvrate")) {
+      controls_.set_rate(ControlRate(Clamp(n, 0L, long(CONTROL_RATE_LAST) - 1)));
+    } else if (!strcmp(s, "sleep")) {
+      sleep_detector_.set_enabled(n != 0);
+    } else if (!strcmp(s, "sleep_threshold")) {
+      sleep_detector_.set_threshold(Clamp(m, -140., 0.));
+    } else if (!strcmp(s, "sleep_time")) {
+      sleep_detector_.set_hang_time(Clamp(m, 10., 60000.));
+    } else if (!strcmp(s, "easter")) {
+      easter_egg_ = n != 0;
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+    double* in = ins[0];
+    double* out = outs[0];
+    double* out2 = outs[1];
+    double* cvinputs = cvinputs_;
+    size_t size = kBlockSize;
+
+    // fm, structure, brightness, damping, position and v/oct cv inlets
+    controls_.Start(ins + 1);
+
+    double* strum = ins[7];
+    bool strum_in = strum_connected_ && !performance_state_.internal_strum;
+    bool vector_rate = controls_.rate() == CONTROL_RATE_VECTOR;
+    if (vector_rate) {
+      double trigger = 0.;
+      if (strum_in) {
+        trigger = vbmi::vec::Sum(strum, vs);
+      }
+      cvinputs[16] = trigger;
+    }
+
+    for (long count = 0; count < vs; count += size) {
+      controls_.Read(count, size);
+      // FM input
+      cvinputs[0] = Clamp(controls_.value(0), -48., 48.);
+      // cv inputs are expected in -1. to 1. range
+      for (int i = 1; i < 5; ++i) {
+        cvinputs[i] = Clamp(controls_.value(i), -1., 1.);
+      }
+      // v/oct input, no limits on range
+      cvinputs[5] = controls_.value(5);
+
+      if (!vector_rate) {
+        double trigger = 0.;
+        if (strum_in) {
+          trigger = vbmi::vec::Sum(strum + count, size);
+        }
+        cvinputs[16] = trigger;
+      }
+
+      read_inputs_.Read(&patch_, &performance_state_, cvinputs);
+      vbmi::vec::Convert(in + count, in_, size);
+      // the strummer keeps running while the resonator sleeps, a strum
+      // wakes it up
+      strummer_.Process(easter_egg_ ? NULL : in_, size, &performance_state_);
+
+      double in_peak = vbmi::vec::MaxAbs(in + count, size);
+      if (!sleep_detector_.Awake(in_peak, performance_state_.strum)) {
+        memset(out + count, 0, size * sizeof(double));
+        memset(out2 + count, 0, size * sizeof(double));
+        continue;
+      }
+
+      if (easter_egg_) {
+        string_synth_.Process(performance_state_, patch_,
+                              in_, out_, aux_, size);
+      } else {
+        part_.Process(performance_state_, patch_, in_, out_, aux_, size);
+      }
+      vbmi::vec::Convert(out_, out + count, size);
+      vbmi::vec::Convert(aux_, out2 + count, size);
+
+      double out_peak = std::max(vbmi::vec::MaxAbs(out + count, size),
+                                 vbmi::vec::MaxAbs(out2 + count, size));
+      sleep_detector_.Update(out_peak, size);
+    }
+  }
+
+ private:
+  void Reinit() {
+    rings::Dsp dsp(sr_);
+    strummer_.Init(0.01, dsp.getSr() / kBlockSize, dsp);
+    part_.Init(reverb_buffer_, dsp);
+    string_synth_.Init(reverb_buffer_, dsp);
+  }
+
+  rings::Part part_;
+  rings::StringSynthPart string_synth_;
+  rings::Strummer strummer_;
+  rings::ReadInputs read_inputs_;
+  ControlInputs<6> controls_;
+  SleepDetector sleep_detector_;
+  rings::PerformanceState performance_state_;
+  rings::Patch patch_;
+
+  uint16_t* reverb_buffer_;
+  real_t in_[kBlockSize];
+  real_t out_[kBlockSize];
+  real_t aux_[kBlockSize];
+  double cvinputs_[rings::ADC_CHANNEL_LAST + 1];
+  double sr_;
+  bool strum_connected_;
+  bool easter_egg_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* VBMI_FACTORY(rings)() {
+  return new vbmi::RingsModule;
+}
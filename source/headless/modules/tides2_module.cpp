@@ -0,0 +1,275 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.tds~ (tides2)
+
+
+#include <algorithm>
+#include <cstring>
+
+#include "module.h"
+
+#include "tides2/poly_slope_generator.h"
+#include "tides2/ramp_extractor.h"
+
+
+namespace vbmi {
+
+const size_t kAudioBlockSize = 8;
+const size_t kNumOutputs = 4;
+
+static const tides::Ratio kRatios[19] = {
+  { 0.0625f, 16 },
+  { 0.125f, 8 },
+  { 0.1666666f, 6 },
+  { 0.25f, 4 },
+  { 0.3333333f, 3 },
+  { 0.5f, 2 },
+  { 0.6666666f, 3 },
+  { 0.75f, 4 },
+  { 0.8f, 5 },
+  { 1, 1 },
+  { 1.25f, 4 },
+  { 1.3333333f, 3 },
+  { 1.5f, 2 },
+  { 2.0f, 1 },
+  { 3.0f, 1 },
+  { 4.0f, 1 },
+  { 6.0f, 1 },
+  { 8.0f, 1 },
+  { 16.0f, 1 },
+};
+
+class Tides2Module : public Module {
+ public:
+  Tides2Module() { }
+  ~Tides2Module() { }
+
+  const char* name() const { return "tds"; }
+  int num_inputs() const { return 7; }
+  int num_outputs() const { return kNumOutputs; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return kAudioBlockSize; }
+
+  bool Init(double sample_rate) {
+    sr_ = sample_rate;
+    r_sr_ = 1.f / sr_;
+    poly_slope_generator_.Init();
+    ramp_extractor_.Init(sr_, 40.0f * r_sr_);
+
+    std::fill(&no_gate_[0], &no_gate_[kAudioBlockSize], stmlib::GATE_FLAG_LOW);
+    std::fill(&clock_input_[0], &clock_input_[kAudioBlockSize], stmlib::GATE_FLAG_LOW);
+    std::fill(&ramp_[0], &ramp_[kAudioBlockSize], 0.f);
+
+    output_mode_ = tides::OUTPUT_MODE_GATES;
+    previous_output_mode_ = tides::OUTPUT_MODE_GATES;
+    ramp_mode_ = tides::RAMP_MODE_LOOPING;
+    range_ = tides::RANGE_CONTROL;
+    previous_flags_[0] = stmlib::GATE_FLAG_LOW;
+    previous_flags_[1] = stmlib::GATE_FLAG_LOW;
+    use_trigger_ = false;
+    use_clock_ = false;
+    trig_connected_ = false;
+    clock_connected_ = false;
+    must_reset_ramp_extractor_ = false;
+
+    frequency_ = 1.f;
+    shape_ = 0.5f;
+    slope_ = 0.5f;
+    smoothness_ = 0.5f;
+    shift_ = 0.3f;
+    shape_lp_ = slope_lp_ = smooth_lp_ = shift_lp_ = 0.f;
+    r_.ratio = 1.0f;
+    r_.q = 1;
+    return true;
+  }
+
+  void Connect(int inlet, bool connected) {
+    if (inlet == 5) {
+      trig_connected_ = connected;
+    } else if (inlet == 6) {
+      clock_connected_ = connected;
+    }
+  }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    if (!strcmp(s, "int")) {
+      if (inlet == 5) {
+        use_trigger_ = n != 0;
+      } else if (inlet == 6) {
+        use_clock_ = n != 0;
+      }
+    } else if (!strcmp(s, "float")) {
+      switch (inlet) {
+        case 0: frequency_ = m; break;
+        case 1: shape_ = m; break;
+        case 2: slope_ = m; break;
+        case 3: smoothness_ = m; break;
+        case 4: shift_ = m; break;
+        default: break;
+      }
+    } else if (!strcmp(s, "freq")) {
+      frequency_ = m;
+    } else if (!strcmp(s, "shape")) {
+      shape_ = m;
+    } else if (!strcmp(s, "slope")) {
+      slope_ = m;
+    } else if (!strcmp(s, "smooth")) {
+      smoothness_ = m;
+    } else if (!strcmp(s, "shift")) {
+      shift_ = m;
+    } else if (!strcmp(s, "ratio")) {
+      r_ = kRatios[Clamp(n, 0L, 18L)];
+    } else if (!strcmp(s, "output_mode")) {
+      output_mode_ = tides::OutputMode(Clamp(n, 0L, 3L));
+      if (output_mode_ != previous_output_mode_) {
+        poly_slope_generator_.Reset();
+        previous_output_mode_ = output_mode_;
+      }
+    } else if (!strcmp(s, "ramp_mode")) {
+      ramp_mode_ = tides::RampMode(Clamp(n, 0L, 2L));
+    } else if (!strcmp(s, "range")) {
+      range_ = n != 0 ? tides::RANGE_AUDIO : tides::RANGE_CONTROL;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    double* freq_in = ins[0];
+    double* shape_in = ins[1];
+    double* slope_in = ins[2];
+    double* smooth_in = ins[3];
+    double* shift_in = ins[4];
+    double* trig_in = ins[5];
+    double* clock_in = ins[6];
+
+    stmlib::GateFlags* gate_flags = no_gate_;
+    float frequency, shape, slope, shift, smoothness;
+
+    for (long count = 0; count < vs; count += kAudioBlockSize) {
+      // check for gate/trigger input
+      if (use_trigger_ && trig_connected_) {
+        gate_flags = gate_input_;
+        for (size_t i = 0; i < kAudioBlockSize; ++i) {
+          bool trig = trig_in[i + count] > 0.01;
+          previous_flags_[0] = stmlib::ExtractGateFlags(previous_flags_[0], trig);
+          gate_flags[i] = previous_flags_[0];
+        }
+      }
+
+      if (use_clock_ && clock_connected_) {
+        if (must_reset_ramp_extractor_) {
+          ramp_extractor_.Reset();
+        }
+        for (size_t i = 0; i < kAudioBlockSize; ++i) {
+          bool trig = clock_in[i + count] > 0.01;
+          previous_flags_[1] = stmlib::ExtractGateFlags(previous_flags_[1], trig);
+          clock_input_[i] = previous_flags_[1];
+        }
+        frequency = ramp_extractor_.Process(
+            range_,
+            range_ == tides::RANGE_AUDIO && ramp_mode_ == tides::RAMP_MODE_AR,
+            r_,
+            clock_input_,
+            ramp_,
+            kAudioBlockSize);
+        must_reset_ramp_extractor_ = false;
+      } else {
+        frequency = (freq_in[count] + frequency_) * r_sr_;
+        CONSTRAIN(frequency, 0.f, 0.4f);
+        must_reset_ramp_extractor_ = true;
+      }
+
+      // parameter inputs
+      shape = shape_ + (float)shape_in[count];
+      CONSTRAIN(shape, 0.f, 1.f);
+      ONE_POLE(shape_lp_, shape, 0.1f);
+
+      slope = slope_ + (float)slope_in[count];
+      CONSTRAIN(slope, 0.f, 1.f);
+      ONE_POLE(slope_lp_, slope, 0.1f);
+
+      smoothness = smoothness_ + (float)smooth_in[count];
+      CONSTRAIN(smoothness, 0.f, 1.f);
+      ONE_POLE(smooth_lp_, smoothness, 0.1f);
+
+      shift = shift_ + shift_in[count];
+      CONSTRAIN(shift, 0.f, 1.f);
+      ONE_POLE(shift_lp_, shift, 0.1f);
+
+      poly_slope_generator_.Render(ramp_mode_,
+                                   output_mode_,
+                                   range_,
+                                   frequency, slope_lp_, shape_lp_, smooth_lp_, shift_lp_,
+                                   gate_flags,
+                                   !use_trigger_ && use_clock_ ? ramp_ : NULL,
+                                   out_, kAudioBlockSize);
+
+      for (size_t i = 0; i < kAudioBlockSize; ++i) {
+        for (size_t j = 0; j < kNumOutputs; ++j) {
+          outs[j][i + count] = out_[i].channel[j] * 0.1f;
+        }
+      }
+    }
+  }
+
+ private:
+  tides::PolySlopeGenerator poly_slope_generator_;
+  tides::RampExtractor ramp_extractor_;
+  tides::PolySlopeGenerator::OutputSample out_[kAudioBlockSize];
+  stmlib::GateFlags no_gate_[kAudioBlockSize];
+  stmlib::GateFlags gate_input_[kAudioBlockSize];
+  stmlib::GateFlags clock_input_[kAudioBlockSize];
+  stmlib::GateFlags previous_flags_[2 + 1];
+  tides::Ratio r_;
+  float ramp_[kAudioBlockSize];
+
+  tides::OutputMode output_mode_;
+  tides::OutputMode previous_output_mode_;
+  tides::RampMode ramp_mode_;
+  tides::Range range_;
+
+  float frequency_;
+  float shape_, shape_lp_;
+  float slope_, slope_lp_;
+  float smoothness_, smooth_lp_;
+  float shift_, shift_lp_;
+  bool must_reset_ramp_extractor_;
+  bool trig_connected_;
+  bool clock_connected_;
+  bool use_trigger_;
+  bool use_clock_;
+  float sr_;
+  float r_sr_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_tides2() {
+  return new vbmi::Tides2Module;
+}
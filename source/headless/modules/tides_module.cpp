@@ -0,0 +1,178 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.tds1~ (tides)
+
+
+#include <cmath>
+#include <cstring>
+
+#include "module.h"
+
+#include "tides/generator.h"
+#include "stmlib/utils/gate_flags.h"
+
+
+namespace vbmi {
+
+const size_t kAudioBlockSize = 16;
+const double kSampleRate = 48000.0;     // SR of the original module
+
+class TidesModule : public Module {
+ public:
+  TidesModule() { }
+  ~TidesModule() { }
+
+  const char* name() const { return "tds1"; }
+  int num_inputs() const { return 7; }
+  int num_outputs() const { return 4; }
+  int num_audio_inputs() const { return 0; }
+  int block_size() const { return kAudioBlockSize; }
+
+  bool Init(double sample_rate) {
+    sr_ = sample_rate;
+    sr_pitch_correction_ = log2(kSampleRate / sr_) * 12.0;
+
+    generator_.Init();
+    generator_.set_range(tides::GENERATOR_RANGE_HIGH);
+    generator_.set_mode(tides::GENERATOR_MODE_LOOPING);
+    generator_.set_sync(false);
+
+    previous_state_ = 0;
+    use_trigger_ = false;
+    use_clock_ = false;
+    pitch_ = 60.0;
+    shape_ = 0.0;
+    slope_ = 0.0;
+    smooth_ = 0.0;
+    return true;
+  }
+
+  void Connect(int, bool) { }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    if (!strcmp(s, "int")) {
+      if (inlet == 5) {
+        use_trigger_ = n != 0;
+      } else if (inlet == 6) {
+        use_clock_ = n != 0;
+        generator_.set_sync(use_clock_);
+      }
+    } else if (!strcmp(s, "float")) {
+      switch (inlet) {
+        case 0: pitch_ = Clamp(m, -128.0, 128.0); break;
+        case 1: shape_ = m; break;
+        case 2: slope_ = m; break;
+        case 3: smooth_ = m; break;
+        default: break;
+      }
+    } else if (!strcmp(s, "freq")) {
+      pitch_ = Clamp(m, -128.0, 128.0);
+    } else if (!strcmp(s, "shape")) {
+      shape_ = m;
+    } else if (!strcmp(s, "slope")) {
+      slope_ = m;
+    } else if (!strcmp(s, "smooth")) {
+      smooth_ = m;
+    } else if (!strcmp(s, "ramp_mode")) {
+      generator_.set_mode(tides::GeneratorMode(Clamp(n, 0L, 2L)));
+    } else if (!strcmp(s, "range")) {
+      generator_.set_range(tides::GeneratorRange(Clamp(n, 0L, 2L)));
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    double* freq_in = ins[0];
+    double* shape_in = ins[1];
+    double* slope_in = ins[2];
+    double* smooth_in = ins[3];
+    double* freeze_in = ins[4];
+    double* trig_in = ins[5];
+    double* clock_in = ins[6];
+
+    tides::Generator* generator = &generator_;
+    uint8_t prev_state = previous_state_;
+    double pitch_offset = pitch_ + sr_pitch_correction_;
+
+    for (long count = 0; count < vs; count += kAudioBlockSize) {
+      double pitchf = pitch_offset + freq_in[count];
+      CONSTRAIN(pitchf, -128.0, 128.0);
+      generator->set_pitch(static_cast<int16_t>(pitchf * 128.0));
+
+      // save some cycles and use overflow
+      double shape = (shape_ + shape_in[count]) * 32767.0;
+      generator->set_shape((int16_t)shape);
+      double slope = (slope_ + slope_in[count]) * 32767.0;
+      generator->set_slope((int16_t)slope);
+      double smooth = (smooth_ + smooth_in[count]) * 32767.0;
+      generator->set_smoothness((int16_t)smooth);
+
+      for (size_t i = 0; i < kAudioBlockSize; ++i) {
+        long index = i + count;
+        uint8_t state = 0;
+        if (freeze_in[index] >= 0.1)
+          state |= tides::CONTROL_FREEZE;
+        if (trig_in[index] >= 0.1)
+          state |= tides::CONTROL_GATE;
+        if (clock_in[index] >= 0.1)
+          state |= tides::CONTROL_CLOCK;
+        if (!(prev_state & tides::CONTROL_CLOCK) && (state & tides::CONTROL_CLOCK))
+          state |= tides::CONTROL_CLOCK_RISING;
+        if (!(prev_state & tides::CONTROL_GATE) && (state & tides::CONTROL_GATE))
+          state |= tides::CONTROL_GATE_RISING;
+        if ((prev_state & tides::CONTROL_GATE) && !(state & tides::CONTROL_GATE))
+          state |= tides::CONTROL_GATE_FALLING;
+        prev_state = state;
+
+        const tides::GeneratorSample& sample = generator->Process(state);
+        outs[0][index] = (double)sample.bipolar / 32768.0;
+        outs[1][index] = (double)sample.unipolar / 65536.0;
+        outs[2][index] = sample.flags & tides::FLAG_END_OF_ATTACK;
+        outs[3][index] = (sample.flags & tides::FLAG_END_OF_RELEASE) >> 1;
+      }
+      generator->Process();
+    }
+    previous_state_ = prev_state;
+  }
+
+ private:
+  tides::Generator generator_;
+  uint8_t previous_state_;
+  double pitch_, slope_, shape_, smooth_;
+  bool use_trigger_;
+  bool use_clock_;
+  double sr_;
+  double sr_pitch_correction_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_tides() {
+  return new vbmi::TidesModule;
+}
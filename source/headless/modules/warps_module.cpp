@@ -0,0 +1,189 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// headless port of vb.mi.wrps~
+
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+#include "module.h"
+
+#include "warps/dsp/modulator.h"
+#include "warps/dsp/oscillator.h"
+#include "stmlib/utils/random.h"
+
+#include "read_inputs.hpp"
+#include "control_inputs.h"
+
+
+namespace vbmi {
+
+// original SR: 96 kHz, block size: 60
+// the vector is processed in chunks of at most kBlockSize, without buffering
+// (the vocoder delays by 11 samples at sizes which aren't a multiple of 12)
+const size_t kBlockSize = 64;
+
+class WarpsModule : public Module {
+ public:
+  WarpsModule() : modulator_(NULL) { }
+  ~WarpsModule() { delete modulator_; }
+
+  const char* name() const { return "wrps"; }
+  int num_inputs() const { return 6; }
+  int num_outputs() const { return 2; }
+  int num_audio_inputs() const { return 2; }
+  // the modulator takes any block size, so any vector size works
+  int block_size() const { return 1; }
+
+  bool Init(double sample_rate) {
+    rng_state_ = stmlib::Random::InstanceSeed();
+    sr_ = sample_rate > 0 ? sample_rate : 44100.0;
+    easter_egg_ = false;
+    patched_[0] = patched_[1] = 0;
+    carrier_shape_ = 1;
+
+    modulator_ = NewZeroed<warps::Modulator>();
+    modulator_->Init(sr_);
+    modulator_->mutable_parameters()->note = 110.0f; // (Hz)
+
+    read_inputs_.Init();
+    controls_.Init(CONTROL_RATE_BLOCK);
+    for (int i = 0; i < warps::ADC_LAST; ++i) {
+      adc_inputs_[i] = 0.0;
+    }
+    memset(input_, 0, sizeof(input_));
+    memset(output_, 0, sizeof(output_));
+    return true;
+  }
+
+  void Connect(int, bool) { }
+
+  bool Message(const char* s, int inlet, int argc, const double* argv) {
+    double m = argc > 0 ? argv[0] : 0.0;
+    long n = static_cast<long>(m);
+    warps::Parameters* p = modulator_->mutable_parameters();
+    if (!strcmp(s, "int")) {
+      if (inlet == 2 || inlet == 3) {
+        patched_[inlet - 2] = n != 0;
+      }
+    } else if (!strcmp(s, "float")) {
+      m = Clamp(m, 0., 1.);
+      switch (inlet) {
+        case 2: adc_inputs_[warps::ADC_LEVEL_1_POT] = m; break;
+        case 3: adc_inputs_[warps::ADC_LEVEL_2_POT] = m; break;
+        case 4: adc_inputs_[warps::ADC_ALGORITHM_POT] = m; break;
+        case 5: adc_inputs_[warps::ADC_PARAMETER_POT] = m; break;
+        default: break;
+      }
+    } else if (!strcmp(s, "algo")) {
+      adc_inputs_[warps::ADC_ALGORITHM_POT] = Clamp(m * 0.125, 0., 1.);
+    } else if (!strcmp(s, "timbre")) {
+      adc_inputs_[warps::ADC_PARAMETER_POT] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "osc_shape")) {
+      carrier_shape_ = Clamp(static_cast<int>(n), 0, 3);
+      p->carrier_shape = carrier_shape_;
+    } else if (!strcmp(s, "level1")) {
+      adc_inputs_[warps::ADC_LEVEL_1_POT] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "level2")) {
+      adc_inputs_[warps::ADC_LEVEL_2_POT] = Clamp(m, 0., 1.);
+    } else if (!strcmp(s, "freq")) {
+      p->note = Clamp(m, 0., 15000.);
+    } else if (!strcmp(s, "bypass")) {
+      modulator_->set_bypass(n != 0);
+    } else if (!strcmp(s, "easteregg")) {
+      easter_egg_ = n != 0;
+      modulator_->set_easter_egg(easter_egg_);
+    } else if (!strcmp(s, "cvrate")) {
+      controls_.set_rate(ControlRate(Clamp(n, 0L, long(CONTROL_RATE_LAST) - 1)));
+    } else if (!strcmp(s, "oversampling")) {
+      modulator_->set_oversampling(n);
+    } else if (!strcmp(s, "bands")) {
+      modulator_->set_vocoder_bands(n);
+    } else if (!strcmp(s, "pre_gain")) {
+      double f = static_cast<long>(Clamp(m, 1.0, 10.0));
+      p->limiter_pre_gain = f * 1.4;
+    } else if (!strcmp(s, "seed")) {
+      rng_state_ = static_cast<uint32_t>(n);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  void Process(double** ins, double** outs, long vs) {
+    stmlib::RandomScope random_scope(&rng_state_);
+
+    // cv inputs are expected in 0. to 1. range
+    controls_.Start(ins + 2);
+    bool vector_rate = controls_.rate() == CONTROL_RATE_VECTOR;
+    if (vector_rate) {
+      ReadControls();
+    }
+
+    for (long count = 0; count < vs; count += kBlockSize) {
+      long size = std::min<long>(kBlockSize, vs - count);
+      if (!vector_rate) {
+        controls_.Read(count, size);
+        ReadControls();
+      }
+      for (long i = 0; i < size; ++i) {
+        input_[i].l = ins[0][count + i];
+        input_[i].r = ins[1][count + i];
+      }
+      modulator_->Processf(input_, output_, size);
+      for (long i = 0; i < size; ++i) {
+        outs[0][count + i] = output_[i].l;
+        outs[1][count + i] = output_[i].r;
+      }
+    }
+  }
+
+ private:
+  void ReadControls() {
+    for (int k = 0; k < 4; ++k) {
+      adc_inputs_[k] = controls_.value(k);
+    }
+    read_inputs_.Read(modulator_->mutable_parameters(), adc_inputs_, patched_);
+  }
+
+  warps::Modulator* modulator_;
+  warps::ReadInputs read_inputs_;
+  ControlInputs<4> controls_;
+  double adc_inputs_[warps::ADC_LAST];
+  short patched_[2];
+  bool easter_egg_;
+  uint8_t carrier_shape_;
+  warps::FloatFrame input_[kBlockSize];
+  warps::FloatFrame output_[kBlockSize];
+  double sr_;
+  uint32_t rng_state_;
+};
+
+}  // namespace vbmi
+
+extern "C" VBMI_EXPORT vbmi::Module* vbmi_create_warps() {
+  return new vbmi::WarpsModule;
+}
@@ -0,0 +1,364 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Accuracy of the single precision builds of plaits, rings and elements.
+//
+// Every engine / model is rendered through the double and the float build
+// of its core, with the same messages, input and random seed, and the
+// difference is reported per setup:
+//
+//   level      rms level of the double render, in dBFS
+//   peak_err   largest absolute difference, in dBFS
+//   snr_onset  level of the double render over the level of the
+//              difference during the first 50 ms, in dB
+//   snr        the same over the whole render
+//
+//   vbmi-precision [-r sample_rate] [-b vector_size] [-d seconds] [core]
+//
+// Rounding errors of float phase increments and of feedback paths add up,
+// so the renders drift apart over time and the snr of the whole render is
+// lower than the onset one, although both sound the same.
+//
+// Every setup is rendered twice through each build, by two instances
+// created one after the other, and has to give the same result both times:
+// a module that doesn't initialise all of its state picks up what the
+// previous instance left in the heap.
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "denormals.h"
+#include "module.h"
+
+extern "C" {
+vbmi::Module* vbmi_create_plaits();
+vbmi::Module* vbmi_create_rings();
+vbmi::Module* vbmi_create_elements();
+vbmi::Module* vbmi_create_plaits_f32();
+vbmi::Module* vbmi_create_rings_f32();
+vbmi::Module* vbmi_create_elements_f32();
+}
+
+namespace {
+
+struct Message {
+  const char* selector;
+  double value;
+};
+
+struct Setup {
+  std::string label;
+  std::vector<Message> messages;
+};
+
+struct CorePair {
+  const char* name;
+  vbmi::ModuleFactory reference;
+  vbmi::ModuleFactory single;
+  std::vector<Setup> setups;
+};
+
+// Engines registered in plaits::Voice::Init().
+const int kNumPlaitsEngines = 24;
+
+// rings::RESONATOR_MODEL_LAST and rings::kMaxPolyphony
+const int kNumRingsModels = 6;
+const int kMaxRingsPolyphony = 4;
+
+const double kDefaultSampleRate = 48000.0;
+const int kDefaultVectorSize = 64;
+const double kDefaultDuration = 2.0;
+
+// The phase accumulators of the float build drift away from the double ones
+// over time, the error right after the start shows the precision of the
+// signal path itself.
+const double kOnsetTime = 0.05;
+
+// Anything quieter than this is reported as silence.
+const double kSilence = 1e-12;
+
+Setup MakeSetup(const std::string& label) {
+  Setup setup;
+  setup.label = label;
+  Message seed = { "seed", 1.0 };
+  setup.messages.push_back(seed);
+  return setup;
+}
+
+void AddMessage(Setup* setup, const char* selector, double value) {
+  Message message = { selector, value };
+  setup->messages.push_back(message);
+}
+
+std::vector<Setup> PlaitsSetups() {
+  std::vector<Setup> setups;
+  for (int engine = 0; engine < kNumPlaitsEngines; ++engine) {
+    Setup setup = MakeSetup("engine:" + std::to_string(engine));
+    AddMessage(&setup, "engine", engine);
+    AddMessage(&setup, "harmonics", 0.4);
+    AddMessage(&setup, "timbre", 0.6);
+    AddMessage(&setup, "morph", 0.5);
+    setups.push_back(setup);
+  }
+  return setups;
+}
+
+std::vector<Setup> RingsSetups() {
+  std::vector<Setup> setups;
+  for (int model = 0; model < kNumRingsModels; ++model) {
+    for (int polyphony = 1; polyphony <= kMaxRingsPolyphony; polyphony *= 2) {
+      Setup setup = MakeSetup("model:" + std::to_string(model) +
+          "/polyphony:" + std::to_string(polyphony));
+      AddMessage(&setup, "polyphony", polyphony);
+      AddMessage(&setup, "model", model);
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+std::vector<Setup> ElementsSetups() {
+  std::vector<Setup> setups;
+  for (int bow = 0; bow <= 1; ++bow) {
+    for (int blow = 0; blow <= 1; ++blow) {
+      Setup setup = MakeSetup("bow:" + std::to_string(bow) +
+          "/blow:" + std::to_string(blow));
+      AddMessage(&setup, "bow", bow);
+      AddMessage(&setup, "blow", blow);
+      AddMessage(&setup, "play", 1);
+      setups.push_back(setup);
+    }
+  }
+  return setups;
+}
+
+// Noise bursts of 5 ms twice a second, the same for every render.
+void FillInput(double* buffer, long start, long size, double sample_rate) {
+  long period = static_cast<long>(sample_rate * 0.5);
+  long burst = static_cast<long>(sample_rate * 0.005);
+  uint32_t state = static_cast<uint32_t>(start) * 2654435761u + 1;
+  for (long i = 0; i < size; ++i) {
+    state = state * 1664525L + 1013904223L;
+    buffer[i] = (start + i) % period < burst
+        ? (static_cast<double>(state) / 4294967296.0 - 0.5) : 0.0;
+  }
+}
+
+// Renders all outputs, one after the other. Fails if Init() fails or the
+// output isn't finite.
+bool Render(
+    vbmi::ModuleFactory factory,
+    const Setup& setup,
+    double sample_rate,
+    int vector_size,
+    long num_vectors,
+    std::vector<double>* output) {
+  std::unique_ptr<vbmi::Module> module(factory());
+  if (!module->Init(sample_rate)) {
+    return false;
+  }
+  int num_inputs = module->num_inputs();
+  int num_outputs = module->num_outputs();
+  for (int i = 0; i < num_inputs; ++i) {
+    module->Connect(i, i < module->num_audio_inputs());
+  }
+  for (size_t i = 0; i < setup.messages.size(); ++i) {
+    module->Message(setup.messages[i].selector, 0, 1,
+                    &setup.messages[i].value);
+  }
+
+  std::vector<std::vector<double> > in_buffers(
+      num_inputs, std::vector<double>(vector_size, 0.0));
+  std::vector<double*> ins(num_inputs);
+  std::vector<double*> outs(num_outputs);
+  for (int i = 0; i < num_inputs; ++i) {
+    ins[i] = &in_buffers[i][0];
+  }
+  long length = num_vectors * vector_size;
+  output->assign(length * num_outputs, 0.0);
+  for (long v = 0; v < num_vectors; ++v) {
+    long start = v * vector_size;
+    for (int i = 0; i < module->num_audio_inputs(); ++i) {
+      FillInput(ins[i], start, vector_size, sample_rate);
+    }
+    for (int i = 0; i < num_outputs; ++i) {
+      outs[i] = &(*output)[i * length + start];
+    }
+    // as in the perform routines of the externals
+    vbmi::ScopedFlushDenormals flush_denormals;
+    module->Process(&ins[0], &outs[0], vector_size);
+  }
+  for (size_t i = 0; i < output->size(); ++i) {
+    if (!std::isfinite((*output)[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sums of the double render and of its difference to the float render.
+struct Difference {
+  Difference() : signal(0.0), error(0.0), peak(0.0) { }
+
+  void Add(double reference, double single) {
+    double e = single - reference;
+    signal += reference * reference;
+    error += e * e;
+    peak = std::max(peak, fabs(e));
+  }
+
+  double rms(size_t size) const {
+    return size ? sqrt(signal / size) : 0.0;
+  }
+
+  // "-" for silence, "inf" when both renders are identical.
+  std::string snr() const {
+    if (signal < kSilence * kSilence) {
+      return "-";
+    } else if (error == 0.0) {
+      return "inf";
+    }
+    char text[32];
+    snprintf(text, sizeof(text), "%.1f", 10.0 * log10(signal / error));
+    return text;
+  }
+
+  double signal;
+  double error;
+  double peak;
+};
+
+int num_outputs(const CorePair& core) {
+  std::unique_ptr<vbmi::Module> module(core.reference());
+  return module->num_outputs();
+}
+
+double Decibels(double x) {
+  return x > kSilence ? 20.0 * log10(x) : -240.0;
+}
+
+void Usage() {
+  fprintf(stderr,
+      "usage: vbmi-precision [-r sample_rate] [-b vector_size] [-d seconds]\n"
+      "                      [plaits|rings|elements]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double sample_rate = kDefaultSampleRate;
+  int vector_size = kDefaultVectorSize;
+  double duration = kDefaultDuration;
+  const char* only = NULL;
+
+  for (int i = 1; i < argc; ++i) {
+    bool has_value = i + 1 < argc;
+    if (!strcmp(argv[i], "-r") && has_value) {
+      sample_rate = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "-b") && has_value) {
+      vector_size = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-d") && has_value) {
+      duration = atof(argv[++i]);
+    } else if (argv[i][0] != '-' && !only) {
+      only = argv[i];
+    } else {
+      Usage();
+      return 1;
+    }
+  }
+
+  CorePair cores[] = {
+    { "plaits", &vbmi_create_plaits, &vbmi_create_plaits_f32,
+      PlaitsSetups() },
+    { "rings", &vbmi_create_rings, &vbmi_create_rings_f32, RingsSetups() },
+    { "elements", &vbmi_create_elements, &vbmi_create_elements_f32,
+      ElementsSetups() },
+  };
+
+  printf("%-10s %-22s %8s %9s %9s %9s\n",
+         "core", "setup", "level", "peak_err", "snr_onset", "snr");
+  for (size_t c = 0; c < sizeof(cores) / sizeof(cores[0]); ++c) {
+    const CorePair& core = cores[c];
+    if (only && strcmp(only, core.name)) {
+      continue;
+    }
+    std::unique_ptr<vbmi::Module> probe(core.reference());
+    int block_size = probe->block_size();
+    if (vector_size <= 0 || vector_size % block_size) {
+      fprintf(stderr, "%s: the vector size has to be a multiple of %d\n",
+              core.name, block_size);
+      return 1;
+    }
+    long num_vectors = static_cast<long>(
+        duration * sample_rate / vector_size) + 1;
+
+    for (size_t s = 0; s < core.setups.size(); ++s) {
+      const Setup& setup = core.setups[s];
+      std::vector<double> reference;
+      std::vector<double> single;
+      std::vector<double> reference_again;
+      std::vector<double> single_again;
+      if (!Render(core.reference, setup, sample_rate, vector_size,
+                  num_vectors, &reference) ||
+          !Render(core.single, setup, sample_rate, vector_size,
+                  num_vectors, &single) ||
+          !Render(core.reference, setup, sample_rate, vector_size,
+                  num_vectors, &reference_again) ||
+          !Render(core.single, setup, sample_rate, vector_size,
+                  num_vectors, &single_again)) {
+        fprintf(stderr, "%s %s: Init() failed or the output isn't finite\n",
+                core.name, setup.label.c_str());
+        return 1;
+      }
+      if (reference != reference_again || single != single_again) {
+        fprintf(stderr, "%s %s: a second instance renders differently\n",
+                core.name, setup.label.c_str());
+        return 1;
+      }
+      long length = static_cast<long>(reference.size()) / num_outputs(core);
+      long onset = std::min(length,
+          static_cast<long>(kOnsetTime * sample_rate));
+      Difference whole;
+      Difference start;
+      for (size_t i = 0; i < reference.size(); ++i) {
+        whole.Add(reference[i], single[i]);
+        if (static_cast<long>(i % length) < onset) {
+          start.Add(reference[i], single[i]);
+        }
+      }
+      printf("%-10s %-22s %8.1f %9.1f %9s %9s\n",
+             core.name, setup.label.c_str(),
+             Decibels(whole.rms(reference.size())), Decibels(whole.peak),
+             start.snr().c_str(), whole.snr().c_str());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,340 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Parsers for the CSV and JSON automation files of vbmi-render.
+
+
+#include "automation.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace vbmi {
+
+namespace {
+
+// Just enough JSON to read automation files: objects, arrays, numbers,
+// strings (without unicode escapes), booleans and null.
+struct JsonValue {
+  enum Type { NIL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+  JsonValue() : type(NIL), number(0.0) { }
+
+  Type type;
+  double number;
+  std::string string;
+  std::vector<JsonValue> array;
+  std::map<std::string, JsonValue> object;
+
+  const JsonValue* find(const std::string& key) const {
+    std::map<std::string, JsonValue>::const_iterator it = object.find(key);
+    return it == object.end() ? NULL : &it->second;
+  }
+};
+
+class JsonParser {
+ public:
+  JsonParser(const std::string& text) : text_(text), pos_(0) { }
+
+  bool Parse(JsonValue* value, std::string* error) {
+    if (!ParseValue(value) || (SkipSpace(), pos_ != text_.size())) {
+      std::ostringstream s;
+      s << "JSON syntax error at offset " << pos_;
+      *error = s.str();
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  void SkipSpace() {
+    while (pos_ < text_.size() && isspace(static_cast<unsigned char>(text_[pos_]))) {
+      ++pos_;
+    }
+  }
+
+  bool Consume(char c) {
+    SkipSpace();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool ConsumeWord(const char* word) {
+    size_t n = strlen(word);
+    if (text_.compare(pos_, n, word) == 0) {
+      pos_ += n;
+      return true;
+    }
+    return false;
+  }
+
+  bool ParseString(std::string* out) {
+    if (!Consume('"')) {
+      return false;
+    }
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      char c = text_[pos_++];
+      if (c == '\\' && pos_ < text_.size()) {
+        c = text_[pos_++];
+        switch (c) {
+          case 'n': c = '\n'; break;
+          case 't': c = '\t'; break;
+          case 'r': c = '\r'; break;
+          default: break;
+        }
+      }
+      out->push_back(c);
+    }
+    return pos_ < text_.size() && text_[pos_++] == '"';
+  }
+
+  bool ParseValue(JsonValue* value) {
+    SkipSpace();
+    if (pos_ >= text_.size()) {
+      return false;
+    }
+    char c = text_[pos_];
+    if (c == '{') {
+      ++pos_;
+      value->type = JsonValue::OBJECT;
+      if (Consume('}')) {
+        return true;
+      }
+      do {
+        std::string key;
+        if (!ParseString(&key) || !Consume(':') ||
+            !ParseValue(&value->object[key])) {
+          return false;
+        }
+      } while (Consume(','));
+      return Consume('}');
+    } else if (c == '[') {
+      ++pos_;
+      value->type = JsonValue::ARRAY;
+      if (Consume(']')) {
+        return true;
+      }
+      do {
+        value->array.push_back(JsonValue());
+        if (!ParseValue(&value->array.back())) {
+          return false;
+        }
+      } while (Consume(','));
+      return Consume(']');
+    } else if (c == '"') {
+      value->type = JsonValue::STRING;
+      return ParseString(&value->string);
+    } else if (ConsumeWord("true")) {
+      value->type = JsonValue::BOOLEAN;
+      value->number = 1.0;
+      return true;
+    } else if (ConsumeWord("false")) {
+      value->type = JsonValue::BOOLEAN;
+      return true;
+    } else if (ConsumeWord("null")) {
+      return true;
+    }
+    const char* start = text_.c_str() + pos_;
+    char* end;
+    value->type = JsonValue::NUMBER;
+    value->number = strtod(start, &end);
+    pos_ += end - start;
+    return end != start;
+  }
+
+  const std::string& text_;
+  size_t pos_;
+};
+
+bool ParseTarget(const std::string& target, AutomationEvent* event) {
+  size_t at = target.find('@');
+  event->selector = target.substr(0, at);
+  event->inlet = 0;
+  if (at != std::string::npos) {
+    char* end;
+    event->inlet = strtol(target.c_str() + at + 1, &end, 10);
+    if (*end || event->inlet < 0) {
+      return false;
+    }
+  }
+  return !event->selector.empty();
+}
+
+std::string Trim(const std::string& s) {
+  size_t begin = s.find_first_not_of(" \t\r\n");
+  size_t end = s.find_last_not_of(" \t\r\n");
+  return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+bool LoadCsv(const std::string& text, Automation* automation, std::string* error) {
+  std::istringstream lines(text);
+  std::string line;
+  int line_number = 0;
+  while (std::getline(lines, line)) {
+    ++line_number;
+    line = Trim(line.substr(0, line.find('#')));
+    if (line.empty()) {
+      continue;
+    }
+    std::vector<std::string> fields;
+    std::istringstream columns(line);
+    std::string field;
+    while (std::getline(columns, field, ',')) {
+      fields.push_back(Trim(field));
+    }
+
+    AutomationEvent event;
+    char* end = NULL;
+    bool ok = fields.size() >= 2;
+    if (ok) {
+      event.time = strtod(fields[0].c_str(), &end);
+      ok = *end == '\0' && event.time >= 0.0 && ParseTarget(fields[1], &event);
+    }
+    for (size_t i = 2; ok && i < fields.size(); ++i) {
+      event.args.push_back(strtod(fields[i].c_str(), &end));
+      ok = *end == '\0';
+    }
+    if (!ok) {
+      std::ostringstream s;
+      s << "line " << line_number << ": expected time,target[,arg...]";
+      *error = s.str();
+      return false;
+    }
+    event.ramp = 0.0;
+    if (event.selector == "sig" && event.args.size() > 1) {
+      event.ramp = event.args[1];
+      event.args.resize(1);
+    }
+    automation->events.push_back(event);
+  }
+  return true;
+}
+
+bool LoadJson(const std::string& text, Automation* automation, std::string* error) {
+  JsonValue root;
+  JsonParser parser(text);
+  if (!parser.Parse(&root, error)) {
+    return false;
+  }
+  if (root.type != JsonValue::OBJECT) {
+    *error = "expected a JSON object";
+    return false;
+  }
+
+  const JsonValue* v;
+  if ((v = root.find("core")) && v->type == JsonValue::STRING) {
+    automation->core = v->string;
+  }
+  if ((v = root.find("input")) && v->type == JsonValue::STRING) {
+    automation->input = v->string;
+  }
+  if ((v = root.find("sample_rate")) && v->type == JsonValue::NUMBER) {
+    automation->sample_rate = v->number;
+  }
+  if ((v = root.find("vector_size")) && v->type == JsonValue::NUMBER) {
+    automation->vector_size = static_cast<int>(v->number);
+  }
+  if ((v = root.find("duration")) && v->type == JsonValue::NUMBER) {
+    automation->duration = v->number;
+  }
+
+  const JsonValue* events = root.find("events");
+  if (!events) {
+    return true;
+  }
+  if (events->type != JsonValue::ARRAY) {
+    *error = "'events' must be an array";
+    return false;
+  }
+  for (size_t i = 0; i < events->array.size(); ++i) {
+    const JsonValue& e = events->array[i];
+    const JsonValue* time = e.find("time");
+    const JsonValue* target = e.find("target");
+    AutomationEvent event;
+    if (e.type != JsonValue::OBJECT || !time || time->type != JsonValue::NUMBER ||
+        !target || target->type != JsonValue::STRING ||
+        !ParseTarget(target->string, &event)) {
+      std::ostringstream s;
+      s << "event " << i << ": needs a 'time' and a 'target'";
+      *error = s.str();
+      return false;
+    }
+    event.time = time->number;
+    event.ramp = 0.0;
+    if ((v = e.find("value")) && v->type != JsonValue::ARRAY) {
+      event.args.push_back(v->number);
+    }
+    if ((v = e.find("args")) && v->type == JsonValue::ARRAY) {
+      for (size_t j = 0; j < v->array.size(); ++j) {
+        event.args.push_back(v->array[j].number);
+      }
+    }
+    if ((v = e.find("ramp")) && v->type == JsonValue::NUMBER) {
+      event.ramp = v->number;
+    }
+    automation->events.push_back(event);
+  }
+  return true;
+}
+
+bool EarlierThan(const AutomationEvent& a, const AutomationEvent& b) {
+  return a.time < b.time;
+}
+
+}  // namespace
+
+bool LoadAutomation(const std::string& path, Automation* automation,
+                    std::string* error) {
+  std::ifstream in(path.c_str(), std::ios::binary);
+  if (!in) {
+    *error = "can't open " + path;
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  std::string text = buffer.str();
+
+  size_t first = text.find_first_not_of(" \t\r\n");
+  bool json = first != std::string::npos && text[first] == '{';
+  bool ok = json
+      ? LoadJson(text, automation, error)
+      : LoadCsv(text, automation, error);
+  if (!ok) {
+    *error = path + ": " + *error;
+    return false;
+  }
+  std::stable_sort(automation->events.begin(), automation->events.end(), EarlierThan);
+  return true;
+}
+
+}  // namespace vbmi
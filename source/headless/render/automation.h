@@ -0,0 +1,83 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Automation files for vbmi-render.
+//
+// CSV: one event per line, '#' starts a comment
+//
+//   time,target[,arg...]
+//
+// JSON:
+//
+//   { "core": "rings", "sample_rate": 48000, "vector_size": 64,
+//     "duration": 4.0, "input": "in.wav",
+//     "events": [ { "time": 0.0, "target": "model", "value": 2 },
+//                 { "time": 1.0, "target": "sig@6", "value": 0.5, "ramp": 0.2 },
+//                 { "time": 2.0, "target": "euclid", "args": [0, 16, 5] } ] }
+//
+// Targets are message selectors, 'int@N' / 'float@N' for a number sent to
+// inlet N, or 'sig@N' for the value of signal inlet N. Messages are handled
+// at the start of the next signal vector, like the Max scheduler does in
+// overdrive/audio interrupt mode. Signal values are sample accurate; the
+// optional ramp (seconds, the second CSV argument) interpolates linearly
+// from the current value.
+
+
+#ifndef VBMI_HEADLESS_AUTOMATION_H_
+#define VBMI_HEADLESS_AUTOMATION_H_
+
+#include <string>
+#include <vector>
+
+namespace vbmi {
+
+struct AutomationEvent {
+  double time;
+  std::string selector;   // message selector, or "sig"
+  int inlet;
+  std::vector<double> args;
+  double ramp;
+};
+
+struct Automation {
+  Automation()
+      : sample_rate(0.0), vector_size(0), duration(0.0) { }
+
+  // Settings read from a JSON file. Zero / empty when not given.
+  std::string core;
+  std::string input;
+  double sample_rate;
+  int vector_size;
+  double duration;
+
+  // sorted by time, stable for equal times
+  std::vector<AutomationEvent> events;
+};
+
+bool LoadAutomation(const std::string& path, Automation* automation,
+                    std::string* error);
+
+}  // namespace vbmi
+
+#endif  // VBMI_HEADLESS_AUTOMATION_H_
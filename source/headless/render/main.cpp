@@ -0,0 +1,367 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// vbmi-render: runs one of the DSP cores offline, driven by an automation
+// file, and writes the result to a WAV file.
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "denormals.h"
+#include "module.h"
+#include "render/automation.h"
+#include "render/wav_file.h"
+
+extern "C" {
+vbmi::Module* vbmi_create_plaits();
+vbmi::Module* vbmi_create_rings();
+vbmi::Module* vbmi_create_elements();
+vbmi::Module* vbmi_create_clouds();
+vbmi::Module* vbmi_create_warps();
+vbmi::Module* vbmi_create_braids();
+vbmi::Module* vbmi_create_tides();
+vbmi::Module* vbmi_create_tides2();
+vbmi::Module* vbmi_create_marbles();
+vbmi::Module* vbmi_create_grids();
+vbmi::Module* vbmi_create_plaits_f32();
+vbmi::Module* vbmi_create_rings_f32();
+vbmi::Module* vbmi_create_elements_f32();
+}
+
+namespace {
+
+struct CoreEntry {
+  const char* name;
+  const char* alias;  // name of the Max external, without vb.mi. and ~
+  vbmi::ModuleFactory factory;
+};
+
+const CoreEntry kCores[] = {
+  { "plaits", "plts", &vbmi_create_plaits },
+  { "rings", "rngs", &vbmi_create_rings },
+  { "elements", "elmnts", &vbmi_create_elements },
+  { "clouds", "clds", &vbmi_create_clouds },
+  { "warps", "wrps", &vbmi_create_warps },
+  { "braids", "brds", &vbmi_create_braids },
+  { "tides", "tds1", &vbmi_create_tides },
+  { "tides2", "tds", &vbmi_create_tides2 },
+  { "marbles", "mrbls", &vbmi_create_marbles },
+  { "grids", "grds", &vbmi_create_grids },
+  // single precision builds of the mutableSources64 cores
+  { "plaits_f32", "plts_f32", &vbmi_create_plaits_f32 },
+  { "rings_f32", "rngs_f32", &vbmi_create_rings_f32 },
+  { "elements_f32", "elmnts_f32", &vbmi_create_elements_f32 },
+};
+
+const size_t kNumCores = sizeof(kCores) / sizeof(kCores[0]);
+
+const double kDefaultSampleRate = 48000.0;
+const int kDefaultVectorSize = 64;
+const double kDefaultTail = 2.0;
+
+const CoreEntry* FindCore(const std::string& name) {
+  for (size_t i = 0; i < kNumCores; ++i) {
+    if (name == kCores[i].name || name == kCores[i].alias) {
+      return &kCores[i];
+    }
+  }
+  return NULL;
+}
+
+void Usage() {
+  fprintf(stderr,
+      "usage: vbmi-render <core> -a automation [-o out.wav] [-i in.wav]\n"
+      "                   [-r sample_rate] [-b vector_size] [-d seconds]\n"
+      "                   [-f 16|32]\n\n"
+      "cores:");
+  for (size_t i = 0; i < kNumCores; ++i) {
+    fprintf(stderr, " %s", kCores[i].name);
+  }
+  fprintf(stderr, "\n");
+}
+
+// State of a signal inlet driven by 'sig@N' events.
+struct SignalInlet {
+  SignalInlet() : value(0.0), target(0.0), increment(0.0), remaining(0) { }
+
+  void Set(double v, double ramp, double sample_rate) {
+    remaining = static_cast<long>(ramp * sample_rate);
+    if (remaining > 0) {
+      target = v;
+      increment = (v - value) / remaining;
+    } else {
+      value = target = v;
+      remaining = 0;
+    }
+  }
+
+  double Tick() {
+    if (remaining > 0) {
+      value = --remaining ? value + increment : target;
+    }
+    return value;
+  }
+
+  double value;
+  double target;
+  double increment;
+  long remaining;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2 || argv[1][0] == '-') {
+    Usage();
+    return 1;
+  }
+  std::string core_name = argv[1];
+  std::string automation_path;
+  std::string input_path;
+  std::string output_path = "out.wav";
+  double sample_rate = 0.0;
+  int vector_size = 0;
+  double duration = 0.0;
+  int bits_per_sample = 32;
+
+  for (int i = 2; i < argc; ++i) {
+    std::string option = argv[i];
+    if (i + 1 >= argc) {
+      Usage();
+      return 1;
+    }
+    const char* value = argv[++i];
+    if (option == "-a") {
+      automation_path = value;
+    } else if (option == "-o") {
+      output_path = value;
+    } else if (option == "-i") {
+      input_path = value;
+    } else if (option == "-r") {
+      sample_rate = atof(value);
+    } else if (option == "-b") {
+      vector_size = atoi(value);
+    } else if (option == "-d") {
+      duration = atof(value);
+    } else if (option == "-f") {
+      bits_per_sample = atoi(value);
+    } else {
+      Usage();
+      return 1;
+    }
+  }
+
+  const CoreEntry* core = FindCore(core_name);
+  if (!core) {
+    fprintf(stderr, "vbmi-render: unknown core '%s'\n", core_name.c_str());
+    Usage();
+    return 1;
+  }
+
+  std::string error;
+  vbmi::Automation automation;
+  if (!automation_path.empty() &&
+      !vbmi::LoadAutomation(automation_path, &automation, &error)) {
+    fprintf(stderr, "vbmi-render: %s\n", error.c_str());
+    return 1;
+  }
+
+  // Command line settings override the ones from the automation file.
+  if (sample_rate <= 0.0) {
+    sample_rate = automation.sample_rate > 0.0
+        ? automation.sample_rate : kDefaultSampleRate;
+  }
+  if (vector_size <= 0) {
+    vector_size = automation.vector_size > 0
+        ? automation.vector_size : kDefaultVectorSize;
+  }
+  if (input_path.empty()) {
+    input_path = automation.input;
+  }
+
+  std::unique_ptr<vbmi::Module> module(core->factory());
+  if (vector_size % module->block_size()) {
+    fprintf(stderr, "vbmi-render: %s needs a vector size multiple of %d\n",
+            core->name, module->block_size());
+    return 1;
+  }
+
+  vbmi::AudioFile input;
+  input.sample_rate = sample_rate;
+  input.num_channels = 0;
+  if (!input_path.empty()) {
+    if (!vbmi::ReadWavFile(input_path, &input, &error)) {
+      fprintf(stderr, "vbmi-render: %s\n", error.c_str());
+      return 1;
+    }
+    if (input.sample_rate != sample_rate) {
+      fprintf(stderr, "vbmi-render: warning, %s is at %g Hz, rendering at %g Hz\n",
+              input_path.c_str(), input.sample_rate, sample_rate);
+    }
+  }
+
+  if (duration <= 0.0) {
+    duration = automation.duration;
+  }
+  if (duration <= 0.0) {
+    duration = input.num_frames() / sample_rate;
+    if (!automation.events.empty()) {
+      duration = std::max(duration, automation.events.back().time + kDefaultTail);
+    }
+    if (duration <= 0.0) {
+      duration = kDefaultTail;
+    }
+  }
+  long num_vectors = static_cast<long>(
+      ceil(duration * sample_rate / vector_size));
+
+  if (!module->Init(sample_rate)) {
+    fprintf(stderr, "vbmi-render: can't initialize %s at %g Hz\n",
+            core->name, sample_rate);
+    return 1;
+  }
+
+  // Like dsp64: inlets are connected when something feeds them.
+  int num_inputs = module->num_inputs();
+  int num_outputs = module->num_outputs();
+  std::vector<bool> driven(num_inputs, false);
+  for (int i = 0; i < module->num_audio_inputs() && input.num_channels; ++i) {
+    driven[i] = true;
+  }
+  for (size_t i = 0; i < automation.events.size(); ++i) {
+    const vbmi::AutomationEvent& e = automation.events[i];
+    if (e.selector == "sig") {
+      if (e.inlet >= num_inputs) {
+        fprintf(stderr, "vbmi-render: %s has no signal inlet %d\n",
+                core->name, e.inlet);
+        return 1;
+      }
+      driven[e.inlet] = true;
+    }
+  }
+  for (int i = 0; i < num_inputs; ++i) {
+    module->Connect(i, driven[i]);
+  }
+
+  std::vector<std::vector<double> > in_buffers(
+      num_inputs, std::vector<double>(vector_size, 0.0));
+  std::vector<std::vector<double> > out_buffers(
+      num_outputs, std::vector<double>(vector_size, 0.0));
+  std::vector<double*> ins(num_inputs);
+  std::vector<double*> outs(num_outputs);
+  for (int i = 0; i < num_inputs; ++i) {
+    ins[i] = &in_buffers[i][0];
+  }
+  for (int i = 0; i < num_outputs; ++i) {
+    outs[i] = &out_buffers[i][0];
+  }
+  std::vector<SignalInlet> signals(num_inputs);
+
+  vbmi::AudioFile output;
+  output.sample_rate = sample_rate;
+  output.num_channels = num_outputs;
+  output.channels.resize(num_outputs);
+  for (int i = 0; i < num_outputs; ++i) {
+    output.channels[i].reserve(num_vectors * vector_size);
+  }
+
+  size_t next_message = 0;
+  size_t next_signal = 0;
+  const std::vector<vbmi::AutomationEvent>& events = automation.events;
+  for (long v = 0; v < num_vectors; ++v) {
+    long start = v * vector_size;
+
+    // Messages due before the end of this vector are handled first.
+    double vector_end = (start + vector_size) / sample_rate;
+    for (; next_message < events.size() &&
+           events[next_message].time < vector_end; ++next_message) {
+      const vbmi::AutomationEvent& e = events[next_message];
+      if (e.selector == "sig") {
+        continue;
+      }
+      const double* args = e.args.empty() ? NULL : &e.args[0];
+      if (!module->Message(e.selector.c_str(), e.inlet,
+                           static_cast<int>(e.args.size()), args)) {
+        fprintf(stderr, "vbmi-render: %s doesn't understand '%s'\n",
+                core->name, e.selector.c_str());
+      }
+    }
+
+    for (long i = 0; i < vector_size; ++i) {
+      long frame = start + i;
+      double t = frame / sample_rate;
+      for (; next_signal < events.size() &&
+             events[next_signal].time <= t; ++next_signal) {
+        const vbmi::AutomationEvent& e = events[next_signal];
+        if (e.selector == "sig" && !e.args.empty()) {
+          signals[e.inlet].Set(e.args[0], e.ramp, sample_rate);
+        }
+      }
+      for (int j = 0; j < num_inputs; ++j) {
+        if (j < module->num_audio_inputs() && input.num_channels) {
+          const std::vector<double>& channel =
+              input.channels[j % input.num_channels];
+          in_buffers[j][i] = static_cast<size_t>(frame) < channel.size()
+              ? channel[frame] : 0.0;
+        } else {
+          in_buffers[j][i] = signals[j].Tick();
+        }
+      }
+    }
+
+    {
+      // as in the perform routines of the externals
+      vbmi::ScopedFlushDenormals flush_denormals;
+      module->Process(&ins[0], &outs[0], vector_size);
+    }
+
+    for (int j = 0; j < num_outputs; ++j) {
+      output.channels[j].insert(output.channels[j].end(),
+                                out_buffers[j].begin(), out_buffers[j].end());
+    }
+  }
+
+  // Trim to the exact duration.
+  size_t num_frames = static_cast<size_t>(duration * sample_rate + 0.5);
+  for (int j = 0; j < num_outputs; ++j) {
+    if (output.channels[j].size() > num_frames) {
+      output.channels[j].resize(num_frames);
+    }
+  }
+
+  if (!vbmi::WriteWavFile(output_path, output, bits_per_sample, &error)) {
+    fprintf(stderr, "vbmi-render: %s\n", error.c_str());
+    return 1;
+  }
+  printf("%s: %s, %d ch, %zu frames at %g Hz\n", output_path.c_str(),
+         core->name, num_outputs, output.num_frames(), sample_rate);
+  return 0;
+}
@@ -0,0 +1,210 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Minimal reader / writer for RIFF WAVE files.
+
+
+#include "wav_file.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace vbmi {
+
+namespace {
+
+const uint16_t kFormatPcm = 1;
+const uint16_t kFormatFloat = 3;
+const uint16_t kFormatExtensible = 0xfffe;
+
+uint16_t ReadU16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+uint32_t ReadU32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void WriteU16(FILE* fp, uint16_t v) {
+  uint8_t b[2] = { static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8) };
+  fwrite(b, 1, 2, fp);
+}
+
+void WriteU32(FILE* fp, uint32_t v) {
+  uint8_t b[4] = {
+    static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8),
+    static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 24)
+  };
+  fwrite(b, 1, 4, fp);
+}
+
+double DecodeSample(const uint8_t* p, uint16_t format, uint16_t bits) {
+  if (format == kFormatFloat) {
+    if (bits == 32) {
+      uint32_t u = ReadU32(p);
+      float f;
+      memcpy(&f, &u, sizeof(f));
+      return f;
+    } else {
+      uint64_t u = ReadU32(p) | (static_cast<uint64_t>(ReadU32(p + 4)) << 32);
+      double d;
+      memcpy(&d, &u, sizeof(d));
+      return d;
+    }
+  }
+  switch (bits) {
+    case 16:
+      return static_cast<int16_t>(ReadU16(p)) / 32768.0;
+    case 24: {
+      int32_t v = (p[0] << 8) | (p[1] << 16) | (static_cast<uint32_t>(p[2]) << 24);
+      return (v >> 8) / 8388608.0;
+    }
+    default:
+      return static_cast<int32_t>(ReadU32(p)) / 2147483648.0;
+  }
+}
+
+}  // namespace
+
+bool ReadWavFile(const std::string& path, AudioFile* file, std::string* error) {
+  FILE* fp = fopen(path.c_str(), "rb");
+  if (!fp) {
+    *error = "can't open " + path;
+    return false;
+  }
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(fp);
+
+  if (data.size() < 12 || memcmp(&data[0], "RIFF", 4) ||
+      memcmp(&data[8], "WAVE", 4)) {
+    *error = path + " is not a WAVE file";
+    return false;
+  }
+
+  uint16_t format = 0, channels = 0, bits = 0;
+  uint32_t sample_rate = 0;
+  const uint8_t* samples = NULL;
+  size_t samples_size = 0;
+
+  size_t pos = 12;
+  while (pos + 8 <= data.size()) {
+    const uint8_t* header = &data[pos];
+    uint32_t size = ReadU32(header + 4);
+    size_t available = std::min<size_t>(size, data.size() - pos - 8);
+    if (!memcmp(header, "fmt ", 4) && available >= 16) {
+      format = ReadU16(header + 8);
+      channels = ReadU16(header + 10);
+      sample_rate = ReadU32(header + 12);
+      bits = ReadU16(header + 22);
+      if (format == kFormatExtensible && available >= 26) {
+        format = ReadU16(header + 32);
+      }
+    } else if (!memcmp(header, "data", 4)) {
+      samples = header + 8;
+      samples_size = available;
+    }
+    pos += 8 + size + (size & 1);
+  }
+
+  bool supported = (format == kFormatPcm &&
+                    (bits == 16 || bits == 24 || bits == 32)) ||
+                   (format == kFormatFloat && (bits == 32 || bits == 64));
+  if (!supported || !channels || !samples) {
+    *error = path + ": unsupported WAVE format";
+    return false;
+  }
+
+  size_t bytes_per_sample = bits / 8;
+  size_t num_frames = samples_size / (bytes_per_sample * channels);
+  file->sample_rate = sample_rate;
+  file->num_channels = channels;
+  file->channels.assign(channels, std::vector<double>(num_frames));
+  for (size_t i = 0; i < num_frames; ++i) {
+    for (size_t c = 0; c < channels; ++c) {
+      const uint8_t* p = samples + (i * channels + c) * bytes_per_sample;
+      file->channels[c][i] = DecodeSample(p, format, bits);
+    }
+  }
+  return true;
+}
+
+bool WriteWavFile(const std::string& path, const AudioFile& file,
+                  int bits_per_sample, std::string* error) {
+  FILE* fp = fopen(path.c_str(), "wb");
+  if (!fp) {
+    *error = "can't open " + path + " for writing";
+    return false;
+  }
+
+  bool pcm = bits_per_sample == 16;
+  uint16_t bytes_per_sample = pcm ? 2 : 4;
+  uint16_t channels = file.num_channels;
+  uint32_t data_size = file.num_frames() * channels * bytes_per_sample;
+
+  fwrite("RIFF", 1, 4, fp);
+  WriteU32(fp, 36 + data_size);
+  fwrite("WAVE", 1, 4, fp);
+  fwrite("fmt ", 1, 4, fp);
+  WriteU32(fp, 16);
+  WriteU16(fp, pcm ? kFormatPcm : kFormatFloat);
+  WriteU16(fp, channels);
+  WriteU32(fp, static_cast<uint32_t>(file.sample_rate));
+  WriteU32(fp, static_cast<uint32_t>(file.sample_rate) * channels * bytes_per_sample);
+  WriteU16(fp, channels * bytes_per_sample);
+  WriteU16(fp, bytes_per_sample * 8);
+  fwrite("data", 1, 4, fp);
+  WriteU32(fp, data_size);
+
+  for (size_t i = 0; i < file.num_frames(); ++i) {
+    for (size_t c = 0; c < channels; ++c) {
+      double s = file.channels[c][i];
+      if (pcm) {
+        s = s < -1.0 ? -1.0 : (s > 1.0 ? 1.0 : s);
+        WriteU16(fp, static_cast<uint16_t>(static_cast<int16_t>(lrint(s * 32767.0))));
+      } else {
+        float f = static_cast<float>(s);
+        uint32_t u;
+        memcpy(&u, &f, sizeof(u));
+        WriteU32(fp, u);
+      }
+    }
+  }
+
+  bool ok = !ferror(fp);
+  fclose(fp);
+  if (!ok) {
+    *error = "error writing " + path;
+  }
+  return ok;
+}
+
+}  // namespace vbmi
@@ -1,6 +1,5 @@
-// Copyright 2017 Emilie Gillet.
 //
-// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+// Copyright 2021 Volker Böhm.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -8,10 +7,10 @@
 // to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
 // copies of the Software, and to permit persons to whom the Software is
 // furnished to do so, subject to the following conditions:
-// 
+//
 // The above copyright notice and this permission notice shall be included in
 // all copies or substantial portions of the Software.
-// 
+//
 // THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
 // IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
 // FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -19,46 +18,39 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
-// 
-// See http://creativecommons.org/licenses/MIT/ for more information.
-//
-// -----------------------------------------------------------------------------
 //
-// Resources definitions.
-//
-// Automatically generated with:
-// make resources
-
+// See http://creativecommons.org/licenses/MIT/ for more information.
 
-#ifndef TIDES2_RESOURCES_H_
-#define TIDES2_RESOURCES_H_
 
+// Minimal reader / writer for RIFF WAVE files.
 
-#include "stmlib/stmlib.h"
 
+#ifndef VBMI_HEADLESS_WAV_FILE_H_
+#define VBMI_HEADLESS_WAV_FILE_H_
 
+#include <string>
+#include <vector>
 
-namespace tides {
+namespace vbmi {
 
-typedef uint8_t ResourceId;
+struct AudioFile {
+  double sample_rate;
+  int num_channels;
+  // one vector per channel
+  std::vector<std::vector<double> > channels;
 
-extern const float* lookup_table_table[];
+  size_t num_frames() const {
+    return channels.empty() ? 0 : channels[0].size();
+  }
+};
 
-extern const int16_t* lookup_table_i16_table[];
+// Reads 16, 24 or 32 bit integer PCM and 32 or 64 bit float files.
+bool ReadWavFile(const std::string& path, AudioFile* file, std::string* error);
 
-extern const float lut_sine[];
-extern const float lut_bipolar_fold[];
-extern const float lut_unipolar_fold[];
-extern const int16_t lut_wavetable[];
-#define LUT_SINE 0
-#define LUT_SINE_SIZE 1281
-#define LUT_BIPOLAR_FOLD 1
-#define LUT_BIPOLAR_FOLD_SIZE 1028
-#define LUT_UNIPOLAR_FOLD 2
-#define LUT_UNIPOLAR_FOLD_SIZE 1028
-#define LUT_WAVETABLE 0
-#define LUT_WAVETABLE_SIZE 12300
+// Writes 32 bit float or 16 bit integer PCM, depending on bits_per_sample.
+bool WriteWavFile(const std::string& path, const AudioFile& file,
+                  int bits_per_sample, std::string* error);
 
-}  // namespace tides
+}  // namespace vbmi
 
-#endif  // TIDES2_RESOURCES_H_
+#endif  // VBMI_HEADLESS_WAV_FILE_H_
@@ -57,13 +57,13 @@ uint32_t AnalogOscillator::ComputePhaseIncrement(int16_t midi_pitch) {
     ++num_shifts;
   }
     
-  uint32_t a = lut_oscillator_increments[ref_pitch >> 4];
-  uint32_t b = lut_oscillator_increments[(ref_pitch >> 4) + 1];
+  const uint32_t* increments = tables_->oscillator_increments();
+  uint32_t a = increments[ref_pitch >> 4];
+  uint32_t b = increments[(ref_pitch >> 4) + 1];
   uint32_t phase_increment = a + \
       (static_cast<int32_t>(b - a) * (ref_pitch & 0xf) >> 4);
   phase_increment >>= num_shifts;
-  //return (uint32_t)(phase_increment * 96000./44100. + 0.5);
-    return (uint32_t)(phase_increment * srFactor_ + 0.5);     // vb, add scaling --> SR
+  return phase_increment;
 }
 
 void AnalogOscillator::Render(
@@ -74,7 +74,7 @@ void AnalogOscillator::Render(
   RenderFn fn = fn_table_[shape_];
   
   if (shape_ != previous_shape_) {
-    Init(sampleRate_);
+    Init(tables_->sample_rate());
     previous_shape_ = shape_;
   }
   
@@ -34,6 +34,7 @@
 #include <cstring>
 #include <cstdio>
 
+#include "braids/rate_tables.h"
 #include "braids/resources.h"
 
 namespace braids {
@@ -64,12 +65,13 @@ class AnalogOscillator {
       uint8_t*,
       size_t);
 
-  AnalogOscillator() { }
+  AnalogOscillator() : tables_(NULL) { }
   ~AnalogOscillator() { }
   
   inline void Init(double sr) {
-      sampleRate_ = sr;             // vb
-      srFactor_ = 96000. / sr;      // vb
+    if (!tables_ || tables_->sample_rate() != sr) {
+      tables_ = RateTables::ForSampleRate(sr);    // vb
+    }
     phase_ = 0;
     phase_increment_ = 1;
     high_ = false;
@@ -151,8 +153,7 @@ class AnalogOscillator {
   
   int32_t next_sample_;
     
-    double sampleRate_;     // vb
-    double srFactor_;       // vb
+  const RateTables* tables_;    // vb
   
   AnalogOscillatorShape shape_;
   AnalogOscillatorShape previous_shape_;
@@ -62,13 +62,13 @@ uint32_t DigitalOscillator::ComputePhaseIncrement(int16_t midi_pitch) {
     ++num_shifts;
   }
 
-  uint32_t a = lut_oscillator_increments[ref_pitch >> 4];
-  uint32_t b = lut_oscillator_increments[(ref_pitch >> 4) + 1];
+  const uint32_t* increments = tables_->oscillator_increments();
+  uint32_t a = increments[ref_pitch >> 4];
+  uint32_t b = increments[(ref_pitch >> 4) + 1];
   uint32_t phase_increment = a + \
       (static_cast<int32_t>(b - a) * (ref_pitch & 0xf) >> 4);
   phase_increment >>= num_shifts;
-  //return uint32_t(phase_increment * 96000./44100. + 0.5); // vb, add scaling --> SR;
-    return uint32_t(phase_increment * srFactor_ + 0.5); // vb, add scaling --> SR;
+  return phase_increment;
 }
 
 uint32_t DigitalOscillator::ComputeDelay(int16_t midi_pitch) {
@@ -85,8 +85,9 @@ uint32_t DigitalOscillator::ComputeDelay(int16_t midi_pitch) {
     ++num_shifts;
   }
   
-  uint32_t a = lut_oscillator_delays[ref_pitch >> 4];
-  uint32_t b = lut_oscillator_delays[(ref_pitch >> 4) + 1];
+  const uint32_t* delays = tables_->oscillator_delays();
+  uint32_t a = delays[ref_pitch >> 4];
+  uint32_t b = delays[(ref_pitch >> 4) + 1];
   uint32_t delay = a + (static_cast<int32_t>(b - a) * (ref_pitch & 0xf) >> 4);  
   delay >>= 12 - num_shifts;
   return delay;
@@ -110,13 +111,13 @@ void DigitalOscillator::Render(
   RenderFn fn = fn_table_[shape_];
   
   if (shape_ != previous_shape_) {
-    Init(sampleRate_);
+    Init(tables_->sample_rate());
     previous_shape_ = shape_;
     init_ = true;
   }
   
   phase_increment_ = ComputePhaseIncrement(pitch_);
-    delay_ = ComputeDelay(pitch_);        // TODO: correct delay_ --> SR, vb
+  delay_ = ComputeDelay(pitch_);
   
   if (pitch_ > kHighestNote) {
     pitch_ = kHighestNote;
@@ -196,7 +197,7 @@ void DigitalOscillator::RenderSawSwarm(
     hp_cutoff = 32767;
   }
   
-  int32_t f = Interpolate824(lut_svf_cutoff, hp_cutoff << 17);
+  int32_t f = Interpolate824(tables_->svf_cutoff(), hp_cutoff << 17);
   int32_t damp = lut_svf_damp[0];
   int32_t bp = state_.saw.bp;
   int32_t lp = state_.saw.lp;
@@ -655,7 +656,7 @@ void DigitalOscillator::RenderVowelFof(
         parameter_[1],
         parameter_[0],
         i) + (12 << 7);
-    svf_f[i] = Interpolate824(lut_svf_cutoff, frequency << 17);
+    svf_f[i] = Interpolate824(tables_->svf_cutoff(), frequency << 17);
     amplitudes[i] = InterpolateFormantParameter(
         formant_a_data,
         parameter_[1],
@@ -1028,7 +1029,7 @@ void DigitalOscillator::RenderStruckDrum(
   } else if (cutoff > 32767) {
     cutoff = 32767;
   }
-  int32_t f = Interpolate824(lut_svf_cutoff, cutoff << 16);
+  int32_t f = Interpolate824(tables_->svf_cutoff(), cutoff << 16);
   int32_t lp_state_0 = state_.add.lp_noise[0];
   int32_t lp_state_1 = state_.add.lp_noise[1];
   int32_t lp_state_2 = state_.add.lp_noise[2];
@@ -1836,7 +1837,7 @@ void DigitalOscillator::RenderFilteredNoise(
     const uint8_t* sync,
     int16_t* buffer,
     size_t size) {
-  int32_t f = Interpolate824(lut_svf_cutoff, pitch_ << 17);
+  int32_t f = Interpolate824(tables_->svf_cutoff(), pitch_ << 17);
   int32_t damp = Interpolate824(lut_svf_damp, parameter_[0] << 17);
   int32_t scale = Interpolate824(lut_svf_scale, parameter_[0] << 17);
   int32_t bp = state_.svf.bp;
@@ -2027,7 +2028,7 @@ void DigitalOscillator::RenderGranularCloud(
       g->envelope_phase_increment = 0;
       if ((Random::GetWord() & 0xffff) < 0x4000) {
         g->envelope_phase_increment = \
-            lut_granular_envelope_rate[parameter_[0] >> 7] << 3;
+            tables_->granular_envelope_rate()[parameter_[0] >> 7] << 3;
         g->envelope_phase = 0;
         g->phase_increment = phase_increment_;
         int32_t pitch_mod = Random::GetSample() * parameter_[1] >> 16;
@@ -32,6 +32,7 @@
 #include "stmlib/stmlib.h"
 
 #include "braids/excitation.h"
+#include "braids/rate_tables.h"
 #include "braids/svf.h"
 
 #include <cstring>
@@ -242,20 +243,21 @@ class DigitalOscillator {
  public:
   typedef void (DigitalOscillator::*RenderFn)(const uint8_t*, int16_t*, size_t);
 
-  DigitalOscillator() { }
+  DigitalOscillator() : tables_(NULL) { }
   ~DigitalOscillator() { }
   
   inline void Init(double sr) {
-      sampleRate_ = sr;
-      srFactor_ = 96000. / sr;
+    if (!tables_ || tables_->sample_rate() != sr) {
+      tables_ = RateTables::ForSampleRate(sr);    // vb
+    }
     memset(&state_, 0, sizeof(state_));
     pulse_[0].Init();
     pulse_[1].Init();
     pulse_[2].Init();
     pulse_[3].Init();
-    svf_[0].Init();
-    svf_[1].Init();
-    svf_[2].Init();
+    svf_[0].Init(tables_->svf_cutoff());
+    svf_[1].Init(tables_->svf_cutoff());
+    svf_[2].Init(tables_->svf_cutoff());
     phase_ = 0;
     strike_ = true;
     init_ = true;
@@ -353,8 +355,7 @@ class DigitalOscillator {
   
   uint8_t active_voice_;
     
-    double sampleRate_;     // vb
-    double srFactor_;       // vb
+  const RateTables* tables_;    // vb
   
   bool init_;
   bool strike_;
@@ -102,7 +102,7 @@ void MacroOscillator::RenderMorph(
   } else if (lp_cutoff > 32767) {
     lp_cutoff = 32767;
   }
-  int32_t f = Interpolate824(lut_svf_cutoff, lp_cutoff << 17);
+  int32_t f = Interpolate824(tables_->svf_cutoff(), lp_cutoff << 17);
   int32_t lp_state = lp_state_;
   int32_t fuzz_amount = parameter_[1] << 1;
   if (pitch_ > (80 << 7)) {
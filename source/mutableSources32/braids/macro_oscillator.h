@@ -35,6 +35,7 @@
 
 #include "braids/analog_oscillator.h"
 #include "braids/digital_oscillator.h"
+#include "braids/rate_tables.h"
 #include "braids/resources.h"
 #include "braids/settings.h"
 
@@ -48,7 +49,7 @@ class MacroOscillator {
   ~MacroOscillator() { }
   
   inline void Init(double sr) {
-      
+    tables_ = RateTables::ForSampleRate(sr);    // vb
     analog_oscillator_[0].Init(sr);
     analog_oscillator_[1].Init(sr);
     analog_oscillator_[2].Init(sr);
@@ -103,7 +104,7 @@ class MacroOscillator {
   uint8_t sync_buffer_[32];     // vb must be at least BLOCK_SIZE!
   int16_t temp_buffer_[32];
   int32_t lp_state_;
-    
+  const RateTables* tables_;    // vb
   
   AnalogOscillator analog_oscillator_[3];
   DigitalOscillator digital_oscillator_;
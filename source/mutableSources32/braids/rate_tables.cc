@@ -0,0 +1,97 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Sample rate dependent lookup tables.
+
+#include "braids/rate_tables.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace braids {
+
+const double kHardwareSampleRate = 96000.0;
+
+// Rounds and saturates a scaled table entry.
+template<typename T>
+inline T Scale(T value, double factor) {
+  double scaled = floor(static_cast<double>(value) * factor + 0.5);
+  double limit = static_cast<double>(static_cast<T>(~T(0)));
+  return static_cast<T>(std::min(scaled, limit));
+}
+
+void RateTables::Init(double sample_rate) {
+  sample_rate_ = sample_rate;
+
+  // Increments are inversely proportional to the rate, delays proportional.
+  // The 96 kHz tables are scaled rather than recomputed, so that the output
+  // at 96 kHz stays identical.
+  double factor = kHardwareSampleRate / sample_rate;
+  for (int32_t i = 0; i < LUT_OSCILLATOR_INCREMENTS_SIZE; ++i) {
+    oscillator_increments_[i] = Scale(lut_oscillator_increments[i], factor);
+  }
+  for (int32_t i = 0; i < LUT_OSCILLATOR_DELAYS_SIZE; ++i) {
+    oscillator_delays_[i] = Scale(lut_oscillator_delays[i], 1.0 / factor);
+  }
+  for (int32_t i = 0; i < LUT_GRANULAR_ENVELOPE_RATE_SIZE; ++i) {
+    granular_envelope_rate_[i] = Scale<uint32_t>(
+        lut_granular_envelope_rate[i], factor);
+  }
+
+  // One entry per semitone, from MIDI note 0. The cutoff is limited to an
+  // eighth of the sample rate, as in the original table.
+  if (sample_rate == kHardwareSampleRate) {
+    std::copy(
+        &lut_svf_cutoff[0],
+        &lut_svf_cutoff[LUT_SVF_CUTOFF_SIZE],
+        &svf_cutoff_[0]);
+  } else {
+    for (int32_t i = 0; i < LUT_SVF_CUTOFF_SIZE; ++i) {
+      double f = 440.0 * pow(2.0, (i - 69) / 12.0) / sample_rate;
+      f = std::min(f, 0.125);
+      svf_cutoff_[i] = static_cast<uint16_t>(32768.0 * 2.0 * sin(M_PI * f));
+    }
+  }
+}
+
+/* static */
+const RateTables* RateTables::ForSampleRate(double sample_rate) {
+  static std::mutex mutex;
+  static std::vector<RateTables*> tables;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (size_t i = 0; i < tables.size(); ++i) {
+    if (tables[i]->sample_rate() == sample_rate) {
+      return tables[i];
+    }
+  }
+  RateTables* t = new RateTables;
+  t->Init(sample_rate);
+  tables.push_back(t);
+  return t;
+}
+
+}  // namespace braids
@@ -0,0 +1,73 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// The lookup tables of resources.cc that depend on the sample rate, for any
+// rate. resources.cc has them for the 96 kHz of the hardware: phase
+// increments, delays and filter cutoffs for a given pitch. Tables for other
+// rates are computed the first time an oscillator is initialized at that
+// rate, and shared by all oscillators running at it.
+
+#ifndef BRAIDS_RATE_TABLES_H_
+#define BRAIDS_RATE_TABLES_H_
+
+#include "stmlib/stmlib.h"
+
+#include "braids/resources.h"
+
+namespace braids {
+
+class RateTables {
+ public:
+  // Not real-time safe the first time a rate is asked for, call it from
+  // Init(). The tables live until the program exits.
+  static const RateTables* ForSampleRate(double sample_rate);
+
+  inline double sample_rate() const { return sample_rate_; }
+  inline const uint32_t* oscillator_increments() const {
+    return oscillator_increments_;
+  }
+  inline const uint32_t* oscillator_delays() const {
+    return oscillator_delays_;
+  }
+  inline const uint16_t* svf_cutoff() const { return svf_cutoff_; }
+  inline const uint32_t* granular_envelope_rate() const {
+    return granular_envelope_rate_;
+  }
+
+ private:
+  RateTables() { }
+  void Init(double sample_rate);
+
+  double sample_rate_;
+  uint32_t oscillator_increments_[LUT_OSCILLATOR_INCREMENTS_SIZE];
+  uint32_t oscillator_delays_[LUT_OSCILLATOR_DELAYS_SIZE];
+  uint16_t svf_cutoff_[LUT_SVF_CUTOFF_SIZE];
+  uint32_t granular_envelope_rate_[LUT_GRANULAR_ENVELOPE_RATE_SIZE];
+
+  DISALLOW_COPY_AND_ASSIGN(RateTables);
+};
+
+}  // namespace braids
+
+#endif  // BRAIDS_RATE_TABLES_H_
@@ -48,6 +48,12 @@ class Svf {
   ~Svf() { }
   
   void Init() {
+    Init(lut_svf_cutoff);
+  }
+
+  // The cutoff table for the sample rate the filter runs at.
+  void Init(const uint16_t* cutoff_table) {
+    cutoff_table_ = cutoff_table;
     lp_ = 0;
     bp_ = 0;
     frequency_ = 33 << 7;
@@ -77,7 +83,7 @@ class Svf {
 
   inline int32_t Process(int32_t in) {
     if (dirty_) {
-      f_ = stmlib::Interpolate824(lut_svf_cutoff, frequency_ << 17);
+      f_ = stmlib::Interpolate824(cutoff_table_, frequency_ << 17);
       damp_ = stmlib::Interpolate824(lut_svf_damp, resonance_ << 17);
       dirty_ = false;
     }
@@ -98,6 +104,7 @@ class Svf {
   }
   
  private:
+  const uint16_t* cutoff_table_;
   bool dirty_;
   
   int16_t frequency_;
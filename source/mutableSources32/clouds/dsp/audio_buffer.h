@@ -285,6 +285,9 @@ class AudioBuffer {
     int16_t* get_buf16() {
         return s16_;
     }
+    const int16_t* get_buf16() const {
+        return s16_;
+    }
     int8_t* get_buf8() {
         return s8_;
     }
@@ -0,0 +1,130 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Read-only view on float samples owned by someone else (a locked MSP
+// buffer~), with the read interface of AudioBuffer, so that the grains can
+// play from it directly. Samples may be interleaved with other channels,
+// and any number of frames long. Nothing is copied or converted.
+//
+// The view has no interpolation tail, indices wrap around on every read
+// instead. The write head stays at 0, just like after copying a buffer~ into
+// the recording buffer: position 0 is the end of the material, position 1
+// its beginning.
+
+#ifndef CLOUDS_DSP_EXTERNAL_BUFFER_H_
+#define CLOUDS_DSP_EXTERNAL_BUFFER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "clouds/dsp/audio_buffer.h"
+
+namespace clouds {
+
+class ExternalBuffer {
+ public:
+  ExternalBuffer() { }
+  ~ExternalBuffer() { }
+
+  // In lo-fi mode the processor runs at half the sample rate, decimation
+  // skips every other frame so that the material keeps its pitch.
+  void Init(
+      const float* samples,
+      int32_t num_frames,
+      int32_t stride,
+      int32_t decimation) {
+    samples_ = samples;
+    stride_ = stride * decimation;
+    size_ = num_frames / decimation;
+  }
+
+  template<InterpolationMethod method>
+  inline float Read(int32_t integral, uint16_t fractional) const {
+    if (method == INTERPOLATION_ZOH) {
+      return ReadZOH(integral, fractional);
+    } else if (method == INTERPOLATION_LINEAR) {
+      return ReadLinear(integral, fractional);
+    } else if (method == INTERPOLATION_HERMITE) {
+      return ReadHermite(integral, fractional);
+    }
+    return 0.0f;
+  }
+
+  inline float ReadZOH(int32_t integral, uint16_t) const {
+    return sample(integral);
+  }
+
+  inline float ReadLinear(int32_t integral, uint16_t fractional) const {
+    float t = static_cast<float>(fractional) / 65536.0f;
+    float x0 = sample(integral);
+    float x1 = sample(integral + 1);
+    return x0 + (x1 - x0) * t;
+  }
+
+  inline float ReadHermite(int64_t integral, uint16_t fractional) const {
+    int32_t i = wrap(static_cast<int32_t>(integral));
+    float t = static_cast<float>(fractional) / 65536.0f;
+    float xm1 = sample(i);
+    float x0 = sample(i + 1);
+    float x1 = sample(i + 2);
+    float x2 = sample(i + 3);
+
+    // Laurent de Soras's Hermite interpolator.
+    const float c = (x1 - xm1) * 0.5f;
+    const float v = x0 - x1;
+    const float w = c + v;
+    const float a = w + v + (x2 - x0) * 0.5f;
+    const float b_neg = w + a;
+    return (((a * t) - b_neg) * t + c) * t + x0;
+  }
+
+  inline int32_t size() const { return size_; }
+  inline int32_t head() const { return 0; }
+
+ private:
+  inline int32_t wrap(int32_t index) const {
+    // Grains longer than the material can start before its beginning or
+    // read past its end more than once.
+    if (static_cast<uint32_t>(index) >= static_cast<uint32_t>(size_)) {
+      index %= size_;
+      if (index < 0) {
+        index += size_;
+      }
+    }
+    return index;
+  }
+
+  inline float sample(int32_t index) const {
+    return samples_[static_cast<size_t>(wrap(index)) * stride_];
+  }
+
+  const float* samples_;
+  int32_t stride_;
+  int32_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExternalBuffer);
+};
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_EXTERNAL_BUFFER_H_
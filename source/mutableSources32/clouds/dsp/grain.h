@@ -32,6 +32,7 @@
 #include "stmlib/stmlib.h"
 
 #include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/simd.h"
 
 #include "clouds/dsp/audio_buffer.h"
 
@@ -117,9 +118,9 @@ class Grain {
     envelope_phase_ = phase;
   }
   
-  template<int32_t num_channels, GrainQuality quality, Resolution resolution>
+  template<int32_t num_channels, GrainQuality quality, typename Buffer>
   inline void OverlapAdd(
-      const AudioBuffer<resolution>* buffer,
+      const Buffer* buffer,
       float* destination,
       float* envelope,
       size_t size) {
@@ -172,6 +173,93 @@ class Grain {
     phase_ = phase;
   }
   
+  // 16-bit buffers: same result as above, four output samples at a time.
+  // The interpolation taps of one sample are contiguous in the buffer, so
+  // each sample takes a single 64-bit load, and a transpose turns the loads
+  // of four samples into one vector per tap.
+  template<int32_t num_channels, GrainQuality quality>
+  inline void OverlapAdd(
+      const AudioBuffer<RESOLUTION_16_BIT>* buffer,
+      float* destination,
+      float* envelope,
+      size_t size) {
+    using namespace stmlib::simd;
+
+    if (!active_) {
+      return;
+    }
+    while (pre_delay_ && size) {
+      destination += 2;
+      --size;
+      --pre_delay_;
+    }
+
+    const size_t n = RenderEnvelopeVector<quality>(envelope, size);
+
+    const int32_t buffer_size = buffer[0].size();
+    const int16_t* l_samples = buffer[0].get_buf16();
+    const int16_t* r_samples = buffer[num_channels - 1].get_buf16();
+    const int32_t phase_increment = phase_increment_;
+    const int32_t first_sample = first_sample_;
+    const Vector gain_l = Splat(gain_l_);
+    const Vector gain_r = Splat(gain_r_);
+    const Vector one_minus_gain_l = Splat(1.0f - gain_l_);
+    const Vector one_minus_gain_r = Splat(1.0f - gain_r_);
+    const VectorInt phase_offset = SetInt(
+        0, phase_increment, 2 * phase_increment, 3 * phase_increment);
+    const VectorInt last_sample = SplatInt(buffer_size - 1);
+    int32_t phase = phase_;
+
+    size_t i = 0;
+    for (; i + kWidth <= n; i += kWidth) {
+      VectorInt p = Add(SplatInt(phase), phase_offset);
+      VectorInt sample_index = Add(SplatInt(first_sample), ShiftRight<16>(p));
+      sample_index = Sub(sample_index, And(
+          GreaterThan(sample_index, last_sample), SplatInt(buffer_size)));
+      int32_t index[kWidth];
+      Store(index, sample_index);
+      Vector t = Mul(
+          ToFloat(And(p, SplatInt(65535))),
+          Splat(1.0f / 65536.0f));
+      phase += kWidth * phase_increment;
+      Vector gain = Load(&envelope[i]);
+
+      Vector l = Mul(Read<quality>(l_samples, index, t), gain);
+      Vector out_l, out_r;
+      if (num_channels == 1) {
+        out_l = Mul(l, gain_l);
+        out_r = Mul(l, gain_r);
+      } else {
+        Vector r = Mul(Read<quality>(r_samples, index, t), gain);
+        out_l = Add(Mul(l, gain_l), Mul(r, one_minus_gain_r));
+        out_r = Add(Mul(r, gain_r), Mul(l, one_minus_gain_l));
+      }
+      Vector a, b;
+      Interleave(out_l, out_r, &a, &b);
+      Store(destination, Add(Load(destination), a));
+      Store(destination + kWidth, Add(Load(destination + kWidth), b));
+      destination += 2 * kWidth;
+    }
+
+    for (; i < n; ++i) {
+      int32_t sample_index = first_sample + (phase >> 16);
+      float gain = envelope[i];
+      float l = buffer[0].template Read<InterpolationMethod(quality)>(
+          sample_index, phase & 65535) * gain;
+      if (num_channels == 1) {
+        *destination++ += l * gain_l_;
+        *destination++ += l * gain_r_;
+      } else {
+        float r = buffer[1].template Read<InterpolationMethod(quality)>(
+            sample_index, phase & 65535) * gain;
+        *destination++ += l * gain_l_ + r * (1.0f - gain_r_);
+        *destination++ += r * gain_r_ + l * (1.0f - gain_l_);
+      }
+      phase += phase_increment;
+    }
+    phase_ = phase;
+  }
+
   inline bool active() { return active_; }
   
   inline GrainQuality recommended_quality() const {
@@ -179,6 +267,103 @@ class Grain {
   }
 
  private:
+  // RenderEnvelope() for the vectorized OverlapAdd(): the phase is still
+  // accumulated sample by sample, the window is then computed on vectors.
+  // Returns the number of samples left in the grain (at most size), the
+  // envelope is padded with zeros to a multiple of the vector size.
+  template<GrainQuality quality>
+  inline size_t RenderEnvelopeVector(float* destination, size_t size) {
+    using namespace stmlib::simd;
+
+    const float increment = envelope_phase_increment_;
+    float phase = envelope_phase_;
+    size_t n = 0;
+    while (n < size) {
+      float gain = phase;
+      phase += increment;
+      if (phase >= 2.0f) {
+        active_ = false;
+        break;
+      }
+      destination[n++] = gain;
+    }
+    envelope_phase_ = phase;
+
+    size_t padded_size = (n + kWidth - 1) & ~(kWidth - 1);
+    for (size_t i = n; i < padded_size; ++i) {
+      destination[i] = 0.0f;
+    }
+
+    const bool use_lut_for_envelope = envelope_smoothness_ != 0.0f;
+    const Vector smoothness = Splat(envelope_smoothness_);
+    const Vector slope = Splat(envelope_slope_);
+    const Vector one = Splat(1.0f);
+    const Vector two = Splat(2.0f);
+    for (size_t i = 0; i < padded_size; i += kWidth) {
+      Vector gain = Load(&destination[i]);
+      gain = Min(gain, Sub(two, gain));
+      if (use_lut_for_envelope) {
+        if (quality == GRAIN_QUALITY_HIGH) {
+          float index[kWidth];
+          float a[kWidth];
+          float b[kWidth];
+          Store(index, Mul(gain, Splat(4096.0f)));
+          for (size_t j = 0; j < kWidth; ++j) {
+            int32_t integral = static_cast<int32_t>(index[j]);
+            index[j] -= static_cast<float>(integral);
+            a[j] = lut_window[integral];
+            b[j] = lut_window[integral + 1];
+          }
+          Vector va = Set(a[0], a[1], a[2], a[3]);
+          Vector vb = Set(b[0], b[1], b[2], b[3]);
+          Vector fractional = Set(index[0], index[1], index[2], index[3]);
+          Vector window = Add(va, Mul(Sub(vb, va), fractional));
+          gain = Add(gain, Mul(smoothness, Sub(window, gain)));
+        }
+      } else {
+        if (quality >= GRAIN_QUALITY_MEDIUM) {
+          gain = Min(Mul(gain, slope), one);
+        }
+      }
+      Store(&destination[i], gain);
+    }
+    return n;
+  }
+
+  // Reads 4 consecutive samples and interpolates them like
+  // AudioBuffer::Read().
+  template<GrainQuality quality>
+  static inline stmlib::simd::Vector Read(
+      const int16_t* samples,
+      const int32_t* index,
+      stmlib::simd::Vector t) {
+    using namespace stmlib::simd;
+
+    Vector xm1 = LoadInt16(&samples[index[0]]);
+    Vector x0 = LoadInt16(&samples[index[1]]);
+    Vector x1 = LoadInt16(&samples[index[2]]);
+    Vector x2 = LoadInt16(&samples[index[3]]);
+    Transpose(&xm1, &x0, &x1, &x2);
+    const Vector scale = Splat(1.0f / 32768.0f);
+
+    if (quality == GRAIN_QUALITY_LOW) {
+      return Mul(xm1, scale);
+    } else if (quality == GRAIN_QUALITY_MEDIUM) {
+      return Mul(Add(xm1, Mul(Sub(x0, xm1), t)), scale);
+    } else {
+      const Vector half = Splat(0.5f);
+      const Vector c = Mul(Sub(x1, xm1), half);
+      const Vector v = Sub(x0, x1);
+      const Vector w = Add(c, v);
+      const Vector a = Add(Add(w, v), Mul(Sub(x2, x0), half));
+      const Vector b_neg = Add(w, a);
+      Vector y = Sub(Mul(a, t), b_neg);
+      y = Add(Mul(y, t), c);
+      y = Add(Mul(y, t), x0);
+      return Mul(y, scale);
+    }
+  }
+
   int32_t first_sample_;
   int32_t width_;
   int32_t phase_;
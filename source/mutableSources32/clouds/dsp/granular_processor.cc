@@ -53,6 +53,7 @@ void GranularProcessor::Init(
   num_channels_ = 2;
   low_fidelity_ = false;
   bypass_ = false;
+  max_num_grains_ = 0;
   
   src_down_.Init();
   src_up_.Init();
@@ -61,6 +62,7 @@ void GranularProcessor::Init(
   
   previous_playback_mode_ = PLAYBACK_MODE_LAST;
   reset_buffers_ = true;
+  use_external_buffer_ = false;
   dry_wet_ = 0.0f;
     
     sr_ = 48000.f;      // vb, init sample rate
@@ -75,6 +77,25 @@ void GranularProcessor::ResetFilters() {
   }
 }
 
+void GranularProcessor::set_external_buffer(
+    const float* samples,
+    int32_t num_frames,
+    int32_t num_channels) {
+  int32_t decimation = low_fidelity_ ? kDownsamplingFactor : 1;
+  use_external_buffer_ = samples && num_channels > 0 &&
+      num_frames >= static_cast<int32_t>(kMaxBlockSize) * decimation;
+  if (!use_external_buffer_) {
+    return;
+  }
+  // A mono buffer~ feeds both channels.
+  external_buffer_[0].Init(samples, num_frames, num_channels, decimation);
+  external_buffer_[1].Init(
+      samples + (num_channels > 1 ? 1 : 0),
+      num_frames,
+      num_channels,
+      decimation);
+}
+
 void GranularProcessor::ProcessGranular(
     FloatFrame* input,
     FloatFrame* output,
@@ -118,7 +139,9 @@ void GranularProcessor::ProcessGranular(
       parameters_.granular.window_shape = parameters_.texture < 0.75f
           ? parameters_.texture * 1.333f : 1.0f;
   
-      if (resolution() == 8) {
+      if (use_external_buffer_) {
+        player_.Play(external_buffer_, parameters_, &output[0].l, size);
+      } else if (resolution() == 8) {
         player_.Play(buffer_8_, parameters_, &output[0].l, size);
       } else {
         player_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -356,7 +379,8 @@ bool GranularProcessor::LoadPersistentData(const uint32_t* data) {
     // and the block size.
     data += 2;
     memcpy(block[i].data, data, block[i].size);
-    data += block[i].size / sizeof(uint32_t);
+    // vb: blocks are padded to whole words, clds~ buffers can have any size.
+    data += (block[i].size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
     
     if (i == 0) {
       // We now know from which mode the data was saved.
@@ -464,14 +488,15 @@ void GranularProcessor::Prepare() {
         }
           
       }
-      int32_t num_grains = (num_channels_ == 1 ? 40 : 32) * \
-          (low_fidelity_ ? 23 : 16) >> 4;
-      player_.Init(num_channels_, num_grains);
+      player_.Init(num_channels_, num_grains());
       ws_player_.Init(&correlator_, num_channels_);
       looper_.Init(num_channels_);
     }
     reset_buffers_ = false;
     previous_playback_mode_ = playback_mode_;
+  } else if (playback_mode_ != PLAYBACK_MODE_SPECTRAL &&
+             player_.max_num_grains() != num_grains()) {
+    player_.set_max_num_grains(num_grains());
   }
   
   if (playback_mode_ == PLAYBACK_MODE_SPECTRAL) {
@@ -33,6 +33,7 @@
 #include "stmlib/dsp/filter.h"
 
 #include "clouds/dsp/correlator.h"
+#include "clouds/dsp/external_buffer.h"
 #include "clouds/dsp/frame.h"
 #include "clouds/dsp/fx/diffuser.h"
 #include "clouds/dsp/fx/pitch_shifter.h"
@@ -138,6 +139,20 @@ class GranularProcessor {
     low_fidelity_ = low_fidelity;
   }
   
+  // Maximum number of grains in granular mode, 0 for the number the
+  // hardware uses with the current quality setting. Takes effect in the
+  // next call to Prepare().
+  inline void set_max_num_grains(int32_t max_num_grains) {
+    max_num_grains_ = max_num_grains;
+  }
+
+  inline int32_t num_grains() const {
+    if (max_num_grains_ > 0) {
+      return std::min(max_num_grains_, kMaxNumGrains);
+    }
+    return (num_channels_ == 1 ? 40 : 32) * (low_fidelity_ ? 23 : 16) >> 4;
+  }
+
   inline int32_t quality() const {
     int32_t quality = 0;
     if (num_channels_ == 1) quality |= 1;
@@ -153,6 +168,12 @@ class GranularProcessor {
   void GetPersistentData(PersistentBlock* block, size_t *num_blocks);
   bool LoadPersistentData(const uint32_t* data);
   void PreparePersistentData();
+
+    // vb: size of the buffer blocks GetPersistentData() returns once the
+    // processor runs with 'quality', to check data before loading it.
+    inline size_t persistent_buffer_size(int32_t quality) const {
+        return buffer_size_[quality & 1 ? 0 : 1];
+    }
     
     
     //vb: add method to retrieve internal audio buffer
@@ -170,6 +191,19 @@ class GranularProcessor {
     AudioBuffer<RESOLUTION_8_BIT_MU_LAW>* GetAudioBuf8() {
         return buffer_8_;
     }
+    // vb: let the grains read from samples owned by the host (a locked
+    // buffer~) instead of the recording buffer. Only the granular mode
+    // uses them, the recording buffer keeps running for the other modes.
+    // The samples must stay valid until the next call, NULL switches back.
+    void set_external_buffer(
+        const float* samples,
+        int32_t num_frames,
+        int32_t num_channels);
+
+    inline bool external_buffer() const {
+        return use_external_buffer_;
+    }
+
     // vb: make this public
     inline int32_t resolution() const {
         return low_fidelity_ ? 8 : 16;
@@ -190,6 +224,7 @@ class GranularProcessor {
   PlaybackMode playback_mode_;
   PlaybackMode previous_playback_mode_;
   int32_t num_channels_;
+  int32_t max_num_grains_;
   bool low_fidelity_;
   
   bool silence_;
@@ -218,6 +253,8 @@ class GranularProcessor {
   
   AudioBuffer<RESOLUTION_8_BIT_MU_LAW> buffer_8_[2];
   AudioBuffer<RESOLUTION_16_BIT> buffer_16_[2];
+  ExternalBuffer external_buffer_[2];
+  bool use_external_buffer_;
   
   FloatFrame in_[kMaxBlockSize];
   FloatFrame in_downsampled_[kMaxBlockSize / kDownsamplingFactor];
@@ -34,6 +34,7 @@
 #include <algorithm>
 
 #include "stmlib/dsp/atan.h"
+#include "stmlib/dsp/simd.h"
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/random.h"
 
@@ -46,7 +47,9 @@
 
 namespace clouds {
 
-const int32_t kMaxNumGrains = 64;
+// The hardware plays up to 64 grains (40 in mono, 32 in stereo, more in
+// lo-fi mode), set_max_num_grains() allows for denser clouds.
+const int32_t kMaxNumGrains = 256;
 
 using namespace stmlib;
 
@@ -56,8 +59,7 @@ class GranularSamplePlayer {
   ~GranularSamplePlayer() { }
   
   void Init(int32_t num_channels, int32_t max_num_grains) {
-    max_num_grains_ = max_num_grains;
-    num_midfi_grains_ = 3 * max_num_grains / 4;
+    set_max_num_grains(max_num_grains);
     gain_normalization_ = 1.0f;
     for (int32_t i = 0; i < kMaxNumGrains; ++i) {
       grains_[i].Init();
@@ -67,9 +69,22 @@ class GranularSamplePlayer {
     grain_size_hint_ = 1024.0f;
   }
   
-  template<Resolution resolution>
+  // Grains beyond the new maximum are stopped.
+  void set_max_num_grains(int32_t max_num_grains) {
+    CONSTRAIN(max_num_grains, 1, kMaxNumGrains);
+    for (int32_t i = max_num_grains; i < kMaxNumGrains; ++i) {
+      grains_[i].Init();
+    }
+    max_num_grains_ = max_num_grains;
+    num_midfi_grains_ = 3 * max_num_grains / 4;
+  }
+
+  inline int32_t max_num_grains() const { return max_num_grains_; }
+
+  // Buffer is one of the AudioBuffer resolutions or an ExternalBuffer.
+  template<typename Buffer>
   void Play(
-      const AudioBuffer<resolution>* buffer,
+      const Buffer* buffer,
       const Parameters& parameters,
       float* out, size_t size) {
     float overlap = parameters.granular.overlap;
@@ -246,7 +261,7 @@ class GranularSamplePlayer {
   
   Grain grains_[kMaxNumGrains];
   int32_t available_grains_[kMaxNumGrains];
-  float envelope_buffer_[kMaxBlockSize];
+  float envelope_buffer_[kMaxBlockSize + stmlib::simd::kWidth];
   
   DISALLOW_COPY_AND_ASSIGN(GranularSamplePlayer);
 };
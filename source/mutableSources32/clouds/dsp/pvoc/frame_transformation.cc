@@ -70,20 +70,32 @@ void FrameTransformation::Process(
     const Parameters& parameters,
     float* fft_out,
     float* ifft_in) {
+  Analyze(parameters, fft_out);
+  Synthesize(parameters, fft_out, ifft_in);
+}
+
+void FrameTransformation::Analyze(
+    const Parameters& parameters,
+    float* fft_out) {
   fft_out[0] = 0.0f;
   fft_out[fft_size_ >> 1] = 0.0f;
 
-  bool freeze = parameters.freeze;
-  bool glitch = parameters.gate;
-  float pitch_ratio = SemitonesToRatio(parameters.pitch);
-  
-  if (!freeze) {
+  if (!parameters.freeze) {
     RectangularToPolar(fft_out);
     StoreMagnitudes(
         fft_out,
         parameters.position,
         parameters.spectral.refresh_rate);
   }
+}
+
+void FrameTransformation::Synthesize(
+    const Parameters& parameters,
+    float* fft_out,
+    float* ifft_in) {
+  bool glitch = parameters.gate;
+  float pitch_ratio = SemitonesToRatio(parameters.pitch);
+  
   float* temp = &fft_out[0];
   ReplayMagnitudes(ifft_in, parameters.position);
   WarpMagnitudes(ifft_in, temp, parameters.spectral.warp);
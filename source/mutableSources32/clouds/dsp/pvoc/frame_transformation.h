@@ -55,6 +55,15 @@ class FrameTransformation {
       float* fft_out,
       float* ifft_in);
   
+  // Process() in two halves, for the STFT to run them in different blocks:
+  // the analysis stores the magnitudes of fft_out, the synthesis builds
+  // ifft_in and uses fft_out as scratch space.
+  void Analyze(const Parameters& parameters, float* fft_out);
+  void Synthesize(
+      const Parameters& parameters,
+      float* fft_out,
+      float* ifft_in);
+  
  private:
   void RectangularToPolar(float* fft_data);
   void PolarToRectangular(float* fft_data);
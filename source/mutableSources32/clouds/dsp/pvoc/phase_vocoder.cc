@@ -98,9 +98,41 @@ void PhaseVocoder::Process(
   }
 }
 
+// On the module, Buffer() runs in the main loop, while the audio interrupt
+// records the next hop. Here it is called after every block, so instead of
+// transforming the whole frame in the block that completes a hop (a spike
+// of two 4096 point FFTs per channel), its steps are spread evenly over the
+// blocks of the next hop. The frame is done before its output is read, so
+// this adds no latency.
 void PhaseVocoder::Buffer() {
+  size_t pending = 0;
   for (int32_t i = 0; i < num_channels_; ++i) {
-    stft_[i].Buffer();
+    pending += stft_[i].pending_steps();
+  }
+  if (!pending) {
+    return;
+  }
+  
+  // Frames older than the last one are overdue.
+  size_t frame_steps = stft_[0].num_steps() * num_channels_;
+  size_t overdue = pending > frame_steps ? pending - frame_steps : 0;
+  size_t block_size = stft_[0].process_size();
+  size_t remaining = stft_[0].hop_size() - stft_[0].hop_position();
+  size_t num_blocks = block_size ? remaining / block_size : 0;
+  size_t budget = num_blocks
+      ? overdue + (pending - overdue + num_blocks - 1) / num_blocks
+      : pending;
+  
+  while (budget--) {
+    // Frame by frame, and channel by channel within a frame, since the
+    // channels share the FFT buffers.
+    STFT* stft = &stft_[0];
+    for (int32_t i = 1; i < num_channels_; ++i) {
+      if (stft_[i].frames_done() < stft->frames_done()) {
+        stft = &stft_[i];
+      }
+    }
+    stft->Step();
   }
 }
 
@@ -54,6 +54,13 @@ void STFT::Init(
     ++fft_num_passes_;
   }
   buffer_size_ = fft_size_ + hop_size_;
+#ifdef USE_ARM_FFT
+  fft_num_steps_ = 1;
+#else
+  fft_num_steps_ = FFT::num_steps(fft_num_passes_);
+#endif  // USE_ARM_FFT
+  // Window, FFT, analysis and synthesis by the modifier, IFFT, overlap-add.
+  num_steps_ = 1 + fft_num_steps_ + 2 + fft_num_steps_ + 1;
   
   fft_ = fft;
 #ifdef USE_ARM_FFT
@@ -85,6 +92,8 @@ void STFT::Reset() {
   fill(&synthesis_[0], &synthesis_[buffer_size_], 0);
   ready_ = 0;
   done_ = 0;
+  step_ = 0;
+  process_size_ = 0;
 }
 
 void STFT::Process(
@@ -94,6 +103,7 @@ void STFT::Process(
     size_t size,
     size_t stride) {
   parameters_ = &parameters;
+  process_size_ = size;
   while (size) {
     size_t processed = min(size, hop_size_ - block_size_);
     for (size_t i = 0; i < processed; ++i) {
@@ -113,6 +123,9 @@ void STFT::Process(
     if (block_size_ >= hop_size_) {
       block_size_ -= hop_size_;
       ++ready_;
+      // The modifier sees the parameters of the block that completed the
+      // frame, however late the frame is processed.
+      frame_parameters_ = parameters;
     }
   }
 }
@@ -122,6 +135,46 @@ void STFT::Buffer() {
     return;
   }
   
+  size_t done = done_;
+  while (done_ == done) {
+    Step();
+  }
+}
+
+bool STFT::Step() {
+  if (ready_ == done_) {
+    return false;
+  }
+  
+  if (step_ == 0) {
+    Analyze();
+  } else if (step_ <= fft_num_steps_) {
+    DirectFft(step_ - 1);
+  } else if (step_ == fft_num_steps_ + 1) {
+    // Process in the frequency domain.
+    if (modifier_ != NULL && parameters_ != NULL) {
+      modifier_->Analyze(frame_parameters_, &fft_out_[0]);
+    }
+  } else if (step_ == fft_num_steps_ + 2) {
+    if (modifier_ != NULL && parameters_ != NULL) {
+      modifier_->Synthesize(frame_parameters_, &fft_out_[0], &ifft_in_[0]);
+    } else {
+      copy(&fft_out_[0], &fft_out_[fft_size_], &ifft_in_[0]);
+    }
+  } else if (step_ <= 2 * fft_num_steps_ + 2) {
+    InverseFft(step_ - fft_num_steps_ - 3);
+  } else {
+    Synthesize();
+  }
+  
+  ++step_;
+  if (step_ == num_steps_) {
+    step_ = 0;
+  }
+  return true;
+}
+
+void STFT::Analyze() {
   // Copy block to FFT buffer and apply window.
   size_t source_ptr = process_ptr_;
   const float* w = window_;
@@ -133,7 +186,9 @@ void STFT::Buffer() {
     }
     w += window_stride_;
   }
-  
+}
+
+void STFT::DirectFft(size_t step) {
   // Compute FFT. fft_in is lost.
 #ifdef USE_ARM_FFT
   arm_rfft_fast_f32(fft_, fft_in_, fft_out_, 0);
@@ -144,19 +199,11 @@ void STFT::Buffer() {
     fft_out_[i + fft_size_ / 2] = fft_in_[2 * i + 1];
   }
 #else
-  if (fft_size_ != FFT::max_size) {
-    fft_->Direct(fft_in_, fft_out_, fft_num_passes_);
-  } else {
-    fft_->Direct(fft_in_, fft_out_);
-  }
+  fft_->DirectStep(fft_in_, fft_out_, fft_num_passes_, step);
 #endif  // USE_ARM_FFT
-  // Process in the frequency domain.
-  if (modifier_ != NULL && parameters_ != NULL) {
-    modifier_->Process(*parameters_, &fft_out_[0], &ifft_in_[0]);
-  } else {
-    copy(&fft_out_[0], &fft_out_[fft_size_], &ifft_in_[0]);
-  }
-  
+}
+
+void STFT::InverseFft(size_t step) {
   // Compute IFFT. ifft_in is lost.
 #ifdef USE_ARM_FFT
   // Re-arrange data.
@@ -167,13 +214,11 @@ void STFT::Buffer() {
   }
   arm_rfft_fast_f32(fft_, ifft_in_, ifft_out_, 1);
 #else
-  if (fft_size_ != FFT::max_size) {
-    fft_->Inverse(ifft_in_, ifft_out_, fft_num_passes_);
-  } else {
-    fft_->Inverse(ifft_in_, ifft_out_);
-  }
+  fft_->InverseStep(ifft_in_, ifft_out_, fft_num_passes_, step);
 #endif  // USE_ARM_FFT
-  
+}
+
+void STFT::Synthesize() {
   size_t destination_ptr = process_ptr_;
 #ifdef USE_ARM_FFT
   float inverse_window_size = 1.0f / \
@@ -183,7 +228,7 @@ void STFT::Buffer() {
       float(fft_size_ * fft_size_ / hop_size_ >> 1);
 #endif  // USE_ARM_FFT
     
-  w = window_;
+  const float* w = window_;
   for (size_t i = 0; i < fft_size_; ++i) {
     float s = ifft_out_[i] * w[0] * inverse_window_size;
     
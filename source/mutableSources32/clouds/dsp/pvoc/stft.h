@@ -31,23 +31,33 @@
 
 #include "stmlib/stmlib.h"
 
+#include "clouds/dsp/parameters.h"
+
 // #define USE_ARM_FFT
 
+// The FFT backend is chosen at build time. Besides the ARM one, a backend
+// provides Init(), num_steps(n), DirectStep() and InverseStep() and uses
+// the data layout of ShyFFT. USE_SHY_FFT (cmake -DVBMI_SHY_FFT=ON) selects
+// the original scalar ShyFFT instead of the vectorized one.
+// #define USE_SHY_FFT
+
 #ifdef USE_ARM_FFT
   #include <arm_math.h>
-#else
+#elif defined(USE_SHY_FFT)
   #include "stmlib/fft/shy_fft.h"
+#else
+  #include "stmlib/fft/simd_fft.h"
 #endif  // USE_ARM_FFT
 
 namespace clouds {
 
-struct Parameters;
-
 const size_t kMaxFftSize = 4096;
 #ifdef USE_ARM_FFT
   typedef arm_rfft_fast_instance_f32 FFT;
-#else
+#elif defined(USE_SHY_FFT)
   typedef stmlib::ShyFFT<float, kMaxFftSize, stmlib::RotationPhasor> FFT;
+#else
+  typedef stmlib::SimdFFT<kMaxFftSize> FFT;
 #endif  // USE_ARM_FFT
 
 typedef class FrameTransformation Modifier;
@@ -78,12 +88,38 @@ class STFT {
       size_t size,
       size_t stride);
 
+  // Transforms, modifies and resynthesizes the next frame that is ready.
   void Buffer();
+
+  // The same work, one step (one FFT pass, the window, ...) at a time.
+  // Returns false when no frame is ready. The output of a frame is only
+  // read once the hop after it has been recorded, so its num_steps() steps
+  // can be spread over the blocks of that hop.
+  bool Step();
+
+  inline size_t num_steps() const { return num_steps_; }
+  // Steps left for the frames that are ready.
+  inline size_t pending_steps() const {
+    return (ready_ - done_) * num_steps_ - step_;
+  }
+  inline size_t frames_done() const { return done_; }
+  inline size_t hop_size() const { return hop_size_; }
+  // Samples recorded since the last frame became ready.
+  inline size_t hop_position() const { return block_size_; }
+  // Size of the last Process() call.
+  inline size_t process_size() const { return process_size_; }
   
  private:
+  void Analyze();
+  void DirectFft(size_t step);
+  void InverseFft(size_t step);
+  void Synthesize();
+
+
   FFT* fft_;
   size_t fft_size_;
   size_t fft_num_passes_;
+  size_t fft_num_steps_;
   size_t hop_size_;
   size_t buffer_size_;
   float* fft_in_;
@@ -103,8 +139,13 @@ class STFT {
   
   size_t ready_;
   size_t done_;
+  size_t step_;
+  size_t num_steps_;
+  size_t process_size_;
   
   const Parameters* parameters_;
+  // Parameters at the time the last frame became ready.
+  Parameters frame_parameters_;
   
   Modifier* modifier_;
   
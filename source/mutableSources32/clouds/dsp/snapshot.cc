@@ -0,0 +1,316 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Snapshot files.
+
+#include "clouds/dsp/snapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "clouds/dsp/mu_law.h"
+
+namespace clouds {
+
+using namespace stmlib;
+
+const uint32_t kSnapshotTag = FourCC<'c', 'l', 'd', 's'>::value;
+const uint32_t kSnapshotVersion = 1;
+const uint32_t kBufferTag = FourCC<'b', 'u', 'f', 'f'>::value;
+
+STATIC_ASSERT(sizeof(SnapshotHeader) % sizeof(uint32_t) == 0, word_aligned);
+
+// Blocks are padded to whole words, as LoadPersistentData() expects.
+inline size_t Padded(size_t size) {
+  return (size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+}
+
+// Size of a block in the file.
+inline size_t StoredSize(uint32_t encoding, uint32_t tag, uint32_t size) {
+  return encoding == SNAPSHOT_ENCODING_MU_LAW && tag == kBufferTag
+      ? size / 2
+      : size;
+}
+
+int32_t WriteSnapshot(
+    GranularProcessor* processor,
+    const char* path,
+    SnapshotEncoding encoding) {
+  PersistentBlock block[4];
+  size_t num_blocks;
+  processor->PreparePersistentData();
+  processor->GetPersistentData(block, &num_blocks);
+
+  const PersistentState* state = static_cast<const PersistentState*>(
+      block[0].data);
+  if ((state->quality & 2) || state->spectral) {
+    encoding = SNAPSHOT_ENCODING_PCM;
+  }
+
+  SnapshotHeader header;
+  memset(&header, 0, sizeof(header));
+  header.tag = kSnapshotTag;
+  header.version = kSnapshotVersion;
+  header.encoding = encoding;
+  header.num_blocks = num_blocks;
+  header.playback_mode = processor->playback_mode();
+  header.parameters_size = sizeof(Parameters);
+  header.parameters = processor->parameters();
+  for (size_t i = 0; i < num_blocks; ++i) {
+    header.data_size += 2 * sizeof(uint32_t) + Padded(block[i].size);
+  }
+
+  FILE* fp = fopen(path, "wb");
+  if (!fp) {
+    return -1;
+  }
+
+  const uint8_t padding[sizeof(uint32_t)] = { 0 };
+  bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+  for (size_t i = 0; i < num_blocks && ok; ++i) {
+    uint32_t words[2] = { block[i].tag, block[i].size };
+    ok = fwrite(words, sizeof(words), 1, fp) == 1;
+
+    size_t size = StoredSize(encoding, block[i].tag, block[i].size);
+    if (size == block[i].size) {
+      ok = ok && fwrite(block[i].data, 1, size, fp) == size;
+    } else {
+      // Streamed through a small buffer, the recording buffers can be large.
+      const int16_t* samples = static_cast<const int16_t*>(block[i].data);
+      uint8_t chunk[1024];
+      size_t done = 0;
+      while (done < size && ok) {
+        size_t n = std::min(size - done, sizeof(chunk));
+        for (size_t j = 0; j < n; ++j) {
+          chunk[j] = Lin2MuLaw(samples[done + j]);
+        }
+        ok = fwrite(chunk, 1, n, fp) == n;
+        done += n;
+      }
+    }
+    size_t pad = Padded(size) - size;
+    ok = ok && fwrite(padding, 1, pad, fp) == pad;
+  }
+  ok = fclose(fp) == 0 && ok;
+  return ok ? encoding : -1;
+}
+
+bool Snapshot::Open(const char* path) {
+  Close();
+
+#ifdef _WIN32
+  FILE* fp = fopen(path, "rb");
+  if (!fp) {
+    return false;
+  }
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (size > 0) {
+    mapping_ = malloc(size);
+  }
+  if (mapping_ && fread(mapping_, 1, size, fp) == size_t(size)) {
+    mapping_size_ = size;
+  }
+  fclose(fp);
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void* mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      mapping_ = mapping;
+      mapping_size_ = st.st_size;
+    }
+  }
+  close(fd);
+#endif
+
+  if (mapping_size_ < sizeof(SnapshotHeader)) {
+    Close();
+    return false;
+  }
+  memcpy(&header_, mapping_, sizeof(header_));
+  if (header_.tag != kSnapshotTag ||
+      header_.version != kSnapshotVersion ||
+      header_.parameters_size != sizeof(Parameters) ||
+      header_.encoding > SNAPSHOT_ENCODING_MU_LAW ||
+      header_.num_blocks > 4) {
+    Close();
+    return false;
+  }
+
+  const uint8_t* blocks = static_cast<const uint8_t*>(mapping_) + \
+      sizeof(SnapshotHeader);
+  size_t size = mapping_size_ - sizeof(SnapshotHeader);
+  if (!Expand(blocks, size)) {
+    Close();
+    return false;
+  }
+
+  // Everything is in memory now, the file is not needed any more.
+#ifdef _WIN32
+  free(mapping_);
+#else
+  munmap(mapping_, mapping_size_);
+#endif
+  mapping_ = NULL;
+  mapping_size_ = 0;
+  return true;
+}
+
+bool Snapshot::Expand(const uint8_t* blocks, size_t size) {
+  // Check that all blocks are complete before touching anything.
+  size_t position = 0;
+  size_t data_size = 0;
+  for (uint32_t i = 0; i < header_.num_blocks; ++i) {
+    uint32_t words[2];
+    if (position + sizeof(words) > size) {
+      return false;
+    }
+    memcpy(words, blocks + position, sizeof(words));
+    position += sizeof(words) + Padded(
+        StoredSize(header_.encoding, words[0], words[1]));
+    data_size += sizeof(words) + Padded(words[1]);
+  }
+  if (position > size || data_size != header_.data_size) {
+    return false;
+  }
+
+  // PCM blocks are copied as well: pages of the mapping that are not
+  // resident would otherwise be read from disk by LoadPersistentData(), on
+  // the audio thread.
+  expanded_ = static_cast<uint32_t*>(calloc(data_size, 1));
+  if (!expanded_) {
+    return false;
+  }
+  uint8_t* destination = reinterpret_cast<uint8_t*>(expanded_);
+  const uint8_t* source = blocks;
+  for (uint32_t i = 0; i < header_.num_blocks; ++i) {
+    uint32_t words[2];
+    memcpy(words, source, sizeof(words));
+    memcpy(destination, words, sizeof(words));
+    source += sizeof(words);
+    destination += sizeof(words);
+
+    size_t stored_size = StoredSize(header_.encoding, words[0], words[1]);
+    if (stored_size == words[1]) {
+      memcpy(destination, source, stored_size);
+    } else {
+      int16_t* samples = reinterpret_cast<int16_t*>(destination);
+      for (size_t j = 0; j < stored_size; ++j) {
+        samples[j] = MuLaw2Lin(source[j]);
+      }
+    }
+    source += Padded(stored_size);
+    destination += Padded(words[1]);
+  }
+  data_ = expanded_;
+  return true;
+}
+
+void Snapshot::Close() {
+  if (mapping_) {
+#ifdef _WIN32
+    free(mapping_);
+#else
+    munmap(mapping_, mapping_size_);
+#endif
+  }
+  free(expanded_);
+  mapping_ = NULL;
+  mapping_size_ = 0;
+  expanded_ = NULL;
+  data_ = NULL;
+}
+
+// LoadPersistentData() checks each block only when it gets to it, and has
+// already overwritten the state and changed the quality when a buffer block
+// doesn't fit. Everything is checked here first.
+bool Matches(const GranularProcessor& processor, const Snapshot& snapshot) {
+  const uint32_t* data = snapshot.data();
+  if (data[0] != FourCC<'s', 't', 'a', 't'>::value ||
+      data[1] != sizeof(PersistentState)) {
+    return false;
+  }
+  PersistentState state;
+  memcpy(&state, data + 2, sizeof(state));
+  data += 2 + Padded(sizeof(state)) / sizeof(uint32_t);
+
+  int32_t num_channels = state.quality & 1 ? 1 : 2;
+  if (state.quality > 3 ||
+      snapshot.header().num_blocks != 1 + uint32_t(num_channels)) {
+    return false;
+  }
+  size_t size = processor.persistent_buffer_size(state.quality);
+  int32_t num_samples = static_cast<int32_t>(
+      state.quality & 2 ? size : size / 2);
+  for (int32_t i = 0; i < num_channels; ++i) {
+    if (data[0] != kBufferTag || data[1] != size) {
+      return false;
+    }
+    if (!state.spectral &&
+        (state.write_head[i] < 0 || state.write_head[i] >= num_samples)) {
+      return false;
+    }
+    data += 2 + Padded(size) / sizeof(uint32_t);
+  }
+  return true;
+}
+
+bool RestoreSnapshot(GranularProcessor* processor, const Snapshot& snapshot) {
+  if (!snapshot.loaded() ||
+      !Matches(*processor, snapshot) ||
+      !processor->LoadPersistentData(snapshot.data())) {
+    return false;
+  }
+
+  // LoadPersistentData() only knows about spectral or not.
+  const SnapshotHeader& header = snapshot.header();
+  bool spectral = processor->playback_mode() == PLAYBACK_MODE_SPECTRAL;
+  if (!spectral && header.playback_mode < PLAYBACK_MODE_SPECTRAL) {
+    processor->set_playback_mode(
+        static_cast<PlaybackMode>(header.playback_mode));
+  }
+
+  Parameters* parameters = processor->mutable_parameters();
+  *parameters = header.parameters;
+  parameters->freeze = true;
+  parameters->trigger = false;
+  return true;
+}
+
+}  // namespace clouds
@@ -0,0 +1,100 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Snapshot files: the blocks of GranularProcessor::GetPersistentData() (the
+// data the hardware saves to its flash) plus the parameters, so that frozen
+// buffers can be recalled across sessions.
+//
+// The blocks are written one after the other, straight from the recording
+// buffers. 16-bit buffers can be stored as 8-bit mu-law, which halves the
+// file size. Open() reads the whole file into memory, expanding mu-law
+// blocks on the way, so that restoring a snapshot never touches the disk.
+
+#ifndef CLOUDS_DSP_SNAPSHOT_H_
+#define CLOUDS_DSP_SNAPSHOT_H_
+
+#include "stmlib/stmlib.h"
+
+#include "clouds/dsp/granular_processor.h"
+#include "clouds/dsp/parameters.h"
+
+namespace clouds {
+
+enum SnapshotEncoding {
+  SNAPSHOT_ENCODING_PCM,
+  SNAPSHOT_ENCODING_MU_LAW
+};
+
+struct SnapshotHeader {
+  uint32_t tag;
+  uint32_t version;
+  uint32_t encoding;
+  uint32_t num_blocks;
+  uint32_t data_size;  // Size of the blocks once expanded.
+  uint32_t playback_mode;
+  uint32_t parameters_size;
+  Parameters parameters;
+};
+
+// Returns the encoding actually used: buffers that are already 8-bit, and
+// the spectral mode, are always stored as they are. -1 if the file could
+// not be written.
+int32_t WriteSnapshot(
+    GranularProcessor* processor,
+    const char* path,
+    SnapshotEncoding encoding);
+
+class Snapshot {
+ public:
+  Snapshot() : mapping_(NULL), mapping_size_(0), expanded_(NULL), data_(NULL) { }
+  ~Snapshot() { Close(); }
+
+  bool Open(const char* path);
+  void Close();
+
+  inline bool loaded() const { return data_ != NULL; }
+  inline const SnapshotHeader& header() const { return header_; }
+
+  // Blocks in the format expected by GranularProcessor::LoadPersistentData().
+  inline const uint32_t* data() const { return data_; }
+
+ private:
+  bool Expand(const uint8_t* blocks, size_t size);
+
+  void* mapping_;
+  size_t mapping_size_;
+  uint32_t* expanded_;
+  const uint32_t* data_;
+  SnapshotHeader header_;
+
+  DISALLOW_COPY_AND_ASSIGN(Snapshot);
+};
+
+// Loads the buffers, mode and parameters, and freezes the processor. Has to
+// be called from the audio thread, or with the audio thread stopped.
+bool RestoreSnapshot(GranularProcessor* processor, const Snapshot& snapshot);
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_SNAPSHOT_H_
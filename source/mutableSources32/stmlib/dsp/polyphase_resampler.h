@@ -0,0 +1,224 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Rational sample rate converter (up / down), for ratios only known at run
+// time, such as a host running at 44.1 kHz and a module at 96 kHz (147/320).
+//
+// Same interface as SampleRateConverter, but the filter is designed in Init():
+// a Kaiser windowed sinc, cut off at the lower of the two Nyquist
+// frequencies, split in 'up' phases of 'taps' coefficients each. Only the
+// phase needed for an output sample is evaluated, so the cost is 'taps'
+// multiply-adds per output sample, whatever the ratio.
+
+#ifndef STMLIB_DSP_POLYPHASE_RESAMPLER_H_
+#define STMLIB_DSP_POLYPHASE_RESAMPLER_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "stmlib/dsp/simd.h"
+
+namespace stmlib {
+
+class PolyphaseResampler {
+ public:
+  enum {
+    kMaxUp = 512,
+    kMaxTaps = 256,
+    kMaxUpRatio = 4
+  };
+
+  PolyphaseResampler() : up_(1), down_(1), taps_(0) { }
+  ~PolyphaseResampler() { }
+
+  // Returns false when the rates are not integers, or when the ratio needs
+  // more phases or taps than supported. The caller has to fall back to
+  // another converter then.
+  bool Init(double source_rate, double target_rate) {
+    int32_t source = static_cast<int32_t>(source_rate);
+    int32_t target = static_cast<int32_t>(target_rate);
+    if (source <= 0 || target <= 0 ||
+        source != source_rate || target != target_rate) {
+      return false;
+    }
+    int32_t divisor = Gcd(source, target);
+    return Init(target / divisor, source / divisor);
+  }
+
+  bool Init(int32_t up, int32_t down) {
+    if (up < 1 || down < 1 || up > kMaxUp || up > down * kMaxUpRatio) {
+      return false;
+    }
+    // Steeper filters when decimating by larger factors, the transition band
+    // gets narrower relative to the input rate.
+    int32_t taps = (32 * std::max(down, up) / up + 3) & ~3;
+    if (taps > kMaxTaps) {
+      return false;
+    }
+    up_ = up;
+    down_ = down;
+    taps_ = up == down ? 0 : taps;
+    Reset();
+    if (!taps_) {
+      return true;
+    }
+
+    // Prototype low-pass at 'up' times the source rate.
+    const double kBeta = 8.0;
+    const int32_t length = up_ * taps_;
+    const double cutoff = 0.5 / std::max(up_, down_) * 0.92;
+    const double center = (length - 1) * 0.5;
+    const double i0_beta = BesselI0(kBeta);
+    std::vector<double> h(length);
+    for (int32_t i = 0; i < length; ++i) {
+      double t = i - center;
+      double x = 2.0 * cutoff * t;
+      double sinc = t == 0.0 ? 1.0 : sin(M_PI * x) / (M_PI * x);
+      double w = 2.0 * t / (length - 1);
+      double window = BesselI0(kBeta * sqrt(std::max(0.0, 1.0 - w * w)));
+      h[i] = sinc * window / i0_beta;
+    }
+
+    // Phase p produces the output between input samples, its coefficient i
+    // multiplies the i-th oldest sample of the history. Each phase is
+    // normalized for unity gain at DC.
+    coefficients_.assign(length, 0.0f);
+    for (int32_t p = 0; p < up_; ++p) {
+      float* phase = &coefficients_[p * taps_];
+      double sum = 0.0;
+      for (int32_t i = 0; i < taps_; ++i) {
+        sum += h[p + (taps_ - 1 - i) * up_];
+      }
+      for (int32_t i = 0; i < taps_; ++i) {
+        phase[i] = h[p + (taps_ - 1 - i) * up_] / sum;
+      }
+    }
+    history_.assign(2 * taps_, 0.0f);
+    return true;
+  }
+
+  void Reset() {
+    std::fill(history_.begin(), history_.end(), 0.0f);
+    write_ptr_ = 0;
+    phase_ = 0;
+    skip_ = 1;
+  }
+
+  // Delay in source samples.
+  inline float delay() const {
+    return taps_ ? 0.5f * (taps_ - 1.0f / up_) : 0.0f;
+  }
+
+  inline int32_t up() const { return up_; }
+  inline int32_t down() const { return down_; }
+
+  // Largest number of samples Process() can write for a given input size.
+  inline size_t max_output_size(size_t input_size) const {
+    return (input_size * up_ + down_ - 1) / down_ + 1;
+  }
+
+  // Returns the number of samples written to out.
+  size_t Process(const float* in, float* out, size_t input_size) {
+    if (!taps_) {
+      std::copy(&in[0], &in[input_size], &out[0]);
+      return input_size;
+    }
+    float* history = &history_[0];
+    const float* coefficients = &coefficients_[0];
+    size_t output_size = 0;
+    while (true) {
+      while (skip_ && input_size) {
+        // The history is stored twice, so that the last 'taps' samples are
+        // always contiguous, starting at write_ptr_.
+        history[write_ptr_] = history[write_ptr_ + taps_] = *in++;
+        if (++write_ptr_ == taps_) {
+          write_ptr_ = 0;
+        }
+        --skip_;
+        --input_size;
+      }
+      if (skip_) {
+        break;
+      }
+      do {
+        out[output_size++] = Dot(
+            &coefficients[phase_ * taps_],
+            &history[write_ptr_]);
+        phase_ += down_;
+        skip_ = phase_ / up_;
+        phase_ -= skip_ * up_;
+      } while (!skip_);
+    }
+    return output_size;
+  }
+
+ private:
+  inline float Dot(const float* a, const float* b) const {
+    simd::Vector sum = simd::Splat(0.0f);
+    for (int32_t i = 0; i < taps_; i += simd::kWidth) {
+      sum = simd::Add(sum, simd::Mul(simd::Load(a + i), simd::Load(b + i)));
+    }
+    float s[simd::kWidth];
+    simd::Store(s, sum);
+    return (s[0] + s[1]) + (s[2] + s[3]);
+  }
+
+  static int32_t Gcd(int32_t a, int32_t b) {
+    while (b) {
+      int32_t t = a % b;
+      a = b;
+      b = t;
+    }
+    return a;
+  }
+
+  static double BesselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int32_t k = 1; k < 32; ++k) {
+      term *= (x * 0.5 / k) * (x * 0.5 / k);
+      sum += term;
+    }
+    return sum;
+  }
+
+  int32_t up_;
+  int32_t down_;
+  int32_t taps_;
+  int32_t write_ptr_;
+  int32_t phase_;
+  int32_t skip_;
+
+  std::vector<float> coefficients_;
+  std::vector<float> history_;
+
+  DISALLOW_COPY_AND_ASSIGN(PolyphaseResampler);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_POLYPHASE_RESAMPLER_H_
@@ -0,0 +1,398 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Minimal wrapper around the single precision SIMD instructions of the
+// target: SSE2 on x86-64, NEON on arm. Everything else falls back to plain
+// scalar code. Vectors hold 4 floats (or 4 int32 for index arithmetic),
+// which keeps the shuffles below simple.
+//
+// Only mul, add, sub, div, min, abs and compare/select are used, no fused
+// multiply-add, so each lane gives exactly the same result as the scalar code
+// it replaces.
+
+#ifndef STMLIB_DSP_SIMD_H_
+#define STMLIB_DSP_SIMD_H_
+
+#include "stmlib/stmlib.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define STMLIB_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #include <arm_neon.h>
+  #define STMLIB_SIMD_NEON
+#endif
+
+namespace stmlib {
+
+namespace simd {
+
+#if defined(STMLIB_SIMD_SSE2)
+
+typedef __m128 Vector;
+const size_t kWidth = 4;
+
+inline Vector Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, Vector v) { _mm_storeu_ps(p, v); }
+inline Vector Splat(float x) { return _mm_set1_ps(x); }
+inline Vector Set(float a, float b, float c, float d) {
+  return _mm_setr_ps(a, b, c, d);
+}
+inline Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+inline Vector Min(Vector a, Vector b) { return _mm_min_ps(a, b); }
+inline Vector Div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+inline Vector Abs(Vector a) {
+  return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+}
+
+// All bits set in the lanes where a > b.
+inline Vector GreaterThan(Vector a, Vector b) { return _mm_cmpgt_ps(a, b); }
+inline Vector Select(Vector mask, Vector a, Vector b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// 4 consecutive int16 samples, converted to float.
+inline Vector LoadInt16(const int16_t* p) {
+  __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+  x = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+  return _mm_cvtepi32_ps(x);
+}
+
+typedef __m128i VectorInt;
+
+inline VectorInt SplatInt(int32_t x) { return _mm_set1_epi32(x); }
+inline VectorInt SetInt(int32_t a, int32_t b, int32_t c, int32_t d) {
+  return _mm_setr_epi32(a, b, c, d);
+}
+inline void Store(int32_t* p, VectorInt v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+inline VectorInt Add(VectorInt a, VectorInt b) { return _mm_add_epi32(a, b); }
+inline VectorInt Sub(VectorInt a, VectorInt b) { return _mm_sub_epi32(a, b); }
+inline VectorInt And(VectorInt a, VectorInt b) { return _mm_and_si128(a, b); }
+// All bits set where a > b.
+inline VectorInt GreaterThan(VectorInt a, VectorInt b) {
+  return _mm_cmpgt_epi32(a, b);
+}
+// Arithmetic shift.
+template<int shift>
+inline VectorInt ShiftRight(VectorInt a) { return _mm_srai_epi32(a, shift); }
+inline Vector ToFloat(VectorInt a) { return _mm_cvtepi32_ps(a); }
+
+// (a0 a1 a2 a3) -> (a3 a2 a1 a0)
+inline Vector Reverse(Vector a) {
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// (a0 a1 a2 a3), (b0 b1 b2 b3) -> (a0 a2 b0 b2), (a1 a3 b1 b3)
+inline void Deinterleave(Vector a, Vector b, Vector* even, Vector* odd) {
+  *even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  *odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// The inverse of the above.
+inline void Interleave(Vector even, Vector odd, Vector* a, Vector* b) {
+  *a = _mm_unpacklo_ps(even, odd);
+  *b = _mm_unpackhi_ps(even, odd);
+}
+
+inline void Transpose(Vector* a, Vector* b, Vector* c, Vector* d) {
+  _MM_TRANSPOSE4_PS(*a, *b, *c, *d);
+}
+
+#elif defined(STMLIB_SIMD_NEON)
+
+typedef float32x4_t Vector;
+const size_t kWidth = 4;
+
+inline Vector Load(const float* p) { return vld1q_f32(p); }
+inline void Store(float* p, Vector v) { vst1q_f32(p, v); }
+inline Vector Splat(float x) { return vdupq_n_f32(x); }
+inline Vector Set(float a, float b, float c, float d) {
+  const float v[4] = { a, b, c, d };
+  return vld1q_f32(v);
+}
+inline Vector Add(Vector a, Vector b) { return vaddq_f32(a, b); }
+inline Vector Sub(Vector a, Vector b) { return vsubq_f32(a, b); }
+inline Vector Mul(Vector a, Vector b) { return vmulq_f32(a, b); }
+inline Vector Min(Vector a, Vector b) { return vminq_f32(a, b); }
+#if defined(__aarch64__)
+inline Vector Div(Vector a, Vector b) { return vdivq_f32(a, b); }
+#else
+inline Vector Div(Vector a, Vector b) {
+  // No division on armv7, the reciprocal estimate would not be exact.
+  float x[4], y[4];
+  vst1q_f32(x, a);
+  vst1q_f32(y, b);
+  for (size_t i = 0; i < 4; ++i) {
+    x[i] /= y[i];
+  }
+  return vld1q_f32(x);
+}
+#endif  // __aarch64__
+inline Vector Abs(Vector a) { return vabsq_f32(a); }
+
+// All bits set in the lanes where a > b.
+inline Vector GreaterThan(Vector a, Vector b) {
+  return vreinterpretq_f32_u32(vcgtq_f32(a, b));
+}
+inline Vector Select(Vector mask, Vector a, Vector b) {
+  return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+
+inline Vector LoadInt16(const int16_t* p) {
+  return vcvtq_f32_s32(vmovl_s16(vld1_s16(p)));
+}
+
+typedef int32x4_t VectorInt;
+
+inline VectorInt SplatInt(int32_t x) { return vdupq_n_s32(x); }
+inline VectorInt SetInt(int32_t a, int32_t b, int32_t c, int32_t d) {
+  const int32_t v[4] = { a, b, c, d };
+  return vld1q_s32(v);
+}
+inline void Store(int32_t* p, VectorInt v) { vst1q_s32(p, v); }
+inline VectorInt Add(VectorInt a, VectorInt b) { return vaddq_s32(a, b); }
+inline VectorInt Sub(VectorInt a, VectorInt b) { return vsubq_s32(a, b); }
+inline VectorInt And(VectorInt a, VectorInt b) { return vandq_s32(a, b); }
+inline VectorInt GreaterThan(VectorInt a, VectorInt b) {
+  return vreinterpretq_s32_u32(vcgtq_s32(a, b));
+}
+template<int shift>
+inline VectorInt ShiftRight(VectorInt a) { return vshrq_n_s32(a, shift); }
+inline Vector ToFloat(VectorInt a) { return vcvtq_f32_s32(a); }
+
+inline Vector Reverse(Vector a) {
+  Vector r = vrev64q_f32(a);
+  return vcombine_f32(vget_high_f32(r), vget_low_f32(r));
+}
+
+inline void Deinterleave(Vector a, Vector b, Vector* even, Vector* odd) {
+  float32x4x2_t r = vuzpq_f32(a, b);
+  *even = r.val[0];
+  *odd = r.val[1];
+}
+
+inline void Interleave(Vector even, Vector odd, Vector* a, Vector* b) {
+  float32x4x2_t r = vzipq_f32(even, odd);
+  *a = r.val[0];
+  *b = r.val[1];
+}
+
+inline void Transpose(Vector* a, Vector* b, Vector* c, Vector* d) {
+  float32x4x2_t ab = vtrnq_f32(*a, *b);
+  float32x4x2_t cd = vtrnq_f32(*c, *d);
+  *a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+  *b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+  *c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+  *d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+
+#else
+
+struct Vector { float x[4]; };
+const size_t kWidth = 4;
+
+inline Vector Load(const float* p) {
+  Vector v = { { p[0], p[1], p[2], p[3] } };
+  return v;
+}
+
+inline void Store(float* p, Vector v) {
+  for (size_t i = 0; i < 4; ++i) {
+    p[i] = v.x[i];
+  }
+}
+
+inline Vector Splat(float x) { Vector v = { { x, x, x, x } }; return v; }
+
+inline Vector Set(float a, float b, float c, float d) {
+  Vector v = { { a, b, c, d } };
+  return v;
+}
+
+inline Vector Add(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] += b.x[i];
+  }
+  return a;
+}
+
+inline Vector Sub(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] -= b.x[i];
+  }
+  return a;
+}
+
+inline Vector Mul(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] *= b.x[i];
+  }
+  return a;
+}
+
+inline Vector Min(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] = b.x[i] < a.x[i] ? b.x[i] : a.x[i];
+  }
+  return a;
+}
+
+inline Vector Div(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] /= b.x[i];
+  }
+  return a;
+}
+
+inline Vector Abs(Vector a) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] = a.x[i] < 0.0f ? -a.x[i] : a.x[i];
+  }
+  return a;
+}
+
+// Non-zero in the lanes where a > b.
+inline Vector GreaterThan(Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] = a.x[i] > b.x[i] ? 1.0f : 0.0f;
+  }
+  return a;
+}
+
+inline Vector Select(Vector mask, Vector a, Vector b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] = mask.x[i] != 0.0f ? a.x[i] : b.x[i];
+  }
+  return a;
+}
+
+inline Vector LoadInt16(const int16_t* p) {
+  Vector v = { {
+      static_cast<float>(p[0]), static_cast<float>(p[1]),
+      static_cast<float>(p[2]), static_cast<float>(p[3]) } };
+  return v;
+}
+
+struct VectorInt { int32_t x[4]; };
+
+inline VectorInt SplatInt(int32_t x) {
+  VectorInt v = { { x, x, x, x } };
+  return v;
+}
+
+inline VectorInt SetInt(int32_t a, int32_t b, int32_t c, int32_t d) {
+  VectorInt v = { { a, b, c, d } };
+  return v;
+}
+
+inline void Store(int32_t* p, VectorInt v) {
+  for (size_t i = 0; i < 4; ++i) {
+    p[i] = v.x[i];
+  }
+}
+
+inline VectorInt Add(VectorInt a, VectorInt b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] += b.x[i];
+  }
+  return a;
+}
+
+inline VectorInt Sub(VectorInt a, VectorInt b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] -= b.x[i];
+  }
+  return a;
+}
+
+inline VectorInt And(VectorInt a, VectorInt b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] &= b.x[i];
+  }
+  return a;
+}
+
+inline VectorInt GreaterThan(VectorInt a, VectorInt b) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] = a.x[i] > b.x[i] ? -1 : 0;
+  }
+  return a;
+}
+
+template<int shift>
+inline VectorInt ShiftRight(VectorInt a) {
+  for (size_t i = 0; i < 4; ++i) {
+    a.x[i] >>= shift;
+  }
+  return a;
+}
+
+inline Vector ToFloat(VectorInt a) {
+  Vector v = { {
+      static_cast<float>(a.x[0]), static_cast<float>(a.x[1]),
+      static_cast<float>(a.x[2]), static_cast<float>(a.x[3]) } };
+  return v;
+}
+
+inline Vector Reverse(Vector a) {
+  Vector v = { { a.x[3], a.x[2], a.x[1], a.x[0] } };
+  return v;
+}
+
+inline void Deinterleave(Vector a, Vector b, Vector* even, Vector* odd) {
+  Vector e = { { a.x[0], a.x[2], b.x[0], b.x[2] } };
+  Vector o = { { a.x[1], a.x[3], b.x[1], b.x[3] } };
+  *even = e;
+  *odd = o;
+}
+
+inline void Interleave(Vector even, Vector odd, Vector* a, Vector* b) {
+  Vector l = { { even.x[0], odd.x[0], even.x[1], odd.x[1] } };
+  Vector h = { { even.x[2], odd.x[2], even.x[3], odd.x[3] } };
+  *a = l;
+  *b = h;
+}
+
+inline void Transpose(Vector* a, Vector* b, Vector* c, Vector* d) {
+  Vector* rows[4] = { a, b, c, d };
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = i + 1; j < 4; ++j) {
+      float t = rows[i]->x[j];
+      rows[i]->x[j] = rows[j]->x[i];
+      rows[j]->x[i] = t;
+    }
+  }
+}
+
+#endif  // STMLIB_SIMD_SSE2
+
+}  // namespace simd
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_SIMD_H_
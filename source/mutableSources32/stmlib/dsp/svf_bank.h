@@ -0,0 +1,246 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of CrossoverSvf stored as a structure of arrays, so that four filters
+// are processed with one SIMD instruction. Each filter of the bank is a
+// cascade of num_passes CrossoverSvf with their own coefficients, and has its
+// own mode (low-pass, normalized band-pass or high-pass). It computes exactly
+// what running the input through CrossoverSvf::Process<mode> num_passes times
+// computes.
+//
+// Four filters with the same mode run without any per-lane selection, so
+// filters should be grouped by mode where possible.
+
+#ifndef STMLIB_DSP_SVF_BANK_H_
+#define STMLIB_DSP_SVF_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "stmlib/dsp/filter.h"
+#include "stmlib/dsp/simd.h"
+
+namespace stmlib {
+
+// size has to be a multiple of simd::kWidth.
+template<size_t size, size_t num_passes = 1>
+class CrossoverSvfBank {
+ public:
+  CrossoverSvfBank() { }
+  ~CrossoverSvfBank() { }
+  
+  void Init() {
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t pass = 0; pass < num_passes; ++pass) {
+        set_f_fq(i, pass, 0.0f, 0.0f);
+      }
+      set_mode(i, FILTER_MODE_LOW_PASS);
+    }
+    Reset();
+  }
+  
+  void Reset() {
+    for (size_t stage = 0; stage < kNumStages; ++stage) {
+      std::fill(&lp_[stage][0], &lp_[stage][size], 0.0f);
+      std::fill(&bp_[stage][0], &bp_[stage][size], 0.0f);
+      std::fill(&x_[stage][0], &x_[stage][size], 0.0f);
+    }
+  }
+  
+  inline void set_f_fq(size_t i, size_t pass, float f, float fq) {
+    f_[pass][i] = f;
+    fq_[pass][i] = fq;
+    minus_fq_[pass][i] = -fq;
+  }
+  
+  // FILTER_MODE_LOW_PASS, FILTER_MODE_BAND_PASS_NORMALIZED or
+  // FILTER_MODE_HIGH_PASS.
+  inline void set_mode(size_t i, FilterMode mode) {
+    mode_[i] = mode;
+    low_pass_[i] = mode == FILTER_MODE_LOW_PASS ? 1.0f : 0.0f;
+    band_pass_[i] = mode == FILTER_MODE_BAND_PASS_NORMALIZED ? 1.0f : 0.0f;
+  }
+  
+  // Filters i to i + simd::kWidth - 1 all get the samples of in. Their outputs
+  // are interleaved: out[j * stride + k] is sample j of filter i + k.
+  inline void Process(
+      size_t i,
+      const float* in,
+      float* out,
+      size_t block_size,
+      size_t stride) {
+    Dispatch<true>(i, in, out, block_size, stride);
+  }
+  
+  // Same as above, but each filter reads its own input, interleaved like the
+  // output. in and out can be the same buffer.
+  inline void ProcessInterleaved(
+      size_t i,
+      const float* in,
+      float* out,
+      size_t block_size,
+      size_t stride) {
+    Dispatch<false>(i, in, out, block_size, stride);
+  }
+  
+ private:
+  enum {
+    kNumStages = num_passes * 2,
+    kMixedModes = -1
+  };
+  
+  struct Coefficients {
+    simd::Vector f;
+    simd::Vector fq;
+    simd::Vector minus_fq;
+  };
+  
+  struct State {
+    simd::Vector lp;
+    simd::Vector bp;
+    simd::Vector x;
+  };
+  
+  // One of the two stages of CrossoverSvf::Process, for one sample. With
+  // kMixedModes, the masks pick the mode of each lane.
+  template<int32_t mode>
+  static inline simd::Vector Tick(
+      const Coefficients& c,
+      simd::Vector low_pass,
+      simd::Vector band_pass,
+      simd::Vector in,
+      State* s) {
+    using namespace simd;
+    s->lp = Add(s->lp, Mul(c.f, s->bp));
+    s->bp = Add(s->bp, Add(Sub(Mul(c.minus_fq, s->bp), Mul(c.f, s->lp)), in));
+    if (mode == FILTER_MODE_BAND_PASS_NORMALIZED) {
+      s->bp = Add(s->bp, s->x);
+    } else if (mode == kMixedModes) {
+      s->bp = Select(band_pass, Add(s->bp, s->x), s->bp);
+    }
+    s->x = in;
+    
+    if (mode == FILTER_MODE_LOW_PASS) {
+      return Mul(s->lp, c.f);
+    } else if (mode == FILTER_MODE_BAND_PASS_NORMALIZED) {
+      return Mul(s->bp, c.fq);
+    } else if (mode == FILTER_MODE_HIGH_PASS) {
+      return Sub(Sub(in, Mul(s->lp, c.f)), Mul(s->bp, c.fq));
+    } else {
+      Vector lp_out = Mul(s->lp, c.f);
+      Vector bp_out = Mul(s->bp, c.fq);
+      Vector hp_out = Sub(Sub(in, lp_out), bp_out);
+      return Select(low_pass, lp_out, Select(band_pass, bp_out, hp_out));
+    }
+  }
+  
+  template<bool shared_input>
+  inline void Dispatch(
+      size_t i,
+      const float* in,
+      float* out,
+      size_t block_size,
+      size_t stride) {
+    int32_t mode = mode_[i];
+    for (size_t k = 1; k < simd::kWidth; ++k) {
+      if (mode_[i + k] != mode) {
+        mode = kMixedModes;
+      }
+    }
+    switch (mode) {
+      case FILTER_MODE_LOW_PASS:
+        ProcessBlock<shared_input, FILTER_MODE_LOW_PASS>(
+            i, in, out, block_size, stride);
+        break;
+      case FILTER_MODE_BAND_PASS_NORMALIZED:
+        ProcessBlock<shared_input, FILTER_MODE_BAND_PASS_NORMALIZED>(
+            i, in, out, block_size, stride);
+        break;
+      case FILTER_MODE_HIGH_PASS:
+        ProcessBlock<shared_input, FILTER_MODE_HIGH_PASS>(
+            i, in, out, block_size, stride);
+        break;
+      default:
+        ProcessBlock<shared_input, kMixedModes>(
+            i, in, out, block_size, stride);
+        break;
+    }
+  }
+  
+  template<bool shared_input, int32_t mode>
+  inline void ProcessBlock(
+      size_t i,
+      const float* in,
+      float* out,
+      size_t block_size,
+      size_t stride) {
+    using namespace simd;
+    const Vector zero = Splat(0.0f);
+    const Vector low_pass = GreaterThan(Load(low_pass_ + i), zero);
+    const Vector band_pass = GreaterThan(Load(band_pass_ + i), zero);
+    Coefficients c[num_passes];
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+      c[pass].f = Load(f_[pass] + i);
+      c[pass].fq = Load(fq_[pass] + i);
+      c[pass].minus_fq = Load(minus_fq_[pass] + i);
+    }
+    State s[kNumStages];
+    for (size_t stage = 0; stage < kNumStages; ++stage) {
+      s[stage].lp = Load(lp_[stage] + i);
+      s[stage].bp = Load(bp_[stage] + i);
+      s[stage].x = Load(x_[stage] + i);
+    }
+    
+    for (size_t j = 0; j < block_size; ++j) {
+      Vector y = shared_input ? Splat(in[j]) : Load(in + j * stride);
+      for (size_t stage = 0; stage < kNumStages; ++stage) {
+        y = Tick<mode>(c[stage / 2], low_pass, band_pass, y, &s[stage]);
+      }
+      Store(out + j * stride, y);
+    }
+    
+    for (size_t stage = 0; stage < kNumStages; ++stage) {
+      Store(lp_[stage] + i, s[stage].lp);
+      Store(bp_[stage] + i, s[stage].bp);
+      Store(x_[stage] + i, s[stage].x);
+    }
+  }
+  
+  float f_[num_passes][size];
+  float fq_[num_passes][size];
+  float minus_fq_[num_passes][size];
+  int32_t mode_[size];
+  float low_pass_[size];
+  float band_pass_[size];
+  float lp_[kNumStages][size];
+  float bp_[kNumStages][size];
+  float x_[kNumStages][size];
+  
+  DISALLOW_COPY_AND_ASSIGN(CrossoverSvfBank);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_SVF_BANK_H_
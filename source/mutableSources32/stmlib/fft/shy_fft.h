@@ -319,57 +319,73 @@ struct DirectTransform {
       const uint8_t* bit_rev,
       Phasor* phasor,
       size_t rt_num_passes) {
+    for (size_t step = 0; step < rt_num_passes - 1; ++step) {
+      Step(input, output, bit_rev, phasor, rt_num_passes, step);
+    }
+  }
+  
+  // One pass of the run-time sized transform, so that it can be spread over
+  // several calls. Steps 0 to rt_num_passes - 2 have to be run in order, the
+  // first one consumes the input, the last one leaves the result in output.
+  void Step(
+      T* input,
+      T* output,
+      const uint8_t* bit_rev,
+      Phasor* phasor,
+      size_t rt_num_passes,
+      size_t step) {
     T* s;
     T* d;
     Math<T> math;
     size_t rt_size = 1 << rt_num_passes;
-    // First and second pass.
-    d = output;
-    for (size_t i = 0; i < rt_size; i += 4) {
-      const T* s = input;
-      size_t r0 = \
-          ((bit_rev[i & 0xff] << 8) | bit_rev[i >> 8]) >> (16 - rt_num_passes);
-      size_t r1 = r0 + 2 * (rt_size >> 2);
-      size_t r2 = r0 + 1 * (rt_size >> 2);
-      size_t r3 = r0 + 3 * (rt_size >> 2);
-      
-      d[1] = s[r0] - s[r1];
-      d[3] = s[r2] - s[r3];
-      T a = s[r0] + s[r1];
-      T b = s[r2] + s[r3];
-      d[0] = a + b;
-      d[2] = a - b;
-      d += 4;
-    }
     
-    // Third pass.
-    s = output;
-    d = input;
-    for (size_t i = 0; i < rt_size; i += 8) {
-      T v;
-
-      d[i] = s[i] + s[i + 4];
-      d[i + 4] = s[i] - s[i + 4];
-      d[i + 2] = s[i + 2];
-      d[i + 6] = s[i + 6];
-
-      v = (s[i + 5] - s[i + 7]) * math.sqrt_2_div_2();
-      d[i + 1] = s[i + 1] + v;
-      d[i + 3] = s[i + 1] - v;
-
-      v = (s[i + 5] + s[i + 7]) * math.sqrt_2_div_2();
-      d[i + 5] = v + s[i + 3];
-      d[i + 7] = v - s[i + 3];
+    if (step == 0) {
+      // First and second pass.
+      d = output;
+      for (size_t i = 0; i < rt_size; i += 4) {
+        const T* s = input;
+        size_t r0 = \
+            ((bit_rev[i & 0xff] << 8) | bit_rev[i >> 8]) >> (16 - rt_num_passes);
+        size_t r1 = r0 + 2 * (rt_size >> 2);
+        size_t r2 = r0 + 1 * (rt_size >> 2);
+        size_t r3 = r0 + 3 * (rt_size >> 2);
+        
+        d[1] = s[r0] - s[r1];
+        d[3] = s[r2] - s[r3];
+        T a = s[r0] + s[r1];
+        T b = s[r2] + s[r3];
+        d[0] = a + b;
+        d[2] = a - b;
+        d += 4;
+      }
+      return;
     }
     
-    // Remaining passes.
-    for (size_t pass = 3; pass < rt_num_passes; ++pass) {
-      // Flip source and destination pointers
-      {
-        T* tmp = s;
-        s = d;
-        d = tmp;
+    if (step == 1) {
+      // Third pass.
+      s = output;
+      d = input;
+      for (size_t i = 0; i < rt_size; i += 8) {
+        T v;
+
+        d[i] = s[i] + s[i + 4];
+        d[i + 4] = s[i] - s[i + 4];
+        d[i + 2] = s[i + 2];
+        d[i + 6] = s[i + 6];
+
+        v = (s[i + 5] - s[i + 7]) * math.sqrt_2_div_2();
+        d[i + 1] = s[i + 1] + v;
+        d[i + 3] = s[i + 1] - v;
+
+        v = (s[i + 5] + s[i + 7]) * math.sqrt_2_div_2();
+        d[i + 5] = v + s[i + 3];
+        d[i + 7] = v - s[i + 3];
       }
+    } else {
+      // Remaining passes, source and destination flip with every pass.
+      size_t pass = step + 1;
+      s = pass & 1 ? input : output;
+      d = pass & 1 ? output : input;
       
       size_t n = 1 << pass;
       size_t n_2 = n >> 1;
@@ -405,7 +421,7 @@ struct DirectTransform {
     }
     
     // Annoying additional data copy step.
-    if (d != output) {
+    if (step == rt_num_passes - 2 && d != output) {
       std::copy(&d[0], &d[rt_size], &output[0]);
     }
   }
@@ -552,14 +568,31 @@ struct InverseTransform {
       const uint8_t* bit_rev,
       Phasor* phasor,
       size_t rt_num_passes) {
-    T* s = (T*)(input);
-    T* d = output;
+    for (size_t step = 0; step < rt_num_passes - 1; ++step) {
+      Step(input, output, bit_rev, phasor, rt_num_passes, step);
+    }
+  }
+  
+  // One pass of the run-time sized transform, see DirectTransform::Step().
+  void Step(
+      T* input,
+      T* output,
+      const uint8_t* bit_rev,
+      Phasor* phasor,
+      size_t rt_num_passes,
+      size_t step) {
+    T* s;
+    T* d;
     Math<T> math;
     
     size_t rt_size = 1 << rt_num_passes;
     
-    // Remaining passes.
-    for (size_t pass = rt_num_passes - 1; pass >= 3; --pass) {
+    if (step + 3 < rt_num_passes) {
+      // Remaining passes, source and destination flip with every pass.
+      size_t pass = rt_num_passes - 1 - step;
+      s = step & 1 ? output : input;
+      d = step & 1 ? input : output;
+      
       size_t n = 1 << pass;
       size_t n_2 = n >> 1;
       
@@ -591,58 +624,49 @@ struct InverseTransform {
           phasor->Rotate();
         }
       }
-
-      // Flip source and destination pointers for the next pass.
-      if (d == output) {
-        s = output;
-        d = input;
-      } else {
-        s = input;
-        d = output;
+    } else if (step + 3 == rt_num_passes) {
+      // Copy data if necessary.
+      if (!(step & 1)) {
+        std::copy(&input[0], &input[rt_size], &output[0]);
       }
-    }
-    
-    // Copy data if necessary.
-    if (d == output) {
-      std::copy(&s[0], &s[rt_size], &output[0]);
-    }
-    
-    s = output;
-    d = input;
-    for (size_t i = 0; i < rt_size; i += 8) {
-      T vr, vi;
-      d[i] = s[i] + s[i + 4];
-      d[i + 4] = s[i] - s[i + 4];
-      d[i + 2] = s[i + 2] * T(2);
-      d[i + 6] = s[i + 6] * T(2);
-      d[i + 1] = s[i + 1] + s[i + 3];
-      d[i + 3] = s[i + 5] - s[i + 7];
-      vr = s[i + 1] - s[i + 3];
-      vi = s[i + 5] + s[i + 7];
-      d[i + 5] = (vr + vi) * math.sqrt_2_div_2();
-      d[i + 7] = (vi - vr) * math.sqrt_2_div_2();
-    }
-    
-    // First and second pass.
-    s = input;
-    d = output;
-    for (size_t i = 0; i < rt_size; i += 4) {
-      size_t r0 = \
-            ((bit_rev[i & 0xff] << 8) | bit_rev[i >> 8]) >> (16 - rt_num_passes);
-      size_t r1 = r0 + 2 * (rt_size >> 2);
-      size_t r2 = r0 + 1 * (rt_size >> 2);
-      size_t r3 = r0 + 3 * (rt_size >> 2);
       
-      T b_0 = s[0] + s[2];
-      T b_2 = s[0] - s[2];
-      T b_1 = s[1] * T(2);
-      T b_3 = s[3] * T(2);
-      
-      d[r0] = b_0 + b_1;
-      d[r1] = b_0 - b_1;
-      d[r2] = b_2 + b_3;
-      d[r3] = b_2 - b_3;
-      s += 4;
+      s = output;
+      d = input;
+      for (size_t i = 0; i < rt_size; i += 8) {
+        T vr, vi;
+        d[i] = s[i] + s[i + 4];
+        d[i + 4] = s[i] - s[i + 4];
+        d[i + 2] = s[i + 2] * T(2);
+        d[i + 6] = s[i + 6] * T(2);
+        d[i + 1] = s[i + 1] + s[i + 3];
+        d[i + 3] = s[i + 5] - s[i + 7];
+        vr = s[i + 1] - s[i + 3];
+        vi = s[i + 5] + s[i + 7];
+        d[i + 5] = (vr + vi) * math.sqrt_2_div_2();
+        d[i + 7] = (vi - vr) * math.sqrt_2_div_2();
+      }
+    } else {
+      // First and second pass.
+      s = input;
+      d = output;
+      for (size_t i = 0; i < rt_size; i += 4) {
+        size_t r0 = \
+              ((bit_rev[i & 0xff] << 8) | bit_rev[i >> 8]) >> (16 - rt_num_passes);
+        size_t r1 = r0 + 2 * (rt_size >> 2);
+        size_t r2 = r0 + 1 * (rt_size >> 2);
+        size_t r3 = r0 + 3 * (rt_size >> 2);
+        
+        T b_0 = s[0] + s[2];
+        T b_2 = s[0] - s[2];
+        T b_1 = s[1] * T(2);
+        T b_3 = s[3] * T(2);
+        
+        d[r0] = b_0 + b_1;
+        d[r1] = b_0 - b_1;
+        d[r2] = b_2 + b_3;
+        d[r3] = b_2 - b_3;
+        s += 4;
+      }
     }
   }
 };
@@ -750,6 +774,20 @@ class ShyFFT {
         n);
   }
   
+  // Direct(input, output, n) and Inverse(input, output, n) spread over
+  // num_steps(n) calls, one pass per call. Steps 0 ... num_steps(n) - 1
+  // have to be called in order, with the same buffers.
+  static inline size_t num_steps(size_t n) { return n - 1; }
+
+  void DirectStep(T* input, T* output, size_t n, size_t step) {
+    DirectTransform<T, num_passes, Phasor<T, num_passes> > d;
+    d.Step(input, output, bit_rev_256_lut_, &phasor_, n, step);
+  }
+  
+  void InverseStep(T* input, T* output, size_t n, size_t step) {
+    InverseTransform<T, num_passes, Phasor<T, num_passes> > i;
+    i.Step(input, output, bit_rev_256_lut_, &phasor_, n, step);
+  }
 
  private:
   PhasorType phasor_;
@@ -0,0 +1,445 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Real FFT with the same interface and data layout as ShyFFT, but vectorized.
+//
+// The N real samples are packed into N / 2 complex ones, which go through
+// radix-4 (and one radix-2) decimation in frequency stages on separate
+// real / imaginary arrays, so that each butterfly works on 4 neighbouring
+// points at once. The twiddle factors of every stage are precomputed.
+// A bit reversal and a last pass that splits the spectra of the even and
+// odd samples give the spectrum of the real signal.
+//
+// As with ShyFFT, Direct() gives the real parts of bins 0 to N / 2 in
+// output[0 ... N / 2] and the negated imaginary parts of bins 1 to N / 2 - 1
+// in output[N / 2 + 1 ... N - 1], Inverse(Direct(x)) is N * x, and the input
+// buffer is used as workspace.
+
+#ifndef STMLIB_FFT_SIMD_FFT_H_
+#define STMLIB_FFT_SIMD_FFT_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cmath>
+
+#include "stmlib/dsp/simd.h"
+#include "stmlib/fft/shy_fft.h"  // Log2
+
+namespace stmlib {
+
+template<size_t size>
+class SimdFFT {
+ public:
+  enum {
+    num_passes = Log2<size>::value,
+    max_size = size
+  };
+  
+  SimdFFT() { }
+  ~SimdFFT() { }
+  
+  void Init() {
+    // Twiddles of the radix-4 stages, for every span from 4 to size / 2.
+    // Per span L: w^j, w^2j and w^3j for j < L / 4, w = exp(-2 pi i / L),
+    // real parts first.
+    float* t = twiddles_;
+    for (size_t pass = 2; pass < num_passes; ++pass) {
+      size_t span = 1 << pass;
+      size_t quarter = span >> 2;
+      twiddle_offset_[pass] = t - twiddles_;
+      for (size_t k = 1; k <= 3; ++k) {
+        for (size_t j = 0; j < quarter; ++j) {
+          double angle = -2.0 * M_PI * static_cast<double>(k * j) / span;
+          t[j] = static_cast<float>(cos(angle));
+          t[j + quarter] = static_cast<float>(sin(angle));
+        }
+        t += 2 * quarter;
+      }
+    }
+    
+    // exp(-2 pi i k / size), for the split of the packed spectrum.
+    for (size_t k = 0; k < size / 2; ++k) {
+      double angle = 2.0 * M_PI * static_cast<double>(k) / size;
+      split_cos_[k] = static_cast<float>(cos(angle));
+      split_sin_[k] = static_cast<float>(sin(angle));
+    }
+    
+    for (size_t i = 0; i < size / 2; ++i) {
+      size_t r = 0;
+      for (size_t b = 0; b < num_passes - 1; ++b) {
+        r |= ((i >> b) & 1) << (num_passes - 2 - b);
+      }
+      bit_rev_[i] = r;
+    }
+  }
+  
+  void Direct(float* input, float* output) {
+    Direct(input, output, num_passes);
+  }
+  
+  void Inverse(float* input, float* output) {
+    Inverse(input, output, num_passes);
+  }
+  
+  // Transform of 2^n points, n <= num_passes. n must be at least 5.
+  void Direct(float* input, float* output, size_t n) {
+    for (size_t step = 0; step < num_steps(n); ++step) {
+      DirectStep(input, output, n, step);
+    }
+  }
+  
+  void Inverse(float* input, float* output, size_t n) {
+    for (size_t step = 0; step < num_steps(n); ++step) {
+      InverseStep(input, output, n, step);
+    }
+  }
+  
+  // The transforms spread over num_steps(n) calls, one stage per call, see
+  // ShyFFT::DirectStep().
+  static inline size_t num_steps(size_t n) {
+    // packing, butterfly stages, bit reversal, split
+    return 1 + ((n - 1) >> 1) + ((n - 1) & 1) + 2;
+  }
+  
+  void DirectStep(float* input, float* output, size_t n, size_t step) {
+    size_t half = 1 << (n - 1);
+    if (step == 0) {
+      Pack(input, output, output + half, half);
+    } else if (step + 2 < num_steps(n)) {
+      Butterflies(output, output + half, n - 1, step - 1);
+    } else if (step + 2 == num_steps(n)) {
+      BitReverse(output, input, n - 1);
+      BitReverse(output + half, input + half, n - 1);
+    } else {
+      SplitSpectrum(input, input + half, output, half);
+    }
+  }
+  
+  // Runs the inverse through the direct transform: x = conj(FFT(conj(X))).
+  void InverseStep(float* input, float* output, size_t n, size_t step) {
+    size_t half = 1 << (n - 1);
+    if (step == 0) {
+      MergeSpectrum(input, output, output + half, half);
+    } else if (step + 2 < num_steps(n)) {
+      Butterflies(output, output + half, n - 1, step - 1);
+    } else if (step + 2 == num_steps(n)) {
+      BitReverse(output, input, n - 1);
+      BitReverse(output + half, input + half, n - 1);
+    } else {
+      Unpack(input, input + half, output, half);
+    }
+  }
+
+ private:
+  // x[2k] + i x[2k + 1] -> re[k], im[k]
+  static void Pack(const float* x, float* re, float* im, size_t half) {
+    for (size_t k = 0; k < half; k += simd::kWidth) {
+      simd::Vector even, odd;
+      simd::Deinterleave(
+          simd::Load(x + 2 * k),
+          simd::Load(x + 2 * k + simd::kWidth),
+          &even,
+          &odd);
+      simd::Store(re + k, even);
+      simd::Store(im + k, odd);
+    }
+  }
+  
+  // The inverse of the above, conjugating on the way.
+  static void Unpack(const float* re, const float* im, float* x, size_t half) {
+    simd::Vector minus_one = simd::Splat(-1.0f);
+    for (size_t k = 0; k < half; k += simd::kWidth) {
+      simd::Vector a, b;
+      simd::Interleave(
+          simd::Load(re + k),
+          simd::Mul(simd::Load(im + k), minus_one),
+          &a,
+          &b);
+      simd::Store(x + 2 * k, a);
+      simd::Store(x + 2 * k + simd::kWidth, b);
+    }
+  }
+  
+  // Stage 'stage' of a complex FFT of 2^m points, in place. With an odd m,
+  // the first stage is a radix-2 one.
+  void Butterflies(float* re, float* im, size_t m, size_t stage) {
+    size_t num_points = 1 << m;
+    // log2 of the span of the butterflies
+    size_t pass = m - 2 * stage + (m & 1);
+    if (m & 1 && stage == 0) {
+      Radix2(re, im, num_points, twiddles_ + twiddle_offset_[m]);
+    } else if (pass == 2) {
+      LastRadix4(re, im, num_points);
+    } else {
+      Radix4(re, im, num_points, 1 << pass, twiddles_ + twiddle_offset_[pass]);
+    }
+  }
+  
+  // Radix-2 stage spanning all the points. The radix-4 twiddles of that span
+  // give w^j for the first quarter, and w^(j + L / 4) = -i w^j: its real part
+  // is the imaginary part of w^j, which follows in the table.
+  static void Radix2(float* re, float* im, size_t num_points, const float* w) {
+    size_t h = num_points >> 1;
+    size_t q = num_points >> 2;
+    for (size_t j = 0; j < h; j += simd::kWidth) {
+      simd::Vector ar = simd::Load(re + j);
+      simd::Vector ai = simd::Load(im + j);
+      simd::Vector br = simd::Load(re + j + h);
+      simd::Vector bi = simd::Load(im + j + h);
+      simd::Store(re + j, simd::Add(ar, br));
+      simd::Store(im + j, simd::Add(ai, bi));
+      
+      simd::Vector dr = simd::Sub(ar, br);
+      simd::Vector di = simd::Sub(ai, bi);
+      simd::Vector wr, wi;
+      if (j < q) {
+        wr = simd::Load(w + j);
+        wi = simd::Load(w + q + j);
+      } else {
+        wr = simd::Load(w + j);
+        wi = simd::Sub(simd::Splat(0.0f), simd::Load(w + j - q));
+      }
+      simd::Store(re + j + h, simd::Sub(simd::Mul(dr, wr), simd::Mul(di, wi)));
+      simd::Store(im + j + h, simd::Add(simd::Mul(dr, wi), simd::Mul(di, wr)));
+    }
+  }
+  
+  // Radix-4 stage, made of two radix-2 stages so that the output ends up in
+  // plain bit reversed order:
+  //   x[j]          <- (a0 + a2) + (a1 + a3)
+  //   x[j + q]      <- ((a0 + a2) - (a1 + a3)) w^2j
+  //   x[j + 2q]     <- ((a0 - a2) - i (a1 - a3)) w^j
+  //   x[j + 3q]     <- ((a0 - a2) + i (a1 - a3)) w^3j
+  static void Radix4(
+      float* re,
+      float* im,
+      size_t num_points,
+      size_t span,
+      const float* w) {
+    size_t q = span >> 2;
+    const float* w1 = w;
+    const float* w2 = w + 2 * q;
+    const float* w3 = w + 4 * q;
+    for (size_t start = 0; start < num_points; start += span) {
+      float* r = re + start;
+      float* i = im + start;
+      for (size_t j = 0; j < q; j += simd::kWidth) {
+        simd::Vector a0r = simd::Load(r + j);
+        simd::Vector a0i = simd::Load(i + j);
+        simd::Vector a1r = simd::Load(r + j + q);
+        simd::Vector a1i = simd::Load(i + j + q);
+        simd::Vector a2r = simd::Load(r + j + 2 * q);
+        simd::Vector a2i = simd::Load(i + j + 2 * q);
+        simd::Vector a3r = simd::Load(r + j + 3 * q);
+        simd::Vector a3i = simd::Load(i + j + 3 * q);
+        
+        simd::Vector s02r = simd::Add(a0r, a2r);
+        simd::Vector s02i = simd::Add(a0i, a2i);
+        simd::Vector d02r = simd::Sub(a0r, a2r);
+        simd::Vector d02i = simd::Sub(a0i, a2i);
+        simd::Vector s13r = simd::Add(a1r, a3r);
+        simd::Vector s13i = simd::Add(a1i, a3i);
+        simd::Vector d13r = simd::Sub(a1r, a3r);
+        simd::Vector d13i = simd::Sub(a1i, a3i);
+        
+        simd::Store(r + j, simd::Add(s02r, s13r));
+        simd::Store(i + j, simd::Add(s02i, s13i));
+        
+        Rotate(
+            simd::Sub(s02r, s13r), simd::Sub(s02i, s13i),
+            simd::Load(w2 + j), simd::Load(w2 + q + j),
+            r + j + q, i + j + q);
+        // (a0 - a2) -/+ i (a1 - a3)
+        Rotate(
+            simd::Add(d02r, d13i), simd::Sub(d02i, d13r),
+            simd::Load(w1 + j), simd::Load(w1 + q + j),
+            r + j + 2 * q, i + j + 2 * q);
+        Rotate(
+            simd::Sub(d02r, d13i), simd::Add(d02i, d13r),
+            simd::Load(w3 + j), simd::Load(w3 + q + j),
+            r + j + 3 * q, i + j + 3 * q);
+      }
+    }
+  }
+  
+  // Stores (xr + i xi) (wr + i wi).
+  static inline void Rotate(
+      simd::Vector xr,
+      simd::Vector xi,
+      simd::Vector wr,
+      simd::Vector wi,
+      float* re,
+      float* im) {
+    simd::Store(re, simd::Sub(simd::Mul(xr, wr), simd::Mul(xi, wi)));
+    simd::Store(im, simd::Add(simd::Mul(xr, wi), simd::Mul(xi, wr)));
+  }
+  
+  // The last radix-4 stage works on groups of 4 neighbouring points, without
+  // twiddles. 4 groups are transposed so that each vector holds one point of
+  // every group.
+  static void LastRadix4(float* re, float* im, size_t num_points) {
+    for (size_t start = 0; start < num_points; start += 16) {
+      simd::Vector a0r = simd::Load(re + start);
+      simd::Vector a1r = simd::Load(re + start + 4);
+      simd::Vector a2r = simd::Load(re + start + 8);
+      simd::Vector a3r = simd::Load(re + start + 12);
+      simd::Vector a0i = simd::Load(im + start);
+      simd::Vector a1i = simd::Load(im + start + 4);
+      simd::Vector a2i = simd::Load(im + start + 8);
+      simd::Vector a3i = simd::Load(im + start + 12);
+      simd::Transpose(&a0r, &a1r, &a2r, &a3r);
+      simd::Transpose(&a0i, &a1i, &a2i, &a3i);
+      
+      simd::Vector s02r = simd::Add(a0r, a2r);
+      simd::Vector s02i = simd::Add(a0i, a2i);
+      simd::Vector d02r = simd::Sub(a0r, a2r);
+      simd::Vector d02i = simd::Sub(a0i, a2i);
+      simd::Vector s13r = simd::Add(a1r, a3r);
+      simd::Vector s13i = simd::Add(a1i, a3i);
+      simd::Vector d13r = simd::Sub(a1r, a3r);
+      simd::Vector d13i = simd::Sub(a1i, a3i);
+      
+      simd::Vector y0r = simd::Add(s02r, s13r);
+      simd::Vector y0i = simd::Add(s02i, s13i);
+      simd::Vector y1r = simd::Sub(s02r, s13r);
+      simd::Vector y1i = simd::Sub(s02i, s13i);
+      simd::Vector y2r = simd::Add(d02r, d13i);
+      simd::Vector y2i = simd::Sub(d02i, d13r);
+      simd::Vector y3r = simd::Sub(d02r, d13i);
+      simd::Vector y3i = simd::Add(d02i, d13r);
+      simd::Transpose(&y0r, &y1r, &y2r, &y3r);
+      simd::Transpose(&y0i, &y1i, &y2i, &y3i);
+      simd::Store(re + start, y0r);
+      simd::Store(re + start + 4, y1r);
+      simd::Store(re + start + 8, y2r);
+      simd::Store(re + start + 12, y3r);
+      simd::Store(im + start, y0i);
+      simd::Store(im + start + 4, y1i);
+      simd::Store(im + start + 8, y2i);
+      simd::Store(im + start + 12, y3i);
+    }
+  }
+  
+  // Bit reversed copy of 2^m points.
+  void BitReverse(const float* source, float* destination, size_t m) {
+    size_t shift = num_passes - 1 - m;
+    size_t num_points = 1 << m;
+    for (size_t i = 0; i < num_points; ++i) {
+      destination[i] = source[bit_rev_[i] >> shift];
+    }
+  }
+  
+  // Spectrum of the real signal from the spectrum Z of the packed one:
+  //   X[k] = E[k] + exp(-2 pi i k / N) O[k]
+  // with E[k] = (Z[k] + Z*[h - k]) / 2 and O[k] = (Z[k] - Z*[h - k]) / 2i.
+  // Bins k and h - k are computed together, 4 at a time for k = 1 ... h / 2.
+  void SplitSpectrum(const float* re, const float* im, float* x, size_t h) {
+    size_t stride = (size >> 1) / h;
+    x[0] = re[0] + im[0];
+    x[h] = re[0] - im[0];
+    simd::Vector half = simd::Splat(0.5f);
+    simd::Vector zero = simd::Splat(0.0f);
+    for (size_t k = 1; k <= h / 2; k += simd::kWidth) {
+      size_t mirror = h - k - (simd::kWidth - 1);
+      simd::Vector ar = simd::Load(re + k);
+      simd::Vector ai = simd::Load(im + k);
+      simd::Vector br = simd::Reverse(simd::Load(re + mirror));
+      simd::Vector bi = simd::Reverse(simd::Load(im + mirror));
+      simd::Vector er = simd::Mul(half, simd::Add(ar, br));
+      simd::Vector ei = simd::Mul(half, simd::Sub(ai, bi));
+      simd::Vector o_r = simd::Mul(half, simd::Add(ai, bi));
+      simd::Vector o_i = simd::Mul(half, simd::Sub(br, ar));
+      simd::Vector c, s;
+      LoadSplitTwiddles(k, stride, &c, &s);
+      simd::Vector p = simd::Add(simd::Mul(c, o_r), simd::Mul(s, o_i));
+      simd::Vector q = simd::Sub(simd::Mul(c, o_i), simd::Mul(s, o_r));
+      // Bin h / 2 is written twice, with the same value.
+      simd::Store(x + mirror, simd::Reverse(simd::Sub(er, p)));
+      simd::Store(x + h + mirror, simd::Reverse(simd::Sub(ei, q)));
+      simd::Store(x + k, simd::Add(er, p));
+      simd::Store(x + h + k, simd::Sub(zero, simd::Add(ei, q)));
+    }
+  }
+  
+  // The inverse of the above, scaled by 2 and conjugated:
+  //   Z[k] = (X[k] + X*[h - k]) + i (X[k] - X*[h - k]) exp(2 pi i k / N)
+  void MergeSpectrum(const float* x, float* re, float* im, size_t h) {
+    size_t stride = (size >> 1) / h;
+    re[0] = x[0] + x[h];
+    im[0] = x[h] - x[0];
+    simd::Vector zero = simd::Splat(0.0f);
+    for (size_t k = 1; k <= h / 2; k += simd::kWidth) {
+      size_t mirror = h - k - (simd::kWidth - 1);
+      simd::Vector ar = simd::Load(x + k);
+      simd::Vector ai = simd::Sub(zero, simd::Load(x + h + k));
+      simd::Vector br = simd::Reverse(simd::Load(x + mirror));
+      simd::Vector bi = simd::Sub(
+          zero, simd::Reverse(simd::Load(x + h + mirror)));
+      simd::Vector sr = simd::Add(ar, br);
+      simd::Vector si = simd::Sub(ai, bi);
+      simd::Vector dr = simd::Sub(ar, br);
+      simd::Vector di = simd::Add(ai, bi);
+      simd::Vector c, s;
+      LoadSplitTwiddles(k, stride, &c, &s);
+      simd::Vector u = simd::Add(simd::Mul(c, di), simd::Mul(s, dr));
+      simd::Vector v = simd::Sub(simd::Mul(c, dr), simd::Mul(s, di));
+      simd::Store(re + mirror, simd::Reverse(simd::Add(sr, u)));
+      simd::Store(im + mirror, simd::Reverse(simd::Sub(si, v)));
+      simd::Store(re + k, simd::Sub(sr, u));
+      simd::Store(im + k, simd::Sub(zero, simd::Add(si, v)));
+    }
+  }
+  
+  inline void LoadSplitTwiddles(
+      size_t k,
+      size_t stride,
+      simd::Vector* c,
+      simd::Vector* s) {
+    if (stride == 1) {
+      *c = simd::Load(split_cos_ + k);
+      *s = simd::Load(split_sin_ + k);
+    } else {
+      float c_k[simd::kWidth];
+      float s_k[simd::kWidth];
+      for (size_t i = 0; i < simd::kWidth; ++i) {
+        c_k[i] = split_cos_[(k + i) * stride];
+        s_k[i] = split_sin_[(k + i) * stride];
+      }
+      *c = simd::Load(c_k);
+      *s = simd::Load(s_k);
+    }
+  }
+  
+  float twiddles_[3 * size / 2];
+  size_t twiddle_offset_[num_passes];
+  float split_cos_[size / 2];
+  float split_sin_[size / 2];
+  uint16_t bit_rev_[size / 2];
+  
+  DISALLOW_COPY_AND_ASSIGN(SimdFFT);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_FFT_SIMD_FFT_H_
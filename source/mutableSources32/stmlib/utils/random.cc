@@ -28,9 +28,19 @@
 
 #include "stmlib/utils/random.h"
 
+#include <atomic>
+
 namespace stmlib {
 
 /* static */
-uint32_t Random::rng_state_ = 0x21;
+thread_local uint32_t Random::rng_state_ = 0x21;
+
+/* static */
+uint32_t Random::InstanceSeed() {
+  static std::atomic<uint32_t> num_instances(0);
+  // Golden ratio spacing, so that the states of consecutive instances do
+  // not start close to each other.
+  return 0x21 + num_instances++ * 0x9e3779b9;
+}
 
 }  // namespace stmlib
@@ -42,6 +42,10 @@ namespace tides {
 
 typedef uint8_t ResourceId;
 
+// vb: the tables of tides and tides2 share the namespace and some names, the
+// inline namespace keeps them apart in the shared resources library.
+inline namespace tides2 {
+
 extern const float* lookup_table_table[];
 
 extern const int16_t* lookup_table_i16_table[];
@@ -50,6 +54,9 @@ extern const float lut_sine[];
 extern const float lut_bipolar_fold[];
 extern const float lut_unipolar_fold[];
 extern const int16_t lut_wavetable[];
+
+}  // namespace tides2
+
 #define LUT_SINE 0
 #define LUT_SINE_SIZE 1281
 #define LUT_BIPOLAR_FOLD 1
@@ -29,6 +29,8 @@
 #include "warps/dsp/filter_bank.h"
 
 #include <algorithm>
+#include <cmath>
+#include <complex>
 
 #include "warps/resources.h"
 
@@ -37,19 +39,132 @@ namespace warps {
 using namespace std;
 using namespace stmlib;
 
-void FilterBank::Init(float sample_rate) {
+namespace {
+
+// The coefficients are for the rate of the hardware.
+const double kDesignSampleRate = 96000.0;
+const int32_t kImpulseResponseSize = 2048;
+
+// Coefficients of the sixth octave bank, in the layout of filter_bank_table:
+// decimation factor, delay, post-gain, f and fq of the two SVFs. The low-pass
+// and high-pass bands at both ends are the ones of the third octave bank. The
+// band-pass filters in between are designed like in resources/filter_bank.py.
+class SixthOctaveTable {
+ public:
+  SixthOctaveTable() {
+    copy(
+        &filter_bank_table[0][0],
+        &filter_bank_table[0][7],
+        &coefficients_[0][0]);
+    copy(
+        &filter_bank_table[kNumBands - 1][0],
+        &filter_bank_table[kNumBands - 1][7],
+        &coefficients_[kMaxNumBands - 1][0]);
+    const double interval = pow(2.0, 1.0 / 6.0);
+    const double first_frequency = 110.0 / pow(2.0, 1.0 / 3.0);
+    for (int32_t i = 1; i < kMaxNumBands - 1; ++i) {
+      // Same rates as the third octave bands, up to 1.4kHz at 1/12th.
+      DesignBandPass(
+          first_frequency * pow(interval, i),
+          sqrt(interval),
+          i <= 24 ? kMidFactor * kLowFactor : kMidFactor,
+          coefficients_[i]);
+    }
+    for (int32_t i = 0; i < kMaxNumBands; ++i) {
+      table_[i] = coefficients_[i];
+    }
+  }
+  
+  inline const float* const* table() const { return table_; }
+  
+ private:
+  // Second order Butterworth band-pass, from f / half_width to
+  // f * half_width. Each of its pole pairs makes one crossover SVF.
+  static void DesignBandPass(
+      double frequency,
+      double half_width,
+      int32_t decimation_factor,
+      float* coefficients) {
+    const double nyquist = kDesignSampleRate / decimation_factor * 0.5;
+    
+    // Pre-warped band edges, then the pole of the analog low-pass prototype
+    // moved to the band, and the bilinear transform (fs = 2, like scipy).
+    double low = 4.0 * tan(M_PI * 0.5 * frequency / half_width / nyquist);
+    double high = 4.0 * tan(M_PI * 0.5 * frequency * half_width / nyquist);
+    complex<double> pole = complex<double>(-M_SQRT1_2, M_SQRT1_2) * \
+        (high - low) * 0.5;
+    complex<double> root = sqrt(pole * pole - low * high);
+    complex<double> analog_poles[2] = { pole + root, pole - root };
+    
+    const float gain = 0.25f;
+    CrossoverSvf svf[2];
+    for (int32_t pass = 0; pass < 2; ++pass) {
+      complex<double> z = (4.0 + analog_poles[pass]) / \
+          (4.0 - analog_poles[pass]);
+      coefficients[pass * 2 + 3] = -abs(1.0 - z);
+      coefficients[pass * 2 + 4] = 1.0 - norm(z);
+      svf[pass].Init();
+      svf[pass].set_f_fq(
+          coefficients[pass * 2 + 3],
+          coefficients[pass * 2 + 4]);
+    }
+    
+    // The delay is the center of gravity of the energy of the impulse
+    // response.
+    double energy = 0.0;
+    double moment = 0.0;
+    for (int32_t i = 0; i < kImpulseResponseSize; ++i) {
+      float y = i == 0 ? gain : 0.0f;
+      svf[0].Process<FILTER_MODE_BAND_PASS_NORMALIZED>(&y, &y, 1);
+      svf[1].Process<FILTER_MODE_BAND_PASS_NORMALIZED>(&y, &y, 1);
+      energy += y * y;
+      moment += i * y * y;
+    }
+    coefficients[0] = decimation_factor;
+    coefficients[1] = floor(moment / energy);
+    coefficients[2] = gain;
+  }
+  
+  float coefficients_[kMaxNumBands][7];
+  const float* table_[kMaxNumBands];
+};
+
+inline FilterMode BandMode(int32_t band, int32_t num_bands) {
+  if (band == 0) {
+    return FILTER_MODE_LOW_PASS;
+  } else if (band == num_bands - 1) {
+    return FILTER_MODE_HIGH_PASS;
+  } else {
+    return FILTER_MODE_BAND_PASS_NORMALIZED;
+  }
+}
+
+}  // namespace
+
+void FilterBank::Init(float sample_rate, int32_t num_bands) {
+  static const SixthOctaveTable sixth_octave_table;
+  
+  num_bands_ = num_bands == kMaxNumBands ? kMaxNumBands : kNumBands;
+  const float* const* table = num_bands_ == kNumBands
+      ? filter_bank_table
+      : sixth_octave_table.table();
+  
   low_src_down_.Init();
   low_src_up_.Init();
   mid_src_down_.Init();
   mid_src_up_.Init();
   
+  svf_.Init();
+  fill(&post_gain_[0], &post_gain_[kMaxNumLanes], 0.0f);
+  fill(&samples_[0], &samples_[kSampleMemorySize], 0.0f);
+  
   int32_t max_delay = 0;
-  float* samples = &samples_[0];
   
   int32_t group = -1;
   int32_t decimation_factor = -1;
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    const float* coefficients = filter_bank_table[i];
+  int32_t lane = 0;
+  for (int32_t i = 0; i < num_bands_; ++i) {
+    const float* coefficients = table[i];
 
     Band& b = band_[i];
 
@@ -58,29 +173,51 @@ void FilterBank::Init(float sample_rate) {
     if (b.decimation_factor != decimation_factor) {
       decimation_factor = b.decimation_factor;
       ++group;
+      // Groups start on a new vector.
+      lane = (lane + simd::kWidth - 1) & ~(simd::kWidth - 1);
+      group_[group].first_band = i;
+      group_[group].num_bands = 0;
+      group_[group].first_lane = lane;
+      group_[group].decimation_factor = decimation_factor;
     }
+    ++group_[group].num_bands;
     
     b.group = group;
+    b.lane = lane++;
     b.sample_rate = sample_rate / static_cast<float>(b.decimation_factor);
-    b.samples = samples;
-    samples += kMaxFilterBankBlockSize / b.decimation_factor;
     
     b.delay = static_cast<int32_t>(coefficients[1]);
     b.delay *= b.decimation_factor;
-    b.post_gain = coefficients[2];
+    post_gain_[b.lane] = coefficients[2];
 
     max_delay = max(max_delay, b.delay);
+    svf_.set_mode(b.lane, BandMode(i, num_bands_));
     for (int32_t pass = 0; pass < 2; ++pass) {
-      b.svf[pass].Init();
-      b.svf[pass].set_f_fq(
+      svf_.set_f_fq(
+          b.lane,
+          pass,
           coefficients[pass * 2 + 3],
           coefficients[pass * 2 + 4]);
     }
   }
-  band_[kNumBands].group = band_[kNumBands - 1].group + 1;
+  
+  float* samples = &samples_[0];
+  for (int32_t i = 0; i < kNumBandGroups; ++i) {
+    BandGroup& g = group_[i];
+    g.num_lanes = (g.num_bands + simd::kWidth - 1) & ~(simd::kWidth - 1);
+    g.samples = samples;
+    // The padding lanes (silent, their post-gain is 0) take the mode of the
+    // last band, so that the vector does not mix modes.
+    int32_t last_band = g.first_band + g.num_bands - 1;
+    for (int32_t lane = g.num_bands; lane < g.num_lanes; ++lane) {
+      svf_.set_mode(g.first_lane + lane, BandMode(last_band, num_bands_));
+    }
+    samples += kMaxFilterBankBlockSize / g.decimation_factor * g.num_lanes;
+  }
+  
   max_delay = min(max_delay, int32_t(256));
   float* delay_ptr = &delay_buffer_[0];
-  for (int32_t i = 0; i < kNumBands; ++i) {
+  for (int32_t i = 0; i < num_bands_; ++i) {
     Band& b = band_[i];
     int32_t compensation = max_delay - b.delay;
     if (b.group == 0) {
@@ -103,53 +240,46 @@ void FilterBank::Analyze(const float* in, size_t size) {
   low_src_down_.Process(tmp_[0], tmp_[1], size / kMidFactor);
   
   const float* sources[3] = { tmp_[1], tmp_[0], in };
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    Band& b = band_[i];
-    const size_t band_size = size / b.decimation_factor;
-    const float* input = sources[b.group];
+  for (int32_t i = 0; i < kNumBandGroups; ++i) {
+    const BandGroup& g = group_[i];
+    const size_t group_size = size / g.decimation_factor;
     
-    for (int32_t pass = 0; pass < 2; ++pass) {
-      const float* source = pass == 0 ? input : b.samples;
-      float* destination = b.samples;
-      if (i == 0) {
-        b.svf[pass].Process<FILTER_MODE_LOW_PASS>(
-            source, destination, band_size);
-      } else if (i == kNumBands - 1) {
-        b.svf[pass].Process<FILTER_MODE_HIGH_PASS>(
-            source, destination, band_size);
-      } else {
-        b.svf[pass].Process<FILTER_MODE_BAND_PASS_NORMALIZED>(
-            source, destination, band_size);
+    for (int32_t lane = 0; lane < g.num_lanes; lane += simd::kWidth) {
+      float* samples = g.samples + lane;
+      svf_.Process(
+          g.first_lane + lane, sources[i], samples, group_size, g.num_lanes);
+      
+      // Apply post-gain
+      const simd::Vector gain = simd::Load(&post_gain_[g.first_lane + lane]);
+      for (size_t j = 0; j < group_size; ++j) {
+        float* frame = samples + j * g.num_lanes;
+        simd::Store(frame, simd::Mul(simd::Load(frame), gain));
       }
     }
-    // Apply post-gain
-    const float gain = b.post_gain;
-    float* output = b.samples;
-    for (size_t i = 0; i < band_size; ++i) {
-      output[i] *= gain;
-    }
   }
 }
 
 void FilterBank::Synthesize(float* out, size_t size) {
   float* buffers[3] = { tmp_[1], tmp_[0], out };
 
-  fill(&buffers[0][0], &buffers[0][size / band_[0].decimation_factor], 0.0f);
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    Band& b = band_[i];
+  fill(&buffers[0][0], &buffers[0][size / group_[0].decimation_factor], 0.0f);
+  for (int32_t i = 0; i < kNumBandGroups; ++i) {
+    const BandGroup& g = group_[i];
+    const size_t group_size = size / g.decimation_factor;
     
-    size_t band_size = size / b.decimation_factor;
-    float* s = buffers[b.group];
-    for (size_t j = 0; j < band_size; ++j) {
-      s[j] += b.delay_line.ReadWrite(b.samples[j]);
+    float* s = buffers[i];
+    for (int32_t band = 0; band < g.num_bands; ++band) {
+      Band& b = band_[g.first_band + band];
+      const float* samples = g.samples + band;
+      for (size_t j = 0; j < group_size; ++j) {
+        s[j] += b.delay_line.ReadWrite(samples[j * g.num_lanes]);
+      }
     }
     
-    if (band_[i + 1].group != b.group) {
-      if (b.group == 0) {
-        low_src_up_.Process(tmp_[1], tmp_[0], band_size);
-      } else if (b.group == 1) {
-        mid_src_up_.Process(tmp_[0], out, band_size);
-      }
+    if (i == 0) {
+      low_src_up_.Process(tmp_[1], tmp_[0], group_size);
+    } else if (i == 1) {
+      mid_src_up_.Process(tmp_[0], out, group_size);
     }
   }
 }
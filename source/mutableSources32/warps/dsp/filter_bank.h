@@ -25,6 +25,11 @@
 // -----------------------------------------------------------------------------
 //
 // Filter bank.
+//
+// The bands are kept as a structure of arrays: bands running at the same rate
+// form a group, and each group is padded to whole SIMD vectors ("lanes"), so
+// that the filters of four bands run at once. The samples of a group are
+// interleaved, one frame of num_lanes samples per sample period.
 
 #ifndef WARPS_DSP_FILTER_BANK_H_
 #define WARPS_DSP_FILTER_BANK_H_
@@ -33,18 +38,23 @@
 
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
+#include "stmlib/dsp/simd.h"
+#include "stmlib/dsp/svf_bank.h"
 
 #include "warps/dsp/sample_rate_converter.h"
 #include "warps/resources.h"
 
 namespace warps {
 
-const int32_t kNumBands = 20;
+const int32_t kNumBands = 20;  // Third octave bands, like the hardware.
+const int32_t kMaxNumBands = 39;  // Sixth octave bands.
+const int32_t kNumBandGroups = 3;
+const int32_t kMaxNumLanes = 48;  // Enough for both, with the padding.
 const int32_t kLowFactor = 4;
 const int32_t kMidFactor = 3;
 const int32_t kDelayLineSize = 6144;
 const int32_t kMaxFilterBankBlockSize = 96;
-const int32_t kSampleMemorySize = kMaxFilterBankBlockSize * kNumBands / 2;
+const int32_t kSampleMemorySize = kMaxFilterBankBlockSize * kMaxNumLanes / 2;
 
 class PooledDelayLine {
  public:
@@ -62,7 +72,9 @@ class PooledDelayLine {
   
   float ReadWrite(float value) {
     delay_line_[head_] = value;
-    head_ = (head_ + 1) % size_;
+    if (++head_ == size_) {
+      head_ = 0;
+    }
     return delay_line_[head_];
   };
   
@@ -76,37 +88,60 @@ class PooledDelayLine {
 
 struct Band {
   int32_t group;
+  int32_t lane;
   float sample_rate;
-  float post_gain;
-  stmlib::CrossoverSvf svf[2];
   int32_t decimation_factor;
-  float* samples;
   PooledDelayLine delay_line;
   int32_t delay;
 };
 
+struct BandGroup {
+  int32_t first_band;
+  int32_t num_bands;
+  int32_t first_lane;
+  int32_t num_lanes;  // A multiple of simd::kWidth.
+  int32_t decimation_factor;
+  float* samples;  // Lane l of frame j at samples[j * num_lanes + l].
+};
+
 class FilterBank {
  public:
   FilterBank() { }
   ~FilterBank() { }
-  void Init(float sample_rate);
+  
+  // num_bands is kNumBands or kMaxNumBands.
+  void Init(float sample_rate, int32_t num_bands);
   void Analyze(const float* in, size_t size);
   void Synthesize(float* out, size_t size);
-  const Band& band(int32_t index) {
+  
+  inline int32_t num_bands() const { return num_bands_; }
+  
+  const Band& band(int32_t index) const {
     return band_[index];
   }
   
+  const BandGroup& group(int32_t index) const {
+    return group_[index];
+  }
+  
  private:
   SampleRateConverter<SRC_DOWN, kMidFactor, 36> mid_src_down_;
   SampleRateConverter<SRC_UP, kMidFactor, 36> mid_src_up_;
   SampleRateConverter<SRC_DOWN, kLowFactor, 48> low_src_down_;
   SampleRateConverter<SRC_UP, kLowFactor, 48> low_src_up_;
   
+  int32_t num_bands_;
+  
   float tmp_[2][kMaxFilterBankBlockSize];
   float samples_[kSampleMemorySize];
   float delay_buffer_[kDelayLineSize];
   
-  Band band_[kNumBands + 1];
+  // Each band runs through two crossover SVFs, with different coefficients.
+  stmlib::CrossoverSvfBank<kMaxNumLanes, 2> svf_;
+  float post_gain_[kMaxNumLanes];
+  
+  Band band_[kMaxNumBands];
+  BandGroup group_[kNumBandGroups];
   
   DISALLOW_COPY_AND_ASSIGN(FilterBank);
 };
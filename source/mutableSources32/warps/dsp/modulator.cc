@@ -47,10 +47,14 @@ void Modulator::Init(float sample_rate) {
   
   for (int32_t i = 0; i < 2; ++i) {
     amplifier_[i].Init();
-    src_up_[i].Init();
     quadrature_transform_[i].Init(lut_ap_poles, LUT_AP_POLES_SIZE);
   }
-  src_down_.Init();
+  oversampler_6x_.Init();
+  oversampler_4x_.Init();
+  oversampler_2x_.Init();
+  oversampling_ = kOversampling;
+  xmod_ratio_ = kOversampling;
+  xmod_ratio_hold_ = 0;
   
   xmod_oscillator_.Init(sample_rate);
   vocoder_oscillator_.Init(sample_rate);
@@ -67,9 +71,20 @@ void Modulator::Init(float sample_rate) {
   feedback_sample_ = 0.0f;
 }
 
+void Modulator::set_oversampling(int32_t oversampling) {
+  if (oversampling <= kOversamplingAuto) {
+    oversampling_ = kOversamplingAuto;
+  } else if (oversampling <= 2) {
+    oversampling_ = oversampling;
+  } else {
+    oversampling_ = oversampling <= 4 ? 4 : 6;
+  }
+}
+
+template<typename IO>
 void Modulator::ProcessEasterEgg(
-    ShortFrame* input,
-    ShortFrame* output,
+    typename IO::Buffer input,
+    typename IO::Buffer output,
     size_t size) {
   float* carrier = buffer_[0];
   float* carrier_i = &src_buffer_[0][0];
@@ -98,8 +113,9 @@ void Modulator::ProcessEasterEgg(
     float shape = static_cast<float>(parameters_.carrier_shape - 1) * 0.5f;
     quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
   } else {
+    const typename IO::Sample* l = IO::Channel(input, 0);
     for (size_t i = 0; i < size; ++i) {
-      carrier[i] = static_cast<float>(input[i].l) / 32768.0f;
+      carrier[i] = ToFloat(l[i * IO::kStride]);
     }
     quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
     
@@ -133,16 +149,18 @@ void Modulator::ProcessEasterEgg(
       parameters_.channel_drive[1],
       size);
   
+  const typename IO::Sample* l = IO::Channel(input, 0);
+  const typename IO::Sample* r = IO::Channel(input, 1);
   float feedback_sample = feedback_sample_;
   for (size_t i = 0; i < size; ++i) {
     float timbre = mix.Next();
     float modulator_i, modulator_q;
 
     // Start from the signal from input 2, with non-linear gain.
-    float in = static_cast<float>(input->r) / 32768.0f;
+    float in = ToFloat(r[i * IO::kStride]);
     
     if (parameters_.carrier_shape) {
-      in += static_cast<float>(input->l) / 32768.0f;
+      in += ToFloat(l[i * IO::kStride]);
     }
     
     float modulator = in;
@@ -177,278 +195,30 @@ void Modulator::ProcessEasterEgg(
     main += wet_dry * (in - main);
     aux += wet_dry * (in - aux);
     
-    output->l = Clip16(static_cast<int32_t>(main * 32768.0f));
-    output->r = Clip16(static_cast<int32_t>(aux * 32768.0f));
-    ++output;
-    ++input;
+    CONSTRAIN(main, -1.0f, 1.0f);
+    CONSTRAIN(aux, -1.0f, 1.0f);
+    IO::Write(output, i, main, aux);
   }
   feedback_sample_ = feedback_sample;
   previous_parameters_ = parameters_;
 }
-    
-    void Modulator::ProcessEasterEggf(
-                                     FloatFrame* input,
-                                     FloatFrame* output,
-                                     size_t size) {
-        float* carrier = buffer_[0];
-        float* carrier_i = &src_buffer_[0][0];
-        float* carrier_q = &src_buffer_[0][size];
-        
-        // Generate the I/Q components.
-        if (parameters_.carrier_shape) {
-            float d = parameters_.frequency_shift_pot - 0.5f;
-            float linear_modulation_amount = 1.0f - 14.0f * d * d;
-            if (linear_modulation_amount < 0.0f) {
-                linear_modulation_amount = 0.0f;
-            }
-            float frequency = parameters_.frequency_shift_pot;
-            frequency += linear_modulation_amount * parameters_.frequency_shift_cv;
-            
-            float direction = frequency >= 0.5f ? 1.0f : -1.0f;
-            frequency = 2.0f * fabs(frequency - 0.5f);
-            frequency = frequency <= 0.4f
-            ? frequency * frequency * frequency * 62.5f
-            : 4.0f * SemitonesToRatio(180.0f * (frequency - 0.4f));
-            frequency *= SemitonesToRatio(
-                                          parameters_.frequency_shift_cv * 60.0f * \
-                                          (1.0f - linear_modulation_amount) * direction);
-            frequency *= direction;
-            
-            float shape = static_cast<float>(parameters_.carrier_shape - 1) * 0.5f;
-            quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
-        } else {
-            for (size_t i = 0; i < size; ++i) {
-                //carrier[i] = static_cast<float>(input[i].l) / 32768.0f;
-                carrier[i] = input[i].l;
-            }
-            quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
-            
-            ParameterInterpolator phase_shift(
-                                              &previous_parameters_.phase_shift,
-                                              parameters_.phase_shift,
-                                              size);
-            
-            for (size_t i = 0; i < size; ++i) {
-                float x_i = carrier_i[i];
-                float x_q = carrier_q[i];
-                float angle = phase_shift.Next();
-                float r_sin = Interpolate(lut_sin, angle, 1024.0f);
-                float r_cos = Interpolate(lut_sin + 256, angle, 1024.0f);
-                carrier_i[i] = r_sin * x_i + r_cos * x_q;
-                carrier_q[i] = r_sin * x_q - r_cos * x_i;
-            }
-        }
-        
-        // Setup parameter interpolation.
-        ParameterInterpolator mix(
-                                  &previous_parameters_.modulation_parameter,
-                                  parameters_.modulation_parameter,
-                                  size);
-        ParameterInterpolator feedback_amount(
-                                              &previous_parameters_.channel_drive[0],
-                                              parameters_.channel_drive[0],
-                                              size);
-        ParameterInterpolator dry_wet(
-                                      &previous_parameters_.channel_drive[1],
-                                      parameters_.channel_drive[1],
-                                      size);
-        
-        float feedback_sample = feedback_sample_;
-        for (size_t i = 0; i < size; ++i) {
-            float timbre = mix.Next();
-            float modulator_i, modulator_q;
-            
-            // Start from the signal from input 2, with non-linear gain.
-            float in = input->r;
-            
-            if (parameters_.carrier_shape) {
-                in += input->l;
-            }
-            
-            float modulator = in;
-            
-            // Apply feedback if necessary, and soft limit.
-            float amount = feedback_amount.Next();
-            amount *= (2.0f - amount);
-            amount *= (2.0f - amount);
-            
-            // mic.w feedback amount tweak.
-            float max_fb = 1.0f + 2.0f * (timbre - 0.5f) * (timbre - 0.5f);
-            modulator += amount * (
-                                   SoftClip(modulator + max_fb * feedback_sample * amount) - modulator);
-            
-            quadrature_transform_[1].Process(modulator, &modulator_i, &modulator_q);
-            
-            // Modulate!
-            float a = *carrier_i++ * modulator_i;
-            float b = *carrier_q++ * modulator_q;
-            float up = a - b;
-            float down = a + b;
-            float lut_index = timbre;
-            float fade_in = Interpolate(lut_xfade_in, lut_index, 256.0f);
-            float fade_out = Interpolate(lut_xfade_out, lut_index, 256.0f);
-            float main = up * fade_in + down * fade_out;
-            float aux = down * fade_in + up * fade_out;
-            
-            // Simple LP to prevent feedback of high-frequencies.
-            ONE_POLE(feedback_sample, main, 0.2f);
-            
-            float wet_dry = 1.0f - dry_wet.Next();
-            main += wet_dry * (in - main);
-            aux += wet_dry * (in - aux);
-            
-            CONSTRAIN(main, -1.0f, 1.0f);
-            CONSTRAIN(aux, -1.0f, 1.0f);
-            output->l = main;
-            output->r = aux;
-            ++output;
-            ++input;
-        }
-        feedback_sample_ = feedback_sample;
-        previous_parameters_ = parameters_;
-    }
-    
-    
-    void Modulator::ProcessEasterEggff(
-                                     float** input,
-                                     float** output,
-                                     size_t size) {
-        float* carrier = buffer_[0];
-        float* carrier_i = &src_buffer_[0][0];
-        float* carrier_q = &src_buffer_[0][size];
-        
-        // Generate the I/Q components.
-        if (parameters_.carrier_shape) {
-            float d = parameters_.frequency_shift_pot - 0.5f;
-            float linear_modulation_amount = 1.0f - 14.0f * d * d;
-            if (linear_modulation_amount < 0.0f) {
-                linear_modulation_amount = 0.0f;
-            }
-            float frequency = parameters_.frequency_shift_pot;
-            frequency += linear_modulation_amount * parameters_.frequency_shift_cv;
-            
-            float direction = frequency >= 0.5f ? 1.0f : -1.0f;
-            frequency = 2.0f * fabs(frequency - 0.5f);
-            frequency = frequency <= 0.4f
-            ? frequency * frequency * frequency * 62.5f
-            : 4.0f * SemitonesToRatio(180.0f * (frequency - 0.4f));
-            frequency *= SemitonesToRatio(
-                                          parameters_.frequency_shift_cv * 60.0f * \
-                                          (1.0f - linear_modulation_amount) * direction);
-            frequency *= direction;
-            
-            float shape = static_cast<float>(parameters_.carrier_shape - 1) * 0.5f;
-            quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
-        } else {
-            for (size_t i = 0; i < size; ++i) {
-                carrier[i] = input[0][i];//static_cast<float>(input[i].l) / 32768.0f;
-            }
-            quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
-            
-            ParameterInterpolator phase_shift(
-                                              &previous_parameters_.phase_shift,
-                                              parameters_.phase_shift,
-                                              size);
-            
-            for (size_t i = 0; i < size; ++i) {
-                float x_i = carrier_i[i];
-                float x_q = carrier_q[i];
-                float angle = phase_shift.Next();
-                float r_sin = Interpolate(lut_sin, angle, 1024.0f);
-                float r_cos = Interpolate(lut_sin + 256, angle, 1024.0f);
-                carrier_i[i] = r_sin * x_i + r_cos * x_q;
-                carrier_q[i] = r_sin * x_q - r_cos * x_i;
-            }
-        }
-        
-        // Setup parameter interpolation.
-        ParameterInterpolator mix(
-                                  &previous_parameters_.modulation_parameter,
-                                  parameters_.modulation_parameter,
-                                  size);
-        ParameterInterpolator feedback_amount(
-                                              &previous_parameters_.channel_drive[0],
-                                              parameters_.channel_drive[0],
-                                              size);
-        ParameterInterpolator dry_wet(
-                                      &previous_parameters_.channel_drive[1],
-                                      parameters_.channel_drive[1],
-                                      size);
-        
-        float feedback_sample = feedback_sample_;
-        for (size_t i = 0; i < size; ++i) {
-            float timbre = mix.Next();
-            float modulator_i, modulator_q;
-            
-            // Start from the signal from input 2, with non-linear gain.
-            //float in = static_cast<float>(input->r) / 32768.0f;
-            float in = input[1][i];
-            
-            if (parameters_.carrier_shape) {
-                //in += static_cast<float>(input->l) / 32768.0f;
-                in += input[0][i];
-            }
-            
-            float modulator = in;
-            
-            // Apply feedback if necessary, and soft limit.
-            float amount = feedback_amount.Next();
-            amount *= (2.0f - amount);
-            amount *= (2.0f - amount);
-            
-            // mic.w feedback amount tweak.
-            float max_fb = 1.0f + 2.0f * (timbre - 0.5f) * (timbre - 0.5f);
-            modulator += amount * (
-                                   SoftClip(modulator + max_fb * feedback_sample * amount) - modulator);
-            
-            quadrature_transform_[1].Process(modulator, &modulator_i, &modulator_q);
-            
-            // Modulate!
-            float a = *carrier_i++ * modulator_i;
-            float b = *carrier_q++ * modulator_q;
-            float up = a - b;
-            float down = a + b;
-            float lut_index = timbre;
-            float fade_in = Interpolate(lut_xfade_in, lut_index, 256.0f);
-            float fade_out = Interpolate(lut_xfade_out, lut_index, 256.0f);
-            float main = up * fade_in + down * fade_out;
-            float aux = down * fade_in + up * fade_out;
-            
-            // Simple LP to prevent feedback of high-frequencies.
-            ONE_POLE(feedback_sample, main, 0.2f);
-            
-            float wet_dry = 1.0f - dry_wet.Next();
-            main += wet_dry * (in - main);
-            aux += wet_dry * (in - aux);
-            /*
-            output->l = Clip16(static_cast<int32_t>(main * 32768.0f));
-            output->r = Clip16(static_cast<int32_t>(aux * 32768.0f));
-            ++output;
-            ++input;*/
-            CONSTRAIN(main, -1.f, 1.f);
-            CONSTRAIN(aux, -1.f, 1.f);
-            output[0][i] = main;
-            output[1][i] = aux;
-        }
-        feedback_sample_ = feedback_sample;
-        previous_parameters_ = parameters_;
-    }
 
-void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
+template<typename IO>
+void Modulator::Process(
+    typename IO::Buffer input,
+    typename IO::Buffer output,
+    size_t size) {
   if (bypass_) {
-    copy(&input[0], &input[size], &output[0]);
+    IO::Copy(input, output, size);
     return;
   } else if (easter_egg_) {
-    ProcessEasterEgg(input, output, size);
+    ProcessEasterEgg<IO>(input, output, size);
     return;
   }
   float* carrier = buffer_[0];
   float* modulator = buffer_[1];
   float* main_output = buffer_[0];
   float* aux_output = buffer_[2];
-  float* oversampled_carrier = src_buffer_[0];
-  float* oversampled_modulator = src_buffer_[1];
-  float* oversampled_output = src_buffer_[0];
   
   // 0.0: use cross-modulation algorithms. 1.0f: use vocoder.
   float vocoder_amount = (
@@ -460,23 +230,31 @@ void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
   }
   
   // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-  short* input_samples = &input->l;
-  for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-      amplifier_[i].Process(
-          parameters_.channel_drive[i],
-          1.0f - vocoder_amount,
-          input_samples + i,
-          buffer_[i],
-          aux_output,
-          2,
-          size);
+  int32_t first_amplified = IO::kAmplifyBothInputs || \
+      !parameters_.carrier_shape ? 0 : 1;
+  for (int32_t i = first_amplified; i < 2; ++i) {
+    amplifier_[i].Process(
+        parameters_.channel_drive[i],
+        1.0f - vocoder_amount,
+        IO::Channel(input, i),
+        buffer_[i],
+        aux_output,
+        IO::kStride,
+        size);
   }
 
   // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
   if (parameters_.carrier_shape) {
     // Scale phase-modulation input.
-    for (size_t i = 0; i < size; ++i) {
-        internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+    if (IO::kAmplifyBothInputs) {
+      // vb, we want level1 to control amp of ext. carrier input when doing PM
+      // with int.osc, so take input AFTER vca/saturation not before.
+      copy(&carrier[0], &carrier[size], &internal_modulation_[0]);
+    } else {
+      const typename IO::Sample* l = IO::Channel(input, 0);
+      for (size_t i = 0; i < size; ++i) {
+        internal_modulation_[i] = ToFloat(l[i * IO::kStride]);
+      }
     }
     // Xmod: sine, triangle saw.
     // Vocoder: saw, pulse, noise.
@@ -535,9 +313,6 @@ void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
   }
   
   if (vocoder_amount < 0.5f) {
-    src_up_[0].Process(carrier, oversampled_carrier, size);
-    src_up_[1].Process(modulator, oversampled_modulator, size);
-    
     float algorithm = min(parameters_.modulation_algorithm * 8.0f, 5.999f);
     float previous_algorithm = min(
         previous_parameters_.modulation_algorithm * 8.0f, 5.999f);
@@ -549,23 +324,45 @@ void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
       previous_algorithm_fractional = algorithm_fractional;
     }
 
-    (this->*xmod_table_[algorithm_integral])(
-        previous_algorithm_fractional,
-        algorithm_fractional,
-        previous_parameters_.skewed_modulation_parameter(),
-        parameters_.skewed_modulation_parameter(),
-        oversampled_modulator,
-        oversampled_carrier,
-        oversampled_output,
-        size * kOversampling);
+    XmodBlock xmod;
+    xmod.fn = xmod_table_[algorithm_integral];
+    xmod.balance = previous_algorithm_fractional;
+    xmod.balance_end = algorithm_fractional;
+    xmod.parameter = previous_parameters_.skewed_modulation_parameter();
+    xmod.parameter_end = parameters_.skewed_modulation_parameter();
 
-    src_down_.Process(oversampled_output, main_output, size * kOversampling);
+    int32_t ratio = ChooseXmodRatio(algorithm_integral, xmod);
+    if (ratio == xmod_ratio_) {
+      RenderXmod(ratio, xmod, modulator, carrier, main_output, size);
+    } else {
+      // The ratios have different latencies, cross-fade over one block.
+      // The converters of the new ratio start from silence.
+      if (ratio == 6) {
+        oversampler_6x_.Init();
+      } else if (ratio == 4) {
+        oversampler_4x_.Init();
+      } else if (ratio == 2) {
+        oversampler_2x_.Init();
+      }
+      RenderXmod(ratio, xmod, modulator, carrier, fade_buffer_, size);
+      RenderXmod(xmod_ratio_, xmod, modulator, carrier, main_output, size);
+      float fade = 0.0f;
+      float fade_increment = 1.0f / static_cast<float>(size);
+      for (size_t i = 0; i < size; ++i) {
+        fade += fade_increment;
+        main_output[i] += fade * (fade_buffer_[i] - main_output[i]);
+      }
+      xmod_ratio_ = ratio;
+    }
   } else {
     float release_time = 4.0f * (parameters_.modulation_algorithm - 0.75f);
     CONSTRAIN(release_time, 0.0f, 1.0f);
     
     vocoder_.set_release_time(release_time * (2.0f - release_time));
     vocoder_.set_formant_shift(parameters_.modulation_parameter);
+    if (IO::kVocoderPreGain) {
+      vocoder_.set_limiter_pre_gain(parameters_.limiter_pre_gain);
+    }
     vocoder_.Process(modulator, carrier, main_output, size);
   }
   
@@ -580,356 +377,13 @@ void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
     }
   }
 
-  // Convert back to integer and clip.
-    
-  while (size--) {
-    output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-    output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
-    ++main_output;
-    ++aux_output;
-    ++output;
+  // Convert back to the output format.
+  for (size_t i = 0; i < size; ++i) {
+    IO::Write(output, i, main_output[i], aux_output[i] * 0.5f);
   }
     
   previous_parameters_ = parameters_;
 }
-    
-void Modulator::Processf(FloatFrame* input, FloatFrame* output, size_t size) {
-        if (bypass_) {
-            copy(&input[0], &input[size], &output[0]);
-            return;
-        } else if (easter_egg_) {
-            ProcessEasterEggf(input, output, size);
-            return;
-        }
-        float* carrier = buffer_[0];
-        float* modulator = buffer_[1];
-        float* main_output = buffer_[0];
-        float* aux_output = buffer_[2];
-        float* oversampled_carrier = src_buffer_[0];
-        float* oversampled_modulator = src_buffer_[1];
-        float* oversampled_output = src_buffer_[0];
-        
-        // 0.0: use cross-modulation algorithms. 1.0f: use vocoder.
-        float vocoder_amount = (parameters_.modulation_algorithm - 0.7f) * 20.0f + 0.5f;
-        CONSTRAIN(vocoder_amount, 0.0f, 1.0f);
-    
-        
-        if (!parameters_.carrier_shape) {
-            fill(&aux_output[0], &aux_output[size], 0.0f);
-        }
-    
-        // apply VCA/saturation (5.8% per channel)
-        float* input_samples = &input->l;
-//        for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-        for (int32_t i = 0; i < 2; ++i) {       // vb, always apply VCA to both inputs
-            amplifier_[i].Processf(
-                                  parameters_.channel_drive[i],
-                                  1.0f - vocoder_amount,
-                                  input_samples + i,
-                                  buffer_[i],
-                                  aux_output,
-                                  2,
-                                  size);
-        }
-        
-        // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
-        if (parameters_.carrier_shape) {
-            // Scale phase-modulation input.
-            for (size_t i = 0; i < size; ++i) {
-                // internal_modulation_[i] = input[i].l;
-                // vb, we want level1 to control amp of ext. carrier input when doing PM with int.osc
-                // so, take input AFTER vca/saturation not before
-                internal_modulation_[i] = carrier[i];
-            }
-
-            // Xmod: sine, triangle saw.
-            // Vocoder: saw, pulse, noise.
-            OscillatorShape xmod_shape = static_cast<OscillatorShape>(parameters_.carrier_shape - 1);
-            OscillatorShape vocoder_shape = static_cast<OscillatorShape>(parameters_.carrier_shape + 1);
-            
-            
-            const float kXmodCarrierGain = 0.5f;
-            
-            // Outside of the transition zone between the cross-modulation and vocoding
-            // algorithm, we need to render only one of the two oscillators.
-            if (vocoder_amount == 0.0f) {
-                xmod_oscillator_.Render(
-                                        xmod_shape,
-                                        parameters_.note,
-                                        internal_modulation_,
-                                        aux_output,
-                                        size);
-                for (size_t i = 0; i < size; ++i) {
-                    carrier[i] = aux_output[i] * kXmodCarrierGain;
-                }
-            } else if (vocoder_amount >= 0.5f) {
-                float carrier_gain = vocoder_oscillator_.Render(
-                                                                vocoder_shape,
-                                                                parameters_.note,
-                                                                internal_modulation_,
-                                                                aux_output,
-                                                                size);
-
-                for (size_t i = 0; i < size; ++i) {
-                    carrier[i] = aux_output[i] * carrier_gain;
-                }
-            } else {
-                float balance = vocoder_amount * 2.0f;
-                xmod_oscillator_.Render(
-                                        xmod_shape,
-                                        parameters_.note,
-                                        internal_modulation_,
-                                        carrier,
-                                        size);
-                float carrier_gain = vocoder_oscillator_.Render(
-                                                                vocoder_shape,
-                                                                parameters_.note,
-                                                                internal_modulation_,
-                                                                aux_output,
-                                                                size);
-                for (size_t i = 0; i < size; ++i) {
-                    float a = carrier[i];
-                    float b = aux_output[i];
-                    aux_output[i] = a + (b - a) * balance;
-                    a *= kXmodCarrierGain;
-                    b *= carrier_gain;
-                    carrier[i] = a + (b - a) * balance;
-                }
-            }
-        }
-        
-        if (vocoder_amount < 0.5f) {
-            src_up_[0].Process(carrier, oversampled_carrier, size);
-            src_up_[1].Process(modulator, oversampled_modulator, size);
-            
-            float algorithm = min(parameters_.modulation_algorithm * 8.0f, 5.999f);
-            float previous_algorithm = min(
-                                           previous_parameters_.modulation_algorithm * 8.0f, 5.999f);
-            
-            MAKE_INTEGRAL_FRACTIONAL(algorithm);
-            MAKE_INTEGRAL_FRACTIONAL(previous_algorithm);
-            
-            if (algorithm_integral != previous_algorithm_integral) {
-                previous_algorithm_fractional = algorithm_fractional;
-            }
-            
-            (this->*xmod_table_[algorithm_integral])(
-                                                     previous_algorithm_fractional,
-                                                     algorithm_fractional,
-                                                     previous_parameters_.skewed_modulation_parameter(),
-                                                     parameters_.skewed_modulation_parameter(),
-                                                     oversampled_modulator,
-                                                     oversampled_carrier,
-                                                     oversampled_output,
-                                                     size * kOversampling);
-            
-            src_down_.Process(oversampled_output, main_output, size * kOversampling);
-        } else {
-            float release_time = 4.0f * (parameters_.modulation_algorithm - 0.75f);
-            CONSTRAIN(release_time, 0.0f, 1.0f);
-            
-            vocoder_.set_release_time(release_time * (2.0f - release_time));
-            vocoder_.set_formant_shift(parameters_.modulation_parameter);
-            vocoder_.set_limiter_pre_gain(parameters_.limiter_pre_gain);
-            vocoder_.Process(modulator, carrier, main_output, size);
-        }
-        
-        // Cross-fade to raw modulator for the transition between cross-modulation
-        // algorithms and vocoding algorithms.
-        float transition_gain = 2.0f * (vocoder_amount < 0.5f
-                                        ? vocoder_amount
-                                        : 1.0f - vocoder_amount);
-        if (transition_gain != 0.0f) {
-            for (size_t i = 0; i < size; ++i) {
-                main_output[i] += transition_gain * (modulator[i] - main_output[i]);
-            }
-        }
-        
-        // vb, remove hard clipping of outputs
-        while (size--) {
-            float main = *main_output;
-            float aux = *aux_output * 0.5;
-//            CONSTRAIN(main, -1.0f, 1.0f);
-//            CONSTRAIN(aux, -1.0f, 1.0f);
-            output->l = main;
-            output->r = aux;
-            ++main_output;
-            ++aux_output;
-            ++output;
-        }
-        
-        previous_parameters_ = parameters_;
-    }
-
-    
-    void Modulator::Processff(float** input, float** output, size_t size) {
-        if (bypass_) {
-            copy(&input[0][0], &input[0][size], &output[0][0]);
-            copy(&input[1][0], &input[1][size], &output[1][0]);
-            return;
-        } else if (easter_egg_) {
-            ProcessEasterEggff(input, output, size);
-            return;
-        }
-        float* carrier = buffer_[0];
-        float* modulator = buffer_[1];
-        float* main_output = buffer_[0];
-        float* aux_output = buffer_[2];
-        float* oversampled_carrier = src_buffer_[0];
-        float* oversampled_modulator = src_buffer_[1];
-        float* oversampled_output = src_buffer_[0];
-        
-        // 0.0: use cross-modulation algorithms. 1.0f: use vocoder.
-        float vocoder_amount = (
-                                parameters_.modulation_algorithm - 0.7f) * 20.0f + 0.5f;
-        CONSTRAIN(vocoder_amount, 0.0f, 1.0f);
-        
-        if (!parameters_.carrier_shape) {
-            fill(&aux_output[0], &aux_output[size], 0.0f);
-        }
-        
-        // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-        //short* input_samples = &input->l;
-        for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-            amplifier_[i].Processff(
-                                   parameters_.channel_drive[i],
-                                   1.0f - vocoder_amount,
-                                   input[i], //input_samples + i,
-                                   buffer_[i],
-                                   aux_output,
-                                   2,
-                                   size);
-        }
-        
-         // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
-         if (parameters_.carrier_shape) {
-             // Scale phase-modulation input.
-             for (size_t i = 0; i < size; ++i) {
-             internal_modulation_[i] = input[0][i];
-         }
-         // Xmod: sine, triangle saw.
-         // Vocoder: saw, pulse, noise.
-         OscillatorShape xmod_shape = static_cast<OscillatorShape>(
-         parameters_.carrier_shape - 1);
-         OscillatorShape vocoder_shape = static_cast<OscillatorShape>(
-         parameters_.carrier_shape + 1);
-         
-         const float kXmodCarrierGain = 0.5f;
-         
-         // Outside of the transition zone between the cross-modulation and vocoding
-         // algorithm, we need to render only one of the two oscillators.
-         if (vocoder_amount == 0.0f) {
-             xmod_oscillator_.Render(
-             xmod_shape,
-             parameters_.note,
-             internal_modulation_,
-             aux_output,
-             size);
-             for (size_t i = 0; i < size; ++i) {
-             carrier[i] = aux_output[i] * kXmodCarrierGain;
-             }
-         } else if (vocoder_amount >= 0.5f) {
-             float carrier_gain = vocoder_oscillator_.Render(
-             vocoder_shape,
-             parameters_.note,
-             internal_modulation_,
-             aux_output,
-             size);
-             for (size_t i = 0; i < size; ++i) {
-                 carrier[i] = aux_output[i] * carrier_gain;
-             }
-         } else {
-             float balance = vocoder_amount * 2.0f;
-             xmod_oscillator_.Render(
-             xmod_shape,
-             parameters_.note,
-             internal_modulation_,
-             carrier,
-             size);
-             float carrier_gain = vocoder_oscillator_.Render(
-             vocoder_shape,
-             parameters_.note,
-             internal_modulation_,
-             aux_output,
-             size);
-                 for (size_t i = 0; i < size; ++i) {
-                 float a = carrier[i];
-                 float b = aux_output[i];
-                 aux_output[i] = a + (b - a) * balance;
-                 a *= kXmodCarrierGain;
-                 b *= carrier_gain;
-                 carrier[i] = a + (b - a) * balance;
-                 }
-             }
-         }
-         
-         if (vocoder_amount < 0.5f) {
-             src_up_[0].Process(carrier, oversampled_carrier, size);
-             src_up_[1].Process(modulator, oversampled_modulator, size);
-             
-             float algorithm = min(parameters_.modulation_algorithm * 8.0f, 5.999f);
-             float previous_algorithm = min(
-             previous_parameters_.modulation_algorithm * 8.0f, 5.999f);
-             
-             MAKE_INTEGRAL_FRACTIONAL(algorithm);
-             MAKE_INTEGRAL_FRACTIONAL(previous_algorithm);
-             
-             if (algorithm_integral != previous_algorithm_integral) {
-                 previous_algorithm_fractional = algorithm_fractional;
-             }
-             
-             (this->*xmod_table_[algorithm_integral])(
-                 previous_algorithm_fractional,
-                 algorithm_fractional,
-                 previous_parameters_.skewed_modulation_parameter(),
-                 parameters_.skewed_modulation_parameter(),
-                 oversampled_modulator,
-                 oversampled_carrier,
-                 oversampled_output,
-                 size * kOversampling);
-             
-             src_down_.Process(oversampled_output, main_output, size * kOversampling);
-         } else {
-             float release_time = 4.0f * (parameters_.modulation_algorithm - 0.75f);
-             CONSTRAIN(release_time, 0.0f, 1.0f);
-             
-             vocoder_.set_release_time(release_time * (2.0f - release_time));
-             vocoder_.set_formant_shift(parameters_.modulation_parameter);
-             vocoder_.Process(modulator, carrier, main_output, size);
-         }
-         
-         // Cross-fade to raw modulator for the transition between cross-modulation
-         // algorithms and vocoding algorithms.
-         float transition_gain = 2.0f * (vocoder_amount < 0.5f
-         ? vocoder_amount
-         : 1.0f - vocoder_amount);
-         if (transition_gain != 0.0f) {
-             for (size_t i = 0; i < size; ++i) {
-                 main_output[i] += transition_gain * (modulator[i] - main_output[i]);
-             }
-         }
-        
-        // Convert back to integer and clip.
-        /*
-         while (size--) {
-         output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-         output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
-         ++main_output;
-         ++aux_output;
-         ++output;
-         }*/
-        for (int i=0; i<size; i++) {
-            float main = main_output[i];
-            float aux = aux_output[i] * 0.5f;
-            CONSTRAIN(main, -1.0, 1.0);
-            CONSTRAIN(aux, -1.0, 1.0);
-            output[0][i] = main;
-            output[1][i] = aux;
-        }
-        previous_parameters_ = parameters_;
-    }
-
-
 
 /* static */
 inline float Modulator::Diode(float x) {
@@ -1022,6 +476,111 @@ inline float Modulator::Xmod<ALGORITHM_NOP>(
   return modulator;
 }
 
+/* static */
+inline simd::Vector Modulator::Diode(simd::Vector x) {
+  simd::Vector sign = simd::Select(
+      simd::GreaterThan(x, simd::Splat(0.0f)),
+      simd::Splat(1.0f),
+      simd::Splat(-1.0f));
+  simd::Vector dead_zone = simd::Sub(simd::Abs(x), simd::Splat(0.667f));
+  dead_zone = simd::Add(dead_zone, simd::Abs(dead_zone));
+  dead_zone = simd::Mul(dead_zone, dead_zone);
+  return simd::Mul(
+      simd::Mul(simd::Splat(0.04324765822726063f), dead_zone), sign);
+}
+
+// Same operations as the scalar Xmod<>, in the same order, on 4 samples.
+
+/* static */
+template<>
+inline simd::Vector Modulator::XmodVector<ALGORITHM_FOLD>(
+    simd::Vector x_1, simd::Vector x_2, simd::Vector parameter) {
+  simd::Vector sum = simd::Splat(0.0f);
+  sum = simd::Add(sum, x_1);
+  sum = simd::Add(sum, x_2);
+  sum = simd::Add(sum, simd::Mul(simd::Mul(x_1, x_2), simd::Splat(0.25f)));
+  sum = simd::Mul(sum, simd::Add(simd::Splat(0.02f), parameter));
+  
+  // The wavefolder table lookups are done lane by lane.
+  const float kScale = 2048.0f / ((1.0f + 1.0f + 0.25f) * 1.02f);
+  float s[simd::kWidth];
+  simd::Store(s, sum);
+  for (size_t i = 0; i < simd::kWidth; ++i) {
+    s[i] = Interpolate(lut_bipolar_fold + 2048, s[i], kScale);
+  }
+  return simd::Load(s);
+}
+
+/* static */
+template<>
+inline simd::Vector Modulator::XmodVector<ALGORITHM_ANALOG_RING_MODULATION>(
+    simd::Vector modulator, simd::Vector carrier, simd::Vector parameter) {
+  carrier = simd::Mul(carrier, simd::Splat(2.0f));
+  simd::Vector ring = simd::Add(
+      Diode(simd::Add(modulator, carrier)),
+      Diode(simd::Sub(modulator, carrier)));
+  ring = simd::Mul(ring, simd::Add(
+      simd::Splat(4.0f), simd::Mul(parameter, simd::Splat(24.0f))));
+  
+  // SoftLimit()
+  simd::Vector ring_2 = simd::Mul(ring, ring);
+  return simd::Div(
+      simd::Mul(ring, simd::Add(simd::Splat(27.0f), ring_2)),
+      simd::Add(
+          simd::Splat(27.0f),
+          simd::Mul(simd::Mul(simd::Splat(9.0f), ring), ring)));
+}
+
+/* static */
+template<>
+inline simd::Vector Modulator::XmodVector<ALGORITHM_DIGITAL_RING_MODULATION>(
+    simd::Vector x_1, simd::Vector x_2, simd::Vector parameter) {
+  simd::Vector ring = simd::Mul(
+      simd::Mul(simd::Mul(simd::Splat(4.0f), x_1), x_2),
+      simd::Add(simd::Splat(1.0f), simd::Mul(parameter, simd::Splat(8.0f))));
+  return simd::Div(ring, simd::Add(simd::Splat(1.0f), simd::Abs(ring)));
+}
+
+/* static */
+template<>
+inline simd::Vector Modulator::XmodVector<ALGORITHM_COMPARATOR>(
+    simd::Vector modulator, simd::Vector carrier, simd::Vector parameter) {
+  simd::Vector x = simd::Mul(parameter, simd::Splat(2.995f));
+  
+  // x is in [0, 3), its integral part is found with two comparisons.
+  simd::Vector below_1 = simd::GreaterThan(simd::Splat(1.0f), x);
+  simd::Vector below_2 = simd::GreaterThan(simd::Splat(2.0f), x);
+  simd::Vector x_integral = simd::Select(
+      below_1,
+      simd::Splat(0.0f),
+      simd::Select(below_2, simd::Splat(1.0f), simd::Splat(2.0f)));
+  simd::Vector x_fractional = simd::Sub(x, x_integral);
+  
+  simd::Vector abs_modulator = simd::Abs(modulator);
+  simd::Vector abs_carrier = simd::Abs(carrier);
+  simd::Vector louder = simd::GreaterThan(abs_modulator, abs_carrier);
+  simd::Vector direct = simd::Select(
+      simd::GreaterThan(carrier, modulator), modulator, carrier);
+  simd::Vector window = simd::Select(louder, modulator, carrier);
+  simd::Vector window_2 = simd::Select(
+      louder, abs_modulator, simd::Mul(abs_carrier, simd::Splat(-1.0f)));
+  simd::Vector threshold = simd::Select(
+      simd::GreaterThan(carrier, simd::Splat(0.05f)), carrier, modulator);
+  
+  simd::Vector a = simd::Select(
+      below_1, direct, simd::Select(below_2, threshold, window));
+  simd::Vector b = simd::Select(
+      below_1, threshold, simd::Select(below_2, window, window_2));
+  return simd::Add(a, simd::Mul(simd::Sub(b, a), x_fractional));
+}
+
+/* static */
+template<>
+inline simd::Vector Modulator::XmodVector<ALGORITHM_NOP>(
+    simd::Vector modulator, simd::Vector carrier, simd::Vector parameter) {
+  return modulator;
+}
+
 /* static */
 Modulator::XmodFn Modulator::xmod_table_[] = {
   &Modulator::ProcessXmod<ALGORITHM_XFADE, ALGORITHM_FOLD>,
@@ -1033,4 +592,125 @@ Modulator::XmodFn Modulator::xmod_table_[] = {
   &Modulator::ProcessXmod<ALGORITHM_COMPARATOR, ALGORITHM_NOP>,
 };
 
+int32_t Modulator::ChooseXmodRatio(
+    int32_t algorithm,
+    const XmodBlock& xmod) {
+  if (oversampling_ != kOversamplingAuto) {
+    return oversampling_;
+  }
+  
+  // Each of the two algorithms between which the block cross-fades counts,
+  // unless its weight stays at 0 for the whole block.
+  float parameter = max(xmod.parameter, xmod.parameter_end);
+  int32_t ratio = 1;
+  if (xmod.balance < 1.0f || xmod.balance_end < 1.0f) {
+    ratio = max(ratio, XmodRatio(
+        static_cast<XmodAlgorithm>(algorithm), parameter));
+  }
+  if (xmod.balance > 0.0f || xmod.balance_end > 0.0f) {
+    ratio = max(ratio, XmodRatio(
+        static_cast<XmodAlgorithm>(algorithm + 1), parameter));
+  }
+  
+  // Go up at once, but only go down once the lower ratio has been enough
+  // for a while (about 80ms at 48kHz), so that a modulated parameter
+  // doesn't keep switching back and forth.
+  const int32_t kHoldBlocks = 64;
+  if (ratio >= xmod_ratio_) {
+    xmod_ratio_hold_ = kHoldBlocks;
+  } else if (xmod_ratio_hold_) {
+    --xmod_ratio_hold_;
+    ratio = xmod_ratio_;
+  }
+  return ratio;
+}
+
+/* static */
+int32_t Modulator::XmodRatio(XmodAlgorithm algorithm, float parameter) {
+  switch (algorithm) {
+    case ALGORITHM_XFADE:
+    case ALGORITHM_NOP:
+      // Linear.
+      return 1;
+      
+    case ALGORITHM_FOLD:
+      // Close to linear as long as the signal stays in the middle of the
+      // folding table.
+      return parameter < 0.2f ? 2 : (parameter < 0.5f ? 4 : 6);
+      
+    case ALGORITHM_ANALOG_RING_MODULATION:
+    case ALGORITHM_DIGITAL_RING_MODULATION:
+      // Products of the two inputs, soft-limited harder and harder.
+      return parameter < 0.5f ? 4 : 6;
+      
+    default:
+      // xor and comparator have hard edges at any setting.
+      return 6;
+  }
+}
+
+void Modulator::RenderXmod(
+    int32_t ratio,
+    const XmodBlock& xmod,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  switch (ratio) {
+    case 6:
+      RenderXmod(&oversampler_6x_, xmod, modulator, carrier, out, size);
+      break;
+    case 4:
+      RenderXmod(&oversampler_4x_, xmod, modulator, carrier, out, size);
+      break;
+    case 2:
+      RenderXmod(&oversampler_2x_, xmod, modulator, carrier, out, size);
+      break;
+    default:
+      (this->*xmod.fn)(
+          xmod.balance,
+          xmod.balance_end,
+          xmod.parameter,
+          xmod.parameter_end,
+          modulator,
+          carrier,
+          out,
+          size);
+      break;
+  }
+}
+
+template<typename O>
+void Modulator::RenderXmod(
+    O* oversampler,
+    const XmodBlock& xmod,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  float* oversampled_carrier = src_buffer_[0];
+  float* oversampled_modulator = src_buffer_[1];
+  float* oversampled_output = src_buffer_[0];
+
+  oversampler->up[0].Process(carrier, oversampled_carrier, size);
+  oversampler->up[1].Process(modulator, oversampled_modulator, size);
+  (this->*xmod.fn)(
+      xmod.balance,
+      xmod.balance_end,
+      xmod.parameter,
+      xmod.parameter_end,
+      oversampled_modulator,
+      oversampled_carrier,
+      oversampled_output,
+      size * O::RATIO);
+  oversampler->down.Process(oversampled_output, out, size * O::RATIO);
+}
+
+/* explicit instantiations */
+template void Modulator::Process<ShortFrameIO>(
+    ShortFrame*, ShortFrame*, size_t);
+template void Modulator::Process<FloatFrameIO>(
+    FloatFrame*, FloatFrame*, size_t);
+template void Modulator::Process<PlanarIO>(float**, float**, size_t);
+
 }  // namespace warps
@@ -32,6 +32,9 @@
 #include "stmlib/stmlib.h"
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/parameter_interpolator.h"
+#include "stmlib/dsp/simd.h"
+
+#include <algorithm>
 
 #include "warps/dsp/oscillator.h"
 #include "warps/dsp/parameters.h"
@@ -43,13 +46,90 @@
 
 namespace warps {
 
+namespace simd = stmlib::simd;
+
 const size_t kMaxBlockSize = 96;
-const size_t kOversampling = 6;
+const size_t kOversampling = 6;  // Highest ratio, and the default one.
+const int32_t kOversamplingAuto = 0;
 const size_t kNumOscillators = 1;
 
 typedef struct { short l; short r; } ShortFrame;
 typedef struct { float l; float r; } FloatFrame;
 
+inline float ToFloat(short x) { return static_cast<float>(x) / 32768.0f; }
+inline float ToFloat(float x) { return x; }
+
+// I/O formats of the modulator. Each one says where the samples of a channel
+// are, how outputs are written back, and which of the vb behaviours it gets.
+
+// Interleaved 16-bit frames, as on the hardware.
+struct ShortFrameIO {
+  typedef ShortFrame* Buffer;
+  typedef short Sample;
+  static const size_t kStride = 2;
+  // Hardware: no VCA on the carrier input when the internal oscillator is
+  // used, phase modulation taken from the raw input.
+  static const bool kAmplifyBothInputs = false;
+  static const bool kVocoderPreGain = false;
+
+  static inline const Sample* Channel(Buffer b, int32_t c) {
+    return &b->l + c;
+  }
+  static inline void Write(Buffer b, size_t i, float main, float aux) {
+    b[i].l = stmlib::Clip16(static_cast<int32_t>(main * 32768.0f));
+    b[i].r = stmlib::Clip16(static_cast<int32_t>(aux * 32768.0f));
+  }
+  static inline void Copy(Buffer in, Buffer out, size_t size) {
+    std::copy(&in[0], &in[size], &out[0]);
+  }
+};
+
+// Interleaved float frames (wrps~).
+struct FloatFrameIO {
+  typedef FloatFrame* Buffer;
+  typedef float Sample;
+  static const size_t kStride = 2;
+  // vb, level 1 also sets the amount of phase modulation of the internal
+  // oscillator, and the vocoder limiter gain is a parameter.
+  static const bool kAmplifyBothInputs = true;
+  static const bool kVocoderPreGain = true;
+
+  static inline const Sample* Channel(Buffer b, int32_t c) {
+    return &b->l + c;
+  }
+  // vb, no hard clipping of the outputs.
+  static inline void Write(Buffer b, size_t i, float main, float aux) {
+    b[i].l = main;
+    b[i].r = aux;
+  }
+  static inline void Copy(Buffer in, Buffer out, size_t size) {
+    std::copy(&in[0], &in[size], &out[0]);
+  }
+};
+
+// One float array per channel.
+struct PlanarIO {
+  typedef float** Buffer;
+  typedef float Sample;
+  static const size_t kStride = 1;
+  static const bool kAmplifyBothInputs = false;
+  static const bool kVocoderPreGain = false;
+
+  static inline const Sample* Channel(Buffer b, int32_t c) {
+    return b[c];
+  }
+  static inline void Write(Buffer b, size_t i, float main, float aux) {
+    CONSTRAIN(main, -1.0f, 1.0f);
+    CONSTRAIN(aux, -1.0f, 1.0f);
+    b[0][i] = main;
+    b[1][i] = aux;
+  }
+  static inline void Copy(Buffer in, Buffer out, size_t size) {
+    std::copy(&in[0][0], &in[0][size], &out[0][0]);
+    std::copy(&in[1][0], &in[1][size], &out[1][0]);
+  }
+};
+
 class SaturatingAmplifier {
  public:
   SaturatingAmplifier() { }
@@ -58,10 +138,11 @@ class SaturatingAmplifier {
     drive_ = 0.0f;
   }
   
+  template<typename T>
   void Process(
       float drive,
       float limit,
-      short* in,
+      const T* in,
       float* out,
       float* out_raw,
       size_t in_stride,
@@ -70,7 +151,7 @@ class SaturatingAmplifier {
     stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
     float level = level_;
     for (size_t i = 0; i < size; ++i) {
-      float s = static_cast<float>(*in) / 32768.0f;
+      float s = ToFloat(*in);
       float error = s * s - level;
       level += error * (error > 0.0f ? 0.1f: 0.0001f);
       s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
@@ -103,99 +184,6 @@ class SaturatingAmplifier {
       out[i] = pre + (post - pre) * limit;
     }
   }
-    
-    void Processf(
-                 float drive,
-                 float limit,
-                 float* in,
-                 float* out,
-                 float* out_raw,
-                 size_t in_stride,
-                 size_t size) {
-        // Process noise gate and compute raw output
-        stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
-        float level = level_;
-        for (size_t i = 0; i < size; ++i) {
-            float s = *in;
-            float error = s * s - level;
-            level += error * (error > 0.0f ? 0.1f: 0.0001f);
-            s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
-            out[i] = s;
-            out_raw[i] += s * drive_modulation.Next();
-            in += in_stride;
-        }
-        level_ = level;
-        
-        // Process overdrive / gain
-        float drive_2 = drive * drive;
-        float pre_gain_a = drive * 0.5f;
-        float pre_gain_b = drive_2 * drive_2 * drive * 24.0f;
-        float pre_gain = pre_gain_a + (pre_gain_b - pre_gain_a) * drive_2;
-        float drive_squished = drive * (2.0f - drive);
-        float post_gain = 1.0f / stmlib::SoftClip(
-                                                  0.33f + drive_squished * (pre_gain - 0.33f));
-        stmlib::ParameterInterpolator pre_gain_modulation(
-                                                          &pre_gain_,
-                                                          pre_gain,
-                                                          size);
-        stmlib::ParameterInterpolator post_gain_modulation(
-                                                           &post_gain_,
-                                                           post_gain,
-                                                           size);
-        
-        for (size_t i = 0; i < size; ++i) {
-            float pre = pre_gain_modulation.Next() * out[i];
-            float post = stmlib::SoftClip(pre) * post_gain_modulation.Next();
-            out[i] = pre + (post - pre) * limit;
-        }
-    }
-    
-    void Processff(
-                 float drive,
-                 float limit,
-                 float* in,
-                 float* out,
-                 float* out_raw,
-                 size_t in_stride,
-                 size_t size) {
-        // Process noise gate and compute raw output
-        stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
-        float level = level_;
-        for (size_t i = 0; i < size; ++i) {
-            float s = in[i];
-            float error = s * s - level;
-            level += error * (error > 0.0f ? 0.1f: 0.0001f);
-            s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
-            out[i] = s;
-            out_raw[i] += s * drive_modulation.Next();
-            //in += in_stride;
-        }
-        level_ = level;
-        
-        // Process overdrive / gain
-        float drive_2 = drive * drive;
-        float pre_gain_a = drive * 0.5f;
-        float pre_gain_b = drive_2 * drive_2 * drive * 24.0f;
-        float pre_gain = pre_gain_a + (pre_gain_b - pre_gain_a) * drive_2;
-        float drive_squished = drive * (2.0f - drive);
-        float post_gain = 1.0f / stmlib::SoftClip(
-                                                  0.33f + drive_squished * (pre_gain - 0.33f));
-        stmlib::ParameterInterpolator pre_gain_modulation(
-                                                          &pre_gain_,
-                                                          pre_gain,
-                                                          size);
-        stmlib::ParameterInterpolator post_gain_modulation(
-                                                           &post_gain_,
-                                                           post_gain,
-                                                           size);
-        
-        for (size_t i = 0; i < size; ++i) {
-            float pre = pre_gain_modulation.Next() * out[i];
-            float post = stmlib::SoftClip(pre) * post_gain_modulation.Next();
-            out[i] = pre + (post - pre) * limit;
-        }
-         
-    }
 
  private:
   float level_;
@@ -207,6 +195,23 @@ class SaturatingAmplifier {
   DISALLOW_COPY_AND_ASSIGN(SaturatingAmplifier);
 };
 
+// Up and down converters for one oversampling ratio.
+template<int32_t ratio, int32_t filter_size>
+struct Oversampler {
+  enum {
+    RATIO = ratio
+  };
+
+  void Init() {
+    up[0].Init();
+    up[1].Init();
+    down.Init();
+  }
+
+  SampleRateConverter<SRC_UP, ratio, filter_size> up[2];
+  SampleRateConverter<SRC_DOWN, ratio, filter_size> down;
+};
+
 enum XmodAlgorithm {
   ALGORITHM_XFADE,
   ALGORITHM_FOLD,
@@ -234,12 +239,23 @@ class Modulator {
   ~Modulator() { }
 
   void Init(float sample_rate);
-  void Process(ShortFrame* input, ShortFrame* output, size_t size);
-  void Processf(FloatFrame* input, FloatFrame* output, size_t size);
-  void Processff(float** input, float** output, size_t size);
-  void ProcessEasterEgg(ShortFrame* input, ShortFrame* output, size_t size);
-  void ProcessEasterEggf(FloatFrame* input, FloatFrame* output, size_t size);
-  void ProcessEasterEggff(float** input, float** output, size_t size);
+
+  // One kernel for all the I/O formats, see ShortFrameIO, FloatFrameIO and
+  // PlanarIO.
+  template<typename IO>
+  void Process(typename IO::Buffer input, typename IO::Buffer output,
+               size_t size);
+
+  inline void Process(ShortFrame* input, ShortFrame* output, size_t size) {
+    Process<ShortFrameIO>(input, output, size);
+  }
+  inline void Processf(FloatFrame* input, FloatFrame* output, size_t size) {
+    Process<FloatFrameIO>(input, output, size);
+  }
+  inline void Processff(float** input, float** output, size_t size) {
+    Process<PlanarIO>(input, output, size);
+  }
+
   inline Parameters* mutable_parameters() { return &parameters_; }
   inline const Parameters& parameters() { return parameters_; }
   
@@ -248,9 +264,53 @@ class Modulator {
 
   inline bool easter_egg() const { return easter_egg_; }
   inline void set_easter_egg(bool easter_egg) { easter_egg_ = easter_egg; }
+
+  // Oversampling ratio of the cross-modulation algorithms: 1, 2, 4 or 6, or
+  // kOversamplingAuto to pick, block by block, the lowest ratio that the
+  // algorithm and its parameter need.
+  void set_oversampling(int32_t oversampling);
+  inline int32_t oversampling() const { return oversampling_; }
+  inline int32_t xmod_ratio() const { return xmod_ratio_; }
+  
+  // Number of vocoder bands: kNumBands (third octaves, like the hardware), or
+  // kMaxNumBands (sixth octaves) for anything above.
+  inline void set_vocoder_bands(int32_t num_bands) {
+    vocoder_.set_num_bands(num_bands);
+  }
+  inline int32_t vocoder_bands() const { return vocoder_.num_bands(); }
     
   
  private:
+  template<typename IO>
+  void ProcessEasterEgg(typename IO::Buffer input, typename IO::Buffer output,
+                        size_t size);
+
+  struct XmodBlock {
+    XmodFn fn;
+    float balance;
+    float balance_end;
+    float parameter;
+    float parameter_end;
+  };
+
+  int32_t ChooseXmodRatio(int32_t algorithm, const XmodBlock& xmod);
+  void RenderXmod(
+      int32_t ratio,
+      const XmodBlock& xmod,
+      const float* modulator,
+      const float* carrier,
+      float* out,
+      size_t size);
+  template<typename O>
+  void RenderXmod(
+      O* oversampler,
+      const XmodBlock& xmod,
+      const float* modulator,
+      const float* carrier,
+      float* out,
+      size_t size);
+  static int32_t XmodRatio(XmodAlgorithm algorithm, float parameter);
+
   template<XmodAlgorithm algorithm_1, XmodAlgorithm algorithm_2>
   void ProcessXmod(
       float balance,
@@ -264,44 +324,61 @@ class Modulator {
     float step = 1.0f / static_cast<float>(size);
     float parameter_increment = (parameter_end - parameter) * step;
     float balance_increment = (balance_end - balance) * step; 
-    while (size) {
-      {
-        const float x_1 = *in_1++;
-        const float x_2 = *in_2++;
-        float a = Xmod<algorithm_1>(x_1, x_2, parameter);
-        float b = Xmod<algorithm_2>(x_1, x_2, parameter);
-        *out++ = a + (b - a) * balance;
-        parameter += parameter_increment;
-        balance += balance_increment;
-        size--;
-      }
-      {
-        const float x_1 = *in_1++;
-        const float x_2 = *in_2++;
-        float a = Xmod<algorithm_1>(x_1, x_2, parameter);
-        float b = Xmod<algorithm_2>(x_1, x_2, parameter);
-        *out++ = a + (b - a) * balance;
-        parameter += parameter_increment;
-        balance += balance_increment;
-        size--;
-      }
-      {
-        const float x_1 = *in_1++;
-        const float x_2 = *in_2++;
-        float a = Xmod<algorithm_1>(x_1, x_2, parameter);
-        float b = Xmod<algorithm_2>(x_1, x_2, parameter);
-        *out++ = a + (b - a) * balance;
+
+    // The ramps are accumulated one sample at a time, as in the scalar
+    // loop, the rest runs on simd::kWidth samples at once.
+    float p[simd::kWidth];
+    float m[simd::kWidth];
+    while (size >= simd::kWidth) {
+      for (size_t i = 0; i < simd::kWidth; ++i) {
+        p[i] = parameter;
+        m[i] = balance;
         parameter += parameter_increment;
         balance += balance_increment;
-        size--;
       }
+      const simd::Vector x_1 = simd::Load(in_1);
+      const simd::Vector x_2 = simd::Load(in_2);
+      const simd::Vector parameters = simd::Load(p);
+      simd::Vector a = XmodVector<algorithm_1>(x_1, x_2, parameters);
+      simd::Vector b = XmodVector<algorithm_2>(x_1, x_2, parameters);
+      simd::Store(out, simd::Add(a, simd::Mul(simd::Sub(b, a), simd::Load(m))));
+      in_1 += simd::kWidth;
+      in_2 += simd::kWidth;
+      out += simd::kWidth;
+      size -= simd::kWidth;
+    }
+    while (size--) {
+      const float x_1 = *in_1++;
+      const float x_2 = *in_2++;
+      float a = Xmod<algorithm_1>(x_1, x_2, parameter);
+      float b = Xmod<algorithm_2>(x_1, x_2, parameter);
+      *out++ = a + (b - a) * balance;
+      parameter += parameter_increment;
+      balance += balance_increment;
     }
   }
   
   template<XmodAlgorithm algorithm>
   static float Xmod(float x_1, float x_2, float parameter);
+
+  // Lane by lane unless specialized.
+  template<XmodAlgorithm algorithm>
+  static inline simd::Vector XmodVector(
+      simd::Vector x_1, simd::Vector x_2, simd::Vector parameter) {
+    float a[simd::kWidth];
+    float b[simd::kWidth];
+    float p[simd::kWidth];
+    simd::Store(a, x_1);
+    simd::Store(b, x_2);
+    simd::Store(p, parameter);
+    for (size_t i = 0; i < simd::kWidth; ++i) {
+      a[i] = Xmod<algorithm>(a[i], b[i], p[i]);
+    }
+    return simd::Load(a);
+  }
   
   static float Diode(float x);
+  static simd::Vector Diode(simd::Vector x);
   
   bool bypass_;
   bool easter_egg_;
@@ -314,8 +391,12 @@ class Modulator {
   Oscillator vocoder_oscillator_;
   QuadratureOscillator quadrature_oscillator_;
   
-  SampleRateConverter<SRC_UP, kOversampling, 48> src_up_[2];
-  SampleRateConverter<SRC_DOWN, kOversampling, 48> src_down_;
+  int32_t oversampling_;
+  int32_t xmod_ratio_;
+  int32_t xmod_ratio_hold_;
+  Oversampler<6, 48> oversampler_6x_;
+  Oversampler<4, 48> oversampler_4x_;
+  Oversampler<2, 32> oversampler_2x_;
 
   Vocoder vocoder_;
   QuadratureTransform quadrature_transform_[2];
@@ -323,6 +404,7 @@ class Modulator {
   float internal_modulation_[kMaxBlockSize];
   float buffer_[3][kMaxBlockSize];
   float src_buffer_[2][kMaxBlockSize * kOversampling];
+  float fade_buffer_[kMaxBlockSize];
 
   float feedback_sample_;
   
@@ -131,6 +131,36 @@ struct SRC_FIR<SRC_DOWN, 3, 36> {
   }
 };
 
+// Generated with:
+// 2 * kaiser-windowed sinc, 32 taps, cutoff 0.5 / 2, beta 6.76
+template<>
+struct SRC_FIR<SRC_UP, 2, 32> {
+  template<int32_t i> inline float Read() const {
+    const float h[] = {
+      -2.150408360e-04, -6.950378309e-04,  1.569015681e-03,  3.006357735e-03,
+      -5.213313659e-03, -8.438304777e-03,  1.298313890e-02,  1.922687969e-02,
+      -2.767582206e-02, -3.906871892e-02,  5.460754431e-02,  7.650740562e-02,
+      -1.094998322e-01, -1.659510908e-01,  2.914506454e-01,  8.974061737e-01,
+    };
+    return h[i];
+  }
+};
+
+// Generated with:
+// 1 * kaiser-windowed sinc, 32 taps, cutoff 0.5 / 2, beta 6.76
+template<>
+struct SRC_FIR<SRC_DOWN, 2, 32> {
+  template<int32_t i> inline float Read() const {
+    const float h[] = {
+      -1.075204180e-04, -3.475189154e-04,  7.845078404e-04,  1.503178867e-03,
+      -2.606656830e-03, -4.219152388e-03,  6.491569451e-03,  9.613439846e-03,
+      -1.383791103e-02, -1.953435946e-02,  2.730377216e-02,  3.825370281e-02,
+      -5.474991608e-02, -8.297554541e-02,  1.457253227e-01,  4.487030869e-01,
+    };
+    return h[i];
+  }
+};
+
 }  // namespace warps
 
 #endif  // WARPS_DSP_SAMPLE_RATE_CONVERSION_FILTERS_H_
@@ -39,24 +39,33 @@ using namespace std;
 using namespace stmlib;
 
 void Vocoder::Init(float sample_rate) {
-  modulator_filter_bank_.Init(sample_rate);
-  carrier_filter_bank_.Init(sample_rate);
+  sample_rate_ = sample_rate;
   limiter_.Init();
 
   release_time_ = 0.5f;
   formant_shift_ = 0.5f;
   
-  BandGain zero;
-  zero.carrier = 0.0f;
-  zero.vocoder = 0.0f;
-  fill(&previous_gain_[0], &previous_gain_[kNumBands], zero);
-  fill(&gain_[0], &gain_[kNumBands], zero);
-  
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    follower_[i].Init();
-  }
+  InitBands(kNumBands);
+  requested_num_bands_ = kNumBands;
     
     limiter_pre_gain_ = 1.4f;       // vb
+  
+  delayed_ = false;
+  fifo_in_size_ = 0;
+  fifo_out_size_ = 0;
+}
+
+void Vocoder::InitBands(int32_t num_bands) {
+  num_bands_ = num_bands;
+  modulator_filter_bank_.Init(sample_rate_, num_bands);
+  carrier_filter_bank_.Init(sample_rate_, num_bands);
+  
+  fill(&previous_carrier_gain_[0], &previous_carrier_gain_[kMaxNumLanes], 0.0f);
+  fill(&previous_vocoder_gain_[0], &previous_vocoder_gain_[kMaxNumLanes], 0.0f);
+  fill(&carrier_gain_[0], &carrier_gain_[kMaxNumLanes], 0.0f);
+  fill(&vocoder_gain_[0], &vocoder_gain_[kMaxNumLanes], 0.0f);
+  
+  followers_.Init(sqrtf(num_bands));
 }
 
 void Vocoder::Process(
@@ -64,19 +73,82 @@ void Vocoder::Process(
     const float* carrier,
     float* out,
     size_t size) {
+  if (requested_num_bands_ != num_bands_) {
+    InitBands(requested_num_bands_);
+  }
+  
+  if (!delayed_) {
+    if (size % kVocoderGranularity == 0) {
+      ProcessBlock(modulator, carrier, out, size);
+      return;
+    }
+    delayed_ = true;
+    fill(&fifo_out_[0], &fifo_out_[kVocoderLatency], 0.0f);
+    fifo_out_size_ = kVocoderLatency;
+  }
+  
+  // There are never more than kVocoderLatency samples in both FIFOs, the
+  // output FIFO always holds enough samples once the input has been run.
+  copy(&modulator[0], &modulator[size], &fifo_in_[0][fifo_in_size_]);
+  copy(&carrier[0], &carrier[size], &fifo_in_[1][fifo_in_size_]);
+  fifo_in_size_ += size;
+  
+  size_t block_size = fifo_in_size_ - fifo_in_size_ % kVocoderGranularity;
+  if (block_size) {
+    ProcessBlock(
+        fifo_in_[0],
+        fifo_in_[1],
+        &fifo_out_[fifo_out_size_],
+        block_size);
+    fifo_out_size_ += block_size;
+    fifo_in_size_ -= block_size;
+    copy(
+        &fifo_in_[0][block_size],
+        &fifo_in_[0][block_size + fifo_in_size_],
+        &fifo_in_[0][0]);
+    copy(
+        &fifo_in_[1][block_size],
+        &fifo_in_[1][block_size + fifo_in_size_],
+        &fifo_in_[1][0]);
+  }
+  
+  copy(&fifo_out_[0], &fifo_out_[size], &out[0]);
+  fifo_out_size_ -= size;
+  copy(&fifo_out_[size], &fifo_out_[size + fifo_out_size_], &fifo_out_[0]);
+}
+
+void Vocoder::ProcessBlock(
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
   // Run through filter banks.
   modulator_filter_bank_.Analyze(modulator, size);
   carrier_filter_bank_.Analyze(carrier, size);
   
+  // The band peaks are smoothed once per block.
+  float peak_attack = 0.5f;
+  float peak_decay = 0.1f;
+  if (size != kVocoderReferenceBlockSize) {
+    float blocks = static_cast<float>(size) / kVocoderReferenceBlockSize;
+    peak_attack = 1.0f - powf(1.0f - peak_attack, blocks);
+    peak_decay = 1.0f - powf(1.0f - peak_decay, blocks);
+  }
+  
   // Set the attack/release release_time of envelope followers.
+  const float band_ratio = num_bands_ == kNumBands
+      ? 1.2599f  // 2 ** (4/12.0), a third octave.
+      : 1.12246f;  // 2 ** (2/12.0), a sixth octave.
   float f = 80.0f * SemitonesToRatio(-72.0f * release_time_);
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    float decay = f / modulator_filter_bank_.band(i).sample_rate;
-    follower_[i].set_attack(decay * 2.0f);
-    follower_[i].set_decay(decay * 0.5f);
-    follower_[i].set_freeze(release_time_ > 0.995f);
-    f *= 1.2599f;  // 2 ** (4/12.0), a third octave.
+  for (int32_t i = 0; i < num_bands_; ++i) {
+    const Band& b = modulator_filter_bank_.band(i);
+    float decay = f / b.sample_rate;
+    followers_.set_attack(b.lane, decay * 2.0f);
+    followers_.set_decay(b.lane, decay * 0.5f);
+    f *= band_ratio;
   }
+  followers_.set_peak_coefficients(peak_attack, peak_decay);
+  followers_.set_freeze(release_time_ > 0.995f);
   
   // Compute the amplitude (or modulation amount) in all bands.
   float formant_shift_amount = 2.0f * fabs(formant_shift_ - 0.5f);
@@ -84,46 +156,70 @@ void Vocoder::Process(
   formant_shift_amount *= (2.0f - formant_shift_amount);
   float envelope_increment = 4.0f * SemitonesToRatio(-48.0f * formant_shift_);
   float envelope = 0.0f;
-  const float kLastBand = kNumBands - 1.0001f;
-  for (int32_t i = 0; i < kNumBands; ++i) {
+  const float kLastBand = num_bands_ - 1.0001f;
+  const float attenuation_slope = static_cast<float>(kNumBands) / num_bands_;
+  for (int32_t i = 0; i < num_bands_; ++i) {
     float source_band = envelope;
     CONSTRAIN(source_band, 0.0f, kLastBand);
     MAKE_INTEGRAL_FRACTIONAL(source_band);
-    float a = follower_[source_band_integral].peak();
-    float b = follower_[source_band_integral + 1].peak();
+    float a = followers_.peak(
+        modulator_filter_bank_.band(source_band_integral).lane);
+    float b = followers_.peak(
+        modulator_filter_bank_.band(source_band_integral + 1).lane);
     float band_gain = (a + (b - a) * source_band_fractional);
     float attenuation = envelope - kLastBand;
     if (attenuation >= 0.0f) {
-      band_gain *= 1.0f / (1.0f + 1.0f * attenuation);
+      band_gain *= 1.0f / (1.0f + attenuation_slope * attenuation);
     }
     envelope += envelope_increment;
 
-    gain_[i].carrier = band_gain * formant_shift_amount;
-    gain_[i].vocoder = 1.0f - formant_shift_amount;
+    int32_t lane = modulator_filter_bank_.band(i).lane;
+    carrier_gain_[lane] = band_gain * formant_shift_amount;
+    vocoder_gain_[lane] = 1.0f - formant_shift_amount;
   }
-        
-  for (int32_t i = 0; i < kNumBands; ++i) {
-    size_t band_size = size / modulator_filter_bank_.band(i).decimation_factor;
-    const float step = 1.0f / static_cast<float>(band_size);
-
-    float* carrier = carrier_filter_bank_.band(i).samples;
-    float* modulator = modulator_filter_bank_.band(i).samples;
-    float* envelope = tmp_;
-
-    follower_[i].Process(modulator, envelope, band_size);
+  
+  // Follow the modulator bands and apply the gains to the carrier bands, four
+  // lanes at a time.
+  for (int32_t i = 0; i < kNumBandGroups; ++i) {
+    const BandGroup& m = modulator_filter_bank_.group(i);
+    const BandGroup& c = carrier_filter_bank_.group(i);
+    size_t group_size = size / c.decimation_factor;
+    const simd::Vector step = simd::Splat(
+        1.0f / static_cast<float>(group_size));
     
-    float vocoder_gain = previous_gain_[i].vocoder;
-    float vocoder_gain_increment = (gain_[i].vocoder - vocoder_gain) * step;
-    float carrier_gain = previous_gain_[i].carrier;
-    float carrier_gain_increment = (gain_[i].carrier - carrier_gain) * step;
-    for (size_t j = 0; j < band_size; ++j) {
-      carrier[j] *= (carrier_gain + vocoder_gain * envelope[j]);
-      vocoder_gain += vocoder_gain_increment;
-      carrier_gain += carrier_gain_increment;
+    for (int32_t lane = 0; lane < c.num_lanes; lane += simd::kWidth) {
+      const int32_t l = c.first_lane + lane;
+      float* carrier = c.samples + lane;
+      float* envelope = tmp_;
+      
+      followers_.Process(
+          l, m.samples + lane, m.num_lanes, envelope, group_size);
+      
+      simd::Vector vocoder_gain = simd::Load(&previous_vocoder_gain_[l]);
+      simd::Vector vocoder_gain_increment = simd::Mul(
+          simd::Sub(simd::Load(&vocoder_gain_[l]), vocoder_gain), step);
+      simd::Vector carrier_gain = simd::Load(&previous_carrier_gain_[l]);
+      simd::Vector carrier_gain_increment = simd::Mul(
+          simd::Sub(simd::Load(&carrier_gain_[l]), carrier_gain), step);
+      for (size_t j = 0; j < group_size; ++j) {
+        float* frame = carrier + j * c.num_lanes;
+        simd::Vector gain = simd::Add(
+            carrier_gain,
+            simd::Mul(vocoder_gain, simd::Load(envelope + j * simd::kWidth)));
+        simd::Store(frame, simd::Mul(simd::Load(frame), gain));
+        vocoder_gain = simd::Add(vocoder_gain, vocoder_gain_increment);
+        carrier_gain = simd::Add(carrier_gain, carrier_gain_increment);
+      }
     }
-    
-    previous_gain_[i] = gain_[i];
   }
+  copy(
+      &carrier_gain_[0],
+      &carrier_gain_[kMaxNumLanes],
+      &previous_carrier_gain_[0]);
+  copy(
+      &vocoder_gain_[0],
+      &vocoder_gain_[kMaxNumLanes],
+      &previous_vocoder_gain_[0]);
 
   carrier_filter_bank_.Synthesize(out, size);
 //  limiter_.Process(out, 1.4f, size);
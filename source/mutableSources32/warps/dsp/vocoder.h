@@ -31,70 +31,104 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
+
+#include "stmlib/dsp/simd.h"
+
 #include "warps/dsp/filter_bank.h"
 #include "warps/dsp/limiter.h"
 
 namespace warps {
 
-const float kFollowerGain = sqrtf(kNumBands);
+// The filter bank decimates the lowest bands by 12, blocks have to be a
+// multiple of that. Other sizes go through a FIFO, with that much latency.
+const size_t kVocoderGranularity = 12;
+const size_t kVocoderLatency = kVocoderGranularity - 1;
+
+// Block size of the hardware, which the band peak smoothing was tuned for.
+const size_t kVocoderReferenceBlockSize = 60;
 
-class EnvelopeFollower {
+// One envelope follower per filter bank lane, four processed at once.
+class EnvelopeFollowerBank {
  public:
-  EnvelopeFollower() { }
-  ~EnvelopeFollower() { }
+  EnvelopeFollowerBank() { }
+  ~EnvelopeFollowerBank() { }
   
-  void Init() {
-    envelope_ = 0.0f;
+  void Init(float gain) {
+    gain_ = gain;
     freeze_ = false;
-    attack_ = decay_ = 0.1f;
-    peak_ = 0.0f;
+    peak_attack_ = 0.5f;
+    peak_decay_ = 0.1f;
+    std::fill(&attack_[0], &attack_[kMaxNumLanes], 0.1f);
+    std::fill(&decay_[0], &decay_[kMaxNumLanes], 0.1f);
+    std::fill(&envelope_[0], &envelope_[kMaxNumLanes], 0.0f);
+    std::fill(&peak_[0], &peak_[kMaxNumLanes], 0.0f);
   };
   
-  void set_attack(float attack) {
-    attack_ = attack;
+  void set_attack(int32_t lane, float attack) {
+    attack_[lane] = attack;
+  }
+  
+  void set_decay(int32_t lane, float decay) {
+    decay_[lane] = decay;
   }
   
-  void set_decay(float decay) {
-    decay_ = decay;
+  void set_peak_coefficients(float attack, float decay) {
+    peak_attack_ = attack;
+    peak_decay_ = decay;
   }
   
   void set_freeze(bool freeze) {
     freeze_ = freeze;
   }
   
-  void Process(const float* in, float* out, size_t size) {
-    float envelope = envelope_;
-    float attack = freeze_ ? 0.0f : attack_;
-    float decay = freeze_ ? 0.0f : decay_;
-    float peak = 0.0f;
-    while (size--) {
-      float error = fabs(*in++ * kFollowerGain) - envelope;
-      envelope += (error > 0.0f ? attack : decay) * error;
-      if (envelope > peak) {
-        peak = envelope;
-      }
-      *out++ = envelope;
+  // Lanes i to i + simd::kWidth - 1, reading interleaved frames of in. The
+  // envelopes are written as vectors: out[j * simd::kWidth + k] for lane
+  // i + k.
+  void Process(
+      int32_t i,
+      const float* in,
+      size_t stride,
+      float* out,
+      size_t size) {
+    using namespace stmlib::simd;
+    const Vector zero = Splat(0.0f);
+    const Vector gain = Splat(gain_);
+    Vector envelope = Load(&envelope_[i]);
+    Vector attack = freeze_ ? zero : Load(&attack_[i]);
+    Vector decay = freeze_ ? zero : Load(&decay_[i]);
+    Vector peak = zero;
+    for (size_t j = 0; j < size; ++j) {
+      Vector error = Sub(Abs(Mul(Load(in + j * stride), gain)), envelope);
+      Vector rising = GreaterThan(error, zero);
+      envelope = Add(envelope, Mul(Select(rising, attack, decay), error));
+      peak = Select(GreaterThan(envelope, peak), envelope, peak);
+      Store(out + j * kWidth, envelope);
     }
-    envelope_ = envelope;
-    float error = peak - peak_;
-    peak_ += (error > 0.0f ? 0.5f : 0.1f) * error;
+    Store(&envelope_[i], envelope);
+    
+    Vector previous_peak = Load(&peak_[i]);
+    Vector error = Sub(peak, previous_peak);
+    Vector coefficient = Select(
+        GreaterThan(error, zero),
+        Splat(peak_attack_),
+        Splat(peak_decay_));
+    Store(&peak_[i], Add(previous_peak, Mul(coefficient, error)));
   }
   
-  inline float peak() const { return peak_; }
+  inline float peak(int32_t lane) const { return peak_[lane]; }
   
  private:
-  float attack_;
-  float decay_;
-  float envelope_;
-  float peak_;
-  float freeze_;
+  float gain_;
+  bool freeze_;
+  float peak_attack_;
+  float peak_decay_;
+  float attack_[kMaxNumLanes];
+  float decay_[kMaxNumLanes];
+  float envelope_[kMaxNumLanes];
+  float peak_[kMaxNumLanes];
   
-  DISALLOW_COPY_AND_ASSIGN(EnvelopeFollower);
-};
-
-struct BandGain {
-  float carrier;
-  float vocoder;
+  DISALLOW_COPY_AND_ASSIGN(EnvelopeFollowerBank);
 };
 
 class Vocoder {
@@ -103,6 +137,10 @@ class Vocoder {
   ~Vocoder() { }
   
   void Init(float sample_rate);
+  
+  // Any size up to kMaxFilterBankBlockSize. Once a size which is not a
+  // multiple of kVocoderGranularity has been seen, the output is delayed by
+  // kVocoderLatency samples.
   void Process(
       const float* modulator,
       const float* carrier,
@@ -120,21 +158,48 @@ class Vocoder {
     void set_limiter_pre_gain(float gain) {
         limiter_pre_gain_ = gain * 1.4f;
     }
+  
+  // kNumBands, or kMaxNumBands for anything above. Taken into account at the
+  // next block, which starts from silent bands.
+  void set_num_bands(int32_t num_bands) {
+    requested_num_bands_ = num_bands > kNumBands ? kMaxNumBands : kNumBands;
+  }
+  
+  inline int32_t num_bands() const { return requested_num_bands_; }
 
  private:
+  void InitBands(int32_t num_bands);
+  void ProcessBlock(
+      const float* modulator,
+      const float* carrier,
+      float* out,
+      size_t size);
+  
+  float sample_rate_;
+  int32_t num_bands_;
+  int32_t requested_num_bands_;
   float release_time_;
   float formant_shift_;
     float limiter_pre_gain_;    // vb
   
-  BandGain previous_gain_[kNumBands];
-  BandGain gain_[kNumBands];
+  // Per lane.
+  float previous_carrier_gain_[kMaxNumLanes];
+  float previous_vocoder_gain_[kMaxNumLanes];
+  float carrier_gain_[kMaxNumLanes];
+  float vocoder_gain_[kMaxNumLanes];
 
-  float tmp_[kMaxFilterBankBlockSize];
+  float tmp_[kMaxFilterBankBlockSize * stmlib::simd::kWidth];
+  
+  bool delayed_;
+  size_t fifo_in_size_;
+  size_t fifo_out_size_;
+  float fifo_in_[2][kMaxFilterBankBlockSize + kVocoderGranularity];
+  float fifo_out_[kMaxFilterBankBlockSize + kVocoderGranularity];
    
   FilterBank modulator_filter_bank_;
   FilterBank carrier_filter_bank_;
   Limiter limiter_;
-  EnvelopeFollower follower_[kNumBands];
+  EnvelopeFollowerBank followers_;
   
   DISALLOW_COPY_AND_ASSIGN(Vocoder);
 };
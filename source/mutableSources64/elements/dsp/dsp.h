@@ -39,21 +39,26 @@ namespace elements {
 const size_t kMaxBlockSize = 16;   
 
     
+// vb, sample rate context. Each Part owns its copy and hands it down to
+// the voices, so instances can run at different rates side by side.
 class Dsp {
-    private:
-        static double kSampleRate;
-        static double kSrFactor;
-        static double kIntervalCorrection;
-        
     public:
-        static double getSr() { return kSampleRate; }
-        static double getSrFactor() { return kSrFactor; }
-        static double getIntervalCorrection() { return kIntervalCorrection; }
-        static void setSr(double newsr) {
+        Dsp() { setSr(32000.0); }
+        explicit Dsp(real_t newsr) { setSr(newsr); }
+        
+        real_t getSr() const { return kSampleRate; }
+        real_t getSrFactor() const { return kSrFactor; }
+        real_t getIntervalCorrection() const { return kIntervalCorrection; }
+        void setSr(real_t newsr) {
             kSampleRate = newsr;
             kSrFactor = 32000.0 / kSampleRate;
             kIntervalCorrection = log(kSrFactor)/log(2.0)*12.0;
         }
+        
+    private:
+        real_t kSampleRate;
+        real_t kSrFactor;
+        real_t kIntervalCorrection;
     };
 
 }  // namespace elements
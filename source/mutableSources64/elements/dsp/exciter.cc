@@ -41,7 +41,8 @@ namespace elements {
 using namespace std;
 using namespace stmlib;
 
-void Exciter::Init() {
+void Exciter::Init(const Dsp& dsp) {
+  sr_ = dsp.getSr();
   set_model(EXCITER_MODEL_MALLET);
   set_parameter(0.0);
   set_timbre(0.99);
@@ -55,12 +56,12 @@ void Exciter::Init() {
   signature_ = 0.0;
 }
 
-double Exciter::GetPulseAmplitude(double cutoff) {
+real_t Exciter::GetPulseAmplitude(real_t cutoff) {
   uint32_t cutoff_index = static_cast<uint32_t>(cutoff * 256.0);
   return lut_approx_svf_gain[cutoff_index];
 }
 
-void Exciter::Process(const uint8_t flags, double* out, size_t size) {
+void Exciter::Process(const uint8_t flags, real_t* out, size_t size) {
   damping_ = 0.0;
   (this->*fn_table_[model_])(flags, out, size);
   // Apply filters.
@@ -83,7 +84,7 @@ void Exciter::Process(const uint8_t flags, double* out, size_t size) {
 }
 
 void Exciter::ProcessGranularSamplePlayer(
-    const uint8_t flags, double* out, size_t size) {
+    const uint8_t flags, real_t* out, size_t size) {
   const uint32_t restart_prob = uint32_t(0.01 * 4294967296.0);
   const uint32_t restart_point = uint32_t(parameter_ * 32767.0) << 17;
   const uint32_t phase_increment = static_cast<uint32_t>(
@@ -94,9 +95,9 @@ void Exciter::ProcessGranularSamplePlayer(
   uint32_t phase = phase_;
   while (size--) {
     uint32_t phase_integral = phase >> 17;
-    double phase_fractional = static_cast<double>(phase & 0x1fff) / 131072.0;
-    double a = static_cast<double>(base[phase_integral]);
-    double b = static_cast<double>(base[phase_integral + 1]);
+    real_t phase_fractional = static_cast<real_t>(phase & 0x1fff) / 131072.0;
+    real_t a = static_cast<real_t>(base[phase_integral]);
+    real_t b = static_cast<real_t>(base[phase_integral + 1]);
     *out++ = (a + (b - a) * phase_fractional) / 32768.0;
     phase += phase_increment;
     if (Random::GetWord() < restart_prob) {
@@ -108,8 +109,8 @@ void Exciter::ProcessGranularSamplePlayer(
 }
 
 void Exciter::ProcessSamplePlayer(
-    const uint8_t flags, double* out, size_t size) {
-  double index = (1.0 - parameter_) * 8.0;
+    const uint8_t flags, real_t* out, size_t size) {
+  real_t index = (1.0 - parameter_) * 8.0;
   MAKE_INTEGRAL_FRACTIONAL(index);
   if (index_integral == 8) {
     index_integral = 7;
@@ -123,7 +124,7 @@ void Exciter::ProcessSamplePlayer(
   const uint32_t phase_increment = static_cast<uint32_t>(
       65536.0 * SemitonesToRatio(72.0 * timbre_ - 36.0 + 7.0));
   
-  double damp = damp_state_;
+  real_t damp = damp_state_;
   uint32_t phase = phase_;
 
   if (flags & EXCITER_FLAG_RISING_EDGE) {
@@ -136,21 +137,21 @@ void Exciter::ProcessSamplePlayer(
   
   while (size--) {
     uint32_t phase_integral = phase >> 16;
-    double phase_fractional = static_cast<double>(phase & 0xffff) / 65536.0;
-    double sample_1 = 0.0;
-    double sample_2 = 0.0;
+    real_t phase_fractional = static_cast<real_t>(phase & 0xffff) / 65536.0;
+    real_t sample_1 = 0.0;
+    real_t sample_2 = 0.0;
     bool step = false;
     if (phase_integral < length_1) {
       const int16_t* base = &smp_sample_data[offset_1 + phase_integral];
-      double a = static_cast<double>(base[0]);
-      double b = static_cast<double>(base[1]);
+      real_t a = static_cast<real_t>(base[0]);
+      real_t b = static_cast<real_t>(base[1]);
       sample_1 = a + (b - a) * phase_fractional;
       step = true;
     }
     if (phase_integral < length_2) {
       const int16_t* base = &smp_sample_data[offset_2 + phase_integral];
-      double a = static_cast<double>(base[0]);
-      double b = static_cast<double>(base[1]);
+      real_t a = static_cast<real_t>(base[0]);
+      real_t b = static_cast<real_t>(base[1]);
       sample_2 = a + (b - a) * phase_fractional;
       step = true;
     }
@@ -165,7 +166,7 @@ void Exciter::ProcessSamplePlayer(
   damp_state_ = damp;
 }
 
-void Exciter::ProcessMallet(const uint8_t flags, double* out, size_t size) {
+void Exciter::ProcessMallet(const uint8_t flags, real_t* out, size_t size) {
   fill(&out[0], &out[size], 0.0);
   if (flags & EXCITER_FLAG_RISING_EDGE) {
     damp_state_ = 0.0;
@@ -179,11 +180,11 @@ void Exciter::ProcessMallet(const uint8_t flags, double* out, size_t size) {
 
 void Exciter::ProcessPlectrum(
     const uint8_t flags,
-    double* out,
+    real_t* out,
     size_t size) {
-  double amplitude = GetPulseAmplitude(timbre_);
-  double damp = damp_state_;
-  double impulse = 0.0;
+  real_t amplitude = GetPulseAmplitude(timbre_);
+  real_t damp = damp_state_;
+  real_t impulse = 0.0;
   if (flags & EXCITER_FLAG_RISING_EDGE) {
     impulse = -amplitude * (0.05 + signature_ * 0.2);
     plectrum_delay_ = static_cast<uint32_t>(
@@ -208,7 +209,7 @@ void Exciter::ProcessPlectrum(
 
 void Exciter::ProcessParticles(
     const uint8_t flags,
-    double* out,
+    real_t* out,
     size_t size) {
   if (flags & EXCITER_FLAG_RISING_EDGE) {
     particle_state_ = RandomSample();
@@ -220,10 +221,10 @@ void Exciter::ProcessParticles(
   if (flags & EXCITER_FLAG_GATE) {
     const uint32_t up_probability = uint32_t(0.7 * 4294967296.0);
     const uint32_t down_probability = uint32_t(0.3 * 4294967296.0);
-    const double amplitude = GetPulseAmplitude(timbre_);
+    const real_t amplitude = GetPulseAmplitude(timbre_);
     while (size--) {
       if (delay_ == 0) {
-        double amount = RandomSample();
+        real_t amount = RandomSample();
         amount = 1.05 + 0.5 * amount * amount;
         if (Random::GetWord() > up_probability) {
           particle_state_ *= amount;
@@ -236,12 +237,12 @@ void Exciter::ProcessParticles(
             particle_state_ = 0.02;
           }
         }
-          delay_ = static_cast<uint32_t>(particle_state_ * 0.15 * Dsp::getSr());
-        double gain = 1.0 - particle_range_;
+          delay_ = static_cast<uint32_t>(particle_state_ * 0.15 * sr_);
+        real_t gain = 1.0 - particle_range_;
         gain *= gain;
         *out = particle_state_ * amplitude * (1.0 - gain);
         
-        double decay_factor = 1.0 - parameter_;
+        real_t decay_factor = 1.0 - parameter_;
         particle_range_ *= 1.0 - decay_factor * decay_factor * 0.5;
       } else {
         --delay_;
@@ -253,15 +254,15 @@ void Exciter::ProcessParticles(
 
 void Exciter::ProcessFlow(
     const uint8_t flags,
-    double* out,
+    real_t* out,
     size_t size) {
-  double scale = parameter_ * parameter_ * parameter_ * parameter_;
-  double threshold = 0.0001 + scale * 0.125;
+  real_t scale = parameter_ * parameter_ * parameter_ * parameter_;
+  real_t threshold = 0.0001 + scale * 0.125;
   if (flags & EXCITER_FLAG_RISING_EDGE) {
     particle_state_ = 0.5;
   }
   while (size--) {
-    double sample = RandomSample();
+    real_t sample = RandomSample();
     if (sample < threshold) {
       particle_state_ = -particle_state_;
     }
@@ -269,7 +270,7 @@ void Exciter::ProcessFlow(
   }
 }
 
-void Exciter::ProcessNoise(const uint8_t flags, double* out, size_t size) {
+void Exciter::ProcessNoise(const uint8_t flags, real_t* out, size_t size) {
   while (size--) {
     *out++ = RandomSample() - 0.5;
   }
@@ -34,6 +34,8 @@
 #include "stmlib/dsp/filter.h"
 #include "stmlib/utils/random.h"
 
+#include "elements/dsp/dsp.h"
+
 namespace elements {
 
 enum ExciterModel {
@@ -54,14 +56,14 @@ enum ExciterFlags {
 
 class Exciter {
  public:
-  typedef void (Exciter::*ProcessFn)(const uint8_t, double*, size_t);
+  typedef void (Exciter::*ProcessFn)(const uint8_t, real_t*, size_t);
    
   Exciter() { }
   ~Exciter() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   
-  inline void set_signature(double signature) {
+  inline void set_signature(real_t signature) {
     signature_ = signature;
   }
   
@@ -69,16 +71,16 @@ class Exciter {
     model_ = model;
   }
   
-  inline void set_parameter(double parameter) {
+  inline void set_parameter(real_t parameter) {
     parameter_ = parameter;
   }
   
-  inline void set_timbre(double timbre) {
+  inline void set_timbre(real_t timbre) {
     timbre_ = timbre;
   }
   
-  inline void set_meta(double meta, ExciterModel first, ExciterModel last) {
-    meta *= static_cast<double>(last - first + 1);
+  inline void set_meta(real_t meta, ExciterModel first, ExciterModel last) {
+    meta *= static_cast<real_t>(last - first + 1);
     MAKE_INTEGRAL_FRACTIONAL(meta);
     model_ = static_cast<ExciterModel>(first + meta_integral);
     parameter_ = meta_fractional;
@@ -87,39 +89,40 @@ class Exciter {
     }
   }
   
-  inline double damping() const {
+  inline real_t damping() const {
     return damping_;
   }
   
   inline const stmlib::Svf& filter() const { return lp_; }
   
-  void Process(const uint8_t flags, double* out, size_t n);
-  void ProcessGranularSamplePlayer(const uint8_t, double*, size_t);
-  void ProcessSamplePlayer(const uint8_t, double*, size_t);
-  void ProcessMallet(const uint8_t, double*, size_t);
-  void ProcessPlectrum(const uint8_t, double*, size_t);
-  void ProcessParticles(const uint8_t, double*, size_t);
-  void ProcessFlow(const uint8_t, double*, size_t);
-  void ProcessNoise(const uint8_t, double*, size_t);
+  void Process(const uint8_t flags, real_t* out, size_t n);
+  void ProcessGranularSamplePlayer(const uint8_t, real_t*, size_t);
+  void ProcessSamplePlayer(const uint8_t, real_t*, size_t);
+  void ProcessMallet(const uint8_t, real_t*, size_t);
+  void ProcessPlectrum(const uint8_t, real_t*, size_t);
+  void ProcessParticles(const uint8_t, real_t*, size_t);
+  void ProcessFlow(const uint8_t, real_t*, size_t);
+  void ProcessNoise(const uint8_t, real_t*, size_t);
   
  private:
-  double GetPulseAmplitude(double cutoff);
+  real_t GetPulseAmplitude(real_t cutoff);
 
-  inline double RandomSample() const {
+  inline real_t RandomSample() const {
     //return static_cast<double>(stmlib::Random::GetWord()) / 4294967296.0;
       return stmlib::Random::GetDouble();   // vb
   }
 
+  real_t sr_;
   ExciterModel model_;
-  double parameter_;
-  double timbre_;
+  real_t parameter_;
+  real_t timbre_;
   
   stmlib::Svf lp_;
-  double damp_state_;
-  double particle_state_;
-  double particle_range_;
-  double damping_;
-  double signature_;
+  real_t damp_state_;
+  real_t particle_state_;
+  real_t particle_range_;
+  real_t damping_;
+  real_t signature_;
   uint32_t phase_;
   uint32_t delay_;
   uint32_t plectrum_delay_;
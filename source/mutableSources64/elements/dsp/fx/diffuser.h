@@ -44,7 +44,7 @@ class Diffuser {
     engine_.Init(buffer);
   }
   
-  void Process(double* in_out, size_t size) {
+  void Process(real_t* in_out, size_t size) {
     typedef E::Reserve<126,
       E::Reserve<180,
       E::Reserve<269,
@@ -54,7 +54,7 @@ class Diffuser {
     E::DelayLine<Memory, 2> ap3;
     E::DelayLine<Memory, 3> ap4;
     E::Context c;
-    const double kap = 0.625;
+    const real_t kap = 0.625;
     while (size--) {
       engine_.Start(&c);
       c.Read(*in_out);
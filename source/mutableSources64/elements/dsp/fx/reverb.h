@@ -49,7 +49,7 @@ class Reverb {
     diffusion_ = 0.625;
   }
   
-  void Process(double* left, double* right, size_t size) {
+  void Process(real_t* left, real_t* right, size_t size) {
     // This is the Griesinger topology described in the Dattorro paper
     // (4 AP diffusers on the input, then a loop of 2x 2AP+1Delay).
     // Modulation is applied in the loop of the first diffuser AP for additional
@@ -76,18 +76,18 @@ class Reverb {
     E::DelayLine<Memory, 9> del2;
     E::Context c;
 
-    const double kap = diffusion_;
-    const double klp = lp_;
-    const double krt = reverb_time_;
-    const double amount = amount_;
-    const double gain = input_gain_;
+    const real_t kap = diffusion_;
+    const real_t klp = lp_;
+    const real_t krt = reverb_time_;
+    const real_t amount = amount_;
+    const real_t gain = input_gain_;
 
-    double lp_1 = lp_decay_1_;
-    double lp_2 = lp_decay_2_;
+    real_t lp_1 = lp_decay_1_;
+    real_t lp_2 = lp_decay_2_;
 
     while (size--) {
-      double wet;
-      double apout = 0.0;
+      real_t wet;
+      real_t apout = 0.0;
       engine_.Start(&c);
       
       // Smear AP1 inside the loop.
@@ -141,23 +141,23 @@ class Reverb {
     lp_decay_2_ = lp_2;
   }
   
-  inline void set_amount(double amount) {
+  inline void set_amount(real_t amount) {
     amount_ = amount;
   }
   
-  inline void set_input_gain(double input_gain) {
+  inline void set_input_gain(real_t input_gain) {
     input_gain_ = input_gain;
   }
 
-  inline void set_time(double reverb_time) {
+  inline void set_time(real_t reverb_time) {
     reverb_time_ = reverb_time;
   }
   
-  inline void set_diffusion(double diffusion) {
+  inline void set_diffusion(real_t diffusion) {
     diffusion_ = diffusion;
   }
   
-  inline void set_lp(double lp) {
+  inline void set_lp(real_t lp) {
     lp_ = lp;
   }
   
@@ -165,14 +165,14 @@ class Reverb {
   typedef FxEngine<32768, FORMAT_16_BIT> E;
   E engine_;
   
-  double amount_;
-  double input_gain_;
-  double reverb_time_;
-  double diffusion_;
-  double lp_;
+  real_t amount_;
+  real_t input_gain_;
+  real_t reverb_time_;
+  real_t diffusion_;
+  real_t lp_;
   
-  double lp_decay_1_;
-  double lp_decay_2_;
+  real_t lp_decay_1_;
+  real_t lp_decay_2_;
   
   DISALLOW_COPY_AND_ASSIGN(Reverb);
 };
@@ -59,7 +59,7 @@ class MultistageEnvelope {
   void Init();
     
     // TODO: envelope process doesn't work ? .. segment_ goes up to 3
-  inline double Process(uint8_t flags) {
+  inline real_t Process(uint8_t flags) {
     if (flags & ENVELOPE_FLAG_RISING_EDGE) {
       start_value_ = (segment_ == num_segments_ || hard_reset_)
           ? level_[0]
@@ -85,12 +85,12 @@ class MultistageEnvelope {
     bool sustained = sustain_point_ && segment_ == sustain_point_ &&
         flags & ENVELOPE_FLAG_GATE;
   
-    double phase_increment = 0.0;
+    real_t phase_increment = 0.0;
     if (!sustained && !done) {
       phase_increment = Interpolate8(lut_env_increments, time_[segment_]);
     }
 
-    double t = Interpolate8(
+    real_t t = Interpolate8(
         lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]],
         phase_);
     phase_ += phase_increment;
@@ -99,17 +99,17 @@ class MultistageEnvelope {
     return value_;
   }
 
-  inline void Process(const uint8_t* flags_in, double* out, size_t size) {
+  inline void Process(const uint8_t* flags_in, real_t* out, size_t size) {
     while (size--) {
       *out++ = Process(*flags_in++);
     }
   }
 
-  inline void set_time(uint16_t segment, double time) {
+  inline void set_time(uint16_t segment, real_t time) {
     time_[segment] = time;
   }
   
-  inline void set_level(uint16_t segment, double level) {
+  inline void set_level(uint16_t segment, real_t level) {
     level_[segment] = level;
   }
   
@@ -117,15 +117,15 @@ class MultistageEnvelope {
     num_segments_ = num_segments;
   }
   
-  inline void set_sustain_point(double sustain_point) {
+  inline void set_sustain_point(real_t sustain_point) {
     sustain_point_ = sustain_point;
   }
   
   inline void set_adsr(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 3;
     sustain_point_ = 2;
 
@@ -145,7 +145,7 @@ class MultistageEnvelope {
     loop_start_ = loop_end_ = 0;
   }
   
-  inline void set_ad(double attack, double decay) {
+  inline void set_ad(real_t attack, real_t decay) {
     num_segments_ = 2;
     sustain_point_ = 0;
 
@@ -163,10 +163,10 @@ class MultistageEnvelope {
   }
   
   inline void set_adr(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 3;
     sustain_point_ = 0;
 
@@ -186,7 +186,7 @@ class MultistageEnvelope {
     loop_start_ = loop_end_ = 0;
   }
   
-  inline void set_ar(double attack, double decay) {
+  inline void set_ar(real_t attack, real_t decay) {
     num_segments_ = 2;
     sustain_point_ = 1;
 
@@ -204,10 +204,10 @@ class MultistageEnvelope {
   }
   
   inline void set_adsar(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 4;
     sustain_point_ = 2;
 
@@ -231,10 +231,10 @@ class MultistageEnvelope {
   }
   
   inline void set_adar(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 4;
     sustain_point_ = 0;
 
@@ -257,7 +257,7 @@ class MultistageEnvelope {
     loop_start_ = loop_end_ = 0;
   }
   
-  inline void set_ad_loop(double attack, double decay) {
+  inline void set_ad_loop(real_t attack, real_t decay) {
     num_segments_ = 2;
     sustain_point_ = 0;
 
@@ -276,10 +276,10 @@ class MultistageEnvelope {
   }
   
   inline void set_adr_loop(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 3;
     sustain_point_ = 0;
 
@@ -301,10 +301,10 @@ class MultistageEnvelope {
   }
   
   inline void set_adar_loop(
-      double attack,
-      double decay,
-      double sustain,
-      double release) {
+      real_t attack,
+      real_t decay,
+      real_t sustain,
+      real_t release) {
     num_segments_ = 4;
     sustain_point_ = 0;
 
@@ -333,24 +333,24 @@ class MultistageEnvelope {
   }
   
  private:
-  inline double Interpolate8(const double* table, double index) const {
+  inline real_t Interpolate8(const real_t* table, real_t index) const {
     index *= 256.0;
     size_t integral = static_cast<size_t>(index);
-    double fractional = index - static_cast<double>(integral);
-    double a = table[integral];
-    double b = table[integral + 1];
+    real_t fractional = index - static_cast<real_t>(integral);
+    real_t a = table[integral];
+    real_t b = table[integral + 1];
     return a + (b - a) * fractional;
   }
 
-  double level_[kMaxNumSegments];
-  double time_[kMaxNumSegments];
+  real_t level_[kMaxNumSegments];
+  real_t time_[kMaxNumSegments];
   EnvelopeShape shape_[kMaxNumSegments];
   
   int16_t segment_;
-  double start_value_;
-  double value_;
+  real_t start_value_;
+  real_t value_;
 
-  double phase_;
+  real_t phase_;
   
   uint16_t num_segments_;
   uint16_t sustain_point_;
@@ -37,7 +37,7 @@ using namespace std;
 using namespace stmlib;
 
 // scipy.signal.remez(101, [0, 0.3 / 8, 0.495 / 8, 0.5], [1, 0]);
-const double kDownsamplingFilter[] = {
+const real_t kDownsamplingFilter[] = {
   -0.001859272945,  0.001184937535,  0.001212413444,  0.001369688661,
    0.001555406705,  0.001685761819,  0.001692922383,  0.001526182555,
    0.001157229282,  0.000582212588, -0.000172916131, -0.001054896973,
@@ -66,7 +66,7 @@ const double kDownsamplingFilter[] = {
   -0.001859272945,
 };
 
-void Spatializer::Init(double fixed_position) {
+void Spatializer::Init(real_t fixed_position) {
   angle_ = 0.0;
   fixed_position_ = fixed_position;
   left_ = 0.0;
@@ -77,36 +77,36 @@ void Spatializer::Init(double fixed_position) {
 }
   
 void Spatializer::Process(
-    double* source,
-    double* center,
-    double* sides,
+    real_t* source,
+    real_t* center,
+    real_t* sides,
     size_t size) {
   behind_filter_.Process<FILTER_MODE_LOW_PASS>(source, behind_, size, 1);
  
-  double angle = angle_;
-  double x = distance_ * stmlib::InterpolateWrap(
+  real_t angle = angle_;
+  real_t x = distance_ * stmlib::InterpolateWrap(
       lut_sine, angle, 4096.0);
-  double y = distance_ * stmlib::InterpolateWrap(
+  real_t y = distance_ * stmlib::InterpolateWrap(
       lut_sine, angle + 0.25, 4096.0);
-  double backfront = (1.0 + y) * 0.5 * distance_;
+  real_t backfront = (1.0 + y) * 0.5 * distance_;
   x += fixed_position_ * (1.0 - distance_);
 
-  double target_left = stmlib::InterpolateWrap(
+  real_t target_left = stmlib::InterpolateWrap(
       lut_sine, (1.0 + x) * 0.125, 4096.0);
-  double target_right = stmlib::InterpolateWrap(
+  real_t target_right = stmlib::InterpolateWrap(
       lut_sine, (3.0 + x) * 0.125, 4096.0);
 
   // Prevent zipper noise during rendering.
-  double step = 1.0 / static_cast<double>(size);
-  double left_increment = (target_left - left_) * step;
-  double right_increment = (target_right - right_) * step;
+  real_t step = 1.0 / static_cast<real_t>(size);
+  real_t left_increment = (target_left - left_) * step;
+  real_t right_increment = (target_right - right_) * step;
 
   for (size_t i = 0; i < size; ++i) {
     left_ += left_increment;
     right_ += right_increment;
-    double y = source[i] + backfront * (behind_[i] - source[i]);
-    double l = left_ * y;
-    double r = right_ * y;
+    real_t y = source[i] + backfront * (behind_[i] - source[i]);
+    real_t l = left_ * y;
+    real_t r = right_ * y;
     center[i] += (l + r) * 0.5;
     sides[i] += (l - r) * 0.5 / 0.7;
   }
@@ -114,15 +114,15 @@ void Spatializer::Process(
 
 
 void FmOscillator::Process(
-    double frequency,
-    double ratio,
-    double feedback_amount,
-    double target_fm_amount,
-    const double* external_fm,
-    double* destination,
+    real_t frequency,
+    real_t ratio,
+    real_t feedback_amount,
+    real_t target_fm_amount,
+    const real_t* external_fm,
+    real_t* destination,
     size_t size) {
     
-    frequency += Dsp::getIntervalCorrection();   // vb, pitch correction
+    frequency += interval_correction_;   // vb, pitch correction
     
   ratio = Interpolate(lut_fm_frequency_quantizer, ratio, 128.0);
     
@@ -133,16 +133,16 @@ void FmOscillator::Process(
   uint32_t phase_mod = phase_mod_;
 
   // Linear interpolation on FM amount parameter.
-  double step = 1.0 / static_cast<double>(size);
-  double fm_amount = fm_amount_;
-  double fm_amount_increment = (target_fm_amount - fm_amount) * step;
-  double previous_sample = previous_sample_;
+  real_t step = 1.0 / static_cast<real_t>(size);
+  real_t fm_amount = fm_amount_;
+  real_t fm_amount_increment = (target_fm_amount - fm_amount) * step;
+  real_t previous_sample = previous_sample_;
   
   // To prevent aliasing, reduce FM amount when frequency or feedback are
   // too high.
-  double brightness = frequency + ratio * 0.75 - 60.0 + \
+  real_t brightness = frequency + ratio * 0.75 - 60.0 + \
       feedback_amount * 24.0;
-  double amount_attenuation = brightness <= 0.0
+  real_t amount_attenuation = brightness <= 0.0
       ? 1.0
       : 1.0 - brightness * brightness * 0.0015;
   if (amount_attenuation < 0.0) {
@@ -153,7 +153,7 @@ void FmOscillator::Process(
     fm_amount += fm_amount_increment;
     phase_carrier += inc_carrier;
     phase_mod += inc_mod;
-    double mod = SineFm(phase_mod, feedback_amount * previous_sample);
+    real_t mod = SineFm(phase_mod, feedback_amount * previous_sample);
     destination[i] = previous_sample = SineFm(
         phase_carrier,
         amount_attenuation * (mod * fm_amount + external_fm[i]));
@@ -166,7 +166,8 @@ void FmOscillator::Process(
 }
 
 
-void OminousVoice::Init() {
+void OminousVoice::Init(const Dsp& dsp) {
+  sr_factor_ = dsp.getSrFactor();
   envelope_.Init();
   envelope_.set_adsr(0.5, 0.5, 0.5, 0.5);
   previous_gate_ = false;
@@ -174,7 +175,7 @@ void OminousVoice::Init() {
   
   for (size_t i = 0; i < kNumOscillators; ++i) {
     external_fm_state_[i] = 0.0;
-    oscillator_[i].Init();
+    oscillator_[i].Init(dsp);
 
     // Downsampling is done mostly by the FIR, but since the stopband
     // attenuation peaks at -48dB, we can get a few extra dB of attenution with
@@ -198,53 +199,53 @@ void OminousVoice::Init() {
 
 void OminousVoice::ConfigureEnvelope(const Patch& patch) {
   if (patch.exciter_envelope_shape < 0.4) {
-    double a = 0.0;
-    double dr = (patch.exciter_envelope_shape * 0.625 + 0.2) * 1.8;
+    real_t a = 0.0;
+    real_t dr = (patch.exciter_envelope_shape * 0.625 + 0.2) * 1.8;
     envelope_.set_adsr(a, dr, 0.0, dr);
   } else if (patch.exciter_envelope_shape < 0.6) {
-    double s = (patch.exciter_envelope_shape - 0.4) * 5.0;
+    real_t s = (patch.exciter_envelope_shape - 0.4) * 5.0;
     envelope_.set_adsr(0.0, 0.80, s, 0.80);
   } else {
-    double a = 0.0;
-    double dr = ((1.0 - patch.exciter_envelope_shape) * 0.75 + 0.15) * 1.8;
+    real_t a = 0.0;
+    real_t dr = ((1.0 - patch.exciter_envelope_shape) * 0.75 + 0.15) * 1.8;
     envelope_.set_adsr(a, dr, 1.0, dr);
   }
 }
 
 void OminousVoice::Process(
     const Patch& patch,
-    double frequency,
-    double strength,
+    real_t frequency,
+    real_t strength,
     const bool gate_in,
-    const double* blow_in,
-    const double* strike_in,
-    double* raw,
-    double* center,
-    double* sides,
+    const real_t* blow_in,
+    const real_t* strike_in,
+    real_t* raw,
+    real_t* center,
+    real_t* sides,
     size_t size) {
   uint8_t flags = GetGateFlags(gate_in);
   
   // Compute the envelope.
   ConfigureEnvelope(patch);
-  double level = envelope_.Process(flags);
+  real_t level = envelope_.Process(flags);
   level += strength >= 0.5 ? 2.0 * strength - 1.0 : 0.0;
-  double level_increment = (level - level_state_) / size;
+  real_t level_increment = (level - level_state_) / size;
 
   damping_ += 0.1 * (patch.resonator_damping - damping_);
-  double filter_env_amount = damping_ <= 0.9 ? 1.1 * damping_ : 0.99;
-  double vca_env_amount = 1.0 + \
+  real_t filter_env_amount = damping_ <= 0.9 ? 1.1 * damping_ : 0.99;
+  real_t vca_env_amount = 1.0 + \
       damping_ * damping_ * damping_ * damping_ * 0.5;
   
   // Comfigure the filter.
-  double cutoff_midi = 12.0;
+  real_t cutoff_midi = 12.0;
   cutoff_midi += patch.resonator_brightness * 140.0;
   cutoff_midi += filter_env_amount * level * 120.0;
   cutoff_midi += 0.5 * (frequency - 64.0);
   
-  double cutoff = midi_to_frequency(cutoff_midi);
-  double q_bump = patch.resonator_geometry - 0.6;
-  double q = 1.72 - q_bump * q_bump * 2.0;
-  double cutoff_2 = cutoff * (1.0 + patch.resonator_modulation_offset);
+  real_t cutoff = midi_to_frequency(cutoff_midi);
+  real_t q_bump = patch.resonator_geometry - 0.6;
+  real_t q = 1.72 - q_bump * q_bump * 2.0;
+  real_t cutoff_2 = cutoff * (1.0 + patch.resonator_modulation_offset);
 
   filter_[0].set_f_q<FREQUENCY_FAST>(cutoff, q);
   filter_[1].set_f_q<FREQUENCY_FAST>(cutoff_2, q * 1.25);
@@ -254,7 +255,7 @@ void OminousVoice::Process(
   fill(&sides[0], &sides[size], 0.0);
   fill(&raw[0], &raw[size], 0.0);
   
-  const double rotation_speed[2] = { 1.0, 1.123456 };
+  const real_t rotation_speed[2] = { 1.0, 1.123456 };
   feedback_ += 0.01 * (patch.exciter_bow_timbre - feedback_);
   frequency += kOversamplingDownMidi;
   for (size_t i = 0; i < 2; ++i) {
@@ -262,7 +263,7 @@ void OminousVoice::Process(
         &external_fm_state_[i],
         i == 0 ? blow_in : strike_in,
         external_fm_oversampled_, size);
-    double detune, ratio, amount, level;
+    real_t detune, ratio, amount, level;
     if (i == 0) {
       detune = 0.0;
       ratio = patch.exciter_blow_meta;
@@ -293,7 +294,7 @@ void OminousVoice::Process(
     fir_downsampler_[i].Process(osc_oversampled_, osc_, size * kOversamplingUp);
     
     // Copy to raw buffer.
-    double level_state = osc_level_[i];
+    real_t level_state = osc_level_[i];
     for (size_t j = 0; j < size; ++j) {
       level_state += 0.01 * (level - level_state);
       osc_[j] *= level_state;
@@ -305,17 +306,17 @@ void OminousVoice::Process(
     filter_[i].ProcessMultimode(osc_, osc_, size, patch.resonator_geometry);
 
     // Apply VCA.
-    double l = level_state_;
+    real_t l = level_state_;
     for (size_t j = 0; j < size; ++j) {
-      double gain = l * vca_env_amount;
+      real_t gain = l * vca_env_amount;
       if (gain >= 1.0) gain = 1.0;
       osc_[j] *= gain;
       l += level_increment;
     }
 
     // Spatialize.
-    double f = patch.resonator_position * patch.resonator_position * 0.001;
-    double distance = patch.resonator_position;
+    real_t f = patch.resonator_position * patch.resonator_position * 0.001;
+    real_t distance = patch.resonator_position;
     
     spatializer_[i].Rotate(f * rotation_speed[i]);
     spatializer_[i].set_distance(distance * (2.0 - distance));
@@ -43,7 +43,7 @@
 
 namespace elements {
 
-const double kOversamplingDownMidi = -36.0;
+const real_t kOversamplingDownMidi = -36.0;
 const size_t kOversamplingUp = 8;
 
 const size_t kNumOscillators = 2;
@@ -53,20 +53,20 @@ class FIRDownsampler {
  public:
   FIRDownsampler() { }
   ~FIRDownsampler() { }
-  void Init(const double* filter_coefficients) {
+  void Init(const real_t* filter_coefficients) {
     coefficients_ = filter_coefficients;
     std::fill(&buffer_[0], &buffer_[buffer_size * 2], 0.0);
     ptr_ = 0;
   }
   // size is expected to be a multiple of the downsampling ratio.
-  void Process(const double* in, double* out, size_t size) {
+  void Process(const real_t* in, real_t* out, size_t size) {
     while (size) {
       for (int32_t i = 0; i < ratio; ++i) {
         buffer_[ptr_ + buffer_size] = buffer_[ptr_] = *in++;
         ptr_ = (ptr_ + (buffer_size - 1)) & (buffer_size - 1);
         size--;
       }
-      double s = 0.0;
+      real_t s = 0.0;
       for (int32_t i = 0; i < filter_size; ++i) {
         s += buffer_[ptr_ + i + 1] * coefficients_[i];
       }
@@ -76,8 +76,8 @@ class FIRDownsampler {
   
  private:
   int32_t ptr_;
-  const double* coefficients_;
-  double buffer_[buffer_size * 2];
+  const real_t* coefficients_;
+  real_t buffer_[buffer_size * 2];
   
   DISALLOW_COPY_AND_ASSIGN(FIRDownsampler);
 };
@@ -86,9 +86,9 @@ class Spatializer {
  public:
   Spatializer() { }
   ~Spatializer() { }
-  void Init(double fixed_position);
+  void Init(real_t fixed_position);
 
-  inline void Rotate(double rotation_speed) {
+  inline void Rotate(real_t rotation_speed) {
     angle_ += rotation_speed;
     if (angle_ >= 1.0) {
       angle_ -= 1.0;
@@ -98,19 +98,19 @@ class Spatializer {
     }
   }
   
-  inline void set_distance(double distance) {
+  inline void set_distance(real_t distance) {
     distance_ = distance;
   }
 
-  void Process(double* source, double* center, double* sides, size_t size);
+  void Process(real_t* source, real_t* center, real_t* sides, size_t size);
 
  private:
-  double behind_[kMaxBlockSize];
-  double left_;
-  double right_;
-  double angle_;
-  double distance_;
-  double fixed_position_;
+  real_t behind_[kMaxBlockSize];
+  real_t left_;
+  real_t right_;
+  real_t angle_;
+  real_t distance_;
+  real_t fixed_position_;
   
   stmlib::NaiveSvf behind_filter_;
   
@@ -121,50 +121,53 @@ class FmOscillator {
  public:
   FmOscillator() { }
   ~FmOscillator() { }
-  void Init() {
+  void Init(const Dsp& dsp) {
+    interval_correction_ = dsp.getIntervalCorrection();
     fm_amount_ = 0.0;
     previous_sample_ = 0.0;
   }
 
-  void Process(double frequency,
-      double ratio,
-      double feedback_amount,
-      double target_fm_amount,
-      const double* external,
-      double* destination,
+  void Process(real_t frequency,
+      real_t ratio,
+      real_t feedback_amount,
+      real_t target_fm_amount,
+      const real_t* external,
+      real_t* destination,
       size_t size);
 
  private:
-  inline double midi_to_increment(double midi_pitch) const {
+  inline real_t midi_to_increment(real_t midi_pitch) const {
     int32_t pitch = static_cast<int32_t>(midi_pitch * 256.0);
     pitch = 32768 + stmlib::Clip16(pitch - 20480);
-    double increment = lut_midi_to_increment_high[pitch >> 8] * \
+    real_t increment = lut_midi_to_increment_high[pitch >> 8] * \
         lut_midi_to_f_low[pitch & 0xff];
     return increment;
   }
   
-  inline double Sine(uint32_t phase) const {
+  inline real_t Sine(uint32_t phase) const {
     uint32_t integral = phase >> 20;
-    double fractional = static_cast<double>(phase << 12) / 4294967296.0;
-    double a = lut_sine[integral];
-    double b = lut_sine[integral + 1];
+    real_t fractional = static_cast<real_t>(phase << 12) / 4294967296.0;
+    real_t a = lut_sine[integral];
+    real_t b = lut_sine[integral + 1];
     return a + (b - a) * fractional;
   }
   
-  inline double SineFm(uint32_t phase, double fm) const {
+  inline real_t SineFm(uint32_t phase, real_t fm) const {
     phase += static_cast<uint32_t>(fm * 2147483648.0);
     uint32_t integral = phase >> 20;
-    double fractional = static_cast<double>(phase << 12) / 4294967296.0;
-    double a = lut_sine[integral];
-    double b = lut_sine[integral + 1];
+    real_t fractional = static_cast<real_t>(phase << 12) / 4294967296.0;
+    real_t a = lut_sine[integral];
+    real_t b = lut_sine[integral + 1];
     return a + (b - a) * fractional;
   }
   
-  double fm_amount_;
-  double previous_sample_;
+  real_t fm_amount_;
+  real_t previous_sample_;
   uint32_t phase_carrier_;
   uint32_t phase_mod_;
-   
+  
+  real_t interval_correction_;  // vb
+  
   DISALLOW_COPY_AND_ASSIGN(FmOscillator);
 };
 
@@ -173,17 +176,17 @@ class OminousVoice {
   OminousVoice() { }
   ~OminousVoice() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   void Process(
       const Patch& patch,
-      double frequency,
-      double strength,
+      real_t frequency,
+      real_t strength,
       const bool gate_in,
-      const double* blow_in,
-      const double* strike_in,
-      double* raw,
-      double* center,
-      double* sides,
+      const real_t* blow_in,
+      const real_t* strike_in,
+      real_t* raw,
+      real_t* center,
+      real_t* sides,
       size_t size);
   
  private:
@@ -191,14 +194,14 @@ class OminousVoice {
 
   template<int up>
   void Upsample(
-      double* state,
-      const double* source,
-      double* destination,
+      real_t* state,
+      const real_t* source,
+      real_t* destination,
       size_t source_size) {
-    const double down = 1.0 / double(up);
-    double s = *state;
+    const real_t down = 1.0 / real_t(up);
+    real_t s = *state;
     for (size_t i = 0; i < source_size; ++i) {
-      double increment = (source[i] - s) * down;
+      real_t increment = (source[i] - s) * down;
       for (size_t j = 0; j < up; ++j) {
         *destination++ = s;
         s += increment;
@@ -221,32 +224,33 @@ class OminousVoice {
     return flags;
   }
   
-  inline double midi_to_frequency(double midi_pitch) const {
+  inline real_t midi_to_frequency(real_t midi_pitch) const {
     if (midi_pitch < -12.0) {
       midi_pitch = -12.0;
     }
     int32_t pitch = static_cast<int32_t>(midi_pitch * 256.0);
     pitch = 32768 + stmlib::Clip16(pitch - 20480);
     //return lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff];
-      return lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff] * Dsp::getSrFactor();  // vb
+      return lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff] * sr_factor_;  // vb
   }
   
-  double external_fm_oversampled_[kOversamplingUp * kMaxBlockSize];
-  double osc_oversampled_[kOversamplingUp * kMaxBlockSize];
-  double osc_[kMaxBlockSize];
+  real_t external_fm_oversampled_[kOversamplingUp * kMaxBlockSize];
+  real_t osc_oversampled_[kOversamplingUp * kMaxBlockSize];
+  real_t osc_[kMaxBlockSize];
   
   bool previous_gate_;
   MultistageEnvelope envelope_;
 
-  double level_[kMaxBlockSize];
-  double level_state_;
-  double damping_;
+  real_t level_[kMaxBlockSize];
+  real_t level_state_;
+  real_t damping_;
+  real_t sr_factor_;  // vb
   
-  double feedback_;
+  real_t feedback_;
   
-  double osc_level_[kNumOscillators];
+  real_t osc_level_[kNumOscillators];
 
-  double external_fm_state_[kNumOscillators];
+  real_t external_fm_state_[kNumOscillators];
   
   FmOscillator oscillator_[kNumOscillators];
   
@@ -35,7 +35,8 @@ namespace elements {
 using namespace std;
 using namespace stmlib;
 
-void Part::Init(uint16_t* reverb_buffer) {
+void Part::Init(uint16_t* reverb_buffer, const Dsp& dsp) {
+  dsp_ = dsp;
   patch_.exciter_envelope_shape = 1.0;
   patch_.exciter_bow_level = 0.0;
   patch_.exciter_bow_timbre = 0.5;
@@ -50,7 +51,7 @@ void Part::Init(uint16_t* reverb_buffer) {
   patch_.resonator_brightness = 0.5;
   patch_.resonator_damping = 0.25;
   patch_.resonator_position = 0.3;
-  patch_.resonator_modulation_frequency = 0.5 / Dsp::getSr();
+  patch_.resonator_modulation_frequency = 0.5 / dsp_.getSr();
   patch_.resonator_modulation_offset = 0.1;
   patch_.reverb_diffusion = 0.625;
   patch_.reverb_lp = 0.7;
@@ -62,8 +63,8 @@ void Part::Init(uint16_t* reverb_buffer) {
   fill(&note_[0], &note_[kNumVoices], 69.0);
   
   for (size_t i = 0; i < kNumVoices; ++i) {
-    voice_[i].Init();
-    ominous_voice_[i].Init();
+    voice_[i].Init(dsp_);
+    ominous_voice_[i].Init(dsp_);
   }
   
   reverb_.Init(reverb_buffer);
@@ -90,35 +91,35 @@ void Part::Seed(uint32_t* seed, size_t size) {
       signature ^= seed[i];
       signature = signature * 1664525L + 1013904223L;
   }
-  double x;
+  real_t x;
 
-  x = static_cast<double>(signature & 7) / 8.0;
+  x = static_cast<real_t>(signature & 7) / 8.0;
   signature >>= 3;
-  patch_.resonator_modulation_frequency = (0.4 + 0.8 * x) / Dsp::getSr();
+  patch_.resonator_modulation_frequency = (0.4 + 0.8 * x) / dsp_.getSr();
   
-  x = static_cast<double>(signature & 7) / 8.0;
+  x = static_cast<real_t>(signature & 7) / 8.0;
   signature >>= 3;
   patch_.resonator_modulation_offset = 0.05 + 0.1 * x;
 
-  x = static_cast<double>(signature & 7) / 8.0;
+  x = static_cast<real_t>(signature & 7) / 8.0;
   signature >>= 3;
   patch_.reverb_diffusion = 0.55 + 0.15 * x;
 
-  x = static_cast<double>(signature & 7) / 8.0;
+  x = static_cast<real_t>(signature & 7) / 8.0;
   signature >>= 3;
   patch_.reverb_lp = 0.7 + 0.2 * x;
 
-  x = static_cast<double>(signature & 7) / 8.0;
+  x = static_cast<real_t>(signature & 7) / 8.0;
   signature >>= 3;
   patch_.exciter_signature = x;
 }
 
 void Part::Process(
     const PerformanceState& performance_state,
-    const double* blow_in,
-    const double* strike_in,
-    double* main,
-    double* aux,
+    const real_t* blow_in,
+    const real_t* strike_in,
+    real_t* main,
+    real_t* aux,
     size_t size) {
 
   // Copy inputs to outputs when bypass mode is enabled.
@@ -153,19 +154,19 @@ void Part::Process(
   
   // Compute the raw signal gain, stereo spread, and reverb parameters from
   // the "space" metaparameter.
-  double space = patch_.space >= 1.0 ? 1.0 : patch_.space;
-  double raw_gain = space <= 0.05 ? 1.0 : 
+  real_t space = patch_.space >= 1.0 ? 1.0 : patch_.space;
+  real_t raw_gain = space <= 0.05 ? 1.0 : 
     (space <= 0.1 ? 2.0 - space * 20.0 : 0.0);
   space = space >= 0.1 ? space - 0.1 : 0.0;
-  double spread = space <= 0.7 ? space : 0.7;
-  double reverb_amount = space >= 0.5 ? 1.0 * (space - 0.5) : 0.0;
-  double reverb_time = 0.35 + 1.2 * reverb_amount;
+  real_t spread = space <= 0.7 ? space : 0.7;
+  real_t reverb_amount = space >= 0.5 ? 1.0 * (space - 0.5) : 0.0;
+  real_t reverb_time = 0.35 + 1.2 * reverb_amount;
   
     
   // Render each voice.
     
   for (size_t i = 0; i < kNumVoices; ++i) {
-    double midi_pitch = note_[i] + performance_state.modulation;
+    real_t midi_pitch = note_[i] + performance_state.modulation;
     if (easter_egg_) {
       ominous_voice_[i].Process(
           patch_,
@@ -189,8 +190,8 @@ void Part::Process(
       voice_[i].set_resonator_model(resonator_model_);
       // Render the voice signal.
         // vb
-        double freq = lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff];
-        freq *= Dsp::getSrFactor();
+        real_t freq = lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff];
+        freq *= dsp_.getSrFactor();
         //std::cout << "freq: " << freq << "\n";
         
       voice_[i].Process(
@@ -207,7 +208,7 @@ void Part::Process(
     }
     
 /*
-        double midi_pitch = note_[0] + performance_state.modulation;
+        real_t midi_pitch = note_[0] + performance_state.modulation;
         if (easter_egg_) {
             ominous_voice_[0].Process(
                                       patch_,
@@ -230,8 +231,8 @@ void Part::Process(
             }
             voice_[0].set_resonator_model(resonator_model_);
             // Render the voice signal.
-            double freq = lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff];
-            freq *= Dsp::getSrFactor();
+            real_t freq = lut_midi_to_f_high[pitch >> 8] * lut_midi_to_f_low[pitch & 0xff];
+            freq *= dsp_.getSrFactor();
 
             voice_[0].Process(
                               patch_,
@@ -248,9 +249,9 @@ void Part::Process(
     
     // Mixdown.
     for (size_t j = 0; j < size; ++j) {
-      double side = sides_buffer_[j] * spread;
-      double r = center_buffer_[j] - side;
-      double l = center_buffer_[j] + side;;
+      real_t side = sides_buffer_[j] * spread;
+      real_t r = center_buffer_[j] - side;
+      real_t l = center_buffer_[j] + side;;
       main[j] += r;
       aux[j] += l + (raw_buffer_[j] - l) * raw_gain;
     }
@@ -268,10 +269,10 @@ void Part::Process(
   // Metering.
 //TODO: clean metering code
     /*
-  double exciter_level = voice_[active_voice_].exciter_level();
-  double resonator_level = resonator_level_;
+  real_t exciter_level = voice_[active_voice_].exciter_level();
+  real_t resonator_level = resonator_level_;
   for (size_t i = 0; i < size; ++i) {
-    double error = main[i] * main[i] - resonator_level;
+    real_t error = main[i] * main[i] - resonator_level;
     resonator_level += error * (error > 0.0 ? 0.05 : 0.0005);
   }
   resonator_level_ = resonator_level;
@@ -280,7 +281,7 @@ void Part::Process(
   }
     
   if (easter_egg_) {
-    double l = (patch_.exciter_blow_level + patch_.exciter_strike_level) * 0.5;
+    real_t l = (patch_.exciter_blow_level + patch_.exciter_strike_level) * 0.5;
     scaled_exciter_level_ = l * (2.0 - l);
   } else {
     exciter_level *= 16.0;
@@ -40,9 +40,9 @@ namespace elements {
 
 struct PerformanceState {
   bool gate;
-  double note;
-  double modulation;
-  double strength;
+  real_t note;
+  real_t modulation;
+  real_t strength;
 };
 
 // Polyphony is actually possible, but you have to reduce the number of modes
@@ -54,14 +54,14 @@ class Part {
   Part() { }
   ~Part() { }
   
-  void Init(uint16_t* reverb_buffer);
+  void Init(uint16_t* reverb_buffer, const Dsp& dsp);
   
   void Process(
       const PerformanceState& performance_state,
-      const double* blow_in,
-      const double* strike_in,
-      double* main,
-      double* aux,
+      const real_t* blow_in,
+      const real_t* strike_in,
+      real_t* main,
+      real_t* aux,
       size_t n);
 
   inline Patch* mutable_patch() { return &patch_; }
@@ -70,8 +70,8 @@ class Part {
   void Panic();
   
   // For metering.
-  inline double exciter_level() const { return scaled_exciter_level_; }
-  inline double resonator_level() const { return scaled_resonator_level_; }
+  inline real_t exciter_level() const { return scaled_exciter_level_; }
+  inline real_t resonator_level() const { return scaled_resonator_level_; }
   inline bool gate() const { return previous_gate_; }
   inline bool bypass() const { return bypass_; }
   inline void set_bypass(bool bypass) { bypass_ = bypass; }
@@ -81,6 +81,8 @@ class Part {
 
   inline ResonatorModel resonator_model() const { return resonator_model_; }
   inline void set_resonator_model(ResonatorModel r) { resonator_model_ = r; }
+  
+  inline const Dsp& dsp() const { return dsp_; }
     
  private:
   Patch patch_;
@@ -91,25 +93,27 @@ class Part {
   bool bypass_;
   bool easter_egg_;
   bool previous_gate_;
-  double note_[kNumVoices];
+  real_t note_[kNumVoices];
   
   //size_t num_voices_;
   size_t active_voice_;
   
-  double silence_[kMaxBlockSize];
+  real_t silence_[kMaxBlockSize];
   
-  double raw_buffer_[kMaxBlockSize];
-  double center_buffer_[kMaxBlockSize];
-  double sides_buffer_[kMaxBlockSize];
+  real_t raw_buffer_[kMaxBlockSize];
+  real_t center_buffer_[kMaxBlockSize];
+  real_t sides_buffer_[kMaxBlockSize];
   
-  double scaled_exciter_level_;
-  double scaled_resonator_level_;
-  double resonator_level_;
+  real_t scaled_exciter_level_;
+  real_t scaled_resonator_level_;
+  real_t resonator_level_;
   
   Reverb reverb_;
   
   ResonatorModel resonator_model_;
   
+  Dsp dsp_;  // vb
+  
   DISALLOW_COPY_AND_ASSIGN(Part);
 };
 
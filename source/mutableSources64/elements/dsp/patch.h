@@ -32,27 +32,27 @@
 namespace elements {
 
 struct Patch {
-  double exciter_envelope_shape;
-  double exciter_bow_level;
-  double exciter_bow_timbre;
-  double exciter_blow_level;
-  double exciter_blow_meta;
-  double exciter_blow_timbre;
-  double exciter_strike_level;
-  double exciter_strike_meta;
-  double exciter_strike_timbre;
-  double exciter_signature;
-  double resonator_geometry;
-  double resonator_brightness;
-  double resonator_damping;
-  double resonator_position;
-  double resonator_modulation_frequency;
-  double resonator_modulation_offset;
-  double reverb_diffusion;
-  double reverb_lp;
-  double space;
+  real_t exciter_envelope_shape;
+  real_t exciter_bow_level;
+  real_t exciter_bow_timbre;
+  real_t exciter_blow_level;
+  real_t exciter_blow_meta;
+  real_t exciter_blow_timbre;
+  real_t exciter_strike_level;
+  real_t exciter_strike_meta;
+  real_t exciter_strike_timbre;
+  real_t exciter_signature;
+  real_t resonator_geometry;
+  real_t resonator_brightness;
+  real_t resonator_damping;
+  real_t resonator_position;
+  real_t resonator_modulation_frequency;
+  real_t resonator_modulation_offset;
+  real_t reverb_diffusion;
+  real_t reverb_lp;
+  real_t space;
   
-  double modulation_frequency;
+  real_t modulation_frequency;
 };
 
 }  // namespace elements
@@ -30,6 +30,7 @@
 
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/cosine_oscillator.h"
+#include "stmlib/dsp/simd.h"
 
 #include "elements/dsp/dsp.h"
 #include "elements/resources.h"
@@ -41,17 +42,14 @@ namespace elements {
 using namespace std;
 using namespace stmlib;
 
-void Resonator::Init() {
-  for (size_t i = 0; i < kMaxModes; ++i) {
-    f_[i].Init();
-  }
-
+void Resonator::Init(const Dsp& dsp) {
+  f_.Init();
+  f_bow_.Init();
   for (size_t i = 0; i < kMaxBowedModes; ++i) {
-    f_bow_[i].Init();
     d_bow_[i].Init();
   }
   
-    set_frequency(220.0 / Dsp::getSr());
+    set_frequency(220.0 / dsp.getSr());
     // set_frequency(220.0 / kSampleRate);
   set_geometry(0.25);
   set_brightness(0.5);
@@ -69,30 +67,28 @@ void Resonator::Init() {
 
 size_t Resonator::ComputeFilters() {
   ++clock_divider_;
-  double stiffness = Interpolate(lut_stiffness, geometry_, 256.0);
+  real_t stiffness = Interpolate(lut_stiffness, geometry_, 256.0);
     //std::cout << "stiffness: " << stiffness << "\n";
-  double harmonic = frequency_;
-  double stretch_factor = 1.0; 
-  double q = 500.0 * Interpolate(
+  real_t harmonic = frequency_;
+  real_t stretch_factor = 1.0; 
+  real_t q = 500.0 * Interpolate(
       lut_4_decades,
       damping_ * 0.8,
       256.0);
-  double brightness_attenuation = 1.0 - geometry_;
+  real_t brightness_attenuation = 1.0 - geometry_;
   // Reduces the range of brightness when geometry is very low, to prevent
   // clipping.
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
-  double brightness = brightness_ * (1.0 - 0.2 * brightness_attenuation);
-  double q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
-  double q_loss_damping_rate = geometry_ * (2.0 - geometry_) * 0.1;
+  real_t brightness = brightness_ * (1.0 - 0.2 * brightness_attenuation);
+  real_t q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
+  real_t q_loss_damping_rate = geometry_ * (2.0 - geometry_) * 0.1;
 
   size_t num_modes = 0;
-  for (size_t i = 0; i < min(kMaxModes, resolution_); ++i) {
-    // Update the first 24 modes every time (2kHz). The higher modes are
-    // refreshed as a slowest rate.
-    bool update = i <= 24 || ((i & 1) == (clock_divider_ & 1));
-    double partial_frequency = harmonic * stretch_factor;
+  size_t num_filters = min(kMaxModes, resolution_);
+  for (size_t i = 0; i < num_filters; ++i) {
+    real_t partial_frequency = harmonic * stretch_factor;
     if (partial_frequency >= 0.37) {    // vb, was: 0.49 // 0.37
       partial_frequency = 0.37;
     } else {
@@ -100,18 +96,7 @@ size_t Resonator::ComputeFilters() {
     }
       // vb, add filter freq array for information outlet
       filtFreqs_[i] = partial_frequency;
-      
-    if (update) {
-        f_[i].set_f_q<FREQUENCY_FAST>(        // TODO: vb: also try FREQUENCY_EXACT
-          partial_frequency,
-          1.0 + partial_frequency * q);
-      if (i < kMaxBowedModes) {     //min(kMaxBowedModes, num_modes)
-        size_t period = 1.0 / partial_frequency;
-        while (period >= kMaxDelayLineSize) period >>= 1;
-        d_bow_[i].set_delay(period);
-        f_bow_[i].set_g_q(f_[i].g(), 1.0 + partial_frequency * 1500.0);
-      }
-    }
+    resonance_[i] = 1.0 + partial_frequency * q;
     stretch_factor += stiffness;
     if (stiffness < 0.0) {
       // Make sure that the partials do not fold back into negative frequencies.
@@ -126,41 +111,51 @@ size_t Resonator::ComputeFilters() {
     q *= q_loss;
   }
   
+  // Update the first 24 modes every time (2kHz). The higher modes are
+  // refreshed as a slowest rate.
+  const size_t kNumFastModes = 25;
+  // TODO: vb: also try FREQUENCY_EXACT
+  f_.set_f_q<FREQUENCY_FAST>(
+      filtFreqs_,
+      resonance_,
+      0,
+      min(kNumFastModes, num_filters));
+  for (size_t i = kNumFastModes + ((clock_divider_ & 1) ? 0 : 1);
+       i < num_filters;
+       i += 2) {
+    f_.set_f_q<FREQUENCY_FAST>(i, filtFreqs_[i], resonance_[i]);
+  }
+  
+  for (size_t i = 0; i < min(kMaxBowedModes, num_filters); ++i) {
+    size_t period = 1.0 / filtFreqs_[i];
+    while (period >= kMaxDelayLineSize) period >>= 1;
+    d_bow_[i].set_delay(period);
+    f_bow_.set_g_q(i, f_.g(i), 1.0 + filtFreqs_[i] * 1500.0);
+  }
+  
   return num_modes;
 }
 
 void Resonator::Process(
-    const double* bow_strength,
-    const double* in,
-    double* center,
-    double* sides,
+    const real_t* bow_strength,
+    const real_t* in,
+    real_t* center,
+    real_t* sides,
     size_t size) {
   size_t num_modes = ComputeFilters();
   size_t num_banded_wg = min(kMaxBowedModes, num_modes);
 
   // Linearly interpolate position. This parameter is extremely sensitive to
   // zipper noise.
-  double position_increment = (position_ - previous_position_) / size;
+  real_t position_increment = (position_ - previous_position_) / size;
   while (size--) {
-      double s = 0.0;         // vb: init with zero, so we can easier mute later
-
     // 0.5 Hz LFO used to modulate the position of the stereo side channel.
     lfo_phase_ += modulation_frequency_;
     if (lfo_phase_ >= 1.0) {
       lfo_phase_ -= 1.0;
     }
     previous_position_ += position_increment;
-    double lfo = lfo_phase_ > 0.5 ? 1.0 - lfo_phase_ : lfo_phase_;
-    CosineOscillator amplitudes;
-    CosineOscillator aux_amplitudes;
-    amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(previous_position_);
-    aux_amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(
-        modulation_offset_ + lfo);
-  
-    // Render normal modes.
-    double input = *in++ * 0.125;
-    double sum_center = 0.0;
-    double sum_side = 0.0;
+    real_t lfo = lfo_phase_ > 0.5 ? 1.0 - lfo_phase_ : lfo_phase_;
 
     // Note: For a steady sound, the correct way of simulating the effect of
     // a pickup is to use a comb filter. But it sounds very flange-y when
@@ -171,26 +166,43 @@ void Resonator::Process(
     // partials may not be in an integer ratios, what we are doing here is
     // approximative when the stretch factor is non null.
     // It sounds interesting nevertheless.
-    amplitudes.Start();
-    aux_amplitudes.Start();
-    for (size_t i = 0; i < num_modes; i++) {
-      s = f_[i].Process<FILTER_MODE_BAND_PASS>(input);
-      sum_center += s * amplitudes.Next();
-      sum_side += s * aux_amplitudes.Next();
-    }
+    CosineOscillator amplitudes;
+    CosineOscillator aux_amplitudes;
+    amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(previous_position_);
+    aux_amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(
+        modulation_offset_ + lfo);
+    amplitudes.Render(amplitudes_, num_modes);
+    aux_amplitudes.Render(aux_amplitudes_, num_modes);
+
+    // Render normal modes.
+    real_t input = *in++ * 0.125;
+    real_t sum_center;
+    real_t sum_side;
+    f_.Process<FILTER_MODE_BAND_PASS>(input, band_pass_, num_modes);
+    simd::DotProduct2(
+        band_pass_,
+        amplitudes_,
+        aux_amplitudes_,
+        num_modes,
+        &sum_center,
+        &sum_side);
     *sides++ = sum_side - sum_center;
     
     // Render bowed modes.
-    double bow_signal = 0.0;
+    real_t bow_signal = 0.0;
     input += bow_signal_;
-    amplitudes.Start();
     for (size_t i = 0; i < num_banded_wg; ++i) {
-      s = 0.99 * d_bow_[i].Read();
+      real_t s = 0.99 * d_bow_[i].Read();
       bow_signal += s;
-      s = f_bow_[i].Process<FILTER_MODE_BAND_PASS_NORMALIZED>(input + s);
+      bow_input_[i] = input + s;
+    }
+    f_bow_.Process<FILTER_MODE_BAND_PASS_NORMALIZED>(
+        bow_input_, band_pass_, num_banded_wg);
+    for (size_t i = 0; i < num_banded_wg; ++i) {
+      real_t s = band_pass_[i];
       //d_bow_[i].Write(s);
         d_bow_[i].Write(lp_bow.Process<FILTER_MODE_LOW_PASS>(s));   // vb, prevent high freq ringing
-      sum_center += s * amplitudes.Next() * 8.0;
+      sum_center += s * amplitudes_[i] * 8.0;
     }
     bow_signal_ = BowTable(bow_signal, *bow_strength++);
     *center++ = sum_center;
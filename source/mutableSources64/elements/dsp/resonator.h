@@ -37,6 +37,7 @@
 #include "elements/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/delay_line.h"
+#include "stmlib/dsp/svf_bank.h"
 
 #include <iostream>
 
@@ -51,31 +52,31 @@ class Resonator {
   Resonator() { }
   ~Resonator() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   void Process(
-      const double* bow_strength,
-      const double* in,
-      double* center,
-      double* sides,
+      const real_t* bow_strength,
+      const real_t* in,
+      real_t* center,
+      real_t* sides,
       size_t size);
   
-  inline void set_frequency(double frequency) {
+  inline void set_frequency(real_t frequency) {
     frequency_ = frequency;
   }
   
-  inline void set_geometry(double geometry) {
+  inline void set_geometry(real_t geometry) {
     geometry_ = geometry;
   }
   
-  inline void set_brightness(double brightness) {
+  inline void set_brightness(real_t brightness) {
     brightness_ = brightness;
   }
   
-  inline void set_damping(double damping) {
+  inline void set_damping(real_t damping) {
     damping_ = damping;
   }
   
-  inline void set_position(double position) {
+  inline void set_position(real_t position) {
     position_ = position;
   }
   
@@ -83,17 +84,17 @@ class Resonator {
     resolution_ = std::min(resolution, kMaxModes);
   }
   
-  inline void set_modulation_frequency(double modulation_frequency) {
+  inline void set_modulation_frequency(real_t modulation_frequency) {
     modulation_frequency_ = modulation_frequency;
   }
 
-  inline void set_modulation_offset(double modulation_offset) {
+  inline void set_modulation_offset(real_t modulation_offset) {
     modulation_offset_ = modulation_offset;
   }
   
-  inline double BowTable(double x, double velocity) const {
+  inline real_t BowTable(real_t x, real_t velocity) const {
     x = 0.13 * velocity - x;
-    double bow = x;
+    real_t bow = x;
     bow *= 6.0;
     bow = fabs(bow) + 0.75;
     bow *= bow;
@@ -104,31 +105,38 @@ class Resonator {
     return x * bow;
   }
     
-    double* get_f() { return filtFreqs_; } //vb
+    real_t* get_f() { return filtFreqs_; } //vb
   
  private:
   size_t ComputeFilters();
   
-  double frequency_;
-  double geometry_;
-  double brightness_;
-  double position_;
-  double previous_position_;
-  double damping_;
+  real_t frequency_;
+  real_t geometry_;
+  real_t brightness_;
+  real_t position_;
+  real_t previous_position_;
+  real_t damping_;
   
-  double modulation_frequency_;
-  double modulation_offset_;
-  double lfo_phase_;
+  real_t modulation_frequency_;
+  real_t modulation_offset_;
+  real_t lfo_phase_;
 
-  double bow_signal_;
+  real_t bow_signal_;
   
   size_t resolution_;
   
-    double filtFreqs_[kMaxModes];    //vb
+    real_t filtFreqs_[kMaxModes];    //vb
     
-  stmlib::Svf f_[kMaxModes];
-  stmlib::Svf f_bow_[kMaxBowedModes];
-  stmlib::DelayLine<double, kMaxDelayLineSize> d_bow_[kMaxBowedModes];
+  // Modes and bowed modes are stored as structures of arrays and processed
+  // several at a time.
+  stmlib::SvfBank<kMaxModes> f_;
+  stmlib::SvfBank<kMaxBowedModes> f_bow_;
+  real_t resonance_[kMaxModes];
+  real_t amplitudes_[kMaxModes];
+  real_t aux_amplitudes_[kMaxModes];
+  real_t band_pass_[kMaxModes];
+  real_t bow_input_[kMaxBowedModes];
+  stmlib::DelayLine<real_t, kMaxDelayLineSize> d_bow_[kMaxBowedModes];
     
     stmlib::OnePole lp_bow;     // vb, prevent high freq ringing for bowed modes
   
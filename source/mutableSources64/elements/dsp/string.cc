@@ -43,7 +43,8 @@ namespace elements {
 using namespace std;
 using namespace stmlib;
 
-void String::Init(bool enable_dispersion) {
+void String::Init(const Dsp& dsp, bool enable_dispersion) {
+  sr_ = dsp.getSr();
   enable_dispersion_ = enable_dispersion;
   
   string_.Init();
@@ -51,7 +52,7 @@ void String::Init(bool enable_dispersion) {
   fir_damping_filter_.Init();
   iir_damping_filter_.Init();
   
-  set_frequency(220.0 / Dsp::getSr());
+  set_frequency(220.0 / sr_);
   set_dispersion(0.25f);
   set_brightness(0.5f);
   set_damping(0.3f);
@@ -67,22 +68,22 @@ void String::Init(bool enable_dispersion) {
   out_sample_[0] = out_sample_[1] = 0.0;
   aux_sample_[0] = aux_sample_[1] = 0.0;
   
-  dc_blocker_.Init(1.0 - 20.0 / Dsp::getSr());
+  dc_blocker_.Init(1.0 - 20.0 / sr_);
 }
 
 template<bool enable_dispersion>
 void String::ProcessInternal(
-    const double* in,
-    double* out,
-    double* aux,
+    const real_t* in,
+    real_t* out,
+    real_t* aux,
     size_t size) {
-  double delay = 1.0 / frequency_;
+  real_t delay = 1.0 / frequency_;
   CONSTRAIN(delay, 4.0, kDelayLineSize - 4.0);
   
   // If there is not enough delay time in the delay line, we play at the
   // lowest possible note and we upsample on the fly with a shitty linear
   // interpolator. We don't care because it's a corner case (f0 < 11.7Hz)
-  double src_ratio = delay * frequency_;
+  real_t src_ratio = delay * frequency_;
   if (src_ratio >= 0.9999) {
     // When we are above 11.7 Hz, we make sure that the linear interpolator
     // does not get in the way.
@@ -90,7 +91,7 @@ void String::ProcessInternal(
     src_ratio = 1.0;
   }
 
-  double clamped_position = 0.5 - 0.98 * fabs(position_ - 0.5);
+  real_t clamped_position = 0.5 - 0.98 * fabs(position_ - 0.5);
   
   // Linearly interpolate all comb-related CV parameters for each sample.
   ParameterInterpolator delay_modulation(
@@ -101,20 +102,20 @@ void String::ProcessInternal(
       &previous_dispersion_, dispersion_, size);
   
   // For damping/absorption, the interpolation is done in the filter code.
-  double lf_damping = damping_ * (2.0 - damping_);
-  double rt60 = 0.07 * SemitonesToRatio(lf_damping * 96.0) * Dsp::getSr();
-  double rt60_base_2_12 = max(-120.0 * delay / src_ratio / rt60, -127.0);
-  double damping_coefficient = SemitonesToRatio(rt60_base_2_12);
-  double brightness = brightness_ * brightness_;
-  double noise_filter = SemitonesToRatio((brightness_ - 1.0) * 48.0);
-  double damping_cutoff = min(
+  real_t lf_damping = damping_ * (2.0 - damping_);
+  real_t rt60 = 0.07 * SemitonesToRatio(lf_damping * 96.0) * sr_;
+  real_t rt60_base_2_12 = max(-120.0 * delay / src_ratio / rt60, -127.0);
+  real_t damping_coefficient = SemitonesToRatio(rt60_base_2_12);
+  real_t brightness = brightness_ * brightness_;
+  real_t noise_filter = SemitonesToRatio((brightness_ - 1.0) * 48.0);
+  real_t damping_cutoff = min(
       24.0 + damping_ * damping_ * 48.0 + brightness_ * brightness_ * 24.0,
       84.0);
-  double damping_f = min(frequency_ * SemitonesToRatio(damping_cutoff), 0.499);
+  real_t damping_f = min(frequency_ * SemitonesToRatio(damping_cutoff), real_t(0.499));
   
   // Crossfade to infinite decay.
   if (damping_ >= 0.95) {
-    double to_infinite = 20.0 * (damping_ - 0.95);
+    real_t to_infinite = 20.0 * (damping_ - 0.95);
     damping_coefficient += to_infinite * (1.0 - damping_coefficient);
     brightness += to_infinite * (1.0 - brightness);
     damping_f += to_infinite * (0.4999 - damping_f);
@@ -133,57 +134,57 @@ void String::ProcessInternal(
     if (src_phase_ > 1.0) {
       src_phase_ -= 1.0;
       
-      double delay = delay_modulation.Next();
-      double comb_delay = delay * position_modulation.Next();
+      real_t delay = delay_modulation.Next();
+      real_t comb_delay = delay * position_modulation.Next();
     
 #ifndef MIC_W
       delay *= damping_compensation_modulation.Next();  // IIR delay.
 #endif  // MIC_W
       delay -= 1.0; // FIR delay.
     
-      double s = 0.0;
+      real_t s = 0.0;
 
       if (enable_dispersion) {
-        double noise = 2.0 * Random::GetDouble() - 1.0;
+        real_t noise = 2.0 * Random::GetDouble() - 1.0;
         noise *= 1.0 / (0.2 + noise_filter);
         dispersion_noise_ += noise_filter * (noise - dispersion_noise_);
 
-        double dispersion = dispersion_modulation.Next();
-        double stretch_point = dispersion <= 0.0
+        real_t dispersion = dispersion_modulation.Next();
+        real_t stretch_point = dispersion <= 0.0
             ? 0.0
             : dispersion * (2.0 - dispersion) * 0.475;
-        double noise_amount = dispersion > 0.75
+        real_t noise_amount = dispersion > 0.75
             ? 4.0 * (dispersion - 0.75)
             : 0.0;
-        double bridge_curving = dispersion < 0.0
+        real_t bridge_curving = dispersion < 0.0
             ? -dispersion
             : 0.0;
         
         noise_amount = noise_amount * noise_amount * 0.025;
-        double ac_blocking_amount = bridge_curving;
+        real_t ac_blocking_amount = bridge_curving;
 
         bridge_curving = bridge_curving * bridge_curving * 0.01;
-        double ap_gain = -0.618 * dispersion / (0.15 + fabs(dispersion));
+        real_t ap_gain = -0.618 * dispersion / (0.15 + fabs(dispersion));
         
-        double delay_fm = 1.0;
+        real_t delay_fm = 1.0;
         delay_fm += dispersion_noise_ * noise_amount;
         delay_fm -= curved_bridge_ * bridge_curving;
         delay *= delay_fm;
         
-        double ap_delay = delay * stretch_point;
-        double main_delay = delay - ap_delay;
+        real_t ap_delay = delay * stretch_point;
+        real_t main_delay = delay - ap_delay;
         if (ap_delay >= 4.0 && main_delay >= 4.0) {
           s = string_.ReadHermite(main_delay);
           s = stretch_.Allpass(s, ap_delay, ap_gain);
         } else {
           s = string_.ReadHermite(delay);
         }
-        double s_ac = s;
+        real_t s_ac = s;
         dc_blocker_.Process(&s_ac, 1);
         s += ac_blocking_amount * (s_ac - s);
         
-        double value = fabs(s) - 0.025;
-        double sign = s > 0.0 ? 1.0 : -1.5;
+        real_t value = fabs(s) - 0.025;
+        real_t sign = s > 0.0 ? 1.0 : -1.5;
         curved_bridge_ = (fabs(value) + value) * sign;
       } else {
         s = string_.ReadHermite(delay);
@@ -208,7 +209,7 @@ void String::ProcessInternal(
   }
 }
 
-void String::Process(const double* in, double* out, double* aux, size_t size) {
+void String::Process(const real_t* in, real_t* out, real_t* aux, size_t size) {
   if (enable_dispersion_) {
     ProcessInternal<true>(in, out, aux, size);
   } else {
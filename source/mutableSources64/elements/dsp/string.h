@@ -36,6 +36,8 @@
 #include "stmlib/dsp/delay_line.h"
 #include "stmlib/dsp/filter.h"
 
+#include "elements/dsp/dsp.h"
+
 namespace elements {
 
 const size_t kDelayLineSize = 2048;
@@ -54,23 +56,23 @@ class DampingFilter {
     damping_increment_ = 0.0;
   }
    
-  inline void Configure(double damping, double brightness, size_t size) {
+  inline void Configure(real_t damping, real_t brightness, size_t size) {
     if (!size) {
       damping_ = damping;
       brightness_ = brightness;
       damping_increment_ = 0.0;
       brightness_increment_ = 0.0;
     } else {
-      double step = 1.0 / static_cast<double>(size);
+      real_t step = 1.0 / static_cast<real_t>(size);
       damping_increment_ = (damping - damping_) * step;
       brightness_increment_ = (brightness - brightness_) * step;
     }
   }
    
-  inline double Process(double x) {
-    double h0 = (1.0 + brightness_) * 0.5;
-    double h1 = (1.0 - brightness_) * 0.25;
-    double y = damping_ * (h0 * x_ + h1 * (x + x__));
+  inline real_t Process(real_t x) {
+    real_t h0 = (1.0 + brightness_) * 0.5;
+    real_t h1 = (1.0 - brightness_) * 0.25;
+    real_t y = damping_ * (h0 * x_ + h1 * (x + x__));
     x__ = x_;
     x_ = x;
     brightness_ += brightness_increment_;
@@ -78,51 +80,51 @@ class DampingFilter {
     return y;
   }
  private:
-  double x_;
-  double x__;
-  double brightness_;
-  double brightness_increment_;
-  double damping_;
-  double damping_increment_;
+  real_t x_;
+  real_t x__;
+  real_t brightness_;
+  real_t brightness_increment_;
+  real_t damping_;
+  real_t damping_increment_;
   
   DISALLOW_COPY_AND_ASSIGN(DampingFilter);
 };
 
-typedef stmlib::DelayLine<double, kDelayLineSize> StringDelayLine;
-typedef stmlib::DelayLine<double, kDelayLineSize / 2> StiffnessDelayLine;
+typedef stmlib::DelayLine<real_t, kDelayLineSize> StringDelayLine;
+typedef stmlib::DelayLine<real_t, kDelayLineSize / 2> StiffnessDelayLine;
 
 class String {
  public:
   String() { }
   ~String() { }
   
-  void Init(bool enable_dispersion);
-  void Process(const double* in, double* out, double* aux, size_t size);
+  void Init(const Dsp& dsp, bool enable_dispersion);
+  void Process(const real_t* in, real_t* out, real_t* aux, size_t size);
   
-  inline void set_frequency(double frequency) {
+  inline void set_frequency(real_t frequency) {
     frequency_ = frequency;
   }
 
-  inline void set_frequency(double frequency, double coefficient) {
+  inline void set_frequency(real_t frequency, real_t coefficient) {
     frequency_ += coefficient * (frequency - frequency_);
   }
 
-  inline void set_dispersion(double dispersion) {
+  inline void set_dispersion(real_t dispersion) {
     dispersion = dispersion < 0.24
           ? (dispersion - 0.24) * 4.166
           : (dispersion > 0.26 ? (dispersion - 0.26) * 1.35135 : 0.0);
     dispersion_ = dispersion;
   }
   
-  inline void set_brightness(double brightness) {
+  inline void set_brightness(real_t brightness) {
     brightness_ = brightness;
   }
   
-  inline void set_damping(double damping) {
+  inline void set_damping(real_t damping) {
     damping_ = damping;
   }
   
-  inline void set_position(double position) {
+  inline void set_position(real_t position) {
     position_ = position;
   }
   
@@ -130,30 +132,31 @@ class String {
   
  private:
   template<bool enable_dispersion>
-  void ProcessInternal(const double* in, double* out, double* aux, size_t size);
+  void ProcessInternal(const real_t* in, real_t* out, real_t* aux, size_t size);
    
-  double frequency_;
-  double dispersion_;
-  double brightness_;
-  double damping_;
-  double position_;
-  
-  double delay_;
-  double clamped_position_;
-  double previous_dispersion_;
-  double previous_damping_compensation_;
+  real_t sr_;
+  real_t frequency_;
+  real_t dispersion_;
+  real_t brightness_;
+  real_t damping_;
+  real_t position_;
+  
+  real_t delay_;
+  real_t clamped_position_;
+  real_t previous_dispersion_;
+  real_t previous_damping_compensation_;
   
   bool enable_dispersion_;
   bool enable_iir_damping_;
-  double dispersion_noise_;
+  real_t dispersion_noise_;
   
   // Very crappy linear interpolation upsampler used for low pitches that
   // do not fit the delay line. Rarely used.
-  double src_phase_;
-  double out_sample_[2];
-  double aux_sample_[2];
+  real_t src_phase_;
+  real_t out_sample_[2];
+  real_t aux_sample_[2];
   
-  double curved_bridge_;
+  real_t curved_bridge_;
   
   StringDelayLine string_;
   StiffnessDelayLine stretch_;
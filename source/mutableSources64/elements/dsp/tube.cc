@@ -46,15 +46,15 @@ void Tube::Init() {
 }
 
 void Tube::Process(
-    double frequency,
-    double envelope,
-    double damping,
-    double timbre,
-    double* input_output,
-    double gain,
+    real_t frequency,
+    real_t envelope,
+    real_t damping,
+    real_t timbre,
+    real_t* input_output,
+    real_t gain,
     size_t size) {
-  double delay = 1.0 / frequency;
-  while (delay >= double(kTubeDelaySize)) {
+  real_t delay = 1.0 / frequency;
+  while (delay >= real_t(kTubeDelaySize)) {
     delay *= 0.5;
   }
   MAKE_INTEGRAL_FRACTIONAL(delay);
@@ -62,20 +62,20 @@ void Tube::Process(
   if (envelope >= 1.0) envelope = 1.0;
   
   damping = 3.6 - damping * 1.8;
-  double lpf_coefficient = frequency * (1.0 + timbre * timbre * 256.0);
+  real_t lpf_coefficient = frequency * (1.0 + timbre * timbre * 256.0);
   if (lpf_coefficient >= 0.995) lpf_coefficient = 0.995;
   
   int32_t d = delay_ptr_;
   while (size--) {
-    double breath = *input_output * damping + 0.8;
-    double a = delay_line_[(d + delay_integral) % kTubeDelaySize];
-    double b = delay_line_[(d + delay_integral + 1) % kTubeDelaySize];
-    double in = a + (b - a) * delay_fractional;
-    double pressure_delta = -0.95 * (in * envelope + zero_state_) - breath;
+    real_t breath = *input_output * damping + 0.8;
+    real_t a = delay_line_[(d + delay_integral) % kTubeDelaySize];
+    real_t b = delay_line_[(d + delay_integral + 1) % kTubeDelaySize];
+    real_t in = a + (b - a) * delay_fractional;
+    real_t pressure_delta = -0.95 * (in * envelope + zero_state_) - breath;
     zero_state_ = in;
     
-    double reed = pressure_delta * -0.2 + 0.8;
-    double out = pressure_delta * reed + breath;
+    real_t reed = pressure_delta * -0.2 + 0.8;
+    real_t out = pressure_delta * reed + breath;
     
     CONSTRAIN(out, -5.0, 5.0);
     delay_line_[d] = out * 0.5;         // TODO: Crahses here, because d goes out of bound! why?
@@ -47,19 +47,19 @@ class Tube {
   
   void Init();
   void Process(
-      double frequency,
-      double envelope,
-      double damping,
-      double timbre,
-      double* input_output,
-      double gain,
+      real_t frequency,
+      real_t envelope,
+      real_t damping,
+      real_t timbre,
+      real_t* input_output,
+      real_t gain,
       size_t size);
 
  private:
   int32_t delay_ptr_;
-  double zero_state_;
-  double pole_state_;
-  double delay_line_[kTubeDelaySize];
+  real_t zero_state_;
+  real_t pole_state_;
+  real_t delay_line_[kTubeDelaySize];
 
   DISALLOW_COPY_AND_ASSIGN(Tube);
 };
@@ -38,11 +38,12 @@ namespace elements {
 using namespace std;
 using namespace stmlib;
 
-void Voice::Init() {
+void Voice::Init(const Dsp& dsp) {
+  dsp_ = dsp;
   envelope_.Init();
-  bow_.Init();
-  blow_.Init();
-  strike_.Init();
+  bow_.Init(dsp_);
+  blow_.Init(dsp_);
+  strike_.Init(dsp_);
   diffuser_.Init(diffuser_buffer_);
   
   ResetResonator();
@@ -68,15 +69,15 @@ void Voice::Init() {
 }
 
 void Voice::ResetResonator() {
-  resonator_.Init();
+  resonator_.Init(dsp_);
   for (size_t i = 0; i < kNumStrings; ++i) {
-    string_[i].Init(true);
+    string_[i].Init(dsp_, true);
   }
-  dc_blocker_.Init(1.0 - 10.0 / Dsp::getSr());
+  dc_blocker_.Init(1.0 - 10.0 / dsp_.getSr());
   resonator_.set_resolution(52);  // Runs with 56 extremely tightly.
 }
 
-double chords[11][5] = {
+real_t chords[11][5] = {
     { 0.0, -12.0, 0.0, 0.01, 12.0 },
     { 0.0, -12.0, 3.0, 7.0,  10.0 },
     { 0.0, -12.0, 3.0, 7.0,  12.0 },
@@ -93,45 +94,45 @@ double chords[11][5] = {
 
 void Voice::Process(
     const Patch& patch,
-    double frequency,
-    double strength,
+    real_t frequency,
+    real_t strength,
     const bool gate_in,
-    const double* blow_in,
-    const double* strike_in,
-    double* raw,
-    double* center,
-    double* sides,
+    const real_t* blow_in,
+    const real_t* strike_in,
+    real_t* raw,
+    real_t* center,
+    real_t* sides,
     size_t size) {
   uint8_t flags = GetGateFlags(gate_in);
 
   // Compute the envelope.
-  double envelope_gain = 1.0;
+  real_t envelope_gain = 1.0;
   if (patch.exciter_envelope_shape < 0.4) {
-    double a = patch.exciter_envelope_shape * 0.75 + 0.15;
-    double dr = a * 1.8;
+    real_t a = patch.exciter_envelope_shape * 0.75 + 0.15;
+    real_t dr = a * 1.8;
     envelope_.set_adsr(a, dr, 0.0, dr);
     envelope_gain = 5.0 - patch.exciter_envelope_shape * 10.0;
   } else if (patch.exciter_envelope_shape < 0.6) {
-    double s = (patch.exciter_envelope_shape - 0.4) * 5.0;
+    real_t s = (patch.exciter_envelope_shape - 0.4) * 5.0;
     envelope_.set_adsr(0.45, 0.81, s, 0.81);
   } else {
-    double a = (1.0 - patch.exciter_envelope_shape) * 0.75 + 0.15;
-    double dr = a * 1.8;
+    real_t a = (1.0 - patch.exciter_envelope_shape) * 0.75 + 0.15;
+    real_t dr = a * 1.8;
     envelope_.set_adsr(a, dr, 1.0, dr);
   }
     
-  double envelope_value = envelope_.Process(flags) * envelope_gain;
-  double envelope_increment = (envelope_value - envelope_value_) / size;
+  real_t envelope_value = envelope_.Process(flags) * envelope_gain;
+  real_t envelope_increment = (envelope_value - envelope_value_) / size;
   
   // Configure and evaluate exciters.
-  double brightness_factor = 0.4 + 0.6 * patch.resonator_brightness;
+  real_t brightness_factor = 0.4 + 0.6 * patch.resonator_brightness;
   bow_.set_timbre(patch.exciter_bow_timbre * brightness_factor);
 
   blow_.set_parameter(patch.exciter_blow_meta);
   blow_.set_timbre(patch.exciter_blow_timbre);
   blow_.set_signature(patch.exciter_signature);
   
-  double strike_meta = patch.exciter_strike_meta;
+  real_t strike_meta = patch.exciter_strike_meta;
   strike_.set_meta(
       strike_meta <= 0.4 ? strike_meta * 0.625 : strike_meta * 1.25 - 0.25,
       EXCITER_MODEL_SAMPLE_PLAYER,
@@ -141,7 +142,7 @@ void Voice::Process(
 
   bow_.Process(flags, bow_buffer_, size);
   
-  double blow_level, tube_level;
+  real_t blow_level, tube_level;
   blow_level = patch.exciter_blow_level * 1.5;
   tube_level = blow_level > 1.0 ? (blow_level - 1.0) * 2.0 : 0.0;
   blow_level = blow_level < 1.0 ? blow_level * 0.4 : 0.4;
@@ -164,7 +165,7 @@ void Voice::Process(
   // The Strike exciter is implemented in such a way that raising the level
   // beyond a certain point doesn't change the exciter amplitude, but instead,
   // increasingly mixes the raw exciter signal into the resonator output.
-  double strike_level, strike_bleed;
+  real_t strike_level, strike_bleed;
   strike_level = patch.exciter_strike_level * 1.25;
   strike_bleed = strike_level > 1.0 ? (strike_level - 1.0) * 2.0 : 0.0;
   strike_level = strike_level < 1.0 ? strike_level : 1.0;
@@ -172,17 +173,17 @@ void Voice::Process(
   
   // The strength parameter is very sensitive to zipper noise.
   strength *= 256.0;
-  double strength_increment = (strength - strength_) / size;
+  real_t strength_increment = (strength - strength_) / size;
   
   // Sum all sources of excitation.
   for (size_t i = 0; i < size; ++i) {
     strength_ += strength_increment;
     envelope_value_ += envelope_increment;
-    double input_sample = 0.0;
-    double e = envelope_value_;
-    double strength_lut = strength_;
+    real_t input_sample = 0.0;
+    real_t e = envelope_value_;
+    real_t strength_lut = strength_;
     MAKE_INTEGRAL_FRACTIONAL(strength_lut);
-    double accent = lut_accent_gain_coarse[strength_lut_integral] *
+    real_t accent = lut_accent_gain_coarse[strength_lut_integral] *
        lut_accent_gain_fine[
            static_cast<int32_t>(256.0 * strength_lut_fractional)];
     bow_strength_buffer_[i] = e * patch.exciter_bow_level;
@@ -199,12 +200,12 @@ void Voice::Process(
   /* -- vb
   // Update meter for exciter.
   for (size_t i = 0; i < size; ++i) {
-    double error = raw[i] * raw[i] - exciter_level_;
+    real_t error = raw[i] * raw[i] - exciter_level_;
     exciter_level_ += error * (error > 0.0 ? 0.5 : 0.001);
   }*/
   
   // Some exciters can cause palm mutes on release.
-  double damping = patch.resonator_damping;
+  real_t damping = patch.resonator_damping;
   damping -= strike_.damping() * strike_level * 0.125;
   damping -= (1.0 - bow_strength_buffer_[0]) * \
       patch.exciter_bow_level * 0.0625;
@@ -230,22 +231,22 @@ void Voice::Process(
         ? 1
         : kNumStrings;
     
-    double normalization = 1.0 / static_cast<double>(num_notes);
+    real_t normalization = 1.0 / static_cast<real_t>(num_notes);
     dc_blocker_.Process(raw, size);
     for (size_t i = 0; i < size; ++i) {
       raw[i] *= normalization;
     }
     
-    double chord = patch.resonator_geometry * 10.0;
-    double hysteresis = chord > chord_index_ ? -0.1 : 0.1;
+    real_t chord = patch.resonator_geometry * 10.0;
+    real_t hysteresis = chord > chord_index_ ? -0.1 : 0.1;
     int chord_index = static_cast<int>(chord + hysteresis + 0.5);
     CONSTRAIN(chord_index, 0, 10);
-    chord_index_ = static_cast<double>(chord_index);
+    chord_index_ = static_cast<real_t>(chord_index);
 
     fill(&center[0], &center[size], 0.0);
     fill(&sides[0], &sides[size], 0.0);
     for (size_t i = 0; i < num_notes; ++i) {
-      double transpose = chords[chord_index][i];
+      real_t transpose = chords[chord_index][i];
       string_[i].set_frequency(frequency * SemitonesToRatio(transpose));
       string_[i].set_brightness(patch.resonator_brightness);
       string_[i].set_position(patch.resonator_position);
@@ -253,14 +254,14 @@ void Voice::Process(
       if (num_notes == 1) {
         string_[i].set_dispersion(patch.resonator_geometry);
       } else {
-        double b = patch.resonator_brightness;
+        real_t b = patch.resonator_brightness;
         string_[i].set_dispersion(b < 0.5 ? 0.0 : (b - 0.5) * -0.4);
       }
       string_[i].Process(raw, center, sides, size);
     }
     for (size_t i = 0; i < size; ++i) {
-      double left = center[i];
-      double right = sides[i];
+      real_t left = center[i];
+      real_t right = sides[i];
       center[i] = left - right;
       sides[i] = left + right;
     }
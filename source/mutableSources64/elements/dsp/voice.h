@@ -58,20 +58,20 @@ class Voice {
   Voice() { }
   ~Voice() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   void Process(
       const Patch& patch,
-      double frequency,
-      double strength,
+      real_t frequency,
+      real_t strength,
       const bool gate_in,
-      const double* blow_in,
-      const double* strike_in,
-      double* raw,
-      double* center,
-      double* sides,
+      const real_t* blow_in,
+      const real_t* strike_in,
+      real_t* raw,
+      real_t* center,
+      real_t* sides,
       size_t size);
   // For metering.
-  inline double exciter_level() const { return exciter_level_; }
+  inline real_t exciter_level() const { return exciter_level_; }
   void Panic() {
     ResetResonator();
   }
@@ -79,7 +79,7 @@ class Voice {
     resonator_model_ = resonator_model;
   }
     
-    double* getF() { return resonator_.get_f(); }
+    real_t* getF() { return resonator_.get_f(); }
   
  private:
   void ResetResonator();
@@ -97,6 +97,7 @@ class Voice {
     return flags;
   }
   
+  Dsp dsp_;
   MultistageEnvelope envelope_;
   Tube tube_; 
   Exciter bow_;
@@ -107,16 +108,16 @@ class Voice {
   String string_[kNumStrings];
   stmlib::DCBlocker dc_blocker_;
   
-  double strength_;
-  double envelope_value_;
+  real_t strength_;
+  real_t envelope_value_;
   
-  double exciter_level_;
+  real_t exciter_level_;
   
-  double bow_buffer_[kMaxBlockSize];
-  double bow_strength_buffer_[kMaxBlockSize];
-  double blow_buffer_[kMaxBlockSize];
-  double strike_buffer_[kMaxBlockSize];
-  double external_buffer_[kMaxBlockSize];
+  real_t bow_buffer_[kMaxBlockSize];
+  real_t bow_strength_buffer_[kMaxBlockSize];
+  real_t blow_buffer_[kMaxBlockSize];
+  real_t strike_buffer_[kMaxBlockSize];
+  real_t external_buffer_[kMaxBlockSize];
   
     float diffuser_buffer_[1024];     // TODO: check out float/double duffuser buffer
     //double diffuser_buffer_[1024];
@@ -124,7 +125,7 @@ class Voice {
   bool previous_gate_;
   
   ResonatorModel resonator_model_;
-  double chord_index_;
+  real_t chord_index_;
   
   DISALLOW_COPY_AND_ASSIGN(Voice);
 };
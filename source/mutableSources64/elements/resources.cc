@@ -174,7 +174,7 @@ const int16_t* lookup_table_int16_table[] = {
 
 
 
-const double lut_sine[] = {
+const real_t lut_sine[] = {
    0.000000000e+00,  1.533980186e-03,  3.067956763e-03,  4.601926120e-03,
    6.135884649e-03,  7.669828740e-03,  9.203754782e-03,  1.073765917e-02,
    1.227153829e-02,  1.380538853e-02,  1.533920628e-02,  1.687298795e-02,
@@ -1201,7 +1201,7 @@ const double lut_sine[] = {
   -6.135884649e-03, -4.601926120e-03, -3.067956763e-03, -1.533980186e-03,
    0.000000000e+00,
 };
-const double lut_approx_svf_gain[] = {
+const real_t lut_approx_svf_gain[] = {
    4.200005822e+02,  4.099237183e+02,  4.000886248e+02,  3.904895013e+02,
    3.811206860e+02,  3.719766535e+02,  3.630520105e+02,  3.543414934e+02,
    3.458399648e+02,  3.375424105e+02,  3.294439367e+02,  3.215397669e+02,
@@ -1268,7 +1268,7 @@ const double lut_approx_svf_gain[] = {
    1.230167210e+00,  1.217909100e+00,  1.206629817e+00,  1.196346629e+00,
    1.188672690e+00,
 };
-const double lut_approx_svf_g[] = {
+const real_t lut_approx_svf_g[] = {
    3.141602989e-03,  3.218831536e-03,  3.297958582e-03,  3.379030801e-03,
    3.462096013e-03,  3.547203214e-03,  3.634402603e-03,  3.723745617e-03,
    3.815284955e-03,  3.909074612e-03,  4.005169912e-03,  4.103627537e-03,
@@ -1335,7 +1335,7 @@ const double lut_approx_svf_g[] = {
    6.993550439e+00,  9.318558639e+00,  1.407720922e+01,  2.935971016e+01,
    3.183088390e+02,
 };
-const double lut_approx_svf_r[] = {
+const real_t lut_approx_svf_r[] = {
    2.000000000e+00,  1.946754762e+00,  1.894927051e+00,  1.844479130e+00,
    1.795374265e+00,  1.747576700e+00,  1.701051631e+00,  1.655765181e+00,
    1.611684376e+00,  1.568777116e+00,  1.527012161e+00,  1.486359098e+00,
@@ -1402,7 +1402,7 @@ const double lut_approx_svf_r[] = {
    2.227947720e-03,  2.168633916e-03,  2.110899202e-03,  2.054701536e-03,
    2.000000000e-03,
 };
-const double lut_approx_svf_h[] = {
+const real_t lut_approx_svf_h[] = {
    9.937462795e-01,  9.935932867e-01,  9.934365695e-01,  9.932760383e-01,
    9.931116010e-01,  9.929431638e-01,  9.927706303e-01,  9.925939020e-01,
    9.924128782e-01,  9.922274556e-01,  9.920375286e-01,  9.918429892e-01,
@@ -1469,7 +1469,7 @@ const double lut_approx_svf_h[] = {
    1.565022410e-02,  9.392083109e-03,  4.399041685e-03,  1.084937594e-03,
    9.807947187e-06,
 };
-const double lut_4_decades[] = {
+const real_t lut_4_decades[] = {
    1.000000000e+00,  1.036632928e+00,  1.074607828e+00,  1.113973860e+00,
    1.154781985e+00,  1.197085030e+00,  1.240937761e+00,  1.286396945e+00,
    1.333521432e+00,  1.382372227e+00,  1.433012570e+00,  1.485508017e+00,
@@ -1536,7 +1536,7 @@ const double lut_4_decades[] = {
    8.659643234e+03,  8.976871324e+03,  9.305720409e+03,  9.646616199e+03,
    1.000000000e+04,
 };
-const double lut_accent_gain_coarse[] = {
+const real_t lut_accent_gain_coarse[] = {
    1.778279410e-01,  1.802434016e-01,  1.826916718e-01,  1.851731971e-01,
    1.876884294e-01,  1.902378263e-01,  1.928218521e-01,  1.954409770e-01,
    1.980956779e-01,  2.007864379e-01,  2.035137468e-01,  2.062781012e-01,
@@ -1603,7 +1603,7 @@ const double lut_accent_gain_coarse[] = {
    5.327978946e+00,  5.400349594e+00,  5.473703263e+00,  5.548053304e+00,
    5.623413252e+00,
 };
-const double lut_accent_gain_fine[] = {
+const real_t lut_accent_gain_fine[] = {
    1.000000000e+00,  1.000052703e+00,  1.000105410e+00,  1.000158118e+00,
    1.000210830e+00,  1.000263545e+00,  1.000316262e+00,  1.000368982e+00,
    1.000421705e+00,  1.000474430e+00,  1.000527159e+00,  1.000579890e+00,
@@ -1670,7 +1670,7 @@ const double lut_accent_gain_fine[] = {
    1.013369484e+00,  1.013422892e+00,  1.013476303e+00,  1.013529717e+00,
    1.013583133e+00,
 };
-const double lut_stiffness[] = {
+const real_t lut_stiffness[] = {
   -6.250000000e-02, -6.152343750e-02, -6.054687500e-02, -5.957031250e-02,
   -5.859375000e-02, -5.761718750e-02, -5.664062500e-02, -5.566406250e-02,
   -5.468750000e-02, -5.371093750e-02, -5.273437500e-02, -5.175781250e-02,
@@ -1737,7 +1737,7 @@ const double lut_stiffness[] = {
    1.808823654e+00,  1.884612937e+00,  1.945398753e+00,  2.000000000e+00,
    2.000000000e+00,
 };
-const double lut_env_increments[] = {
+const real_t lut_env_increments[] = {
    1.000000000e+00,  9.063850448e-01,  8.229004961e-01,  7.483069353e-01,
    6.815335492e-01,  6.216529559e-01,  5.678601147e-01,  5.194546047e-01,
    4.758256919e-01,  4.364397144e-01,  4.008293953e-01,  3.685847672e-01,
@@ -1804,7 +1804,7 @@ const double lut_env_increments[] = {
    6.725644047e-05,  6.602858654e-05,  6.482698750e-05,  6.365100040e-05,
    6.250000000e-05,  6.250000000e-05,
 };
-const double lut_env_linear[] = {
+const real_t lut_env_linear[] = {
    0.000000000e+00,  3.906250000e-03,  7.812500000e-03,  1.171875000e-02,
    1.562500000e-02,  1.953125000e-02,  2.343750000e-02,  2.734375000e-02,
    3.125000000e-02,  3.515625000e-02,  3.906250000e-02,  4.296875000e-02,
@@ -1871,7 +1871,7 @@ const double lut_env_linear[] = {
    9.843750000e-01,  9.882812500e-01,  9.921875000e-01,  9.960937500e-01,
    1.000000000e+00,  1.000000000e+00,
 };
-const double lut_env_expo[] = {
+const real_t lut_env_expo[] = {
    0.000000000e+00,  1.579281856e-02,  3.134079216e-02,  4.664771677e-02,
    6.171732951e-02,  7.655330956e-02,  9.115927906e-02,  1.055388040e-01,
    1.196953950e-01,  1.336325085e-01,  1.473535470e-01,  1.608618606e-01,
@@ -1938,7 +1938,7 @@ const double lut_env_expo[] = {
    9.987967036e-01,  9.991046146e-01,  9.994077518e-01,  9.997061893e-01,
    1.000000000e+00,  1.000000000e+00,
 };
-const double lut_env_quartic[] = {
+const real_t lut_env_quartic[] = {
    0.000000000e+00,  1.010748988e-08,  1.009399071e-07,  3.878697237e-07,
    1.008050957e-06,  2.114578098e-06,  3.873517001e-06,  6.462027591e-06,
    1.006704644e-05,  1.488430108e-05,  2.111753950e-05,  2.897790804e-05,
@@ -2005,7 +2005,7 @@ const double lut_env_quartic[] = {
    9.490587784e-01,  9.616199073e-01,  9.742967511e-01,  9.870899137e-01,
    1.000000000e+00,  1.000000000e+00,
 };
-const double lut_midi_to_f_high[] = {
+const real_t lut_midi_to_f_high[] = {
    1.596835726e-05,  1.691788519e-05,  1.792387499e-05,  1.898968407e-05,
    2.011886944e-05,  2.131519967e-05,  2.258266740e-05,  2.392550268e-05,
    2.534818711e-05,  2.685546875e-05,  2.845237802e-05,  3.014424446e-05,
@@ -2071,7 +2071,7 @@ const double lut_midi_to_f_high[] = {
    3.750000000e-01,  3.750000000e-01,  3.750000000e-01,  3.750000000e-01,
    3.750000000e-01,  3.750000000e-01,  3.750000000e-01,  3.750000000e-01,
 };
-const double lut_midi_to_increment_high[] = {
+const real_t lut_midi_to_increment_high[] = {
    6.858357219e+04,  7.266176361e+04,  7.698245692e+04,  8.156007202e+04,
    8.640988628e+04,  9.154808550e+04,  9.699181795e+04,  1.027592516e+05,
    1.088696346e+05,  1.153433600e+05,  1.222020331e+05,  1.294685441e+05,
@@ -2137,7 +2137,7 @@ const double lut_midi_to_increment_high[] = {
    1.610612736e+09,  1.610612736e+09,  1.610612736e+09,  1.610612736e+09,
    1.610612736e+09,  1.610612736e+09,  1.610612736e+09,  1.610612736e+09,
 };
-const double lut_midi_to_f_low[] = {
+const real_t lut_midi_to_f_low[] = {
    1.000000000e+00,  1.000225659e+00,  1.000451370e+00,  1.000677131e+00,
    1.000902943e+00,  1.001128806e+00,  1.001354720e+00,  1.001580685e+00,
    1.001806701e+00,  1.002032768e+00,  1.002258886e+00,  1.002485055e+00,
@@ -2203,7 +2203,7 @@ const double lut_midi_to_f_low[] = {
    1.057552413e+00,  1.057791060e+00,  1.058029760e+00,  1.058268515e+00,
    1.058507323e+00,  1.058746185e+00,  1.058985101e+00,  1.059224071e+00,
 };
-const double lut_fm_frequency_quantizer[] = {
+const real_t lut_fm_frequency_quantizer[] = {
   -1.200000000e+01, -1.200000000e+01, -1.200000000e+01, -1.184000000e+01,
   -1.184000000e+01, -1.184000000e+01, -1.111000000e+01, -1.038000000e+01,
   -9.650000000e+00, -8.920000000e+00, -8.190000000e+00, -7.460000000e+00,
@@ -2238,7 +2238,7 @@ const double lut_fm_frequency_quantizer[] = {
    3.525000000e+01,  3.600000000e+01,  3.600000000e+01,  3.600000000e+01,
    3.600000000e+01,
 };
-const double lut_detune_quantizer[] = {
+const real_t lut_detune_quantizer[] = {
   -2.400000000e+01, -2.400000000e+01, -2.400000000e+01, -2.300000000e+01,
   -2.200000000e+01, -2.100000000e+01, -2.000000000e+01, -1.900000000e+01,
   -1.800000000e+01, -1.700000000e+01, -1.600000000e+01, -1.500000000e+01,
@@ -2257,7 +2257,7 @@ const double lut_detune_quantizer[] = {
    2.275000000e+01,  2.400000000e+01,  2.400000000e+01,  2.400000000e+01,
    2.400000000e+01,
 };
-const double lut_svf_shift[] = {
+const real_t lut_svf_shift[] = {
    2.500000000e-01,  2.408119579e-01,  2.316544611e-01,  2.225575501e-01,
    2.135502761e-01,  2.046602549e-01,  1.959132760e-01,  1.873329789e-01,
    1.789406032e-01,  1.707548172e-01,  1.627916233e-01,  1.550643347e-01,
@@ -2326,7 +2326,7 @@ const double lut_svf_shift[] = {
 };
 
 
-const double* lookup_table_table[] = {
+const real_t* lookup_table_table[] = {
   lut_sine,
   lut_approx_svf_gain,
   lut_approx_svf_g,
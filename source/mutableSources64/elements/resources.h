@@ -46,32 +46,32 @@ extern const int16_t* lookup_table_int16_table[];
 
 extern const uint32_t* lookup_table_uint32_table[];
 
-extern const double* lookup_table_table[];
+extern const real_t* lookup_table_table[];
 
 extern const int16_t* sample_table[];
 
 extern const size_t* sample_boundary_table[];
 
 extern const int16_t lut_db_led_brightness[];
-extern const double lut_sine[];
-extern const double lut_approx_svf_gain[];
-extern const double lut_approx_svf_g[];
-extern const double lut_approx_svf_r[];
-extern const double lut_approx_svf_h[];
-extern const double lut_4_decades[];
-extern const double lut_accent_gain_coarse[];
-extern const double lut_accent_gain_fine[];
-extern const double lut_stiffness[];
-extern const double lut_env_increments[];
-extern const double lut_env_linear[];
-extern const double lut_env_expo[];
-extern const double lut_env_quartic[];
-extern const double lut_midi_to_f_high[];
-extern const double lut_midi_to_increment_high[];
-extern const double lut_midi_to_f_low[];
-extern const double lut_fm_frequency_quantizer[];
-extern const double lut_detune_quantizer[];
-extern const double lut_svf_shift[];
+extern const real_t lut_sine[];
+extern const real_t lut_approx_svf_gain[];
+extern const real_t lut_approx_svf_g[];
+extern const real_t lut_approx_svf_r[];
+extern const real_t lut_approx_svf_h[];
+extern const real_t lut_4_decades[];
+extern const real_t lut_accent_gain_coarse[];
+extern const real_t lut_accent_gain_fine[];
+extern const real_t lut_stiffness[];
+extern const real_t lut_env_increments[];
+extern const real_t lut_env_linear[];
+extern const real_t lut_env_expo[];
+extern const real_t lut_env_quartic[];
+extern const real_t lut_midi_to_f_high[];
+extern const real_t lut_midi_to_increment_high[];
+extern const real_t lut_midi_to_f_low[];
+extern const real_t lut_fm_frequency_quantizer[];
+extern const real_t lut_detune_quantizer[];
+extern const real_t lut_svf_shift[];
 extern const int16_t smp_sample_data[];
 extern const int16_t smp_noise_sample[];
 extern const size_t smp_boundaries[];
@@ -38,7 +38,7 @@ using namespace stmlib;
 
 // Alternative chord table by Jon Butler jonbutler88@gmail.com
 /* static */
-const double ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
+const real_t ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
   // Fixed Intervals
   { 0.00, 0.01, 11.99, 12.00 },  // Octave
   { 0.00, 7.00,  7.01, 12.00 },  // Fifth
@@ -65,7 +65,7 @@ const double ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
 #else
 
 /* static */
-const double ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
+const real_t ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
   { 0.00, 0.01, 11.99, 12.00 },  // OCT
   { 0.00, 7.00,  7.01, 12.00 },  // 5
   { 0.00, 5.00,  7.00, 12.00 },  // sus4
@@ -82,9 +82,9 @@ const double ChordBank::chords_[kChordNumChords][kChordNumNotes] = {
 #endif  // JON_CHORDS
 
 void ChordBank::Init(BufferAllocator* allocator) {
-  ratios_ = allocator->Allocate<double>(kChordNumChords * kChordNumNotes);
+  ratios_ = allocator->Allocate<real_t>(kChordNumChords * kChordNumNotes);
   note_count_ = allocator->Allocate<int>(kChordNumChords);
-  sorted_ratios_ = allocator->Allocate<double>(kChordNumNotes);
+  sorted_ratios_ = allocator->Allocate<real_t>(kChordNumNotes);
 
   chord_index_quantizer_.Init(kChordNumChords, 0.075, false);
 }
@@ -105,23 +105,23 @@ void ChordBank::Reset() {
 }
 
 int ChordBank::ComputeChordInversion(
-    double inversion,
-    double* ratios,
-    double* amplitudes) {
-  const double* base_ratio = this->ratios();
-  inversion = inversion * double(kChordNumNotes * kChordNumVoices);
+    real_t inversion,
+    real_t* ratios,
+    real_t* amplitudes) {
+  const real_t* base_ratio = this->ratios();
+  inversion = inversion * real_t(kChordNumNotes * kChordNumVoices);
 
   MAKE_INTEGRAL_FRACTIONAL(inversion);
 
   int num_rotations = inversion_integral / kChordNumNotes;
   int rotated_note = inversion_integral % kChordNumNotes;
 
-  const double kBaseGain = 0.25;
+  const real_t kBaseGain = 0.25;
 
   int mask = 0;
 
   for (int i = 0; i < kChordNumNotes; ++i) {
-    double transposition = 0.25 * static_cast<double>(
+    real_t transposition = 0.25 * static_cast<real_t>(
         1 << ((kChordNumNotes - 1 + inversion_integral - i) / kChordNumNotes));
     int target_voice = (i - num_rotations + kChordNumVoices) % kChordNumVoices;
     int previous_voice = (target_voice - 1 + kChordNumVoices) % kChordNumVoices;
@@ -57,11 +57,11 @@ class ChordBank {
   void Reset();
 
   int ComputeChordInversion(
-      double inversion, double* ratios, double* amplitudes);
+      real_t inversion, real_t* ratios, real_t* amplitudes);
 
   inline void Sort() {
     for (int i = 0; i < kChordNumNotes; ++i) {
-      double r = ratio(i);
+      real_t r = ratio(i);
       while (r > 2.0) {
         r *= 0.5;
       }
@@ -70,7 +70,7 @@ class ChordBank {
     std::sort(&sorted_ratios_[0], &sorted_ratios_[kChordNumNotes]);
   }
 
-  inline void set_chord(double parameter) {
+  inline void set_chord(real_t parameter) {
     chord_index_quantizer_.Process(parameter * 1.02);
   }
 
@@ -78,15 +78,15 @@ class ChordBank {
     return chord_index_quantizer_.quantized_value();
   }
 
-  inline const double* ratios() const {
+  inline const real_t* ratios() const {
     return &ratios_[chord_index() * kChordNumNotes];
   }
 
-  inline double ratio(int note) const {
+  inline real_t ratio(int note) const {
     return ratios_[chord_index() * kChordNumNotes + note];
   }
 
-  inline double sorted_ratio(int note) const {
+  inline real_t sorted_ratio(int note) const {
     return sorted_ratios_[note];
   }
 
@@ -97,11 +97,11 @@ class ChordBank {
  private:
   stmlib::HysteresisQuantizer2 chord_index_quantizer_;
 
-  double* ratios_;
-  double* sorted_ratios_;
+  real_t* ratios_;
+  real_t* sorted_ratios_;
   int* note_count_;
 
-  static const double chords_[kChordNumChords][kChordNumNotes];
+  static const real_t chords_[kChordNumChords][kChordNumNotes];
 
   DISALLOW_COPY_AND_ASSIGN(ChordBank);
 };
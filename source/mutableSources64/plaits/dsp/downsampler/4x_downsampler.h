@@ -39,7 +39,7 @@ const size_t kOversampling = 4;
 
 class Downsampler {
  public:
-  Downsampler(double* state) {
+  Downsampler(real_t* state) {
     head_ = *state;
     tail_ = 0.0f;
     state_ = state;
@@ -47,21 +47,21 @@ class Downsampler {
   ~Downsampler() {
     *state_ = head_;
   }
-  inline void Accumulate(int i, double sample) {
+  inline void Accumulate(int i, real_t sample) {
     head_ += sample * lut_4x_downsampler_fir[3 - (i & 3)];
     tail_ += sample * lut_4x_downsampler_fir[i & 3];
   }
 
-  inline double Read() {
-    double value = head_;
+  inline real_t Read() {
+    real_t value = head_;
     head_ = tail_;
     tail_ = 0.0f;
     return value;
   }
  private:
-  double head_;
-  double tail_;
-  double* state_;
+  real_t head_;
+  real_t tail_;
+  real_t* state_;
 
   DISALLOW_COPY_AND_ASSIGN(Downsampler);
 };
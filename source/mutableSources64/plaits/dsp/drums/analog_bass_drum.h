@@ -46,7 +46,8 @@ class AnalogBassDrum {
   AnalogBassDrum() { }
   ~AnalogBassDrum() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     pulse_remaining_samples_ = 0;
     fm_pulse_remaining_samples_ = 0;
     pulse_ = 0.0;
@@ -62,7 +63,7 @@ class AnalogBassDrum {
     oscillator_.Init();
   }
 
-  inline double Diode(double x) {
+  inline real_t Diode(real_t x) {
     if (x >= 0.0) {
       return x;
     } else {
@@ -74,27 +75,26 @@ class AnalogBassDrum {
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double tone,
-      double decay,
-      double attack_fm_amount,
-      double self_fm_amount,
-      double* out,
+      real_t accent,
+      real_t f0,
+      real_t tone,
+      real_t decay,
+      real_t attack_fm_amount,
+      real_t self_fm_amount,
+      real_t* out,
       size_t size) {
-      //const double sr = Dsp::getSr();
-    const int kTriggerPulseDuration = 1.0e-3 * kSampleRate;
-    const int kFMPulseDuration = 6.0e-3 * kSampleRate;
-    const double kPulseDecayTime = 0.2e-3 * kSampleRate;
-    const double kPulseFilterTime = 0.1e-3 * kSampleRate;
-    const double kRetrigPulseDuration = 0.05 * kSampleRate;
-
-    const double scale = 0.001 / f0;
-    const double q = 1500.0 * stmlib::SemitonesToRatio(decay * 80.0);
-    const double tone_f = std::min(
+    const int kTriggerPulseDuration = 1.0e-3 * sr_;
+    const int kFMPulseDuration = 6.0e-3 * sr_;
+    const real_t kPulseDecayTime = 0.2e-3 * sr_;
+    const real_t kPulseFilterTime = 0.1e-3 * sr_;
+    const real_t kRetrigPulseDuration = 0.05 * sr_;
+
+    const real_t scale = 0.001 / f0;
+    const real_t q = 1500.0 * stmlib::SemitonesToRatio(decay * 80.0);
+    const real_t tone_f = std::min(
         4.0 * f0 * stmlib::SemitonesToRatio(tone * 108.0),
         1.0);
-    const double exciter_leak = 0.08 * (tone + 0.25);
+    const real_t exciter_leak = 0.08 * (tone + 0.25);
 
 
     if (trigger) {
@@ -111,7 +111,7 @@ class AnalogBassDrum {
 
     while (size--) {
       // Q39 / Q40
-      double pulse = 0.0;
+      real_t pulse = 0.0;
       if (pulse_remaining_samples_) {
         --pulse_remaining_samples_;
         pulse = pulse_remaining_samples_ ? pulse_height_ : pulse_height_ - 1.0;
@@ -129,7 +129,7 @@ class AnalogBassDrum {
       pulse = Diode((pulse - pulse_lp_) + pulse * 0.044);
 
       // Q41 / Q42
-      double fm_pulse = 0.0;
+      real_t fm_pulse = 0.0;
       if (fm_pulse_remaining_samples_) {
         --fm_pulse_remaining_samples_;
         fm_pulse = 1.0;
@@ -145,15 +145,15 @@ class AnalogBassDrum {
       ONE_POLE(fm_pulse_lp_, fm_pulse, 1.0 / kPulseFilterTime);
 
       // Q43 and R170 leakage
-      double punch = 0.7 + Diode(10.0 * lp_out_ - 1.0);
+      real_t punch = 0.7 + Diode(10.0 * lp_out_ - 1.0);
 
       // Q43 / R165
-      double attack_fm = fm_pulse_lp_ * 1.7 * attack_fm_amount;
-      double self_fm = punch * 0.08 * self_fm_amount;
-      double f = f0 * (1.0 + attack_fm + self_fm);
+      real_t attack_fm = fm_pulse_lp_ * 1.7 * attack_fm_amount;
+      real_t self_fm = punch * 0.08 * self_fm_amount;
+      real_t f = f0 * (1.0 + attack_fm + self_fm);
       CONSTRAIN(f, 0.0, 0.4);
 
-      double resonator_out;
+      real_t resonator_out;
       if (sustain) {
         oscillator_.Next(f, sustain_gain.Next(), &resonator_out, &lp_out_);
       } else {
@@ -174,20 +174,22 @@ class AnalogBassDrum {
  private:
   int pulse_remaining_samples_;
   int fm_pulse_remaining_samples_;
-  double pulse_;
-  double pulse_height_;
-  double pulse_lp_;
-  double fm_pulse_lp_;
-  double retrig_pulse_;
-  double lp_out_;
-  double tone_lp_;
-  double sustain_gain_;
+  real_t pulse_;
+  real_t pulse_height_;
+  real_t pulse_lp_;
+  real_t fm_pulse_lp_;
+  real_t retrig_pulse_;
+  real_t lp_out_;
+  real_t tone_lp_;
+  real_t sustain_gain_;
 
   stmlib::Svf resonator_;
 
   // Replace the resonator in "free running" (sustain) mode.
   SineOscillator oscillator_;
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(AnalogBassDrum);
 };
 
@@ -50,7 +50,8 @@ class AnalogSnareDrum {
 
   static const int kNumModes = 5;
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     pulse_remaining_samples_ = 0;
     pulse_ = 0.0;
     pulse_height_ = 0.0;
@@ -68,21 +69,20 @@ class AnalogSnareDrum {
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double tone,
-      double decay,
-      double snappy,
-      double* out,
+      real_t accent,
+      real_t f0,
+      real_t tone,
+      real_t decay,
+      real_t snappy,
+      real_t* out,
       size_t size) {
-      //const double sr = Dsp::getSr();
-    const double decay_xt = decay * (1.0 + decay * (decay - 1.0));
-    const int kTriggerPulseDuration = 1.0e-3 * kSampleRate;
-    const double kPulseDecayTime = 0.1e-3 * kSampleRate;
-    const double q = 2000.0 * stmlib::SemitonesToRatio(decay_xt * 84.0);
-    const double noise_envelope_decay = 1.0 - 0.0017 * \
+    const real_t decay_xt = decay * (1.0 + decay * (decay - 1.0));
+    const int kTriggerPulseDuration = 1.0e-3 * sr_;
+    const real_t kPulseDecayTime = 0.1e-3 * sr_;
+    const real_t q = 2000.0 * stmlib::SemitonesToRatio(decay_xt * 84.0);
+    const real_t noise_envelope_decay = 1.0 - 0.0017 * \
         stmlib::SemitonesToRatio(-decay * (50.0 + snappy * 10.0));
-    const double exciter_leak = snappy * (2.0 - snappy) * 0.1;
+    const real_t exciter_leak = snappy * (2.0 - snappy) * 0.1;
     
     snappy = snappy * 1.1 - 0.05;
     CONSTRAIN(snappy, 0.0, 1.0);
@@ -93,18 +93,18 @@ class AnalogSnareDrum {
       noise_envelope_ = 2.0;
     }
     
-    static const double kModeFrequencies[kNumModes] = {
+    static const real_t kModeFrequencies[kNumModes] = {
         1.00,
         2.00,
         3.18,
         4.16,
         5.62};
     
-    double f[kNumModes];
-    double gain[kNumModes];
+    real_t f[kNumModes];
+    real_t gain[kNumModes];
     
     for (int i = 0; i < kNumModes; ++i) {
-      f[i] = std::min(f0 * kModeFrequencies[i], 0.499);
+      f[i] = std::min(f0 * kModeFrequencies[i], real_t(0.499));
       resonator_[i].set_f_q<stmlib::FREQUENCY_FAST>(
           f[i],
           1.0 + f[i] * (i == 0 ? q : q * 0.25));
@@ -127,7 +127,7 @@ class AnalogSnareDrum {
       }
     }
 
-    double f_noise = f0 * 16.0;
+    real_t f_noise = f0 * 16.0;
     CONSTRAIN(f_noise, 0.0, 0.499);
     noise_filter_.set_f_q<stmlib::FREQUENCY_FAST>(
         f_noise, 1.0 + f_noise * 1.5);
@@ -140,7 +140,7 @@ class AnalogSnareDrum {
     
     while (size--) {
       // Q45 / Q46
-      double pulse = 0.0;
+      real_t pulse = 0.0;
       if (pulse_remaining_samples_) {
         --pulse_remaining_samples_;
         pulse = pulse_remaining_samples_ ? pulse_height_ : pulse_height_ - 1.0;
@@ -150,14 +150,14 @@ class AnalogSnareDrum {
         pulse = pulse_;
       }
       
-      double sustain_gain_value = sustain_gain.Next();
+      real_t sustain_gain_value = sustain_gain.Next();
       
       // R189 / C57 / R190 + C58 / C59 / R197 / R196 / IC14
       ONE_POLE(pulse_lp_, pulse, 0.75);
       
-      double shell = 0.0;
+      real_t shell = 0.0;
       for (int i = 0; i < kNumModes; ++i) {
-        double excitation = i == 0
+        real_t excitation = i == 0
             ? (pulse - pulse_lp_) + 0.006 * pulse
             : 0.026 * pulse;
         shell += gain[i] * (sustain
@@ -168,7 +168,7 @@ class AnalogSnareDrum {
       shell = stmlib::SoftClip(shell);
       
       // C56 / R194 / Q48 / C54 / R188 / D54
-      double noise = 2.0 * stmlib::Random::GetDouble() - 1.0;
+      real_t noise = 2.0 * stmlib::Random::GetDouble() - 1.0;
       if (noise < 0.0f) noise = 0.0;
       noise_envelope_ *= noise_envelope_decay;
       noise *= (sustain ? sustain_gain_value : noise_envelope_) * snappy * 2.0;
@@ -183,11 +183,11 @@ class AnalogSnareDrum {
 
  private:
   int pulse_remaining_samples_;
-  double pulse_;
-  double pulse_height_;
-  double pulse_lp_;
-  double noise_envelope_;
-  double sustain_gain_;
+  real_t pulse_;
+  real_t pulse_height_;
+  real_t pulse_lp_;
+  real_t noise_envelope_;
+  real_t sustain_gain_;
   
   stmlib::Svf resonator_[kNumModes];
   stmlib::Svf noise_filter_;
@@ -195,6 +195,8 @@ class AnalogSnareDrum {
   // Replace the resonators in "free running" (sustain) mode.
   SineOscillator oscillator_[kNumModes];
   
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(AnalogSnareDrum);
 };
   
@@ -51,12 +51,12 @@ class SquareNoise {
   SquareNoise() { }
   ~SquareNoise() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
     std::fill(&phase_[0], &phase_[6], 0);
   }
 
-  void Render(double f0, double* temp_1, double* temp_2, double* out, size_t size) {
-    const double ratios[6] = {
+  void Render(real_t f0, real_t* temp_1, real_t* temp_2, real_t* out, size_t size) {
+    const real_t ratios[6] = {
         // Nominal f0: 414 Hz
         1.0, 1.304, 1.466, 1.787, 1.932, 2.536
     };
@@ -64,7 +64,7 @@ class SquareNoise {
     uint32_t increment[6];
     uint32_t phase[6];
     for (int i = 0; i < 6; ++i) {
-      double f = f0 * ratios[i];
+      real_t f = f0 * ratios[i];
       if (f >= 0.499) f = 0.499;
       increment[i] = static_cast<uint32_t>(f * 4294967296.0);
       phase[i] = phase_[i];
@@ -84,7 +84,7 @@ class SquareNoise {
       noise += (phase[3] >> 31);
       noise += (phase[4] >> 31);
       noise += (phase[5] >> 31);
-      *out++ = 0.33 * static_cast<double>(noise) - 1.0;
+      *out++ = 0.33 * static_cast<real_t>(noise) - 1.0;
     }
 
     for (int i = 0; i < 6; ++i) {
@@ -103,21 +103,22 @@ class RingModNoise {
   RingModNoise() { }
   ~RingModNoise() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     for (int i = 0; i < 6; ++i) {
       oscillator_[i].Init();
     }
   }
 
-  void Render(double f0, double* temp_1, double* temp_2, double* out, size_t size) {
-    const double ratio = f0 / (0.01 + f0);
-    const double f1a = 200.0 / kSampleRate * ratio;
-    const double f1b = 7530.0 / kSampleRate * ratio;
-    const double f2a = 510.0 / kSampleRate * ratio;
-    const double f2b = 8075.0 / kSampleRate * ratio;
-    const double f3a = 730.0 / kSampleRate * ratio;
-    const double f3b = 10500.0 / kSampleRate * ratio;
-    const double f[3][2] = { { f1a, f1b }, { f2a, f2b }, { f3a, f3b } };
+  void Render(real_t f0, real_t* temp_1, real_t* temp_2, real_t* out, size_t size) {
+    const real_t ratio = f0 / (0.01 + f0);
+    const real_t f1a = 200.0 / sr_ * ratio;
+    const real_t f1b = 7530.0 / sr_ * ratio;
+    const real_t f2a = 510.0 / sr_ * ratio;
+    const real_t f2b = 8075.0 / sr_ * ratio;
+    const real_t f3a = 730.0 / sr_ * ratio;
+    const real_t f3b = 10500.0 / sr_ * ratio;
+    const real_t f[3][2] = { { f1a, f1b }, { f2a, f2b }, { f3a, f3b } };
 
     std::fill(&out[0], &out[size], 0.0);
     // RenderPair(&oscillator_[0], f1a, f1b, temp_1, temp_2, out, size);
@@ -131,10 +132,10 @@ class RingModNoise {
  private:
   void RenderPair(
       Oscillator* osc,
-      const double* f,
-      double* temp_1,
-      double* temp_2,
-      double* out,
+      const real_t* f,
+      real_t* temp_1,
+      real_t* temp_2,
+      real_t* out,
       size_t size) {
     osc[0].Render<OSCILLATOR_SHAPE_SQUARE>(f[0], 0.5, temp_1, size);
     osc[1].Render<OSCILLATOR_SHAPE_SAW>(f[1], 0.5, temp_2, size);
@@ -144,12 +145,14 @@ class RingModNoise {
   }
   Oscillator oscillator_[6];
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(RingModNoise);
 };
 
 class SwingVCA {
  public:
-  double operator()(double s, double gain) {
+  real_t operator()(real_t s, real_t gain) {
    s *= s > 0.0 ? 10.0 : 0.1;
    s = s / (1.0 + fabs(s));
    return (s + 1.0) * gain;
@@ -158,7 +161,7 @@ class SwingVCA {
 
 class LinearVCA {
  public:
-  double operator()(double s, double gain) {
+  real_t operator()(real_t s, real_t gain) {
    return s * gain;
   }
 };
@@ -173,13 +176,14 @@ class HiHat {
   HiHat() { }
   ~HiHat() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     envelope_ = 0.0;
     noise_clock_ = 0.0;
     noise_sample_ = 0.0;
     sustain_gain_ = 0.0;
 
-    metallic_noise_.Init();
+    metallic_noise_.Init(dsp);
     noise_coloration_svf_.Init();
     hpf_.Init();
   }
@@ -187,18 +191,18 @@ class HiHat {
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double tone,
-      double decay,
-      double noisiness,
-      double* temp_1,
-      double* temp_2,
-      double* out,
+      real_t accent,
+      real_t f0,
+      real_t tone,
+      real_t decay,
+      real_t noisiness,
+      real_t* temp_1,
+      real_t* temp_2,
+      real_t* out,
       size_t size) {
-    const double envelope_decay = 1.0 - 0.003 * stmlib::SemitonesToRatio(
+    const real_t envelope_decay = 1.0 - 0.003 * stmlib::SemitonesToRatio(
         -decay * 84.0);
-    const double cut_decay = 1.0 - 0.0025 * stmlib::SemitonesToRatio(
+    const real_t cut_decay = 1.0 - 0.0025 * stmlib::SemitonesToRatio(
         -decay * 36.0);
 
     if (trigger) {
@@ -209,9 +213,9 @@ class HiHat {
     metallic_noise_.Render(2.0 * f0, temp_1, temp_2, out, size);
 
     // Apply BPF on the metallic noise.
-    double cutoff = 150.0 / kSampleRate * stmlib::SemitonesToRatio(
+    real_t cutoff = 150.0 / sr_ * stmlib::SemitonesToRatio(
         tone * 72.0);
-    CONSTRAIN(cutoff, 0.0, 16000.0 / kSampleRate);
+    CONSTRAIN(cutoff, 0.0, 16000.0 / sr_);
     noise_coloration_svf_.set_f_q<stmlib::FREQUENCY_ACCURATE>(
         cutoff, resonance ? 3.0 + 3.0 * tone : 1.0);
     noise_coloration_svf_.Process<stmlib::FILTER_MODE_BAND_PASS>(
@@ -221,7 +225,7 @@ class HiHat {
     // add a variable amount of clocked noise to the output of the 6 schmitt
     // trigger oscillators.
     noisiness *= noisiness;
-    double noise_f = f0 * (16.0 + 16.0 * (1.0 - noisiness));
+    real_t noise_f = f0 * (16.0 + 16.0 * (1.0 - noisiness));
     CONSTRAIN(noise_f, 0.0, 0.5);
 
     for (size_t i = 0; i < size; ++i) {
@@ -251,15 +255,17 @@ class HiHat {
   }
 
  private:
-  double envelope_;
-  double noise_clock_;
-  double noise_sample_;
-  double sustain_gain_;
+  real_t envelope_;
+  real_t noise_clock_;
+  real_t noise_sample_;
+  real_t sustain_gain_;
 
   MetallicNoiseSource metallic_noise_;
   stmlib::Svf noise_coloration_svf_;
   stmlib::Svf hpf_;
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(HiHat);
 };
 
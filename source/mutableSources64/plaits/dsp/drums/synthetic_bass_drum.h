@@ -45,24 +45,27 @@ class SyntheticBassDrumClick {
   SyntheticBassDrumClick() { }
   ~SyntheticBassDrumClick() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     lp_ = 0.0;
     hp_ = 0.0;
     filter_.Init();
-      filter_.set_f_q<stmlib::FREQUENCY_FAST>(5000.0 / kSampleRate, 2.0);
+      filter_.set_f_q<stmlib::FREQUENCY_FAST>(5000.0 / sr_, 2.0);
   }
 
-  double Process(double in) {
+  real_t Process(real_t in) {
     SLOPE(lp_, in, 0.5, 0.1);
     ONE_POLE(hp_, lp_, 0.04);
     return filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(lp_ - hp_);
   }
 
  private:
-  double lp_;
-  double hp_;
+  real_t lp_;
+  real_t hp_;
   stmlib::Svf filter_;
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(SyntheticBassDrumClick);
 };
 
@@ -76,16 +79,16 @@ class SyntheticBassDrumAttackNoise {
     hp_ = 0.0;
   }
 
-  double Render() {
-    double sample = stmlib::Random::GetDouble();
+  real_t Render() {
+    real_t sample = stmlib::Random::GetDouble();
     ONE_POLE(lp_, sample, 0.05);
     ONE_POLE(hp_, lp_, 0.005);
     return lp_ - hp_;
   }
 
  private:
-  double lp_;
-  double hp_;
+  real_t lp_;
+  real_t hp_;
 
   DISALLOW_COPY_AND_ASSIGN(SyntheticBassDrumAttackNoise);
 };
@@ -95,7 +98,8 @@ class SyntheticBassDrum {
   SyntheticBassDrum() { }
   ~SyntheticBassDrum() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     phase_ = 0.0;
     phase_noise_ = 0.0;
     f0_ = 0.0;
@@ -110,21 +114,21 @@ class SyntheticBassDrum {
 
       transient_env_ = transient_env_lp_ = 0.0; //vb
 
-    click_.Init();
+    click_.Init(dsp);
     noise_.Init();
   }
 
-  inline double DistortedSine(double phase, double phase_noise, double dirtiness) {
+  inline real_t DistortedSine(real_t phase, real_t phase_noise, real_t dirtiness) {
     phase += phase_noise * dirtiness;
     MAKE_INTEGRAL_FRACTIONAL(phase);
     phase = phase_fractional;
-    double triangle = (phase < 0.5 ? phase : 1.0 - phase) * 4.0 - 1.0;
-    double sine = 2.0 * triangle / (1.0 + fabs(triangle));
-    double clean_sine = Sine(phase + 0.75);
+    real_t triangle = (phase < 0.5 ? phase : 1.0 - phase) * 4.0 - 1.0;
+    real_t sine = 2.0 * triangle / (1.0 + fabs(triangle));
+    real_t clean_sine = Sine(phase + 0.75);
     return sine + (1.0 - dirtiness) * (clean_sine - sine);
   }
 
-  inline double TransistorVCA(double s, double gain) {
+  inline real_t TransistorVCA(real_t s, real_t gain) {
     s = (s - 0.6) * gain;
     return 3.0 * s / (2.0 + fabs(s)) + gain * 0.3;
   }
@@ -132,14 +136,14 @@ class SyntheticBassDrum {
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double tone,
-      double decay,
-      double dirtiness,
-      double fm_envelope_amount,
-      double fm_envelope_decay,
-      double* out,
+      real_t accent,
+      real_t f0,
+      real_t tone,
+      real_t decay,
+      real_t dirtiness,
+      real_t fm_envelope_amount,
+      real_t fm_envelope_decay,
+      real_t* out,
       size_t size) {
     decay *= decay;
     fm_envelope_decay *= fm_envelope_decay;
@@ -147,23 +151,22 @@ class SyntheticBassDrum {
     stmlib::ParameterInterpolator f0_mod(&f0_, f0, size);
 
     dirtiness *= std::max(1.0 - 8.0 * f0, 0.0);
-      //const double sr = Dsp::getSr();
-    const double fm_decay = 1.0 - \
-        1.0 / (0.008 * (1.0 + fm_envelope_decay * 4.0) * kSampleRate);
+    const real_t fm_decay = 1.0 - \
+        1.0 / (0.008 * (1.0 + fm_envelope_decay * 4.0) * sr_);
 
-    const double body_env_decay = 1.0 - 1.0 / (0.02 * kSampleRate) * \
+    const real_t body_env_decay = 1.0 - 1.0 / (0.02 * sr_) * \
         stmlib::SemitonesToRatio(-decay * 60.0);
-    const double transient_env_decay = 1.0 - 1.0 / (0.005 * kSampleRate);
-    const double tone_f = std::min(
+    const real_t transient_env_decay = 1.0 - 1.0 / (0.005 * sr_);
+    const real_t tone_f = std::min(
         4.0 * f0 * stmlib::SemitonesToRatio(tone * 108.0),
         1.0);
-    const double transient_level = tone;
+    const real_t transient_level = tone;
 
     if (trigger) {
       fm_ = 1.0;
       body_env_ = transient_env_ = 0.3 + 0.7 * accent;
-      body_env_pulse_width_ = kSampleRate * 0.001;
-      fm_pulse_width_ = kSampleRate * 0.0013;
+      body_env_pulse_width_ = sr_ * 0.001;
+      fm_pulse_width_ = sr_ * 0.0013;
     }
 
     stmlib::ParameterInterpolator sustain_gain(
@@ -174,14 +177,14 @@ class SyntheticBassDrum {
     while (size--) {
       ONE_POLE(phase_noise_, stmlib::Random::GetDouble() - 0.5, 0.002);
 
-      double mix = 0.0;
+      real_t mix = 0.0;
 
       if (sustain) {
         phase_ += f0_mod.Next();
         if (phase_ >= 1.0) {
           phase_ -= 1.0;
         }
-        double body = DistortedSine(phase_, phase_noise_, dirtiness);
+        real_t body = DistortedSine(phase_, phase_noise_, dirtiness);
         mix -= TransistorVCA(body, sustain_gain.Next());
       } else {
         if (fm_pulse_width_) {
@@ -189,8 +192,8 @@ class SyntheticBassDrum {
           phase_ = 0.25;
         } else {
           fm_ *= fm_decay;
-          double fm = 1.0 + fm_envelope_amount * 3.5 * fm_lp_;
-          phase_ += std::min(f0_mod.Next() * fm, 0.5);
+          real_t fm = 1.0 + fm_envelope_amount * 3.5 * fm_lp_;
+          phase_ += std::min(f0_mod.Next() * fm, real_t(0.5));
           if (phase_ >= 1.0) {
             phase_ -= 1.0;
           }
@@ -203,13 +206,13 @@ class SyntheticBassDrum {
           transient_env_ *= transient_env_decay;
         }
 
-        const double envelope_lp_f = 0.1;
+        const real_t envelope_lp_f = 0.1;
         ONE_POLE(body_env_lp_, body_env_, envelope_lp_f);
         ONE_POLE(transient_env_lp_, transient_env_, envelope_lp_f);
         ONE_POLE(fm_lp_, fm_, envelope_lp_f);
 
-        double body = DistortedSine(phase_, phase_noise_, dirtiness);
-        double transient = click_.Process(
+        real_t body = DistortedSine(phase_, phase_noise_, dirtiness);
+        real_t transient = click_.Process(
             body_env_pulse_width_ ? 0.0 : 1.0) + noise_.Render();
 
         mix -= TransistorVCA(body, body_env_lp_);
@@ -222,20 +225,20 @@ class SyntheticBassDrum {
   }
 
  private:
-  double f0_;
-  double phase_;
-  double phase_noise_;
+  real_t f0_;
+  real_t phase_;
+  real_t phase_noise_;
 
-  double fm_;
-  double fm_lp_;
-  double body_env_;
-  double body_env_lp_;
-  double transient_env_;
-  double transient_env_lp_;
+  real_t fm_;
+  real_t fm_lp_;
+  real_t body_env_;
+  real_t body_env_lp_;
+  real_t transient_env_;
+  real_t transient_env_lp_;
 
-  double sustain_gain_;
+  real_t sustain_gain_;
 
-  double tone_lp_;
+  real_t tone_lp_;
 
   SyntheticBassDrumClick click_;
   SyntheticBassDrumAttackNoise noise_;
@@ -243,6 +246,8 @@ class SyntheticBassDrum {
   int body_env_pulse_width_;
   int fm_pulse_width_;
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(SyntheticBassDrum);
 };
 
@@ -49,7 +49,8 @@ class SyntheticSnareDrum {
   SyntheticSnareDrum() { }
   ~SyntheticSnareDrum() { }
 
-  void Init() {
+  void Init(const Dsp& dsp) {
+    sr_ = dsp.getSr();
     phase_[0] = 0.0;
     phase_[1] = 0.0;
     drum_amplitude_ = 0.0;
@@ -63,38 +64,38 @@ class SyntheticSnareDrum {
     snare_lp_.Init();
   }
   
-  inline double DistortedSine(double phase) {
-    double triangle = (phase < 0.5 ? phase : 1.0 - phase) * 4.0 - 1.3;
+  inline real_t DistortedSine(real_t phase) {
+    real_t triangle = (phase < 0.5 ? phase : 1.0 - phase) * 4.0 - 1.3;
     return 2.0 * triangle / (1.0 + fabs(triangle));
   }
   
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double fm_amount,
-      double decay,
-      double snappy,
-      double* out,
+      real_t accent,
+      real_t f0,
+      real_t fm_amount,
+      real_t decay,
+      real_t snappy,
+      real_t* out,
       size_t size) {
-    const double decay_xt = decay * (1.0 + decay * (decay - 1.0));
+    const real_t decay_xt = decay * (1.0 + decay * (decay - 1.0));
     fm_amount *= fm_amount;
-    const double drum_decay = 1.0 - 1.0 / (0.015 * kSampleRate) * \
+    const real_t drum_decay = 1.0 - 1.0 / (0.015 * sr_) * \
         stmlib::SemitonesToRatio(
            -decay_xt * 72.0 - fm_amount * 12.0 + snappy * 7.0);
-    const double snare_decay = 1.0 - 1.0 / (0.01 * kSampleRate) * \
+    const real_t snare_decay = 1.0 - 1.0 / (0.01 * sr_) * \
         stmlib::SemitonesToRatio(-decay * 60.0 - snappy * 7.0);
-    const double fm_decay = 1.0 - 1.0 / (0.007 * kSampleRate);
+    const real_t fm_decay = 1.0 - 1.0 / (0.007 * sr_);
     
     snappy = snappy * 1.1 - 0.05;
     CONSTRAIN(snappy, 0.0, 1.0);
     
-    const double drum_level = stmlib::Sqrt(1.0 - snappy);
-    const double snare_level = stmlib::Sqrt(snappy);
+    const real_t drum_level = stmlib::Sqrt(1.0 - snappy);
+    const real_t snare_level = stmlib::Sqrt(snappy);
     
-    const double snare_f_min = std::min(10.0 * f0, 0.5);
-    const double snare_f_max = std::min(35.0 * f0, 0.5);
+    const real_t snare_f_min = std::min(10.0 * f0, 0.5);
+    const real_t snare_f_max = std::min(35.0 * f0, 0.5);
 
     snare_hp_.set_f<stmlib::FREQUENCY_FAST>(snare_f_min);
     snare_lp_.set_f_q<stmlib::FREQUENCY_FAST>(snare_f_max,
@@ -105,7 +106,7 @@ class SyntheticSnareDrum {
       snare_amplitude_ = drum_amplitude_ = 0.3 + 0.7 * accent;
       fm_ = 1.0;
       phase_[0] = phase_[1] = 0.0;
-      hold_counter_ = static_cast<int>((0.04 + decay * 0.03) * kSampleRate);
+      hold_counter_ = static_cast<int>((0.04 + decay * 0.03) * sr_);
     }
     
     stmlib::ParameterInterpolator sustain_gain(
@@ -136,8 +137,8 @@ class SyntheticSnareDrum {
       // The 909 circuit has a funny kind of oscillator coupling - the signal
       // leaving Q40's collector and resetting all oscillators allow some
       // intermodulation.
-      double reset_noise = 0.0;
-      double reset_noise_amount = (0.125 - f0) * 8.0;
+      real_t reset_noise = 0.0;
+      real_t reset_noise_amount = (0.125 - f0) * 8.0;
       CONSTRAIN(reset_noise_amount, 0.0, 1.0);
       reset_noise_amount *= reset_noise_amount;
       reset_noise_amount *= fm_amount;
@@ -145,7 +146,7 @@ class SyntheticSnareDrum {
       reset_noise += phase_[1] > 0.5 ? -1.0 : 1.0;
       reset_noise *= reset_noise_amount * 0.025;
 
-      double f = f0 * (1.0 + fm_amount * (4.0 * fm_));
+      real_t f = f0 * (1.0 + fm_amount * (4.0 * fm_));
       phase_[0] += f;
       phase_[1] += f * 1.47;
       if (reset_noise_amount > 0.1) {
@@ -164,14 +165,14 @@ class SyntheticSnareDrum {
         }
       }
       
-      double drum = -0.1;
+      real_t drum = -0.1;
       drum += DistortedSine(phase_[0]) * 0.60;
       drum += DistortedSine(phase_[1]) * 0.25;
       drum *= drum_amplitude_ * drum_level;
       drum = drum_lp_.Process<stmlib::FILTER_MODE_LOW_PASS>(drum);
       
-      double noise = stmlib::Random::GetDouble();
-      double snare = snare_lp_.Process<stmlib::FILTER_MODE_LOW_PASS>(noise);
+      real_t noise = stmlib::Random::GetDouble();
+      real_t snare = snare_lp_.Process<stmlib::FILTER_MODE_LOW_PASS>(noise);
       snare = snare_hp_.Process<stmlib::FILTER_MODE_HIGH_PASS>(snare);
       snare = (snare + 0.1) * (snare_amplitude_ + fm_) * snare_level;
       
@@ -180,17 +181,19 @@ class SyntheticSnareDrum {
   }
 
  private:
-  double phase_[2];
-  double drum_amplitude_;
-  double snare_amplitude_;
-  double fm_;
-  double sustain_gain_;
+  real_t phase_[2];
+  real_t drum_amplitude_;
+  real_t snare_amplitude_;
+  real_t fm_;
+  real_t sustain_gain_;
   int hold_counter_;
   
   stmlib::OnePole drum_lp_;
   stmlib::OnePole snare_hp_;
   stmlib::Svf snare_lp_;
   
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(SyntheticSnareDrum);
 };
   
@@ -31,9 +31,6 @@
 
 #include "stmlib/stmlib.h"
 
-extern double kSampleRate;
-extern double a0;
-
 namespace plaits {
     
     //const double kSampleRate = 48000.0;      //48000.0;
@@ -55,26 +52,24 @@ namespace plaits {
     const size_t kMaxBlockSize = 32;   // was 24;
     const size_t kBlockSize = 16;       // 12
     
-    /*
+    // vb, sample rate context. The Voice owns its copy and hands it down
+    // to the engines, so instances can run at different rates side by side.
     class Dsp {
-    private:
-        static double kSampleRate;
-        //const double a0 = (440.0 / 8.0) / kSampleRate;
-        static double a0;
-        static size_t kBlockSize;
-        
     public:
-        static double getSr() {return kSampleRate;}
-        static double getA0() {return a0;}
-        static void setSr(double newsr) {
+        Dsp() { setSr(48000.0); }
+        explicit Dsp(real_t newsr) { setSr(newsr); }
+        
+        real_t getSr() const {return kSampleRate;}
+        real_t getA0() const {return a0;}
+        void setSr(real_t newsr) {
             kSampleRate = newsr;
             a0 = (440.0 / 8.0) / kSampleRate;
         }
-        static size_t getBlockSize() {return kBlockSize;}
-        static void setBlockSize(int newBlockSize) {
-            kBlockSize = static_cast<size_t>(newBlockSize);
-        }
-    };*/
+        
+    private:
+        real_t kSampleRate;
+        real_t a0;
+    };
     
 
 }  // namespace plaits
@@ -40,7 +40,7 @@ using namespace std;
 using namespace stmlib;
 
 void AdditiveEngine::Init(BufferAllocator* allocator) {
-  amplitudes_ = allocator->Allocate<double>(kNumHarmonics);
+  amplitudes_ = allocator->Allocate<real_t>(kNumHarmonics);
   for (int i = 0; i < kNumHarmonicOscillators; ++i) {
     harmonic_oscillator_[i].Init();
   }
@@ -54,26 +54,26 @@ void AdditiveEngine::Reset() {
 }
 
 void AdditiveEngine::UpdateAmplitudes(
-    double centroid,
-    double slope,
-    double bumps,
-    double* amplitudes,
+    real_t centroid,
+    real_t slope,
+    real_t bumps,
+    real_t* amplitudes,
     const int* harmonic_indices,
     size_t num_harmonics) {
-  const double n = (static_cast<double>(num_harmonics) - 1.0);
-  const double margin = (1.0 / slope - 1.0) / (1.0 + bumps);
-  const double center = centroid * (n + margin) - 0.5 * margin;
+  const real_t n = (static_cast<real_t>(num_harmonics) - 1.0);
+  const real_t margin = (1.0 / slope - 1.0) / (1.0 + bumps);
+  const real_t center = centroid * (n + margin) - 0.5 * margin;
 
-  double sum = 0.001;
+  real_t sum = 0.001;
 
   for (size_t i = 0; i < num_harmonics; ++i) {
-    double order = fabs(static_cast<double>(i) - center) * slope;
-    double gain = 1.0 - order;
+    real_t order = fabs(static_cast<real_t>(i) - center) * slope;
+    real_t gain = 1.0 - order;
     gain += fabs(gain);
     gain *= gain;
 
-    double b = 0.25 + order * bumps;
-    double bump_factor = 1.0 + Sine(b);
+    real_t b = 0.25 + order * bumps;
+    real_t bump_factor = 1.0 + Sine(b);
 
     gain *= bump_factor;
     gain *= gain;
@@ -100,9 +100,9 @@ void AdditiveEngine::UpdateAmplitudes(
   }
 }
 
-inline double Bump(double x, double centroid, double slope) {
-  double d = fabs(x - centroid);
-  double bump = 1.0 - d * slope;
+inline real_t Bump(real_t x, real_t centroid, real_t slope) {
+  real_t d = fabs(x - centroid);
+  real_t bump = 1.0 - d * slope;
   return bump + fabs(bump);
 }
 
@@ -117,17 +117,17 @@ const int organ_harmonics[8] = {
 
 void AdditiveEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
 
-  const double centroid = parameters.timbre;
-  const double raw_bumps = parameters.harmonics;
-  const double raw_slope = (1.0 - 0.6 * raw_bumps) * parameters.morph;
-  const double slope = 0.01 + 1.99 * raw_slope * raw_slope * raw_slope;
-  const double bumps = 16.0 * raw_bumps * raw_bumps;
+  const real_t centroid = parameters.timbre;
+  const real_t raw_bumps = parameters.harmonics;
+  const real_t raw_slope = (1.0 - 0.6 * raw_bumps) * parameters.morph;
+  const real_t slope = 0.01 + 1.99 * raw_slope * raw_slope * raw_slope;
+  const real_t bumps = 16.0 * raw_bumps * raw_bumps;
   UpdateAmplitudes(
       centroid,
       slope,
@@ -47,23 +47,23 @@ class AdditiveEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
   void UpdateAmplitudes(
-      double centroid,
-      double slope,
-      double bumps,
-      double* amplitudes,
+      real_t centroid,
+      real_t slope,
+      real_t bumps,
+      real_t* amplitudes,
       const int* harmonic_indices,
       size_t num_harmonics);
 
   HarmonicOscillator<kHarmonicBatchSize> harmonic_oscillator_[kNumHarmonicOscillators];
 
-  double* amplitudes_;
+  real_t* amplitudes_;
 
   DISALLOW_COPY_AND_ASSIGN(AdditiveEngine);
 };
@@ -36,8 +36,8 @@ using namespace std;
 using namespace stmlib;
 
 void BassDrumEngine::Init(BufferAllocator* allocator) {
-  analog_bass_drum_.Init();
-  synthetic_bass_drum_.Init();
+  analog_bass_drum_.Init(dsp_);
+  synthetic_bass_drum_.Init(dsp_);
   overdrive_.Init();
 }
 
@@ -47,15 +47,15 @@ void BassDrumEngine::Reset() {
 
 void BassDrumEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
   
-  const double attack_fm_amount = min(parameters.harmonics * 4.0, 1.0);
-  const double self_fm_amount = max(min(parameters.harmonics * 4.0 - 1.0, 1.0), 0.0);
-  const double drive = max(parameters.harmonics * 2.0 - 1.0, 0.0) * \
+  const real_t attack_fm_amount = min(parameters.harmonics * 4.0, 1.0);
+  const real_t self_fm_amount = max(min(parameters.harmonics * 4.0 - 1.0, 1.0), 0.0);
+  const real_t drive = max(parameters.harmonics * 2.0 - 1.0, 0.0) * \
       max(1.0 - 16.0 * f0, 0.0);
   
   const bool sustain = parameters.trigger & TRIGGER_UNPATCHED;
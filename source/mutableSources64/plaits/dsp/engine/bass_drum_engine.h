@@ -46,8 +46,8 @@ class BassDrumEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
@@ -52,12 +52,12 @@ void ChordEngine::Reset() {
     chords_.Reset();
 }
 
-const double fade_point[kChordNumVoices] = {
+const real_t fade_point[kChordNumVoices] = {
   0.55, 0.47, 0.49, 0.51, 0.53
 };
 
 const int kRegistrationTableSize = 8;
-const double registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
+const real_t registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
   { 0.0, 1.0, 0.0, 0.0, 0.0, 0.0 },  // Square
   { 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 },  // Saw
   { 0.5, 0.0, 0.5, 0.0, 0.0, 0.0 },  // Saw + saw
@@ -69,14 +69,14 @@ const double registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
 };
 
 void ChordEngine::ComputeRegistration(
-    double registration,
-    double* amplitudes) {
+    real_t registration,
+    real_t* amplitudes) {
   registration *= (kRegistrationTableSize - 1.001);
   MAKE_INTEGRAL_FRACTIONAL(registration);
 
   for (int i = 0; i < kChordNumHarmonics * 2; ++i) {
-    double a = registrations[registration_integral][i];
-    double b = registrations[registration_integral + 1][i];
+    real_t a = registrations[registration_integral][i];
+    real_t b = registrations[registration_integral + 1][i];
     amplitudes[i] = a + (b - a) * registration_fractional;
   }
 }
@@ -103,8 +103,8 @@ const int16_t* const wavetable[] = {
 
 void ChordEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   ONE_POLE(morph_lp_, parameters.morph, 0.1f);
@@ -112,14 +112,14 @@ void ChordEngine::Render(
 
   chords_.set_chord(parameters.harmonics);
 
-  double harmonics[kChordNumHarmonics * 2 + 2];
-  double note_amplitudes[kChordNumVoices];
-  double registration = max(1.0 - morph_lp_ * 2.15, 0.0);
+  real_t harmonics[kChordNumHarmonics * 2 + 2];
+  real_t note_amplitudes[kChordNumVoices];
+  real_t registration = max(1.0 - morph_lp_ * 2.15, 0.0);
 
   ComputeRegistration(registration, harmonics);
   harmonics[kChordNumHarmonics * 2] = 0.0;
 
-  double ratios[kChordNumVoices];
+  real_t ratios[kChordNumVoices];
   int aux_note_mask = chords_.ComputeChordInversion(
       timbre_lp_,
       ratios,
@@ -128,18 +128,18 @@ void ChordEngine::Render(
   fill(&out[0], &out[size], 0.0);
   fill(&aux[0], &aux[size], 0.0);
 
-  const double f0 = NoteToFrequency(parameters.note) * 0.998;
-  const double waveform = max((morph_lp_ - 0.535) * 2.15, 0.0);
+  const real_t f0 = NoteToFrequency(parameters.note) * 0.998;
+  const real_t waveform = max((morph_lp_ - 0.535) * 2.15, 0.0);
 
   for (int note = 0; note < kChordNumVoices; ++note) {
-    double wavetable_amount = 50.0 * (morph_lp_ - fade_point[note]);
+    real_t wavetable_amount = 50.0 * (morph_lp_ - fade_point[note]);
     CONSTRAIN(wavetable_amount, 0.0, 1.0);
 
-    double divide_down_amount = 1.0 - wavetable_amount;
-    double* destination = (1 << note) & aux_note_mask ? aux : out;
+    real_t divide_down_amount = 1.0 - wavetable_amount;
+    real_t* destination = (1 << note) & aux_note_mask ? aux : out;
 
-    const double note_f0 = f0 * ratios[note];
-    double divide_down_gain = 4.0 - note_f0 * 32.0;
+    const real_t note_f0 = f0 * ratios[note];
+    real_t divide_down_gain = 4.0 - note_f0 * 32.0;
     CONSTRAIN(divide_down_gain, 0.0, 1.0);
     divide_down_amount *= divide_down_gain;
 
@@ -47,24 +47,24 @@ class ChordEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
-  void ComputeRegistration(double registration, double* amplitudes);
+  void ComputeRegistration(real_t registration, real_t* amplitudes);
   int ComputeChordInversion(
-      double inversion,
-      double* ratios,
-      double* amplitudes);
+      real_t inversion,
+      real_t* ratios,
+      real_t* amplitudes);
 
   StringSynthOscillator divide_down_voice_[kChordNumVoices];
   WavetableOscillator<128, 15> wavetable_voice_[kChordNumVoices];
   ChordBank chords_;
 
-  double morph_lp_;
-  double timbre_lp_;
+  real_t morph_lp_;
+  real_t timbre_lp_;
 
   DISALLOW_COPY_AND_ASSIGN(ChordEngine);
 };
@@ -36,11 +36,10 @@
 
 namespace plaits {
 
-inline double NoteToFrequency(double midi_note) {
+inline real_t NoteToFrequency(real_t midi_note, real_t a0) {
   midi_note -= 9.0;
   CONSTRAIN(midi_note, -128.0, 127.0);
-    //return plaits::Dsp::getA0() * 0.25 * stmlib::SemitonesToRatio(midi_note);
-    return a0 * 0.25 * stmlib::SemitonesToRatio(midi_note);
+  return a0 * 0.25 * stmlib::SemitonesToRatio(midi_note);
 }
 
 enum TriggerState {
@@ -52,17 +51,17 @@ enum TriggerState {
 
 struct EngineParameters {
   int trigger;
-  double note;
-  double timbre;
-  double morph;
-  double harmonics;
-  double accent;
+  real_t note;
+  real_t timbre;
+  real_t morph;
+  real_t harmonics;
+  real_t accent;
 };
 
 struct PostProcessingSettings {
   // A negative value indicates that a limiter must be used.
-  double out_gain;
-  double aux_gain;
+  real_t out_gain;
+  real_t aux_gain;
 
   // When this flag is set to true, the engine declares that it will
   // render a signal that already has an envelope (eg: modal drum, 808 kick).
@@ -86,12 +85,22 @@ class Engine {
   virtual void LoadUserData(const uint8_t* user_data) {};
   virtual void Render(
       const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped) = 0;
 
+  // vb, has to be called before Init()
+  inline void set_dsp(const Dsp& dsp) { dsp_ = dsp; }
+
   PostProcessingSettings post_processing_settings;
+  
+ protected:
+  inline real_t NoteToFrequency(real_t midi_note) const {
+    return plaits::NoteToFrequency(midi_note, dsp_.getA0());
+  }
+  
+  Dsp dsp_;
 };
 
 template<int max_size>
@@ -111,8 +120,8 @@ class EngineRegistry {
   void RegisterInstance(
       Engine* instance,
       bool already_enveloped,
-      double out_gain,
-      double aux_gain) {
+      real_t out_gain,
+      real_t aux_gain) {
     if (num_engines_ >= max_size) {
       return;
     }
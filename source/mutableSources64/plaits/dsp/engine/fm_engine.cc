@@ -43,9 +43,8 @@ void FMEngine::Init(BufferAllocator* allocator) {
   modulator_phase_ = 0;
   sub_phase_ = 0;
 
-    //int a0 = plaits::Dsp::getA0();
-  previous_carrier_frequency_ = a0;
-  previous_modulator_frequency_ = a0;
+  previous_carrier_frequency_ = dsp_.getA0();
+  previous_modulator_frequency_ = dsp_.getA0();
   previous_amount_ = 0.0;
   previous_feedback_ = 0.0;
   previous_sample_ = 0.0;
@@ -60,25 +59,25 @@ void FMEngine::Reset() {
 
 void FMEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
 
   // 4x oversampling
-  const double note = parameters.note - 24.0;
+  const real_t note = parameters.note - 24.0;
 
-  const double ratio = Interpolate(
+  const real_t ratio = Interpolate(
       lut_fm_frequency_quantizer,
       parameters.harmonics,
       128.0);
 
-  double modulator_note = note + ratio;
-  double target_modulator_frequency = NoteToFrequency(modulator_note);
+  real_t modulator_note = note + ratio;
+  real_t target_modulator_frequency = NoteToFrequency(modulator_note);
   CONSTRAIN(target_modulator_frequency, 0.0, 0.5);
 
   // Reduce the maximum FM index for high pitched notes, to prevent aliasing.
-  double hf_taming = 1.0 - (modulator_note - 72.0) * 0.025;
+  real_t hf_taming = 1.0 - (modulator_note - 72.0) * 0.025;
   CONSTRAIN(hf_taming, 0.0, 1.0);
   hf_taming *= hf_taming;
 
@@ -97,24 +96,24 @@ void FMEngine::Render(
   Downsampler sub_downsampler(&sub_fir_);
 
   while (size--) {
-    const double max_uint32 = 4294967296.0;
-    const double amount = amount_modulation.Next();
-    const double feedback = feedback_modulation.Next();
-    double phase_feedback = feedback < 0.0 ? 0.5 * feedback * feedback : 0.0;
+    const real_t max_uint32 = 4294967296.0;
+    const real_t amount = amount_modulation.Next();
+    const real_t feedback = feedback_modulation.Next();
+    real_t phase_feedback = feedback < 0.0 ? 0.5 * feedback * feedback : 0.0;
     const uint32_t carrier_increment = static_cast<uint32_t>(
         max_uint32 * carrier_frequency.Next());
-    double _modulator_frequency = modulator_frequency.Next();
+    real_t _modulator_frequency = modulator_frequency.Next();
 
     for (size_t j = 0; j < kOversampling; ++j) {
       modulator_phase_ += static_cast<uint32_t>(max_uint32 * \
            _modulator_frequency * (1.0 + previous_sample_ * phase_feedback));
       carrier_phase_ += carrier_increment;
       sub_phase_ += carrier_increment >> 1;
-      double modulator_fb = feedback > 0.0 ? 0.25 * feedback * feedback : 0.0;
-      double modulator = SinePM(
+      real_t modulator_fb = feedback > 0.0 ? 0.25 * feedback * feedback : 0.0;
+      real_t modulator = SinePM(
           modulator_phase_, modulator_fb * previous_sample_);
-      double carrier = SinePM(carrier_phase_, amount * modulator);
-      double sub = SinePM(sub_phase_, amount * carrier * 0.25);
+      real_t carrier = SinePM(carrier_phase_, amount * modulator);
+      real_t sub = SinePM(sub_phase_, amount * carrier * 0.25);
       ONE_POLE(previous_sample_, carrier, 0.05);
       carrier_downsampler.Accumulate(j, carrier);
       sub_downsampler.Accumulate(j, sub);
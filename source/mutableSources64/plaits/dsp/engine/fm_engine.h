@@ -41,8 +41,8 @@ class FMEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
@@ -51,14 +51,14 @@ class FMEngine : public Engine {
   uint32_t modulator_phase_;
   uint32_t sub_phase_;
 
-  double previous_carrier_frequency_;
-  double previous_modulator_frequency_;
-  double previous_amount_;
-  double previous_feedback_;
-  double previous_sample_;
+  real_t previous_carrier_frequency_;
+  real_t previous_modulator_frequency_;
+  real_t previous_amount_;
+  real_t previous_feedback_;
+  real_t previous_sample_;
 
-  double sub_fir_;
-  double carrier_fir_;
+  real_t sub_fir_;
+  real_t carrier_fir_;
 
   DISALLOW_COPY_AND_ASSIGN(FMEngine);
 };
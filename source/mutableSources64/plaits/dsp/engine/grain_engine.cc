@@ -50,21 +50,21 @@ void GrainEngine::Reset() {
 
 void GrainEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped)
     {
-    const double root = parameters.note;
-    const double f0 = NoteToFrequency(root);
+    const real_t root = parameters.note;
+    const real_t f0 = NoteToFrequency(root);
 
-    const double f1 = NoteToFrequency(24.0 + 84.0 * parameters.timbre);
-    const double ratio = SemitonesToRatio(-24.0 + 48.0 * parameters.harmonics);
-    const double carrier_bleed = parameters.harmonics < 0.5
+    const real_t f1 = NoteToFrequency(24.0 + 84.0 * parameters.timbre);
+    const real_t ratio = SemitonesToRatio(-24.0 + 48.0 * parameters.harmonics);
+    const real_t carrier_bleed = parameters.harmonics < 0.5
       ? 1.0 - 2.0 * parameters.harmonics
       : 0.0;
-    const double carrier_bleed_fixed = carrier_bleed * (2.0 - carrier_bleed);
-    const double carrier_shape = 0.33 + (parameters.morph - 0.33) * \
+    const real_t carrier_bleed_fixed = carrier_bleed * (2.0 - carrier_bleed);
+    const real_t carrier_shape = 0.33 + (parameters.morph - 0.33) * \
       max(1.0 - f0 * 24.0, 0.0);
   
     grainlet_[0].Render(f0, f1, carrier_shape, carrier_bleed_fixed, out, size);
@@ -74,7 +74,7 @@ void GrainEngine::Render(
         out[i] = dc_blocker_[0].Process<FILTER_MODE_HIGH_PASS>(out[i] + aux[i]);
     }
 
-    const double cutoff = NoteToFrequency(root + 96.0 * parameters.timbre);
+    const real_t cutoff = NoteToFrequency(root + 96.0 * parameters.timbre);
     z_oscillator_.Render(
         f0,
         cutoff,
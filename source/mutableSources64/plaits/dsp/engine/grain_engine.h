@@ -48,8 +48,8 @@ class GrainEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
     
@@ -59,7 +59,7 @@ class GrainEngine : public Engine {
   ZOscillator z_oscillator_;
   stmlib::OnePole dc_blocker_[2];
   
-  double grain_balance_;
+  real_t grain_balance_;
   
   DISALLOW_COPY_AND_ASSIGN(GrainEngine);
 };
@@ -34,9 +34,9 @@ namespace plaits {
 using namespace stmlib;
 
 void HiHatEngine::Init(BufferAllocator* allocator) {
-  hi_hat_1_.Init();
-  hi_hat_2_.Init();
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize * 2);
+  hi_hat_1_.Init(dsp_);
+  hi_hat_2_.Init(dsp_);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize * 2);
 }
 
 void HiHatEngine::Reset() {
@@ -45,11 +45,11 @@ void HiHatEngine::Reset() {
 
 void HiHatEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
 
   hi_hat_1_.Render(
       parameters.trigger & TRIGGER_UNPATCHED,
@@ -44,8 +44,8 @@ class HiHatEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
@@ -53,7 +53,7 @@ class HiHatEngine : public Engine {
   HiHat<SquareNoise, SwingVCA, true, false> hi_hat_1_;
   HiHat<RingModNoise, LinearVCA, false, false> hi_hat_2_;
 
-  double* temp_buffer_;
+  real_t* temp_buffer_;
 
   DISALLOW_COPY_AND_ASSIGN(HiHatEngine);
 };
@@ -36,7 +36,7 @@ using namespace std;
 using namespace stmlib;
 
 void ModalEngine::Init(BufferAllocator* allocator) {
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize);
   harmonics_lp_ = 0.0;
   Reset();
 }
@@ -47,8 +47,8 @@ void ModalEngine::Reset() {
 
 void ModalEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   fill(&out[0], &out[size], 0.0);
@@ -43,15 +43,15 @@ class ModalEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
   
  private:
   ModalVoice voice_;
-  double* temp_buffer_;
-  double harmonics_lp_;
+  real_t* temp_buffer_;
+  real_t harmonics_lp_;
   
   DISALLOW_COPY_AND_ASSIGN(ModalEngine);
 };
@@ -46,7 +46,7 @@ void NoiseEngine::Init(BufferAllocator* allocator) {
   previous_q_ = 0.0;
   previous_mode_ = 0.0;
 
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize);
 }
 
 void NoiseEngine::Reset() {
@@ -55,19 +55,19 @@ void NoiseEngine::Reset() {
 
 void NoiseEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
-  const double f1 = NoteToFrequency(
+  const real_t f0 = NoteToFrequency(parameters.note);
+  const real_t f1 = NoteToFrequency(
       parameters.note + parameters.harmonics * 48.0 - 24.0);
-  const double clock_lowest_note = parameters.trigger & TRIGGER_UNPATCHED
+  const real_t clock_lowest_note = parameters.trigger & TRIGGER_UNPATCHED
       ? 0.0
       : -24.0;
-  const double clock_f = NoteToFrequency(
+  const real_t clock_f = NoteToFrequency(
       parameters.timbre * (128.0 - clock_lowest_note) + clock_lowest_note);
-  const double q = 0.5 * SemitonesToRatio(parameters.morph * 120.0);
+  const real_t q = 0.5 * SemitonesToRatio(parameters.morph * 120.0);
   const bool sync = parameters.trigger & TRIGGER_RISING_EDGE;
   clocked_noise_[0].Render(sync, clock_f, aux, size);
   clocked_noise_[1].Render(sync, clock_f * f1 / f0, temp_buffer_, size);
@@ -78,19 +78,19 @@ void NoiseEngine::Render(
   ParameterInterpolator mode_modulation(
       &previous_mode_, parameters.harmonics, size);
   
-  const double* in_1 = aux;
-  const double* in_2 = temp_buffer_;
+  const real_t* in_1 = aux;
+  const real_t* in_2 = temp_buffer_;
   while (size--) {
-    const double f0 = f0_modulation.Next();
-    const double f1 = f1_modulation.Next();
-    const double q = q_modulation.Next();
-    const double gain = 1.0 / Sqrt((0.5 + q) * 40. * f0);
+    const real_t f0 = f0_modulation.Next();
+    const real_t f1 = f1_modulation.Next();
+    const real_t q = q_modulation.Next();
+    const real_t gain = 1.0 / Sqrt((0.5 + q) * 40. * f0);
     lp_hp_filter_.set_f_q<FREQUENCY_ACCURATE>(f0, q);
     bp_filter_[0].set_f_q<FREQUENCY_ACCURATE>(f0, q);
     bp_filter_[1].set_f_q<FREQUENCY_ACCURATE>(f1, q);
     
-    double input_1 = *in_1++ * gain;
-    double input_2 = *in_2++ * gain;
+    real_t input_1 = *in_1++ * gain;
+    real_t input_2 = *in_2++ * gain;
     lp_hp_filter_.ProcessMultimodeLPtoHP(
         &input_1, out++, 1, mode_modulation.Next());
     *aux++ = bp_filter_[0].Process<FILTER_MODE_BAND_PASS>(input_1) + \
@@ -45,8 +45,8 @@ class NoiseEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
   
@@ -55,12 +55,12 @@ class NoiseEngine : public Engine {
   stmlib::Svf lp_hp_filter_;
   stmlib::Svf bp_filter_[2];
   
-  double previous_f0_;
-  double previous_f1_;
-  double previous_q_;
-  double previous_mode_;
+  real_t previous_f0_;
+  real_t previous_f1_;
+  real_t previous_q_;
+  real_t previous_mode_;
   
-  double* temp_buffer_;
+  real_t* temp_buffer_;
   
   DISALLOW_COPY_AND_ASSIGN(NoiseEngine);
 };
@@ -49,23 +49,23 @@ void ParticleEngine::Reset() {
 
 void ParticleEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
-  const double density_sqrt = NoteToFrequency(
+  const real_t f0 = NoteToFrequency(parameters.note);
+  const real_t density_sqrt = NoteToFrequency(
       60.0 + parameters.timbre * parameters.timbre * 72.0);
-  const double density = density_sqrt * density_sqrt * (1.0 / kNumParticles);
-  const double gain = 1.0 / density;
-  const double q_sqrt = SemitonesToRatio(parameters.morph >= 0.5
+  const real_t density = density_sqrt * density_sqrt * (1.0 / kNumParticles);
+  const real_t gain = 1.0 / density;
+  const real_t q_sqrt = SemitonesToRatio(parameters.morph >= 0.5
       ? (parameters.morph - 0.5) * 120.0
       : 0.0);
-  const double q = 0.5 + q_sqrt * q_sqrt;
-  const double spread = 48.0 * parameters.harmonics * parameters.harmonics;
-  const double raw_diffusion_sqrt = 2.0 * fabs(parameters.morph - 0.5);
-  const double raw_diffusion = raw_diffusion_sqrt * raw_diffusion_sqrt;
-  const double diffusion = parameters.morph < 0.5
+  const real_t q = 0.5 + q_sqrt * q_sqrt;
+  const real_t spread = 48.0 * parameters.harmonics * parameters.harmonics;
+  const real_t raw_diffusion_sqrt = 2.0 * fabs(parameters.morph - 0.5);
+  const real_t raw_diffusion = raw_diffusion_sqrt * raw_diffusion_sqrt;
+  const real_t diffusion = parameters.morph < 0.5
       ? raw_diffusion
       : 0.0;
   const bool sync = parameters.trigger & TRIGGER_RISING_EDGE;
@@ -86,7 +86,7 @@ void ParticleEngine::Render(
         size);
   }
 
-  post_filter_.set_f_q<FREQUENCY_DIRTY>(min(f0, 0.49), 0.5);
+  post_filter_.set_f_q<FREQUENCY_DIRTY>(min(f0, real_t(0.49)), 0.5);
   post_filter_.Process<FILTER_MODE_LOW_PASS>(out, out, size);
 
   diffuser_.Process(
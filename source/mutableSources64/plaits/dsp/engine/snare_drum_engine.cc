@@ -36,8 +36,8 @@ using namespace std;
 using namespace stmlib;
 
 void SnareDrumEngine::Init(BufferAllocator* allocator) {
-  analog_snare_drum_.Init();
-  synthetic_snare_drum_.Init();
+  analog_snare_drum_.Init(dsp_);
+  synthetic_snare_drum_.Init(dsp_);
 }
 
 void SnareDrumEngine::Reset() {
@@ -46,11 +46,11 @@ void SnareDrumEngine::Reset() {
 
 void SnareDrumEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
   
   analog_snare_drum_.Render(
       parameters.trigger & TRIGGER_UNPATCHED,
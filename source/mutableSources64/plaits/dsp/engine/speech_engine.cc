@@ -36,17 +36,17 @@ using namespace std;
 using namespace stmlib;
 
 void SpeechEngine::Init(BufferAllocator* allocator) {
-  sam_speech_synth_.Init();
-  naive_speech_synth_.Init();
+  sam_speech_synth_.Init(dsp_);
+  naive_speech_synth_.Init(dsp_);
   lpc_speech_synth_word_bank_.Init(
       word_banks_,
       LPC_SPEECH_SYNTH_NUM_WORD_BANKS,
       allocator);
-  lpc_speech_synth_controller_.Init(&lpc_speech_synth_word_bank_);
+  lpc_speech_synth_controller_.Init(&lpc_speech_synth_word_bank_, dsp_);
   word_bank_quantizer_.Init(LPC_SPEECH_SYNTH_NUM_WORD_BANKS + 1, 0.1f, false);
 
-  temp_buffer_[0] = allocator->Allocate<double>(kMaxBlockSize);
-  temp_buffer_[1] = allocator->Allocate<double>(kMaxBlockSize);
+  temp_buffer_[0] = allocator->Allocate<real_t>(kMaxBlockSize);
+  temp_buffer_[1] = allocator->Allocate<real_t>(kMaxBlockSize);
 
   prosody_amount_ = 0.0;
   speed_ = 0.0;
@@ -58,19 +58,19 @@ void SpeechEngine::Reset() {
 
 void SpeechEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
 
-  const double group = parameters.harmonics * 6.0;
+  const real_t group = parameters.harmonics * 6.0;
 
   // Interpolates between the 3 models: naive, SAM, LPC.
   if (group <= 2.0) {
     *already_enveloped = false;
 
-    double blend = group;
+    real_t blend = group;
     if (group <= 1.0f) {
       naive_speech_synth_.Render(
           parameters.trigger == TRIGGER_RISING_EDGE,
@@ -47,16 +47,16 @@ class SpeechEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
-  inline void set_prosody_amount(double prosody_amount) {
+  inline void set_prosody_amount(real_t prosody_amount) {
     prosody_amount_ = prosody_amount;
   }
 
-  inline void set_speed(double speed) {
+  inline void set_speed(real_t speed) {
     speed_ = speed;
   }
 
@@ -69,9 +69,9 @@ class SpeechEngine : public Engine {
   LPCSpeechSynthController lpc_speech_synth_controller_;
   LPCSpeechSynthWordBank lpc_speech_synth_word_bank_;
 
-  double* temp_buffer_[2];
-  double prosody_amount_;
-  double speed_;
+  real_t* temp_buffer_[2];
+  real_t prosody_amount_;
+  real_t speed_;
 
   DISALLOW_COPY_AND_ASSIGN(SpeechEngine);
 };
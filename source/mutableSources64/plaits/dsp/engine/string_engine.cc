@@ -36,13 +36,13 @@ using namespace std;
 using namespace stmlib;
 
 void StringEngine::Init(BufferAllocator* allocator) {
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize);
   for (int i = 0; i < kNumStrings; ++i) {
-    voice_[i].Init(allocator);
+    voice_[i].Init(allocator, dsp_);
     f0_[i] = 0.01;
   }
   active_string_ = kNumStrings - 1;
-  f0_delay_.Init(allocator->Allocate<double>(16));
+  f0_delay_.Init(allocator->Allocate<real_t>(16));
 }
 
 void StringEngine::Reset() {
@@ -54,8 +54,8 @@ void StringEngine::Reset() {
 
 void StringEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   if (parameters.trigger & TRIGGER_RISING_EDGE) { // TODO: do we need this delay?
@@ -65,7 +65,7 @@ void StringEngine::Render(
     active_string_ = (active_string_ + 1) % kNumStrings;
   }
   
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
   f0_[active_string_] = f0;
   f0_delay_.Write(f0);
   
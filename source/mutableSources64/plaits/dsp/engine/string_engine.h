@@ -45,18 +45,18 @@ class StringEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
   StringVoice voice_[kNumStrings];
 
-  double f0_[kNumStrings];
-  DelayLine<double, 16> f0_delay_;
+  real_t f0_[kNumStrings];
+  DelayLine<real_t, 16> f0_delay_;
   int active_string_;
-  double* temp_buffer_;
+  real_t* temp_buffer_;
   
   DISALLOW_COPY_AND_ASSIGN(StringEngine);
 };
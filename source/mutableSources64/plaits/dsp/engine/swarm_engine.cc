@@ -40,26 +40,26 @@ void SwarmEngine::Init(BufferAllocator* allocator) {
 }
 
 void SwarmEngine::Reset() {
-  const double n = (kNumSwarmVoices - 1) / 2;
+  const real_t n = (kNumSwarmVoices - 1) / 2;
   for (int i = 0; i < kNumSwarmVoices; ++i) {
-    double rank = (static_cast<double>(i) - n) / n;
+    real_t rank = (static_cast<real_t>(i) - n) / n;
     swarm_voice_[i].Init(rank);
   }
 }
 
 void SwarmEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
-  const double control_rate = static_cast<double>(size);
-  const double density = NoteToFrequency(parameters.timbre * 120.0) * \
+  const real_t f0 = NoteToFrequency(parameters.note);
+  const real_t control_rate = static_cast<real_t>(size);
+  const real_t density = NoteToFrequency(parameters.timbre * 120.0) * \
       0.025 * control_rate;
-  const double spread = parameters.harmonics * parameters.harmonics * \
+  const real_t spread = parameters.harmonics * parameters.harmonics * \
       parameters.harmonics;
-  double size_ratio = 0.25 * SemitonesToRatio(
+  real_t size_ratio = 0.25 * SemitonesToRatio(
       (1.0 - parameters.morph) * 84.0);
 
   const bool burst_mode = !(parameters.trigger & TRIGGER_UNPATCHED);
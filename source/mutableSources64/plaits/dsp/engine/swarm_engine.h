@@ -59,7 +59,7 @@ class GrainEnvelope {
       filter_coefficient_ = 0.0; // vb, add initialization
   }
 
-  inline void Step(double rate, bool burst_mode, bool start_burst) {
+  inline void Step(real_t rate, bool burst_mode, bool start_burst) {
     bool randomize = false;
     if (start_burst) {
       phase_ = 0.5;
@@ -68,7 +68,7 @@ class GrainEnvelope {
     } else {
       phase_ += rate * fm_;
       if (phase_ >= 1.0) {
-        phase_ -= static_cast<double>(static_cast<int>(phase_));
+        phase_ -= static_cast<real_t>(static_cast<int>(phase_));
         randomize = true;
       }
     }
@@ -85,7 +85,7 @@ class GrainEnvelope {
     }
   }
 
-  inline double frequency(double size_ratio) const {
+  inline real_t frequency(real_t size_ratio) const {
     // We approximate two overlapping grains of frequencies f1 and f2
     // By a continuous tone ramping from f1 to f2. This allows a continuous
     // transition between the "grain cloud" and "swarm of glissandi" textures.
@@ -96,12 +96,12 @@ class GrainEnvelope {
     }
   }
 
-  inline double amplitude(double size_ratio) {
-    double target_amplitude = 1.0;
+  inline real_t amplitude(real_t size_ratio) {
+    real_t target_amplitude = 1.0;
     if (size_ratio >= 1.0) {
-      double phase = (phase_ - 0.5) * size_ratio;
+      real_t phase = (phase_ - 0.5) * size_ratio;
       CONSTRAIN(phase, -1.0, 1.0);
-      double e = Sine(0.5 * phase + 1.25);
+      real_t e = Sine(0.5 * phase + 1.25);
       target_amplitude = 0.5 * (e + 1.0);
     }
 
@@ -116,13 +116,13 @@ class GrainEnvelope {
   }
 
  private:
-  double from_;
-  double interval_;
-  double phase_;
-  double fm_;
-  double amplitude_;
-  double previous_size_ratio_;
-  double filter_coefficient_;
+  real_t from_;
+  real_t interval_;
+  real_t phase_;
+  real_t fm_;
+  real_t amplitude_;
+  real_t previous_size_ratio_;
+  real_t filter_coefficient_;
 
   DISALLOW_COPY_AND_ASSIGN(GrainEnvelope);
 };
@@ -140,9 +140,9 @@ class AdditiveSawOscillator {
   }
 
   inline void Render(
-      double frequency,
-      double level,
-      double* out,
+      real_t frequency,
+      real_t level,
+      real_t* out,
       size_t size) {
     if (frequency >= kMaxFrequency) {
       frequency = kMaxFrequency;
@@ -150,20 +150,20 @@ class AdditiveSawOscillator {
     stmlib::ParameterInterpolator fm(&frequency_, frequency, size);
     stmlib::ParameterInterpolator gain(&gain_, level, size);
 
-    double next_sample = next_sample_;
-    double phase = phase_;
+    real_t next_sample = next_sample_;
+    real_t phase = phase_;
 
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double frequency = fm.Next();
+      const real_t frequency = fm.Next();
 
       phase += frequency;
 
       if (phase >= 1.0) {
         phase -= 1.0;
-        double t = phase / frequency;
+        real_t t = phase / frequency;
         this_sample -= stmlib::ThisBlepSample(t);
         next_sample -= stmlib::NextBlepSample(t);
       }
@@ -177,12 +177,12 @@ class AdditiveSawOscillator {
 
  private:
   // Oscillator state.
-  double phase_;
-  double next_sample_;
+  real_t phase_;
+  real_t next_sample_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double gain_;
+  real_t frequency_;
+  real_t gain_;
 
   DISALLOW_COPY_AND_ASSIGN(AdditiveSawOscillator);
 };
@@ -192,7 +192,7 @@ class SwarmVoice {
   SwarmVoice() { }
   ~SwarmVoice() { }
 
-  void Init(double rank) {
+  void Init(real_t rank) {
     rank_ = rank;
     envelope_.Init();
     saw_.Init();
@@ -200,24 +200,24 @@ class SwarmVoice {
   }
 
   void Render(
-      double f0,
-      double density,
+      real_t f0,
+      real_t density,
       bool burst_mode,
       bool start_burst,
-      double spread,
-      double size_ratio,
-      double* saw,
-      double* sine,
+      real_t spread,
+      real_t size_ratio,
+      real_t* saw,
+      real_t* sine,
       size_t size) {
     envelope_.Step(density, burst_mode, start_burst);
 
-    const double scale = 1.0 / kNumSwarmVoices;
-    const double amplitude = envelope_.amplitude(size_ratio) * scale;
+    const real_t scale = 1.0 / kNumSwarmVoices;
+    const real_t amplitude = envelope_.amplitude(size_ratio) * scale;
 
-    const double expo_amount = envelope_.frequency(size_ratio);
+    const real_t expo_amount = envelope_.frequency(size_ratio);
     f0 *= stmlib::SemitonesToRatio(48.0 * expo_amount * spread * rank_);
 
-    const double linear_amount = rank_ * (rank_ + 0.01) * spread * 0.25;
+    const real_t linear_amount = rank_ * (rank_ + 0.01) * spread * 0.25;
     f0 *= 1.0 + linear_amount;
 
     saw_.Render(f0, amplitude, saw, size);
@@ -225,7 +225,7 @@ class SwarmVoice {
   };
 
  private:
-  double rank_;
+  real_t rank_;
 
   GrainEnvelope envelope_;
   AdditiveSawOscillator saw_;
@@ -240,8 +240,8 @@ class SwarmEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
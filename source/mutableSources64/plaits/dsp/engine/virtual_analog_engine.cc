@@ -48,38 +48,38 @@ void VirtualAnalogEngine::Init(BufferAllocator* allocator) {
   auxiliary_amount_ = 0.0;
   xmod_amount_ = 0.0;
 
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize);
 }
 
 void VirtualAnalogEngine::Reset() {
 
 }
 
-const double intervals[5] = {
+const real_t intervals[5] = {
   0.0, 7.01, 12.01, 19.01, 24.01
 };
 
-inline double Squash(double x) {
+inline real_t Squash(real_t x) {
   return x * x * (3.0 - 2.0 * x);
 }
 
-double VirtualAnalogEngine::ComputeDetuning(double detune) const {
+real_t VirtualAnalogEngine::ComputeDetuning(real_t detune) const {
   detune = 2.05 * detune - 1.025;
   CONSTRAIN(detune, -1.0, 1.0);
 
-  double sign = detune < 0.0 ? -1.0 : 1.0;
+  real_t sign = detune < 0.0 ? -1.0 : 1.0;
   detune = detune * sign * 3.9999;
   MAKE_INTEGRAL_FRACTIONAL(detune);
 
-  double a = intervals[detune_integral];
-  double b = intervals[detune_integral + 1];
+  real_t a = intervals[detune_integral];
+  real_t b = intervals[detune_integral + 1];
   return (a + (b - a) * Squash(Squash(detune_fractional))) * sign;
 }
 
 void VirtualAnalogEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
 
@@ -89,22 +89,22 @@ void VirtualAnalogEngine::Render(
   // 2 = variable waveshape controlled by MORPH, detuned by HARMONICS.
   // OUT = 1 + 2.
   // AUX = 1 + sync 2.
-  const double auxiliary_detune = ComputeDetuning(parameters.harmonics);
-  const double primary_f = NoteToFrequency(parameters.note);
-  const double auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
-  const double sync_f = NoteToFrequency(
+  const real_t auxiliary_detune = ComputeDetuning(parameters.harmonics);
+  const real_t primary_f = NoteToFrequency(parameters.note);
+  const real_t auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
+  const real_t sync_f = NoteToFrequency(
       parameters.note + parameters.harmonics * 48.0);
 
-  double shape_1 = parameters.timbre * 1.5;
+  real_t shape_1 = parameters.timbre * 1.5;
   CONSTRAIN(shape_1, 0.0, 1.0);
 
-  double pw_1 = 0.5 + (parameters.timbre - 0.66) * 1.4;
+  real_t pw_1 = 0.5 + (parameters.timbre - 0.66) * 1.4;
   CONSTRAIN(pw_1, 0.5, 0.99);
 
-  double shape_2 = parameters.morph * 1.5;
+  real_t shape_2 = parameters.morph * 1.5;
   CONSTRAIN(shape_2, 0.0, 1.0);
 
-  double pw_2 = 0.5 + (parameters.morph - 0.66) * 1.4;
+  real_t pw_2 = 0.5 + (parameters.morph - 0.66) * 1.4;
   CONSTRAIN(pw_2, 0.5, 0.99);
 
   // primary_.Render<false>(
@@ -129,22 +129,22 @@ void VirtualAnalogEngine::Render(
   // OUT = crossfade between 1 + 2, 1, 1 sync 2 controlled by TIMBRE.
   // AUX = 2.
 
-  double auxiliary_amount = max(0.5 - parameters.timbre, 0.0) * 2.0;
+  real_t auxiliary_amount = max(0.5 - parameters.timbre, 0.0) * 2.0;
   auxiliary_amount *= auxiliary_amount * 0.5;
 
-  const double xmod_amount = max(parameters.timbre - 0.5, 0.0) * 2.0;
-  const double squashed_xmod_amount = xmod_amount * (2.0 - xmod_amount);
+  const real_t xmod_amount = max(parameters.timbre - 0.5, 0.0) * 2.0;
+  const real_t squashed_xmod_amount = xmod_amount * (2.0 - xmod_amount);
 
-  const double auxiliary_detune = ComputeDetuning(parameters.harmonics);
-  const double primary_f = NoteToFrequency(parameters.note);
-  const double auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
-  const double sync_f = primary_f * SemitonesToRatio(
+  const real_t auxiliary_detune = ComputeDetuning(parameters.harmonics);
+  const real_t primary_f = NoteToFrequency(parameters.note);
+  const real_t auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
+  const real_t sync_f = primary_f * SemitonesToRatio(
       xmod_amount * (auxiliary_detune + 36.0));
 
-  double shape = parameters.morph * 1.5;
+  real_t shape = parameters.morph * 1.5;
   CONSTRAIN(shape, 0.0, 1.0);
 
-  double pw = 0.5 + (parameters.morph - 0.66) * 1.4;
+  real_t pw = 0.5 + (parameters.morph - 0.66) * 1.4;
   CONSTRAIN(pw, 0.5, 0.99);
 
   // primary_.Render<false>(primary_f, primary_f, pw, shape, out, size);
@@ -178,19 +178,19 @@ void VirtualAnalogEngine::Render(
   // OUT = 1 + 2.
   // AUX = dual variable waveshape controlled by MORPH, self sync by TIMBRE.
 
-  const double sync_amount = parameters.timbre * parameters.timbre;
-  const double auxiliary_detune = ComputeDetuning(parameters.harmonics);
-  const double primary_f = NoteToFrequency(parameters.note);
-  const double auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
-  const double primary_sync_f = NoteToFrequency(
+  const real_t sync_amount = parameters.timbre * parameters.timbre;
+  const real_t auxiliary_detune = ComputeDetuning(parameters.harmonics);
+  const real_t primary_f = NoteToFrequency(parameters.note);
+  const real_t auxiliary_f = NoteToFrequency(parameters.note + auxiliary_detune);
+  const real_t primary_sync_f = NoteToFrequency(
       parameters.note + sync_amount * 48.0);
-  const double auxiliary_sync_f = NoteToFrequency(
+  const real_t auxiliary_sync_f = NoteToFrequency(
       parameters.note + auxiliary_detune + sync_amount * 48.0);
 
-  double shape = parameters.morph * 1.5;
+  real_t shape = parameters.morph * 1.5;
   CONSTRAIN(shape, 0.0, 1.0);
 
-  double pw = 0.5 + (parameters.morph - 0.66) * 1.46;
+  real_t pw = 0.5 + (parameters.morph - 0.66) * 1.46;
   CONSTRAIN(pw, 0.5, 0.995);
 
   // Render monster sync to AUX.
@@ -203,28 +203,28 @@ void VirtualAnalogEngine::Render(
   }
 
   // Render double varishape to OUT.
-  double square_pw = 1.3 * parameters.timbre - 0.15;
+  real_t square_pw = 1.3 * parameters.timbre - 0.15;
   CONSTRAIN(square_pw, 0.005, 0.5);
 
-  const double square_sync_ratio = parameters.timbre < 0.5
+  const real_t square_sync_ratio = parameters.timbre < 0.5
       ? 0.0
       : (parameters.timbre - 0.5) * (parameters.timbre - 0.5) * 4.0 * 48.0;
 
-  const double square_gain = min(parameters.timbre * 8.0, 1.0);
+  const real_t square_gain = min(parameters.timbre * 8.0, 1.0);
 
-  double saw_pw = parameters.morph < 0.5
+  real_t saw_pw = parameters.morph < 0.5
       ? parameters.morph + 0.5
       : 1.0 - (parameters.morph - 0.5) * 2.0;
   saw_pw *= 1.1;
   CONSTRAIN(saw_pw, 0.005, 1.0);
 
-  double saw_shape = 10.0 - 21.0 * parameters.morph;
+  real_t saw_shape = 10.0 - 21.0 * parameters.morph;
   CONSTRAIN(saw_shape, 0.0, 1.0);
 
-  double saw_gain = 8.0 * (1.0 - parameters.morph);
+  real_t saw_gain = 8.0 * (1.0 - parameters.morph);
   CONSTRAIN(saw_gain, 0.02, 1.0);
 
-  const double square_sync_f = NoteToFrequency(
+  const real_t square_sync_f = NoteToFrequency(
       parameters.note + square_sync_ratio);
 
   // sync_.Render<true>(
@@ -233,7 +233,7 @@ void VirtualAnalogEngine::Render(
       primary_f, square_sync_f, square_pw, 1.0, temp_buffer_, size);
   variable_saw_.Render(auxiliary_f, saw_pw, saw_shape, out, size);
 
-  double norm = 1.0 / (std::max(square_gain, saw_gain));
+  real_t norm = 1.0 / (std::max(square_gain, saw_gain));
 
   ParameterInterpolator square_gain_modulation(
       &auxiliary_amount_,
@@ -46,13 +46,13 @@ class VirtualAnalogEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
   
  private:
-  double ComputeDetuning(double detune) const;
+  real_t ComputeDetuning(real_t detune) const;
   
   VariableShapeOscillator primary_;
   VariableShapeOscillator auxiliary_;
@@ -60,9 +60,9 @@ class VirtualAnalogEngine : public Engine {
   VariableShapeOscillator sync_;
   VariableSawOscillator variable_saw_;
 
-  double auxiliary_amount_;
-  double xmod_amount_;
-  double* temp_buffer_;
+  real_t auxiliary_amount_;
+  real_t xmod_amount_;
+  real_t* temp_buffer_;
   
   DISALLOW_COPY_AND_ASSIGN(VirtualAnalogEngine);
 };
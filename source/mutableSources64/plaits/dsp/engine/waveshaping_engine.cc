@@ -54,24 +54,24 @@ void WaveshapingEngine::Reset() {
 
 }
 
-double Tame(double f0, double harmonics, double order) {
+real_t Tame(real_t f0, real_t harmonics, real_t order) {
   f0 *= harmonics;
-  double max_f = 0.5 / order;
-  double max_amount = 1.0 - (f0 - max_f) / (0.5 - max_f);
+  real_t max_f = 0.5 / order;
+  real_t max_amount = 1.0 - (f0 - max_f) / (0.5 - max_f);
   CONSTRAIN(max_amount, 0.0, 1.0);
   return max_amount * max_amount * max_amount;
 }
 
 void WaveshapingEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double root = parameters.note;
+  const real_t root = parameters.note;
 
-  const double f0 = NoteToFrequency(root);
-  const double pw = parameters.morph * 0.45 + 0.5;
+  const real_t f0 = NoteToFrequency(root);
+  const real_t pw = parameters.morph * 0.45 + 0.5;
 
   // Start from bandlimited slope signal.
   slope_.Render<OSCILLATOR_SHAPE_SLOPE>(f0, pw, out, size);
@@ -79,11 +79,11 @@ void WaveshapingEngine::Render(
 
   // Try to estimate how rich the spectrum is, and reduce the range of the
   // waveshaping control accordingly.
-  const double slope = 3.0 + fabs(parameters.morph - 0.5) * 5.0;
-  const double shape_amount = fabs(parameters.harmonics - 0.5) * 2.0;
-  const double shape_amount_attenuation = Tame(f0, slope, 16.0);
-  const double wavefolder_gain = parameters.timbre;
-  const double wavefolder_gain_attenuation = Tame(
+  const real_t slope = 3.0 + fabs(parameters.morph - 0.5) * 5.0;
+  const real_t shape_amount = fabs(parameters.harmonics - 0.5) * 2.0;
+  const real_t shape_amount_attenuation = Tame(f0, slope, 16.0);
+  const real_t wavefolder_gain = parameters.timbre;
+  const real_t wavefolder_gain_attenuation = Tame(
       f0,
       slope * (3.0 + shape_amount * shape_amount_attenuation * 5.0),
       12.0);
@@ -97,39 +97,39 @@ void WaveshapingEngine::Render(
       &previous_wavefolder_gain_,
       0.03 + 0.46 * wavefolder_gain * wavefolder_gain_attenuation,
       size);
-  const double overtone_gain = parameters.timbre * (2.0 - parameters.timbre);
+  const real_t overtone_gain = parameters.timbre * (2.0 - parameters.timbre);
   ParameterInterpolator overtone_gain_modulation(
       &previous_overtone_gain_,
       overtone_gain * (2.0 - overtone_gain),
       size);
 
   for (size_t i = 0; i < size; ++i) {
-    double shape = shape_modulation.Next() * 3.9999;
+    real_t shape = shape_modulation.Next() * 3.9999;
     MAKE_INTEGRAL_FRACTIONAL(shape);
 
     const int16_t* shape_1 = lookup_table_i16_table[shape_integral];
     const int16_t* shape_2 = lookup_table_i16_table[shape_integral + 1];
 
-    double ws_index = 127.0 * out[i] + 128.0;
+    real_t ws_index = 127.0 * out[i] + 128.0;
     MAKE_INTEGRAL_FRACTIONAL(ws_index)
     ws_index_integral &= 255;
 
-    double x0 = static_cast<double>(shape_1[ws_index_integral]) / 32768.0;
-    double x1 = static_cast<double>(shape_1[ws_index_integral + 1]) / 32768.0;
-    double x = x0 + (x1 - x0) * ws_index_fractional;
+    real_t x0 = static_cast<real_t>(shape_1[ws_index_integral]) / 32768.0;
+    real_t x1 = static_cast<real_t>(shape_1[ws_index_integral + 1]) / 32768.0;
+    real_t x = x0 + (x1 - x0) * ws_index_fractional;
 
-    double y0 = static_cast<double>(shape_2[ws_index_integral]) / 32768.0;
-    double y1 = static_cast<double>(shape_2[ws_index_integral + 1]) / 32768.0;
-    double y = y0 + (y1 - y0) * ws_index_fractional;
+    real_t y0 = static_cast<real_t>(shape_2[ws_index_integral]) / 32768.0;
+    real_t y1 = static_cast<real_t>(shape_2[ws_index_integral + 1]) / 32768.0;
+    real_t y = y0 + (y1 - y0) * ws_index_fractional;
 
-    double mix = x + (y - x) * shape_fractional;
-    double index = mix * wf_gain_modulation.Next() + 0.5;
-    double fold = InterpolateHermite(
+    real_t mix = x + (y - x) * shape_fractional;
+    real_t index = mix * wf_gain_modulation.Next() + 0.5;
+    real_t fold = InterpolateHermite(
         lut_fold + 1, index, 512.0);
-    double fold_2 = -InterpolateHermite(
+    real_t fold_2 = -InterpolateHermite(
         lut_fold_2 + 1, index, 512.0);
 
-    double sine = Sine(aux[i] * 0.25 + 0.5);
+    real_t sine = Sine(aux[i] * 0.25 + 0.5);
     out[i] = fold;
     aux[i] = sine + (fold_2 - sine) * overtone_gain_modulation.Next();
   }
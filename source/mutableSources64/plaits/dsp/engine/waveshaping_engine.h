@@ -42,17 +42,17 @@ class WaveshapingEngine : public Engine {
   virtual void Init(stmlib::BufferAllocator* allocator);
   virtual void Reset();
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
   
  private:
   Oscillator slope_;
   Oscillator triangle_;
-  double previous_shape_;
-  double previous_wavefolder_gain_;
-  double previous_overtone_gain_;
+  real_t previous_shape_;
+  real_t previous_wavefolder_gain_;
+  real_t previous_overtone_gain_;
   
   DISALLOW_COPY_AND_ASSIGN(WaveshapingEngine);
 };
@@ -45,7 +45,7 @@ const int kNumWaves = 192;
 const int kNumCustomWaves = 15;
 
 const size_t kTableSize = 128;
-const double kTableSizeF = double(kTableSize);
+const real_t kTableSizeF = real_t(kTableSize);
 
 void WavetableEngine::Init(BufferAllocator* allocator) {
   phase_ = 0.0;
@@ -61,12 +61,11 @@ void WavetableEngine::Init(BufferAllocator* allocator) {
   previous_x_ = 0.0;
   previous_y_ = 0.0;
   previous_z_ = 0.0;
-    //previous_f0_ = plaits::Dsp::getA0();    //a0;
-  previous_f0_ = a0;
+  previous_f0_ = dsp_.getA0();
 
   diff_out_.Init();
 
-  wave_map_ = allocator->Allocate<const int16_t*>(kNumWavesPerBank);
+  wave_map_ = allocator->Allocate<const int16_t*>(kNumBanks * kNumWavesPerBank);
 }
 
 void WavetableEngine::Reset() {
@@ -93,7 +92,7 @@ void WavetableEngine::LoadUserData(const uint8_t* user_data) {
   }
 }
 
-inline double Clamp(double x, double amount) {
+inline real_t Clamp(real_t x, real_t amount) {
   x = x - 0.5;
   x *= amount;
   CONSTRAIN(x, -0.5, 0.5);
@@ -102,14 +101,14 @@ inline double Clamp(double x, double amount) {
 }
 
 const size_t table_size = 256;
-const double table_size_f = double(table_size);
+const real_t table_size_f = real_t(table_size);
 
-inline double WavetableEngine::ReadWave(
+inline real_t WavetableEngine::ReadWave(
     int x,
     int y,
     int z,
     int phase_integral,
-    double phase_fractional) {
+    real_t phase_fractional) {
 
   return InterpolateWaveHermite(
       wave_map_[x + y * 8 + z * kNumWavesPerBank],
@@ -119,22 +118,22 @@ inline double WavetableEngine::ReadWave(
 
 void WavetableEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
 
   ONE_POLE(x_pre_lp_, parameters.timbre * 6.9999, 0.2);
   ONE_POLE(y_pre_lp_, parameters.morph * 6.9999, 0.2);
   ONE_POLE(z_pre_lp_, parameters.harmonics * 6.9999, 0.05);
 
-  const double x = x_pre_lp_;
-  const double y = y_pre_lp_;
-  const double z = z_pre_lp_;
+  const real_t x = x_pre_lp_;
+  const real_t y = y_pre_lp_;
+  const real_t z = z_pre_lp_;
 
-  const double quantization = min(max(z - 3.0, 0.0), 1.0);
-  const double lp_coefficient = min(
+  const real_t quantization = min(max(z - 3.0, 0.0), 1.0);
+  const real_t lp_coefficient = min(
       max(2.0 * f0 * (4.0 - 3.0 * quantization), 0.01), 0.1);
 
   MAKE_INTEGRAL_FRACTIONAL(x);
@@ -146,27 +145,27 @@ void WavetableEngine::Render(
   z_fractional += quantization * (Clamp(z_fractional, 16.0) - z_fractional);
 
   ParameterInterpolator x_modulation(
-      &previous_x_, static_cast<double>(x_integral) + x_fractional, size);
+      &previous_x_, static_cast<real_t>(x_integral) + x_fractional, size);
   ParameterInterpolator y_modulation(
-      &previous_y_, static_cast<double>(y_integral) + y_fractional, size);
+      &previous_y_, static_cast<real_t>(y_integral) + y_fractional, size);
   ParameterInterpolator z_modulation(
-      &previous_z_, static_cast<double>(z_integral) + z_fractional, size);
+      &previous_z_, static_cast<real_t>(z_integral) + z_fractional, size);
 
   ParameterInterpolator f0_modulation(&previous_f0_, f0, size);
 
   while (size--) {
-    const double f0 = f0_modulation.Next();
+    const real_t f0 = f0_modulation.Next();
 
-    const double gain = (1.0 / (f0 * 131072.0)) * (0.95 - f0);
-    const double cutoff = min(kTableSizeF * f0, 1.0);
+    const real_t gain = (1.0 / (f0 * 131072.0)) * (0.95 - f0);
+    const real_t cutoff = min(kTableSizeF * f0, real_t(1.0));
 
     ONE_POLE(x_lp_, x_modulation.Next(), lp_coefficient);
     ONE_POLE(y_lp_, y_modulation.Next(), lp_coefficient);
     ONE_POLE(z_lp_, z_modulation.Next(), lp_coefficient);
 
-    const double x = x_lp_;
-    const double y = y_lp_;
-    const double z = z_lp_;
+    const real_t x = x_lp_;
+    const real_t y = y_lp_;
+    const real_t z = z_lp_;
 
     MAKE_INTEGRAL_FRACTIONAL(x);
     MAKE_INTEGRAL_FRACTIONAL(y);
@@ -177,7 +176,7 @@ void WavetableEngine::Render(
       phase_ -= 1.0;
     }
 
-    const double p = phase_ * kTableSizeF;
+    const real_t p = phase_ * kTableSizeF;
     MAKE_INTEGRAL_FRACTIONAL(p);
 
     {
@@ -195,30 +194,30 @@ void WavetableEngine::Render(
         z1 = 7 - z1;
       }
 
-      double x0y0z0 = ReadWave(x0, y0, z0, p_integral, p_fractional);
-      double x1y0z0 = ReadWave(x1, y0, z0, p_integral, p_fractional);
-      double xy0z0 = x0y0z0 + (x1y0z0 - x0y0z0) * x_fractional;
+      real_t x0y0z0 = ReadWave(x0, y0, z0, p_integral, p_fractional);
+      real_t x1y0z0 = ReadWave(x1, y0, z0, p_integral, p_fractional);
+      real_t xy0z0 = x0y0z0 + (x1y0z0 - x0y0z0) * x_fractional;
 
-      double x0y1z0 = ReadWave(x0, y1, z0, p_integral, p_fractional);
-      double x1y1z0 = ReadWave(x1, y1, z0, p_integral, p_fractional);
-      double xy1z0 = x0y1z0 + (x1y1z0 - x0y1z0) * x_fractional;
+      real_t x0y1z0 = ReadWave(x0, y1, z0, p_integral, p_fractional);
+      real_t x1y1z0 = ReadWave(x1, y1, z0, p_integral, p_fractional);
+      real_t xy1z0 = x0y1z0 + (x1y1z0 - x0y1z0) * x_fractional;
 
-      double xyz0 = xy0z0 + (xy1z0 - xy0z0) * y_fractional;
+      real_t xyz0 = xy0z0 + (xy1z0 - xy0z0) * y_fractional;
 
-      double x0y0z1 = ReadWave(x0, y0, z1, p_integral, p_fractional);
-      double x1y0z1 = ReadWave(x1, y0, z1, p_integral, p_fractional);
-      double xy0z1 = x0y0z1 + (x1y0z1 - x0y0z1) * x_fractional;
+      real_t x0y0z1 = ReadWave(x0, y0, z1, p_integral, p_fractional);
+      real_t x1y0z1 = ReadWave(x1, y0, z1, p_integral, p_fractional);
+      real_t xy0z1 = x0y0z1 + (x1y0z1 - x0y0z1) * x_fractional;
 
-      double x0y1z1 = ReadWave(x0, y1, z1, p_integral, p_fractional);
-      double x1y1z1 = ReadWave(x1, y1, z1, p_integral, p_fractional);
-      double xy1z1 = x0y1z1 + (x1y1z1 - x0y1z1) * x_fractional;
+      real_t x0y1z1 = ReadWave(x0, y1, z1, p_integral, p_fractional);
+      real_t x1y1z1 = ReadWave(x1, y1, z1, p_integral, p_fractional);
+      real_t xy1z1 = x0y1z1 + (x1y1z1 - x0y1z1) * x_fractional;
 
-      double xyz1 = xy0z1 + (xy1z1 - xy0z1) * y_fractional;
+      real_t xyz1 = xy0z1 + (xy1z1 - xy0z1) * y_fractional;
 
-      double mix = xyz0 + (xyz1 - xyz0) * z_fractional;
+      real_t mix = xyz0 + (xyz1 - xyz0) * z_fractional;
       mix = diff_out_.Process(cutoff, mix) * gain;
       *out++ = mix;
-      *aux++ = static_cast<double>(static_cast<int>(mix * 32.0)) / 32.0;
+      *aux++ = static_cast<real_t>(static_cast<int>(mix * 32.0)) / 32.0;
     }
   }
 }
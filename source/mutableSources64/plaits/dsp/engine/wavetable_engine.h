@@ -44,28 +44,28 @@ class WavetableEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data);
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
-  double ReadWave(int x, int y, int z, int phase_i, double phase_f);
+  real_t ReadWave(int x, int y, int z, int phase_i, real_t phase_f);
 
-  double phase_;
+  real_t phase_;
 
-  double x_pre_lp_;
-  double y_pre_lp_;
-  double z_pre_lp_;
+  real_t x_pre_lp_;
+  real_t y_pre_lp_;
+  real_t z_pre_lp_;
 
-  double x_lp_;
-  double y_lp_;
-  double z_lp_;
+  real_t x_lp_;
+  real_t y_lp_;
+  real_t z_lp_;
 
-  double previous_x_;
-  double previous_y_;
-  double previous_z_;
-  double previous_f0_;
+  real_t previous_x_;
+  real_t previous_y_;
+  real_t previous_z_;
+  real_t previous_f0_;
 
   // Maps a (bank, X, Y) coordinate to a waveform index.
   // This allows all waveforms to be reshuffled by the user to create new maps.
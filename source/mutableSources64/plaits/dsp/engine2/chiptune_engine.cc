@@ -58,14 +58,14 @@ void ChiptuneEngine::Reset() {
 
 void ChiptuneEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = NoteToFrequency(parameters.note);
-  const double shape = parameters.morph * 0.995;
+  const real_t f0 = NoteToFrequency(parameters.note);
+  const real_t shape = parameters.morph * 0.995;
   const bool clocked = !(parameters.trigger & TRIGGER_UNPATCHED);
-  double root_transposition = 1.0;
+  real_t root_transposition = 1.0;
 
   *already_enveloped = clocked;
 
@@ -80,14 +80,14 @@ void ChiptuneEngine::Render(
       arpeggiator_.Clock(chords_.num_notes());
       envelope_state_ = 1.0;
     }
-    const double octave = double(1 << arpeggiator_.octave());
-    const double note_f0 = f0 * chords_.sorted_ratio(
+    const real_t octave = real_t(1 << arpeggiator_.octave());
+    const real_t note_f0 = f0 * chords_.sorted_ratio(
         arpeggiator_.note()) * octave;
     root_transposition = octave;
     voice_[0].Render(note_f0, shape, out, size);
   } else {
-    double ratios[kChordNumVoices];
-    double amplitudes[kChordNumVoices];
+    real_t ratios[kChordNumVoices];
+    real_t amplitudes[kChordNumVoices];
 
     chords_.set_chord(parameters.harmonics);
     chords_.ComputeChordInversion(parameters.timbre, ratios, amplitudes);
@@ -97,7 +97,7 @@ void ChiptuneEngine::Render(
 
     fill(&out[0], &out[size], 0.0);
     for (int voice = 0; voice < kChordNumVoices; ++voice) {
-      const double voice_f0 = f0 * ratios[voice];
+      const real_t voice_f0 = f0 * ratios[voice];
       voice_[voice].Render(voice_f0, shape, aux, size);
       for (size_t j = 0; j < size; ++j) {
         out[j] += aux[j] * amplitudes[voice];
@@ -110,10 +110,10 @@ void ChiptuneEngine::Render(
 
   // Apply envelope if necessary.
   if (envelope_shape_ != NO_ENVELOPE) {
-    const double shape = abs(envelope_shape_);
-    const double decay = 1.0 - \
-        2.0 / kSampleRate * SemitonesToRatio(60.0 * shape) * shape;
-    double aux_envelope_amount = envelope_shape_ * 20.0;
+    const real_t shape = abs(envelope_shape_);
+    const real_t decay = 1.0 - \
+        2.0 / dsp_.getSr() * SemitonesToRatio(60.0 * shape) * shape;
+    real_t aux_envelope_amount = envelope_shape_ * 20.0;
     CONSTRAIN(aux_envelope_amount, 0.0, 1.0);
 
     for (size_t i = 0; i < size; ++i) {
@@ -50,12 +50,12 @@ class ChiptuneEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data) { }
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
-  inline void set_envelope_shape(double envelope_shape) {
+  inline void set_envelope_shape(real_t envelope_shape) {
     envelope_shape_ = envelope_shape;
   }
 
@@ -67,9 +67,9 @@ class ChiptuneEngine : public Engine {
   Arpeggiator arpeggiator_;
   stmlib::HysteresisQuantizer2 arpeggiator_pattern_selector_;
 
-  double envelope_shape_;
-  double envelope_state_;
-  double aux_envelope_amount_;
+  real_t envelope_shape_;
+  real_t envelope_state_;
+  real_t aux_envelope_amount_;
 
   DISALLOW_COPY_AND_ASSIGN(ChiptuneEngine);
 };
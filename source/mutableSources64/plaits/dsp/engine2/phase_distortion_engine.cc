@@ -44,7 +44,7 @@ using namespace stmlib;
 void PhaseDistortionEngine::Init(BufferAllocator* allocator) {
   modulator_.Init();
   shaper_.Init();
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize * 4);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize * 4);
 }
 
 void PhaseDistortionEngine::Reset() {
@@ -53,22 +53,22 @@ void PhaseDistortionEngine::Reset() {
 
 void PhaseDistortionEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
-  const double f0 = 0.5 * NoteToFrequency(parameters.note);
-  const double modulator_f = min(0.25, f0 * SemitonesToRatio(Interpolate(
+  const real_t f0 = 0.5 * NoteToFrequency(parameters.note);
+  const real_t modulator_f = min(real_t(0.25), f0 * SemitonesToRatio(Interpolate(
       lut_fm_frequency_quantizer,
       parameters.harmonics,
       128.0)));
-  const double pw = 0.5 + parameters.morph * 0.49;
-  const double amount = 8.0 * parameters.timbre * parameters.timbre * \
+  const real_t pw = 0.5 + parameters.morph * 0.49;
+  const real_t amount = 8.0 * parameters.timbre * parameters.timbre * \
       (1.0 - modulator_f * 3.8);
 
   // Upsample by 2x
-  double* synced = &temp_buffer_[0];
-  double* free_running = &temp_buffer_[2 * size];
+  real_t* synced = &temp_buffer_[0];
+  real_t* free_running = &temp_buffer_[2 * size];
   shaper_.Render<true, true>(
       f0, modulator_f, pw, 0.0, amount, synced, 2 * size);
   modulator_.Render<false, true>(
@@ -44,15 +44,15 @@ class PhaseDistortionEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data) { }
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
   VariableShapeOscillator shaper_;
   VariableShapeOscillator modulator_;
-  double* temp_buffer_;
+  real_t* temp_buffer_;
 
   DISALLOW_COPY_AND_ASSIGN(PhaseDistortionEngine);
 };
@@ -38,7 +38,7 @@ using namespace fm;
 using namespace std;
 using namespace stmlib;
 
-void FMVoice::Init(fm::Algorithms<6>* algorithms, double sample_rate) {
+void FMVoice::Init(fm::Algorithms<6>* algorithms, real_t sample_rate) {
   voice_.Init(algorithms, sample_rate);
   lfo_.Init(sample_rate);
 
@@ -54,7 +54,7 @@ void FMVoice::Init(fm::Algorithms<6>* algorithms, double sample_rate) {
   patch_ = NULL;
 }
 
-void FMVoice::Render(double* buffer, size_t size) {
+void FMVoice::Render(real_t* buffer, size_t size) {
   if (!patch_) {
     return;
   }
@@ -77,10 +77,10 @@ void SixOpEngine::Init(BufferAllocator* allocator) {
 
   algorithms_.Init();
   for (int i = 0; i < kNumSixOpVoices; ++i) {
-    voice_[i].Init(&algorithms_, kSampleRate);
+    voice_[i].Init(&algorithms_, dsp_.getSr());
   }
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize * 4);
-  acc_buffer_ = allocator->Allocate<double>(kMaxBlockSize * kNumSixOpVoices);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize * 4);
+  acc_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize * kNumSixOpVoices);
   patches_ = allocator->Allocate<fm::Patch>(kNumPatchesPerBank);
 
   active_voice_ = kNumSixOpVoices - 1;
@@ -102,16 +102,16 @@ void SixOpEngine::LoadUserData(const uint8_t* user_data) {
 
 void SixOpEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   int patch_index = patch_index_quantizer_.Process(
       parameters.harmonics * 1.02);
 
   if (parameters.trigger & TRIGGER_UNPATCHED) {
-    const double t = parameters.morph;
-    voice_[0].mutable_lfo()->Scrub(2.0 * kSampleRate * t);
+    const real_t t = parameters.morph;
+    voice_[0].mutable_lfo()->Scrub(2.0 * dsp_.getSr() * t);
 
     for (int i = 0; i < kNumSixOpVoices; ++i) {
       voice_[i].LoadPatch(&patches_[patch_index]);
@@ -134,7 +134,7 @@ void SixOpEngine::Render(
     p->note = parameters.note;
     p->velocity = parameters.accent;
     p->envelope_control = parameters.morph;
-    voice_[active_voice_].mutable_lfo()->Step(double(size));
+    voice_[active_voice_].mutable_lfo()->Step(real_t(size));
 
     for (int i = 0; i < kNumSixOpVoices; ++i) {
       Voice<6>::Parameters* p = voice_[i].mutable_parameters();
@@ -142,7 +142,7 @@ void SixOpEngine::Render(
       p->sustain = false;
       p->gate = (parameters.trigger & TRIGGER_HIGH) && (i == active_voice_);
       if (voice_[i].patch() != voice_[active_voice_].patch()) {
-        voice_[i].mutable_lfo()->Step(double(size));
+        voice_[i].mutable_lfo()->Step(real_t(size));
         voice_[i].set_modulations(voice_[i].lfo());
       } else {
         voice_[i].set_modulations(voice_[active_voice_].lfo());
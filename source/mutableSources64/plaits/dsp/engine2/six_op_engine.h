@@ -46,9 +46,9 @@ class FMVoice {
   FMVoice() { }
   ~FMVoice() { }
 
-  void Init(fm::Algorithms<6>* algorithms, double sample_rate);
+  void Init(fm::Algorithms<6>* algorithms, real_t sample_rate);
   void LoadPatch(const fm::Patch* patch);
-  void Render(double* buffer, size_t size);
+  void Render(real_t* buffer, size_t size);
 
   inline void UnloadPatch() {
     patch_ = NULL;
@@ -93,8 +93,8 @@ class SixOpEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data);
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
@@ -105,8 +105,8 @@ class SixOpEngine : public Engine {
   fm::Algorithms<6> algorithms_;
   fm::Patch* patches_;
   FMVoice voice_[kNumSixOpVoices];
-  double* temp_buffer_;
-  double* acc_buffer_;
+  real_t* temp_buffer_;
+  real_t* acc_buffer_;
   int active_voice_;
   int rendered_voice_;
 
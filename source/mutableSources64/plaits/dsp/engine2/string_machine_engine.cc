@@ -55,7 +55,7 @@ void StringMachineEngine::Reset() {
 }
 
 const int kRegistrationTableSize = 11;
-const double registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
+const real_t registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
   { 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 },    // Saw
   { 0.5, 0.0, 0.5, 0.0, 0.0, 0.0 },    // Saw + saw
   { 0.4, 0.0, 0.2, 0.0, 0.4, 0.0 },    // Full saw
@@ -70,22 +70,22 @@ const double registrations[kRegistrationTableSize][kChordNumHarmonics * 2] = {
 };
 
 void StringMachineEngine::ComputeRegistration(
-    double registration,
-    double* amplitudes) {
+    real_t registration,
+    real_t* amplitudes) {
   registration *= (kRegistrationTableSize - 1.001);
   MAKE_INTEGRAL_FRACTIONAL(registration);
 
   for (int i = 0; i < kChordNumHarmonics * 2; ++i) {
-    double a = registrations[registration_integral][i];
-    double b = registrations[registration_integral + 1][i];
+    real_t a = registrations[registration_integral][i];
+    real_t b = registrations[registration_integral + 1][i];
     amplitudes[i] = a + (b - a) * registration_fractional;
   }
 }
 
 void StringMachineEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   ONE_POLE(morph_lp_, parameters.morph, 0.1);
@@ -93,18 +93,18 @@ void StringMachineEngine::Render(
 
   chords_.set_chord(parameters.harmonics);
 
-  double harmonics[kChordNumHarmonics * 2 + 2];
-  double registration = max(morph_lp_, 0.0);
+  real_t harmonics[kChordNumHarmonics * 2 + 2];
+  real_t registration = max(morph_lp_, real_t(0.0));
   ComputeRegistration(registration, harmonics);
   harmonics[kChordNumHarmonics * 2] = 0.0;
 
   // Render string/organ sound.
   fill(&out[0], &out[size], 0.0);
   fill(&aux[0], &aux[size], 0.0);
-  const double f0 = NoteToFrequency(parameters.note) * 0.998;
+  const real_t f0 = NoteToFrequency(parameters.note) * 0.998;
   for (int note = 0; note < kChordNumNotes; ++note) {
-    const double note_f0 = f0 * chords_.ratio(note);
-    double divide_down_gain = 4.0 - note_f0 * 32.0;
+    const real_t note_f0 = f0 * chords_.ratio(note);
+    real_t divide_down_gain = 4.0 - note_f0 * 32.0;
     CONSTRAIN(divide_down_gain, 0.0, 1.0);
     divide_down_voice_[note].Render(
         note_f0,
@@ -115,21 +115,21 @@ void StringMachineEngine::Render(
   }
 
   // Pass through VCF.
-  const double cutoff = 2.2 * f0 * SemitonesToRatio(120.0 * parameters.timbre);
+  const real_t cutoff = 2.2 * f0 * SemitonesToRatio(120.0 * parameters.timbre);
   svf_[0].set_f_q<FREQUENCY_DIRTY>(cutoff, 1.0);
   svf_[1].set_f_q<FREQUENCY_DIRTY>(cutoff * 1.5, 1.0);
 
   // Mixdown.
   for (size_t i = 0; i < size; ++i) {
-    const double l = svf_[0].Process<FILTER_MODE_LOW_PASS>(out[i]);
-    const double r = svf_[1].Process<FILTER_MODE_LOW_PASS>(aux[i]);
+    const real_t l = svf_[0].Process<FILTER_MODE_LOW_PASS>(out[i]);
+    const real_t r = svf_[1].Process<FILTER_MODE_LOW_PASS>(aux[i]);
     out[i] = 0.66 * l + 0.33 * r;
     aux[i] = 0.66 * r + 0.33 * l;
   }
 
   // Ensemble FX.
-  const double amount = abs(parameters.timbre - 0.5) * 2.0;
-  const double depth = 0.35 + 0.65 * parameters.timbre;
+  const real_t amount = abs(parameters.timbre - 0.5) * 2.0;
+  const real_t depth = 0.35 + 0.65 * parameters.timbre;
   ensemble_.set_amount(amount);
   ensemble_.set_depth(depth);
   ensemble_.Process(out, aux, size);
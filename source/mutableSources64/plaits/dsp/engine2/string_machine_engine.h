@@ -45,13 +45,13 @@ class StringMachineEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data) { }
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
-  void ComputeRegistration(double registration, double* amplitudes);
+  void ComputeRegistration(real_t registration, real_t* amplitudes);
 
   ChordBank chords_;
 
@@ -59,8 +59,8 @@ class StringMachineEngine : public Engine {
   StringSynthOscillator divide_down_voice_[kChordNumNotes];
   stmlib::NaiveSvf svf_[2];
 
-  double morph_lp_;
-  double timbre_lp_;
+  real_t morph_lp_;
+  real_t timbre_lp_;
 
   DISALLOW_COPY_AND_ASSIGN(StringMachineEngine);
 };
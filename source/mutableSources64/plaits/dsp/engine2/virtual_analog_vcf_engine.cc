@@ -59,38 +59,38 @@ void VirtualAnalogVCFEngine::Reset() {
 
 void VirtualAnalogVCFEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   // VA Oscillator (saw or PW square) + sub
-  const double f0 = NoteToFrequency(parameters.note);
+  const real_t f0 = NoteToFrequency(parameters.note);
 
-  double shape = (parameters.morph - 0.25) * 2.0 + 0.5;
+  real_t shape = (parameters.morph - 0.25) * 2.0 + 0.5;
   CONSTRAIN(shape, 0.5, 1.0);
 
-  double pw = (parameters.morph - 0.5) * 2.0 + 0.5;
+  real_t pw = (parameters.morph - 0.5) * 2.0 + 0.5;
   if (parameters.morph > 0.75) {
     pw = 2.5 - parameters.morph * 2.0;
   }
   CONSTRAIN(pw, 0.5, 0.98);
 
-  double sub_gain = max(abs(parameters.morph - 0.5) - 0.3, 0.0) * 5.0;
+  real_t sub_gain = max(abs(parameters.morph - 0.5) - 0.3, 0.0) * 5.0;
 
   oscillator_.Render(f0, pw, shape, out, size);
   sub_oscillator_.Render(f0 * 0.501, 0.5, 1.0, aux, size);
 
-  const double cutoff = f0 * SemitonesToRatio(
+  const real_t cutoff = f0 * SemitonesToRatio(
       (parameters.timbre - 0.2) * 120.0);
 
-  double stage2_gain = 1.0 - (parameters.harmonics - 0.4) * 4.0;
+  real_t stage2_gain = 1.0 - (parameters.harmonics - 0.4) * 4.0;
   CONSTRAIN(stage2_gain, 0.0, 1.0);
 
-  const double resonance = 2.667 * \
+  const real_t resonance = 2.667 * \
       max(abs(parameters.harmonics - 0.5) - 0.125, 0.0);
-  const double resonance_sqr = resonance * resonance;
-  const double q = resonance_sqr * resonance_sqr * 48.0;
-  double gain = (parameters.harmonics - 0.7) + 0.85;
+  const real_t resonance_sqr = resonance * resonance;
+  const real_t q = resonance_sqr * resonance_sqr * 48.0;
+  real_t gain = (parameters.harmonics - 0.7) + 0.85;
   CONSTRAIN(gain, 0.7 - resonance_sqr * 0.3, 1.0);
 
   ParameterInterpolator sub_gain_modulation(
@@ -104,18 +104,18 @@ void VirtualAnalogVCFEngine::Render(
   ParameterInterpolator gain_modulation(&previous_gain_, gain, size);
 
   for (size_t i = 0; i < size; ++i) {
-    const double cutoff = min(cutoff_modulation.Next(), 0.25);
-    const double q = q_modulation.Next();
-    const double stage2_gain = stage2_gain_modulation.Next();
+    const real_t cutoff = min(cutoff_modulation.Next(), real_t(0.25));
+    const real_t q = q_modulation.Next();
+    const real_t stage2_gain = stage2_gain_modulation.Next();
 
     svf_[0].set_f_q<FREQUENCY_FAST>(cutoff, 0.5 + q);
     svf_[1].set_f_q<FREQUENCY_FAST>(cutoff, 0.5 + 0.025 * q);
 
-    const double gain = gain_modulation.Next();
-    const double input = SoftClip(
+    const real_t gain = gain_modulation.Next();
+    const real_t input = SoftClip(
         (out[i] + aux[i] * sub_gain_modulation.Next()) * gain);
 
-    double lp, hp;
+    real_t lp, hp;
     svf_[0].Process<FILTER_MODE_LOW_PASS, FILTER_MODE_HIGH_PASS>(
         input, &lp, &hp);
 
@@ -46,8 +46,8 @@ class VirtualAnalogVCFEngine : public Engine {
   virtual void Reset();
   virtual void LoadUserData(const uint8_t* user_data) { }
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
@@ -56,11 +56,11 @@ class VirtualAnalogVCFEngine : public Engine {
   VariableShapeOscillator oscillator_;
   VariableShapeOscillator sub_oscillator_;
 
-  double previous_cutoff_;
-  double previous_stage2_gain_;
-  double previous_q_;
-  double previous_gain_;
-  double previous_sub_gain_;
+  real_t previous_cutoff_;
+  real_t previous_stage2_gain_;
+  real_t previous_q_;
+  real_t previous_gain_;
+  real_t previous_sub_gain_;
 
   DISALLOW_COPY_AND_ASSIGN(VirtualAnalogVCFEngine);
 };
@@ -42,7 +42,7 @@ void WaveTerrainEngine::Init(BufferAllocator* allocator) {
   path_.Init();
   offset_ = 0.0;
   terrain_ = 0.0;
-  temp_buffer_ = allocator->Allocate<double>(kMaxBlockSize * 4);
+  temp_buffer_ = allocator->Allocate<real_t>(kMaxBlockSize * 4);
   user_terrain_ = NULL;
 }
 
@@ -50,10 +50,10 @@ void WaveTerrainEngine::Reset() {
 
 }
 
-inline double TerrainLookup(double x, double y, const int8_t* terrain) {
+inline real_t TerrainLookup(real_t x, real_t y, const int8_t* terrain) {
   const int terrain_size = 64;
-  const double value_scale = 1.0 / 128.0;
-  const double coord_scale = double(terrain_size - 2) * 0.5;
+  const real_t value_scale = 1.0 / 128.0;
+  const real_t coord_scale = real_t(terrain_size - 2) * 0.5;
 
   x = (x + 1.0) * coord_scale;
   y = (y + 1.0) * coord_scale;
@@ -61,7 +61,7 @@ inline double TerrainLookup(double x, double y, const int8_t* terrain) {
   MAKE_INTEGRAL_FRACTIONAL(x);
   MAKE_INTEGRAL_FRACTIONAL(y);
 
-  double xy[2];
+  real_t xy[2];
 
   terrain += y_integral * terrain_size;
   xy[0] = InterpolateWave(terrain, x_integral, x_fractional);
@@ -71,14 +71,14 @@ inline double TerrainLookup(double x, double y, const int8_t* terrain) {
 }
 
 template<typename T>
-inline double InterpolateIntegratedWave(
+inline real_t InterpolateIntegratedWave(
     const T* table,
     int32_t index_integral,
-    double index_fractional) {
-  double a = static_cast<double>(table[index_integral]);
-  double b = static_cast<double>(table[index_integral + 1]);
-  double c = static_cast<double>(table[index_integral + 2]);
-  double t = index_fractional;
+    real_t index_fractional) {
+  real_t a = static_cast<real_t>(table[index_integral]);
+  real_t b = static_cast<real_t>(table[index_integral + 1]);
+  real_t c = static_cast<real_t>(table[index_integral + 2]);
+  real_t t = index_fractional;
   return (b - a) + (c - b - b + a) * t;
 }
 
@@ -90,12 +90,12 @@ inline double InterpolateIntegratedWave(
 #define DIFFERENTIATE_WAVE_DATA
 
 // Lookup from the wavetable data re-interpreted as a terrain. :facepalm:
-inline double TerrainLookupWT(double x, double y, int bank) {
+inline real_t TerrainLookupWT(real_t x, real_t y, int bank) {
   const int table_size = 128;
   const int table_size_full = table_size + 4;  // Includes 4 wrapped samples
   const int num_waves = 64;
-  const double sample = (y + 1.0) * 0.5 * double(table_size);
-  const double wt = (x + 1.0) * 0.5 * double(num_waves - 1);
+  const real_t sample = (y + 1.0) * 0.5 * real_t(table_size);
+  const real_t wt = (x + 1.0) * 0.5 * real_t(num_waves - 1);
 
   const int16_t* waves = wav_integrated_waves + \
       bank * num_waves * table_size_full;
@@ -103,15 +103,15 @@ inline double TerrainLookupWT(double x, double y, int bank) {
   MAKE_INTEGRAL_FRACTIONAL(sample);
   MAKE_INTEGRAL_FRACTIONAL(wt);
 
-  double xy[2];
+  real_t xy[2];
 #ifdef DIFFERENTIATE_WAVE_DATA
-  const double value_scale = 1.0 / 1024.0;
+  const real_t value_scale = 1.0 / 1024.0;
   waves += wt_integral * table_size_full;
   xy[0] = InterpolateIntegratedWave(waves, sample_integral, sample_fractional);
   waves += table_size_full;
   xy[1] = InterpolateIntegratedWave(waves, sample_integral, sample_fractional);
 #else
-  const double value_scale = 1.0 / 32768.0;
+  const real_t value_scale = 1.0 / 32768.0;
   waves += wt_integral * table_size_full;
   xy[0] = InterpolateWave(waves, sample_integral, sample_fractional);
   waves += table_size_full;
@@ -120,15 +120,15 @@ inline double TerrainLookupWT(double x, double y, int bank) {
   return (xy[0] + (xy[1] - xy[0]) * wt_fractional) * value_scale;
 }
 
-inline double Squash(double x, double a) {
+inline real_t Squash(real_t x, real_t a) {
   x *= a;
   return x / (1.0 + abs(x));
 }
 
-inline double WaveTerrainEngine::Terrain(double x, double y, int terrain_index) {
+inline real_t WaveTerrainEngine::Terrain(real_t x, real_t y, int terrain_index) {
   // The Sine function only works for a positive argument.
   // Thus, all calls to Sine include a positive offset of the argument!
-  const double k = 4.0;
+  const real_t k = 4.0;
   switch (terrain_index) {
     case 0:
       {
@@ -138,20 +138,20 @@ inline double WaveTerrainEngine::Terrain(double x, double y, int terrain_index)
       break;
     case 1:
       {
-        const double xy = x * y;
+        const real_t xy = x * y;
         return Sine(k + Sine(k + (x + y) * 0.637) / (0.2 + xy * xy) * 0.159);
       }
       break;
     case 2:
       {
-        const double xy = x * y;
+        const real_t xy = x * y;
         return Sine(k + Sine(k + 2.387 * xy) / (0.350 + xy * xy) * 0.159);
       }
       break;
     case 3:
       {
-        const double xy = x * y;
-        const double xys = (x - 0.25) * (y + 0.25);
+        const real_t xy = x * y;
+        const real_t xys = (x - 0.25) * (y + 0.25);
         return Sine(k + xy / (2.0 + abs(5.0 * xys)) * 6.366);
       }
       break;
@@ -179,19 +179,19 @@ inline double WaveTerrainEngine::Terrain(double x, double y, int terrain_index)
 
 void WaveTerrainEngine::Render(
     const EngineParameters& parameters,
-    double* out,
-    double* aux,
+    real_t* out,
+    real_t* aux,
     size_t size,
     bool* already_enveloped) {
   const size_t kOversampling = 2;
-  const double kScale = 1.0 / double(kOversampling);
+  const real_t kScale = 1.0 / real_t(kOversampling);
 
-  double* path_x = &temp_buffer_[0];
-  double* path_y = &temp_buffer_[kOversampling * size];
+  real_t* path_x = &temp_buffer_[0];
+  real_t* path_y = &temp_buffer_[kOversampling * size];
 
-  const double f0 = NoteToFrequency(parameters.note);
-  const double attenuation = max(1.0 - 8.0 * f0, 0.0);
-  const double radius = 0.1 + 0.9 * parameters.timbre * attenuation * \
+  const real_t f0 = NoteToFrequency(parameters.note);
+  const real_t attenuation = max(1.0 - 8.0 * f0, 0.0);
+  const real_t radius = 0.1 + 0.9 * parameters.timbre * attenuation * \
       (2.0 - attenuation);
 
   // Use the "magic sine" algorithm to generate sin and cos functions for the
@@ -203,27 +203,27 @@ void WaveTerrainEngine::Render(
   int num_terrains = user_terrain_ ? 9 : 8;
   ParameterInterpolator terrain(
       &terrain_,
-      min(parameters.harmonics * 1.05, 1.0) * double(num_terrains - 1.0001),
+      min(parameters.harmonics * 1.05, 1.0) * real_t(num_terrains - 1.0001),
       size);
 
   size_t ij = 0;
   for (size_t i = 0; i < size; ++i) {
-    const double x_offset = offset.Next();
+    const real_t x_offset = offset.Next();
 
-    const double z = terrain.Next();
+    const real_t z = terrain.Next();
     MAKE_INTEGRAL_FRACTIONAL(z);
 
-    double out_s = 0.0;
-    double aux_s = 0.0;
+    real_t out_s = 0.0;
+    real_t aux_s = 0.0;
 
     for (size_t j = 0; j < kOversampling; ++j) {
-      const double x = path_x[ij] * (1.0 - abs(x_offset)) + x_offset;
-      const double y = path_y[ij];
+      const real_t x = path_x[ij] * (1.0 - abs(x_offset)) + x_offset;
+      const real_t y = path_y[ij];
       ++ij;
 
-      const double z0 = Terrain(x, y, z_integral);
-      const double z1 = Terrain(x, y, z_integral + 1);
-      const double z = (z0 + (z1 - z0) * z_fractional);
+      const real_t z0 = Terrain(x, y, z_integral);
+      const real_t z1 = Terrain(x, y, z_integral + 1);
+      const real_t z = (z0 + (z1 - z0) * z_fractional);
       out_s += z;
       aux_s += y + z;
     }
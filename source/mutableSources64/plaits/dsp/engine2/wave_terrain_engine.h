@@ -52,19 +52,19 @@ class WaveTerrainEngine : public Engine {
     user_terrain_ = (const int8_t*)(user_data);
   }
   virtual void Render(const EngineParameters& parameters,
-      double* out,
-      double* aux,
+      real_t* out,
+      real_t* aux,
       size_t size,
       bool* already_enveloped);
 
  private:
-  double Terrain(double x, double y, int terrain_index);
+  real_t Terrain(real_t x, real_t y, int terrain_index);
 
   FastSineOscillator path_;
-  double offset_;
-  double terrain_;
+  real_t offset_;
+  real_t terrain_;
 
-  double* temp_buffer_;
+  real_t* temp_buffer_;
   const int8_t* user_terrain_;
 
   DISALLOW_COPY_AND_ASSIGN(WaveTerrainEngine);
@@ -52,10 +52,10 @@ class LPGEnvelope {
   }
 
   inline void ProcessPing(
-      double attack,
-      double short_decay,
-      double decay_tail,
-      double hf) {
+      real_t attack,
+      real_t short_decay,
+      real_t decay_tail,
+      real_t hf) {
     if (ramp_up_) {
       vactrol_state_ += attack;
       if (vactrol_state_ >= 1.0) {
@@ -67,17 +67,17 @@ class LPGEnvelope {
   }
 
   inline void ProcessLP(
-      double level,
-      double short_decay,
-      double decay_tail,
-      double hf) {
-    double vactrol_input = level;
-    double vactrol_error = (vactrol_input - vactrol_state_);
-    double vactrol_state_2 = vactrol_state_ * vactrol_state_;
-    double vactrol_state_4 = vactrol_state_2 * vactrol_state_2;
-    double tail = 1.0 - vactrol_state_;
-    double tail_2 = tail * tail;
-    double vactrol_coefficient = (vactrol_error > 0.0)
+      real_t level,
+      real_t short_decay,
+      real_t decay_tail,
+      real_t hf) {
+    real_t vactrol_input = level;
+    real_t vactrol_error = (vactrol_input - vactrol_state_);
+    real_t vactrol_state_2 = vactrol_state_ * vactrol_state_;
+    real_t vactrol_state_4 = vactrol_state_2 * vactrol_state_2;
+    real_t tail = 1.0 - vactrol_state_;
+    real_t tail_2 = tail * tail;
+    real_t vactrol_coefficient = (vactrol_error > 0.0)
         ? 0.6
         : short_decay + (1.0 - vactrol_state_4) * decay_tail;
     vactrol_state_ += vactrol_coefficient * vactrol_error;
@@ -87,15 +87,15 @@ class LPGEnvelope {
     hf_bleed_ = (tail_2 + (1.0 - tail_2) * hf) * hf * hf;
   }
 
-  inline double gain() const { return gain_; }
-  inline double frequency() const { return frequency_; }
-  inline double hf_bleed() const { return hf_bleed_; }
+  inline real_t gain() const { return gain_; }
+  inline real_t frequency() const { return frequency_; }
+  inline real_t hf_bleed() const { return hf_bleed_; }
 
  private:
-  double vactrol_state_;
-  double gain_;
-  double frequency_;
-  double hf_bleed_;
+  real_t vactrol_state_;
+  real_t gain_;
+  real_t frequency_;
+  real_t hf_bleed_;
   bool ramp_up_;
 
   DISALLOW_COPY_AND_ASSIGN(LPGEnvelope);
@@ -115,18 +115,18 @@ class DecayEnvelope {
   }
 
     // TODO: could be useful, vb
-    inline void Trigger(double val) {
+    inline void Trigger(real_t val) {
         value_ = val;
     }
 
-  inline void Process(double decay) {
+  inline void Process(real_t decay) {
     value_ *= (1.0 - decay);
   }
 
-  inline double value() const { return value_; }
+  inline real_t value() const { return value_; }
 
  private:
-  double value_;
+  real_t value_;
 
   DISALLOW_COPY_AND_ASSIGN(DecayEnvelope);
 };
@@ -33,7 +33,7 @@ namespace plaits {
 namespace fm {
 
 /* extern */
-const double lut_coarse[32] = {
+const real_t lut_coarse[32] = {
  -12.000000,
    0.000000,
   12.000000,
@@ -69,7 +69,7 @@ const double lut_coarse[32] = {
 };
 
 /* extern */
-const double lut_amp_mod_sensitivity[4] = {
+const real_t lut_amp_mod_sensitivity[4] = {
   0.0,
   0.2588,
   0.4274,
@@ -77,7 +77,7 @@ const double lut_amp_mod_sensitivity[4] = {
 };
 
 /* extern */
-const double lut_pitch_mod_sensitivity[8] = {
+const real_t lut_pitch_mod_sensitivity[8] = {
   0.0,
   0.0781250,
   0.1562500,
@@ -89,7 +89,7 @@ const double lut_pitch_mod_sensitivity[8] = {
 };
 
 /* extern */
-const double lut_cube_root[17] = {
+const real_t lut_cube_root[17] = {
   0.0,
   0.39685062976,
   0.50000000000,
@@ -41,17 +41,17 @@ namespace plaits {
 
 namespace fm {
 
-extern const double lut_cube_root[17];
-extern const double lut_amp_mod_sensitivity[4];
-extern const double lut_pitch_mod_sensitivity[8];
-extern const double lut_coarse[32];
+extern const real_t lut_cube_root[17];
+extern const real_t lut_amp_mod_sensitivity[4];
+extern const real_t lut_pitch_mod_sensitivity[8];
+extern const real_t lut_coarse[32];
 
 // Computes 2^x by using a polynomial approximation of 2^frac(x) and directly
 // incrementing the exponent of the IEEE 754 representation of the result
 // by int(x). Depending on the use case, the order of the polynomial
-// approximation can be chosen.
+// approximation can be chosen. Always computed on a double, whatever real_t.
 template<int order>
-inline double Pow2Fast(double x) {
+inline real_t Pow2Fast(double x) {
   union {
     double f;
     int64_t w;
@@ -102,77 +102,77 @@ inline int OperatorLevel(int level) {
 // 50 =  0
 // 82 = +1 octave
 // 99 = +4 octave
-inline double PitchEnvelopeLevel(int level) {
-  double l = (double(level) - 50.0) / 32.0;
-  double tail = std::max(std::abs(l + 0.02) - 1.0, 0.0);
+inline real_t PitchEnvelopeLevel(int level) {
+  real_t l = (real_t(level) - 50.0) / 32.0;
+  real_t tail = std::max(std::abs(l + 0.02) - 1.0, 0.0);
   return l * (1.0 + tail * tail * 5.3056);
 }
 
 // Convert an operator envelope rate from 0-99 to a frequency.
-inline double OperatorEnvelopeIncrement(int rate) {
+inline real_t OperatorEnvelopeIncrement(int rate) {
   int rate_scaled = (rate * 41) >> 6;
   int mantissa = 4 + (rate_scaled & 3);
   int exponent = 2 + (rate_scaled >> 2);
-  return double(mantissa << exponent) / double(1 << 24);
+  return real_t(mantissa << exponent) / real_t(1 << 24);
 }
 
 // Convert a pitch envelope rate from 0-99 to a frequency.
-inline double PitchEnvelopeIncrement(int rate) {
-  double r = double(rate) * 0.01;
+inline real_t PitchEnvelopeIncrement(int rate) {
+  real_t r = real_t(rate) * 0.01;
   return (1.0 + 192.0 * r * (r * r * r * r + 0.3333)) / (21.3 * 44100.0);
 }
 
-const double kMinLFOFrequency = 0.005865;
+const real_t kMinLFOFrequency = 0.005865;
 
 // Convert an LFO rate from 0-99 to a frequency.
-inline double LFOFrequency(int rate) {
+inline real_t LFOFrequency(int rate) {
   int rate_scaled = rate == 0 ? 1 : (rate * 165) >> 6;
   rate_scaled *= rate_scaled < 160 ? 11 : (11 + ((rate_scaled - 160) >> 4));
-  return double(rate_scaled) * kMinLFOFrequency;
+  return real_t(rate_scaled) * kMinLFOFrequency;
 }
 
 // Convert an LFO delay from 0-99 to the two increments.
-inline void LFODelay(int delay, double increments[2]) {
+inline void LFODelay(int delay, real_t increments[2]) {
   if (delay == 0) {
     increments[0] = increments[1] = 100000.0;
   } else {
     int d = 99 - delay;
     d = (16 + (d & 15)) << (1 + (d >> 4));
-    increments[0] = double(d) * kMinLFOFrequency;
-    increments[1] = double(std::max(0x80, d & 0xff80)) * kMinLFOFrequency;
+    increments[0] = real_t(d) * kMinLFOFrequency;
+    increments[1] = real_t(std::max(0x80, d & 0xff80)) * kMinLFOFrequency;
   }
 }
 
 // Pre-process the velocity to easily compute the velocity scaling.
-inline double NormalizeVelocity(double velocity) {
+inline real_t NormalizeVelocity(real_t velocity) {
   // double cube_root = stmlib::Sqrt(
   //     0.7f * stmlib::Sqrt(velocity) + 0.3f * velocity);
-  const double cube_root = stmlib::Interpolate(lut_cube_root, velocity, 16);
+  const real_t cube_root = stmlib::Interpolate(lut_cube_root, velocity, 16);
   return 16.0 * (cube_root - 0.918);
 }
 
 // MIDI note to envelope increment ratio.
-inline double RateScaling(double note, int rate_scaling) {
+inline real_t RateScaling(real_t note, int rate_scaling) {
   return Pow2Fast<1>(
-      double(rate_scaling) * (note * 0.33333 - 7.0) * 0.03125);
+      real_t(rate_scaling) * (note * 0.33333 - 7.0) * 0.03125);
 }
 
 // Operator amplitude modulation sensitivity (0-3).
-inline double AmpModSensitivity(int amp_mod_sensitivity) {
+inline real_t AmpModSensitivity(int amp_mod_sensitivity) {
   return lut_amp_mod_sensitivity[amp_mod_sensitivity];
 }
 
 // Pitch modulation sensitivity (0-7).
-inline double PitchModSensitivity(int pitch_mod_sensitivity) {
+inline real_t PitchModSensitivity(int pitch_mod_sensitivity) {
   return lut_pitch_mod_sensitivity[pitch_mod_sensitivity];
 }
 
 // Keyboard tracking to TL adjustment.
-inline double KeyboardScaling(double note, const Patch::KeyboardScaling& ks) {
-  const double x = note - double(ks.break_point) - 15.0;
+inline real_t KeyboardScaling(real_t note, const Patch::KeyboardScaling& ks) {
+  const real_t x = note - real_t(ks.break_point) - 15.0;
   const int curve = x > 0.0 ? ks.right_curve : ks.left_curve;
 
-  double t = std::abs(x);
+  real_t t = std::abs(x);
   if (curve == 1 || curve == 2) {
     t = std::min(t * 0.010467, 1.0);
     t = t * t * t;
@@ -182,19 +182,19 @@ inline double KeyboardScaling(double note, const Patch::KeyboardScaling& ks) {
     t = -t;
   }
 
-  double depth = double(x > 0.0 ? ks.right_depth : ks.left_depth);
+  real_t depth = real_t(x > 0.0 ? ks.right_depth : ks.left_depth);
   return t * depth * 0.02677;
 }
 
-inline double FrequencyRatio(const Patch::Operator& op) {
-  const double detune = op.mode == 0 && op.fine
-      ? 1.0 + 0.01 * double(op.fine)
+inline real_t FrequencyRatio(const Patch::Operator& op) {
+  const real_t detune = op.mode == 0 && op.fine
+      ? 1.0 + 0.01 * real_t(op.fine)
       : 1.0;
 
-  double base = op.mode == 0
+  real_t base = op.mode == 0
       ? lut_coarse[op.coarse]
-      : double(int(op.coarse & 3) * 100 + op.fine) * 0.39864;
-  base += (double(op.detune) - 7.0) * 0.015;
+      : real_t(int(op.coarse & 3) * 100 + op.fine) * 0.39864;
+  base += (real_t(op.detune) - 7.0) * 0.015;
 
   return stmlib::SemitonesToRatioSafe(base) * detune;
 }
@@ -68,28 +68,28 @@ class Envelope {
     Init(1.0);
   }
 
-  inline void Init(double scale) {
+  inline void Init(real_t scale) {
     scale_ = scale;
     stage_ = num_stages - 1;
     phase_ = 1.0;
     start_ = 0.0;
     for (int i = 0; i < num_stages; ++i) {
       increment_[i] = 0.001;
-      level_[i] = 1.0 / double(1 << i);
+      level_[i] = 1.0 / real_t(1 << i);
     }
     level_[num_stages - 1] = 0.0;
   }
 
   // Directly copy the variables.
-  void Set(const double increment[num_stages], const double level[num_stages]) {
+  void Set(const real_t increment[num_stages], const real_t level[num_stages]) {
     std::copy(&increment[0], &increment[num_stages], &increment_[0]);
     std::copy(&level[0], &level[num_stages], &level_[0]);
   }
 
-  inline double RenderAtSample(double t, const double gate_duration) {
+  inline real_t RenderAtSample(real_t t, const real_t gate_duration) {
     if (t > gate_duration) {
       // Check how far we are into the release phase.
-      const double phase = (t - gate_duration) * increment_[num_stages - 1];
+      const real_t phase = (t - gate_duration) * increment_[num_stages - 1];
       return phase >= 1.0
           ? level_[num_stages - 1]
           : value(num_stages - 1, phase,
@@ -98,7 +98,7 @@ class Envelope {
 
     int stage = 0;
     for (; stage < num_stages - 1; ++stage) {
-      const double stage_duration = 1.0 / increment_[stage];
+      const real_t stage_duration = 1.0 / increment_[stage];
       if (t < stage_duration) {
         break;
       }
@@ -117,15 +117,15 @@ class Envelope {
     return value(stage, t * increment_[stage], PREVIOUS_LEVEL);
   }
 
-  inline double Render(bool gate) {
+  inline real_t Render(bool gate) {
     return Render(gate, 1.0, 1.0, 1.0);
   }
 
-  inline double Render(
+  inline real_t Render(
       bool gate,
-      double rate,
-      double ad_scale,
-      double release_scale) {
+      real_t rate,
+      real_t ad_scale,
+      real_t release_scale) {
     if (gate) {
       if (stage_ == num_stages - 1) {
         start_ = value();
@@ -155,18 +155,18 @@ class Envelope {
   }
 
  private:
-  inline double value() {
+  inline real_t value() {
     return value(stage_, phase_, start_);
   }
 
-  inline double value(int stage, double phase, double start_level) {
-   double from = start_level == PREVIOUS_LEVEL
+  inline real_t value(int stage, real_t phase, real_t start_level) {
+   real_t from = start_level == PREVIOUS_LEVEL
        ? level_[(stage - 1 + num_stages) % num_stages] : start_level;
-   double to = level_[stage];
+   real_t to = level_[stage];
 
    if (reshape_ascending_segments && from < to) {
-     from = std::max(6.7, from);
-     to = std::max(6.7, to);
+     from = std::max(real_t(6.7), from);
+     to = std::max(real_t(6.7), to);
      phase *= (2.5 - phase) * 0.666667;
    }
 
@@ -174,13 +174,13 @@ class Envelope {
   }
 
   int stage_;
-  double phase_;
-  double start_;
+  real_t phase_;
+  real_t start_;
 
  protected:
-  double increment_[num_stages];
-  double level_[num_stages];
-  double scale_;
+  real_t increment_[num_stages];
+  real_t level_[num_stages];
+  real_t scale_;
 
   DISALLOW_COPY_AND_ASSIGN(Envelope);
 };
@@ -194,14 +194,14 @@ class OperatorEnvelope : public Envelope<4, true> {
       int level_scaled = OperatorLevel(level[i]);
       level_scaled = (level_scaled & ~1) + global_level - 133; // 125 ?
       level_[i] = 0.125 * \
-          (level_scaled < 1 ? 0.5 : static_cast<double>(level_scaled));
+          (level_scaled < 1 ? 0.5 : static_cast<real_t>(level_scaled));
     }
 
     // Configure increments.
     for (int i = 0; i < NUM_STAGES; ++i) {
-      double increment = OperatorEnvelopeIncrement(rate[i]);
-      double from = level_[(i - 1 + NUM_STAGES) % NUM_STAGES];
-      double to = level_[i];
+      real_t increment = OperatorEnvelopeIncrement(rate[i]);
+      real_t from = level_[(i - 1 + NUM_STAGES) % NUM_STAGES];
+      real_t to = level_[i];
 
       if (from == to) {
         // Quirk: for plateaux, the increment is scaled.
@@ -211,8 +211,8 @@ class OperatorEnvelope : public Envelope<4, true> {
           increment *= 20.0;
         }
       } else if (from < to) {
-        from = std::max(6.7, from);
-        to = std::max(6.7, to);
+        from = std::max(real_t(6.7), from);
+        to = std::max(real_t(6.7), to);
         if (from == to) {
           // Quirk: because of the jump, the attack might disappear.
           increment = 1.0;
@@ -238,9 +238,9 @@ class PitchEnvelope : public Envelope<4, false> {
 
     // Configure increments.
     for (int i = 0; i < NUM_STAGES; ++i) {
-      double from = level_[(i - 1 + NUM_STAGES) % NUM_STAGES];
-      double to = level_[i];
-      double increment = PitchEnvelopeIncrement(rate[i]);
+      real_t from = level_[(i - 1 + NUM_STAGES) % NUM_STAGES];
+      real_t to = level_[i];
+      real_t increment = PitchEnvelopeIncrement(rate[i]);
       if (from != to) {
         increment *= 1.0 / std::abs(from - to);
       } else if (i != NUM_STAGES - 1) {
@@ -54,7 +54,7 @@ class Lfo {
     WAVEFORM_S_AND_H
   };
 
-  inline void Init(double sample_rate) {
+  inline void Init(real_t sample_rate) {
     phase_ = 0.0;
     frequency_ = 0.1;
     delay_phase_ = 0.0;
@@ -82,9 +82,9 @@ class Lfo {
     waveform_ = Waveform(modulations.waveform);
     reset_phase_ = modulations.reset_phase != 0;
 
-    amp_mod_depth_ = double(modulations.amp_mod_depth) * 0.01;
+    amp_mod_depth_ = real_t(modulations.amp_mod_depth) * 0.01;
 
-    pitch_mod_depth_ = double(modulations.pitch_mod_depth) * 0.01 * \
+    pitch_mod_depth_ = real_t(modulations.pitch_mod_depth) * 0.01 * \
         PitchModSensitivity(modulations.pitch_mod_sensitivity);
   }
 
@@ -95,7 +95,7 @@ class Lfo {
     delay_phase_ = 0.0;
   }
 
-  inline void Step(double scale) {
+  inline void Step(real_t scale) {
     phase_ += scale * frequency_;
     if (phase_ >= 1.0) {
       phase_ -= 1.0;
@@ -109,8 +109,8 @@ class Lfo {
     }
   }
 
-  inline void Scrub(double sample) {
-    double phase = sample * frequency_;
+  inline void Scrub(real_t sample) {
+    real_t phase = sample * frequency_;
     MAKE_INTEGRAL_FRACTIONAL(phase)
     phase_ = phase_fractional;
     if (phase_integral != phase_integral_) {
@@ -129,7 +129,7 @@ class Lfo {
     }
   }
 
-  inline double value() const {
+  inline real_t value() const {
     switch (waveform_) {
       case WAVEFORM_TRIANGLE:
         return 2.0 * (phase_ < 0.5 ? 0.5 - phase_ : phase_ - 0.5);
@@ -152,30 +152,30 @@ class Lfo {
     return 0.0;
   }
 
-  inline double delay_ramp() const {
+  inline real_t delay_ramp() const {
     return delay_phase_ < 0.5 ? 0.0 : (delay_phase_ - 0.5) * 2.0;
   }
 
-  inline double pitch_mod() const {
+  inline real_t pitch_mod() const {
     return (value_ - 0.5) * delay_ramp() * pitch_mod_depth_;
   }
 
-  inline double amp_mod() const {
+  inline real_t amp_mod() const {
     return (1.0 - value_) * delay_ramp() * amp_mod_depth_;
   }
 
  private:
-  double phase_;
-  double frequency_;
-  double delay_phase_;
-  double delay_increment_[2];
-  double value_;
+  real_t phase_;
+  real_t frequency_;
+  real_t delay_phase_;
+  real_t delay_increment_[2];
+  real_t value_;
 
-  double random_value_;
-  double one_hz_;
+  real_t random_value_;
+  real_t one_hz_;
 
-  double amp_mod_depth_;
-  double pitch_mod_depth_;
+  real_t amp_mod_depth_;
+  real_t pitch_mod_depth_;
 
   Waveform waveform_;
   bool reset_phase_;
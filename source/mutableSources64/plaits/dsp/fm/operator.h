@@ -52,30 +52,30 @@ struct Operator {
   }
 
   uint32_t phase;
-  double amplitude;
+  real_t amplitude;
 };
 
 typedef void (*RenderFn)(
     Operator* ops,
-    const double* f,
-    const double* a,
-    double* fb_state,
+    const real_t* f,
+    const real_t* a,
+    real_t* fb_state,
     int fb_amount,
-    const double* modulation,
-    double* out,
+    const real_t* modulation,
+    real_t* out,
     size_t size);
 
 template<int n, int modulation_source, bool additive>
 void RenderOperators(
     Operator* ops,
-    const double* f,
-    const double* a,
-    double* fb_state,
+    const real_t* f,
+    const real_t* a,
+    real_t* fb_state,
     int fb_amount,
-    const double* modulation,
-    double* out,
+    const real_t* modulation,
+    real_t* out,
     size_t size) {
-  double previous_0 = 0.0, previous_1 = 0.0;        // vb: add initialization
+  real_t previous_0 = 0.0, previous_1 = 0.0;        // vb: add initialization
 
   if (modulation_source >= Operator::MODULATION_SOURCE_FEEDBACK) {
     previous_0 = fb_state[0];
@@ -84,21 +84,21 @@ void RenderOperators(
 
   uint32_t frequency[n];
   uint32_t phase[n];
-  double amplitude[n];
-  double amplitude_increment[n];
+  real_t amplitude[n];
+  real_t amplitude_increment[n];
 
-  const double scale = 1.0 / double(size);
+  const real_t scale = 1.0 / real_t(size);
   for (int i = 0; i < n; ++i) {
-    frequency[i] = static_cast<uint32_t>(std::min(f[i], 0.5) * 4294967296.0);
+    frequency[i] = static_cast<uint32_t>(std::min(f[i], real_t(0.5)) * 4294967296.0);
     phase[i] = ops[i].phase;
     amplitude[i] = ops[i].amplitude;
-    amplitude_increment[i] = (std::min(a[i], 4.0) - amplitude[i]) * scale;
+    amplitude_increment[i] = (std::min(a[i], real_t(4.0)) - amplitude[i]) * scale;
   }
 
-  const double fb_scale = fb_amount ? double(1 << fb_amount) / 512.0 : 0.0;
+  const real_t fb_scale = fb_amount ? real_t(1 << fb_amount) / 512.0 : 0.0;
 
   while (size--) {
-    double pm = 0.0;
+    real_t pm = 0.0;
     if (modulation_source >= Operator::MODULATION_SOURCE_FEEDBACK) {
       pm = (previous_0 + previous_1) * fb_scale;
     } else if (modulation_source == Operator::MODULATION_SOURCE_EXTERNAL) {
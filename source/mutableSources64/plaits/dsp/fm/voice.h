@@ -54,25 +54,25 @@ class Voice {
   struct Parameters {
     bool sustain;
     bool gate;
-    double note;
-    double velocity;
-    double brightness;
-    double envelope_control;
-    double pitch_mod;
-    double amp_mod;
+    real_t note;
+    real_t velocity;
+    real_t brightness;
+    real_t envelope_control;
+    real_t pitch_mod;
+    real_t amp_mod;
   };
 
   inline void Init(
       const Algorithms<num_operators>* algorithms,
-      double sample_rate) {
+      real_t sample_rate) {
     algorithms_ = algorithms;
 
     sample_rate_ = sample_rate;
     one_hz_ = 1.0 / sample_rate;
     a0_ = 55.0 / sample_rate;
 
-    const double native_sr = 44100.0;  // Legacy sample rate.
-    const double envelope_scale = native_sr * one_hz_;
+    const real_t native_sr = 44100.0;  // Legacy sample rate.
+    const real_t envelope_scale = native_sr * one_hz_;
 
     for (int i = 0; i < num_operators; ++i) {
       operator_[i].Reset();
@@ -115,42 +115,42 @@ class Voice {
       // The level increase caused by keyboard scaling plus velocity
       // scaling should not exceed this number - otherwise it would be
       // equivalent to have an operator with a level above 99.
-      level_headroom_[i] = double(127 - level);
+      level_headroom_[i] = real_t(127 - level);
 
       // Pre-compute frequency ratios. Encode the base frequency
       // (1Hz or the root note) as the sign of the ratio.
-      double sign = op.mode == 0 ? 1.0 : -1.0;
+      real_t sign = op.mode == 0 ? 1.0 : -1.0;
       ratios_[i] = sign * FrequencyRatio(op);
     }
     dirty_ = false;
     return true;
   }
 
-  inline double op_level(int i) const {
+  inline real_t op_level(int i) const {
     return level_[i];
   }
 
   inline void Render(
       const Parameters& parameters,
-      double* temp,
-      double* out,
-      double* aux,
+      real_t* temp,
+      real_t* out,
+      real_t* aux,
       size_t size) {
-    double* buffers[4] = { out, aux, temp, temp };
+    real_t* buffers[4] = { out, aux, temp, temp };
     Render(parameters, buffers, size);
   }
 
   inline void Render(
       const Parameters& parameters,
-      double* temp,
+      real_t* temp,
       size_t size) {
-    double* buffers[4] = { temp, temp + size, temp + 2 * size, temp + 2 * size };
+    real_t* buffers[4] = { temp, temp + size, temp + 2 * size, temp + 2 * size };
     Render(parameters, buffers, size);
   }
 
   inline void Render(
       const Parameters& parameters,
-      double* buffers[4],
+      real_t* buffers[4],
       size_t size) {
     if (Setup()) {
       // This prevents a CPU overrun, since there is not enough CPU to perform
@@ -161,24 +161,24 @@ class Voice {
       return;
     }
 
-    const double envelope_rate = double(size);
-    const double ad_scale = Pow2Fast<1>(
+    const real_t envelope_rate = real_t(size);
+    const real_t ad_scale = Pow2Fast<1>(
         (0.5 - parameters.envelope_control) * 8.0);
-    const double r_scale = Pow2Fast<1>(
+    const real_t r_scale = Pow2Fast<1>(
         -std::abs(parameters.envelope_control - 0.3) * 8.0);
-    const double gate_duration = 1.5 * sample_rate_;
-    const double envelope_sample = gate_duration * parameters.envelope_control;
+    const real_t gate_duration = 1.5 * sample_rate_;
+    const real_t envelope_sample = gate_duration * parameters.envelope_control;
 
     // Apply LFO and pitch envelope modulations.
-    const double pitch_envelope = parameters.sustain
+    const real_t pitch_envelope = parameters.sustain
         ? pitch_envelope_.RenderAtSample(envelope_sample, gate_duration)
         : pitch_envelope_.Render(
               parameters.gate,
               envelope_rate,
               ad_scale,
               r_scale);
-    const double pitch_mod = pitch_envelope + parameters.pitch_mod;
-    const double f0 = a0_ * 0.25 * stmlib::SemitonesToRatioSafe(
+    const real_t pitch_mod = pitch_envelope + parameters.pitch_mod;
+    const real_t f0 = a0_ * 0.25 * stmlib::SemitonesToRatioSafe(
         parameters.note - 9.0 + pitch_mod * 12.0);
 
     // Sample the note and velocity (used for scaling) only when a trigger
@@ -198,25 +198,25 @@ class Voice {
     }
 
     // Compute frequencies and amplitudes.
-    double f[num_operators];
-    double a[num_operators];
+    real_t f[num_operators];
+    real_t a[num_operators];
     for (int i = 0; i < num_operators; ++i) {
       const Patch::Operator& op = patch_->op[i];
 
       f[i] = ratios_[i] * (ratios_[i] < 0.0 ? -one_hz_ : f0);
 
-      const double rate_scaling = RateScaling(note_, op.rate_scaling);
-      double level = parameters.sustain
+      const real_t rate_scaling = RateScaling(note_, op.rate_scaling);
+      real_t level = parameters.sustain
           ? operator_envelope_[i].RenderAtSample(envelope_sample, gate_duration)
           : operator_envelope_[i].Render(
                 parameters.gate,
                 envelope_rate * rate_scaling,
                 ad_scale,
                 r_scale);
-      const double kb_scaling = KeyboardScaling(note_, op.keyboard_scaling);
-      const double velocity_scaling = normalized_velocity_ * \
-          double(op.velocity_sensitivity);
-      const double brightness = algorithms_->is_modulator(patch_->algorithm, i)
+      const real_t kb_scaling = KeyboardScaling(note_, op.keyboard_scaling);
+      const real_t velocity_scaling = normalized_velocity_ * \
+          real_t(op.velocity_sensitivity);
+      const real_t brightness = algorithms_->is_modulator(patch_->algorithm, i)
           ? (parameters.brightness - 0.5) * 32.0
           : 0.0;
 
@@ -226,13 +226,13 @@ class Voice {
 
       level_[i] = level;
 
-      const double sensitivity = AmpModSensitivity(op.amp_mod_sensitivity);
+      const real_t sensitivity = AmpModSensitivity(op.amp_mod_sensitivity);
 #ifdef FAST_OP_LEVEL_MODULATION
-      const double level_mod = 1.0 - sensitivity * parameters.amp_mod;
+      const real_t level_mod = 1.0 - sensitivity * parameters.amp_mod;
       a[i] = Pow2Fast<2>(-14.0 + level) * level_mod;
 #else
-      const double log_level_mod = sensitivity * parameters.amp_mod - 1.0;
-      const double level_mod = 1.0 - Pow2Fast<2>(6.4 * log_level_mod);
+      const real_t log_level_mod = sensitivity * parameters.amp_mod - 1.0;
+      const real_t level_mod = 1.0 - Pow2Fast<2>(6.4 * log_level_mod);
       a[i] = Pow2Fast<2>(-14.0 + level * level_mod);
 #endif  // FAST_LINEAR_AMPLITUDE_MODULATION
     }
@@ -255,9 +255,9 @@ class Voice {
 
  private:
   const Algorithms<num_operators>* algorithms_;
-  double sample_rate_;
-  double one_hz_;
-  double a0_;
+  real_t sample_rate_;
+  real_t one_hz_;
+  real_t a0_;
 
   bool gate_;
 
@@ -265,14 +265,14 @@ class Voice {
   OperatorEnvelope operator_envelope_[num_operators];
   PitchEnvelope pitch_envelope_;
 
-  double normalized_velocity_;
-  double note_;
+  real_t normalized_velocity_;
+  real_t note_;
 
-  double ratios_[num_operators];
-  double level_headroom_[num_operators];
-  double level_[num_operators];
+  real_t ratios_[num_operators];
+  real_t level_headroom_[num_operators];
+  real_t level_[num_operators];
 
-  double feedback_state_[2];
+  real_t feedback_state_[2];
 
   const Patch* patch_;
 
@@ -50,7 +50,7 @@ class Diffuser {
     engine_.Clear();
   }
 
-  void Process(double amount, double rt, double* in_out, size_t size) {
+  void Process(real_t amount, real_t rt, real_t* in_out, size_t size) {
     typedef E::Reserve<126,
       E::Reserve<180,
       E::Reserve<269,
@@ -66,11 +66,11 @@ class Diffuser {
     E::DelayLine<Memory, 5> dapb;
     E::DelayLine<Memory, 6> del;
     E::Context c;
-    const double kap = 0.625;
-    const double klp = 0.75;
-    double lp = lp_decay_;
+    const real_t kap = 0.625;
+    const real_t klp = 0.75;
+    real_t lp = lp_decay_;
     while (size--) {
-      double wet;
+      real_t wet;
       engine_.Start(&c);
       c.Read(*in_out);
       c.Read(ap1 TAIL, kap);
@@ -98,7 +98,7 @@ class Diffuser {
  private:
   typedef FxEngine<8192, FORMAT_12_BIT> E;
   E engine_;
-  double lp_decay_;
+  real_t lp_decay_;
 
   DISALLOW_COPY_AND_ASSIGN(Diffuser);
 };
@@ -56,7 +56,7 @@ class Ensemble {
     engine_.Clear();
   }
 
-  void Process(double* left, double* right, size_t size) {
+  void Process(real_t* left, real_t* right, size_t size) {
     typedef E::Reserve<511, E::Reserve<511> > Memory;
     E::DelayLine<Memory, 0> line_l;
     E::DelayLine<Memory, 1> line_r;
@@ -64,7 +64,7 @@ class Ensemble {
 
     while (size--) {
       engine_.Start(&c);
-      double dry_amount = 1.0 - amount_ * 0.5;
+      real_t dry_amount = 1.0 - amount_ * 0.5;
 
       // Update LFO.
       const uint32_t one_third = 1417339207UL;
@@ -72,22 +72,22 @@ class Ensemble {
 
       phase_1_ += 67289; // 0.75 Hz
       phase_2_ += 589980; // 6.57 Hz
-      double slow_0 = SineRaw(phase_1_);
-      double slow_120 = SineRaw(phase_1_ + one_third);
-      double slow_240 = SineRaw(phase_1_ + two_third);
-      double fast_0 = SineRaw(phase_2_);
-      double fast_120 = SineRaw(phase_2_ + one_third);
-      double fast_240 = SineRaw(phase_2_ + two_third);
+      real_t slow_0 = SineRaw(phase_1_);
+      real_t slow_120 = SineRaw(phase_1_ + one_third);
+      real_t slow_240 = SineRaw(phase_1_ + two_third);
+      real_t fast_0 = SineRaw(phase_2_);
+      real_t fast_120 = SineRaw(phase_2_ + one_third);
+      real_t fast_240 = SineRaw(phase_2_ + two_third);
 
       // Max deviation: 176
-      double a = depth_ * 160.0;
-      double b = depth_ * 16.0;
+      real_t a = depth_ * 160.0;
+      real_t b = depth_ * 16.0;
 
-      double mod_1 = slow_0 * a + fast_0 * b;
-      double mod_2 = slow_120 * a + fast_120 * b;
-      double mod_3 = slow_240 * a + fast_240 * b;
+      real_t mod_1 = slow_0 * a + fast_0 * b;
+      real_t mod_2 = slow_120 * a + fast_120 * b;
+      real_t mod_3 = slow_240 * a + fast_240 * b;
 
-      double wet = 0.0;
+      real_t wet = 0.0;
 
       // Sum L & R channel to send to chorus line.
       c.Read(*left, 1.0);
@@ -111,19 +111,19 @@ class Ensemble {
     }
   }
 
-  inline void set_amount(double amount) {
+  inline void set_amount(real_t amount) {
     amount_ = amount;
   }
 
-  inline void set_depth(double depth) {
+  inline void set_depth(real_t depth) {
     depth_ = depth;
   }
 
  private:
   E engine_;
 
-  double amount_;
-  double depth_;
+  real_t amount_;
+  real_t depth_;
 
   uint32_t phase_1_;
   uint32_t phase_2_;
@@ -60,11 +60,11 @@ template<>
 struct DataType<FORMAT_12_BIT> {
   typedef uint16_t T;
   
-  static inline double Decompress(T value) {
-    return static_cast<double>(static_cast<int16_t>(value)) / 4096.0;
+  static inline real_t Decompress(T value) {
+    return static_cast<real_t>(static_cast<int16_t>(value)) / 4096.0;
   }
   
-  static inline T Compress(double value) {
+  static inline T Compress(real_t value) {
     return static_cast<uint16_t>(
         stmlib::Clip16(static_cast<int32_t>(value * 4096.0)));
   }
@@ -74,11 +74,11 @@ template<>
 struct DataType<FORMAT_16_BIT> {
   typedef uint16_t T;
   
-  static inline double Decompress(T value) {
-    return static_cast<double>(static_cast<int16_t>(value)) / 32768.0;
+  static inline real_t Decompress(T value) {
+    return static_cast<real_t>(static_cast<int16_t>(value)) / 32768.0;
   }
   
-  static inline T Compress(double value) {
+  static inline T Compress(real_t value) {
     return static_cast<uint16_t>(
         stmlib::Clip16(static_cast<int32_t>(value * 32768.0)));
   }
@@ -86,13 +86,13 @@ struct DataType<FORMAT_16_BIT> {
 
 template<>
 struct DataType<FORMAT_32_BIT> {
-  typedef double T;
+  typedef real_t T;
   
-  static inline double Decompress(T value) {
+  static inline real_t Decompress(T value) {
     return value;;
   }
   
-  static inline T Compress(double value) {
+  static inline T Compress(real_t value) {
     return value;
   }
 };
@@ -147,29 +147,29 @@ class FxEngine {
     Context() { }
     ~Context() { }
     
-    inline void Load(double value) {
+    inline void Load(real_t value) {
       accumulator_ = value;
     }
 
-    inline void Read(double value, double scale) {
+    inline void Read(real_t value, real_t scale) {
       accumulator_ += value * scale;
     }
 
-    inline void Read(double value) {
+    inline void Read(real_t value) {
       accumulator_ += value;
     }
 
-    inline void Write(double& value) {
+    inline void Write(real_t& value) {
       value = accumulator_;
     }
 
-    inline void Write(double& value, double scale) {
+    inline void Write(real_t& value, real_t scale) {
       value = accumulator_;
       accumulator_ *= scale;
     }
     
     template<typename D>
-    inline void Write(D& d, int32_t offset, double scale) {
+    inline void Write(D& d, int32_t offset, real_t scale) {
       //STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
       T w = DataType<format>::Compress(accumulator_);
       if (offset == -1) {
@@ -181,23 +181,23 @@ class FxEngine {
     }
     
     template<typename D>
-    inline void Write(D& d, double scale) {
+    inline void Write(D& d, real_t scale) {
       Write(d, 0, scale);
     }
 
     template<typename D>
-    inline void WriteAllPass(D& d, int32_t offset, double scale) {
+    inline void WriteAllPass(D& d, int32_t offset, real_t scale) {
       Write(d, offset, scale);
       accumulator_ += previous_read_;
     }
     
     template<typename D>
-    inline void WriteAllPass(D& d, double scale) {
+    inline void WriteAllPass(D& d, real_t scale) {
       WriteAllPass(d, 0, scale);
     }
     
     template<typename D>
-    inline void Read(D& d, int32_t offset, double scale) {
+    inline void Read(D& d, int32_t offset, real_t scale) {
       //STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
       T r;
       if (offset == -1) {
@@ -205,65 +205,65 @@ class FxEngine {
       } else {
         r = buffer_[(write_ptr_ + D::base + offset) & MASK];
       }
-      double r_f = DataType<format>::Decompress(r);
+      real_t r_f = DataType<format>::Decompress(r);
       previous_read_ = r_f;
       accumulator_ += r_f * scale;
     }
     
     template<typename D>
-    inline void Read(D& d, double scale) {
+    inline void Read(D& d, real_t scale) {
       Read(d, 0, scale);
     }
     
-    inline void Lp(double& state, double coefficient) {
+    inline void Lp(real_t& state, real_t coefficient) {
       state += coefficient * (accumulator_ - state);
       accumulator_ = state;
     }
 
-    inline void Hp(double& state, double coefficient) {
+    inline void Hp(real_t& state, real_t coefficient) {
       state += coefficient * (accumulator_ - state);
       accumulator_ -= state;
     }
     
     template<typename D>
-    inline void Interpolate(D& d, double offset, double scale) {
+    inline void Interpolate(D& d, real_t offset, real_t scale) {
       //STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
       MAKE_INTEGRAL_FRACTIONAL(offset);
-      double a = DataType<format>::Decompress(
+      real_t a = DataType<format>::Decompress(
           buffer_[(write_ptr_ + offset_integral + D::base) & MASK]);
-      double b = DataType<format>::Decompress(
+      real_t b = DataType<format>::Decompress(
           buffer_[(write_ptr_ + offset_integral + D::base + 1) & MASK]);
-      double x = a + (b - a) * offset_fractional;
+      real_t x = a + (b - a) * offset_fractional;
       previous_read_ = x;
       accumulator_ += x * scale;
     }
     
     template<typename D>
     inline void Interpolate(
-        D& d, double offset, LFOIndex index, double amplitude, double scale) {
+        D& d, real_t offset, LFOIndex index, real_t amplitude, real_t scale) {
       //STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
       offset += amplitude * lfo_value_[index];
       MAKE_INTEGRAL_FRACTIONAL(offset);
-      double a = DataType<format>::Decompress(
+      real_t a = DataType<format>::Decompress(
           buffer_[(write_ptr_ + offset_integral + D::base) & MASK]);
-      double b = DataType<format>::Decompress(
+      real_t b = DataType<format>::Decompress(
           buffer_[(write_ptr_ + offset_integral + D::base + 1) & MASK]);
-      double x = a + (b - a) * offset_fractional;
+      real_t x = a + (b - a) * offset_fractional;
       previous_read_ = x;
       accumulator_ += x * scale;
     }
     
    private:
-    double accumulator_;
-    double previous_read_;
-    double lfo_value_[2];
+    real_t accumulator_;
+    real_t previous_read_;
+    real_t lfo_value_[2];
     T* buffer_;
     int32_t write_ptr_;
 
     DISALLOW_COPY_AND_ASSIGN(Context);
   };
   
-  inline void SetLFOFrequency(LFOIndex index, double frequency) {
+  inline void SetLFOFrequency(LFOIndex index, real_t frequency) {
     lfo_[index].template Init<stmlib::COSINE_OSCILLATOR_APPROXIMATE>(frequency * 32.0f);
   }
   
@@ -49,40 +49,40 @@ class LowPassGate {
   }
   
   void Process(
-      double gain,
-      double frequency,
-      double hf_bleed,
-      double* in_out,
+      real_t gain,
+      real_t frequency,
+      real_t hf_bleed,
+      real_t* in_out,
       size_t size) {
     stmlib::ParameterInterpolator gain_modulation(&previous_gain_, gain, size);
     filter_.set_f_q<stmlib::FREQUENCY_DIRTY>(frequency, 0.4);
     while (size--) {
-      const double s = *in_out * gain_modulation.Next();
-      const double lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
+      const real_t s = *in_out * gain_modulation.Next();
+      const real_t lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
       *in_out++ = lp + (s - lp) * hf_bleed;
     }
   }
   
   void Process(
-      double gain,
-      double frequency,
-      double hf_bleed,
-      double* in,
+      real_t gain,
+      real_t frequency,
+      real_t hf_bleed,
+      real_t* in,
       short* out,
       size_t size,
       size_t stride) {
     stmlib::ParameterInterpolator gain_modulation(&previous_gain_, gain, size);
     filter_.set_f_q<stmlib::FREQUENCY_DIRTY>(frequency, 0.4);
     while (size--) {
-      const double s = *in++ * gain_modulation.Next();
-      const double lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
+      const real_t s = *in++ * gain_modulation.Next();
+      const real_t lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
       *out = stmlib::Clip16(1 + static_cast<int32_t>(lp + (s - lp) * hf_bleed));
       out += stride;
     }
   }
   
  private:
-  double previous_gain_;
+  real_t previous_gain_;
   stmlib::Svf filter_;
   
   DISALLOW_COPY_AND_ASSIGN(LowPassGate);
@@ -47,13 +47,13 @@ class Overdrive {
     post_gain_ = 0.0;
   }
   
-  void Process(double drive, double* in_out, size_t size) {
-    const double drive_2 = drive * drive;
-    const double pre_gain_a = drive * 0.5;
-    const double pre_gain_b = drive_2 * drive_2 * drive * 24.0;
-    const double pre_gain = pre_gain_a + (pre_gain_b - pre_gain_a) * drive_2;
-    const double drive_squashed = drive * (2.0 - drive);
-    const double post_gain = 1.0 / stmlib::SoftClip(
+  void Process(real_t drive, real_t* in_out, size_t size) {
+    const real_t drive_2 = drive * drive;
+    const real_t pre_gain_a = drive * 0.5;
+    const real_t pre_gain_b = drive_2 * drive_2 * drive * 24.0;
+    const real_t pre_gain = pre_gain_a + (pre_gain_b - pre_gain_a) * drive_2;
+    const real_t drive_squashed = drive * (2.0 - drive);
+    const real_t post_gain = 1.0 / stmlib::SoftClip(
           0.33 + drive_squashed * (pre_gain - 0.33));
     
     stmlib::ParameterInterpolator pre_gain_modulation(
@@ -67,14 +67,14 @@ class Overdrive {
         size);
     
     while (size--) {
-      double pre = pre_gain_modulation.Next() * *in_out;
+      real_t pre = pre_gain_modulation.Next() * *in_out;
       *in_out++ = stmlib::SoftClip(pre) * post_gain_modulation.Next();
     }
   }
   
  private:
-  double pre_gain_;
-  double post_gain_;
+  real_t pre_gain_;
+  real_t post_gain_;
   
   DISALLOW_COPY_AND_ASSIGN(Overdrive);
 };
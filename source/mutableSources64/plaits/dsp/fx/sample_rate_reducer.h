@@ -49,7 +49,7 @@ class SampleRateReducer {
   }
   
   template<bool optimized_handling_of_special_cases>
-  void Process(double frequency, double* in_out, size_t size) {
+  void Process(real_t frequency, real_t* in_out, size_t size) {
     if (optimized_handling_of_special_cases) {
       // Use fast specialized implementations for target rates close to the
       // original rates. Caveats:
@@ -70,23 +70,23 @@ class SampleRateReducer {
     } else {
       CONSTRAIN(frequency, 0.0, 1.0);
     }
-    double previous_sample = previous_sample_;
-    double next_sample = next_sample_;
-    double sample = sample_;
-    double phase = phase_;
+    real_t previous_sample = previous_sample_;
+    real_t next_sample = next_sample_;
+    real_t sample = sample_;
+    real_t phase = phase_;
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
       phase += frequency;
       if (phase >= 1.0) {
         phase -= 1.0;
-        double t = phase / frequency;
+        real_t t = phase / frequency;
         // t = 0: the transition occurred right at this sample.
         // t = 1: the transition occurred at the previous sample.
         // Use linear interpolation to recover the fractional sample.
-        double new_sample = \
+        real_t new_sample = \
             previous_sample + (*in_out - previous_sample) * (1.0 - t);
-        double discontinuity = new_sample - sample;
+        real_t discontinuity = new_sample - sample;
         this_sample += discontinuity * stmlib::ThisBlepSample(t);
         next_sample += discontinuity * stmlib::NextBlepSample(t);
         sample = new_sample;
@@ -102,7 +102,7 @@ class SampleRateReducer {
   }
   
  private:
-  void ProcessHalf(double amount, double* in_out, size_t size) {
+  void ProcessHalf(real_t amount, real_t* in_out, size_t size) {
     // assert(size % 2 == 0);
     while (size) {
       in_out[1] += (in_out[0] - in_out[1]) * amount;
@@ -112,7 +112,7 @@ class SampleRateReducer {
     sample_ = next_sample_ = previous_sample_ = in_out[-1];
   }
   
-  void ProcessQuarter(double amount, double* in_out, size_t size) {
+  void ProcessQuarter(real_t amount, real_t* in_out, size_t size) {
     // assert(size % 4 == 0);
     while (size) {
       in_out[1] = in_out[0];
@@ -124,10 +124,10 @@ class SampleRateReducer {
     sample_ = next_sample_ = previous_sample_ = in_out[-1];
   }
    
-  double phase_;
-  double sample_;
-  double previous_sample_;
-  double next_sample_;
+  real_t phase_;
+  real_t sample_;
+  real_t previous_sample_;
+  real_t next_sample_;
   
   DISALLOW_COPY_AND_ASSIGN(SampleRateReducer);
 };
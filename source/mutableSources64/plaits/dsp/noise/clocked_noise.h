@@ -49,34 +49,34 @@ class ClockedNoise {
     frequency_ = 0.001;
   }
 
-  void Render(bool sync, double frequency, double* out, size_t size) {
+  void Render(bool sync, real_t frequency, real_t* out, size_t size) {
     CONSTRAIN(frequency, 0.0, 1.0);
     
     stmlib::ParameterInterpolator fm(&frequency_, frequency, size);
 
-    double next_sample = next_sample_;
-    double sample = sample_;
+    real_t next_sample = next_sample_;
+    real_t sample = sample_;
     
     if (sync) {
       phase_ = 1.0;
     }
 
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double frequency = fm.Next();
-      const double raw_sample = stmlib::Random::GetDouble() * 2.0 - 1.0;
-      double raw_amount = 4.0 * (frequency - 0.25);
+      const real_t frequency = fm.Next();
+      const real_t raw_sample = stmlib::Random::GetDouble() * 2.0 - 1.0;
+      real_t raw_amount = 4.0 * (frequency - 0.25);
       CONSTRAIN(raw_amount, 0.0, 1.0);
       
       phase_ += frequency;
       
       if (phase_ >= 1.0) {
         phase_ -= 1.0;
-        double t = phase_ / frequency;
-        double new_sample = raw_sample;
-        double discontinuity = new_sample - sample;
+        real_t t = phase_ / frequency;
+        real_t new_sample = raw_sample;
+        real_t discontinuity = new_sample - sample;
         this_sample += discontinuity * stmlib::ThisBlepSample(t);
         next_sample += discontinuity * stmlib::NextBlepSample(t);
         sample = new_sample;
@@ -90,12 +90,12 @@ class ClockedNoise {
   
  private:
   // Oscillator state.
-  double phase_;
-  double sample_;
-  double next_sample_;
+  real_t phase_;
+  real_t sample_;
+  real_t next_sample_;
 
   // For interpolation of parameters.
-  double frequency_;
+  real_t frequency_;
   
   DISALLOW_COPY_AND_ASSIGN(ClockedNoise);
 };
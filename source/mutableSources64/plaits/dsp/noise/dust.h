@@ -34,9 +34,9 @@
 
 namespace plaits {
 
-inline double Dust(double frequency) {
-  double inv_frequency = 1.0 / frequency;
-  double u = stmlib::Random::GetDouble();
+inline real_t Dust(real_t frequency) {
+  real_t inv_frequency = 1.0 / frequency;
+  real_t u = stmlib::Random::GetDouble();
   if (u < frequency) {
     return u * inv_frequency;
   } else {
@@ -45,13 +45,13 @@ class FractalRandomGenerator {
     }
   }
   
-  double Render(double frequency) {
+  real_t Render(real_t frequency) {
     return Render(frequency, 0.5);
   }
   
-  double Render(double frequency, double decay) {
-    double gain = 0.5;
-    double sum = 0.0;
+  real_t Render(real_t frequency, real_t decay) {
+    real_t gain = 0.5;
+    real_t sum = 0.0;
 
     for (int i = 0; i < order; ++i) {
       sum += generator_[i].Render(frequency) * gain;
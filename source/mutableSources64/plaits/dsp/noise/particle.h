@@ -48,28 +48,28 @@ class Particle {
   
   inline void Render(
       bool sync,
-      double density,
-      double gain,
-      double frequency,
-      double spread,
-      double q,
-      double* out,
-      double* aux,
+      real_t density,
+      real_t gain,
+      real_t frequency,
+      real_t spread,
+      real_t q,
+      real_t* out,
+      real_t* aux,
       size_t size) {
-    double u = stmlib::Random::GetDouble();
+    real_t u = stmlib::Random::GetDouble();
     if (sync) {
       u = density;
     }
     bool can_radomize_frequency = true;
     while (size--) {
-      double s = 0.0f;
+      real_t s = 0.0f;
       if (u <= density) {
         s = u * gain;
         if (can_radomize_frequency) {
-          const double u = 2.0 * stmlib::Random::GetDouble() - 1.0;
-          const double f = std::min(
+          const real_t u = 2.0 * stmlib::Random::GetDouble() - 1.0;
+          const real_t f = std::min(
               stmlib::SemitonesToRatio(spread * u) * frequency,
-              0.25);
+              real_t(0.25));
           pre_gain_ = 0.5 / stmlib::Sqrt(q * f * stmlib::Sqrt(density));
           filter_.set_f_q<stmlib::FREQUENCY_DIRTY>(f, q);
           // Keep the cutoff constant for this whole block.
@@ -83,7 +83,7 @@ class Particle {
   }
  
  private:
-  double pre_gain_;
+  real_t pre_gain_;
   stmlib::Svf filter_;
   
   DISALLOW_COPY_AND_ASSIGN(Particle);
@@ -55,10 +55,10 @@ class FormantOscillator {
   }
 
   void Render(
-      double carrier_frequency,
-      double formant_frequency,
-      double phase_shift,
-      double* out,
+      real_t carrier_frequency,
+      real_t formant_frequency,
+      real_t phase_shift,
+      real_t* out,
       size_t size) {
     if (carrier_frequency >= kMaxFrequency) {
       carrier_frequency = kMaxFrequency;
@@ -73,27 +73,27 @@ class FormantOscillator {
         &formant_frequency_, formant_frequency, size);
     stmlib::ParameterInterpolator pm(&phase_shift_, phase_shift, size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
 
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double carrier_frequency = carrier_fm.Next();
-      const double formant_frequency = formant_fm.Next();
+      const real_t carrier_frequency = carrier_fm.Next();
+      const real_t formant_frequency = formant_fm.Next();
 
       carrier_phase_ += carrier_frequency;
 
       if (carrier_phase_ >= 1.0) {
         carrier_phase_ -= 1.0;
-        double reset_time = carrier_phase_ / carrier_frequency;
+        real_t reset_time = carrier_phase_ / carrier_frequency;
 
-        double formant_phase_at_reset = formant_phase_ + \
+        real_t formant_phase_at_reset = formant_phase_ + \
             (1.0 - reset_time) * formant_frequency;
-        double before = Sine(
+        real_t before = Sine(
             formant_phase_at_reset + pm.subsample(1.0 - reset_time));
-        double after = Sine(0.0 + pm.subsample(1.0));
-        double discontinuity = after - before;
+        real_t after = Sine(0.0 + pm.subsample(1.0));
+        real_t discontinuity = after - before;
         this_sample += discontinuity * stmlib::ThisBlepSample(reset_time);
         next_sample += discontinuity * stmlib::NextBlepSample(reset_time);
         formant_phase_ = reset_time * formant_frequency;
@@ -104,7 +104,7 @@ class FormantOscillator {
         }
       }
 
-      const double phase_shift = pm.Next();
+      const real_t phase_shift = pm.Next();
       next_sample += Sine(formant_phase_ + phase_shift);
 
       *out++ = this_sample;
@@ -115,14 +115,14 @@ class FormantOscillator {
  private:
 
   // Oscillator state.
-  double carrier_phase_;
-  double formant_phase_;
-  double next_sample_;
+  real_t carrier_phase_;
+  real_t formant_phase_;
+  real_t next_sample_;
 
   // For interpolation of parameters.
-  double carrier_frequency_;
-  double formant_frequency_;
-  double phase_shift_;
+  real_t carrier_frequency_;
+  real_t formant_frequency_;
+  real_t phase_shift_;
 
   DISALLOW_COPY_AND_ASSIGN(FormantOscillator);
 };
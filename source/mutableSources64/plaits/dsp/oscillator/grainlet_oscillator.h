@@ -57,11 +57,11 @@ class GrainletOscillator {
   }
 
   void Render(
-      double carrier_frequency,
-      double formant_frequency,
-      double carrier_shape,
-      double carrier_bleed,
-      double* out,
+      real_t carrier_frequency,
+      real_t formant_frequency,
+      real_t carrier_shape,
+      real_t carrier_bleed,
+      real_t* out,
       size_t size) {
     if (carrier_frequency >= kMaxFrequency * 0.5) {
       carrier_frequency = kMaxFrequency * 0.5;
@@ -87,17 +87,17 @@ class GrainletOscillator {
         carrier_bleed,
         size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
 
     while (size--) {
       bool reset = false;
-      double reset_time = 0.0;
+      real_t reset_time = 0.0;
 
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double f0 = carrier_frequency_modulation.Next();
-      const double f1 = formant_frequency_modulation.Next();
+      const real_t f0 = carrier_frequency_modulation.Next();
+      const real_t f1 = formant_frequency_modulation.Next();
 
       carrier_phase_ += f0;
       reset = carrier_phase_ >= 1.0;
@@ -105,19 +105,19 @@ class GrainletOscillator {
       if (reset) {
         carrier_phase_ -= 1.0;
         reset_time = carrier_phase_ / f0;
-        double before = Grainlet(
+        real_t before = Grainlet(
             1.0,
             formant_phase_ + (1.0 - reset_time) * f1,
             carrier_shape_modulation.subsample(1.0 - reset_time),
             carrier_bleed_modulation.subsample(1.0 - reset_time));
 
-        double after = Grainlet(
+        real_t after = Grainlet(
             0.0,
             0.0,
             carrier_shape_modulation.subsample(1.0),
             carrier_bleed_modulation.subsample(1.0));
 
-        double discontinuity = after - before;
+        real_t discontinuity = after - before;
         this_sample += discontinuity * stmlib::ThisBlepSample(reset_time);
         next_sample += discontinuity * stmlib::NextBlepSample(reset_time);
         formant_phase_ = reset_time * f1;
@@ -145,10 +145,10 @@ class GrainletOscillator {
 //      //return std::sin(phase*2*M_PI);
 //  }
 
-  inline double Carrier(double phase, double shape) {
+  inline real_t Carrier(real_t phase, real_t shape) {
     shape *= 3.0;
     MAKE_INTEGRAL_FRACTIONAL(shape);
-    double t = 1.0 - shape_fractional;
+    real_t t = 1.0 - shape_fractional;
 
     if (shape_integral == 0) {
       phase = phase * (1.0 + t * t * t * 15.0);
@@ -157,7 +157,7 @@ class GrainletOscillator {
       }
       phase += 0.75;
     } else if (shape_integral == 1) {
-      double breakpoint = 0.001 + 0.499 * t * t * t;
+      real_t breakpoint = 0.001 + 0.499 * t * t * t;
       if (phase < breakpoint) {
         phase *= (0.5 / breakpoint);
       } else {
@@ -172,26 +172,26 @@ class GrainletOscillator {
     return (Sine(phase) + 1.0) * 0.25;
   }
 
-  inline double Grainlet(
-      double carrier_phase,
-      double formant_phase,
-      double shape,
-      double bleed) {
-    double carrier = Carrier(carrier_phase, shape);
-    double formant = Sine(formant_phase);
+  inline real_t Grainlet(
+      real_t carrier_phase,
+      real_t formant_phase,
+      real_t shape,
+      real_t bleed) {
+    real_t carrier = Carrier(carrier_phase, shape);
+    real_t formant = Sine(formant_phase);
     return carrier * (formant + bleed) / (1.0 + bleed);
   }
 
   // Oscillator state.
-  double carrier_phase_;
-  double formant_phase_;
-  double next_sample_;
+  real_t carrier_phase_;
+  real_t formant_phase_;
+  real_t next_sample_;
 
   // For interpolation of parameters.
-  double carrier_frequency_;
-  double formant_frequency_;
-  double carrier_shape_;
-  double carrier_bleed_;
+  real_t carrier_frequency_;
+  real_t formant_frequency_;
+  real_t carrier_shape_;
+  real_t carrier_bleed_;
 
   DISALLOW_COPY_AND_ASSIGN(GrainletOscillator);
 };
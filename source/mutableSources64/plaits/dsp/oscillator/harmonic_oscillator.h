@@ -55,9 +55,9 @@ class HarmonicOscillator {
 
   template<int first_harmonic_index>
   void Render(
-      double frequency,
-      const double* amplitudes,
-      double* out,
+      real_t frequency,
+      const real_t* amplitudes,
+      real_t* out,
       size_t size) {
     if (frequency >= 0.5) {
       frequency = 0.5;
@@ -67,7 +67,7 @@ class HarmonicOscillator {
     stmlib::ParameterInterpolator fm(&frequency_, frequency, size);
 
     for (int i = 0; i < num_harmonics; ++i) {
-      double f = frequency * static_cast<double>(first_harmonic_index + i);
+      real_t f = frequency * static_cast<real_t>(first_harmonic_index + i);
       if (f >= 0.5) {
         f = 0.5;
       }
@@ -79,21 +79,21 @@ class HarmonicOscillator {
       if (phase_ >= 1.0) {
         phase_ -= 1.0;
       }
-      const double two_x = 2.0 * SineNoWrap(phase_);
-      double previous, current;
+      const real_t two_x = 2.0 * SineNoWrap(phase_);
+      real_t previous, current;
       if (first_harmonic_index == 1) {
         previous = 1.0;
         current = two_x * 0.5;
       } else {
-        const double k = first_harmonic_index;
+        const real_t k = first_harmonic_index;
         previous = Sine(phase_ * (k - 1.0) + 0.25);
         current = Sine(phase_ * k);
       }
 
-      double sum = 0.0;
+      real_t sum = 0.0;
       for (int i = 0; i < num_harmonics; ++i) {
         sum += am[i].Next() * current;
-        double temp = current;
+        real_t temp = current;
         current = two_x * current - previous;
         previous = temp;
       }
@@ -107,11 +107,11 @@ class HarmonicOscillator {
 
  private:
   // Oscillator state.
-  double phase_;
+  real_t phase_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double amplitude_[num_harmonics];
+  real_t frequency_;
+  real_t amplitude_[num_harmonics];
 
   DISALLOW_COPY_AND_ASSIGN(HarmonicOscillator);
 };
@@ -54,42 +54,42 @@ class NESTriangleOscillator {
     frequency_ = 0.001;
   }
 
-  inline void Render(double frequency, double* out, size_t size) {
+  inline void Render(real_t frequency, real_t* out, size_t size) {
     // Compute all constants needed to scale the waveform and its
     // discontinuities.
     const int num_steps = 1 << num_bits;
     const int half = num_steps / 2;
     const int top = num_steps != 2 ? num_steps - 1 : 2;
-    const double num_steps_f = static_cast<double>(num_steps);
-    const double scale = num_steps != 2
-        ? 4.0 / static_cast<double>(top - 1)
+    const real_t num_steps_f = static_cast<real_t>(num_steps);
+    const real_t scale = num_steps != 2
+        ? 4.0 / static_cast<real_t>(top - 1)
         : 2.0;
 
-    frequency = std::min(frequency, 0.25);
+    frequency = std::min(frequency, real_t(0.25));
 
     stmlib::ParameterInterpolator fm(&frequency_, frequency, size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
     while (size--) {
-      const double frequency = fm.Next();
+      const real_t frequency = fm.Next();
       phase_ += frequency;
 
       // Compute the point at which we transition between the "full resolution"
       // NES triangle, and a naive band-limited triangle.
-      double fade_to_tri = (frequency - 0.5 / num_steps_f) * 2.0 * num_steps_f;
+      real_t fade_to_tri = (frequency - 0.5 / num_steps_f) * 2.0 * num_steps_f;
       CONSTRAIN(fade_to_tri, 0.0, 1.0)
 
-      const double nes_gain = 1.0 - fade_to_tri;
-      const double tri_gain = fade_to_tri * 2.0 / scale;
+      const real_t nes_gain = 1.0 - fade_to_tri;
+      const real_t tri_gain = fade_to_tri * 2.0 / scale;
 
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
       // Handle the discontinuity at the top of the naive triangle.
       if (ascending_ && phase_ >= 0.5) {
-        double discontinuity = 4.0 * frequency * tri_gain;
+        real_t discontinuity = 4.0 * frequency * tri_gain;
         if (discontinuity) {
-          double t = (phase_ - 0.5) / frequency;
+          real_t t = (phase_ - 0.5) / frequency;
           this_sample -= stmlib::ThisIntegratedBlepSample(t) * discontinuity;
           next_sample -= stmlib::NextIntegratedBlepSample(t) * discontinuity;
         }
@@ -105,7 +105,7 @@ class NESTriangleOscillator {
           wrap = true;
         }
 
-        double discontinuity = next_step < half ? 1.0 : -1.0;
+        real_t discontinuity = next_step < half ? 1.0 : -1.0;
         if (num_steps == 2) {
           discontinuity = -discontinuity;
         } else {
@@ -117,17 +117,17 @@ class NESTriangleOscillator {
         // Handle the discontinuity at each step of the NES triangle.
         discontinuity *= nes_gain;
         if (discontinuity) {
-          double frac = (phase_ * num_steps_f - static_cast<double>(next_step));
-          double t = frac / (frequency * num_steps_f);
+          real_t frac = (phase_ * num_steps_f - static_cast<real_t>(next_step));
+          real_t t = frac / (frequency * num_steps_f);
           this_sample += stmlib::ThisBlepSample(t) * discontinuity;
           next_sample += stmlib::NextBlepSample(t) * discontinuity;
         }
 
         // Handle the discontinuity at the bottom of the naive triangle.
         if (wrap) {
-          double discontinuity = 4.0f * frequency * tri_gain;
+          real_t discontinuity = 4.0f * frequency * tri_gain;
           if (discontinuity) {
-            double t = phase_ / frequency;
+            real_t t = phase_ / frequency;
             this_sample += stmlib::ThisIntegratedBlepSample(t) * discontinuity;
             next_sample += stmlib::NextIntegratedBlepSample(t) * discontinuity;
           }
@@ -138,7 +138,7 @@ class NESTriangleOscillator {
 
       // Contribution from NES triangle.
       next_sample += nes_gain * \
-          static_cast<double>(step_ < half ? step_ : top - step_);
+          static_cast<real_t>(step_ < half ? step_ : top - step_);
 
       // Contribution from naive triangle.
       next_sample += tri_gain * \
@@ -151,13 +151,13 @@ class NESTriangleOscillator {
 
  private:
   // Oscillator state.
-  double phase_;
-  double next_sample_;
+  real_t phase_;
+  real_t next_sample_;
   int step_;
   bool ascending_;
 
   // For interpolation of parameters.
-  double frequency_;
+  real_t frequency_;
 
   DISALLOW_COPY_AND_ASSIGN(NESTriangleOscillator);
 };
@@ -48,8 +48,8 @@ enum OscillatorShape {
   OSCILLATOR_SHAPE_SQUARE_TRIANGLE
 };
 
-const double kMaxFrequency = 0.25;
-const double kMinFrequency = 0.000001;
+const real_t kMaxFrequency = 0.25;
+const real_t kMinFrequency = 0.000001;
 
 class Oscillator {
  public:
@@ -68,16 +68,16 @@ class Oscillator {
   }
 
   template<OscillatorShape shape>
-  void Render(double frequency, double pw, double* out, size_t size) {
+  void Render(real_t frequency, real_t pw, real_t* out, size_t size) {
     Render<shape, false, false>(frequency, pw, NULL, out, size);
   }
   
   template<OscillatorShape shape>
   void Render(
-      double frequency,
-      double pw,
-      const double* fm,
-      double* out,
+      real_t frequency,
+      real_t pw,
+      const real_t* fm,
+      real_t* out,
       size_t size) {
     if (!fm) {
       Render<shape, false, false>(frequency, pw, NULL, out, size);
@@ -88,10 +88,10 @@ class Oscillator {
 
   template<OscillatorShape shape, bool has_external_fm, bool through_zero_fm>
   void Render(
-      double frequency,
-      double pw,
-      const double* external_fm,
-      double* out,
+      real_t frequency,
+      real_t pw,
+      const real_t* external_fm,
+      real_t* out,
       size_t size) {
     
     if (!has_external_fm) {
@@ -106,13 +106,13 @@ class Oscillator {
     stmlib::ParameterInterpolator fm(&frequency_, frequency, size);
     stmlib::ParameterInterpolator pwm(&pw_, pw, size);
   
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
   
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      double frequency = fm.Next();
+      real_t frequency = fm.Next();
       if (has_external_fm) {
         frequency *= (1.0 + *external_fm++);
         if (!through_zero_fm) {
@@ -121,7 +121,7 @@ class Oscillator {
           CONSTRAIN(frequency, -kMaxFrequency, kMaxFrequency);
         }
       }
-      double pw = (shape == OSCILLATOR_SHAPE_SQUARE_TRIANGLE ||
+      real_t pw = (shape == OSCILLATOR_SHAPE_SQUARE_TRIANGLE ||
                   shape == OSCILLATOR_SHAPE_TRIANGLE) ? 0.5 : pwm.Next();
       if (has_external_fm) {
         CONSTRAIN(pw, std::abs(frequency) * 2.0, 1.0 - 2.0 * std::abs(frequency))
@@ -131,11 +131,11 @@ class Oscillator {
       if (shape <= OSCILLATOR_SHAPE_SAW) {
         if (phase_ >= 1.0) {
           phase_ -= 1.0;
-          double t = phase_ / frequency;
+          real_t t = phase_ / frequency;
           this_sample -= stmlib::ThisBlepSample(t);
           next_sample -= stmlib::NextBlepSample(t);
         } else if (through_zero_fm && phase_ < 0.0) {
-          double t = phase_ / frequency;
+          real_t t = phase_ / frequency;
           phase_ += 1.0;
           this_sample += stmlib::ThisBlepSample(t);
           next_sample += stmlib::NextBlepSample(t);
@@ -150,15 +150,15 @@ class Oscillator {
           hp_state_ = this_sample;
         }
       } else if (shape <= OSCILLATOR_SHAPE_SLOPE) {
-        double slope_up = 2.0;
-        double slope_down = 2.0;
+        real_t slope_up = 2.0;
+        real_t slope_down = 2.0;
         if (shape == OSCILLATOR_SHAPE_SLOPE) {
           slope_up = 1.0 / (pw);
           slope_down = 1.0 / (1.0 - pw);
         }
         if (high_ ^ (phase_ < pw)) {
-          double t = (phase_ - pw) / frequency;
-          double discontinuity = (slope_up + slope_down) * frequency;
+          real_t t = (phase_ - pw) / frequency;
+          real_t discontinuity = (slope_up + slope_down) * frequency;
           if (through_zero_fm && frequency < 0.0) {
             discontinuity = -discontinuity;
           }
@@ -168,15 +168,15 @@ class Oscillator {
         }
         if (phase_ >= 1.0) {
           phase_ -= 1.0;
-          double t = phase_ / frequency;
-          double discontinuity = (slope_up + slope_down) * frequency;
+          real_t t = phase_ / frequency;
+          real_t discontinuity = (slope_up + slope_down) * frequency;
           this_sample += stmlib::ThisIntegratedBlepSample(t) * discontinuity;
           next_sample += stmlib::NextIntegratedBlepSample(t) * discontinuity;
           high_ = true;
         } else if (through_zero_fm && phase_ < 0.0) {
-          double t = phase_ / frequency;
+          real_t t = phase_ / frequency;
           phase_ += 1.0;
-          double discontinuity = (slope_up + slope_down) * frequency;
+          real_t discontinuity = (slope_up + slope_down) * frequency;
           this_sample -= stmlib::ThisIntegratedBlepSample(t) * discontinuity;
           next_sample -= stmlib::NextIntegratedBlepSample(t) * discontinuity;
           high_ = false;
@@ -187,8 +187,8 @@ class Oscillator {
         *out++ = 2.0 * this_sample - 1.0;
       } else {
         if (high_ ^ (phase_ >= pw)) {
-          double t = (phase_ - pw) / frequency;
-          double discontinuity = 1.0;
+          real_t t = (phase_ - pw) / frequency;
+          real_t discontinuity = 1.0;
           if (through_zero_fm && frequency < 0.0) {
             discontinuity = -discontinuity;
           }
@@ -198,12 +198,12 @@ class Oscillator {
         }
         if (phase_ >= 1.0) {
           phase_ -= 1.0;
-          double t = phase_ / frequency;
+          real_t t = phase_ / frequency;
           this_sample -= stmlib::ThisBlepSample(t);
           next_sample -= stmlib::NextBlepSample(t);
           high_ = false;
         } else if (through_zero_fm && phase_ < 0.0) {
-          double t = phase_ / frequency;
+          real_t t = phase_ / frequency;
           phase_ += 1.0;
           this_sample += stmlib::ThisBlepSample(t);
           next_sample += stmlib::NextBlepSample(t);
@@ -212,17 +212,17 @@ class Oscillator {
         next_sample += phase_ < pw ? 0.0 : 1.0;
         
         if (shape == OSCILLATOR_SHAPE_SQUARE_TRIANGLE) {
-          const double integrator_coefficient = frequency * 0.0625;
+          const real_t integrator_coefficient = frequency * 0.0625;
           this_sample = 128.0 * (this_sample - 0.5);
           lp_state_ += integrator_coefficient * (this_sample - lp_state_);
           *out++ = lp_state_;
         } else if (shape == OSCILLATOR_SHAPE_SQUARE_DARK) {
-          const double integrator_coefficient = frequency * 2.0;
+          const real_t integrator_coefficient = frequency * 2.0;
           this_sample = 4.0 * (this_sample - 0.5);
           lp_state_ += integrator_coefficient * (this_sample - lp_state_);
           *out++ = lp_state_;
         } else if (shape == OSCILLATOR_SHAPE_SQUARE_BRIGHT) {
-          const double integrator_coefficient = frequency * 2.0;
+          const real_t integrator_coefficient = frequency * 2.0;
           this_sample = 2.0 * this_sample - 1.0;
           lp_state_ += integrator_coefficient * (this_sample - lp_state_);
           *out++ = (this_sample - lp_state_) * 0.5;
@@ -237,15 +237,15 @@ class Oscillator {
   
  private:
   // Oscillator state.
-  double phase_;
-  double next_sample_;
-  double lp_state_;
-  double hp_state_;
+  real_t phase_;
+  real_t next_sample_;
+  real_t lp_state_;
+  real_t hp_state_;
   bool high_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double pw_;
+  real_t frequency_;
+  real_t pw_;
   
   DISALLOW_COPY_AND_ASSIGN(Oscillator);
 };
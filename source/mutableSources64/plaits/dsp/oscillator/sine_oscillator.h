@@ -41,38 +41,38 @@
 
 namespace plaits {
 
-  const double kSineLUTSize = 512.0;
+  const real_t kSineLUTSize = 512.0;
   const size_t kSineLUTQuadrature = 128;
   const size_t kSineLUTBits = 9;
 
   // Safe for phase >= 0.0f, will wrap.
-  inline double Sine(double phase) {
+  inline real_t Sine(real_t phase) {
     return stmlib::InterpolateWrap(lut_sine, phase, kSineLUTSize);
   }
 
   // Potentially unsafe, if phase >= 1.25.
-  inline double SineNoWrap(double phase) {
+  inline real_t SineNoWrap(real_t phase) {
     return stmlib::Interpolate(lut_sine, phase, kSineLUTSize);
   }
 
   // With positive of negative phase modulation up to an index of 32.
-  inline double SinePM(uint32_t phase, double pm) {
-    const double max_uint32 = 4294967296.0;
+  inline real_t SinePM(uint32_t phase, real_t pm) {
+    const real_t max_uint32 = 4294967296.0;
     const int max_index = 32;
-    const double offset = double(max_index);
-    const double scale = max_uint32 / double(max_index * 2);
+    const real_t offset = real_t(max_index);
+    const real_t scale = max_uint32 / real_t(max_index * 2);
 
     phase += static_cast<uint32_t>((pm + offset) * scale) * max_index * 2;
 
     uint32_t integral = phase >> (32 - kSineLUTBits);
-    double fractional = static_cast<double>(phase << kSineLUTBits) / double(max_uint32);
-    double a = lut_sine[integral];
-    double b = lut_sine[integral + 1];
+    real_t fractional = static_cast<real_t>(phase << kSineLUTBits) / real_t(max_uint32);
+    real_t a = lut_sine[integral];
+    real_t b = lut_sine[integral + 1];
     return a + (b - a) * fractional;
   }
 
   // Direct lookup without interpolation.
-  inline double SineRaw(uint32_t phase) {
+  inline real_t SineRaw(uint32_t phase) {
     return lut_sine[phase >> (32 - kSineLUTBits)];
   }
 
@@ -88,7 +88,7 @@ class SineOscillator {
     amplitude_ = 0.0f;
   }
 
-  inline double Next(double frequency) {
+  inline real_t Next(real_t frequency) {
     if (frequency >= 0.5f) {
       frequency = 0.5f;
     }
@@ -102,7 +102,7 @@ class SineOscillator {
     return SineNoWrap(phase_);
   }
 
-  inline void Next(double frequency, double amplitude, double* sin, double* cos) {
+  inline void Next(real_t frequency, real_t amplitude, real_t* sin, real_t* cos) {
     if (frequency >= 0.5) {
       frequency = 0.5;
     }
@@ -118,18 +118,18 @@ class SineOscillator {
     *cos = amplitude * SineNoWrap(phase_ + 0.25);
   }
 
-  void Render(double frequency, double amplitude, double* out, size_t size) {
+  void Render(real_t frequency, real_t amplitude, real_t* out, size_t size) {
     RenderInternal<true>(frequency, amplitude, out, size);
   }
 
-  void Render(double frequency, double* out, size_t size) {
+  void Render(real_t frequency, real_t* out, size_t size) {
     RenderInternal<false>(frequency, 1.0, out, size);
   }
 
  private:
   template<bool additive>
   void RenderInternal(
-      double frequency, double amplitude, double* out, size_t size) {
+      real_t frequency, real_t amplitude, real_t* out, size_t size) {
     if (frequency >= 0.5) {
       frequency = 0.5;
     }
@@ -141,7 +141,7 @@ class SineOscillator {
       if (phase_ >= 1.0) {
         phase_ -= 1.0;
       }
-      double s = SineNoWrap(phase_);
+      real_t s = SineNoWrap(phase_);
       if (additive) {
         *out++ += am.Next() * s;
       } else {
@@ -151,11 +151,11 @@ class SineOscillator {
   }
 
   // Oscillator state.
-  double phase_;
+  real_t phase_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double amplitude_;
+  real_t frequency_;
+  real_t amplitude_;
 
   DISALLOW_COPY_AND_ASSIGN(SineOscillator);
 };
@@ -178,34 +178,34 @@ class FastSineOscillator {
     QUADRATURE
   };
 
-  static inline double Fast2Sin(double f) {
+  static inline real_t Fast2Sin(real_t f) {
     // In theory, epsilon = 2 sin(pi f)
     // Here, to avoid the call to sinf, we use a 3rd order polynomial
     // approximation, which looks like a Taylor expansion, but with a
     // correction term to give a good trade-off between average error
     // (1.13 cents) and maximum error (7.33 cents) when generating sinewaves
     // in the 16 Hz to 16kHz range (with sr = 48kHz).
-    const double f_pi = f * M_PI;
+    const real_t f_pi = f * M_PI;
     return f_pi * (2.0 - (2.0 * 0.96 / 6.0) * f_pi * f_pi);
   }
 
-  void Render(double frequency, double* out, size_t size) {
+  void Render(real_t frequency, real_t* out, size_t size) {
     RenderInternal<NORMAL>(frequency, 1.0, out, NULL, size);
   }
 
-  void Render(double frequency, double amplitude, double* out, size_t size) {
+  void Render(real_t frequency, real_t amplitude, real_t* out, size_t size) {
     RenderInternal<ADDITIVE>(frequency, amplitude, out, NULL, size);
   }
 
   void RenderQuadrature(
-      double frequency, double amplitude, double* x, double* y, size_t size) {
+      real_t frequency, real_t amplitude, real_t* x, real_t* y, size_t size) {
     RenderInternal<QUADRATURE>(frequency, amplitude, x, y, size);
   }
 
  private:
   template<Mode mode>
   void RenderInternal(
-      double frequency, double amplitude, double* out, double* out_2, size_t size) {
+      real_t frequency, real_t amplitude, real_t* out, real_t* out_2, size_t size) {
     if (frequency >= 0.25) {
       frequency = 0.25;
       amplitude = 0.0;
@@ -215,18 +215,18 @@ class FastSineOscillator {
 
     stmlib::ParameterInterpolator epsilon(&epsilon_, Fast2Sin(frequency), size);
     stmlib::ParameterInterpolator am(&amplitude_, amplitude, size);
-    double x = x_;
-    double y = y_;
+    real_t x = x_;
+    real_t y = y_;
 
-    const double norm = x * x + y * y;
+    const real_t norm = x * x + y * y;
     if (norm <= 0.5 || norm >= 2.0) {
-      const double scale = stmlib::fast_rsqrt_carmack(norm);
+      const real_t scale = stmlib::fast_rsqrt_carmack(norm);
       x *= scale;
       y *= scale;
     }
 
     while (size--) {
-      const double e = epsilon.Next();
+      const real_t e = epsilon.Next();
       x += e * y;
       y -= e * x;
       if (mode == ADDITIVE) {
@@ -234,7 +234,7 @@ class FastSineOscillator {
       } else if (mode == NORMAL) {
         *out++ = x;
       } else if (mode == QUADRATURE) {
-        const double amplitude = am.Next();
+        const real_t amplitude = am.Next();
         *out++ = x * amplitude;
         *out_2++ = y * amplitude;
       }
@@ -244,12 +244,12 @@ class FastSineOscillator {
   }
 
   // Oscillator state.
-  double x_;
-  double y_;
+  real_t x_;
+  real_t y_;
 
   // For interpolation of parameters.
-  double epsilon_;
-  double amplitude_;
+  real_t epsilon_;
+  real_t amplitude_;
 
   DISALLOW_COPY_AND_ASSIGN(FastSineOscillator);
 };
@@ -65,10 +65,10 @@ class StringSynthOscillator {
   }
   
   inline void Render(
-      double frequency,
-      const double* unshifted_registration,
-      double gain,
-      double* out,
+      real_t frequency,
+      const real_t* unshifted_registration,
+      real_t gain,
+      real_t* out,
       size_t size) {
     frequency *= 8.0;
     
@@ -85,7 +85,7 @@ class StringSynthOscillator {
       return;
     }
     
-    double registration[7];
+    real_t registration[7];
     std::fill(&registration[0], &registration[shift], 0.0);
     std::copy(
         &unshifted_registration[0],
@@ -110,23 +110,23 @@ class StringSynthOscillator {
         (registration[6] - registration[5]) * gain,
         size);
     
-    double phase = phase_;
-    double next_sample = next_sample_;
+    real_t phase = phase_;
+    real_t next_sample = next_sample_;
     int segment = segment_;
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
   
-      const double frequency = fm.Next();
-      const double saw_8_gain = saw_8_gain_modulation.Next();
-      const double saw_4_gain = saw_4_gain_modulation.Next();
-      const double saw_2_gain = saw_2_gain_modulation.Next();
-      const double saw_1_gain = saw_1_gain_modulation.Next();
+      const real_t frequency = fm.Next();
+      const real_t saw_8_gain = saw_8_gain_modulation.Next();
+      const real_t saw_4_gain = saw_4_gain_modulation.Next();
+      const real_t saw_2_gain = saw_2_gain_modulation.Next();
+      const real_t saw_1_gain = saw_1_gain_modulation.Next();
 
       phase += frequency;
       int next_segment = static_cast<int>(phase);
       if (next_segment != segment) {
-        double discontinuity = 0.0;
+        real_t discontinuity = 0.0;
         if (next_segment == 8) {
           phase -= 8.0;
           next_segment -= 8;
@@ -140,8 +140,8 @@ class StringSynthOscillator {
         }
         discontinuity -= saw_1_gain;
         if (discontinuity != 0.0) {
-          double fraction = phase - static_cast<double>(next_segment);
-          double t = fraction / frequency;
+          real_t fraction = phase - static_cast<real_t>(next_segment);
+          real_t t = fraction / frequency;
           this_sample += stmlib::ThisBlepSample(t) * discontinuity;
           next_sample += stmlib::NextBlepSample(t) * discontinuity;
         }
@@ -149,9 +149,9 @@ class StringSynthOscillator {
       segment = next_segment;
       
       next_sample += (phase - 4.0) * saw_8_gain * 0.125;
-      next_sample += (phase - double(segment & 4) - 2.0) * saw_4_gain * 0.25;
-      next_sample += (phase - double(segment & 6) - 1.0) * saw_2_gain * 0.5;
-      next_sample += (phase - double(segment & 7) - 0.5) * saw_1_gain;
+      next_sample += (phase - real_t(segment & 4) - 2.0) * saw_4_gain * 0.25;
+      next_sample += (phase - real_t(segment & 6) - 1.0) * saw_2_gain * 0.5;
+      next_sample += (phase - real_t(segment & 7) - 0.5) * saw_1_gain;
       *out++ += 2.0 * this_sample;
     }
     next_sample_ = next_sample;
@@ -161,16 +161,16 @@ class StringSynthOscillator {
  
  private:
   // Oscillator state.
-  double phase_;
-  double next_sample_;
+  real_t phase_;
+  real_t next_sample_;
   int segment_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double saw_8_gain_;
-  double saw_4_gain_;
-  double saw_2_gain_;
-  double saw_1_gain_;
+  real_t frequency_;
+  real_t saw_8_gain_;
+  real_t saw_4_gain_;
+  real_t saw_2_gain_;
+  real_t saw_1_gain_;
 
   DISALLOW_COPY_AND_ASSIGN(StringSynthOscillator);
 };
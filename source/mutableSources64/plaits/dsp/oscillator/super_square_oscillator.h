@@ -55,11 +55,11 @@ class SuperSquareOscillator {
   }
 
   void Render(
-      double frequency,
-      double shape,
-      double* out,
+      real_t frequency,
+      real_t shape,
+      real_t* out,
       size_t size) {
-    double master_frequency = frequency;
+    real_t master_frequency = frequency;
     frequency *= shape < 0.5
         ? (0.51 + 0.98 * shape)
         : 1.0 + 16.0 * (shape - 0.5) * (shape - 0.5);
@@ -76,25 +76,25 @@ class SuperSquareOscillator {
         &master_frequency_, master_frequency, size);
     stmlib::ParameterInterpolator fm(&slave_frequency_, frequency, size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
 
     while (size--) {
       bool reset = false;
       bool transition_during_reset = false;
-      double reset_time = 0.0;
+      real_t reset_time = 0.0;
 
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double master_frequency = master_fm.Next();
-      const double slave_frequency = fm.Next();
+      const real_t master_frequency = master_fm.Next();
+      const real_t slave_frequency = fm.Next();
 
       master_phase_ += master_frequency;
       if (master_phase_ >= 1.0) {
         master_phase_ -= 1.0;
         reset_time = master_phase_ / master_frequency;
 
-        double slave_phase_at_reset = slave_phase_ + \
+        real_t slave_phase_at_reset = slave_phase_ + \
             (1.0 - reset_time) * slave_frequency;
         reset = true;
         if (slave_phase_at_reset >= 1.0) {
@@ -104,7 +104,7 @@ class SuperSquareOscillator {
         if (!high_ && slave_phase_at_reset >= 0.5) {
           transition_during_reset = true;
         }
-        double value = slave_phase_at_reset < 0.5 ? 0.0 : 1.0;
+        real_t value = slave_phase_at_reset < 0.5 ? 0.0 : 1.0;
         this_sample -= value * stmlib::ThisBlepSample(reset_time);
         next_sample -= value * stmlib::NextBlepSample(reset_time);
       }
@@ -115,7 +115,7 @@ class SuperSquareOscillator {
           if (slave_phase_ < 0.5) {
             break;
           }
-          double t = (slave_phase_ - 0.5) / slave_frequency;
+          real_t t = (slave_phase_ - 0.5) / slave_frequency;
           this_sample += stmlib::ThisBlepSample(t);
           next_sample += stmlib::NextBlepSample(t);
           high_ = true;
@@ -126,7 +126,7 @@ class SuperSquareOscillator {
             break;
           }
           slave_phase_ -= 1.0;
-          double t = slave_phase_ / slave_frequency;
+          real_t t = slave_phase_ / slave_frequency;
           this_sample -= stmlib::ThisBlepSample(t);
           next_sample -= stmlib::NextBlepSample(t);
           high_ = false;
@@ -147,14 +147,14 @@ class SuperSquareOscillator {
 
  private:
   // Oscillator state.
-  double master_phase_;
-  double slave_phase_;
-  double next_sample_;
+  real_t master_phase_;
+  real_t slave_phase_;
+  real_t next_sample_;
   bool high_;
 
   // For interpolation of parameters.
-  double master_frequency_;
-  double slave_frequency_;
+  real_t master_frequency_;
+  real_t slave_frequency_;
 
   DISALLOW_COPY_AND_ASSIGN(SuperSquareOscillator);
 };
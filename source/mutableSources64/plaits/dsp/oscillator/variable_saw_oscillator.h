@@ -41,7 +41,7 @@
 
 namespace plaits {
 
-const double kVariableSawNotchDepth = 0.2;
+const real_t kVariableSawNotchDepth = 0.2;
 
 class VariableSawOscillator {
  public:
@@ -60,10 +60,10 @@ class VariableSawOscillator {
   }
   
   void Render(
-      double frequency,
-      double pw,
-      double waveshape,
-      double* out,
+      real_t frequency,
+      real_t pw,
+      real_t waveshape,
+      real_t* out,
       size_t size) {
     if (frequency >= kMaxFrequency) {
       frequency = kMaxFrequency;
@@ -80,26 +80,26 @@ class VariableSawOscillator {
     stmlib::ParameterInterpolator waveshape_modulation(
         &waveshape_, waveshape, size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
     
     while (size--) {
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0f;
     
-      const double frequency = fm.Next();
-      const double pw = pwm.Next();
-      const double waveshape = waveshape_modulation.Next();
-      const double triangle_amount = waveshape;
-      const double notch_amount = 1.0 - waveshape;
-      const double slope_up = 1.0 / (pw);
-      const double slope_down = 1.0 / (1.0 - pw);
+      const real_t frequency = fm.Next();
+      const real_t pw = pwm.Next();
+      const real_t waveshape = waveshape_modulation.Next();
+      const real_t triangle_amount = waveshape;
+      const real_t notch_amount = 1.0 - waveshape;
+      const real_t slope_up = 1.0 / (pw);
+      const real_t slope_down = 1.0 / (1.0 - pw);
 
       phase_ += frequency;
       
       if (!high_ && phase_ >= pw) {
-        const double triangle_step = (slope_up + slope_down) * frequency * triangle_amount;
-        const double notch = (kVariableSawNotchDepth + 1.0 - pw) * notch_amount;
-        const double t = (phase_ - pw) / (previous_pw_ - pw + frequency);
+        const real_t triangle_step = (slope_up + slope_down) * frequency * triangle_amount;
+        const real_t notch = (kVariableSawNotchDepth + 1.0 - pw) * notch_amount;
+        const real_t t = (phase_ - pw) / (previous_pw_ - pw + frequency);
         this_sample += notch * stmlib::ThisBlepSample(t);
         next_sample += notch * stmlib::NextBlepSample(t);
         this_sample -= triangle_step * stmlib::ThisIntegratedBlepSample(t);
@@ -107,9 +107,9 @@ class VariableSawOscillator {
         high_ = true;
       } else if (phase_ >= 1.0) {
         phase_ -= 1.0;
-        const double triangle_step = (slope_up + slope_down) * frequency * triangle_amount;
-        const double notch = (kVariableSawNotchDepth + 1.0) * notch_amount;
-        const double t = phase_ / frequency;
+        const real_t triangle_step = (slope_up + slope_down) * frequency * triangle_amount;
+        const real_t notch = (kVariableSawNotchDepth + 1.0) * notch_amount;
+        const real_t t = phase_ / frequency;
         this_sample -= notch * stmlib::ThisBlepSample(t);
         next_sample -= notch * stmlib::NextBlepSample(t);
         this_sample += triangle_step * stmlib::ThisIntegratedBlepSample(t);
@@ -134,30 +134,30 @@ class VariableSawOscillator {
 
 
  private:
-  inline double ComputeNaiveSample(
-      double phase,
-      double pw,
-      double slope_up,
-      double slope_down,
-      double triangle_amount,
-      double notch_amount) const {
-    double notch_saw = phase < pw ? phase : 1.0 + kVariableSawNotchDepth;
-    double triangle = phase < pw
+  inline real_t ComputeNaiveSample(
+      real_t phase,
+      real_t pw,
+      real_t slope_up,
+      real_t slope_down,
+      real_t triangle_amount,
+      real_t notch_amount) const {
+    real_t notch_saw = phase < pw ? phase : 1.0 + kVariableSawNotchDepth;
+    real_t triangle = phase < pw
         ? phase * slope_up
         : 1.0f - (phase - pw) * slope_down;
     return notch_saw * notch_amount + triangle * triangle_amount;
   }
 
   // Oscillator state.
-  double phase_;
-  double next_sample_;
-  double previous_pw_;
+  real_t phase_;
+  real_t next_sample_;
+  real_t previous_pw_;
   bool high_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double pw_;
-  double waveshape_;
+  real_t frequency_;
+  real_t pw_;
+  real_t waveshape_;
 
   DISALLOW_COPY_AND_ASSIGN(VariableSawOscillator);
 };
@@ -64,20 +64,20 @@ class VariableShapeOscillator {
   }
 
 void Render(
-    double frequency,
-    double pw,
-    double waveshape,
-    double* out,
+    real_t frequency,
+    real_t pw,
+    real_t waveshape,
+    real_t* out,
     size_t size) {
     Render<false, false>(0.0, frequency, pw, waveshape, 0.0, out, size);
 }
 
 void Render(
-    double master_frequency,
-    double frequency,
-    double pw,
-    double waveshape,
-    double* out,
+    real_t master_frequency,
+    real_t frequency,
+    real_t pw,
+    real_t waveshape,
+    real_t* out,
     size_t size) {
     Render<true, false>(
         master_frequency,
@@ -90,12 +90,12 @@ void Render(
 
   template<bool enable_sync, bool output_phase>
   void Render(
-      double master_frequency,
-      double frequency,
-      double pw,
-      double waveshape,
-      double phase_modulation_amount,
-      double* out,
+      real_t master_frequency,
+      real_t frequency,
+      real_t pw,
+      real_t waveshape,
+      real_t phase_modulation_amount,
+      real_t* out,
       size_t size) {
     if (master_frequency >= kMaxFrequency) {
       master_frequency = kMaxFrequency;
@@ -119,24 +119,24 @@ void Render(
     stmlib::ParameterInterpolator phase_modulation(
         &phase_modulation_, phase_modulation_amount, size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
 
     while (size--) {
       bool reset = false;
       bool transition_during_reset = false;
-      double reset_time = 0.0;
+      real_t reset_time = 0.0;
 
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double master_frequency = master_fm.Next();
-      const double slave_frequency = fm.Next();
-      const double pw = pwm.Next();
-      const double waveshape = waveshape_modulation.Next();
-      const double square_amount = std::max(waveshape - 0.5, 0.0) * 2.0;
-      const double triangle_amount = std::max(1.0 - waveshape * 2.0, 0.0);
-      const double slope_up = 1.0 / (pw);
-      const double slope_down = 1.0 / (1.0 - pw);
+      const real_t master_frequency = master_fm.Next();
+      const real_t slave_frequency = fm.Next();
+      const real_t pw = pwm.Next();
+      const real_t waveshape = waveshape_modulation.Next();
+      const real_t square_amount = std::max(waveshape - 0.5, 0.0) * 2.0;
+      const real_t triangle_amount = std::max(1.0 - waveshape * 2.0, 0.0);
+      const real_t slope_up = 1.0 / (pw);
+      const real_t slope_down = 1.0 / (1.0 - pw);
 
       if (enable_sync) {
         master_phase_ += master_frequency;
@@ -144,7 +144,7 @@ void Render(
           master_phase_ -= 1.0;
           reset_time = master_phase_ / master_frequency;
 
-          double slave_phase_at_reset = slave_phase_ + \
+          real_t slave_phase_at_reset = slave_phase_ + \
               (1.0 - reset_time) * slave_frequency;
           reset = true;
           if (slave_phase_at_reset >= 1.0) {
@@ -154,7 +154,7 @@ void Render(
           if (!high_ && slave_phase_at_reset >= pw) {
             transition_during_reset = true;
           }
-          double value = ComputeNaiveSample(
+          real_t value = ComputeNaiveSample(
               slave_phase_at_reset,
               pw,
               slope_up,
@@ -177,8 +177,8 @@ void Render(
           if (slave_phase_ < pw) {
             break;
           }
-          double t = (slave_phase_ - pw) / (previous_pw_ - pw + slave_frequency);
-          double triangle_step = (slope_up + slope_down) * slave_frequency;
+          real_t t = (slave_phase_ - pw) / (previous_pw_ - pw + slave_frequency);
+          real_t triangle_step = (slope_up + slope_down) * slave_frequency;
           triangle_step *= triangle_amount;
 
           this_sample += square_amount * stmlib::ThisBlepSample(t);
@@ -193,8 +193,8 @@ void Render(
             break;
           }
           slave_phase_ -= 1.0;
-          double t = slave_phase_ / slave_frequency;
-          double triangle_step = (slope_up + slope_down) * slave_frequency;
+          real_t t = slave_phase_ / slave_frequency;
+          real_t triangle_step = (slope_up + slope_down) * slave_frequency;
           triangle_step *= triangle_amount;
 
           this_sample -= (1.0 - triangle_amount) * stmlib::ThisBlepSample(t);
@@ -220,7 +220,7 @@ void Render(
       previous_pw_ = pw;
 
     if (output_phase) {
-        double phasor = master_phase_;
+        real_t phasor = master_phase_;
         if (enable_sync) {
         // A trick to prevent discontinuities when the phase wraps around.
         const float w = 4.0 * (1.0 - master_phase_) * master_phase_;
@@ -239,22 +239,22 @@ void Render(
     next_sample_ = next_sample;
   }
 
-  inline void set_master_phase(double master_phase) {
+  inline void set_master_phase(real_t master_phase) {
     master_phase_ = master_phase;
   }
 
 
  private:
-  inline double ComputeNaiveSample(
-      double phase,
-      double pw,
-      double slope_up,
-      double slope_down,
-      double triangle_amount,
-      double square_amount) const {
-    double saw = phase;
-    double square = phase < pw ? 0.0 : 1.0;
-    double triangle = phase < pw
+  inline real_t ComputeNaiveSample(
+      real_t phase,
+      real_t pw,
+      real_t slope_up,
+      real_t slope_down,
+      real_t triangle_amount,
+      real_t square_amount) const {
+    real_t saw = phase;
+    real_t square = phase < pw ? 0.0 : 1.0;
+    real_t triangle = phase < pw
         ? phase * slope_up
         : 1.0 - (phase - pw) * slope_down;
     saw += (square - saw) * square_amount;
@@ -263,18 +263,18 @@ void Render(
   }
 
   // Oscillator state.
-  double master_phase_;
-  double slave_phase_;
-  double next_sample_;
-  double previous_pw_;
+  real_t master_phase_;
+  real_t slave_phase_;
+  real_t next_sample_;
+  real_t previous_pw_;
   bool high_;
 
   // For interpolation of parameters.
-  double master_frequency_;
-  double slave_frequency_;
-  double pw_;
-  double waveshape_;
-  double phase_modulation_;
+  real_t master_frequency_;
+  real_t slave_frequency_;
+  real_t pw_;
+  real_t waveshape_;
+  real_t phase_modulation_;
 
   DISALLOW_COPY_AND_ASSIGN(VariableShapeOscillator);
 };
@@ -57,11 +57,11 @@ class VOSIMOscillator {
   }
 
   void Render(
-      double carrier_frequency,
-      double formant_frequency_1,
-      double formant_frequency_2,
-      double carrier_shape,
-      double* out,
+      real_t carrier_frequency,
+      real_t formant_frequency_1,
+      real_t formant_frequency_2,
+      real_t carrier_shape,
+      real_t* out,
       size_t size) {
     if (carrier_frequency >= kMaxFrequency) {
       carrier_frequency = kMaxFrequency;
@@ -91,14 +91,14 @@ class VOSIMOscillator {
         size);
 
     while (size--) {
-      const double f0 = f0_modulation.Next();
-      const double f1 = f1_modulation.Next();
-      const double f2 = f2_modulation.Next();
+      const real_t f0 = f0_modulation.Next();
+      const real_t f1 = f1_modulation.Next();
+      const real_t f2 = f2_modulation.Next();
 
       carrier_phase_ += carrier_frequency;
       if (carrier_phase_ >= 1.0) {
         carrier_phase_ -= 1.0;
-        double reset_time = carrier_phase_ / f0;
+        real_t reset_time = carrier_phase_ / f0;
         formant_1_phase_ = reset_time * f1;
         formant_2_phase_ = reset_time * f2;
       } else {
@@ -112,26 +112,26 @@ class VOSIMOscillator {
         }
       }
 
-      double carrier = Sine(carrier_phase_ * 0.5 + 0.25) + 1.0;
-      double reset_phase = 0.75 - 0.25 * carrier_shape_modulation.Next();
-      double reset_amplitude = Sine(reset_phase);
-      double formant_0 = Sine(formant_1_phase_ + reset_phase) - reset_amplitude;
-      double formant_1 = Sine(formant_2_phase_ + reset_phase) - reset_amplitude;
+      real_t carrier = Sine(carrier_phase_ * 0.5 + 0.25) + 1.0;
+      real_t reset_phase = 0.75 - 0.25 * carrier_shape_modulation.Next();
+      real_t reset_amplitude = Sine(reset_phase);
+      real_t formant_0 = Sine(formant_1_phase_ + reset_phase) - reset_amplitude;
+      real_t formant_1 = Sine(formant_2_phase_ + reset_phase) - reset_amplitude;
       *out++ = carrier * (formant_0 + formant_1) * 0.25 + reset_amplitude;
     }
   }
 
  private:
   // Oscillator state.
-  double carrier_phase_;
-  double formant_1_phase_;
-  double formant_2_phase_;
+  real_t carrier_phase_;
+  real_t formant_1_phase_;
+  real_t formant_2_phase_;
 
   // For interpolation of parameters.
-  double carrier_frequency_;
-  double formant_1_frequency_;
-  double formant_2_frequency_;
-  double carrier_shape_;
+  real_t carrier_frequency_;
+  real_t formant_1_frequency_;
+  real_t formant_2_frequency_;
+  real_t carrier_shape_;
 
   DISALLOW_COPY_AND_ASSIGN(VOSIMOscillator);
 };
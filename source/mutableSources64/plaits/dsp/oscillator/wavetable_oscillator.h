@@ -50,44 +50,44 @@ class Differentiator {
     lp_ = 0.0;
   }
 
-  double Process(double coefficient, double s) {
+  real_t Process(real_t coefficient, real_t s) {
     ONE_POLE(lp_, s - previous_, coefficient);
     previous_ = s;
     return lp_;
   }
  private:
-  double lp_;
-  double previous_;
+  real_t lp_;
+  real_t previous_;
 
   DISALLOW_COPY_AND_ASSIGN(Differentiator);
 };
 
 template<typename T>
-inline double InterpolateWave(
+inline real_t InterpolateWave(
     const T* table,
     int32_t index_integral,
-    double index_fractional) {
-  double a = static_cast<double>(table[index_integral]);
-  double b = static_cast<double>(table[index_integral + 1]);
-  double t = index_fractional;
+    real_t index_fractional) {
+  real_t a = static_cast<real_t>(table[index_integral]);
+  real_t b = static_cast<real_t>(table[index_integral + 1]);
+  real_t t = index_fractional;
   return a + (b - a) * t;
 }
 
 template<typename T>
-inline double InterpolateWaveHermite(
+inline real_t InterpolateWaveHermite(
     const T* table,
     int32_t index_integral,
-    double index_fractional) {
-  const double xm1 = static_cast<double>(table[index_integral]);
-  const double x0 = static_cast<double>(table[index_integral + 1]);
-  const double x1 = static_cast<double>(table[index_integral + 2]);
-  const double x2 = static_cast<double>(table[index_integral + 3]);
-  const double c = (x1 - xm1) * 0.5;
-  const double v = x0 - x1;
-  const double w = c + v;
-  const double a = w + v + (x2 - x0) * 0.5;
-  const double b_neg = w + a;
-  const double f = index_fractional;
+    real_t index_fractional) {
+  const real_t xm1 = static_cast<real_t>(table[index_integral]);
+  const real_t x0 = static_cast<real_t>(table[index_integral + 1]);
+  const real_t x1 = static_cast<real_t>(table[index_integral + 2]);
+  const real_t x2 = static_cast<real_t>(table[index_integral + 3]);
+  const real_t c = (x1 - xm1) * 0.5;
+  const real_t v = x0 - x1;
+  const real_t w = c + v;
+  const real_t a = w + v + (x2 - x0) * 0.5;
+  const real_t b_neg = w + a;
+  const real_t f = index_fractional;
   return (((a * f) - b_neg) * f + c) * f + x0;
 }
 
@@ -111,11 +111,11 @@ class WavetableOscillator {
   }
 
   void Render(
-      double frequency,
-      double amplitude,
-      double waveform,
+      real_t frequency,
+      real_t amplitude,
+      real_t waveform,
       const int16_t* const* wavetable,
-      double* out,
+      real_t* out,
       size_t size) {
     CONSTRAIN(frequency, 0.0000001, kMaxFrequency)
 
@@ -136,34 +136,34 @@ class WavetableOscillator {
         size);
     stmlib::ParameterInterpolator waveform_modulation(
         &waveform_,
-        waveform * double(num_waves - 1.0001),
+        waveform * real_t(num_waves - 1.0001),
         size);
 
-    double lp = lp_;
-    double phase = phase_;
+    real_t lp = lp_;
+    real_t phase = phase_;
     while (size--) {
-      const double f0 = frequency_modulation.Next();
-      const double cutoff = std::min(double(wavetable_size) * f0, 1.0);
+      const real_t f0 = frequency_modulation.Next();
+      const real_t cutoff = std::min(real_t(wavetable_size) * f0, real_t(1.0));
 
-      const double scale = approximate_scale ? 1.0 : 1.0 / (f0 * 131072.0);
+      const real_t scale = approximate_scale ? 1.0 : 1.0 / (f0 * 131072.0);
 
       phase += f0;
       if (phase >= 1.0) {
         phase -= 1.0;
       }
 
-      const double waveform = waveform_modulation.Next();
+      const real_t waveform = waveform_modulation.Next();
       MAKE_INTEGRAL_FRACTIONAL(waveform);
 
-      const double p = phase * double(wavetable_size);
+      const real_t p = phase * real_t(wavetable_size);
       MAKE_INTEGRAL_FRACTIONAL(p);
 
-      const double x0 = InterpolateWave(
+      const real_t x0 = InterpolateWave(
           wavetable[waveform_integral], p_integral, p_fractional);
-      const double x1 = InterpolateWave(
+      const real_t x1 = InterpolateWave(
           wavetable[waveform_integral + 1], p_integral, p_fractional);
 
-      const double s = differentiator_.Process(
+      const real_t s = differentiator_.Process(
           cutoff,
           (x0 + (x1 - x0) * waveform_fractional) * scale);
       ONE_POLE(lp, s, cutoff);
@@ -175,13 +175,13 @@ class WavetableOscillator {
 
  private:
   // Oscillator state.
-  double phase_;
+  real_t phase_;
 
   // For interpolation of parameters.
-  double frequency_;
-  double amplitude_;
-  double waveform_;
-  double lp_;
+  real_t frequency_;
+  real_t amplitude_;
+  real_t waveform_;
+  real_t lp_;
 
   Differentiator differentiator_;
 
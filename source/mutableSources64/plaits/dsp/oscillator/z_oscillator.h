@@ -58,11 +58,11 @@ class ZOscillator {
   }
 
   void Render(
-      double carrier_frequency,
-      double formant_frequency,
-      double carrier_shape,
-      double mode,
-      double* out,
+      real_t carrier_frequency,
+      real_t formant_frequency,
+      real_t carrier_shape,
+      real_t mode,
+      real_t* out,
       size_t size) {
     if (carrier_frequency >= kMaxFrequency * 0.5) {
       carrier_frequency = kMaxFrequency * 0.5;
@@ -88,17 +88,17 @@ class ZOscillator {
         mode,
         size);
 
-    double next_sample = next_sample_;
+    real_t next_sample = next_sample_;
 
     while (size--) {
       bool reset = false;
-      double reset_time = 0.0;
+      real_t reset_time = 0.0;
 
-      double this_sample = next_sample;
+      real_t this_sample = next_sample;
       next_sample = 0.0;
 
-      const double f0 = carrier_frequency_modulation.Next();
-      const double f1 = formant_frequency_modulation.Next();
+      const real_t f0 = carrier_frequency_modulation.Next();
+      const real_t f1 = formant_frequency_modulation.Next();
 
       discontinuity_phase_ += 2.0 * f0;
       carrier_phase_ += f0;
@@ -108,23 +108,23 @@ class ZOscillator {
         discontinuity_phase_ -= 1.0;
         reset_time = discontinuity_phase_ / (2.0 * f0);
 
-        double carrier_phase_before = carrier_phase_ >= 1.0 ? 1.0 : 0.5;
-        double carrier_phase_after = carrier_phase_ >= 1.0 ? 0.0 : 0.5;
-        double before = Z(
+        real_t carrier_phase_before = carrier_phase_ >= 1.0 ? 1.0 : 0.5;
+        real_t carrier_phase_after = carrier_phase_ >= 1.0 ? 0.0 : 0.5;
+        real_t before = Z(
             carrier_phase_before,
             1.0,
             formant_phase_ + (1.0 - reset_time) * f1,
             carrier_shape_modulation.subsample(1.0 - reset_time),
             mode_modulation.subsample(1.0 - reset_time));
 
-        double after = Z(
+        real_t after = Z(
             carrier_phase_after,
             0.0,
             0.0,
             carrier_shape_modulation.subsample(1.0),
             mode_modulation.subsample(1.0));
 
-        double discontinuity = after - before;
+        real_t discontinuity = after - before;
         this_sample += discontinuity * stmlib::ThisBlepSample(reset_time);
         next_sample += discontinuity * stmlib::NextBlepSample(reset_time);
         formant_phase_ = reset_time * f1;
@@ -157,11 +157,11 @@ class ZOscillator {
 
  private:
 
-  inline double Z(double c, double d, double f, double shape, double mode) {
-    double ramp_down = 0.5 * (1.0 + Sine(0.5 * d + 0.25));
+  inline real_t Z(real_t c, real_t d, real_t f, real_t shape, real_t mode) {
+    real_t ramp_down = 0.5 * (1.0 + Sine(0.5 * d + 0.25));
 
-    double offset;
-    double phase_shift;
+    real_t offset;
+    real_t phase_shift;
     if (mode < 0.333) {
       offset = 1.0;
       phase_shift = 0.25 + mode * 1.50;
@@ -173,8 +173,8 @@ class ZOscillator {
       offset = 0.001;
     }
 
-    double discontinuity = Sine(f + phase_shift);
-    double contour;
+    real_t discontinuity = Sine(f + phase_shift);
+    real_t contour;
     if (shape < 0.5) {
       shape *= 2.0;
       if (c >= 0.5) {
@@ -188,16 +188,16 @@ class ZOscillator {
   }
 
   // Oscillator state.
-  double carrier_phase_;
-  double discontinuity_phase_;
-  double formant_phase_;
-  double next_sample_;
+  real_t carrier_phase_;
+  real_t discontinuity_phase_;
+  real_t formant_phase_;
+  real_t next_sample_;
 
   // For interpolation of parameters.
-  double carrier_frequency_;
-  double formant_frequency_;
-  double carrier_shape_;
-  double mode_;
+  real_t carrier_frequency_;
+  real_t formant_frequency_;
+  real_t carrier_shape_;
+  real_t mode_;
 
   DISALLOW_COPY_AND_ASSIGN(ZOscillator);
 };
@@ -41,7 +41,7 @@ class DelayLine {
   DelayLine() { }
   ~DelayLine() { }
   
-  void Init(double* buffer) {
+  void Init(real_t* buffer) {
     line_ = buffer;
     Reset();
   }
@@ -63,19 +63,19 @@ class DelayLine {
     return -write * coefficient + read;
   }
 
-  inline const T WriteRead(const T sample, double delay) {
+  inline const T WriteRead(const T sample, real_t delay) {
     Write(sample);
     return Read(delay);
   }
   
-  inline const T Read(double delay) const {
+  inline const T Read(real_t delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
     const T a = line_[(write_ptr_ + delay_integral) % max_delay];
     const T b = line_[(write_ptr_ + delay_integral + 1) % max_delay];
     return a + (b - a) * T(delay_fractional);
   }
   
-  inline const T ReadHermite(double delay) const {
+  inline const T ReadHermite(real_t delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
     int32_t t = (write_ptr_ + delay_integral + max_delay);
     const T xm1 = line_[(t - 1) % max_delay];
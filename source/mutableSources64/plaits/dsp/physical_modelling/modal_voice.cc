@@ -54,42 +54,42 @@ void ModalVoice::Init() {
 void ModalVoice::Render(
     bool sustain,
     bool trigger,
-    double accent,
-    double f0,
-    double structure,
-    double brightness,
-    double damping,
-    double* temp,
-    double* out,
-    double* aux,
+    real_t accent,
+    real_t f0,
+    real_t structure,
+    real_t brightness,
+    real_t damping,
+    real_t* temp,
+    real_t* out,
+    real_t* aux,
     size_t size) {
-  const double density = brightness * brightness;
+  const real_t density = brightness * brightness;
   
   brightness += 0.25 * accent * (1.0 - brightness);
   damping += 0.25 * accent * (1.0 - damping);
   
-  const double range = sustain ? 36.0 : 60.0;
-  const double f = sustain ? 4.0 * f0 : 2.0 * f0;
-  const double cutoff = min(
+  const real_t range = sustain ? 36.0 : 60.0;
+  const real_t f = sustain ? 4.0 * f0 : 2.0 * f0;
+  const real_t cutoff = min(
       f * SemitonesToRatio((brightness * (2.0 - brightness) - 0.5) * range),
-      0.499);
-  const double q = sustain ? 0.7 : 1.5;
+      real_t(0.499));
+  const real_t q = sustain ? 0.7 : 1.5;
   
   // Synthesize excitation signal.
   if (sustain) {
-    const double dust_f = 0.00005 + 0.99995 * density * density;
+    const real_t dust_f = 0.00005 + 0.99995 * density * density;
     for (size_t i = 0; i < size; ++i) {
       temp[i] = Dust(dust_f) * (4.0 - dust_f * 3.0) * accent;
     }
   } else {
     fill(&temp[0], &temp[size], 0.0);
     if (trigger) {
-      const double attenuation = 1.0 - damping * 0.5;
-      const double amplitude = (0.12f + 0.08f * accent) * attenuation;
+      const real_t attenuation = 1.0 - damping * 0.5;
+      const real_t amplitude = (0.12f + 0.08f * accent) * attenuation;
       temp[0] = amplitude * SemitonesToRatio(cutoff * cutoff * 24.0) / cutoff;
     }
   }
-  const double one = 1.0;
+  const real_t one = 1.0;
   excitation_filter_.Process<FILTER_MODE_LOW_PASS, false>(
       &cutoff, &q, &one, temp, temp, size);
   for (size_t i = 0; i < size; ++i) {
@@ -44,7 +44,7 @@ namespace plaits {
 using namespace std;
 using namespace stmlib;
 
-void Resonator::Init(double position, int resolution) {
+void Resonator::Init(real_t position, int resolution) {
   resolution_ = min(resolution, kMaxNumModes);
   
   CosineOscillator amplitudes;
@@ -59,8 +59,8 @@ void Resonator::Init(double position, int resolution) {
   }
 }
 
-inline double NthHarmonicCompensation(int n, double stiffness) {
-  double stretch_factor = 1.0;
+inline real_t NthHarmonicCompensation(int n, real_t stiffness) {
+  real_t stretch_factor = 1.0;
   for (int i = 0; i < n - 1; ++i) {
     stretch_factor += stiffness;
     if (stiffness < 0.0) {
@@ -73,38 +73,38 @@ inline double NthHarmonicCompensation(int n, double stiffness) {
 }
 
 void Resonator::Process(
-    double f0,
-    double structure,
-    double brightness,
-    double damping,
-    const double* in,
-    double* out,
+    real_t f0,
+    real_t structure,
+    real_t brightness,
+    real_t damping,
+    const real_t* in,
+    real_t* out,
     size_t size) {
-  double stiffness = Interpolate(lut_stiffness, structure, 64.0);
+  real_t stiffness = Interpolate(lut_stiffness, structure, 64.0);
   f0 *= NthHarmonicCompensation(3, stiffness);
   
-  double harmonic = f0;
-  double stretch_factor = 1.0;
-  double q_sqrt = SemitonesToRatio(damping * 79.7);
-  double q = 500.0 * q_sqrt * q_sqrt;
+  real_t harmonic = f0;
+  real_t stretch_factor = 1.0;
+  real_t q_sqrt = SemitonesToRatio(damping * 79.7);
+  real_t q = 500.0 * q_sqrt * q_sqrt;
   brightness *= 1.0 - structure * 0.3;
   brightness *= 1.0 - damping * 0.3;
-  double q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
+  real_t q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
   
-  double mode_q[kModeBatchSize];
-  double mode_f[kModeBatchSize];
-  double mode_a[kModeBatchSize];
+  real_t mode_q[kModeBatchSize];
+  real_t mode_f[kModeBatchSize];
+  real_t mode_a[kModeBatchSize];
   int batch_counter = 0;
   
   ResonatorSvf<kModeBatchSize>* batch_processor = &mode_filters_[0];
   
   
   for (int i = 0; i < resolution_; ++i) {
-    double mode_frequency = harmonic * stretch_factor;
+    real_t mode_frequency = harmonic * stretch_factor;
     if (mode_frequency >= 0.499) {
       mode_frequency = 0.499;
     }
-    const double mode_attenuation = 1.0 - mode_frequency * 2.0;
+    const real_t mode_attenuation = 1.0 - mode_frequency * 2.0;
     
     mode_f[batch_counter] = mode_frequency;
     mode_q[batch_counter] = 1.0 + mode_frequency * q;
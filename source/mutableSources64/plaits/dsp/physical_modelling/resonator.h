@@ -52,19 +52,19 @@ class ResonatorSvf {
   
   template<stmlib::FilterMode mode, bool add>
   void Process(
-      const double* f,
-      const double* q,
-      const double* gain,
-      const double* in,
-      double* out,
+      const real_t* f,
+      const real_t* q,
+      const real_t* gain,
+      const real_t* in,
+      real_t* out,
       size_t size) {
-    double g[batch_size];
-    double r[batch_size];
-    double r_plus_g[batch_size];
-    double h[batch_size];
-    double state_1[batch_size];
-    double state_2[batch_size];
-    double gains[batch_size];
+    real_t g[batch_size];
+    real_t r[batch_size];
+    real_t r_plus_g[batch_size];
+    real_t h[batch_size];
+    real_t state_1[batch_size];
+    real_t state_2[batch_size];
+    real_t gains[batch_size];
     for (int i = 0; i < batch_size; ++i) {
       g[i] = stmlib::OnePole::tangens<stmlib::FREQUENCY_FAST>(f[i]);
       r[i] = 1.0 / q[i];
@@ -76,13 +76,13 @@ class ResonatorSvf {
     }
     
     while (size--) {
-      double s_in = *in++;
-      double s_out = 0.0;
+      real_t s_in = *in++;
+      real_t s_out = 0.0;
       for (int i = 0; i < batch_size; ++i) {
-        const double hp = (s_in - r_plus_g[i] * state_1[i] - state_2[i]) * h[i];
-        const double bp = g[i] * hp + state_1[i];
+        const real_t hp = (s_in - r_plus_g[i] * state_1[i] - state_2[i]) * h[i];
+        const real_t bp = g[i] * hp + state_1[i];
         state_1[i] = g[i] * hp + bp;
-        const double lp = g[i] * bp + state_2[i];
+        const real_t lp = g[i] * bp + state_2[i];
         state_2[i] = g[i] * bp + lp;
         s_out += gains[i] * ((mode == stmlib::FILTER_MODE_LOW_PASS) ? lp : bp);
       }
@@ -99,8 +99,8 @@ class ResonatorSvf {
   }
   
  private:
-  double state_1_[batch_size];
-  double state_2_[batch_size];
+  real_t state_1_[batch_size];
+  real_t state_2_[batch_size];
   
   DISALLOW_COPY_AND_ASSIGN(ResonatorSvf);
 };
@@ -110,20 +110,20 @@ class Resonator {
   Resonator() { }
   ~Resonator() { }
   
-  void Init(double position, int resolution);
+  void Init(real_t position, int resolution);
   void Process(
-      double f0,
-      double structure,
-      double brightness,
-      double damping,
-      const double* in,
-      double* out,
+      real_t f0,
+      real_t structure,
+      real_t brightness,
+      real_t damping,
+      const real_t* in,
+      real_t* out,
       size_t size);
   
  private:
   int resolution_;
   
-  double mode_amplitude_[kMaxNumModes];
+  real_t mode_amplitude_[kMaxNumModes];
   ResonatorSvf<kModeBatchSize> mode_filters_[kMaxNumModes / kModeBatchSize];
   
   DISALLOW_COPY_AND_ASSIGN(Resonator);
@@ -45,9 +45,10 @@ namespace plaits {
 using namespace std;
 using namespace stmlib;
 
-void String::Init(BufferAllocator* allocator) {
-  string_.Init(allocator->Allocate<double>(kDelayLineSize));
-  stretch_.Init(allocator->Allocate<double>(kDelayLineSize / 4));
+void String::Init(BufferAllocator* allocator, const Dsp& dsp) {
+  sr_ = dsp.getSr();
+  string_.Init(allocator->Allocate<real_t>(kDelayLineSize));
+  stretch_.Init(allocator->Allocate<real_t>(kDelayLineSize / 4));
   delay_ = 100.0;
   Reset();
 }
@@ -56,7 +57,7 @@ void String::Reset() {
   string_.Reset();
   stretch_.Reset();
   iir_damping_filter_.Init();
-    dc_blocker_.Init(1.0 - 20.0 / kSampleRate);
+    dc_blocker_.Init(1.0 - 20.0 / sr_);
   dispersion_noise_ = 0.0;
   curved_bridge_ = 0.0;
   out_sample_[0] = out_sample_[1] = 0.0;
@@ -64,12 +65,12 @@ void String::Reset() {
 }
 
 void String::Process(
-    double f0,
-    double non_linearity_amount,
-    double brightness,
-    double damping,
-    const double* in,
-    double* out,
+    real_t f0,
+    real_t non_linearity_amount,
+    real_t brightness,
+    real_t damping,
+    const real_t* in,
+    real_t* out,
     size_t size) {
   if (non_linearity_amount <= 0.0) {
     ProcessInternal<STRING_NON_LINEARITY_CURVED_BRIDGE>(
@@ -82,20 +83,20 @@ void String::Process(
 
 template<StringNonLinearity non_linearity>
 void String::ProcessInternal(
-    double f0,
-    double non_linearity_amount,
-    double brightness,
-    double damping,
-    const double* in,
-    double* out,
+    real_t f0,
+    real_t non_linearity_amount,
+    real_t brightness,
+    real_t damping,
+    const real_t* in,
+    real_t* out,
     size_t size) {
-  double delay = 1.0 / f0;
+  real_t delay = 1.0 / f0;
   CONSTRAIN(delay, 4.0, kDelayLineSize - 4.0);
   
   // If there is not enough delay time in the delay line, we play at the
   // lowest possible note and we upsample on the fly with a shitty linear
   // interpolator. We don't care because it's a corner case (f0 < 11.7Hz)
-  double src_ratio = delay * f0;
+  real_t src_ratio = delay * f0;
   if (src_ratio >= 0.9999) {
     // When we are above 11.7 Hz, we make sure that the linear interpolator
     // does not get in the way.
@@ -103,14 +104,14 @@ void String::ProcessInternal(
     src_ratio = 1.0;
   }
 
-  double damping_cutoff = min(
+  real_t damping_cutoff = min(
       12.0 + damping * damping * 60.0 + brightness * 24.0,
       84.0);
-  double damping_f = min(f0 * SemitonesToRatio(damping_cutoff), 0.499);
+  real_t damping_f = min(f0 * SemitonesToRatio(damping_cutoff), real_t(0.499));
   
   // Crossfade to infinite decay.
   if (damping >= 0.95) {
-    double to_infinite = 20.0 * (damping - 0.95);
+    real_t to_infinite = 20.0 * (damping - 0.95);
     brightness += to_infinite * (1.0 - brightness);
     damping_f += to_infinite * (0.4999 - damping_f);
     damping_cutoff += to_infinite * (128.0 - damping_cutoff);
@@ -118,37 +119,37 @@ void String::ProcessInternal(
   
   iir_damping_filter_.set_f_q<FREQUENCY_FAST>(damping_f, 0.5);
   
-  double damping_compensation = Interpolate(lut_svf_shift, damping_cutoff, 1.0);
+  real_t damping_compensation = Interpolate(lut_svf_shift, damping_cutoff, 1.0);
   
   // Linearly interpolate delay time.
   ParameterInterpolator delay_modulation(
       &delay_, delay * damping_compensation, size);
   
-  double stretch_point = non_linearity_amount * (2.0 - non_linearity_amount) * 0.225;
-    double stretch_correction = (160.0 / kSampleRate) * delay;
+  real_t stretch_point = non_linearity_amount * (2.0 - non_linearity_amount) * 0.225;
+    real_t stretch_correction = (160.0 / sr_) * delay;
   CONSTRAIN(stretch_correction, 1.0, 2.1);
   
-  double noise_amount_sqrt = non_linearity_amount > 0.75
+  real_t noise_amount_sqrt = non_linearity_amount > 0.75
       ? 4.0 * (non_linearity_amount - 0.75)
       : 0.0;
-  double noise_amount = noise_amount_sqrt * noise_amount_sqrt * 0.1;
-  double noise_filter = 0.06 + 0.94 * brightness * brightness;
+  real_t noise_amount = noise_amount_sqrt * noise_amount_sqrt * 0.1;
+  real_t noise_filter = 0.06 + 0.94 * brightness * brightness;
   
-  double bridge_curving_sqrt = non_linearity_amount;
-  double bridge_curving = bridge_curving_sqrt * bridge_curving_sqrt * 0.01;
+  real_t bridge_curving_sqrt = non_linearity_amount;
+  real_t bridge_curving = bridge_curving_sqrt * bridge_curving_sqrt * 0.01;
   
-  double ap_gain = -0.618 * non_linearity_amount / (0.15 + fabs(non_linearity_amount));
+  real_t ap_gain = -0.618 * non_linearity_amount / (0.15 + fabs(non_linearity_amount));
   
   while (size--) {
     src_phase_ += src_ratio;
     if (src_phase_ > 1.0) {
       src_phase_ -= 1.0;
       
-      double delay = delay_modulation.Next();
-      double s = 0.0;
+      real_t delay = delay_modulation.Next();
+      real_t s = 0.0;
       
       if (non_linearity == STRING_NON_LINEARITY_DISPERSION) {
-        double noise = Random::GetFloat() - 0.5;
+        real_t noise = Random::GetFloat() - 0.5;
         ONE_POLE(dispersion_noise_, noise, noise_filter)
         delay *= 1.0 + dispersion_noise_ * noise_amount;
       } else {
@@ -156,8 +157,8 @@ void String::ProcessInternal(
       }
       
       if (non_linearity == STRING_NON_LINEARITY_DISPERSION) {
-        double ap_delay = delay * stretch_point;
-        double main_delay = delay - ap_delay * (0.408 - stretch_point * 0.308) * stretch_correction;
+        real_t ap_delay = delay * stretch_point;
+        real_t main_delay = delay - ap_delay * (0.408 - stretch_point * 0.308) * stretch_correction;
         if (ap_delay >= 4.0 && main_delay >= 4.0) {
           s = string_.Read(main_delay);
           s = stretch_.Allpass(s, ap_delay, ap_gain);
@@ -169,8 +170,8 @@ void String::ProcessInternal(
       }
       
       if (non_linearity == STRING_NON_LINEARITY_CURVED_BRIDGE) {
-        double value = fabs(s) - 0.025;
-        double sign = s > 0.0 ? 1.0 : -1.5;
+        real_t value = fabs(s) - 0.025;
+        real_t sign = s > 0.0 ? 1.0 : -1.5;
         curved_bridge_ = (fabs(value) + value) * sign;
       }
     
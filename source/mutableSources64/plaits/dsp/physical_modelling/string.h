@@ -36,6 +36,7 @@
 #include "stmlib/dsp/filter.h"
 #include "stmlib/utils/buffer_allocator.h"
 
+#include "plaits/dsp/dsp.h"
 #include "plaits/dsp/physical_modelling/delay_line.h"
 
 
@@ -53,42 +54,44 @@ class String {
   String() { }
   ~String() { }
   
-  void Init(stmlib::BufferAllocator* allocator);
+  void Init(stmlib::BufferAllocator* allocator, const Dsp& dsp);
   void Reset();
   void Process(
-      double f0,
-      double non_linearity_amount,
-      double brightness,
-      double damping,
-      const double* in,
-      double* out,
+      real_t f0,
+      real_t non_linearity_amount,
+      real_t brightness,
+      real_t damping,
+      const real_t* in,
+      real_t* out,
       size_t size);
 
  private:
   template<StringNonLinearity non_linearity>
   void ProcessInternal(
-      double f0,
-      double non_linearity_amount,
-      double brightness,
-      double damping,
-      const double* in,
-      double* out,
+      real_t f0,
+      real_t non_linearity_amount,
+      real_t brightness,
+      real_t damping,
+      const real_t* in,
+      real_t* out,
       size_t size);
   
-  DelayLine<double, kDelayLineSize> string_;
-  DelayLine<double, kDelayLineSize / 4> stretch_;
+  DelayLine<real_t, kDelayLineSize> string_;
+  DelayLine<real_t, kDelayLineSize / 4> stretch_;
   
   stmlib::Svf iir_damping_filter_;
   stmlib::DCBlocker dc_blocker_;
   
-  double delay_;
-  double dispersion_noise_;
-  double curved_bridge_;
+  real_t delay_;
+  real_t dispersion_noise_;
+  real_t curved_bridge_;
   
   // Very crappy linear interpolation upsampler used for low pitches that
   // do not fit the delay line. Rarely used.
-  double src_phase_;
-  double out_sample_[2];
+  real_t src_phase_;
+  real_t out_sample_[2];
+
+  real_t sr_;
 
   DISALLOW_COPY_AND_ASSIGN(String);
 };
@@ -43,9 +43,9 @@ namespace plaits {
 using namespace std;
 using namespace stmlib;
 
-void StringVoice::Init(BufferAllocator* allocator) {
+void StringVoice::Init(BufferAllocator* allocator, const Dsp& dsp) {
   excitation_filter_.Init();
-  string_.Init(allocator);
+  string_.Init(allocator, dsp);
   remaining_noise_samples_ = 0;
 }
 
@@ -56,34 +56,34 @@ void StringVoice::Reset() {
 void StringVoice::Render(
     bool sustain,
     bool trigger,
-    double accent,
-    double f0,
-    double structure,
-    double brightness,
-    double damping,
-    double* temp,
-    double* out,
-    double* aux,
+    real_t accent,
+    real_t f0,
+    real_t structure,
+    real_t brightness,
+    real_t damping,
+    real_t* temp,
+    real_t* out,
+    real_t* aux,
     size_t size) {
-  const double density = brightness * brightness;
+  const real_t density = brightness * brightness;
 
   brightness += 0.25 * accent * (1.0 - brightness);
   damping += 0.25 * accent * (1.0 - damping);
   
   // Synthesize excitation signal.
   if (trigger || sustain) {
-    const double range = 72.0;
-    const double f = 4.0 * f0;
-    const double cutoff = min(
+    const real_t range = 72.0;
+    const real_t f = 4.0 * f0;
+    const real_t cutoff = min(
         f * SemitonesToRatio((brightness * (2.0 - brightness) - 0.5) * range),
-        0.499);
-    const double q = sustain ? 1.0 : 0.5;
+        real_t(0.499));
+    const real_t q = sustain ? 1.0 : 0.5;
     remaining_noise_samples_ = static_cast<size_t>(1.0 / f0);
     excitation_filter_.set_f_q<FREQUENCY_DIRTY>(cutoff, q);
   }
 
   if (sustain) {
-    const double dust_f = 0.00005 + 0.99995 * density * density;
+    const real_t dust_f = 0.00005 + 0.99995 * density * density;
     for (size_t i = 0; i < size; ++i) {
       temp[i] = Dust(dust_f) * (8.0 - dust_f * 6.0) * accent;
     }
@@ -91,7 +91,7 @@ void StringVoice::Render(
     size_t noise_samples = min(remaining_noise_samples_, size);
     remaining_noise_samples_ -= noise_samples;
     size_t tail = size - noise_samples;
-    double* start = temp;
+    real_t* start = temp;
     while (noise_samples--) {
       *start++ = 2.0 * Random::GetFloat() - 1.0;
     }
@@ -107,7 +107,7 @@ void StringVoice::Render(
     aux[i] += temp[i];
   }
   
-  double non_linearity = structure < 0.24
+  real_t non_linearity = structure < 0.24
       ? (structure - 0.24) * 4.166
       : (structure > 0.26 ? (structure - 0.26) * 1.35135 : 0.0);
   string_.Process(f0, non_linearity, brightness, damping, temp, out, size);
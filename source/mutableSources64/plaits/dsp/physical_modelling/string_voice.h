@@ -43,19 +43,19 @@ class StringVoice {
   StringVoice() { }
   ~StringVoice() { }
   
-  void Init(stmlib::BufferAllocator* allocator);
+  void Init(stmlib::BufferAllocator* allocator, const Dsp& dsp);
   void Reset();
   void Render(
       bool sustain,
       bool trigger,
-      double accent,
-      double f0,
-      double structure,
-      double brightness,
-      double damping,
-      double* temp,
-      double* out,
-      double* aux,
+      real_t accent,
+      real_t f0,
+      real_t structure,
+      real_t brightness,
+      real_t damping,
+      real_t* temp,
+      real_t* out,
+      real_t* aux,
       size_t size);
   
  private:
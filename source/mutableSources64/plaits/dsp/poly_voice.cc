@@ -0,0 +1,144 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+//
+// Polyphonic plaits.
+
+#include "plaits/dsp/poly_voice.h"
+
+#include <algorithm>
+
+namespace plaits {
+
+using namespace std;
+using namespace stmlib;
+
+bool PolyVoice::Init(
+    Voice* voices,
+    int num_voices,
+    char* ram,
+    size_t ram_size,
+    const Dsp& dsp) {
+  if (ram_size < kMinEnginePoolSize) {
+    return false;
+  }
+  CONSTRAIN(num_voices, 1, kMaxPolyphony);
+  voice_ = voices;
+  num_voices_ = num_voices;
+  ram_ = ram;
+  ram_size_ = ram_size;
+
+  for (int i = 0; i < num_voices_; ++i) {
+    BufferAllocator allocator(ram_, ram_size_);
+    voice_[i].Init(&allocator, dsp);
+    gain_[i] = 0.0;
+    gate_[i] = false;
+    retrigger_[i] = false;
+    used_[i] = false;
+  }
+
+  allocator_.Init(num_voices_);
+  engine_quantizer_.Init(kMaxEngines, 0.05, true);
+  SelectEngine(0);
+  return true;
+}
+
+void PolyVoice::SelectEngine(int engine) {
+  size_t size = Voice::engine_footprint(engine);
+  int num_playing = size ? static_cast<int>(ram_size_ / size) : num_voices_;
+  CONSTRAIN(num_playing, 1, num_voices_);
+
+  for (int i = 0; i < num_playing; ++i) {
+    voice_[i].BindEngine(engine, ram_ + i * size, size);
+  }
+  for (int i = num_playing; i < num_voices_; ++i) {
+    gate_[i] = false;
+    used_[i] = false;
+  }
+  allocator_.set_num_voices(num_playing);
+  engine_ = engine;
+}
+
+void PolyVoice::NoteOn(real_t note, real_t velocity) {
+  int voice = allocator_.NoteOn(note);
+  // a stolen voice has to see its trigger go low first
+  retrigger_[voice] = gate_[voice];
+  gate_[voice] = true;
+  used_[voice] = true;
+  gain_[voice] = velocity;
+}
+
+void PolyVoice::NoteOff(real_t note) {
+  int voice = allocator_.NoteOff(note);
+  if (voice >= 0) {
+    gate_[voice] = false;
+  }
+}
+
+void PolyVoice::AllNotesOff() {
+  allocator_.Clear();
+  for (int i = 0; i < num_voices_; ++i) {
+    gate_[i] = false;
+  }
+}
+
+void PolyVoice::Render(
+    const Patch& patch,
+    const Modulations& modulations,
+    real_t* out,
+    real_t* aux,
+    size_t size) {
+  int engine = engine_quantizer_.Process(patch.engine, modulations.engine);
+  if (engine != engine_) {
+    SelectEngine(engine);
+  }
+
+  Patch p = patch;
+  Modulations m = modulations;
+  p.engine = engine_;
+  m.engine = 0.0;
+  m.trigger_patched = true;
+
+  fill(&out[0], &out[size], 0.0);
+  fill(&aux[0], &aux[size], 0.0);
+
+  for (int i = 0; i < allocator_.num_voices(); ++i) {
+    if (!used_[i]) {
+      continue;
+    }
+    p.note = patch.note + allocator_.note(i) - kPolyReferenceNote;
+    m.trigger = gate_[i] && !retrigger_[i] ? 1.0 : 0.0;
+    retrigger_[i] = false;
+    voice_[i].Render(p, m, voice_out_, voice_aux_, size);
+
+    const real_t gain = gain_[i];
+    for (size_t j = 0; j < size; ++j) {
+      out[j] += voice_out_[j] * gain;
+      aux[j] += voice_aux_[j] * gain;
+    }
+  }
+}
+
+}  // namespace plaits
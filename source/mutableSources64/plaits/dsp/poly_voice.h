@@ -0,0 +1,117 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+//
+// Polyphonic plaits. All voices play the same engine, each one gets a slice of
+// a shared pool that holds its engine object and RAM, sized for the engine
+// that is currently selected. When an engine needs more than
+// pool_size / num_voices, fewer voices play.
+
+#ifndef PLAITS_DSP_POLY_VOICE_H_
+#define PLAITS_DSP_POLY_VOICE_H_
+
+#include "stmlib/stmlib.h"
+
+#include "stmlib/dsp/hysteresis_quantizer.h"
+
+#include "plaits/dsp/voice.h"
+#include "plaits/dsp/voice_allocator.h"
+
+namespace plaits {
+
+const int kMaxPolyphony = 16;
+
+// Voice::engine_footprint() of the hungriest engine (the inharmonic string)
+// is a bit less, a pool must hold at least that much.
+const size_t kMinEnginePoolSize = 32768;
+
+// Notes are transposed by the note of the patch, like the V/OCT input adds
+// to the frequency knob. At this note, the one plts~ starts with, they
+// sound as they are.
+const real_t kPolyReferenceNote = 48.0;
+
+class PolyVoice {
+ public:
+  PolyVoice() { }
+  ~PolyVoice() { }
+
+  // voices and ram are owned by the caller.
+  bool Init(
+      Voice* voices,
+      int num_voices,
+      char* ram,
+      size_t ram_size,
+      const Dsp& dsp);
+
+  void NoteOn(real_t note, real_t velocity);
+  void NoteOff(real_t note);
+  void AllNotesOff();
+
+  void Render(
+      const Patch& patch,
+      const Modulations& modulations,
+      real_t* out,
+      real_t* aux,
+      size_t size);
+
+  inline int active_engine() const { return engine_; }
+  inline int num_voices() const { return num_voices_; }
+  // voices that fit into the pool with the active engine
+  inline int num_playing_voices() const { return allocator_.num_voices(); }
+  // bytes held by the voices and their engines
+  inline size_t footprint() const {
+    size_t size = sizeof(PolyVoice);
+    for (int i = 0; i < num_voices_; ++i) {
+      size += voice_[i].footprint();
+    }
+    return size;
+  }
+
+ private:
+  void SelectEngine(int engine);
+
+  Voice* voice_;
+  int num_voices_;
+  char* ram_;
+  size_t ram_size_;
+
+  VoiceAllocator<kMaxPolyphony> allocator_;
+  stmlib::HysteresisQuantizer2 engine_quantizer_;
+  int engine_;
+
+  real_t gain_[kMaxPolyphony];
+  bool gate_[kMaxPolyphony];
+  bool retrigger_[kMaxPolyphony];
+  bool used_[kMaxPolyphony];
+
+  real_t voice_out_[kMaxBlockSize];
+  real_t voice_aux_[kMaxBlockSize];
+
+  DISALLOW_COPY_AND_ASSIGN(PolyVoice);
+};
+
+}  // namespace plaits
+
+#endif  // PLAITS_DSP_POLY_VOICE_H_
@@ -55,33 +55,33 @@ void LPCSpeechSynth::Init() {
 }
 
 void LPCSpeechSynth::Render(
-    double prosody_amount,
-    double pitch_shift,
-    double* excitation,
-    double* output,
+    real_t prosody_amount,
+    real_t pitch_shift,
+    real_t* excitation,
+    real_t* output,
     size_t size) {
-  const double base_f0 = kLPCSpeechSynthDefaultF0 / 8000.0;
-  double d = frequency_ - base_f0;
-  double f = (base_f0 + d * prosody_amount) * pitch_shift;
+  const real_t base_f0 = kLPCSpeechSynthDefaultF0 / 8000.0;
+  real_t d = frequency_ - base_f0;
+  real_t f = (base_f0 + d * prosody_amount) * pitch_shift;
   CONSTRAIN(f, 0.0, 0.5);
   
-  double next_sample = next_sample_;
+  real_t next_sample = next_sample_;
   while (size--) {
     phase_ += f;
     
-    double this_sample = next_sample;
+    real_t this_sample = next_sample;
     next_sample = 0.0;
     
     if (phase_ >= 1.0) {
       phase_ -= 1.0;
-      double reset_time = phase_ / f;
+      real_t reset_time = phase_ / f;
       int reset_sample = static_cast<int>(32.0 * reset_time);
       
-      double discontinuity = 0.0;
+      real_t discontinuity = 0.0;
       if (excitation_pulse_sample_index_ < LUT_LPC_EXCITATION_PULSE_SIZE) {
         excitation_pulse_sample_index_ -= reset_sample;
         int8_t s = lut_lpc_excitation_pulse[excitation_pulse_sample_index_];
-        discontinuity = static_cast<double>(s) / 128.0 * pulse_energy_;
+        discontinuity = static_cast<real_t>(s) / 128.0 * pulse_energy_;
       }
       
       this_sample += -discontinuity * ThisBlepSample(reset_time);
@@ -90,11 +90,11 @@ void LPCSpeechSynth::Render(
       excitation_pulse_sample_index_ = reset_sample;
     }
     
-    double e[11];
+    real_t e[11];
     e[10] = Random::GetSample() > 0 ? noise_energy_ : -noise_energy_;
     if (excitation_pulse_sample_index_ < LUT_LPC_EXCITATION_PULSE_SIZE) {
       int8_t s = lut_lpc_excitation_pulse[excitation_pulse_sample_index_];
-      next_sample += static_cast<double>(s) / 128.0 * pulse_energy_;
+      next_sample += static_cast<real_t>(s) / 128.0 * pulse_energy_;
       excitation_pulse_sample_index_ += 32;
     }
     e[10] += this_sample;
@@ -130,23 +130,23 @@ void LPCSpeechSynth::Render(
   next_sample_ = next_sample;
 }
 
-void LPCSpeechSynth::PlayFrame(const Frame& f1, const Frame& f2, double blend) {
-  double frequency_1 = f1.period == 0
+void LPCSpeechSynth::PlayFrame(const Frame& f1, const Frame& f2, real_t blend) {
+  real_t frequency_1 = f1.period == 0
       ? frequency_
-      : 1.0 / static_cast<double>(f1.period);
-  double frequency_2 = f2.period == 0
+      : 1.0 / static_cast<real_t>(f1.period);
+  real_t frequency_2 = f2.period == 0
       ? frequency_
-      : 1.0 / static_cast<double>(f2.period);
+      : 1.0 / static_cast<real_t>(f2.period);
   frequency_ = frequency_1 + (frequency_2 - frequency_1) * blend;
   
-  double energy_1 = static_cast<double>(f1.energy) / 256.0;
-  double energy_2 = static_cast<double>(f2.energy) / 256.0;
-  double noise_energy_1 = f1.period == 0 ? energy_1 : 0.0;
-  double noise_energy_2 = f2.period == 0 ? energy_2 : 0.0;
+  real_t energy_1 = static_cast<real_t>(f1.energy) / 256.0;
+  real_t energy_2 = static_cast<real_t>(f2.energy) / 256.0;
+  real_t noise_energy_1 = f1.period == 0 ? energy_1 : 0.0;
+  real_t noise_energy_2 = f2.period == 0 ? energy_2 : 0.0;
   noise_energy_ = noise_energy_1 + (noise_energy_2 - noise_energy_1) * blend;
 
-  double pulse_energy_1 = f1.period != 0 ? energy_1 : 0;
-  double pulse_energy_2 = f2.period != 0 ? energy_2 : 0;
+  real_t pulse_energy_1 = f1.period != 0 ? energy_1 : 0;
+  real_t pulse_energy_2 = f2.period != 0 ? energy_2 : 0;
   pulse_energy_ = pulse_energy_1 + (pulse_energy_2 - pulse_energy_1) * blend;
   
   k_[0] = BlendCoefficient<32768>(f1.k0, f2.k0, blend);
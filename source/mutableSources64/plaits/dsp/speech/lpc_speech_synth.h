@@ -38,7 +38,7 @@ namespace plaits {
 
 const int kLPCOrder = 10;
 
-const double kLPCSpeechSynthDefaultF0 = 100.0;
+const real_t kLPCSpeechSynthDefaultF0 = 100.0;
 
 class LPCSpeechSynth {
  public:
@@ -64,13 +64,13 @@ class LPCSpeechSynth {
   void Init();
   
   void Render(
-      double prosody_amount,
-      double pitch_shift,
-      double* excitation,
-      double* output,
+      real_t prosody_amount,
+      real_t pitch_shift,
+      real_t* excitation,
+      real_t* output,
       size_t size);
   
-  void PlayFrame(const Frame* frames, double frame, bool interpolate) {
+  void PlayFrame(const Frame* frames, real_t frame, bool interpolate) {
     MAKE_INTEGRAL_FRACTIONAL(frame);
     
     if (!interpolate) {
@@ -83,25 +83,25 @@ class LPCSpeechSynth {
   }
 
  private:
-  void PlayFrame(const Frame& f1, const Frame& f2, double blend);
+  void PlayFrame(const Frame& f1, const Frame& f2, real_t blend);
   
   template <int scale, typename X>
-  double BlendCoefficient(X a, X b, double blend) {
-    double a_f = static_cast<double>(a) / double(scale);
-    double b_f = static_cast<double>(b) / double(scale);
+  real_t BlendCoefficient(X a, X b, real_t blend) {
+    real_t a_f = static_cast<real_t>(a) / real_t(scale);
+    real_t b_f = static_cast<real_t>(b) / real_t(scale);
     return a_f + (b_f - a_f) * blend;
   }
   
-  double phase_;
-  double frequency_;
-  double noise_energy_;
-  double pulse_energy_;
+  real_t phase_;
+  real_t frequency_;
+  real_t noise_energy_;
+  real_t pulse_energy_;
   
-  double next_sample_;
+  real_t next_sample_;
   int excitation_pulse_sample_index_;
 
-  double k_[kLPCOrder];
-  double s_[kLPCOrder + 1];
+  real_t k_[kLPCOrder];
+  real_t s_[kLPCOrder + 1];
 
   DISALLOW_COPY_AND_ASSIGN(LPCSpeechSynth);
 };
@@ -205,7 +205,8 @@ bool LPCSpeechSynthWordBank::Load(int bank) {
   return true;
 }
 
-void LPCSpeechSynthController::Init(LPCSpeechSynthWordBank* word_bank) {
+void LPCSpeechSynthController::Init(LPCSpeechSynthWordBank* word_bank, const Dsp& dsp) {
+  sr_ = dsp.getSr();
   word_bank_ = word_bank;
 
   clock_phase_ = 0.0f;
@@ -225,22 +226,22 @@ void LPCSpeechSynthController::Render(
     bool free_running,
     bool trigger,
     int bank,
-    double frequency,
-    double prosody_amount,
-    double speed,
-    double address,
-    double formant_shift,
-    double gain,
-    double* excitation,
-    double* output,
+    real_t frequency,
+    real_t prosody_amount,
+    real_t speed,
+    real_t address,
+    real_t formant_shift,
+    real_t gain,
+    real_t* excitation,
+    real_t* output,
     size_t size) {
-  const double rate_ratio = SemitonesToRatio((formant_shift - 0.5) * 36.0);
-  const double rate = rate_ratio / 6.0;
+  const real_t rate_ratio = SemitonesToRatio((formant_shift - 0.5) * 36.0);
+  const real_t rate = rate_ratio / 6.0;
 
   // All utterances have been normalized for an average f0 of 100 Hz.
-  const double pitch_shift = frequency / \
-    (rate_ratio * kLPCSpeechSynthDefaultF0 / kSampleRate);
-  const double time_stretch = SemitonesToRatio(-speed * 24.0 +
+  const real_t pitch_shift = frequency / \
+    (rate_ratio * kLPCSpeechSynthDefaultF0 / sr_);
+  const real_t time_stretch = SemitonesToRatio(-speed * 24.0 +
         (formant_shift < 0.4 ? (formant_shift - 0.4) * -45.0
             : (formant_shift > 0.6 ? (formant_shift - 0.6) * -45.0 : 0.0)));
 
@@ -280,12 +281,12 @@ void LPCSpeechSynthController::Render(
   if (playback_frame_ == -1 && remaining_frame_samples_ == 0) {
     synth_.PlayFrame(
         frames,
-        address * (static_cast<double>(num_frames) - 1.0001),
+        address * (static_cast<real_t>(num_frames) - 1.0001),
         true);
   } else {
     if (remaining_frame_samples_ == 0) {
-      synth_.PlayFrame(frames, double(playback_frame_), false);
-      remaining_frame_samples_ = kSampleRate / kLPCSpeechSynthFPS * time_stretch;
+      synth_.PlayFrame(frames, real_t(playback_frame_), false);
+      remaining_frame_samples_ = sr_ / kLPCSpeechSynthFPS * time_stretch;
       ++playback_frame_;
       if (playback_frame_ >= last_playback_frame_) {
         bool back_to_scan_mode = bank == -1 || free_running;
@@ -298,15 +299,15 @@ void LPCSpeechSynthController::Render(
   ParameterInterpolator gain_modulation(&gain_, gain, size);
 
   while (size--) {
-    double this_sample[2];
+    real_t this_sample[2];
     copy(&next_sample_[0], &next_sample_[2], &this_sample[0]);
     fill(&next_sample_[0], &next_sample_[2], 0.0f);
 
     clock_phase_ += rate;
     if (clock_phase_ >= 1.0) {
       clock_phase_ -= 1.0;
-      double reset_time = clock_phase_ / rate;
-      double new_sample[2];
+      real_t reset_time = clock_phase_ / rate;
+      real_t new_sample[2];
 
       synth_.Render(
           prosody_amount,
@@ -314,7 +315,7 @@ void LPCSpeechSynthController::Render(
           &new_sample[0],
           &new_sample[1], 1);
 
-      double discontinuity[2] = {
+      real_t discontinuity[2] = {
         new_sample[0] - sample_[0],
         new_sample[1] - sample_[1]
       };
@@ -326,7 +327,7 @@ void LPCSpeechSynthController::Render(
     }
     next_sample_[0] += sample_[0];
     next_sample_[1] += sample_[1];
-    const double gain = gain_modulation.Next();
+    const real_t gain = gain_modulation.Next();
     *excitation++ = this_sample[0] * gain;
     *output++ = this_sample[1] * gain;
   }
@@ -29,6 +29,7 @@
 #ifndef PLAITS_DSP_SPEECH_LPC_SPEECH_SYNTH_CONTROLLER_H_
 #define PLAITS_DSP_SPEECH_LPC_SPEECH_SYNTH_CONTROLLER_H_
 
+#include "plaits/dsp/dsp.h"
 #include "plaits/dsp/speech/lpc_speech_synth.h"
 
 #include "stmlib/utils/buffer_allocator.h"
@@ -91,7 +92,7 @@ const int kLPCSpeechSynthNumVowels = 5;
 const int kLPCSpeechSynthNumConsonants = 10;
 const int kLPCSpeechSynthNumPhonemes = \
     kLPCSpeechSynthNumVowels + kLPCSpeechSynthNumConsonants;
-const double kLPCSpeechSynthFPS = 40.0f;
+const real_t kLPCSpeechSynthFPS = 40.0f;
 
 struct LPCSpeechSynthWordBankData {
   const uint8_t* data;
@@ -114,11 +115,11 @@ class LPCSpeechSynthWordBank {
   inline int num_frames() const { return num_frames_; }
   inline const LPCSpeechSynth::Frame* frames() const { return frames_; }
 
-  inline void GetWordBoundaries(double address, int* start, int* end) {
+  inline void GetWordBoundaries(real_t address, int* start, int* end) {
     if (num_words_ == 0) {
       *start = *end = -1;
     } else {
-      int word = static_cast<int>(address * static_cast<double>(num_words_));
+      int word = static_cast<int>(address * static_cast<real_t>(num_words_));
       if (word >= num_words_) {
         word = num_words_ - 1;
       }
@@ -159,27 +160,27 @@ class LPCSpeechSynthController {
   LPCSpeechSynthController() { }
   ~LPCSpeechSynthController() { }
 
-  void Init(LPCSpeechSynthWordBank* word_bank);
+  void Init(LPCSpeechSynthWordBank* word_bank, const Dsp& dsp);
 
   void Render(
       bool free_running,
       bool trigger,
       int bank,
-      double frequency,
-      double prosody_amount,
-      double speed,
-      double address,
-      double formant_shift,
-      double gain,
-      double* excitation,
-      double* output,
+      real_t frequency,
+      real_t prosody_amount,
+      real_t speed,
+      real_t address,
+      real_t formant_shift,
+      real_t gain,
+      real_t* excitation,
+      real_t* output,
       size_t size);
 
  private:
-  double clock_phase_;
-  double sample_[2];
-  double next_sample_[2];
-  double gain_;
+  real_t clock_phase_;
+  real_t sample_[2];
+  real_t next_sample_[2];
+  real_t gain_;
   LPCSpeechSynth synth_;
 
   int playback_frame_;
@@ -190,6 +191,8 @@ class LPCSpeechSynthController {
 
   static const LPCSpeechSynth::Frame phonemes_[kLPCSpeechSynthNumPhonemes];
 
+  real_t sr_;
+
   DISALLOW_COPY_AND_ASSIGN(LPCSpeechSynthController);
 };
 
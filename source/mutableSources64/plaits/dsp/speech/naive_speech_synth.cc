@@ -83,7 +83,9 @@ const NaiveSpeechSynth::Phoneme NaiveSpeechSynth::phonemes_[][kNaiveSpeechNumReg
   },
 };
 
-void NaiveSpeechSynth::Init() {
+void NaiveSpeechSynth::Init(const Dsp& dsp) {
+  sr_ = dsp.getSr();
+  a0_ = dsp.getA0();
   pulse_.Init();
   frequency_ = 0.0;
   click_duration_ = 0;
@@ -92,20 +94,20 @@ void NaiveSpeechSynth::Init() {
     filter_[i].Init();
   }
   pulse_coloration_.Init();
-    pulse_coloration_.set_f_q<FREQUENCY_DIRTY>(800.0 / kSampleRate, 0.5);
+    pulse_coloration_.set_f_q<FREQUENCY_DIRTY>(800.0 / sr_, 0.5);
 }
 
 void NaiveSpeechSynth::Render(
     bool click,
-    double frequency,
-    double phoneme,
-    double vocal_register,
-    double* temp,
-    double* excitation,
-    double* output,
+    real_t frequency,
+    real_t phoneme,
+    real_t vocal_register,
+    real_t* temp,
+    real_t* excitation,
+    real_t* output,
     size_t size) {
   if (click) {
-      click_duration_ = kSampleRate * 0.05;
+      click_duration_ = sr_ * 0.05;
   }
   click_duration_ -= min(click_duration_, size);
 
@@ -122,8 +124,8 @@ void NaiveSpeechSynth::Render(
     excitation[i] *= 4.0f;
   }
 
-  double p = phoneme * (kNaiveSpeechNumPhonemes - 1.001);
-  double r = vocal_register * (kNaiveSpeechNumRegisters - 1.001);
+  real_t p = phoneme * (kNaiveSpeechNumPhonemes - 1.001);
+  real_t r = vocal_register * (kNaiveSpeechNumRegisters - 1.001);
 
   MAKE_INTEGRAL_FRACTIONAL(p);
   MAKE_INTEGRAL_FRACTIONAL(r);
@@ -135,23 +137,22 @@ void NaiveSpeechSynth::Render(
     const Formant& p1r0 = phonemes_[p_integral + 1][r_integral].formant[i];
     const Formant& p1r1 = phonemes_[p_integral + 1][r_integral + 1].formant[i];
 
-    double p0r_f = p0r0.frequency + \
+    real_t p0r_f = p0r0.frequency + \
         (p0r1.frequency - p0r0.frequency) * r_fractional;
-    double p1r_f = p1r0.frequency + \
+    real_t p1r_f = p1r0.frequency + \
         (p1r1.frequency - p1r0.frequency) * r_fractional;
-    double f = p0r_f + (p1r_f - p0r_f) * p_fractional;
+    real_t f = p0r_f + (p1r_f - p0r_f) * p_fractional;
 
-    double p0r_a = p0r0.amplitude + \
+    real_t p0r_a = p0r0.amplitude + \
         (p0r1.amplitude - p0r0.amplitude) * r_fractional;
-    double p1r_a = p1r0.amplitude + \
+    real_t p1r_a = p1r0.amplitude + \
         (p1r1.amplitude - p1r0.amplitude) * r_fractional;
-    double a = (p0r_a + (p1r_a - p0r_a) * p_fractional) / 256.0;
+    real_t a = (p0r_a + (p1r_a - p0r_a) * p_fractional) / 256.0;
 
     if (f >= 160.0) {
       f = 160.0;
     }
-    //f = a0 * stmlib::SemitonesToRatio(f - 33.0);
-    f = a0 * stmlib::SemitonesToRatio(f - 33.0);
+    f = a0_ * stmlib::SemitonesToRatio(f - 33.0);
     if (click_duration_ && i == 0) {
       f *= 0.5;
     }
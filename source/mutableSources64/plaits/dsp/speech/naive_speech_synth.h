@@ -47,16 +47,16 @@ class NaiveSpeechSynth {
   NaiveSpeechSynth() { }
   ~NaiveSpeechSynth() { }
 
-  void Init();
+  void Init(const Dsp& dsp);
 
   void Render(
       bool click,
-      double frequency,
-      double phoneme,
-      double vocal_register,
-      double* temp,
-      double* excitation,
-      double* output,
+      real_t frequency,
+      real_t phoneme,
+      real_t vocal_register,
+      real_t* temp,
+      real_t* excitation,
+      real_t* output,
       size_t size);
 
  private:
@@ -70,7 +70,7 @@ class NaiveSpeechSynth {
   };
 
   Oscillator pulse_;
-  double frequency_;
+  real_t frequency_;
   size_t click_duration_;
 
   stmlib::Svf filter_[kNaiveSpeechNumFormants];
@@ -78,6 +78,9 @@ class NaiveSpeechSynth {
 
   static const Phoneme phonemes_[kNaiveSpeechNumPhonemes][kNaiveSpeechNumRegisters];
 
+  real_t sr_;
+  real_t a0_;
+
   DISALLOW_COPY_AND_ASSIGN(NaiveSpeechSynth);
 };
 
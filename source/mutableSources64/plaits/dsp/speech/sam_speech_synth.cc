@@ -43,7 +43,8 @@ namespace plaits {
 using namespace std;
 using namespace stmlib;
 
-void SAMSpeechSynth::Init() {
+void SAMSpeechSynth::Init(const Dsp& dsp) {
+  sr_ = dsp.getSr();
   phase_ = 0.0;
   frequency_ = 0.0;
   pulse_next_sample_ = 0.0;
@@ -79,7 +80,7 @@ const SAMSpeechSynth::Phoneme SAMSpeechSynth::phonemes_[] = {
 };
 
 /* static */
-const double SAMSpeechSynth::formant_amplitude_lut[] = {
+const real_t SAMSpeechSynth::formant_amplitude_lut[] = {
   0.03125000,  0.03756299,  0.04515131,  0.05427259,  0.06523652,
   0.07841532,  0.09425646,  0.11329776,  0.13618570,  0.16369736,
   0.19676682,  0.23651683,  0.28429697,  0.34172946,  0.41076422,
@@ -87,10 +88,10 @@ const double SAMSpeechSynth::formant_amplitude_lut[] = {
 };
 
 void SAMSpeechSynth::InterpolatePhonemeData(
-  double phoneme,
-  double formant_shift,
+  real_t phoneme,
+  real_t formant_shift,
   uint32_t* formant_frequency,
-  double* formant_amplitude) {
+  real_t* formant_amplitude) {
   MAKE_INTEGRAL_FRACTIONAL(phoneme);
 
   const Phoneme& p_1 = phonemes_[phoneme_integral];
@@ -98,43 +99,43 @@ void SAMSpeechSynth::InterpolatePhonemeData(
 
   formant_shift = 1.0 + formant_shift * 2.5;
   for (int i = 0; i < kSAMNumFormants; ++i) {
-    double f_1 = p_1.formant[i].frequency;
-    double f_2 = p_2.formant[i].frequency;
-    double f = f_1 + (f_2 - f_1) * phoneme_fractional;
-    f *= 8.0 * formant_shift * 4294967296.0 / kSampleRate;
+    real_t f_1 = p_1.formant[i].frequency;
+    real_t f_2 = p_2.formant[i].frequency;
+    real_t f = f_1 + (f_2 - f_1) * phoneme_fractional;
+    f *= 8.0 * formant_shift * 4294967296.0 / sr_;
     formant_frequency[i] = static_cast<uint32_t>(f);
 
-    double a_1 = formant_amplitude_lut[p_1.formant[i].amplitude];
-    double a_2 = formant_amplitude_lut[p_2.formant[i].amplitude];
+    real_t a_1 = formant_amplitude_lut[p_1.formant[i].amplitude];
+    real_t a_2 = formant_amplitude_lut[p_2.formant[i].amplitude];
     formant_amplitude[i] = a_1 + (a_2 - a_1) * phoneme_fractional;
   }
 }
 
 void SAMSpeechSynth::Render(
     bool consonant,
-    double frequency,
-    double vowel,
-    double formant_shift,
-    double* excitation,
-    double* output,
+    real_t frequency,
+    real_t vowel,
+    real_t formant_shift,
+    real_t* excitation,
+    real_t* output,
     size_t size) {
   if (frequency >= 0.0625) {
     frequency = 0.0625;
   }
 
   if (consonant) {
-      consonant_samples_ = kSampleRate * 0.05;
+      consonant_samples_ = sr_ * 0.05;
     int r = (vowel + 3.0 * frequency + 7.0 * formant_shift) * 8.0;
     consonant_index_ = (r % kSAMNumConsonants);
   }
   consonant_samples_ -= min(consonant_samples_, size);
 
-  double phoneme = consonant_samples_
+  real_t phoneme = consonant_samples_
       ? (consonant_index_ + kSAMNumVowels)
       : vowel * (kSAMNumVowels - 1.0001f);
 
   uint32_t formant_frequency[kSAMNumFormants];
-  double formant_amplitude[kSAMNumFormants];
+  real_t formant_amplitude[kSAMNumFormants];
 
   InterpolatePhonemeData(
       phoneme,
@@ -143,23 +144,23 @@ void SAMSpeechSynth::Render(
       formant_amplitude);
 
   ParameterInterpolator fm(&frequency_, frequency, size);
-  double pulse_next_sample = pulse_next_sample_;
+  real_t pulse_next_sample = pulse_next_sample_;
 
   while (size--) {
-    double pulse_this_sample = pulse_next_sample;
+    real_t pulse_this_sample = pulse_next_sample;
     pulse_next_sample = 0.0;
-    const double frequency = fm.Next();
+    const real_t frequency = fm.Next();
     phase_ += frequency;
 
     if (phase_ >= 1.0) {
       phase_ -= 1.0;
-      double t = phase_ / frequency;
+      real_t t = phase_ / frequency;
       formant_phase_[0] = static_cast<uint32_t>(
-          t * static_cast<double>(formant_frequency[0]));
+          t * static_cast<real_t>(formant_frequency[0]));
       formant_phase_[1] = static_cast<uint32_t>(
-          t * static_cast<double>(formant_frequency[1]));
+          t * static_cast<real_t>(formant_frequency[1]));
       formant_phase_[2] = static_cast<uint32_t>(
-          t * static_cast<double>(formant_frequency[2]));
+          t * static_cast<real_t>(formant_frequency[2]));
       pulse_this_sample -= ThisBlepSample(t);
       pulse_next_sample -= NextBlepSample(t);
     } else {
@@ -169,11 +170,11 @@ void SAMSpeechSynth::Render(
     }
     pulse_next_sample += phase_;
 
-    double d = pulse_this_sample - 0.5 - pulse_lp_;
+    real_t d = pulse_this_sample - 0.5 - pulse_lp_;
     pulse_lp_ += min(16.0 * frequency, 1.0) * d;
     *excitation++ = d;
 
-    double s = 0;
+    real_t s = 0;
     // s += lut_sine[formant_phase_[0] >> 22] * formant_amplitude[0];
     // s += lut_sine[formant_phase_[1] >> 22] * formant_amplitude[1];
     // s += lut_sine[formant_phase_[2] >> 22] * formant_amplitude[2];
@@ -44,23 +44,23 @@ class SAMSpeechSynth {
   SAMSpeechSynth() { }
   ~SAMSpeechSynth() { }
 
-  void Init();
+  void Init(const Dsp& dsp);
 
   void Render(
       bool consonant,
-      double frequency,
-      double vowel,
-      double formant_shift,
-      double* excitation,
-      double* output,
+      real_t frequency,
+      real_t vowel,
+      real_t formant_shift,
+      real_t* excitation,
+      real_t* output,
       size_t size);
 
  private:
   void InterpolatePhonemeData(
-      double phoneme,
-      double formant_shift,
+      real_t phoneme,
+      real_t formant_shift,
       uint32_t* formant_frequency,
-      double* formant_amplitude);
+      real_t* formant_amplitude);
 
   struct Formant {
     uint8_t frequency;
@@ -70,18 +70,20 @@ class SAMSpeechSynth {
     Formant formant[kSAMNumFormants];
   };
 
-  double phase_;
-  double frequency_;
+  real_t phase_;
+  real_t frequency_;
 
-  double pulse_next_sample_;
-  double pulse_lp_;
+  real_t pulse_next_sample_;
+  real_t pulse_lp_;
 
   uint32_t formant_phase_[3];
   size_t consonant_samples_;
-  double consonant_index_;
+  real_t consonant_index_;
 
   static const Phoneme phonemes_[kSAMNumPhonemes + 1];
-  static const double formant_amplitude_lut[16];
+  static const real_t formant_amplitude_lut[16];
+
+  real_t sr_;
 
   DISALLOW_COPY_AND_ASSIGN(SAMSpeechSynth);
 };
@@ -34,44 +34,99 @@ using namespace std;
 using namespace stmlib;
 
 
-void Voice::Init(BufferAllocator* allocator) {
-  engines_.Init();
-
-  engines_.RegisterInstance(&virtual_analog_engine_, false, 0.8, 0.8);
-  engines_.RegisterInstance(&waveshaping_engine_, false, 0.7, 0.6);
-  engines_.RegisterInstance(&fm_engine_, false, 0.6, 0.6);
-  engines_.RegisterInstance(&grain_engine_, false, 0.7, 0.6);
-  engines_.RegisterInstance(&additive_engine_, false, 0.8, 0.8);
-  engines_.RegisterInstance(&wavetable_engine_, false, 0.6, 0.6);
-  engines_.RegisterInstance(&chord_engine_, false, 0.8, 0.8);
-  engines_.RegisterInstance(&speech_engine_, false, -0.7, 0.8);
-
-  engines_.RegisterInstance(&swarm_engine_, false, -3.0, 1.0);
-  engines_.RegisterInstance(&noise_engine_, false, -1.0, -1.0);
-  engines_.RegisterInstance(&particle_engine_, false, -2.0, 1.0);
-  engines_.RegisterInstance(&string_engine_, true, -1.0, 0.8);
-  engines_.RegisterInstance(&modal_engine_, true, -1.0, 0.8);
-  engines_.RegisterInstance(&bass_drum_engine_, true, 0.8, 0.8);
-  engines_.RegisterInstance(&snare_drum_engine_, true, 0.8, 0.8);
-  engines_.RegisterInstance(&hi_hat_engine_, true, 0.8, 0.8);
-    
-    engines_.RegisterInstance(&virtual_analog_vcf_engine_, false, 1.0, 1.0);
-    engines_.RegisterInstance(&phase_distortion_engine_, false, 0.7, 0.7);
-    engines_.RegisterInstance(&six_op_engine_, true, 1.0, 1.0);
-    engines_.RegisterInstance(&six_op_engine_, true, 1.0, 1.0);
-    engines_.RegisterInstance(&six_op_engine_, true, 1.0, 1.0);
-    engines_.RegisterInstance(&wave_terrain_engine_, false, 0.7, 0.7);
-    engines_.RegisterInstance(&string_machine_engine_, false, 0.8, 0.8);
-    engines_.RegisterInstance(&chiptune_engine_, false, 0.5, 0.5);
-
-  for (int i = 0; i < engines_.size(); ++i) {
-    // All engines will share the same RAM space.
-    allocator->Free();
-    engines_.get(i)->Init(allocator);
+namespace {
+
+// vb: engines are created on demand in the voice's arena.
+typedef Engine* (*EngineFactory)(BufferAllocator* allocator);
+
+template<typename T>
+Engine* CreateEngine(BufferAllocator* allocator) {
+  void* memory = allocator->Allocate<T>(1);
+  return memory ? new(memory) T : NULL;
+}
+
+struct EngineDescriptor {
+  EngineFactory create;
+  bool already_enveloped;
+  real_t out_gain;
+  real_t aux_gain;
+};
+
+const EngineDescriptor kEngines[kMaxEngines] = {
+  { &CreateEngine<VirtualAnalogEngine>, false, 0.8, 0.8 },
+  { &CreateEngine<WaveshapingEngine>, false, 0.7, 0.6 },
+  { &CreateEngine<FMEngine>, false, 0.6, 0.6 },
+  { &CreateEngine<GrainEngine>, false, 0.7, 0.6 },
+  { &CreateEngine<AdditiveEngine>, false, 0.8, 0.8 },
+  { &CreateEngine<WavetableEngine>, false, 0.6, 0.6 },
+  { &CreateEngine<ChordEngine>, false, 0.8, 0.8 },
+  { &CreateEngine<SpeechEngine>, false, -0.7, 0.8 },
+
+  { &CreateEngine<SwarmEngine>, false, -3.0, 1.0 },
+  { &CreateEngine<NoiseEngine>, false, -1.0, -1.0 },
+  { &CreateEngine<ParticleEngine>, false, -2.0, 1.0 },
+  { &CreateEngine<StringEngine>, true, -1.0, 0.8 },
+  { &CreateEngine<ModalEngine>, true, -1.0, 0.8 },
+  { &CreateEngine<BassDrumEngine>, true, 0.8, 0.8 },
+  { &CreateEngine<SnareDrumEngine>, true, 0.8, 0.8 },
+  { &CreateEngine<HiHatEngine>, true, 0.8, 0.8 },
+
+  { &CreateEngine<VirtualAnalogVCFEngine>, false, 1.0, 1.0 },
+  { &CreateEngine<PhaseDistortionEngine>, false, 0.7, 0.7 },
+  { &CreateEngine<SixOpEngine>, true, 1.0, 1.0 },
+  { &CreateEngine<SixOpEngine>, true, 1.0, 1.0 },
+  { &CreateEngine<SixOpEngine>, true, 1.0, 1.0 },
+  { &CreateEngine<WaveTerrainEngine>, false, 0.7, 0.7 },
+  { &CreateEngine<StringMachineEngine>, false, 0.8, 0.8 },
+  { &CreateEngine<ChiptuneEngine>, false, 0.5, 0.5 },
+};
+
+// Engine::Init() allocates the same amount at every sample rate, so the
+// footprints are measured once, in a scratch buffer.
+const size_t kScratchSize = 65536;
+
+struct EngineFootprints {
+  EngineFootprints() {
+    uint8_t* scratch = new uint8_t[kScratchSize];
+    for (int i = 0; i < kMaxEngines; ++i) {
+      BufferAllocator allocator(scratch, kScratchSize);
+      Engine* e = kEngines[i].create(&allocator);
+      e->set_dsp(Dsp());
+      e->Init(&allocator);
+      // keep the next arena aligned
+      size[i] = (kScratchSize - allocator.free() + 15) & ~size_t(15);
+    }
+    delete[] scratch;
   }
 
-  engine_quantizer_.Init(engines_.size(), 0.05, true);
+  size_t size[kMaxEngines];
+};
+
+}  // namespace
+
+size_t Voice::engine_footprint(int engine) {
+  static const EngineFootprints footprints;
+  return footprints.size[engine];
+}
+
+size_t Voice::footprint() const {
+  return sizeof(Voice) + (engine_ ? engine_footprint(previous_engine_index_) : 0);
+}
+
+void Voice::Init(BufferAllocator* allocator, const Dsp& dsp) {
+  dsp_ = dsp;
+
+  // measure the footprints here, the first NewEngine() runs on the audio
+  // thread and must not allocate the scratch buffer.
+  engine_footprint(0);
+
+  size_t size = allocator->free();
+  allocator_.Init(allocator->Allocate<uint8_t>(size), size);
+  engine_ = NULL;
+
+  engine_quantizer_.Init(kMaxEngines, 0.05, true);
   previous_engine_index_ = -1;
+  bound_engine_ = -1;
   reload_user_data_ = false;
   engine_cv_ = 0.0;
 
@@ -88,13 +143,38 @@ void Voice::Init(BufferAllocator* allocator) {
 }
 
 
+void Voice::BindEngine(int engine, void* ram, size_t size) {
+  allocator_.Init(ram, size);
+  engine_ = NULL;
+  bound_engine_ = engine;
+  // the engine is created on the next block
+  previous_engine_index_ = -1;
+}
+
+Engine* Voice::NewEngine(int engine) {
+  allocator_.Free();
+  if (allocator_.free() < engine_footprint(engine)) {
+    return NULL;
+  }
+  const EngineDescriptor& d = kEngines[engine];
+  Engine* e = d.create(&allocator_);
+  PostProcessingSettings* s = &e->post_processing_settings;
+  s->already_enveloped = d.already_enveloped;
+  s->out_gain = d.out_gain;
+  s->aux_gain = d.aux_gain;
+  e->set_dsp(dsp_);
+  e->Init(&allocator_);
+  return e;
+}
+
+
     // changed out and aux buffers, vb
 
     void Voice::Render(
                        const Patch& patch,
                        const Modulations& modulations,
-                       double* out,
-                       double* aux,
+                       real_t* out,
+                       real_t* aux,
                        size_t size) {
         // Trigger, LPG, internal envelope.
 
@@ -102,9 +182,9 @@ void Voice::Init(BufferAllocator* allocator) {
         // CV out lags behind the GATE out.
         /* don't need the trigger delay for now, vb.
         trigger_delay_.Write(modulations.trigger);
-        double trigger_value = trigger_delay_.Read(kTriggerDelay);
+        real_t trigger_value = trigger_delay_.Read(kTriggerDelay);
         */
-        double trigger_value = modulations.trigger;
+        real_t trigger_value = modulations.trigger;
 
         bool previous_trigger_state = trigger_state_;
         if (!previous_trigger_state) {
@@ -130,8 +210,21 @@ void Voice::Init(BufferAllocator* allocator) {
         int engine_index = engine_quantizer_.Process(
             patch.engine,
             engine_cv_);
+        if (bound_engine_ >= 0) {
+            engine_index = bound_engine_;
+        }
 
-        Engine* e = engines_.get(engine_index);
+        if (engine_index != previous_engine_index_) {
+            engine_ = NewEngine(engine_index);
+        }
+        Engine* e = engine_;
+        if (!e) {
+            // the arena is too small for this engine
+            fill(&out[0], &out[size], 0.0);
+            fill(&aux[0], &aux[size], 0.0);
+            previous_engine_index_ = engine_index;
+            return;
+        }
 
         if (engine_index != previous_engine_index_ || reload_user_data_) {
             const uint8_t* data = NULL;
@@ -148,7 +241,7 @@ void Voice::Init(BufferAllocator* allocator) {
         EngineParameters p;
 
         bool rising_edge = trigger_state_ && !previous_trigger_state;
-        double note = (modulations.note + previous_note_) * 0.5;
+        real_t note = (modulations.note + previous_note_) * 0.5;
         previous_note_ = modulations.note;
         const PostProcessingSettings& pp_s = e->post_processing_settings;
 
@@ -159,7 +252,7 @@ void Voice::Init(BufferAllocator* allocator) {
             p.trigger = TRIGGER_UNPATCHED;
         }
 
-        const double short_decay = (200.0 * kBlockSize) / kSampleRate *
+        const real_t short_decay = (200.0 * kBlockSize) / dsp_.getSr() *
         SemitonesToRatio(-96.0 * patch.decay);
 
         decay_envelope_.Process(short_decay * 2.0);
@@ -167,7 +260,7 @@ void Voice::Init(BufferAllocator* allocator) {
         // const double compressed_level = max(
         //                                     1.3 * modulations.level / (0.3 + fabs(modulations.level)),
         //                                     0.0);
-        double compressed_level = 1.3 * modulations.level / (0.3 + abs(modulations.level));
+        real_t compressed_level = 1.3 * modulations.level / (0.3 + abs(modulations.level));
         CONSTRAIN(compressed_level, 0.0, 1.0);
         p.accent = modulations.level_patched ? compressed_level : 0.8;
 
@@ -178,16 +271,17 @@ void Voice::Init(BufferAllocator* allocator) {
         p.harmonics = patch.harmonics + modulations.harmonics;
         CONSTRAIN(p.harmonics, 0.0, 1.0);
 
-        double internal_envelope_amplitude = 1.0;
+        real_t internal_envelope_amplitude = 1.0;
 
-        double internal_envelope_amplitude_timbre = 1.0;
+        real_t internal_envelope_amplitude_timbre = 1.0;
         if (engine_index == 7) {        // was: 15
             internal_envelope_amplitude = 2.0 - p.harmonics * 6.0;
             CONSTRAIN(internal_envelope_amplitude, 0.0, 1.0);
-            speech_engine_.set_prosody_amount(
+            SpeechEngine* speech_engine = static_cast<SpeechEngine*>(e);
+            speech_engine->set_prosody_amount(
                                               !modulations.trigger_patched || modulations.frequency_patched ?
                                               0.0 : patch.frequency_modulation_amount);
-            speech_engine_.set_speed(
+            speech_engine->set_speed(
                                      !modulations.trigger_patched || modulations.morph_patched ?
                                      0.0 : patch.morph_modulation_amount);
         } else if (engine_index == 23) {     // was: 7
@@ -195,9 +289,9 @@ void Voice::Init(BufferAllocator* allocator) {
             // Disable internal envelope on TIMBRE, and enable the envelope generator
             // built into the chiptune engine.
             internal_envelope_amplitude_timbre = 0.0;
-            chiptune_engine_.set_envelope_shape(patch.timbre_modulation_amount);
+            static_cast<ChiptuneEngine*>(e)->set_envelope_shape(patch.timbre_modulation_amount);
           } else {
-            chiptune_engine_.set_envelope_shape(ChiptuneEngine::NO_ENVELOPE);
+            static_cast<ChiptuneEngine*>(e)->set_envelope_shape(ChiptuneEngine::NO_ENVELOPE);
           }
         }
 
@@ -245,14 +339,14 @@ void Voice::Init(BufferAllocator* allocator) {
 
         // Compute LPG parameters.
         if (!lpg_bypass) {
-            const double hf = patch.lpg_colour;
-            const double decay_tail = (20.0 * kBlockSize) / kSampleRate *
+            const real_t hf = patch.lpg_colour;
+            const real_t decay_tail = (20.0 * kBlockSize) / dsp_.getSr() *
             SemitonesToRatio(-72.0 * patch.decay + 12.0 * hf) - short_decay;
 
             if (modulations.level_patched) {
                 lpg_envelope_.ProcessLP(compressed_level, short_decay, decay_tail, hf);
             } else {
-                const double attack = NoteToFrequency(p.note) * double(kBlockSize) * 2.0;
+                const real_t attack = NoteToFrequency(p.note, dsp_.getA0()) * real_t(kBlockSize) * 2.0;
                 lpg_envelope_.ProcessPing(attack, short_decay, decay_tail, hf);
             }
         } else {
@@ -296,7 +390,7 @@ void Voice::Init(BufferAllocator* allocator) {
         // Delay trigger by 1ms to deal with sequencers or MIDI interfaces whose
         // CV out lags behind the GATE out.
         trigger_delay_.Write(modulations.trigger);
-        double trigger_value = trigger_delay_.Read(kTriggerDelay);
+        real_t trigger_value = trigger_delay_.Read(kTriggerDelay);
 
         bool previous_trigger_state = trigger_state_;
         if (!previous_trigger_state) {
@@ -334,7 +428,7 @@ void Voice::Init(BufferAllocator* allocator) {
         EngineParameters p;
 
         bool rising_edge = trigger_state_ && !previous_trigger_state;
-        double note = (modulations.note + previous_note_) * 0.5;
+        real_t note = (modulations.note + previous_note_) * 0.5;
         previous_note_ = modulations.note;
         const PostProcessingSettings& pp_s = e->post_processing_settings;
 
@@ -345,13 +439,13 @@ void Voice::Init(BufferAllocator* allocator) {
         }
 
         int blockSize = plaits::Dsp::getBlockSize();
-        const double sr = Dsp::getSr();
-        const double short_decay = (200.0 * blockSize) / sr *
+        const real_t sr = Dsp::getSr();
+        const real_t short_decay = (200.0 * blockSize) / sr *
         SemitonesToRatio(-96.0 * patch.decay);
 
         decay_envelope_.Process(short_decay * 2.0);
 
-        const double compressed_level = max(
+        const real_t compressed_level = max(
                                             1.3 * modulations.level / (0.3 + fabs(modulations.level)),
                                             0.0);
         p.accent = modulations.level_patched ? compressed_level : 0.8;
@@ -363,7 +457,7 @@ void Voice::Init(BufferAllocator* allocator) {
         p.harmonics = patch.harmonics + modulations.harmonics;
         CONSTRAIN(p.harmonics, 0.0, 1.0);
 
-        double internal_envelope_amplitude = 1.0;
+        real_t internal_envelope_amplitude = 1.0;
 
         if (engine_index == 7) {
             internal_envelope_amplitude = 2.0 - p.harmonics * 6.0;
@@ -419,14 +513,14 @@ void Voice::Init(BufferAllocator* allocator) {
 
         // Compute LPG parameters.
         if (!lpg_bypass) {
-            const double hf = patch.lpg_colour;
-            const double decay_tail = (20.0 * blockSize) / sr *
+            const real_t hf = patch.lpg_colour;
+            const real_t decay_tail = (20.0 * blockSize) / sr *
             SemitonesToRatio(-72.0 * patch.decay + 12.0 * hf) - short_decay;
 
             if (modulations.level_patched) {
                 lpg_envelope_.ProcessLP(compressed_level, short_decay, decay_tail, hf);
             } else {
-                const double attack = NoteToFrequency(p.note) * double(blockSize) * 2.0;
+                const real_t attack = NoteToFrequency(p.note) * real_t(blockSize) * 2.0;
                 lpg_envelope_.ProcessPing(attack, short_decay, decay_tail, hf);
             }
         }
@@ -86,19 +86,19 @@ class ChannelPostProcessor {
   }
 
   void Process(
-      double gain,
+      real_t gain,
       bool bypass_lpg,
-      double low_pass_gate_gain,
-      double low_pass_gate_frequency,
-      double low_pass_gate_hf_bleed,
-      double* in,
+      real_t low_pass_gate_gain,
+      real_t low_pass_gate_frequency,
+      real_t low_pass_gate_hf_bleed,
+      real_t* in,
       short* out,
       size_t size,
       size_t stride) {
     if (gain < 0.0) {
       limiter_.Process(-gain, in, size);
     }
-    const double post_gain = (gain < 0.0 ? 1.0 : gain) * -32767.0;
+    const real_t post_gain = (gain < 0.0 ? 1.0 : gain) * -32767.0;
     if (!bypass_lpg) {
       lpg_.Process(
           post_gain * low_pass_gate_gain,
@@ -118,17 +118,17 @@ class ChannelPostProcessor {
 
     // new process, vb
     void Process(
-                 double gain,
+                 real_t gain,
                  bool bypass_lpg,
-                 double low_pass_gate_gain,
-                 double low_pass_gate_frequency,
-                 double low_pass_gate_hf_bleed,
-                 double* in_out,
+                 real_t low_pass_gate_gain,
+                 real_t low_pass_gate_frequency,
+                 real_t low_pass_gate_hf_bleed,
+                 real_t* in_out,
                  size_t size) {
         if (gain < 0.0) {
             limiter_.Process(-gain, in_out, size);
         }
-        const double post_gain = (gain < 0.0 ? 1.0 : gain);
+        const real_t post_gain = (gain < 0.0 ? 1.0 : gain);
         if (!bypass_lpg) {
             lpg_.Process(
                          post_gain * low_pass_gate_gain,
@@ -138,7 +138,7 @@ class ChannelPostProcessor {
                          size);
         } else {
             while (size--) {
-                double s = *in_out * post_gain;
+                real_t s = *in_out * post_gain;
                 CONSTRAIN(s, -1.0, 1.0);
                 *in_out++ = s;
             }
@@ -154,28 +154,28 @@ class ChannelPostProcessor {
 };
 
 struct Patch {
-  double note;
-  double harmonics;
-  double timbre;
-  double morph;
-  double frequency_modulation_amount;
-  double timbre_modulation_amount;
-  double morph_modulation_amount;
+  real_t note;
+  real_t harmonics;
+  real_t timbre;
+  real_t morph;
+  real_t frequency_modulation_amount;
+  real_t timbre_modulation_amount;
+  real_t morph_modulation_amount;
 
   int engine;
-  double decay;
-  double lpg_colour;
+  real_t decay;
+  real_t lpg_colour;
 };
 
 struct Modulations {
-  double engine;
-  double note;
-  double frequency;
-  double harmonics;
-  double timbre;
-  double morph;
-  double trigger;
-  double level;
+  real_t engine;
+  real_t note;
+  real_t frequency;
+  real_t harmonics;
+  real_t timbre;
+  real_t morph;
+  real_t trigger;
+  real_t level;
 
   bool frequency_patched;
   bool timbre_patched;
@@ -195,7 +195,14 @@ class Voice {
     short aux;
   };
 
-  void Init(stmlib::BufferAllocator* allocator);
+  // vb: the voice takes all the free space of the allocator as its engine
+  // arena. Engines are created in the arena when they get selected, only
+  // the active one exists at a time.
+  void Init(stmlib::BufferAllocator* allocator, const Dsp& dsp);
+
+  // Poly mode, vb: gives the voice its own arena and pins it to one engine,
+  // so that the voices of a PolyVoice only keep the state of that engine.
+  void BindEngine(int engine, void* ram, size_t size);
   void ReloadUserData() {
     reload_user_data_ = true;
   }
@@ -210,32 +217,40 @@ class Voice {
     void Render(
                 const Patch& patch,
                 const Modulations& modulations,
-                double* out, double* aux,
+                real_t* out, real_t* aux,
                 size_t size);
     //
 
 
   inline int active_engine() const { return previous_engine_index_; }
 
+  // Arena bytes an engine needs (object and RAM), measured once per process.
+  static size_t engine_footprint(int engine);
+  // Memory in use: the voice itself and its active engine.
+  size_t footprint() const;
+
+  inline const Dsp& dsp() const { return dsp_; }
+
  private:
+  Engine* NewEngine(int engine);
   void ComputeDecayParameters(const Patch& settings);
 
-  inline double ApplyModulations(
-      double base_value,
-      double modulation_amount,
+  inline real_t ApplyModulations(
+      real_t base_value,
+      real_t modulation_amount,
       bool use_external_modulation,
-      double external_modulation,
+      real_t external_modulation,
       bool use_internal_envelope,
-      double envelope,
-      double default_internal_modulation,
-      double minimum_value,
-      double maximum_value) {
-    double value = base_value;
+      real_t envelope,
+      real_t default_internal_modulation,
+      real_t minimum_value,
+      real_t maximum_value) {
+    real_t value = base_value;
 //    modulation_amount *= std::max(fabs(modulation_amount) - 0.05, 0.05);
 //      modulation_amount *= 1.05;
       modulation_amount *= fabs(modulation_amount);     // vb
 
-    double modulation = use_external_modulation
+    real_t modulation = use_external_modulation
         ? external_modulation
         : (use_internal_envelope ? envelope : default_internal_modulation);
     value += modulation_amount * modulation;
@@ -243,51 +258,29 @@ class Voice {
     return value;
   }
 
-  VirtualAnalogEngine virtual_analog_engine_;
-  WaveshapingEngine waveshaping_engine_;
-  FMEngine fm_engine_;
-  GrainEngine grain_engine_;
-  AdditiveEngine additive_engine_;
-  WavetableEngine wavetable_engine_;
-  ChordEngine chord_engine_;
-  SpeechEngine speech_engine_;
-
-  SwarmEngine swarm_engine_;
-  NoiseEngine noise_engine_;
-  ParticleEngine particle_engine_;
-  StringEngine string_engine_;
-  ModalEngine modal_engine_;
-  BassDrumEngine bass_drum_engine_;
-  SnareDrumEngine snare_drum_engine_;
-  HiHatEngine hi_hat_engine_;
-
-  VirtualAnalogVCFEngine virtual_analog_vcf_engine_;
-  PhaseDistortionEngine phase_distortion_engine_;
-  SixOpEngine six_op_engine_;
-  WaveTerrainEngine wave_terrain_engine_;
-  StringMachineEngine string_machine_engine_;
-  ChiptuneEngine chiptune_engine_;
-
+  Engine* engine_;
+  stmlib::BufferAllocator allocator_;
 
   stmlib::HysteresisQuantizer2 engine_quantizer_;
 
   bool reload_user_data_;
   int previous_engine_index_;
-  double engine_cv_;
+  int bound_engine_;
+  real_t engine_cv_;
 
-  double previous_note_;
+  real_t previous_note_;
   bool trigger_state_;
 
   DecayEnvelope decay_envelope_;
   LPGEnvelope lpg_envelope_;
 
-  double trigger_delay_line_[kMaxTriggerDelay];
-  DelayLine<double, kMaxTriggerDelay> trigger_delay_;
+  real_t trigger_delay_line_[kMaxTriggerDelay];
+  DelayLine<real_t, kMaxTriggerDelay> trigger_delay_;
 
   ChannelPostProcessor out_post_processor_;
   ChannelPostProcessor aux_post_processor_;
 
-  EngineRegistry<kMaxEngines> engines_;
+  Dsp dsp_;   // vb
 
   // we don't use these anymore
   //double out_buffer_[kMaxBlockSize];
@@ -0,0 +1,127 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+//
+// Note to voice assignment for the poly mode. A new note takes the voice that
+// has been released for the longest time, or steals the oldest note when all
+// voices are playing.
+
+#ifndef PLAITS_DSP_VOICE_ALLOCATOR_H_
+#define PLAITS_DSP_VOICE_ALLOCATOR_H_
+
+#include "stmlib/stmlib.h"
+
+namespace plaits {
+
+template<int max_voices>
+class VoiceAllocator {
+ public:
+  VoiceAllocator() { }
+  ~VoiceAllocator() { }
+
+  void Init(int num_voices) {
+    clock_ = 0;
+    for (int i = 0; i < max_voices; ++i) {
+      note_[i] = 0.0;
+      active_[i] = false;
+      age_[i] = 0;
+    }
+    set_num_voices(num_voices);
+  }
+
+  // Voices beyond num_voices are released.
+  void set_num_voices(int num_voices) {
+    CONSTRAIN(num_voices, 1, max_voices);
+    num_voices_ = num_voices;
+    for (int i = num_voices_; i < max_voices; ++i) {
+      active_[i] = false;
+    }
+  }
+
+  int NoteOn(real_t note) {
+    int voice = Find(note);
+    if (voice < 0) {
+      voice = 0;
+      bool free_found = false;
+      for (int i = 0; i < num_voices_; ++i) {
+        bool is_free = !active_[i];
+        if (is_free != free_found) {
+          if (is_free) {
+            voice = i;
+            free_found = true;
+          }
+        } else if (age_[i] < age_[voice]) {
+          voice = i;
+        }
+      }
+    }
+    note_[voice] = note;
+    active_[voice] = true;
+    age_[voice] = ++clock_;
+    return voice;
+  }
+
+  // Returns the voice that played the note, or -1.
+  int NoteOff(real_t note) {
+    int voice = Find(note);
+    if (voice >= 0) {
+      active_[voice] = false;
+      age_[voice] = ++clock_;
+    }
+    return voice;
+  }
+
+  void Clear() {
+    for (int i = 0; i < max_voices; ++i) {
+      active_[i] = false;
+    }
+  }
+
+  inline bool active(int voice) const { return active_[voice]; }
+  inline real_t note(int voice) const { return note_[voice]; }
+  inline int num_voices() const { return num_voices_; }
+
+ private:
+  int Find(real_t note) const {
+    for (int i = 0; i < num_voices_; ++i) {
+      if (active_[i] && note_[i] == note) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  real_t note_[max_voices];
+  bool active_[max_voices];
+  uint32_t age_[max_voices];
+  uint32_t clock_;
+  int num_voices_;
+
+  DISALLOW_COPY_AND_ASSIGN(VoiceAllocator);
+};
+
+}  // namespace plaits
+
+#endif  // PLAITS_DSP_VOICE_ALLOCATOR_H_
@@ -3121,7 +3121,7 @@ const uint8_t* const fm_patches_table[] = {
   syx_bank_2,
 };
 
-const double lut_sine[] = {
+const real_t lut_sine[] = {
    0.000000000e+00,  1.227153829e-02,  2.454122852e-02,  3.680722294e-02,
    4.906767433e-02,  6.132073630e-02,  7.356456360e-02,  8.579731234e-02,
    9.801714033e-02,  1.102222073e-01,  1.224106752e-01,  1.345807085e-01,
@@ -3284,7 +3284,7 @@ const double lut_sine[] = {
    9.987954562e-01,  9.993223846e-01,  9.996988187e-01,  9.999247018e-01,
    1.000000000e+00,
 };
-const double lut_fm_frequency_quantizer[] = {
+const real_t lut_fm_frequency_quantizer[] = {
   -1.200000000e+01, -1.200000000e+01, -1.200000000e+01, -1.184000000e+01,
   -1.184000000e+01, -1.184000000e+01, -1.111000000e+01, -1.038000000e+01,
   -9.650000000e+00, -8.920000000e+00, -8.190000000e+00, -7.460000000e+00,
@@ -3319,7 +3319,7 @@ const double lut_fm_frequency_quantizer[] = {
    3.525000000e+01,  3.600000000e+01,  3.600000000e+01,  3.600000000e+01,
    3.600000000e+01,  3.600000000e+01,
 };
-const double lut_fold[] = {
+const real_t lut_fold[] = {
   -9.980545825e-01, -9.970653772e-01, -9.960649692e-01, -9.950532582e-01,
   -9.940301939e-01, -9.929957802e-01, -9.919500809e-01, -9.908932239e-01,
   -9.898254054e-01, -9.887468930e-01, -9.876580288e-01, -9.865592310e-01,
@@ -3450,7 +3450,7 @@ const double lut_fold[] = {
    9.940301939e-01,  9.950532582e-01,  9.960649692e-01,  9.970653772e-01,
    9.980545825e-01,  9.990327291e-01,  1.000000000e+00,  1.000000000e+00,
 };
-const double lut_fold_2[] = {
+const real_t lut_fold_2[] = {
    1.000000000e+00,  9.992967758e-01,  9.985815484e-01,  9.978540078e-01,
    9.971138332e-01,  9.963606927e-01,  9.955942426e-01,  9.948141269e-01,
    9.940199768e-01,  9.932114103e-01,  9.923880310e-01,  9.915494283e-01,
@@ -3581,7 +3581,7 @@ const double lut_fold_2[] = {
   -9.971138332e-01, -9.978540078e-01, -9.985815484e-01, -9.992967758e-01,
   -1.000000000e+00, -1.000691521e+00, -1.001371627e+00, -1.001371627e+00,
 };
-const double lut_stiffness[] = {
+const real_t lut_stiffness[] = {
   -6.250000000e-02, -5.859375000e-02, -5.468750000e-02, -5.078125000e-02,
   -4.687500000e-02, -4.296875000e-02, -3.906250000e-02, -3.515625000e-02,
   -3.125000000e-02, -2.734375000e-02, -2.343750000e-02, -1.953125000e-02,
@@ -3600,7 +3600,7 @@ const double lut_stiffness[] = {
    1.048005353e+00,  1.183990632e+00,  1.457101344e+00,  2.000000000e+00,
    2.000000000e+00,
 };
-const double lut_svf_shift[] = {
+const real_t lut_svf_shift[] = {
    7.500000000e-01,  7.591880421e-01,  7.683455389e-01,  7.774424499e-01,
    7.864497239e-01,  7.953397451e-01,  8.040867240e-01,  8.126670211e-01,
    8.210593968e-01,  8.292451828e-01,  8.372083767e-01,  8.449356653e-01,
@@ -3667,12 +3667,12 @@ const double lut_svf_shift[] = {
    9.999998482e-01,  9.999998567e-01,  9.999998648e-01,  9.999998724e-01,
    9.999998795e-01,
 };
-const double lut_4x_downsampler_fir[] = {
+const real_t lut_4x_downsampler_fir[] = {
    2.442415000e-02,  9.297315000e-02,  1.671293800e-01,  2.154733200e-01,
 };
 
 
-const double* const lookup_table_table[] = {
+const real_t* const lookup_table_table[] = {
   lut_sine,
   lut_fm_frequency_quantizer,
   lut_fold,
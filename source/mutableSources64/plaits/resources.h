@@ -45,7 +45,7 @@ typedef uint8_t ResourceId;
 
 extern const uint8_t* const fm_patches_table[];
 
-extern const double* const lookup_table_table[];
+extern const real_t* const lookup_table_table[];
 
 extern const int16_t* const lookup_table_i16_table[];
 
@@ -58,13 +58,13 @@ extern const int16_t* const wavetables_table[];
 extern const uint8_t syx_bank_0[];
 extern const uint8_t syx_bank_1[];
 extern const uint8_t syx_bank_2[];
-extern const double lut_sine[];
-extern const double lut_fm_frequency_quantizer[];
-extern const double lut_fold[];
-extern const double lut_fold_2[];
-extern const double lut_stiffness[];
-extern const double lut_svf_shift[];
-extern const double lut_4x_downsampler_fir[];
+extern const real_t lut_sine[];
+extern const real_t lut_fm_frequency_quantizer[];
+extern const real_t lut_fold[];
+extern const real_t lut_fold_2[];
+extern const real_t lut_stiffness[];
+extern const real_t lut_svf_shift[];
+extern const real_t lut_4x_downsampler_fir[];
 extern const int16_t lut_ws_inverse_tan[];
 extern const int16_t lut_ws_inverse_sin[];
 extern const int16_t lut_ws_linear[];
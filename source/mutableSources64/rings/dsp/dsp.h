@@ -41,18 +41,23 @@ namespace rings {
     const size_t kMaxBlockSize = 32;     // 24
     
 
+    // vb, sample rate context. Each Part owns its copy and hands it down to
+    // the voices, so instances can run at different rates side by side.
     class Dsp {
-    private:
-        static double sr;
-        static double a3;
-        
     public:
-        static double getSr() {return sr;}
-        static double getA3() {return a3;}
-        static void setSr(double newsr) {
-            sr = newsr;
-            a3 = 440.0 / sr;
+        Dsp() { setSr(48000.0); }
+        explicit Dsp(real_t newsr) { setSr(newsr); }
+        
+        real_t getSr() const {return sr_;}
+        real_t getA3() const {return a3_;}
+        void setSr(real_t newsr) {
+            sr_ = newsr;
+            a3_ = 440.0 / sr_;
         }
+        
+    private:
+        real_t sr_;
+        real_t a3_;
     };
 
 }  // namespace rings
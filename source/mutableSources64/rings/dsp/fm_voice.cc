@@ -41,8 +41,9 @@ namespace rings {
 
 using namespace stmlib;
 
-void FMVoice::Init() {
-  set_frequency(220.0 / Dsp::getSr());
+void FMVoice::Init(const Dsp& dsp) {
+  sr_ = dsp.getSr();
+  set_frequency(220.0 / sr_);
   set_ratio(0.5);
   set_brightness(0.5);
   set_damping(0.5);
@@ -64,29 +65,29 @@ void FMVoice::Init() {
   fm_amount_ = 0.0;
   
   follower_.Init(
-      8.0 / Dsp::getSr(),
-      160.0 / Dsp::getSr(),
-      1600.0 / Dsp::getSr());
+      8.0 / sr_,
+      160.0 / sr_,
+      1600.0 / sr_);
 }
 
-void FMVoice::Process(const double* in, double* out, double* aux, size_t size) {
+void FMVoice::Process(const real_t* in, real_t* out, real_t* aux, size_t size) {
   // Interpolate between the "oscillator" behaviour and the "FMLPGed thing"
   // behaviour.
-  double envelope_amount = damping_ < 0.9 ? 1.0 : (1.0 - damping_) * 10.0;
-  double amplitude_rt60 = 0.1 * SemitonesToRatio(damping_ * 96.0) * Dsp::getSr();
-  double amplitude_decay = 1.0 - pow(0.001, 1.0 / amplitude_rt60);
+  real_t envelope_amount = damping_ < 0.9 ? 1.0 : (1.0 - damping_) * 10.0;
+  real_t amplitude_rt60 = 0.1 * SemitonesToRatio(damping_ * 96.0) * sr_;
+  real_t amplitude_decay = 1.0 - pow(0.001, 1.0 / amplitude_rt60);
 
-  double brightness_rt60 = 0.1 * SemitonesToRatio(damping_ * 84.0) * Dsp::getSr();
-  double brightness_decay = 1.0 - pow(0.001, 1.0 / brightness_rt60);
+  real_t brightness_rt60 = 0.1 * SemitonesToRatio(damping_ * 84.0) * sr_;
+  real_t brightness_decay = 1.0 - pow(0.001, 1.0 / brightness_rt60);
   
-  double ratio = Interpolate(lut_fm_frequency_quantizer, ratio_, 128.0);
-  double modulator_frequency = carrier_frequency_ * SemitonesToRatio(ratio);
+  real_t ratio = Interpolate(lut_fm_frequency_quantizer, ratio_, 128.0);
+  real_t modulator_frequency = carrier_frequency_ * SemitonesToRatio(ratio);
   
   if (modulator_frequency > 0.5) {
     modulator_frequency = 0.5;
   }
   
-  double feedback = (feedback_amount_ - 0.5) * 2.0;
+  real_t feedback = (feedback_amount_ - 0.5) * 2.0;
   
   ParameterInterpolator carrier_increment(
       &previous_carrier_frequency_, carrier_frequency_, size);
@@ -99,11 +100,11 @@ void FMVoice::Process(const double* in, double* out, double* aux, size_t size) {
 
   uint32_t carrier_phase = carrier_phase_;
   uint32_t modulator_phase = modulator_phase_;
-  double previous_sample = previous_sample_;
+  real_t previous_sample = previous_sample_;
   
   while (size--) {
     // Envelope follower and internal envelope.
-    double amplitude_envelope, brightness_envelope;
+    real_t amplitude_envelope, brightness_envelope;
     follower_.Process(
         *in++,
         &amplitude_envelope,
@@ -115,33 +116,33 @@ void FMVoice::Process(const double* in, double* out, double* aux, size_t size) {
     SLOPE(brightness_envelope_, brightness_envelope, 0.01, brightness_decay);
     
     // Compute envelopes.
-    double brightness_value = brightness.Next();
+    real_t brightness_value = brightness.Next();
     brightness_value *= brightness_value;
-    double fm_amount_min = brightness_value < 0.5
+    real_t fm_amount_min = brightness_value < 0.5
         ? 0.0
         : brightness_value * 2.0 - 1.0;
-    double fm_amount_max = brightness_value < 0.5
+    real_t fm_amount_max = brightness_value < 0.5
         ? 2.0 * brightness_value
         : 1.0;
-    double fm_envelope = 0.5 + envelope_amount * (brightness_envelope_ - 0.5);
-    double fm_amount = (fm_amount_min + fm_amount_max * fm_envelope) * 2.0;
+    real_t fm_envelope = 0.5 + envelope_amount * (brightness_envelope_ - 0.5);
+    real_t fm_amount = (fm_amount_min + fm_amount_max * fm_envelope) * 2.0;
     SLEW(fm_amount_, fm_amount, 0.005 + fm_amount_max * 0.015);
 
     // FM synthesis in itself
-    double phase_feedback = feedback < 0.0 ? 0.5 * feedback * feedback : 0.0;
+    real_t phase_feedback = feedback < 0.0 ? 0.5 * feedback * feedback : 0.0;
     modulator_phase += static_cast<uint32_t>(4294967296.0 * \
       modulator_increment.Next() * (1.0 + previous_sample * phase_feedback));
     carrier_phase += static_cast<uint32_t>(4294967296.0 * \
         carrier_increment.Next());
 
-    double feedback = feedback_amount.Next();
-    double modulator_fb = feedback > 0.0 ? 0.25 * feedback * feedback : 0.0;
-    double modulator = SineFm(modulator_phase, modulator_fb * previous_sample);
-    double carrier = SineFm(carrier_phase, fm_amount_ * modulator);
+    real_t feedback = feedback_amount.Next();
+    real_t modulator_fb = feedback > 0.0 ? 0.25 * feedback * feedback : 0.0;
+    real_t modulator = SineFm(modulator_phase, modulator_fb * previous_sample);
+    real_t carrier = SineFm(carrier_phase, fm_amount_ * modulator);
     ONE_POLE(previous_sample, carrier, 0.1);
 
     // Compute amplitude envelope.
-    double gain = 1.0 + envelope_amount * (amplitude_envelope_ - 1.0);
+    real_t gain = 1.0 + envelope_amount * (amplitude_envelope_ - 1.0);
     ONE_POLE(gain_, gain, 0.005 + 0.045 * fm_amount_);
     
     *out++ = (carrier + 0.5 * modulator) * gain_;
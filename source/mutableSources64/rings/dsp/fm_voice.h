@@ -49,34 +49,34 @@ class FMVoice {
   FMVoice() { }
   ~FMVoice() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   void Process(
-      const double* in,
-      double* out,
-      double* aux,
+      const real_t* in,
+      real_t* out,
+      real_t* aux,
       size_t size);
   
-  inline void set_frequency(double frequency) {
+  inline void set_frequency(real_t frequency) {
     carrier_frequency_ = frequency;
   }
   
-  inline void set_ratio(double ratio) {
+  inline void set_ratio(real_t ratio) {
     ratio_ = ratio;
   }
 
-  inline void set_brightness(double brightness) {
+  inline void set_brightness(real_t brightness) {
     brightness_ = brightness;
   }
   
-  inline void set_damping(double damping) {
+  inline void set_damping(real_t damping) {
     damping_ = damping;
   }
   
-  inline void set_position(double position) {
+  inline void set_position(real_t position) {
     position_ = position;
   }
   
-  inline void set_feedback_amount(double feedback_amount) {
+  inline void set_feedback_amount(real_t feedback_amount) {
     feedback_amount_ = feedback_amount;
   }
   
@@ -85,36 +85,37 @@ class FMVoice {
     brightness_envelope_ = 1.0;
   }
   
-  inline double SineFm(uint32_t phase, double fm) const {
+  inline real_t SineFm(uint32_t phase, real_t fm) const {
     phase += (static_cast<uint32_t>((fm + 4.0) * 536870912.0)) << 3;
     uint32_t integral = phase >> 20;
-    double fractional = static_cast<double>(phase << 12) / 4294967296.0;
-    double a = lut_sine[integral];
-    double b = lut_sine[integral + 1];
+    real_t fractional = static_cast<real_t>(phase << 12) / 4294967296.0;
+    real_t a = lut_sine[integral];
+    real_t b = lut_sine[integral + 1];
     return a + (b - a) * fractional;
   }
   
  private:
-  double carrier_frequency_;
-  double ratio_;
-  double brightness_;
-  double damping_;
-  double position_;
-  double feedback_amount_;
+  real_t sr_;
+  real_t carrier_frequency_;
+  real_t ratio_;
+  real_t brightness_;
+  real_t damping_;
+  real_t position_;
+  real_t feedback_amount_;
   
-  double previous_carrier_frequency_;
-  double previous_modulator_frequency_;
-  double previous_brightness_;
-  double previous_damping_;
-  double previous_feedback_amount_;
+  real_t previous_carrier_frequency_;
+  real_t previous_modulator_frequency_;
+  real_t previous_brightness_;
+  real_t previous_damping_;
+  real_t previous_feedback_amount_;
   
-  double amplitude_envelope_;
-  double brightness_envelope_;
-  double gain_;
-  double fm_amount_;
+  real_t amplitude_envelope_;
+  real_t brightness_envelope_;
+  real_t gain_;
+  real_t fm_amount_;
   uint32_t carrier_phase_;
   uint32_t modulator_phase_;
-  double previous_sample_;
+  real_t previous_sample_;
   
   Follower follower_;
   
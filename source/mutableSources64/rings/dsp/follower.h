@@ -45,7 +45,7 @@ class Follower {
   Follower() { }
   ~Follower() { }
   
-  void Init(double low, double low_mid, double mid_high) {
+  void Init(real_t low, real_t low_mid, real_t mid_high) {
     low_mid_filter_.Init();
     mid_high_filter_.Init();
     
@@ -66,19 +66,19 @@ class Follower {
   }
 
   void Process(
-      double sample,
-      double* envelope,
-      double* centroid) {
-    double bands[3] = { 0.0, 0.0, 0.0 };
+      real_t sample,
+      real_t* envelope,
+      real_t* centroid) {
+    real_t bands[3] = { 0.0, 0.0, 0.0 };
     
     bands[2] = mid_high_filter_.Process<FILTER_MODE_HIGH_PASS>(sample);
     bands[1] = low_mid_filter_.Process<FILTER_MODE_HIGH_PASS>(
         mid_high_filter_.lp());
     bands[0] = low_mid_filter_.lp();
     
-    double weighted = 0.0;
-    double total = 0.0;
-    double frequency = 0.0;
+    real_t weighted = 0.0;
+    real_t total = 0.0;
+    real_t frequency = 0.0;
     for (int32_t i = 0; i < 3; ++i) {
       SLOPE(detector_[i], fabs(bands[i]), attack_[i], decay_[i]);
       weighted += detector_[i] * frequency;
@@ -86,8 +86,8 @@ class Follower {
       frequency += 0.5;
     }
     
-    double error = weighted / (total + 0.001) - centroid_;
-    double coefficient = error > 0.0 ? 0.05 : 0.001;
+    real_t error = weighted / (total + 0.001) - centroid_;
+    real_t coefficient = error > 0.0 ? 0.05 : 0.001;
     centroid_ += error * coefficient;
     
     *envelope = total;
@@ -98,11 +98,11 @@ class Follower {
   NaiveSvf low_mid_filter_;
   NaiveSvf mid_high_filter_;
   
-  double attack_[3];
-  double decay_[3];
-  double detector_[3];
+  real_t attack_[3];
+  real_t decay_[3];
+  real_t detector_[3];
   
-  double centroid_;
+  real_t centroid_;
   
   DISALLOW_COPY_AND_ASSIGN(Follower);
 };
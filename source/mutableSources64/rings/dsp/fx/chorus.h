@@ -49,14 +49,14 @@ class Chorus {
     phase_2_ = 0;
   }
   
-  void Process(double* left, double* right, size_t size) {
+  void Process(real_t* left, real_t* right, size_t size) {
     typedef E::Reserve<2047> Memory;
     E::DelayLine<Memory, 0> line;
     E::Context c;
     
     while (size--) {
       engine_.Start(&c);
-      double dry_amount = 1.0 - amount_ * 0.5;
+      real_t dry_amount = 1.0 - amount_ * 0.5;
     
       // Update LFO.
       phase_1_ += 4.17e-06;
@@ -67,12 +67,12 @@ class Chorus {
       if (phase_2_ >= 1.0) {
         phase_2_ -= 1.0;
       }
-      double sin_1 = stmlib::Interpolate(lut_sine, phase_1_, 4096.0);
-      double cos_1 = stmlib::Interpolate(lut_sine, phase_1_ + 0.25, 4096.0);
-      double sin_2 = stmlib::Interpolate(lut_sine, phase_2_, 4096.0);
-      double cos_2 = stmlib::Interpolate(lut_sine, phase_2_ + 0.25, 4096.0);
+      real_t sin_1 = stmlib::Interpolate(lut_sine, phase_1_, 4096.0);
+      real_t cos_1 = stmlib::Interpolate(lut_sine, phase_1_ + 0.25, 4096.0);
+      real_t sin_2 = stmlib::Interpolate(lut_sine, phase_2_, 4096.0);
+      real_t cos_2 = stmlib::Interpolate(lut_sine, phase_2_ + 0.25, 4096.0);
     
-      double wet;
+      real_t wet;
     
       // Sum L & R channel to send to chorus line.
       c.Read(*left, 0.5);
@@ -93,11 +93,11 @@ class Chorus {
     }
   }
   
-  inline void set_amount(double amount) {
+  inline void set_amount(real_t amount) {
     amount_ = amount;
   }
   
-  inline void set_depth(double depth) {
+  inline void set_depth(real_t depth) {
     depth_ = depth * 384.0;
   }
   
@@ -105,11 +105,11 @@ class Chorus {
   typedef FxEngine<2048, FORMAT_16_BIT> E;
   E engine_;
   
-  double amount_;
-  double depth_;
+  real_t amount_;
+  real_t depth_;
   
-  double phase_1_;
-  double phase_2_;
+  real_t phase_1_;
+  real_t phase_2_;
   
   DISALLOW_COPY_AND_ASSIGN(Chorus);
 };
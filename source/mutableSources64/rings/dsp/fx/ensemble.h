@@ -49,7 +49,7 @@ class Ensemble {
     phase_2_ = 0;
   }
   
-  void Process(double* left, double* right, size_t size) {
+  void Process(real_t* left, real_t* right, size_t size) {
     typedef E::Reserve<2047, E::Reserve<2047> > Memory;
     E::DelayLine<Memory, 0> line_l;
     E::DelayLine<Memory, 1> line_r;
@@ -57,7 +57,7 @@ class Ensemble {
     
     while (size--) {
       engine_.Start(&c);
-      double dry_amount = 1.0 - amount_ * 0.5;
+      real_t dry_amount = 1.0 - amount_ * 0.5;
     
       // Update LFO.
       phase_1_ += 1.57e-05f;
@@ -69,22 +69,22 @@ class Ensemble {
         phase_2_ -= 1.0f;
       }
       int32_t phi_1 = (phase_1_ * 4096.0);
-      double slow_0 = lut_sine[phi_1 & 4095];
-      double slow_120 = lut_sine[(phi_1 + 1365) & 4095];
-      double slow_240 = lut_sine[(phi_1 + 2730) & 4095];
+      real_t slow_0 = lut_sine[phi_1 & 4095];
+      real_t slow_120 = lut_sine[(phi_1 + 1365) & 4095];
+      real_t slow_240 = lut_sine[(phi_1 + 2730) & 4095];
       int32_t phi_2 = (phase_2_ * 4096.0);
-      double fast_0 = lut_sine[phi_2 & 4095];
-      double fast_120 = lut_sine[(phi_2 + 1365) & 4095];
-      double fast_240 = lut_sine[(phi_2 + 2730) & 4095];
+      real_t fast_0 = lut_sine[phi_2 & 4095];
+      real_t fast_120 = lut_sine[(phi_2 + 1365) & 4095];
+      real_t fast_240 = lut_sine[(phi_2 + 2730) & 4095];
       
-      double a = depth_ * 1.0;
-      double b = depth_ * 0.1;
+      real_t a = depth_ * 1.0;
+      real_t b = depth_ * 0.1;
       
-      double mod_1 = slow_0 * a + fast_0 * b;
-      double mod_2 = slow_120 * a + fast_120 * b;
-      double mod_3 = slow_240 * a + fast_240 * b;
+      real_t mod_1 = slow_0 * a + fast_0 * b;
+      real_t mod_2 = slow_120 * a + fast_120 * b;
+      real_t mod_3 = slow_240 * a + fast_240 * b;
     
-      double wet = 0.0;
+      real_t wet = 0.0;
     
       // Sum L & R channel to send to chorus line.
       c.Read(*left, 1.0);
@@ -108,11 +108,11 @@ class Ensemble {
     }
   }
   
-  inline void set_amount(double amount) {
+  inline void set_amount(real_t amount) {
     amount_ = amount;
   }
   
-  inline void set_depth(double depth) {
+  inline void set_depth(real_t depth) {
     depth_ = depth * 128.0f;
   }
   
@@ -120,11 +120,11 @@ class Ensemble {
   typedef FxEngine<4096, FORMAT_16_BIT> E;
   E engine_;
   
-  double amount_;
-  double depth_;
+  real_t amount_;
+  real_t depth_;
   
-  double phase_1_;
-  double phase_2_;
+  real_t phase_1_;
+  real_t phase_2_;
   
   DISALLOW_COPY_AND_ASSIGN(Ensemble);
 };
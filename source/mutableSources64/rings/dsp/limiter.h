@@ -48,30 +48,30 @@ class Limiter {
   }
 
   void Process(
-      double* l,
-      double* r,
+      real_t* l,
+      real_t* r,
       size_t size,
-      double pre_gain) {
+      real_t pre_gain) {
     while (size--) {
-      double l_pre = *l * pre_gain;
-      double r_pre = *r * pre_gain;
+      real_t l_pre = *l * pre_gain;
+      real_t r_pre = *r * pre_gain;
     
-      double l_peak = fabs(l_pre);
-      double r_peak = fabs(r_pre);
-      double s_peak = fabs(r_pre - l_pre);
+      real_t l_peak = fabs(l_pre);
+      real_t r_peak = fabs(r_pre);
+      real_t s_peak = fabs(r_pre - l_pre);
 
-      double peak = std::max(std::max(l_peak, r_peak), s_peak);
+      real_t peak = std::max(std::max(l_peak, r_peak), s_peak);
       SLOPE(peak_, peak, 0.05, 0.00002);
 
       // Clamp to 8Vpp, clipping softly towards 10Vpp
-      double gain = (peak_ <= 1.0 ? 1.0 : 1.0 / peak_);
+      real_t gain = (peak_ <= 1.0 ? 1.0 : 1.0 / peak_);
       *l++ = stmlib::SoftLimit(l_pre * gain * 0.8);
       *r++ = stmlib::SoftLimit(r_pre * gain * 0.8);
     }
   }
 
  private:
-  double peak_;
+  real_t peak_;
 
   DISALLOW_COPY_AND_ASSIGN(Limiter);
 };
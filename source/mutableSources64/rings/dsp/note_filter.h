@@ -44,11 +44,11 @@ class NoteFilter {
   ~NoteFilter() { }
 
   void Init(
-      double sample_rate,
-      double time_constant_fast_edge,
-      double time_constant_steady_part,
-      double edge_recovery_time,
-      double edge_avoidance_delay) {
+      real_t sample_rate,
+      real_t time_constant_fast_edge,
+      real_t time_constant_steady_part,
+      real_t edge_recovery_time,
+      real_t edge_avoidance_delay) {
     fast_coefficient_ = 1.0 / (time_constant_fast_edge * sample_rate);
     slow_coefficient_ = 1.0 / (time_constant_steady_part * sample_rate);
     lag_coefficient_ = 1.0 / (edge_recovery_time * sample_rate);
@@ -63,7 +63,7 @@ class NoteFilter {
     std::fill(&previous_values_[0], &previous_values_[N], note_);
   }
 
-  inline double Process(double note, bool strum) {
+  inline real_t Process(real_t note, bool strum) {
     // If there is a sharp change, follow it instantly.
     if (fabs(note - note_) > 0.4 || strum) {
       stable_note_ = note_ = note;
@@ -72,7 +72,7 @@ class NoteFilter {
       std::fill(&previous_values_[0], &previous_values_[N], note);
     } else {
       // Median filtering of the raw ADC value.
-      double sorted_values[N];
+      real_t sorted_values[N];
       std::rotate(
           &previous_values_[0],
           &previous_values_[1],
@@ -80,7 +80,7 @@ class NoteFilter {
       previous_values_[N - 1] = note;
       std::copy(&previous_values_[0], &previous_values_[N], &sorted_values[0]);
       std::sort(&sorted_values[0], &sorted_values[N]);
-      double median = 0.5 * (sorted_values[(N - 1) / 2] + sorted_values[N / 2]);
+      real_t median = 0.5 * (sorted_values[(N - 1) / 2] + sorted_values[N / 2]);
     
       // Adaptive lag processor.
       note_ += coefficient_ * (median - note_);
@@ -95,26 +95,26 @@ class NoteFilter {
     return note_;
   }
 
-  inline double note() const {
+  inline real_t note() const {
     return note_;
   }
 
-  inline double stable_note() const {
+  inline real_t stable_note() const {
     return delayed_stable_note_.Read();
   }
 
  private:
-  double previous_values_[N];
-  double note_;
-  double stable_note_;
-  stmlib::DelayLine<double, 16> delayed_stable_note_;
+  real_t previous_values_[N];
+  real_t note_;
+  real_t stable_note_;
+  stmlib::DelayLine<real_t, 16> delayed_stable_note_;
 
-  double coefficient_;
-  double stable_coefficient_;
+  real_t coefficient_;
+  real_t stable_coefficient_;
 
-  double fast_coefficient_;
-  double slow_coefficient_;
-  double lag_coefficient_;
+  real_t fast_coefficient_;
+  real_t slow_coefficient_;
+  real_t lag_coefficient_;
 };
 
 }  // namespace rings
@@ -47,37 +47,37 @@ class ZScorer {
   ZScorer() { }
   ~ZScorer() { }
   
-  void Init(double cutoff) {
+  void Init(real_t cutoff) {
     coefficient_ = cutoff;
     mean_ = 0.0;
     variance_ = 0.00;
   }
   
-  inline double Normalize(double sample) {
+  inline real_t Normalize(real_t sample) {
     return Update(sample) / Sqrt(variance_);
   }
   
-  inline bool Test(double sample, double threshold) {
-    double value = Update(sample);
+  inline bool Test(real_t sample, real_t threshold) {
+    real_t value = Update(sample);
     return value > Sqrt(variance_) * threshold;
   }
 
-  inline bool Test(double sample, double threshold, double absolute_threshold) {
-    double value = Update(sample);
+  inline bool Test(real_t sample, real_t threshold, real_t absolute_threshold) {
+    real_t value = Update(sample);
     return value > Sqrt(variance_) * threshold && value > absolute_threshold;
   }
 
  private:
-  inline double Update(float sample) {
-    double centered = sample - mean_;
+  inline real_t Update(float sample) {
+    real_t centered = sample - mean_;
     mean_ += coefficient_ * centered;
     variance_ += coefficient_ * (centered * centered - variance_);
     return centered;
   }
   
-  double coefficient_;
-  double mean_;
-  double variance_;
+  real_t coefficient_;
+  real_t mean_;
+  real_t variance_;
   
   DISALLOW_COPY_AND_ASSIGN(ZScorer);
 };
@@ -87,15 +87,15 @@ class Compressor {
   Compressor() { }
   ~Compressor() { }
   
-  void Init(double attack, double decay, double max_gain) {
+  void Init(real_t attack, real_t decay, real_t max_gain) {
     attack_ = attack;
     decay_ = decay;
     level_ = 0.0;
     skew_ = 1.0 / max_gain;
   }
   
-  void Process(const double* in, double* out, size_t size) {
-    double level = level_;
+  void Process(const real_t* in, real_t* out, size_t size) {
+    real_t level = level_;
     while (size--) {
         SLOPE(level, abs(*in), attack_, decay_);
         *out++ = *in++ / (skew_ + level);
@@ -104,10 +104,10 @@ class Compressor {
   }
  
  private:
-  double attack_;
-  double decay_;
-  double level_;
-  double skew_;
+  real_t attack_;
+  real_t decay_;
+  real_t level_;
+  real_t skew_;
   
   DISALLOW_COPY_AND_ASSIGN(Compressor);
 };
@@ -118,12 +118,12 @@ class OnsetDetector {
   ~OnsetDetector() { }
   
   void Init(
-      double low,
-      double low_mid,
-      double mid_high,
-      double decimated_sr,
-      double ioi_time) {
-    double ioi_f = 1.0 / (ioi_time * decimated_sr);
+      real_t low,
+      real_t low_mid,
+      real_t mid_high,
+      real_t decimated_sr,
+      real_t ioi_time) {
+    real_t ioi_f = 1.0 / (ioi_time * decimated_sr);
     compressor_.Init(ioi_f * 10.0, ioi_f * 0.05, 40.0);
     
     low_mid_filter_.Init();
@@ -153,7 +153,7 @@ class OnsetDetector {
     onset_df_ = 0.0;
   }
   
-  bool Process(const double* samples, size_t size) {
+  bool Process(const real_t* samples, size_t size) {
     // Automatic gain control.
     compressor_.Process(samples, bands_[0], size);
     
@@ -163,21 +163,21 @@ class OnsetDetector {
 
     // Compute low-pass energy and onset detection function
     // (derivative of energy) in each band.
-    double onset_df = 0.0;
-    double total_energy = 0.0;
+    real_t onset_df = 0.0;
+    real_t total_energy = 0.0;
     for (int32_t i = 0; i < 3; ++i) {
-      double* s = bands_[i];
-      double energy = 0.0;
-      double envelope = envelope_[i];
+      real_t* s = bands_[i];
+      real_t energy = 0.0;
+      real_t envelope = envelope_[i];
       size_t increment = 4 >> i;
       for (size_t j = 0; j < size; j += increment) {
         SLOPE(envelope, s[j] * s[j], attack_[i], decay_[i]);
         energy += envelope;
       }
-      energy = Sqrt(energy) * double(increment);
+      energy = Sqrt(energy) * real_t(increment);
       envelope_[i] = envelope;
 
-      double derivative = energy - energy_[i];
+      real_t derivative = energy - energy_[i];
       onset_df += derivative + fabs(derivative);
       energy_[i] = energy;
       total_energy += energy;
@@ -206,19 +206,19 @@ class OnsetDetector {
   NaiveSvf low_mid_filter_;
   NaiveSvf mid_high_filter_;
   
-  double attack_[3];
-  double decay_[3];
-  double energy_[3];
-  double envelope_[3];
-  double onset_df_;
+  real_t attack_[3];
+  real_t decay_[3];
+  real_t energy_[3];
+  real_t envelope_[3];
+  real_t onset_df_;
   
   //double bands_[3][32];     // TODO: why 32 ??? vb
-  double bands_[3][64];
+  real_t bands_[3][64];
     
   ZScorer z_df_;
   
-  double inhibit_threshold_;
-  double inhibit_decay_;
+  real_t inhibit_threshold_;
+  real_t inhibit_decay_;
   int32_t inhibit_time_;
   int32_t inhibit_counter_;
   
@@ -41,10 +41,11 @@ using namespace stmlib;
     
     
 
-void Part::Init(uint16_t* reverb_buffer) {
+void Part::Init(uint16_t* reverb_buffer, const Dsp& dsp) {
     // vb
-    sr_ = Dsp::getSr();
-    a3_ = Dsp::getA3();
+    dsp_ = dsp;
+    sr_ = dsp.getSr();
+    a3_ = dsp.getA3();
     
   active_voice_ = 0;
   
@@ -59,7 +60,7 @@ void Part::Init(uint16_t* reverb_buffer) {
     excitation_filter_[i].Init();
     plucker_[i].Init();
     dc_blocker_[i].Init(1.0 - 10.0 / sr_);
-    resonator_[i].Init();     // vb, init resonators
+    resonator_[i].Init(dsp_);     // vb, init resonators
   }
   
   reverb_.Init(reverb_buffer);
@@ -83,7 +84,7 @@ void Part::ConfigureResonators() {
       {
         int32_t resolution = 64 / polyphony_ - 4;
         for (int32_t i = 0; i < polyphony_; ++i) {
-          resonator_[i].Init();
+          resonator_[i].Init(dsp_);
           resonator_[i].set_resolution(resolution);
         }
       }
@@ -94,16 +95,16 @@ void Part::ConfigureResonators() {
     case RESONATOR_MODEL_SYMPATHETIC_STRING_QUANTIZED:
     case RESONATOR_MODEL_STRING_AND_REVERB:
       {
-        double lfo_frequencies[kNumStrings] = {
+        real_t lfo_frequencies[kNumStrings] = {
           0.5, 0.4, 0.35, 0.23, 0.211, 0.2, 0.171
         };
         for (int32_t i = 0; i < kNumStrings; ++i) {
           bool has_dispersion = model_ == RESONATOR_MODEL_STRING || \
               model_ == RESONATOR_MODEL_STRING_AND_REVERB;
-          string_[i].Init(has_dispersion);
+          string_[i].Init(dsp_, has_dispersion);
 
 //          double f_lfo = double(Dsp::getBlockSize()) / sr_;
-            double f_lfo = double(kMaxBlockSize) / sr_;
+            real_t f_lfo = real_t(kMaxBlockSize) / sr_;
           f_lfo *= lfo_frequencies[i];
           lfo_[i].Init<COSINE_OSCILLATOR_APPROXIMATE>(f_lfo);
         }
@@ -116,7 +117,7 @@ void Part::ConfigureResonators() {
     case RESONATOR_MODEL_FM_VOICE:
       {
         for (int32_t i = 0; i < polyphony_; ++i) {
-          fm_voice_[i].Init();
+          fm_voice_[i].Init(dsp_);
         }
       }
       break;
@@ -134,7 +135,7 @@ void Part::ConfigureResonators() {
 #ifdef BRYAN_CHORDS
 
 // Chord table by Bryan Noll:
-double chords[kMaxPolyphony][11][8] = {
+real_t chords[kMaxPolyphony][11][8] = {
   {
     { -12.0, -0.01, 0.0,  0.01, 0.02, 11.98, 11.99, 12.0 }, // OCT
     { -12.0, -5.0,  0.0,  6.99, 7.0,  11.99, 12.0,  19.0 }, // 5
@@ -192,7 +193,7 @@ double chords[kMaxPolyphony][11][8] = {
 #else
 
 // Original chord table
-double chords[kMaxPolyphony][11][8] = {
+real_t chords[kMaxPolyphony][11][8] = {
   {
     { -12.0, 0.0, 0.01, 0.02, 0.03, 11.98, 11.99, 12.0 },
     { -12.0, 0.0, 3.0,  3.01, 7.0,  9.99,  10.0,  19.0 },
@@ -250,23 +251,23 @@ double chords[kMaxPolyphony][11][8] = {
 #endif  // BRYAN_CHORDS
 
 void Part::ComputeSympatheticStringsNotes(
-    double tonic,
-    double note,
-    double parameter,
-    double* destination,
+    real_t tonic,
+    real_t note,
+    real_t parameter,
+    real_t* destination,
     size_t num_strings) {
     
-  double notes[9] = {
+  real_t notes[9] = {
       tonic,
-      note - 12.0,
-      note - 7.01955,
+      note - real_t(12.0),
+      note - real_t(7.01955),
       note,
-      note + 7.01955,
-      note + 12.0,
-      note + 19.01955,
-      note + 24.0,
-      note + 24.0 };
-  const double detunings[4] = {
+      note + real_t(7.01955),
+      note + real_t(12.0),
+      note + real_t(19.01955),
+      note + real_t(24.0),
+      note + real_t(24.0) };
+  const real_t detunings[4] = {
       0.013,
       0.011,
       0.007,
@@ -276,7 +277,7 @@ void Part::ComputeSympatheticStringsNotes(
   if (parameter >= 2.0) {
     // Quantized chords
     int32_t chord_index = parameter - 2.0;
-    const double* chord = chords[polyphony_ - 1][chord_index];
+    const real_t* chord = chords[polyphony_ - 1][chord_index];
     for (size_t i = 0; i < num_strings; ++i) {
       destination[i] = chord[i] + note;
     }
@@ -287,7 +288,7 @@ void Part::ComputeSympatheticStringsNotes(
   size_t first_detuned_string = num_strings - num_detuned_strings;
   
   for (size_t i = 0; i < first_detuned_string; ++i) {
-    double note = 3.0;
+    real_t note = 3.0;
     if (i != 0) {
       note = parameter * 7.0;
       parameter += (1.0 - parameter) * 0.2;
@@ -296,8 +297,8 @@ void Part::ComputeSympatheticStringsNotes(
     MAKE_INTEGRAL_FRACTIONAL(note);
     note_fractional = Squash(note_fractional);
 
-    double a = notes[note_integral];
-    double b = notes[note_integral + 1];
+    real_t a = notes[note_integral];
+    real_t b = notes[note_integral + 1];
     
     note = a + (b - a) * note_fractional;
     destination[i] = note;
@@ -311,8 +312,8 @@ void Part::RenderModalVoice(
     int32_t voice,
     const PerformanceState& performance_state,
     const Patch& patch,
-    double frequency,
-    double filter_cutoff,
+    real_t frequency,
+    real_t filter_cutoff,
     size_t size) {
   // Internal exciter is a pulse, pre-filter.
   if (performance_state.internal_exciter &&
@@ -344,8 +345,8 @@ void Part::RenderFMVoice(
     int32_t voice,
     const PerformanceState& performance_state,
     const Patch& patch,
-    double frequency,
-    double filter_cutoff,
+    real_t frequency,
+    real_t filter_cutoff,
     size_t size) {
   FMVoice& v = fm_voice_[voice];
   if (performance_state.internal_exciter &&
@@ -367,17 +368,17 @@ void Part::RenderStringVoice(
     int32_t voice,
     const PerformanceState& performance_state,
     const Patch& patch,
-    double frequency,
-    double filter_cutoff,
+    real_t frequency,
+    real_t filter_cutoff,
     size_t size) {
   // Compute number of strings and frequency.
   int32_t num_strings = 1;
-  double frequencies[kNumStrings];
+  real_t frequencies[kNumStrings];
 
   if (model_ == RESONATOR_MODEL_SYMPATHETIC_STRING ||
       model_ == RESONATOR_MODEL_SYMPATHETIC_STRING_QUANTIZED) {
     num_strings = 2 * kMaxPolyphony / polyphony_;
-    double parameter = model_ == RESONATOR_MODEL_SYMPATHETIC_STRING
+    real_t parameter = model_ == RESONATOR_MODEL_SYMPATHETIC_STRING
         ? patch.structure
         : 2.0 + performance_state.chord;
     ComputeSympatheticStringsNotes(
@@ -394,7 +395,7 @@ void Part::RenderStringVoice(
   }
 
   if (voice == active_voice_) {
-    const double gain = 1.0 / Sqrt(static_cast<double>(num_strings) * 2.0);
+    const real_t gain = 1.0 / Sqrt(static_cast<real_t>(num_strings) * 2.0);
     for (size_t i = 0; i < size; ++i) {
       resonator_input_[i] *= gain;
     }
@@ -419,22 +420,22 @@ void Part::RenderStringVoice(
   fill(&out_buffer_[0], &out_buffer_[size], 0.0);
   fill(&aux_buffer_[0], &aux_buffer_[size], 0.0);
   
-  double structure = patch.structure;
-  double dispersion = structure < 0.24
+  real_t structure = patch.structure;
+  real_t dispersion = structure < 0.24
       ? (structure - 0.24) * 4.166
       : (structure > 0.26 ? (structure - 0.26) * 1.35135 : 0.0);
   
   for (int32_t string = 0; string < num_strings; ++string) {
     int32_t i = voice + string * polyphony_;
     String& s = string_[i];
-    double lfo_value = lfo_[i].Next();
+    real_t lfo_value = lfo_[i].Next();
     
-    double brightness = patch.brightness;
-    double damping = patch.damping;
-    double position = patch.position;
-    double glide = 1.0;
-    double string_index = static_cast<double>(string) / static_cast<double>(num_strings);
-    const double* input = resonator_input_;
+    real_t brightness = patch.brightness;
+    real_t damping = patch.damping;
+    real_t position = patch.position;
+    real_t glide = 1.0;
+    real_t string_index = static_cast<real_t>(string) / static_cast<real_t>(num_strings);
+    const real_t* input = resonator_input_;
     
     if (model_ == RESONATOR_MODEL_STRING_AND_REVERB) {
       damping *= (2.0 - damping);
@@ -448,7 +449,7 @@ void Part::RenderStringVoice(
       brightness *= (2.0 - brightness);
       brightness *= (2.0 - brightness);
       damping = 0.7 + patch.damping * 0.27;
-      double amount = (0.5 - fabs(0.5 - patch.position)) * 0.9;
+      real_t amount = (0.5 - fabs(0.5 - patch.position)) * 0.9;
       position = patch.position + lfo_value * amount;
       glide = SemitonesToRatio((brightness - 1.0) * 36.0);
       input = sympathetic_resonator_input_;
@@ -463,9 +464,9 @@ void Part::RenderStringVoice(
     
     if (string == 0) {
       // Was 0.1, Ben Wilson -> 0.2
-      double gain = 0.2 / static_cast<double>(num_strings);
+      real_t gain = 0.2 / static_cast<real_t>(num_strings);
       for (size_t i = 0; i < size; ++i) {
-        double sum = out_buffer_[i] - aux_buffer_[i];
+        real_t sum = out_buffer_[i] - aux_buffer_[i];
         sympathetic_resonator_input_[i] = gain * sum;
       }
     }
@@ -479,9 +480,9 @@ const int32_t kPingPattern[] = {
 void Part::Process(
     const PerformanceState& performance_state,
     const Patch& patch,
-    const double* in,
-    double* out,
-    double* aux,
+    const real_t* in,
+    real_t* out,
+    real_t* aux,
     size_t size) {
 
   // Copy inputs to outputs when bypass mode is enabled.
@@ -517,17 +518,17 @@ void Part::Process(
   for (int32_t voice = 0; voice < polyphony_; ++voice) {
     // Compute MIDI note value, frequency, and cutoff frequency for excitation
     // filter.
-    double cutoff = patch.brightness * (2.0 - patch.brightness);
-    double note = note_[voice] + performance_state.tonic + performance_state.fm;
+    real_t cutoff = patch.brightness * (2.0 - patch.brightness);
+    real_t note = note_[voice] + performance_state.tonic + performance_state.fm;
 
-    double frequency = SemitonesToRatio(note - 69.0) * a3_;
-    double filter_cutoff_range = performance_state.internal_exciter
+    real_t frequency = SemitonesToRatio(note - 69.0) * a3_;
+    real_t filter_cutoff_range = performance_state.internal_exciter
       ? frequency * SemitonesToRatio((cutoff - 0.5) * 96.0)
       : 0.4 * SemitonesToRatio((cutoff - 1.0) * 108.0);
-    double filter_cutoff = min(voice == active_voice_
+    real_t filter_cutoff = min(voice == active_voice_
       ? filter_cutoff_range
       : (10.0 / sr_), 0.499);
-    double filter_q = performance_state.internal_exciter ? 1.5 : 0.8;
+    real_t filter_q = performance_state.internal_exciter ? 1.5 : 0.8;
 
       
     // Process input with excitation filter. Inactive voices receive silence.
@@ -558,7 +559,7 @@ void Part::Process(
       }
     } else {
       // Dispatch odd/even voices to individual outputs.
-      double* destination = voice & 1 ? aux : out;
+      real_t* destination = voice & 1 ? aux : out;
       for (size_t i = 0; i < size; ++i) {
         destination[i] += out_buffer_[i] - aux_buffer_[i];
       }
@@ -567,8 +568,8 @@ void Part::Process(
   
   if (model_ == RESONATOR_MODEL_STRING_AND_REVERB) {
     for (size_t i = 0; i < size; ++i) {
-      double l = out[i];
-      double r = aux[i];
+      real_t l = out[i];
+      real_t r = aux[i];
       out[i] = l * patch.position + (1.0 - patch.position) * r;
       aux[i] = r * patch.position + (1.0 - patch.position) * l;
     }
@@ -588,7 +589,7 @@ void Part::Process(
 }
 
 /* static */
-double Part::model_gains_[] = {
+real_t Part::model_gains_[] = {
   1.4,  // RESONATOR_MODEL_MODAL
   1.0,  // RESONATOR_MODEL_SYMPATHETIC_STRING
   1.4,  // RESONATOR_MODEL_STRING
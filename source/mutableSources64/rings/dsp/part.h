@@ -70,14 +70,14 @@ class Part {
   Part() { }
   ~Part() { }
   
-  void Init(uint16_t* reverb_buffer);
+  void Init(uint16_t* reverb_buffer, const Dsp& dsp);
   
   void Process(
       const PerformanceState& performance_state,
       const Patch& patch,
-      const double* in,
-      double* out,
-      double* aux,
+      const real_t* in,
+      real_t* out,
+      real_t* aux,
       size_t size);
 
   inline bool bypass() const { return bypass_; }
@@ -100,6 +100,8 @@ class Part {
       dirty_ = true;
     }
   }
+  
+  inline const Dsp& dsp() const { return dsp_; }
 
  private:
   void ConfigureResonators();
@@ -107,26 +109,26 @@ class Part {
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
-      double frequency,
-      double filter_cutoff,
+      real_t frequency,
+      real_t filter_cutoff,
       size_t size);
   void RenderStringVoice(
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
-      double frequency,
-      double filter_cutoff,
+      real_t frequency,
+      real_t filter_cutoff,
       size_t size);
   void RenderFMVoice(
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
-      double frequency,
-      double filter_cutoff,
+      real_t frequency,
+      real_t filter_cutoff,
       size_t size);
   
 
-  inline double Squash(double x) const {
+  inline real_t Squash(real_t x) const {
     if (x < 0.5) {
       x *= 2.0;
       x *= x;
@@ -146,10 +148,10 @@ class Part {
   }
 
   void ComputeSympatheticStringsNotes(
-      double tonic,
-      double note,
-      double parameter,
-      double* destination,
+      real_t tonic,
+      real_t note,
+      real_t parameter,
+      real_t* destination,
       size_t num_strings);
   
   bool bypass_;
@@ -171,24 +173,25 @@ class Part {
   stmlib::DCBlocker dc_blocker_[kMaxPolyphony];
   Plucker plucker_[kMaxPolyphony];
 
-  double note_[kMaxPolyphony];
+  real_t note_[kMaxPolyphony];
   NoteFilter note_filter_;
   
-  double resonator_input_[kMaxBlockSize];
-  double sympathetic_resonator_input_[kMaxBlockSize];
-  double noise_burst_buffer_[kMaxBlockSize];
+  real_t resonator_input_[kMaxBlockSize];
+  real_t sympathetic_resonator_input_[kMaxBlockSize];
+  real_t noise_burst_buffer_[kMaxBlockSize];
   
-  double out_buffer_[kMaxBlockSize];
-  double aux_buffer_[kMaxBlockSize];
+  real_t out_buffer_[kMaxBlockSize];
+  real_t aux_buffer_[kMaxBlockSize];
   
   Reverb reverb_;
   Limiter limiter_;
   
-  static double model_gains_[RESONATOR_MODEL_LAST];
+  static real_t model_gains_[RESONATOR_MODEL_LAST];
     
     // vb
-    double sr_;
-    double a3_;
+    Dsp dsp_;
+    real_t sr_;
+    real_t a3_;
   
   DISALLOW_COPY_AND_ASSIGN(Part);
 };
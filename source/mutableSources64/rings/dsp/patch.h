@@ -32,10 +32,10 @@
 namespace rings {
 
 struct Patch {
-  double structure;
-  double brightness;
-  double damping;
-  double position;
+  real_t structure;
+  real_t brightness;
+  real_t damping;
+  real_t position;
 };
 
 }  // namespace rings
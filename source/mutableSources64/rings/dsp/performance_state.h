@@ -39,9 +39,9 @@ struct PerformanceState {
   bool internal_strum;
   bool internal_note;
 
-  double tonic;
-  double note;
-  double fm;
+  real_t tonic;
+  real_t note;
+  real_t fm;
   int32_t chord;
 };
 
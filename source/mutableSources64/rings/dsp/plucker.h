@@ -51,23 +51,23 @@ class Plucker {
     comb_filter_period_ = 0.0;
   }
   
-  void Trigger(double frequency, double cutoff, double position) {
-    double ratio = position * 0.9 + 0.05;
-    double comb_period = 1.0 / frequency * ratio;
+  void Trigger(real_t frequency, real_t cutoff, real_t position) {
+    real_t ratio = position * 0.9 + 0.05;
+    real_t comb_period = 1.0 / frequency * ratio;
     remaining_samples_ = static_cast<size_t>(comb_period);
     while (comb_period >= 255.0) {
       comb_period *= 0.5;
     }
     comb_filter_period_ = comb_period;
     comb_filter_gain_ = (1.0 - position) * 0.8;
-    svf_.set_f_q<FREQUENCY_DIRTY>(std::min(cutoff, 0.499), 1.0);
+    svf_.set_f_q<FREQUENCY_DIRTY>(std::min(cutoff, real_t(0.499)), 1.0);
   }
   
-  void Process(double* out, size_t size) {
-    const double comb_gain = comb_filter_gain_;
-    const double comb_delay = comb_filter_period_;
+  void Process(real_t* out, size_t size) {
+    const real_t comb_gain = comb_filter_gain_;
+    const real_t comb_delay = comb_filter_period_;
     for (size_t i = 0; i < size; ++i) {
-      double in = 0.0;
+      real_t in = 0.0;
       if (remaining_samples_) {
         in = 2.0 * Random::GetDouble() - 1.0;
         --remaining_samples_;
@@ -80,10 +80,10 @@ class Plucker {
 
  private:
   stmlib::Svf svf_;
-  stmlib::DelayLine<double, 256> comb_filter_;
+  stmlib::DelayLine<real_t, 256> comb_filter_;
   size_t remaining_samples_;
-  double comb_filter_period_;
-  double comb_filter_gain_;
+  real_t comb_filter_period_;
+  real_t comb_filter_gain_;
   
   DISALLOW_COPY_AND_ASSIGN(Plucker);
 };
@@ -31,6 +31,7 @@
 //#include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/cosine_oscillator.h"
 #include "stmlib/dsp/parameter_interpolator.h"
+#include "stmlib/dsp/simd.h"
 
 #include "rings/resources.h"
 
@@ -44,12 +45,10 @@ namespace rings {
 using namespace std;
 using namespace stmlib;
 
-void Resonator::Init() {
-  for (int32_t i = 0; i < kMaxModes; ++i) {
-    f_[i].Init();
-  }
+void Resonator::Init(const Dsp& dsp) {
+  f_.Init();
 
-  set_frequency(220.0 / Dsp::getSr());
+  set_frequency(220.0 / dsp.getSr());
   set_structure(0.25);
   set_brightness(0.5);
   set_damping(0.3);
@@ -59,31 +58,32 @@ void Resonator::Init() {
 }
 
 int32_t Resonator::ComputeFilters() {
-  double stiffness = Interpolate(lut_stiffness, structure_, 256.0);
-  double harmonic = frequency_;
-  double stretch_factor = 1.0;
-  double q = 500.0 * Interpolate(
+  real_t stiffness = Interpolate(lut_stiffness, structure_, 256.0);
+  real_t harmonic = frequency_;
+  real_t stretch_factor = 1.0;
+  real_t q = 500.0 * Interpolate(
       lut_4_decades,
       damping_,
       256.0);
-  double brightness_attenuation = 1.0 - structure_;
+  real_t brightness_attenuation = 1.0 - structure_;
   // Reduces the range of brightness when structure is very low, to prevent
   // clipping.
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
-  double brightness = brightness_ * (1.0 - 0.2 * brightness_attenuation);
-  double q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
-  double q_loss_damping_rate = structure_ * (2.0 - structure_) * 0.1;
+  real_t brightness = brightness_ * (1.0 - 0.2 * brightness_attenuation);
+  real_t q_loss = brightness * (2.0 - brightness) * 0.85 + 0.15;
+  real_t q_loss_damping_rate = structure_ * (2.0 - structure_) * 0.1;
   int32_t num_modes = 0;
   for (int32_t i = 0; i < min(kMaxModes, resolution_); ++i) {
-    double partial_frequency = harmonic * stretch_factor;
+    real_t partial_frequency = harmonic * stretch_factor;
     if (partial_frequency >= 0.49) {
       partial_frequency = 0.49;
     } else {
       num_modes = i + 1;
     }
-    f_[i].set_f_q<FREQUENCY_FAST>(
+    f_.set_f_q<FREQUENCY_FAST>(
+        i,
         partial_frequency,
         1.0 + partial_frequency * q);
     stretch_factor += stiffness;
@@ -103,28 +103,27 @@ int32_t Resonator::ComputeFilters() {
   return num_modes;
 }
 
-void Resonator::Process(const double* in, double* out, double* aux, size_t size) {
+void Resonator::Process(const real_t* in, real_t* out, real_t* aux, size_t size) {
   int32_t num_modes = ComputeFilters();
+  // Modes are rendered in odd/even pairs.
+  size_t num_filters = (num_modes + 1) & ~1;
   
   ParameterInterpolator position(&previous_position_, position_, size);
   while (size--) {
     CosineOscillator amplitudes;
-      double freq = position.Next();
+      real_t freq = position.Next();
 
     amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(freq);
     //amplitudes.Init<COSINE_OSCILLATOR_EXACT>(freq);
-
-    double input = *in++ * 0.125;
-    double odd = 0.0;
-    double even = 0.0;
-    amplitudes.Start();
-
-    for (int32_t i = 0; i < num_modes;) {
-      odd += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-      even += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-    }
-    *out++ = odd;
-    *aux++ = even;
+    amplitudes.Render(amplitudes_, num_filters);
+
+    real_t input = *in++ * 0.125;
+    f_.Process<FILTER_MODE_BAND_PASS>(input, band_pass_, num_filters);
+    
+    // "odd" and "even" count the modes from 1, so odd is the sum of the modes
+    // with an even index.
+    simd::DotProductEvenOdd(
+        amplitudes_, band_pass_, num_filters, out++, aux++);
   }
 }
 
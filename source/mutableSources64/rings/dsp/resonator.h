@@ -36,6 +36,7 @@
 #include "rings/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/delay_line.h"
+#include "stmlib/dsp/svf_bank.h"
 
 
 namespace rings {
@@ -47,30 +48,30 @@ class Resonator {
   Resonator() { }
   ~Resonator() { }
   
-  void Init();
+  void Init(const Dsp& dsp);
   void Process(
-      const double* in,
-      double* out,
-      double* aux,
+      const real_t* in,
+      real_t* out,
+      real_t* aux,
       size_t size);
   
-  inline void set_frequency(double frequency) {
+  inline void set_frequency(real_t frequency) {
     frequency_ = frequency;
   }
   
-  inline void set_structure(double structure) {
+  inline void set_structure(real_t structure) {
     structure_ = structure;
   }
   
-  inline void set_brightness(double brightness) {
+  inline void set_brightness(real_t brightness) {
     brightness_ = brightness;
   }
   
-  inline void set_damping(double damping) {
+  inline void set_damping(real_t damping) {
     damping_ = damping;
   }
   
-  inline void set_position(double position) {
+  inline void set_position(real_t position) {
     position_ = position;
   }
   
@@ -81,16 +82,19 @@ class Resonator {
   
  private:
   int32_t ComputeFilters();
-  double frequency_;
-  double structure_;
-  double brightness_;
-  double position_;
-  double previous_position_;
-  double damping_;
+  real_t frequency_;
+  real_t structure_;
+  real_t brightness_;
+  real_t position_;
+  real_t previous_position_;
+  real_t damping_;
   
   int32_t resolution_;
   
-  stmlib::Svf f_[kMaxModes];
+  // The modes are processed as a structure of arrays, several at a time.
+  stmlib::SvfBank<kMaxModes> f_;
+  real_t amplitudes_[kMaxModes];
+  real_t band_pass_[kMaxModes];
   
   DISALLOW_COPY_AND_ASSIGN(Resonator);
 };
@@ -57,7 +57,7 @@ class StringSynthEnvelope {
     value_ = 0.0;
   }
 
-  inline double Process(uint8_t flags) {
+  inline real_t Process(uint8_t flags) {
     if (flags & ENVELOPE_FLAG_RISING_EDGE) {
       start_value_ = segment_ == num_segments_ ? level_[0] : value_;
       segment_ = 0;
@@ -76,11 +76,11 @@ class StringSynthEnvelope {
     bool sustained = sustain_point_ && segment_ == sustain_point_ &&
         flags & ENVELOPE_FLAG_GATE;
   
-    double phase_increment = 0.0;
+    real_t phase_increment = 0.0;
     if (!sustained && !done) {
       phase_increment = rate_[segment_];
     }
-    double t = phase_;
+    real_t t = phase_;
     if (shape_[segment_] == ENVELOPE_SHAPE_QUARTIC) {
       t = 1.0 - t;
       t *= t;
@@ -93,7 +93,7 @@ class StringSynthEnvelope {
     return value_;
   }
 
-  inline void set_ad(double attack, double decay) {
+  inline void set_ad(real_t attack, real_t decay) {
     num_segments_ = 2;
     sustain_point_ = 0;
 
@@ -108,7 +108,7 @@ class StringSynthEnvelope {
     shape_[1] = ENVELOPE_SHAPE_QUARTIC;
   }
 
-  inline void set_ar(double attack, double decay) {
+  inline void set_ar(real_t attack, real_t decay) {
     num_segments_ = 2;
     sustain_point_ = 1;
 
@@ -124,14 +124,14 @@ class StringSynthEnvelope {
   }
   
  private:
-  double level_[4];
-  double rate_[4];
+  real_t level_[4];
+  real_t rate_[4];
   EnvelopeShape shape_[4];
   
   int16_t segment_;
-  double start_value_;
-  double value_;
-  double phase_;
+  real_t start_value_;
+  real_t value_;
+  real_t phase_;
   
   uint16_t num_segments_;
   uint16_t sustain_point_;
@@ -66,10 +66,10 @@ class StringSynthOscillator {
   
   template<OscillatorShape shape, bool interpolate_pitch>
   inline void Render(
-      double target_increment,
-      double target_gain,
-      double target_gain_saw,
-      double* out,
+      real_t target_increment,
+      real_t target_gain,
+      real_t target_gain_saw,
+      real_t* out,
       size_t size) {
     // Cut harmonics above 12kHz, and low-pass harmonics above 8kHz to clear
     // highs
@@ -79,7 +79,7 @@ class StringSynthOscillator {
         return;
       }
     }
-    double phase = phase_;
+    real_t phase = phase_;
     ParameterInterpolator phase_increment(
         &phase_increment_,
         target_increment,
@@ -87,36 +87,36 @@ class StringSynthOscillator {
     ParameterInterpolator gain(&gain_, target_gain, size);
     ParameterInterpolator gain_saw(&gain_saw_, target_gain_saw, size);
 
-    double next_sample = next_sample_;
-    double next_sample_saw = next_sample_saw_;
-    double filter_state = filter_state_;
+    real_t next_sample = next_sample_;
+    real_t next_sample_saw = next_sample_saw_;
+    real_t filter_state = filter_state_;
     bool high = high_;
 
     while (size--) {
-      double this_sample = next_sample;
-      double this_sample_saw = next_sample_saw;
+      real_t this_sample = next_sample;
+      real_t this_sample_saw = next_sample_saw;
       next_sample = 0.0;
       next_sample_saw = 0.0;
 
-      double increment = interpolate_pitch
+      real_t increment = interpolate_pitch
           ? phase_increment.Next()
           : target_increment;
       phase += increment;
     
-      double sample = 0.0;
-      const double pw = 0.5;
+      real_t sample = 0.0;
+      const real_t pw = 0.5;
 
       if (!high && phase >= pw) {
-        double t = (phase - pw) / increment;
+        real_t t = (phase - pw) / increment;
         this_sample += ThisBlepSample(t);
         next_sample += NextBlepSample(t);
         high = true;
       }
       if (phase >= 1.0) {
         phase -= 1.0;
-        double t = phase / increment;
-        double a = ThisBlepSample(t);
-        double b = NextBlepSample(t);
+        real_t t = phase / increment;
+        real_t a = ThisBlepSample(t);
+        real_t b = NextBlepSample(t);
         this_sample -= a;
         next_sample -= b;
         this_sample_saw -= a;
@@ -128,17 +128,17 @@ class StringSynthOscillator {
       next_sample_saw += phase;
       
       if (shape == OSCILLATOR_SHAPE_TRIANGLE) {
-        const double integrator_coefficient = increment * 0.125;
+        const real_t integrator_coefficient = increment * 0.125;
         this_sample = 64.0 * (this_sample - 0.5f);
         filter_state += integrator_coefficient * (this_sample - filter_state);
         sample = filter_state;
       } else if (shape == OSCILLATOR_SHAPE_DARK_SQUARE) {
-        const double integrator_coefficient = increment * 2.0;
+        const real_t integrator_coefficient = increment * 2.0;
         this_sample = 4.0 * (this_sample - 0.5f);
         filter_state += integrator_coefficient * (this_sample - filter_state);
         sample = filter_state;
       } else if (shape == OSCILLATOR_SHAPE_BRIGHT_SQUARE) {
-        const double integrator_coefficient = increment * 2.0;
+        const real_t integrator_coefficient = increment * 2.0;
         this_sample = 2.0 * this_sample - 1.0;
         filter_state += integrator_coefficient * (this_sample - filter_state);
         sample = (this_sample - filter_state) * 0.5;
@@ -158,22 +158,22 @@ class StringSynthOscillator {
   }
 
  private:
-  static inline double ThisBlepSample(double t) {
+  static inline real_t ThisBlepSample(real_t t) {
     return 0.5 * t * t;
   }
-  static inline double NextBlepSample(double t) {
+  static inline real_t NextBlepSample(real_t t) {
     t = 1.0 - t;
     return -0.5 * t * t;
   }
 
   bool high_;
-  double phase_;
-  double phase_increment_;
-  double next_sample_;
-  double next_sample_saw_;
-  double filter_state_;
-  double gain_;
-  double gain_saw_;
+  real_t phase_;
+  real_t phase_increment_;
+  real_t next_sample_;
+  real_t next_sample_saw_;
+  real_t filter_state_;
+  real_t gain_;
+  real_t gain_saw_;
 
   DISALLOW_COPY_AND_ASSIGN(StringSynthOscillator);
 };
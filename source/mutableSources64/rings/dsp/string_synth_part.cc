@@ -35,7 +35,8 @@ namespace rings {
 using namespace std;
 using namespace stmlib;
     
-void StringSynthPart::Init(uint16_t* reverb_buffer) {
+void StringSynthPart::Init(uint16_t* reverb_buffer, const Dsp& dsp) {
+  dsp_ = dsp;
   active_group_ = 0;
   acquisition_delay_ = 0;
 
@@ -62,7 +63,7 @@ void StringSynthPart::Init(uint16_t* reverb_buffer) {
   ensemble_.Init(reverb_buffer);
     
   note_filter_.Init(
-                    Dsp::getSr() / kMaxBlockSize,
+                    dsp_.getSr() / kMaxBlockSize,
       0.001,  // Lag time with a sharp edge on the V/Oct input or trigger.
       0.005,  // Lag time after the trigger has been received.
       0.050,  // Time to transition from reactive to filtered.
@@ -70,7 +71,7 @@ void StringSynthPart::Init(uint16_t* reverb_buffer) {
 }
 
 const int32_t kRegistrationTableSize = 11;
-const double registrations[kRegistrationTableSize][kNumHarmonics * 2] = {
+const real_t registrations[kRegistrationTableSize][kNumHarmonics * 2] = {
   { 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
   { 1.0, 1.0, 0.0, 0.0, 0.0, 0.0 },
   { 1.0, 0.0, 1.0, 0.0, 0.0, 0.0 },
@@ -85,15 +86,15 @@ const double registrations[kRegistrationTableSize][kNumHarmonics * 2] = {
 };
 
 void StringSynthPart::ComputeRegistration(
-    double gain,
-    double registration,
-    double* amplitudes) {
+    real_t gain,
+    real_t registration,
+    real_t* amplitudes) {
   registration *= (kRegistrationTableSize - 1.001);
   MAKE_INTEGRAL_FRACTIONAL(registration);
-  double total = 0.0;
+  real_t total = 0.0;
   for (int32_t i = 0; i < kNumHarmonics * 2; ++i) {
-    double a = registrations[registration_integral][i];
-    double b = registrations[registration_integral + 1][i];
+    real_t a = registrations[registration_integral][i];
+    real_t b = registrations[registration_integral + 1][i];
     amplitudes[i] = a + (b - a) * registration_fractional;
     total += amplitudes[i];
   }
@@ -108,7 +109,7 @@ void StringSynthPart::ComputeRegistration(
 // - more compact, leaving room for a bass
 // - more frequent note changes between adjacent chords.
 // - dropped fifth.
-const double chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
+const real_t chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
   {
     { -12.0, -0.01,  0.0,  0.01,  0.02, 11.99, 12.0, 24.0 }, // OCT
     { -12.0, -5.01, -5.0,  0.0,   7.0,  12.0,  19.0, 24.0 }, // 5
@@ -169,7 +170,7 @@ const double chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
 // - wider, occupies more room in the spectrum.
 // - minimum number of note changes between adjacent chords.
 // - consistant with the chord table used for the sympathetic strings model.
-const double chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
+const real_t chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
   {
     { -24.0, -12.0, 0.0, 0.01, 0.02, 11.99, 12.0, 24.0 },
     { -24.0, -12.0, 0.0, 3.0,  7.0,  10.0,  19.0, 24.0 },
@@ -227,11 +228,11 @@ const double chords[kMaxStringSynthPolyphony][kNumChords][kMaxChordSize] = {
 #endif  // BRYAN_CHORDS
 
 void StringSynthPart::ProcessEnvelopes(
-    double shape,
+    real_t shape,
     uint8_t* flags,
-    double* values) {
-  double decay = shape;
-  double attack = 0.0;
+    real_t* values) {
+  real_t decay = shape;
+  real_t attack = 0.0;
   if (shape < 0.5) {
     attack = 0.0;
   } else {
@@ -239,25 +240,25 @@ void StringSynthPart::ProcessEnvelopes(
   }
   
   // Convert the arbitrary values to actual units.
-    double period = Dsp::getSr() / kMaxBlockSize;
-  double attack_time = SemitonesToRatio(attack * 96.0) * 0.005 * period;
+    real_t period = dsp_.getSr() / kMaxBlockSize;
+  real_t attack_time = SemitonesToRatio(attack * 96.0) * 0.005 * period;
   // double decay_time = SemitonesToRatio(decay * 96.0) * 0.125f * period;
-  double decay_time = SemitonesToRatio(decay * 84.0) * 0.180 * period;
-  double attack_rate = 1.0 / attack_time;
-  double decay_rate = 1.0 / decay_time;
+  real_t decay_time = SemitonesToRatio(decay * 84.0) * 0.180 * period;
+  real_t attack_rate = 1.0 / attack_time;
+  real_t decay_rate = 1.0 / decay_time;
   
   for (int32_t i = 0; i < polyphony_; ++i) {
-    double drone = shape < 0.98 ? 0.0 : (shape - 0.98) * 55.0;
+    real_t drone = shape < 0.98 ? 0.0 : (shape - 0.98) * 55.0;
     if (drone >= 1.0) drone = 1.0;
 
     group_[i].envelope.set_ad(attack_rate, decay_rate);
-    double value = group_[i].envelope.Process(flags[i]);
+    real_t value = group_[i].envelope.Process(flags[i]);
     values[i] = value + (1.0 - value) * drone;
   }
 }
 
 const int32_t kFormantTableSize = 5;
-const double formants[kFormantTableSize][kNumFormants] = {
+const real_t formants[kFormantTableSize][kNumFormants] = {
   { 700, 1100, 2400 },
   { 500, 1300, 1700 },
   { 400, 2000, 2500 },
@@ -266,11 +267,11 @@ const double formants[kFormantTableSize][kNumFormants] = {
 };
 
 void StringSynthPart::ProcessFormantFilter(
-    double vowel,
-    double shift,
-    double resonance,
-    double* out,
-    double* aux,
+    real_t vowel,
+    real_t shift,
+    real_t resonance,
+    real_t* out,
+    real_t* aux,
     size_t size) {
   for (size_t i = 0; i < size; ++i) {
     filter_in_buffer_[i] = out[i] + aux[i];
@@ -282,16 +283,16 @@ void StringSynthPart::ProcessFormantFilter(
   MAKE_INTEGRAL_FRACTIONAL(vowel);
   
   for (int32_t i = 0; i < kNumFormants; ++i) {
-    double a = formants[vowel_integral][i];
-    double b = formants[vowel_integral + 1][i];
-    double f = a + (b - a) * vowel_fractional;
+    real_t a = formants[vowel_integral][i];
+    real_t b = formants[vowel_integral + 1][i];
+    real_t f = a + (b - a) * vowel_fractional;
     f *= shift;
-      formant_filter_[i].set_f_q<FREQUENCY_DIRTY>(f / Dsp::getSr(), resonance);
+      formant_filter_[i].set_f_q<FREQUENCY_DIRTY>(f / dsp_.getSr(), resonance);
     formant_filter_[i].Process<FILTER_MODE_BAND_PASS>(
         filter_in_buffer_,
         filter_out_buffer_,
         size);
-    const double pan = i * 0.3 + 0.2;
+    const real_t pan = i * 0.3 + 0.2;
     for (size_t j = 0; j < size; ++j) {
       out[j] += filter_out_buffer_[j] * pan * 0.5;
       aux[j] += filter_out_buffer_[j] * (1.0 - pan) * 0.5;
@@ -300,16 +301,16 @@ void StringSynthPart::ProcessFormantFilter(
 }
 
 struct ChordNote {
-  double note;
-  double amplitude;
+  real_t note;
+  real_t amplitude;
 };
 
 void StringSynthPart::Process(
     const PerformanceState& performance_state,
     const Patch& patch,
-    const double* in,
-    double* out,
-    double* aux,
+    const real_t* in,
+    real_t* out,
+    real_t* aux,
     size_t size) {
   // Assign note to a voice.
   uint8_t envelope_flags[kMaxStringSynthPolyphony];
@@ -333,7 +334,7 @@ void StringSynthPart::Process(
   }
 
   // Process envelopes.
-  double envelope_values[kMaxStringSynthPolyphony];
+  real_t envelope_values[kMaxStringSynthPolyphony];
   ProcessEnvelopes(patch.damping, envelope_flags, envelope_values);
   
   copy(&in[0], &in[size], &aux[0]);
@@ -341,7 +342,7 @@ void StringSynthPart::Process(
   int32_t chord_size = min(kStringSynthVoices / polyphony_, kMaxChordSize);
   for (int32_t group = 0; group < polyphony_; ++group) {
     ChordNote notes[kMaxChordSize];
-    double harmonics[kNumHarmonics * 2];
+    real_t harmonics[kNumHarmonics * 2];
     
     ComputeRegistration(
         envelope_values[group] * 0.25,
@@ -351,19 +352,19 @@ void StringSynthPart::Process(
     // Note enough polyphony for smooth transition between chords.
     for (int32_t i = 0; i < chord_size; ++i) {
         // TODO: 'chord' enthaelt muell!!!
-      double n = chords[polyphony_ - 1][group_[group].chord][i];
+      real_t n = chords[polyphony_ - 1][group_[group].chord][i];
       notes[i].note = n;
       notes[i].amplitude = n >= 0.0 && n <= 17.0 ? 1.0 : 0.7;
     }
 
     for (int32_t chord_note = 0; chord_note < chord_size; ++chord_note) {
-      double note = 0.0;
+      real_t note = 0.0;
       note += group_[group].tonic;
       note += performance_state.tonic;
       note += performance_state.fm;
       note += notes[chord_note].note;
       
-      double amplitudes[kNumHarmonics * 2];
+      real_t amplitudes[kNumHarmonics * 2];
       for (int32_t i = 0; i < kNumHarmonics * 2; ++i) {
         amplitudes[i] = notes[chord_note].amplitude * harmonics[i];
       }
@@ -378,7 +379,7 @@ void StringSynthPart::Process(
         amplitudes[2 * (num_harmonics - 1) + 1] += amplitudes[2 * i + 1];
       }
         //std::cout << "synth_note: " << note << "\n";
-      double frequency = SemitonesToRatio(note - 69.0) * Dsp::getA3();
+      real_t frequency = SemitonesToRatio(note - 69.0) * dsp_.getA3();
       voice_[group * chord_size + chord_note].Render(
           frequency,
           amplitudes,
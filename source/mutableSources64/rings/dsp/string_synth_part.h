@@ -63,10 +63,10 @@ enum FxType {
 };
 
 struct VoiceGroup {
-  double tonic;
+  real_t tonic;
   StringSynthEnvelope envelope;
   int32_t chord;
-  double structure;
+  real_t structure;
 };
 
 class StringSynthPart {
@@ -74,14 +74,14 @@ class StringSynthPart {
   StringSynthPart() { }
   ~StringSynthPart() { }
   
-  void Init(uint16_t* reverb_buffer);
+  void Init(uint16_t* reverb_buffer, const Dsp& dsp);
   
   void Process(
       const PerformanceState& performance_state,
       const Patch& patch,
-      const double* in,
-      double* out,
-      double* aux,
+      const real_t* in,
+      real_t* out,
+      real_t* aux,
       size_t size);
 
   inline void set_polyphony(int32_t polyphony) {
@@ -103,11 +103,11 @@ class StringSynthPart {
   }
   
  private:
-  void ProcessEnvelopes(double shape, uint8_t* flags, double* values);
-  void ComputeRegistration(double gain, double registration, double* amplitudes);
+  void ProcessEnvelopes(real_t shape, uint8_t* flags, real_t* values);
+  void ComputeRegistration(real_t gain, real_t registration, real_t* amplitudes);
 
-  void ProcessFormantFilter(double vowel, double shift, double resonance,
-                            double* out, double* aux, size_t size);
+  void ProcessFormantFilter(real_t vowel, real_t shift, real_t resonance,
+                            real_t* out, real_t* aux, size_t size);
   
   StringSynthVoice<kNumHarmonics> voice_[kStringSynthVoices];
   VoiceGroup group_[kMaxStringSynthPolyphony];
@@ -128,11 +128,13 @@ class StringSynthPart {
   
   NoteFilter note_filter_;
   
-  double filter_in_buffer_[kMaxBlockSize];
-  double filter_out_buffer_[kMaxBlockSize];
+  real_t filter_in_buffer_[kMaxBlockSize];
+  real_t filter_out_buffer_[kMaxBlockSize];
   
   bool clear_fx_;
   
+  Dsp dsp_;   // vb
+  
   DISALLOW_COPY_AND_ASSIGN(StringSynthPart);
 };
 
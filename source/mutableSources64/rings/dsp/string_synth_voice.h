@@ -48,10 +48,10 @@ class StringSynthVoice {
   }
   
   void Render(
-      double frequency,
-      const double* amplitudes,
+      real_t frequency,
+      const real_t* amplitudes,
       size_t summed_harmonics,
-      double* out,
+      real_t* out,
       size_t size) {
     oscillator_[0].template Render<OSCILLATOR_SHAPE_DARK_SQUARE, true>(
         frequency, amplitudes[0], amplitudes[1], out, size);
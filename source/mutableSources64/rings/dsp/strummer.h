@@ -43,11 +43,11 @@ class Strummer {
   Strummer() { }
   ~Strummer() { }
   
-  void Init(double ioi, double sr) {
+  void Init(real_t ioi, real_t sr, const Dsp& dsp) {
     onset_detector_.Init(
-        8.0 / Dsp::getSr(),
-        160.0 / Dsp::getSr(),
-        1600.0 / Dsp::getSr(),
+        8.0 / dsp.getSr(),
+        160.0 / dsp.getSr(),
+        1600.0 / dsp.getSr(),
         sr,
         ioi);
     inhibit_timer_ = static_cast<int32_t>(ioi * sr);
@@ -56,7 +56,7 @@ class Strummer {
   }
   
   void Process(
-      const double* in,
+      const real_t* in,
       size_t size,
       PerformanceState* performance_state) {
       
@@ -91,7 +91,7 @@ class Strummer {
   }
 
  private:
-  double previous_note_;
+  real_t previous_note_;
   int32_t inhibit_counter_;
   int32_t inhibit_timer_;
   
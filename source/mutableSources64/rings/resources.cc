@@ -44,7 +44,7 @@ namespace rings {
 //const uint32_t* lookup_table_uint32_table[] = {
 //};
 
-const double lut_sine[] = {
+const real_t lut_sine[] = {
    0.000000000e+00,  1.533980186e-03,  3.067956763e-03,  4.601926120e-03,
    6.135884649e-03,  7.669828740e-03,  9.203754782e-03,  1.073765917e-02,
    1.227153829e-02,  1.380538853e-02,  1.533920628e-02,  1.687298795e-02,
@@ -1327,7 +1327,7 @@ const double lut_sine[] = {
    9.999811753e-01,  9.999894111e-01,  9.999952938e-01,  9.999988235e-01,
    1.000000000e+00,
 };
-const double lut_4_decades[] = {
+const real_t lut_4_decades[] = {
    1.000000000e+00,  1.036632928e+00,  1.074607828e+00,  1.113973860e+00,
    1.154781985e+00,  1.197085030e+00,  1.240937761e+00,  1.286396945e+00,
    1.333521432e+00,  1.382372227e+00,  1.433012570e+00,  1.485508017e+00,
@@ -1394,7 +1394,7 @@ const double lut_4_decades[] = {
    8.659643234e+03,  8.976871324e+03,  9.305720409e+03,  9.646616199e+03,
    1.000000000e+04,
 };
-const double lut_svf_shift[] = {
+const real_t lut_svf_shift[] = {
    2.500000000e-01,  2.408119579e-01,  2.316544611e-01,  2.225575501e-01,
    2.135502761e-01,  2.046602549e-01,  1.959132760e-01,  1.873329789e-01,
    1.789406032e-01,  1.707548172e-01,  1.627916233e-01,  1.550643347e-01,
@@ -1461,7 +1461,7 @@ const double lut_svf_shift[] = {
    1.517819816e-07,  1.432631135e-07,  1.352223728e-07,  1.276329242e-07,
    1.204694386e-07,
 };
-const double lut_stiffness[] = {
+const real_t lut_stiffness[] = {
   -6.250000000e-02, -6.152343750e-02, -6.054687500e-02, -5.957031250e-02,
   -5.859375000e-02, -5.761718750e-02, -5.664062500e-02, -5.566406250e-02,
   -5.468750000e-02, -5.371093750e-02, -5.273437500e-02, -5.175781250e-02,
@@ -1528,7 +1528,7 @@ const double lut_stiffness[] = {
    1.808823654e+00,  1.884612937e+00,  1.945398753e+00,  2.000000000e+00,
    2.000000000e+00,
 };
-const double lut_fm_frequency_quantizer[] = {
+const real_t lut_fm_frequency_quantizer[] = {
   -1.200000000e+01, -1.200000000e+01, -1.200000000e+01, -1.184000000e+01,
   -1.184000000e+01, -1.184000000e+01, -1.111000000e+01, -1.038000000e+01,
   -9.650000000e+00, -8.920000000e+00, -8.190000000e+00, -7.460000000e+00,
@@ -1565,7 +1565,7 @@ const double lut_fm_frequency_quantizer[] = {
 };
 
 
-const double* lookup_table_table[] = {
+const real_t* lookup_table_table[] = {
   lut_sine,
   lut_4_decades,
   lut_svf_shift,
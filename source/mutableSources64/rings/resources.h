@@ -46,13 +46,13 @@ extern const int16_t* lookup_table_int16_table[];
 
 extern const uint32_t* lookup_table_uint32_table[];
 
-extern const double* lookup_table_table[];
+extern const real_t* lookup_table_table[];
 
-extern const double lut_sine[];
-extern const double lut_4_decades[];
-extern const double lut_svf_shift[];
-extern const double lut_stiffness[];
-extern const double lut_fm_frequency_quantizer[];
+extern const real_t lut_sine[];
+extern const real_t lut_4_decades[];
+extern const real_t lut_svf_shift[];
+extern const real_t lut_stiffness[];
+extern const real_t lut_fm_frequency_quantizer[];
 #define LUT_SINE 0
 #define LUT_SINE_SIZE 5121
 #define LUT_4_DECADES 1
@@ -37,10 +37,10 @@
 namespace rings {
 
 struct CalibrationData {
-  double pitch_offset;
-  double pitch_scale;
-  double offset[5]; //ADC_CHANNEL_NUM_OFFSETS
-  double normalization_detection_threshold;
+  real_t pitch_offset;
+  real_t pitch_scale;
+  real_t offset[5]; //ADC_CHANNEL_NUM_OFFSETS
+  real_t normalization_detection_threshold;
   uint8_t padding[4];
 };
     // TODO: is size important? (more than 40 bytes now)
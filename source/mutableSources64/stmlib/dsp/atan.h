@@ -36,17 +36,17 @@
 
 namespace stmlib {
 
-static inline uint16_t fast_atan2(double y, double x) {
+static inline uint16_t fast_atan2(real_t y, real_t x) {
   static const uint32_t sign_mask = 0x80000000;
-  static const double b = 0.596227;
-  uint32_t ux_s = sign_mask & unsafe_bit_cast<uint32_t, double>(x);
-  uint32_t uy_s = sign_mask & unsafe_bit_cast<uint32_t, double>(y);
+  static const real_t b = 0.596227;
+  uint32_t ux_s = sign_mask & unsafe_bit_cast<uint32_t, real_t>(x);
+  uint32_t uy_s = sign_mask & unsafe_bit_cast<uint32_t, real_t>(y);
   uint32_t offset = ((~ux_s & uy_s) >> 29 | ux_s >> 30) << 14;
-  double bxy_a = fabs(b * x * y);
-  double num = bxy_a + y * y;
-  double atan_1q = num / (x * x + bxy_a + num);
-  uint32_t uatan_2q = (ux_s ^ uy_s) | unsafe_bit_cast<uint32_t, double>(atan_1q);
-  return unsafe_bit_cast<double, uint32_t>(uatan_2q) * 16384 + offset;
+  real_t bxy_a = fabs(b * x * y);
+  real_t num = bxy_a + y * y;
+  real_t atan_1q = num / (x * x + bxy_a + num);
+  uint32_t uatan_2q = (ux_s ^ uy_s) | unsafe_bit_cast<uint32_t, real_t>(atan_1q);
+  return unsafe_bit_cast<real_t, uint32_t>(uatan_2q) * 16384 + offset;
 }
     /*
     static inline uint16_t fast_atan2(float y, float x) {
@@ -64,18 +64,18 @@ static inline uint16_t fast_atan2(double y, double x) {
 
 extern const uint16_t atan_lut[513];
 
-static inline uint16_t fast_atan2r(double y, double x, double* r) {
-  double squared_magnitude = x * x + y * y;
+static inline uint16_t fast_atan2r(real_t y, real_t x, real_t* r) {
+  real_t squared_magnitude = x * x + y * y;
   if (squared_magnitude == 0.0) {
     *r = 0.0;
     return 0.0;
   }
-  double rinv = fast_rsqrt_carmack(squared_magnitude);
+  real_t rinv = fast_rsqrt_carmack(squared_magnitude);
   *r = rinv * squared_magnitude;
 
   static const uint32_t sign_mask = 0x80000000;
-  uint32_t ux_s = sign_mask & unsafe_bit_cast<uint32_t, double>(x);
-  uint32_t uy_s = sign_mask & unsafe_bit_cast<uint32_t, double>(y);
+  uint32_t ux_s = sign_mask & unsafe_bit_cast<uint32_t, real_t>(x);
+  uint32_t uy_s = sign_mask & unsafe_bit_cast<uint32_t, real_t>(y);
   uint32_t quadrant = ((~ux_s & uy_s) >> 29 | ux_s >> 30);
   uint16_t angle = 0;
   x = fabs(x);
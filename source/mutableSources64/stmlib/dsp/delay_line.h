@@ -68,7 +68,7 @@ class DelayLine {
     return -write * coefficient + read;
   }
 
-  inline const T WriteRead(const T sample, double delay) {
+  inline const T WriteRead(const T sample, real_t delay) {
     Write(sample);
     return Read(delay);
   }
@@ -81,26 +81,26 @@ class DelayLine {
     return line_[(write_ptr_ + delay) % max_delay];
   }
 
-  inline const T Read(double delay) const {
+  inline const T Read(real_t delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
     const T a = line_[(write_ptr_ + delay_integral) % max_delay];
     const T b = line_[(write_ptr_ + delay_integral + 1) % max_delay];
     return a + (b - a) * delay_fractional;
   }
   
-  inline const T ReadHermite(double delay) const {
+  inline const T ReadHermite(real_t delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
     int32_t t = (write_ptr_ + delay_integral + max_delay);
     const T xm1 = line_[(t - 1) % max_delay];
     const T x0 = line_[(t) % max_delay];
     const T x1 = line_[(t + 1) % max_delay];
     const T x2 = line_[(t + 2) % max_delay];
-    const double c = (x1 - xm1) * 0.5;
-    const double v = x0 - x1;
-    const double w = c + v;
-    const double a = w + v + (x2 - x0) * 0.5;
-    const double b_neg = w + a;
-    const double f = delay_fractional;
+    const real_t c = (x1 - xm1) * 0.5;
+    const real_t v = x0 - x1;
+    const real_t w = c + v;
+    const real_t a = w + v + (x2 - x0) * 0.5;
+    const real_t b_neg = w + a;
+    const real_t f = delay_fractional;
     return (((a * f) - b_neg) * f + c) * f + x0;
   }
 
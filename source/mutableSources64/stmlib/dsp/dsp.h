@@ -38,34 +38,34 @@ namespace stmlib {
 
 #define MAKE_INTEGRAL_FRACTIONAL(x) \
   int32_t x ## _integral = static_cast<int32_t>(x); \
-  double x ## _fractional = x - static_cast<double>(x ## _integral);
+  real_t x ## _fractional = x - static_cast<real_t>(x ## _integral);
 
-inline double Interpolate(const double* table, double index, double size) {
+inline real_t Interpolate(const real_t* table, real_t index, real_t size) {
   index *= size;
   MAKE_INTEGRAL_FRACTIONAL(index)
-  double a = table[index_integral];
-  double b = table[index_integral + 1];
+  real_t a = table[index_integral];
+  real_t b = table[index_integral + 1];
   return a + (b - a) * index_fractional;
 }
 
 
-inline double InterpolateHermite(const double* table, double index, double size) {
+inline real_t InterpolateHermite(const real_t* table, real_t index, real_t size) {
   index *= size;
   MAKE_INTEGRAL_FRACTIONAL(index)
-  const double xm1 = table[index_integral - 1];
-  const double x0 = table[index_integral + 0];
-  const double x1 = table[index_integral + 1];
-  const double x2 = table[index_integral + 2];
-  const double c = (x1 - xm1) * 0.5;
-  const double v = x0 - x1;
-  const double w = c + v;
-  const double a = w + v + (x2 - x0) * 0.5;
-  const double b_neg = w + a;
-  const double f = index_fractional;
+  const real_t xm1 = table[index_integral - 1];
+  const real_t x0 = table[index_integral + 0];
+  const real_t x1 = table[index_integral + 1];
+  const real_t x2 = table[index_integral + 2];
+  const real_t c = (x1 - xm1) * 0.5;
+  const real_t v = x0 - x1;
+  const real_t w = c + v;
+  const real_t a = w + v + (x2 - x0) * 0.5;
+  const real_t b_neg = w + a;
+  const real_t f = index_fractional;
   return (((a * f) - b_neg) * f + c) * f + x0;
 }
 /*
-inline double InterpolateWrap(const float* table, float index, float size) {
+inline real_t InterpolateWrap(const float* table, float index, float size) {
   index -= static_cast<float>(static_cast<int32_t>(index));
   index *= size;
   MAKE_INTEGRAL_FRACTIONAL(index)
@@ -74,23 +74,23 @@ inline double InterpolateWrap(const float* table, float index, float size) {
   return a + (b - a) * index_fractional;
 }
   */
-inline double InterpolateWrap(const double* table, double index, double size) {
-    index -= static_cast<double>(static_cast<int32_t>(index));
+inline real_t InterpolateWrap(const real_t* table, real_t index, real_t size) {
+    index -= static_cast<real_t>(static_cast<int32_t>(index));
     index *= size;
     MAKE_INTEGRAL_FRACTIONAL(index)
-    double a = table[index_integral];
-    double b = table[index_integral + 1];
+    real_t a = table[index_integral];
+    real_t b = table[index_integral + 1];
     return a + (b - a) * index_fractional;
 }
 
 #define ONE_POLE(out, in, coefficient) out += (coefficient) * ((in) - out);
 #define SLOPE(out, in, positive, negative) { \
-  double error = (in) - out; \
+  real_t error = (in) - out; \
   out += (error > 0 ? positive : negative) * error; \
 }
 #define SLEW(out, in, delta) { \
-  double error = (in) - out; \
-  double d = (delta); \
+  real_t error = (in) - out; \
+  real_t d = (delta); \
   if (error > d) { \
     error = d; \
   } else if (error < -d) { \
@@ -99,15 +99,15 @@ inline double InterpolateWrap(const double* table, double index, double size) {
   out += error; \
 }
 
-inline double Crossfade(double a, double b, double fade) {
+inline real_t Crossfade(real_t a, real_t b, real_t fade) {
   return a + (b - a) * fade;
 }
 
-inline double SoftLimit(double x) {
+inline real_t SoftLimit(real_t x) {
   return x * (27.0 + x * x) / (27.0 + 9.0 * x * x);
 }
 
-inline double SoftClip(double x) {
+inline real_t SoftClip(real_t x) {
   if (x < -3.0) {
     return -1.0;
   } else if (x > 3.0) {
@@ -151,18 +151,18 @@ inline double SoftClip(double x) {
 #endif
   
 #ifdef TEST
-  inline double Sqrt(double x) {
+  inline real_t Sqrt(real_t x) {
     return sqrt(x);
   }
 #else
-  inline double Sqrt(double x) {
-    double result;
+  inline real_t Sqrt(real_t x) {
+    real_t result;
     __asm ("vsqrt.f32 %0, %1" : "=w" (result) : "w" (x) );
     return result;
   }
 #endif
 
-inline int16_t SoftConvert(double x) {
+inline int16_t SoftConvert(real_t x) {
   return Clip16(static_cast<int32_t>(SoftLimit(x * 0.5) * 32768.0));
 }
 
@@ -64,18 +64,18 @@ class DCBlocker {
   DCBlocker() { }
   ~DCBlocker() { }
   
-  void Init(double pole) {
+  void Init(real_t pole) {
     x_ = 0.0;
     y_ = 0.0;
     pole_ = pole;
   }
   
-  inline void Process(double* in_out, size_t size) {
-    double x = x_;
-    double y = y_;
-    const double pole = pole_;
+  inline void Process(real_t* in_out, size_t size) {
+    real_t x = x_;
+    real_t y = y_;
+    const real_t pole = pole_;
     while (size--) {
-      double old_x = x;
+      real_t old_x = x;
       x = *in_out;
       *in_out++ = y = y * pole + x - old_x;
     }
@@ -84,9 +84,9 @@ class DCBlocker {
   }
   
  private:
-  double pole_;
-  double x_;
-  double y_;
+  real_t pole_;
+  real_t x_;
+  real_t y_;
 };
 
 class OnePole {
@@ -104,31 +104,31 @@ class OnePole {
   }
   
   template<FrequencyApproximation approximation>
-  static inline double tangens(double f) {             // vb, changed from tan...
+  static inline real_t tangens(real_t f) {             // vb, changed from tan...
     if (approximation == FREQUENCY_EXACT) {
       // Clip coefficient to about 100.
       f = f < 0.497 ? f : 0.497;
       return tan(M_PI * f);
     } else if (approximation == FREQUENCY_DIRTY) {
       // Optimized for frequencies below 8kHz.
-      const double a = 3.736e-01 * M_PI_POW_3;
+      const real_t a = 3.736e-01 * M_PI_POW_3;
       return f * (M_PI + a * f * f);
     } else if (approximation == FREQUENCY_FAST) {
       // The usual tangent approximation uses 3.1755e-01 and 2.033e-01, but
       // the coefficients used here are optimized to minimize error for the
       // 16Hz to 16kHz range, with a sample rate of 48kHz.
-      const double a = 3.260e-01 * M_PI_POW_3;
-      const double b = 1.823e-01 * M_PI_POW_5;
-      double f2 = f * f;
+      const real_t a = 3.260e-01 * M_PI_POW_3;
+      const real_t b = 1.823e-01 * M_PI_POW_5;
+      real_t f2 = f * f;
       return f * (M_PI + f2 * (a + b * f2));
     } else if (approximation == FREQUENCY_ACCURATE) {
       // These coefficients don't need to be tweaked for the audio range.
-      const double a = 3.333314036e-01 * M_PI_POW_3;
-      const double b = 1.333923995e-01 * M_PI_POW_5;
-      const double c = 5.33740603e-02 * M_PI_POW_7;
-      const double d = 2.900525e-03 * M_PI_POW_9;
-      const double e = 9.5168091e-03 * M_PI_POW_11;
-      double f2 = f * f;
+      const real_t a = 3.333314036e-01 * M_PI_POW_3;
+      const real_t b = 1.333923995e-01 * M_PI_POW_5;
+      const real_t c = 5.33740603e-02 * M_PI_POW_7;
+      const real_t d = 2.900525e-03 * M_PI_POW_9;
+      const real_t e = 9.5168091e-03 * M_PI_POW_11;
+      real_t f2 = f * f;
       return f * (M_PI + f2 * (a + f2 * (b + f2 * (c + f2 * (d + f2 * e)))));
     }
   }
@@ -136,14 +136,14 @@ class OnePole {
   // Set frequency and resonance from true units. Various approximations
   // are available to avoid the cost of tanf.
   template<FrequencyApproximation approximation>
-  inline void set_f(double f) {
+  inline void set_f(real_t f) {
     g_ = tangens<approximation>(f);
     gi_ = 1.0 / (1.0 + g_);
   }
   
   template<FilterMode mode>
-  inline double Process(double in) {
-    double lp;
+  inline real_t Process(real_t in) {
+    real_t lp;
     lp = (g_ * in + state_) * gi_;
     state_ = g_ * (in - lp) + lp;
 
@@ -157,7 +157,7 @@ class OnePole {
   }
   
   template<FilterMode mode>
-  inline void Process(double* in_out, size_t size) {
+  inline void Process(real_t* in_out, size_t size) {
     while (size--) {
       *in_out = Process<mode>(*in_out);
       ++in_out;
@@ -165,9 +165,9 @@ class OnePole {
   }
   
  private:
-  double g_;
-  double gi_;
-  double state_;
+  real_t g_;
+  real_t gi_;
+  real_t state_;
   
   DISALLOW_COPY_AND_ASSIGN(OnePole);
 };
@@ -196,7 +196,7 @@ class Svf {
   }
 
   // Set all parameters from LUT.
-  inline void set_g_r_h(double g, double r, double h) {
+  inline void set_g_r_h(real_t g, real_t r, real_t h) {
     g_ = g;
     r_ = r;
     h_ = h;
@@ -204,14 +204,14 @@ class Svf {
   
   // Set frequency and resonance coefficients from LUT, adjust remaining
   // parameter.
-  inline void set_g_r(double g, double r) {
+  inline void set_g_r(real_t g, real_t r) {
     g_ = g;
     r_ = r;
     h_ = 1.0 / (1.0 + r_ * g_ + g_ * g_);
   }
 
   // Set frequency from LUT, resonance in true units, adjust the rest.
-  inline void set_g_q(double g, double resonance) {
+  inline void set_g_q(real_t g, real_t resonance) {
     g_ = g;
     r_ = 1.0 / resonance;
     h_ = 1.0 / (1.0 + r_ * g_ + g_ * g_);
@@ -220,15 +220,15 @@ class Svf {
   // Set frequency and resonance from true units. Various approximations
   // are available to avoid the cost of tanf.
   template<FrequencyApproximation approximation>
-  inline void set_f_q(double f, double resonance) {
+  inline void set_f_q(real_t f, real_t resonance) {
     g_ = OnePole::tangens<approximation>(f);
     r_ = 1.0 / resonance;
     h_ = 1.0 / (1.0 + r_ * g_ + g_ * g_);
   }
   
   template<FilterMode mode>
-  inline double Process(double in) {
-    double hp, bp, lp;
+  inline real_t Process(real_t in) {
+    real_t hp, bp, lp;
     hp = (in - r_ * state_1_ - g_ * state_1_ - state_2_) * h_;
     bp = g_ * hp + state_1_;
     state_1_ = g_ * hp + bp;
@@ -247,8 +247,8 @@ class Svf {
   }
   
   template<FilterMode mode_1, FilterMode mode_2>
-  inline void Process(double in, double* out_1, double* out_2) {
-    double hp, bp, lp;
+  inline void Process(real_t in, real_t* out_1, real_t* out_2) {
+    real_t hp, bp, lp;
     hp = (in - r_ * state_1_ - g_ * state_1_ - state_2_) * h_;
     bp = g_ * hp + state_1_;
     state_1_ = g_ * hp + bp;
@@ -277,10 +277,10 @@ class Svf {
   }
   
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
+  inline void Process(const real_t* in, real_t* out, size_t size) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
     
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
@@ -289,7 +289,7 @@ class Svf {
       lp = g_ * bp + state_2;
       state_2 = g_ * bp + lp;
     
-      double value;
+      real_t value;
       if (mode == FILTER_MODE_LOW_PASS) {
         value = lp;
       } else if (mode == FILTER_MODE_BAND_PASS) {
@@ -309,10 +309,10 @@ class Svf {
   }
   
   template<FilterMode mode>
-  inline void ProcessAdd(const double* in, double* out, size_t size, double gain) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
+  inline void ProcessAdd(const real_t* in, real_t* out, size_t size, real_t gain) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
     
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
@@ -321,7 +321,7 @@ class Svf {
       lp = g_ * bp + state_2;
       state_2 = g_ * bp + lp;
     
-      double value;
+      real_t value;
       if (mode == FILTER_MODE_LOW_PASS) {
         value = lp;
       } else if (mode == FILTER_MODE_BAND_PASS) {
@@ -341,10 +341,10 @@ class Svf {
   }
   
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size, size_t stride) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
+  inline void Process(const real_t* in, real_t* out, size_t size, size_t stride) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
     
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
@@ -353,7 +353,7 @@ class Svf {
       lp = g_ * bp + state_2;
       state_2 = g_ * bp + lp;
     
-      double value;
+      real_t value;
       if (mode == FILTER_MODE_LOW_PASS) {
         value = lp;
       } else if (mode == FILTER_MODE_BAND_PASS) {
@@ -373,16 +373,16 @@ class Svf {
   }
   
   inline void ProcessMultimode(
-      const double* in,
-      double* out,
+      const real_t* in,
+      real_t* out,
       size_t size,
-      double mode) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
-    double hp_gain = mode < 0.5 ? -mode * 2.0 : -2.0 + mode * 2.0;
-    double lp_gain = mode < 0.5 ? 1.0 - mode * 2.0 : 0.0;
-    double bp_gain = mode < 0.5 ? 0.0 : mode * 2.0 - 1.0;
+      real_t mode) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
+    real_t hp_gain = mode < 0.5 ? -mode * 2.0 : -2.0 + mode * 2.0;
+    real_t lp_gain = mode < 0.5 ? 1.0 - mode * 2.0 : 0.0;
+    real_t bp_gain = mode < 0.5 ? 0.0 : mode * 2.0 - 1.0;
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
       bp = g_ * hp + state_1;
@@ -398,16 +398,16 @@ class Svf {
   }
   
   inline void ProcessMultimodeLPtoHP(
-      const double* in,
-      double* out,
+      const real_t* in,
+      real_t* out,
       size_t size,
-      double mode) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
-    double hp_gain = std::min(-mode * 2.0 + 1.0, 0.0);
-    double bp_gain = 1.0 - 2.0 * fabs(mode - 0.5);
-    double lp_gain = std::max(1.0 - mode * 2.0, 0.0);
+      real_t mode) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
+    real_t hp_gain = std::min(-mode * 2.0 + 1.0, 0.0);
+    real_t bp_gain = 1.0 - 2.0 * fabs(mode - 0.5);
+    real_t lp_gain = std::max(1.0 - mode * 2.0, 0.0);
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
       bp = g_ * hp + state_1;
@@ -424,11 +424,11 @@ class Svf {
   
   template<FilterMode mode>
   inline void Process(
-      const double* in, double* out_1, double* out_2, size_t size,
-      double gain_1, double gain_2) {
-    double hp, bp, lp;
-    double state_1 = state_1_;
-    double state_2 = state_2_;
+      const real_t* in, real_t* out_1, real_t* out_2, size_t size,
+      real_t gain_1, real_t gain_2) {
+    real_t hp, bp, lp;
+    real_t state_1 = state_1_;
+    real_t state_2 = state_2_;
     
     while (size--) {
       hp = (*in - r_ * state_1 - g_ * state_1 - state_2) * h_;
@@ -437,7 +437,7 @@ class Svf {
       lp = g_ * bp + state_2;
       state_2 = g_ * bp + lp;
     
-      double value;
+      real_t value;
       if (mode == FILTER_MODE_LOW_PASS) {
         value = lp;
       } else if (mode == FILTER_MODE_BAND_PASS) {
@@ -460,17 +460,17 @@ class Svf {
     
     
     
-  inline double g() const { return g_; }
-  inline double r() const { return r_; }
-  inline double h() const { return h_; }
+  inline real_t g() const { return g_; }
+  inline real_t r() const { return r_; }
+  inline real_t h() const { return h_; }
   
  private:
-  double g_;
-  double r_;
-  double h_;
+  real_t g_;
+  real_t r_;
+  real_t h_;
 
-  double state_1_;
-  double state_2_;
+  real_t state_1_;
+  real_t state_2_;
   
   DISALLOW_COPY_AND_ASSIGN(Svf);
 };
@@ -495,7 +495,7 @@ class NaiveSvf {
   // Set frequency and resonance from true units. Various approximations
   // are available to avoid the cost of sinf.
   template<FrequencyApproximation approximation>
-  inline void set_f_q(double f, double resonance) {
+  inline void set_f_q(real_t f, real_t resonance) {
     f = f < 0.497 ? f : 0.497;
     if (approximation == FREQUENCY_EXACT) {
       f_ = 2.0 * sin(M_PI * f);
@@ -507,8 +507,8 @@ class NaiveSvf {
   }
   
   template<FilterMode mode>
-  inline double Process(double in) {
-    double hp, notch, bp_normalized;
+  inline real_t Process(real_t in) {
+    real_t hp, notch, bp_normalized;
     bp_normalized = bp_ * damp_;
     notch = in - bp_normalized;
     lp_ += f_ * bp_;
@@ -526,14 +526,14 @@ class NaiveSvf {
     }
   }
   
-  inline double lp() const { return lp_; }
-  inline double bp() const { return bp_; }
+  inline real_t lp() const { return lp_; }
+  inline real_t bp() const { return bp_; }
   
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size) {
-    double hp, notch, bp_normalized;
-    double lp = lp_;
-    double bp = bp_;
+  inline void Process(const real_t* in, real_t* out, size_t size) {
+    real_t hp, notch, bp_normalized;
+    real_t lp = lp_;
+    real_t bp = bp_;
     while (size--) {
       bp_normalized = bp * damp_;
       notch = *in++ - bp_normalized;
@@ -555,10 +555,10 @@ class NaiveSvf {
     bp_ = bp;
   }
   
-  inline void Split(const double* in, double* low, double* high, size_t size) {
-    double hp, notch, bp_normalized;
-    double lp = lp_;
-    double bp = bp_;
+  inline void Split(const real_t* in, real_t* low, real_t* high, size_t size) {
+    real_t hp, notch, bp_normalized;
+    real_t lp = lp_;
+    real_t bp = bp_;
     while (size--) {
       bp_normalized = bp * damp_;
       notch = *in++ - bp_normalized;
@@ -573,10 +573,10 @@ class NaiveSvf {
   }
 
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size, size_t decimate) {
-    double hp, notch, bp_normalized;
-    double lp = lp_;
-    double bp = bp_;
+  inline void Process(const real_t* in, real_t* out, size_t size, size_t decimate) {
+    real_t hp, notch, bp_normalized;
+    real_t lp = lp_;
+    real_t bp = bp_;
     size_t n = decimate - 1;
     while (size--) {
       bp_normalized = bp * damp_;
@@ -604,10 +604,10 @@ class NaiveSvf {
   }
   
  private:
-  double f_;
-  double damp_;
-  double lp_;
-  double bp_;
+  real_t f_;
+  real_t damp_;
+  real_t lp_;
+  real_t bp_;
   
   DISALLOW_COPY_AND_ASSIGN(NaiveSvf);
 };
@@ -629,19 +629,19 @@ class ModifiedSvf {
     lp_ = bp_ = 0.0;
   }
   
-  inline void set_f_fq(double f, double fq) {
+  inline void set_f_fq(real_t f, real_t fq) {
     f_ = f;
     fq_ = fq;
     x_ = 0.0;
   }
   
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size) {
-    double lp = lp_;
-    double bp = bp_;
-    double x = x_;
-    const double fq = fq_;
-    const double f = f_;
+  inline void Process(const real_t* in, real_t* out, size_t size) {
+    real_t lp = lp_;
+    real_t bp = bp_;
+    real_t x = x_;
+    const real_t fq = fq_;
+    const real_t f = f_;
     while (size--) {
       lp += f * bp;
       bp += -fq * bp -f * lp + *in;
@@ -667,11 +667,11 @@ class ModifiedSvf {
   }
   
  private:
-  double f_;
-  double fq_;
-  double x_;
-  double lp_;
-  double bp_;
+  real_t f_;
+  real_t fq_;
+  real_t x_;
+  real_t lp_;
+  real_t bp_;
   
   DISALLOW_COPY_AND_ASSIGN(ModifiedSvf);
 };
@@ -695,21 +695,21 @@ class CrossoverSvf {
     x_[1] = 0.0;
   }
   
-  inline void set_f_fq(double f, double fq) {
+  inline void set_f_fq(real_t f, real_t fq) {
     f_ = f;
     fq_ = fq;
   }
   
   template<FilterMode mode>
-  inline void Process(const double* in, double* out, size_t size) {
-    double lp_1 = lp_[0];
-    double bp_1 = bp_[0];
-    double lp_2 = lp_[1];
-    double bp_2 = bp_[1];
-    double x_1 = x_[0];
-    double x_2 = x_[1];
-    const double fq = fq_;
-    const double f = f_;
+  inline void Process(const real_t* in, real_t* out, size_t size) {
+    real_t lp_1 = lp_[0];
+    real_t bp_1 = bp_[0];
+    real_t lp_2 = lp_[1];
+    real_t bp_2 = bp_[1];
+    real_t x_1 = x_[0];
+    real_t x_2 = x_[1];
+    const real_t fq = fq_;
+    const real_t f = f_;
     while (size--) {
       lp_1 += f * bp_1;
       bp_1 += -fq * bp_1 -f * lp_1 + *in;
@@ -719,7 +719,7 @@ class CrossoverSvf {
       }
       x_1 = *in++;
       
-      double y;
+      real_t y;
       if (mode == FILTER_MODE_LOW_PASS) {
         y = lp_1 * f;
       } else if (mode == FILTER_MODE_BAND_PASS) {
@@ -757,11 +757,11 @@ class CrossoverSvf {
   }
   
  private:
-  double f_;
-  double fq_;
-  double x_[2];
-  double lp_[2];
-  double bp_[2];
+  real_t f_;
+  real_t fq_;
+  real_t x_[2];
+  real_t lp_[2];
+  real_t bp_[2];
   
   DISALLOW_COPY_AND_ASSIGN(CrossoverSvf);
 };
@@ -43,18 +43,18 @@ class HysteresisQuantizer {
     quantized_value_ = 0;
   }
 
-  inline int Process(double value, int num_steps) {
+  inline int Process(real_t value, int num_steps) {
     return Process(value, num_steps, 0.25);
   }
 
-  inline int Process(double value, int num_steps, double hysteresis) {
+  inline int Process(real_t value, int num_steps, real_t hysteresis) {
     return Process(0, value, num_steps, hysteresis);
   }
 
-  inline int Process(int base, double value, int num_steps, double hysteresis) {
-    value *= static_cast<double>(num_steps - 1);
-    value += static_cast<double>(base);
-    double hysteresis_feedback = value > static_cast<double>(quantized_value_)
+  inline int Process(int base, real_t value, int num_steps, real_t hysteresis) {
+    value *= static_cast<real_t>(num_steps - 1);
+    value += static_cast<real_t>(base);
+    real_t hysteresis_feedback = value > static_cast<real_t>(quantized_value_)
         ? -hysteresis
         : hysteresis;
     int q = static_cast<int>(value + hysteresis_feedback + 0.5);
@@ -64,7 +64,7 @@ class HysteresisQuantizer {
   }
 
   template<typename T>
-  const T& Lookup(const T* array, double value, int num_steps) {
+  const T& Lookup(const T* array, real_t value, int num_steps) {
     return array[Process(value, num_steps)];
   }
 
@@ -83,26 +83,26 @@ class HysteresisQuantizer2 {
   HysteresisQuantizer2() { }
   ~HysteresisQuantizer2() { }
 
-  void Init(int num_steps, double hysteresis, bool symmetric) {
+  void Init(int num_steps, real_t hysteresis, bool symmetric) {
     num_steps_ = num_steps;
     hysteresis_ = hysteresis;
 
-    scale_ = static_cast<double>(symmetric ? num_steps - 1 : num_steps);
+    scale_ = static_cast<real_t>(symmetric ? num_steps - 1 : num_steps);
     offset_ = symmetric ? 0.0f : -0.5f;
 
     quantized_value_ = 0;
   }
 
-  inline int Process(double value) {
+  inline int Process(real_t value) {
     return Process(0, value);
   }
 
-  inline int Process(int base, double value) {
+  inline int Process(int base, real_t value) {
     value *= scale_;
     value += offset_;
-    value += static_cast<double>(base);
+    value += static_cast<real_t>(base);
 
-    double hysteresis_sign = value > static_cast<double>(quantized_value_)
+    real_t hysteresis_sign = value > static_cast<real_t>(quantized_value_)
         ? -1.0f
         : +1.0f;
     int q = static_cast<int>(value + hysteresis_sign * hysteresis_ + 0.5f);
@@ -112,7 +112,7 @@ class HysteresisQuantizer2 {
   }
 
   template<typename T>
-  const T& Lookup(const T* array, double value) {
+  const T& Lookup(const T* array, real_t value) {
     return array[Process(value)];
   }
 
@@ -126,10 +126,10 @@ class HysteresisQuantizer2 {
 
  private:
   int num_steps_;
-  double hysteresis_;
+  real_t hysteresis_;
 
-  double scale_;
-  double offset_;
+  real_t scale_;
+  real_t offset_;
 
   int quantized_value_;
 
@@ -48,17 +48,17 @@ class Limiter {
     peak_ = 0.5;
   }
 
-  void Process(double pre_gain, double* in_out, size_t size) {
+  void Process(real_t pre_gain, real_t* in_out, size_t size) {
     while (size--) {
-      double s = *in_out * pre_gain;
+      real_t s = *in_out * pre_gain;
       SLOPE(peak_, fabs(s), 0.05, 0.00002);
-      double gain = (peak_ <= 1.0 ? 1.0 : 1.0 / peak_);
+      real_t gain = (peak_ <= 1.0 ? 1.0 : 1.0 / peak_);
       *in_out++ = s * gain * 0.8;
     }
   }
 
  private:
-  double peak_;
+  real_t peak_;
 
   DISALLOW_COPY_AND_ASSIGN(Limiter);
 };
@@ -36,11 +36,11 @@ namespace stmlib {
 class ParameterInterpolator {
  public:
   ParameterInterpolator() { }
-  ParameterInterpolator(double* state, double new_value, size_t size) {
+  ParameterInterpolator(real_t* state, real_t new_value, size_t size) {
     Init(state, new_value, size);
   }
 
-  ParameterInterpolator(double* state, double new_value, double step) {
+  ParameterInterpolator(real_t* state, real_t new_value, real_t step) {
     state_ = state;
     value_ = *state;
     increment_ = (new_value - *state) * step;
@@ -50,25 +50,25 @@ class ParameterInterpolator {
     *state_ = value_;
   }
   
-  inline void Init(double* state, double new_value, size_t size) {
+  inline void Init(real_t* state, real_t new_value, size_t size) {
     state_ = state;
     value_ = *state;
-    increment_ = (new_value - *state) / static_cast<double>(size);
+    increment_ = (new_value - *state) / static_cast<real_t>(size);
   }
 
-  inline double Next() {
+  inline real_t Next() {
     value_ += increment_;
     return value_;
   }
 
-  inline double subsample(double t) {
+  inline real_t subsample(real_t t) {
     return value_ + increment_ * t;
   }
   
  private:
-  double* state_;
-  double value_;
-  double increment_;
+  real_t* state_;
+  real_t value_;
+  real_t increment_;
 };
 
 }  // namespace stmlib
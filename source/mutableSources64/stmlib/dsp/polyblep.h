@@ -35,23 +35,23 @@
 
 namespace stmlib {
 
-inline double ThisBlepSample(double t) {
+inline real_t ThisBlepSample(real_t t) {
   return 0.5 * t * t;
 }
 
-inline double NextBlepSample(double t) {
+inline real_t NextBlepSample(real_t t) {
   t = 1.0 - t;
   return -0.5 * t * t;
 }
 
-inline double NextIntegratedBlepSample(double t) {
-  const double t1 = 0.5 * t;
-  const double t2 = t1 * t1;
-  const double t4 = t2 * t2;
+inline real_t NextIntegratedBlepSample(real_t t) {
+  const real_t t1 = 0.5 * t;
+  const real_t t2 = t1 * t1;
+  const real_t t4 = t2 * t2;
   return 0.1875 - t1 + 1.5 * t2 - t4;
 }
 
-inline double ThisIntegratedBlepSample(double t) {
+inline real_t ThisIntegratedBlepSample(real_t t) {
   return NextIntegratedBlepSample(1.0 - t);
 }
   
@@ -49,26 +49,26 @@ To unsafe_bit_cast(From from) {
 }
 
 
-static inline double fast_rsqrt_carmack(double x) {
+static inline real_t fast_rsqrt_carmack(real_t x) {
   uint32_t i;
-  double x2, y;
-  const double threehalfs = 1.5;
+  real_t x2, y;
+  const real_t threehalfs = 1.5;
   y = x;
-  i = unsafe_bit_cast<uint32_t, double>(y);
+  i = unsafe_bit_cast<uint32_t, real_t>(y);
   i = 0x5f3759df - (i >> 1);
-  y = unsafe_bit_cast<double, uint32_t>(i);
+  y = unsafe_bit_cast<real_t, uint32_t>(i);
   x2 = x * 0.5;
   y = y * (threehalfs - (x2 * y * y));
 	return y;
 }
 
-static inline double fast_rsqrt_accurate(double fp0) {
-  double _min = 1.0e-38;
-  double _1p5 = 1.5;
-  double fp1, fp2, fp3;
+static inline real_t fast_rsqrt_accurate(real_t fp0) {
+  real_t _min = 1.0e-38;
+  real_t _1p5 = 1.5;
+  real_t fp1, fp2, fp3;
 
-  uint32_t q = unsafe_bit_cast<uint32_t, double>(fp0);
-  fp2 = unsafe_bit_cast<double, uint32_t>(0x5F3997BB - ((q >> 1) & 0x3FFFFFFF));
+  uint32_t q = unsafe_bit_cast<uint32_t, real_t>(fp0);
+  fp2 = unsafe_bit_cast<real_t, uint32_t>(0x5F3997BB - ((q >> 1) & 0x3FFFFFFF));
   fp1 = _1p5 * fp0 - fp0;
   fp3 = fp2 * fp2;
   if (fp0 < _min) {
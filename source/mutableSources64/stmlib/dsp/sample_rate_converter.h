@@ -49,27 +49,27 @@ struct FilterState {
   enum {
     n = N
   };
-  inline void Push(double value) {
+  inline void Push(real_t value) {
     tail.Push(head);
     head = value;
   }
 
-  template<int32_t i> inline double Read() const {
+  template<int32_t i> inline real_t Read() const {
     return i == 0 ? head : tail.template Read<i - 1>();
   }
 
-  inline void Load(const double* x_state) {
+  inline void Load(const real_t* x_state) {
     head = x_state[0];
     tail.Load(x_state + 1);
   }
 
-  inline void Save(double* x_state) {
+  inline void Save(real_t* x_state) {
     x_state[0] = head;
     tail.Save(x_state + 1);
   }
 
  private:  
-  double head;
+  real_t head;
   FilterState<N-1> tail;
 };
 
@@ -79,23 +79,23 @@ class FilterState<1> {
   enum {
     n = 1
   };
-  inline void Push(double value) {
+  inline void Push(real_t value) {
     head = value;
   }
 
-  template<int32_t i> inline double Read() const {
+  template<int32_t i> inline real_t Read() const {
     return head;
   }
 
-  inline void Load(const double* x_state) {
+  inline void Load(const real_t* x_state) {
     head = x_state[0];
   }
 
-  inline void Save(double* x_state) {
+  inline void Save(real_t* x_state) {
     x_state[0] = head;
   }
  private:
-  double head;
+  real_t head;
 };
 
 template<int32_t N, int32_t x_stride, int32_t h_stride, int32_t mirror = 0, int32_t i = 0, int32_t h_offset = 0>
@@ -106,13 +106,13 @@ struct Accumulator {
   };
   
   template<typename IR>
-  inline double operator()(const double* x, const IR& h) const {
+  inline real_t operator()(const real_t* x, const IR& h) const {
     Accumulator<N - 1, x_stride, h_stride, mirror, i + 1, h_offset> a;
     return x[i * x_stride] * h.template Read<h_index>() + a(x, h);
   }
   
   template<int32_t NN, typename IR>
-  inline double operator()(const FilterState<NN>& x, const IR& h) const {
+  inline real_t operator()(const FilterState<NN>& x, const IR& h) const {
     Accumulator<N - 1, x_stride, h_stride, mirror, i + 1, h_offset> a;
     return x.template Read<i * x_stride>() * h.template Read<h_index>() + a(x, h);
   }
@@ -121,12 +121,12 @@ struct Accumulator {
 template<int32_t x_stride, int32_t h_stride, int32_t mirror, int32_t i, int32_t h_offset>
 struct Accumulator<0, x_stride, h_stride, mirror, i, h_offset> {
   template<typename IR>
-  inline double operator()(const double* x, const IR& h) const {
+  inline real_t operator()(const real_t* x, const IR& h) const {
     return 0.0f;
   }
 
   template<int32_t NN, typename IR>
-  inline double operator()(const FilterState<NN>& x, const IR& h) const {
+  inline real_t operator()(const FilterState<NN>& x, const IR& h) const {
     return 0.0f;
   }
 };
@@ -134,7 +134,7 @@ struct Accumulator<0, x_stride, h_stride, mirror, i, h_offset> {
 template<int32_t K, int32_t mirror = 0, int32_t remaining = K>
 struct PolyphaseStage {
   template<typename T, typename IR>
-  inline void operator()(double* &y, const T& x, const IR& h) const {
+  inline void operator()(real_t* &y, const T& x, const IR& h) const {
     Accumulator<T::n, 1, K, mirror, 0, K - remaining> a;
     *y++ = a(x, h);
     PolyphaseStage<K, mirror, remaining - 1> p;
@@ -145,7 +145,7 @@ struct PolyphaseStage {
 template<int32_t K, int32_t mirror>
 struct PolyphaseStage<K, mirror, 0> {
   template<typename T, typename IR>
-  inline void operator()(double* &y, const T& x, const IR& h) const { }
+  inline void operator()(real_t* &y, const T& x, const IR& h) const { }
 };
 
 template<
@@ -162,7 +162,7 @@ class SampleRateConverter<SRC_UP, 1, filter_size> {
   
   inline void Init() { }
   inline int32_t delay() const { return 0; }
-  inline void Process(const double* in, double* out, size_t input_size) {
+  inline void Process(const real_t* in, real_t* out, size_t input_size) {
     std::copy(&in[0], &in[input_size], &out[0]);
   }
  private:
@@ -177,7 +177,7 @@ class SampleRateConverter<SRC_DOWN, 1, filter_size> {
   
   inline void Init() { }
   inline int32_t delay() const { return 0; }
-  inline void Process(const double* in, double* out, size_t input_size) {
+  inline void Process(const real_t* in, real_t* out, size_t input_size) {
     std::copy(&in[0], &in[input_size], &out[0]);
   }
  private:
@@ -202,7 +202,7 @@ class SampleRateConverter<SRC_UP, ratio, filter_size> {
 
   inline int32_t delay() const { return filter_size / ratio / 2; }
 
-  inline void Process(const double* in, double* out, size_t input_size) {
+  inline void Process(const real_t* in, real_t* out, size_t input_size) {
     SRC_FIR<SRC_UP, ratio, filter_size> ir;
     FilterState<N> x;
     x.Load(x_);
@@ -215,7 +215,7 @@ class SampleRateConverter<SRC_UP, ratio, filter_size> {
   }
   
  private:
-  double x_[N];
+  real_t x_[N];
 
   DISALLOW_COPY_AND_ASSIGN(SampleRateConverter);
 };
@@ -239,7 +239,7 @@ class SampleRateConverter<SRC_DOWN, ratio, filter_size> {
 
   inline int32_t delay() const { return filter_size / 2; }
 
-  inline void Process(const double* in, double* out, size_t input_size) {
+  inline void Process(const real_t* in, real_t* out, size_t input_size) {
     // When downsampling, the number of input samples must be a multiple
     // of the downsampling ratio.
     if ((input_size % ratio) != 0) {
@@ -299,8 +299,8 @@ class SampleRateConverter<SRC_DOWN, ratio, filter_size> {
   }
  
  private:
-  double x_[2 * N];
-  double* x_ptr_;
+  real_t x_[2 * N];
+  real_t* x_ptr_;
 
   DISALLOW_COPY_AND_ASSIGN(SampleRateConverter);
 };
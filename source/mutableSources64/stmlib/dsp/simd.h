@@ -0,0 +1,240 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Minimal wrapper around the SIMD instructions of the target, for vectors of
+// real_t: double precision, or single precision (twice as many lanes) with
+// STMLIB_SINGLE_PRECISION. AVX is used when the code is compiled with
+// -mavx / -mavx2 (or /arch:AVX2, see the VBMI_AVX2 build option), SSE2 is
+// the baseline on x86-64 and NEON on arm64. Everything else falls back to
+// plain scalar code.
+//
+// The vector width is a compile time constant of the filter banks and the
+// oscillators built on top of it, so there is no dispatch at run time: a
+// default x86-64 build runs 2 doubles (4 floats) wide.
+//
+// Only mul, div, add and sub are used, no fused multiply-add, so each lane gives
+// exactly the same result as the scalar code it replaces.
+
+#ifndef STMLIB_DSP_SIMD_H_
+#define STMLIB_DSP_SIMD_H_
+
+#include "stmlib/stmlib.h"
+
+#if defined(__AVX__)
+  #include <immintrin.h>
+  #define STMLIB_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define STMLIB_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  #include <arm_neon.h>
+  #define STMLIB_SIMD_NEON
+#endif
+
+namespace stmlib {
+
+namespace simd {
+
+#if defined(STMLIB_SIMD_AVX) && defined(STMLIB_SINGLE_PRECISION)
+
+typedef __m256 Vector;
+const size_t kWidth = 8;
+
+inline Vector Load(const real_t* p) { return _mm256_loadu_ps(p); }
+inline void Store(real_t* p, Vector v) { _mm256_storeu_ps(p, v); }
+inline Vector Splat(real_t x) { return _mm256_set1_ps(x); }
+inline Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+inline Vector Div(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+
+#elif defined(STMLIB_SIMD_SSE2) && defined(STMLIB_SINGLE_PRECISION)
+
+typedef __m128 Vector;
+const size_t kWidth = 4;
+
+inline Vector Load(const real_t* p) { return _mm_loadu_ps(p); }
+inline void Store(real_t* p, Vector v) { _mm_storeu_ps(p, v); }
+inline Vector Splat(real_t x) { return _mm_set1_ps(x); }
+inline Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+inline Vector Div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+
+#elif defined(STMLIB_SIMD_NEON) && defined(STMLIB_SINGLE_PRECISION)
+
+typedef float32x4_t Vector;
+const size_t kWidth = 4;
+
+inline Vector Load(const real_t* p) { return vld1q_f32(p); }
+inline void Store(real_t* p, Vector v) { vst1q_f32(p, v); }
+inline Vector Splat(real_t x) { return vdupq_n_f32(x); }
+inline Vector Add(Vector a, Vector b) { return vaddq_f32(a, b); }
+inline Vector Sub(Vector a, Vector b) { return vsubq_f32(a, b); }
+inline Vector Mul(Vector a, Vector b) { return vmulq_f32(a, b); }
+inline Vector Div(Vector a, Vector b) { return vdivq_f32(a, b); }
+
+#elif defined(STMLIB_SIMD_AVX)
+
+typedef __m256d Vector;
+const size_t kWidth = 4;
+
+inline Vector Load(const real_t* p) { return _mm256_loadu_pd(p); }
+inline void Store(real_t* p, Vector v) { _mm256_storeu_pd(p, v); }
+inline Vector Splat(real_t x) { return _mm256_set1_pd(x); }
+inline Vector Add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+inline Vector Div(Vector a, Vector b) { return _mm256_div_pd(a, b); }
+
+#elif defined(STMLIB_SIMD_SSE2)
+
+typedef __m128d Vector;
+const size_t kWidth = 2;
+
+inline Vector Load(const real_t* p) { return _mm_loadu_pd(p); }
+inline void Store(real_t* p, Vector v) { _mm_storeu_pd(p, v); }
+inline Vector Splat(real_t x) { return _mm_set1_pd(x); }
+inline Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+inline Vector Div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+
+#elif defined(STMLIB_SIMD_NEON)
+
+typedef float64x2_t Vector;
+const size_t kWidth = 2;
+
+inline Vector Load(const real_t* p) { return vld1q_f64(p); }
+inline void Store(real_t* p, Vector v) { vst1q_f64(p, v); }
+inline Vector Splat(real_t x) { return vdupq_n_f64(x); }
+inline Vector Add(Vector a, Vector b) { return vaddq_f64(a, b); }
+inline Vector Sub(Vector a, Vector b) { return vsubq_f64(a, b); }
+inline Vector Mul(Vector a, Vector b) { return vmulq_f64(a, b); }
+inline Vector Div(Vector a, Vector b) { return vdivq_f64(a, b); }
+
+#else
+
+struct Vector { real_t x; };
+const size_t kWidth = 1;
+
+inline Vector Load(const real_t* p) { Vector v = { *p }; return v; }
+inline void Store(real_t* p, Vector v) { *p = v.x; }
+inline Vector Splat(real_t x) { Vector v = { x }; return v; }
+inline Vector Add(Vector a, Vector b) { Vector v = { a.x + b.x }; return v; }
+inline Vector Sub(Vector a, Vector b) { Vector v = { a.x - b.x }; return v; }
+inline Vector Mul(Vector a, Vector b) { Vector v = { a.x * b.x }; return v; }
+inline Vector Div(Vector a, Vector b) { Vector v = { a.x / b.x }; return v; }
+
+#endif  // STMLIB_SIMD_AVX
+
+// The dot products below use two accumulators per sum, so that consecutive
+// additions do not wait for each other.
+
+// Sum of a[i] * b[i] over even i in *even and over odd i in *odd. The size
+// must be even.
+inline void DotProductEvenOdd(
+    const real_t* a,
+    const real_t* b,
+    size_t size,
+    real_t* even,
+    real_t* odd) {
+  real_t lanes[2 * kWidth > 2 ? 2 * kWidth : 2] = { 0.0 };
+  size_t i = 0;
+  if (kWidth > 1) {
+    Vector acc_0 = Splat(0.0);
+    Vector acc_1 = Splat(0.0);
+    for (; i + 2 * kWidth <= size; i += 2 * kWidth) {
+      acc_0 = Add(acc_0, Mul(Load(a + i), Load(b + i)));
+      acc_1 = Add(acc_1, Mul(Load(a + i + kWidth), Load(b + i + kWidth)));
+    }
+    if (i + kWidth <= size) {
+      acc_0 = Add(acc_0, Mul(Load(a + i), Load(b + i)));
+      i += kWidth;
+    }
+    Store(lanes, Add(acc_0, acc_1));
+    for (size_t j = 2; j < kWidth; j += 2) {
+      lanes[0] += lanes[j];
+      lanes[1] += lanes[j + 1];
+    }
+  }
+  for (; i < size; i += 2) {
+    lanes[0] += a[i] * b[i];
+    lanes[1] += a[i + 1] * b[i + 1];
+  }
+  *even = lanes[0];
+  *odd = lanes[1];
+}
+
+// Sum of a[i] * b_1[i] in *sum_1 and of a[i] * b_2[i] in *sum_2, in a
+// single pass over a.
+inline void DotProduct2(
+    const real_t* a,
+    const real_t* b_1,
+    const real_t* b_2,
+    size_t size,
+    real_t* sum_1,
+    real_t* sum_2) {
+  real_t lanes_1[kWidth];
+  real_t lanes_2[kWidth];
+  size_t i = 0;
+  Vector acc_1_0 = Splat(0.0);
+  Vector acc_1_1 = Splat(0.0);
+  Vector acc_2_0 = Splat(0.0);
+  Vector acc_2_1 = Splat(0.0);
+  for (; i + 2 * kWidth <= size; i += 2 * kWidth) {
+    Vector x_0 = Load(a + i);
+    Vector x_1 = Load(a + i + kWidth);
+    acc_1_0 = Add(acc_1_0, Mul(x_0, Load(b_1 + i)));
+    acc_1_1 = Add(acc_1_1, Mul(x_1, Load(b_1 + i + kWidth)));
+    acc_2_0 = Add(acc_2_0, Mul(x_0, Load(b_2 + i)));
+    acc_2_1 = Add(acc_2_1, Mul(x_1, Load(b_2 + i + kWidth)));
+  }
+  if (i + kWidth <= size) {
+    Vector x = Load(a + i);
+    acc_1_0 = Add(acc_1_0, Mul(x, Load(b_1 + i)));
+    acc_2_0 = Add(acc_2_0, Mul(x, Load(b_2 + i)));
+    i += kWidth;
+  }
+  Store(lanes_1, Add(acc_1_0, acc_1_1));
+  Store(lanes_2, Add(acc_2_0, acc_2_1));
+  real_t s_1 = 0.0;
+  real_t s_2 = 0.0;
+  for (size_t j = 0; j < kWidth; ++j) {
+    s_1 += lanes_1[j];
+    s_2 += lanes_2[j];
+  }
+  for (; i < size; ++i) {
+    s_1 += a[i] * b_1[i];
+    s_2 += a[i] * b_2[i];
+  }
+  *sum_1 = s_1;
+  *sum_2 = s_2;
+}
+
+}  // namespace simd
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_SIMD_H_
@@ -0,0 +1,236 @@
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of SVFs stored as a structure of arrays, so that several filters are
+// processed with one SIMD instruction. Each filter computes exactly what
+// stmlib::Svf computes.
+
+#ifndef STMLIB_DSP_SVF_BANK_H_
+#define STMLIB_DSP_SVF_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "stmlib/dsp/filter.h"
+#include "stmlib/dsp/simd.h"
+
+namespace stmlib {
+
+template<size_t size>
+class SvfBank {
+ public:
+  SvfBank() { }
+  ~SvfBank() { }
+  
+  void Init() {
+    for (size_t i = 0; i < size; ++i) {
+      set_f_q<FREQUENCY_DIRTY>(i, 0.01, 100.0);
+    }
+    Reset();
+  }
+  
+  void Reset() {
+    std::fill(&state_1_[0], &state_1_[size], 0.0);
+    std::fill(&state_2_[0], &state_2_[size], 0.0);
+  }
+  
+  inline void set_g_q(size_t i, real_t g, real_t resonance) {
+    g_[i] = g;
+    r_[i] = 1.0 / resonance;
+    h_[i] = 1.0 / (1.0 + r_[i] * g + g * g);
+  }
+  
+  template<FrequencyApproximation approximation>
+  inline void set_f_q(size_t i, real_t f, real_t resonance) {
+    set_g_q(i, OnePole::tangens<approximation>(f), resonance);
+  }
+  
+  // Batched version of the above, for filters begin to end - 1, reading
+  // f[i] and resonance[i].
+  template<FrequencyApproximation approximation>
+  inline void set_f_q(
+      const real_t* f,
+      const real_t* resonance,
+      size_t begin,
+      size_t end) {
+    size_t i = begin;
+    if (approximation != FREQUENCY_EXACT) {
+      simd::Vector one = simd::Splat(1.0);
+      for (; i + simd::kWidth <= end; i += simd::kWidth) {
+        simd::Vector g = Tangens<approximation>(simd::Load(f + i));
+        simd::Vector r = simd::Div(one, simd::Load(resonance + i));
+        simd::Vector h = simd::Div(one, simd::Add(
+            simd::Add(one, simd::Mul(r, g)),
+            simd::Mul(g, g)));
+        simd::Store(g_ + i, g);
+        simd::Store(r_ + i, r);
+        simd::Store(h_ + i, h);
+      }
+    }
+    for (; i < end; ++i) {
+      set_f_q<approximation>(i, f[i], resonance[i]);
+    }
+  }
+  
+  inline real_t g(size_t i) const { return g_[i]; }
+  inline real_t r(size_t i) const { return r_[i]; }
+  
+  // Moves the filters index[0..n-1] (in increasing order), with their state,
+  // to the front of the bank, so that they can be processed as the first n
+  // filters while the others are left alone. Scatter() puts them back.
+  inline void Gather(const uint8_t* index, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      Swap(i, index[i]);
+    }
+  }
+  
+  inline void Scatter(const uint8_t* index, size_t n) {
+    while (n--) {
+      Swap(n, index[n]);
+    }
+  }
+  
+  // Feeds the same input sample to the first n filters, and writes their
+  // outputs to out[0..n-1].
+  template<FilterMode mode>
+  inline void Process(real_t in, real_t* out, size_t n) {
+    size_t i = 0;
+    simd::Vector input = simd::Splat(in);
+    for (; i + simd::kWidth <= n; i += simd::kWidth) {
+      simd::Store(out + i, ProcessVector<mode>(i, input));
+    }
+    for (; i < n; ++i) {
+      out[i] = ProcessScalar<mode>(i, in);
+    }
+  }
+  
+  // Same as above, but filter i gets its own input sample in[i].
+  template<FilterMode mode>
+  inline void Process(const real_t* in, real_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + simd::kWidth <= n; i += simd::kWidth) {
+      simd::Store(out + i, ProcessVector<mode>(i, simd::Load(in + i)));
+    }
+    for (; i < n; ++i) {
+      out[i] = ProcessScalar<mode>(i, in[i]);
+    }
+  }
+  
+ private:
+  inline void Swap(size_t i, size_t j) {
+    if (i != j) {
+      std::swap(g_[i], g_[j]);
+      std::swap(r_[i], r_[j]);
+      std::swap(h_[i], h_[j]);
+      std::swap(state_1_[i], state_1_[j]);
+      std::swap(state_2_[i], state_2_[j]);
+    }
+  }
+  
+  // Same polynomials as OnePole::tangens.
+  template<FrequencyApproximation approximation>
+  static inline simd::Vector Tangens(simd::Vector f) {
+    using namespace simd;
+    Vector f2 = Mul(f, f);
+    if (approximation == FREQUENCY_DIRTY) {
+      const real_t a = 3.736e-01 * M_PI_POW_3;
+      return Mul(f, Add(Splat(M_PI), Mul(Mul(Splat(a), f), f)));
+    } else if (approximation == FREQUENCY_FAST) {
+      const real_t a = 3.260e-01 * M_PI_POW_3;
+      const real_t b = 1.823e-01 * M_PI_POW_5;
+      return Mul(f, Add(Splat(M_PI),
+          Mul(f2, Add(Splat(a), Mul(Splat(b), f2)))));
+    } else {
+      const real_t a = 3.333314036e-01 * M_PI_POW_3;
+      const real_t b = 1.333923995e-01 * M_PI_POW_5;
+      const real_t c = 5.33740603e-02 * M_PI_POW_7;
+      const real_t d = 2.900525e-03 * M_PI_POW_9;
+      const real_t e = 9.5168091e-03 * M_PI_POW_11;
+      Vector p = Add(Splat(d), Mul(f2, Splat(e)));
+      p = Add(Splat(c), Mul(f2, p));
+      p = Add(Splat(b), Mul(f2, p));
+      p = Add(Splat(a), Mul(f2, p));
+      return Mul(f, Add(Splat(M_PI), Mul(f2, p)));
+    }
+  }
+  
+  template<FilterMode mode>
+  inline simd::Vector ProcessVector(size_t i, simd::Vector in) {
+    using namespace simd;
+    Vector g = Load(g_ + i);
+    Vector r = Load(r_ + i);
+    Vector state_1 = Load(state_1_ + i);
+    Vector state_2 = Load(state_2_ + i);
+    Vector hp = Mul(
+        Sub(Sub(Sub(in, Mul(r, state_1)), Mul(g, state_1)), state_2),
+        Load(h_ + i));
+    Vector bp = Add(Mul(g, hp), state_1);
+    Vector lp = Add(Mul(g, bp), state_2);
+    Store(state_1_ + i, Add(Mul(g, hp), bp));
+    Store(state_2_ + i, Add(Mul(g, bp), lp));
+    
+    if (mode == FILTER_MODE_LOW_PASS) {
+      return lp;
+    } else if (mode == FILTER_MODE_BAND_PASS) {
+      return bp;
+    } else if (mode == FILTER_MODE_BAND_PASS_NORMALIZED) {
+      return Mul(bp, r);
+    } else {
+      return hp;
+    }
+  }
+  
+  template<FilterMode mode>
+  inline real_t ProcessScalar(size_t i, real_t in) {
+    real_t hp, bp, lp;
+    hp = (in - r_[i] * state_1_[i] - g_[i] * state_1_[i] - state_2_[i]) * h_[i];
+    bp = g_[i] * hp + state_1_[i];
+    state_1_[i] = g_[i] * hp + bp;
+    lp = g_[i] * bp + state_2_[i];
+    state_2_[i] = g_[i] * bp + lp;
+    
+    if (mode == FILTER_MODE_LOW_PASS) {
+      return lp;
+    } else if (mode == FILTER_MODE_BAND_PASS) {
+      return bp;
+    } else if (mode == FILTER_MODE_BAND_PASS_NORMALIZED) {
+      return bp * r_[i];
+    } else {
+      return hp;
+    }
+  }
+  
+  real_t g_[size];
+  real_t r_[size];
+  real_t h_[size];
+  real_t state_1_[size];
+  real_t state_2_[size];
+  
+  DISALLOW_COPY_AND_ASSIGN(SvfBank);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_SVF_BANK_H_
@@ -35,19 +35,19 @@
 
 namespace stmlib {
 
-extern const double lut_pitch_ratio_high[257];
-extern const double lut_pitch_ratio_low[257];
+extern const real_t lut_pitch_ratio_high[257];
+extern const real_t lut_pitch_ratio_low[257];
 
-inline double SemitonesToRatio(double semitones) {
-  double pitch = semitones + 128.0;
+inline real_t SemitonesToRatio(real_t semitones) {
+  real_t pitch = semitones + 128.0;
   MAKE_INTEGRAL_FRACTIONAL(pitch)
 
   return lut_pitch_ratio_high[pitch_integral] * \
       lut_pitch_ratio_low[static_cast<int32_t>(pitch_fractional * 256.0)];
 }
 
-inline double SemitonesToRatioSafe(double semitones) {
-  double scale = 1.0;
+inline real_t SemitonesToRatioSafe(real_t semitones) {
+  real_t scale = 1.0;
   while (semitones > 120.0) {
     semitones -= 120.0;
     scale *= 1024.0;
@@ -60,7 +60,7 @@ inline double SemitonesToRatioSafe(double semitones) {
 }
 
 
-inline double Exp2Safe(double value) {
+inline real_t Exp2Safe(real_t value) {
   return SemitonesToRatioSafe(value * 12.0);
 }
 
@@ -81,6 +81,16 @@ namespace impl {
 #define IN_RAM
 #endif  // TEST
 
+// Sample type of the cores built from these sources (plaits, rings and
+// elements). They run in double precision, unless STMLIB_SINGLE_PRECISION is
+// defined (cmake -DVBMI_SINGLE_PRECISION=ON), which makes the filter states,
+// delay lines and lookup tables float again, as on the hardware.
+#ifdef STMLIB_SINGLE_PRECISION
+typedef float real_t;
+#else
+typedef double real_t;
+#endif  // STMLIB_SINGLE_PRECISION
+
 #define UNROLL2(x) x; x;
 #define UNROLL4(x) x; x; x; x;
 #define UNROLL8(x) x; x; x; x; x; x; x; x;
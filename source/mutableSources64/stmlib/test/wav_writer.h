@@ -91,10 +91,10 @@ class WavWriter {
     remaining_frames_ -= num_frames;
   }
   
-  void Write(double* out, size_t size, double gain=32767.0) {
+  void Write(real_t* out, size_t size, real_t gain=32767.0) {
     int16_t* short_buffer = (int16_t*)(calloc(size, sizeof(int16_t)));
     for (size_t i = 0; i < size; ++i) {
-      double x = out[i] * gain;
+      real_t x = out[i] * gain;
       if (x >= 32767.0) x = 32767.0;
       if (x <= -32767.0) x = -32767.0;
       short_buffer[i] = static_cast<int16_t>(x);
@@ -103,17 +103,17 @@ class WavWriter {
     remaining_frames_ -= size / num_channels_;
   }
   
-  void Write(double* l, double* r, size_t size, double gain=32767.0) {
+  void Write(real_t* l, real_t* r, size_t size, real_t gain=32767.0) {
     int16_t* short_buffer = (int16_t*)(calloc(size * 2, sizeof(int16_t)));
     for (size_t i = 0; i < size; ++i) {
       {
-        double x = l[i] * gain;
+        real_t x = l[i] * gain;
         if (x >= 32767.0) x = 32767.0;
         if (x <= -32767.0) x = -32767.0;
         short_buffer[i * 2] = static_cast<int16_t>(x);
       }
       {
-        double x = r[i] * gain;
+        real_t x = r[i] * gain;
         if (x >= 32767.0) x = 32767.0;
         if (x <= -32767.0) x = -32767.0;
         short_buffer[i * 2 + 1] = static_cast<int16_t>(x);
@@ -124,12 +124,12 @@ class WavWriter {
   }
   
   size_t remaining_frames() { return remaining_frames_; }
-  double progress() {
-    return double(remaining_frames_) / double(sample_rate_ * duration_);
+  real_t progress() {
+    return real_t(remaining_frames_) / real_t(sample_rate_ * duration_);
   }
   bool done() { return remaining_frames_ == 0; }
   
-  double triangle(size_t division = 8) {
+  real_t triangle(size_t division = 8) {
     uint16_t tri = (remaining_frames() / division);
     tri = tri > 32767 ? 65535 - tri : tri;
     return tri / 32768.0;
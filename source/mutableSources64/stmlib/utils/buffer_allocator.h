@@ -30,7 +30,6 @@
 #define STMLIB_UTILS_BUFFER_ALLOCATOR_H_
 
 #include "stmlib/stmlib.h"
-#include <iostream>
 
 namespace stmlib {
 
@@ -44,7 +43,6 @@ class BufferAllocator {
   }
   
   inline void Init(void* buffer, size_t size) {
-      std::cout << "BufferAllocator Init" << std::endl;
     buffer_ = static_cast<uint8_t*>(buffer);
     size_ = size;
     Free();
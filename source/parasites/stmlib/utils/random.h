@@ -25,10 +25,18 @@
 // -----------------------------------------------------------------------------
 //
 // Fast 16-bit pseudo random number generator.
+//
+// The generator state is per thread. A module instance that wants its own,
+// reproducible sequence keeps a uint32_t state and makes it current while it
+// renders (RandomScope), so instances on different threads neither race nor
+// share a cache line, and the output of one instance does not depend on
+// what the others do.
 
 #ifndef STMLIB_UTILS_RANDOM_H_
 #define STMLIB_UTILS_RANDOM_H_
 
+#include <atomic>
+
 #include "stmlib/stmlib.h"
 
 namespace stmlib {
@@ -41,6 +49,17 @@ class Random {
     rng_state_ = seed;
   }
 
+  // Exchanges the state of the calling thread with *state.
+  static inline void Swap(uint32_t* state) {
+    uint32_t s = rng_state_;
+    rng_state_ = *state;
+    *state = s;
+  }
+
+  // Initial state for a new instance: the first one starts where the
+  // hardware starts, the following ones at other points of the sequence.
+  static uint32_t InstanceSeed();
+
   static inline uint32_t GetWord() {
     rng_state_ = rng_state_ * 1664525L + 1013904223L;
     return state();
@@ -63,12 +82,61 @@ class Random {
   }
 
  private:
-  static uint32_t rng_state_;
+  static thread_local uint32_t rng_state_;
   static uint32_t nlog2_16(uint16_t x);
 
   DISALLOW_COPY_AND_ASSIGN(Random);
 };
 
+// A new seed for the state of an instance, sent from another thread than
+// the one rendering it (a "seed" message in Max). Writing the state directly
+// doesn't work: while the instance renders, its state is swapped into the
+// generator and RandomScope writes it back at the end. The seed is applied
+// when the next RandomScope starts, so two instances given the same seed
+// render the same output from there on. All zeros is a valid initial value.
+class PendingSeed {
+ public:
+  PendingSeed() : seed_(0), pending_(false) { }
+
+  inline void Post(uint32_t seed) {
+    seed_.store(seed, std::memory_order_relaxed);
+    pending_.store(true, std::memory_order_release);
+  }
+
+  inline void Apply(uint32_t* state) {
+    if (pending_.exchange(false, std::memory_order_acquire)) {
+      *state = seed_.load(std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::atomic<uint32_t> seed_;
+  std::atomic<bool> pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(PendingSeed);
+};
+
+// Makes the generator state of one instance current for the lifetime of the
+// scope, typically the render call of a module.
+class RandomScope {
+ public:
+  explicit RandomScope(uint32_t* state) : state_(state) {
+    Random::Swap(state_);
+  }
+  RandomScope(uint32_t* state, PendingSeed* seed) : state_(state) {
+    seed->Apply(state_);
+    Random::Swap(state_);
+  }
+  ~RandomScope() {
+    Random::Swap(state_);
+  }
+
+ private:
+  uint32_t* state_;
+
+  DISALLOW_COPY_AND_ASSIGN(RandomScope);
+};
+
 }  // namespace stmlib
 
 #endif  // STMLIB_UTILS_RANDOM_H_
@@ -34,315 +34,12 @@
 
 namespace tides {
 
-const uint16_t lut_attenuverter_curve[] = {
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      1,      3,
-       6,      9,     14,     19,
-      26,     34,     42,     52,
-      64,     76,     90,    105,
-     121,    139,    159,    179,
-     202,    226,    252,    279,
-     309,    340,    373,    407,
-     444,    483,    523,    566,
-     611,    658,    707,    758,
-     812,    868,    926,    987,
-    1050,   1116,   1184,   1254,
-    1328,   1404,   1482,   1564,
-    1648,   1735,   1825,   1917,
-    2013,   2111,   2213,   2317,
-    2425,   2536,   2649,   2767,
-    2887,   3010,   3137,   3267,
-    3401,   3537,   3678,   3821,
-    3968,   4119,   4273,   4431,
-    4592,   4757,   4925,   5098,
-    5273,   5453,   5636,   5823,
-    6014,   6209,   6407,   6610,
-    6816,   7026,   7240,   7457,
-    7679,   7905,   8134,   8368,
-    8605,   8847,   9092,   9342,
-    9595,   9853,  10114,  10379,
-   10649,  10922,  11200,  11481,
-   11766,  12056,  12349,  12646,
-   12948,  13253,  13562,  13875,
-   14192,  14513,  14838,  15166,
-   15499,  15835,  16175,  16519,
-   16867,  17218,  17573,  17931,
-   18294,  18659,  19029,  19401,
-   19778,  20157,  20541,  20927,
-   21317,  21710,  22106,  22505,
-   22908,  23313,  23722,  24133,
-   24547,  24964,  25384,  25807,
-   26232,  26660,  27090,  27522,
-   27957,  28395,  28834,  29276,
-   29719,  30165,  30612,  31062,
-   31513,  31965,  32420,  32875,
-   33332,  33791,  34250,  34711,
-   35172,  35635,  36098,  36562,
-   37027,  37492,  37958,  38424,
-   38890,  39356,  39822,  40288,
-   40754,  41220,  41685,  42149,
-   42613,  43076,  43538,  43999,
-   44459,  44917,  45375,  45831,
-   46285,  46737,  47188,  47636,
-   48083,  48527,  48969,  49409,
-   49846,  50280,  50712,  51140,
-   51566,  51988,  52407,  52823,
-   53235,  53643,  54048,  54448,
-   54845,  55238,  55626,  56010,
-   56389,  56764,  57134,  57500,
-   57860,  58215,  58565,  58910,
-   59250,  59584,  59912,  60235,
-   60552,  60863,  61168,  61467,
-   61759,  62046,  62326,  62600,
-   62867,  63128,  63381,  63628,
-   63869,  64102,  64328,  64547,
-   64759,  64964,  65162,  65352,
-   65352,
-};
-
-const uint16_t lut_slope_compression[] = {
-       0,      2,     10,     22,
-      39,     62,     89,    121,
-     158,    200,    246,    298,
-     355,    416,    482,    554,
-     630,    710,    796,    887,
-     982,   1082,   1187,   1297,
-    1411,   1530,   1654,   1782,
-    1915,   2053,   2196,   2343,
-    2494,   2650,   2811,   2976,
-    3146,   3320,   3499,   3682,
-    3869,   4061,   4257,   4457,
-    4662,   4871,   5084,   5301,
-    5522,   5748,   5977,   6211,
-    6448,   6690,   6935,   7185,
-    7438,   7695,   7956,   8220,
-    8488,   8760,   9036,   9315,
-    9597,   9883,  10173,  10466,
-   10762,  11062,  11365,  11671,
-   11980,  12292,  12608,  12926,
-   13248,  13572,  13900,  14230,
-   14563,  14899,  15237,  15578,
-   15922,  16268,  16616,  16968,
-   17321,  17677,  18035,  18395,
-   18758,  19122,  19489,  19857,
-   20228,  20600,  20975,  21351,
-   21728,  22108,  22489,  22872,
-   23256,  23641,  24028,  24416,
-   24806,  25196,  25588,  25981,
-   26375,  26770,  27166,  27562,
-   27960,  28358,  28756,  29156,
-   29556,  29956,  30357,  30758,
-   31160,  31561,  31963,  32365,
-   32768,  33170,  33572,  33974,
-   34375,  34777,  35178,  35579,
-   35979,  36379,  36779,  37177,
-   37575,  37973,  38369,  38765,
-   39160,  39554,  39947,  40339,
-   40729,  41119,  41507,  41894,
-   42279,  42663,  43046,  43427,
-   43807,  44184,  44560,  44935,
-   45307,  45678,  46046,  46413,
-   46777,  47140,  47500,  47858,
-   48214,  48567,  48919,  49267,
-   49613,  49957,  50298,  50636,
-   50972,  51305,  51635,  51963,
-   52287,  52609,  52927,  53243,
-   53555,  53864,  54170,  54473,
-   54773,  55069,  55362,  55652,
-   55938,  56220,  56499,  56775,
-   57047,  57315,  57579,  57840,
-   58097,  58350,  58600,  58845,
-   59087,  59324,  59558,  59787,
-   60013,  60234,  60451,  60664,
-   60873,  61078,  61278,  61474,
-   61666,  61853,  62036,  62215,
-   62389,  62559,  62724,  62885,
-   63041,  63192,  63339,  63482,
-   63620,  63753,  63881,  64005,
-   64124,  64238,  64348,  64453,
-   64553,  64648,  64739,  64825,
-   64905,  64981,  65053,  65119,
-   65180,  65237,  65289,  65335,
-   65377,  65414,  65446,  65473,
-   65496,  65513,  65525,  65533,
-   65535,
-};
-
-
-
-const uint16_t* lookup_table_table[] = {
-  lut_attenuverter_curve,
-  lut_slope_compression,
-};
-
-const uint32_t lut_increments[] = {
-  731558, 736859, 742198, 747577,
-  752994, 758450, 763946, 769482,
-  775058, 780675, 786332, 792030,
-  797769, 803550, 809373, 815238,
-  821146, 827096, 833090, 839126,
-  845207, 851332, 857501, 863715,
-  869974, 876278, 882628, 889024,
-  895466, 901955, 908491, 915074,
-  921705, 928384, 935111, 941888,
-  948713, 955588, 962512, 969487,
-  976512, 983589, 990716, 997895,
-  1005126, 1012410, 1019746, 1027136,
-  1034579, 1042076, 1049627, 1057233,
-  1064894, 1072611, 1080384, 1088213,
-  1096098, 1104041, 1112041, 1120100,
-  1128216, 1136392, 1144627, 1152921,
-  1161276, 1169691, 1178167, 1186704,
-  1195304, 1203965, 1212690, 1221477,
-  1230329, 1239244, 1248224, 1257269,
-  1266380, 1275557, 1284800, 1294110,
-  1303488, 1312933, 1322448, 1332031,
-  1341683, 1351405, 1361198, 1371062,
-  1380997, 1391005, 1401084, 1411237,
-  1421464, 1431764, 1442139, 1452590,
-  1463116,
-};
-
-const uint32_t lut_cutoff[] = {
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,      1,      1,
-       1,      1,     45,     45,
-      45,     45,     45,     63,
-      63,     63,     63,     63,
-      63,     63,     78,     90,
-      90,     90,    101,    110,
-     110,    119,    127,    127,
-     143,    150,    156,    169,
-     181,    186,    197,    212,
-     221,    235,    247,    263,
-     278,    296,    313,    332,
-     353,    373,    397,    419,
-     445,    470,    499,    529,
-     561,    593,    630,    668,
-     706,    749,    794,    840,
-     891,    943,    999,   1059,
-    1122,   1188,   1258,   1334,
-    1413,   1498,   1587,   1681,
-    1781,   1887,   1999,   2118,
-    2244,   2377,   2519,   2668,
-    2827,   2995,   3173,   3362,
-    3562,   3774,   3998,   4236,
-    4488,   4755,   5038,   5337,
-    5655,   5991,   6347,   6725,
-    7125,   7549,   7997,   8473,
-    8977,   9511,  10076,  10675,
-   11310,  11983,  12695,  13450,
-   14250,  15097,  15995,  16946,
-   17954,  19022,  20153,  21351,
-   22621,  23966,  25391,  26901,
-   28500,  30195,  31991,  33893,
-   35908,  38044,  40306,  42703,
-   45242,  47932,  50782,  53802,
-   57001,  60390,  63981,  67786,
-   71817,  76087,  80611,  85405,
-   90483,  95863, 101564, 107603,
-  114001, 120780, 127961, 135570,
-  143631, 152172, 161220, 170807,
-  180963, 191723, 203123, 215201,
-  227996, 241553, 255916, 271132,
-  287254, 304334, 322429, 341600,
-  361911, 383429, 406227, 430380,
-  455969, 483080, 511802, 542231,
-  574469, 608624, 644810, 683146,
-  723761, 766791, 812378, 860675,
-  911842, 966051, 1023482, 1084326,
-  1148786, 1217077, 1289426, 1366075,
-  1447279, 1533308, 1624449, 1721005,
-  1823297, 1931668, 2046476, 2168104,
-  2296957, 2433464, 2578079, 2731282,
-  2893583, 3065521, 3247668, 3440630,
-  3645047, 3861597, 4091001, 4334019,
-  4591457, 4864170, 5153061, 5459087,
-  5783264, 6126663, 6490422, 6875743,
-  7283901, 7716245, 8174201, 8659282,
-  9173087, 9717309, 10293741, 10904280,
-  11550932, 12235822, 12961198, 13729437,
-  14543055, 15404714, 16317229, 17283576,
-  18306906, 19390548, 20538022, 21753050,
-  23039566, 24401728, 25843931, 27370816,
-  28987288, 30698526, 32510001, 34427488,
-  36457083, 38605219, 40878683, 43284634,
-  45830623, 48524607, 51374974, 54390557,
-  57580663, 60955087, 64524134, 68298646,
-  72290020, 76510231, 80971857, 85688096,
-  90672797, 95940473, 101506328, 107386274,
-  113596952, 120155750, 127080818, 134391081,
-  142106249, 150246826, 158834114, 167890206,
-  177437985, 187501110, 198103991, 209271762,
-  221030245, 233405895, 246425744, 260117319,
-  274508556, 289627688, 305503118, 322163273,
-  339636425, 357950503, 377132861, 397210026,
-  418207412, 440148999, 463056981, 486951370,
-  511849570, 537765908, 564711129, 592691859,
-  621710027, 651762267, 682839288, 714925241,
-  747997066, 782023865, 816966279, 852775928,
-  889394893, 926755301, 964779014, 1003377455,
-  1042451608, 1081892206, 1121580136, 1161387078,
-  1201176401, 1240804296, 1280121156, 1318973173,
-  1357204102, 1394657150, 1431176900, 1466611181,
-  1500812782, 1533640882, 1564962072, 1594650825,
-  1622589272, 1648666123, 1672774558, 1694808848,
-  1714659442, 1732206071, 1747308270, 1759792343,
-  1769433290, 1775929286, 1778864857, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412, 1778979412, 1778979412, 1778979412,
-  1778979412,
-};
-
-
-
-const uint32_t* lookup_table_32_table[] = {
-  lut_increments,
-  lut_cutoff,
-};
+// vb: the tables parasites shares with the original tides (lookup tables,
+// audio rate waveshapers, wavetables) are defined once, by tides/resources.cc
+// of mutableSources32. The ones below differ or only exist here, the inline
+// namespace keeps them apart from their tides namesakes when both are linked
+// into the shared resources library.
+inline namespace parasites {
 
 const int16_t wav_sine1024[] = {
        0,    201,    402,    603,
@@ -4828,2586 +4525,6 @@ const int16_t wav_bandlimited_parabola_15[] = {
     -113,
 };
 
-const int16_t wav_inverse_tan_audio[] = {
-  -32767, -30553, -29664, -29001,
-  -28456, -27989, -27577, -27207,
-  -26872, -26564, -26280, -26016,
-  -25769, -25538, -25321, -25115,
-  -24921, -24736, -24561, -24394,
-  -24234, -24082, -23935, -23795,
-  -23661, -23532, -23407, -23288,
-  -23172, -23061, -22953, -22849,
-  -22748, -22651, -22557, -22465,
-  -22377, -22291, -22207, -22126,
-  -22047, -21970, -21896, -21823,
-  -21752, -21683, -21616, -21550,
-  -21486, -21424, -21363, -21304,
-  -21246, -21189, -21133, -21079,
-  -21026, -20974, -20923, -20873,
-  -20825, -20777, -20730, -20684,
-  -20640, -20596, -20552, -20510,
-  -20468, -20428, -20388, -20348,
-  -20310, -20272, -20235, -20198,
-  -20162, -20127, -20092, -20058,
-  -20025, -19992, -19959, -19927,
-  -19896, -19865, -19834, -19805,
-  -19775, -19746, -19717, -19689,
-  -19661, -19634, -19607, -19581,
-  -19554, -19529, -19503, -19478,
-  -19453, -19429, -19405, -19381,
-  -19358, -19334, -19312, -19289,
-  -19267, -19245, -19223, -19202,
-  -19181, -19160, -19139, -19119,
-  -19099, -19079, -19059, -19040,
-  -19021, -19002, -18983, -18965,
-  -18946, -18928, -18911, -18893,
-  -18875, -18858, -18841, -18824,
-  -18807, -18791, -18774, -18758,
-  -18742, -18726, -18711, -18695,
-  -18680, -18665, -18649, -18635,
-  -18620, -18605, -18591, -18576,
-  -18562, -18548, -18534, -18520,
-  -18507, -18493, -18480, -18467,
-  -18453, -18440, -18427, -18415,
-  -18402, -18389, -18377, -18364,
-  -18352, -18340, -18328, -18316,
-  -18304, -18293, -18281, -18269,
-  -18258, -18247, -18235, -18224,
-  -18213, -18202, -18191, -18180,
-  -18170, -18159, -18148, -18138,
-  -18128, -18117, -18107, -18097,
-  -18087, -18077, -18067, -18057,
-  -18047, -18037, -18028, -18018,
-  -18009, -17999, -17990, -17981,
-  -17971, -17962, -17953, -17944,
-  -17935, -17926, -17917, -17908,
-  -17900, -17891, -17882, -17874,
-  -17865, -17857, -17848, -17840,
-  -17832, -17823, -17815, -17807,
-  -17799, -17791, -17783, -17775,
-  -17767, -17759, -17751, -17744,
-  -17736, -17728, -17721, -17713,
-  -17706, -17698, -17691, -17683,
-  -17676, -17669, -17661, -17654,
-  -17647, -17640, -17633, -17625,
-  -17618, -17611, -17604, -17598,
-  -17591, -17584, -17577, -17570,
-  -17563, -17557, -17550, -17543,
-  -17537, -17530, -17524, -17517,
-  -17511, -17504, -17498, -17491,
-  -17485, -17479, -17472, -17466,
-  -17460, -17454, -17448, -17441,
-  -17435, -17429, -17423, -17417,
-  -17411, -17405, -17399, -17393,
-  -17387, -17381, -17376, -17370,
-  -17364, -17358, -17352, -17347,
-  -17341, -17335, -17330, -17324,
-  -17319, -17313, -17307, -17302,
-  -17296, -17291, -17285, -17280,
-  -17274, -17269, -17264, -17258,
-  -17253, -17248, -17242, -17237,
-  -17232, -17227, -17221, -17216,
-  -17211, -17206, -17201, -17195,
-  -17190, -17185, -17180, -17175,
-  -17170, -17165, -17160, -17155,
-  -17150, -17145, -17140, -17135,
-  -17130, -17125, -17121, -17116,
-  -17111, -17106, -17101, -17096,
-  -17092, -17087, -17082, -17077,
-  -17073, -17068, -17063, -17058,
-  -17054, -17049, -17045, -17040,
-  -17035, -17031, -17026, -17021,
-  -17017, -17012, -17008, -17003,
-  -16999, -16994, -16990, -16985,
-  -16981, -16976, -16972, -16967,
-  -16963, -16959, -16954, -16950,
-  -16945, -16941, -16937, -16932,
-  -16928, -16924, -16919, -16915,
-  -16911, -16907, -16902, -16898,
-  -16894, -16890, -16885, -16881,
-  -16877, -16873, -16868, -16864,
-  -16860, -16856, -16852, -16848,
-  -16843, -16839, -16835, -16831,
-  -16827, -16823, -16819, -16815,
-  -16810, -16806, -16802, -16798,
-  -16794, -16790, -16786, -16782,
-  -16778, -16774, -16770, -16766,
-  -16762, -16758, -16754, -16750,
-  -16746, -16742, -16738, -16734,
-  -16730, -16726, -16722, -16718,
-  -16715, -16711, -16707, -16703,
-  -16699, -16695, -16691, -16687,
-  -16683, -16679, -16676, -16672,
-  -16668, -16664, -16660, -16656,
-  -16652, -16649, -16645, -16641,
-  -16637, -16633, -16629, -16626,
-  -16622, -16618, -16614, -16610,
-  -16607, -16603, -16599, -16595,
-  -16592, -16588, -16584, -16580,
-  -16576, -16573, -16569, -16565,
-  -16561, -16558, -16554, -16550,
-  -16546, -16543, -16539, -16535,
-  -16531, -16528, -16524, -16520,
-  -16517, -16513, -16509, -16505,
-  -16502, -16498, -16494, -16491,
-  -16487, -16483, -16479, -16476,
-  -16472, -16468, -16465, -16461,
-  -16457, -16454, -16450, -16446,
-  -16442, -16439, -16435, -16431,
-  -16428, -16424, -16420, -16417,
-  -16413, -16409, -16406, -16402,
-  -16398, -16395, -16391, -16387,
-  -16384, -16380, -16376, -16372,
-  -16369, -16365, -16361, -16358,
-  -16354, -16350, -16347, -16343,
-  -16339, -16336, -16332, -16328,
-  -16325, -16321, -16317, -16313,
-  -16310, -16306, -16302, -16299,
-  -16295, -16291, -16288, -16284,
-  -16280, -16276, -16273, -16269,
-  -16265, -16262, -16258, -16254,
-  -16250, -16247, -16243, -16239,
-  -16236, -16232, -16228, -16224,
-  -16221, -16217, -16213, -16209,
-  -16206, -16202, -16198, -16194,
-  -16191, -16187, -16183, -16179,
-  -16175, -16172, -16168, -16164,
-  -16160, -16157, -16153, -16149,
-  -16145, -16141, -16138, -16134,
-  -16130, -16126, -16122, -16118,
-  -16115, -16111, -16107, -16103,
-  -16099, -16095, -16091, -16088,
-  -16084, -16080, -16076, -16072,
-  -16068, -16064, -16060, -16056,
-  -16052, -16049, -16045, -16041,
-  -16037, -16033, -16029, -16025,
-  -16021, -16017, -16013, -16009,
-  -16005, -16001, -15997, -15993,
-  -15989, -15985, -15981, -15977,
-  -15973, -15969, -15965, -15961,
-  -15957, -15952, -15948, -15944,
-  -15940, -15936, -15932, -15928,
-  -15924, -15919, -15915, -15911,
-  -15907, -15903, -15899, -15894,
-  -15890, -15886, -15882, -15877,
-  -15873, -15869, -15865, -15860,
-  -15856, -15852, -15848, -15843,
-  -15839, -15835, -15830, -15826,
-  -15822, -15817, -15813, -15808,
-  -15804, -15800, -15795, -15791,
-  -15786, -15782, -15777, -15773,
-  -15768, -15764, -15759, -15755,
-  -15750, -15746, -15741, -15736,
-  -15732, -15727, -15722, -15718,
-  -15713, -15709, -15704, -15699,
-  -15694, -15690, -15685, -15680,
-  -15675, -15671, -15666, -15661,
-  -15656, -15651, -15646, -15642,
-  -15637, -15632, -15627, -15622,
-  -15617, -15612, -15607, -15602,
-  -15597, -15592, -15587, -15582,
-  -15577, -15572, -15566, -15561,
-  -15556, -15551, -15546, -15540,
-  -15535, -15530, -15525, -15519,
-  -15514, -15509, -15503, -15498,
-  -15493, -15487, -15482, -15476,
-  -15471, -15465, -15460, -15454,
-  -15448, -15443, -15437, -15432,
-  -15426, -15420, -15415, -15409,
-  -15403, -15397, -15391, -15386,
-  -15380, -15374, -15368, -15362,
-  -15356, -15350, -15344, -15338,
-  -15332, -15326, -15319, -15313,
-  -15307, -15301, -15295, -15288,
-  -15282, -15276, -15269, -15263,
-  -15256, -15250, -15243, -15237,
-  -15230, -15224, -15217, -15210,
-  -15204, -15197, -15190, -15183,
-  -15176, -15169, -15163, -15156,
-  -15149, -15142, -15134, -15127,
-  -15120, -15113, -15106, -15098,
-  -15091, -15084, -15076, -15069,
-  -15061, -15054, -15046, -15039,
-  -15031, -15023, -15016, -15008,
-  -15000, -14992, -14984, -14976,
-  -14968, -14960, -14952, -14944,
-  -14935, -14927, -14919, -14910,
-  -14902, -14893, -14885, -14876,
-  -14867, -14859, -14850, -14841,
-  -14832, -14823, -14814, -14805,
-  -14796, -14786, -14777, -14768,
-  -14758, -14749, -14739, -14730,
-  -14720, -14710, -14700, -14690,
-  -14680, -14670, -14660, -14650,
-  -14639, -14629, -14619, -14608,
-  -14597, -14587, -14576, -14565,
-  -14554, -14543, -14532, -14520,
-  -14509, -14498, -14486, -14474,
-  -14463, -14451, -14439, -14427,
-  -14415, -14403, -14390, -14378,
-  -14365, -14352, -14340, -14327,
-  -14314, -14300, -14287, -14274,
-  -14260, -14247, -14233, -14219,
-  -14205, -14191, -14176, -14162,
-  -14147, -14132, -14118, -14102,
-  -14087, -14072, -14056, -14041,
-  -14025, -14009, -13993, -13976,
-  -13960, -13943, -13926, -13909,
-  -13892, -13874, -13856, -13839,
-  -13821, -13802, -13784, -13765,
-  -13746, -13727, -13708, -13688,
-  -13668, -13648, -13628, -13607,
-  -13586, -13565, -13544, -13522,
-  -13500, -13478, -13455, -13433,
-  -13409, -13386, -13362, -13338,
-  -13314, -13289, -13264, -13238,
-  -13213, -13186, -13160, -13133,
-  -13106, -13078, -13050, -13021,
-  -12992, -12962, -12933, -12902,
-  -12871, -12840, -12808, -12775,
-  -12742, -12709, -12675, -12640,
-  -12605, -12569, -12532, -12495,
-  -12457, -12419, -12379, -12339,
-  -12299, -12257, -12215, -12171,
-  -12127, -12083, -12037, -11990,
-  -11942, -11894, -11844, -11793,
-  -11741, -11688, -11634, -11578,
-  -11521, -11463, -11404, -11343,
-  -11281, -11217, -11151, -11084,
-  -11015, -10944, -10871, -10797,
-  -10720, -10641, -10560, -10476,
-  -10390, -10302, -10210, -10116,
-  -10019,  -9918,  -9814,  -9706,
-   -9595,  -9479,  -9360,  -9235,
-   -9106,  -8972,  -8832,  -8685,
-   -8533,  -8373,  -8206,  -8031,
-   -7846,  -7652,  -7446,  -7229,
-   -6998,  -6751,  -6487,  -6203,
-   -5895,  -5560,  -5190,  -4778,
-   -4311,  -3766,  -3103,  -2214,
-       0,   2214,   3103,   3766,
-    4311,   4778,   5190,   5560,
-    5895,   6203,   6487,   6751,
-    6998,   7229,   7446,   7652,
-    7846,   8031,   8206,   8373,
-    8533,   8685,   8832,   8972,
-    9106,   9235,   9360,   9479,
-    9595,   9706,   9814,   9918,
-   10019,  10116,  10210,  10302,
-   10390,  10476,  10560,  10641,
-   10720,  10797,  10871,  10944,
-   11015,  11084,  11151,  11217,
-   11281,  11343,  11404,  11463,
-   11521,  11578,  11634,  11688,
-   11741,  11793,  11844,  11894,
-   11942,  11990,  12037,  12083,
-   12127,  12171,  12215,  12257,
-   12299,  12339,  12379,  12419,
-   12457,  12495,  12532,  12569,
-   12605,  12640,  12675,  12709,
-   12742,  12775,  12808,  12840,
-   12871,  12902,  12933,  12962,
-   12992,  13021,  13050,  13078,
-   13106,  13133,  13160,  13186,
-   13213,  13238,  13264,  13289,
-   13314,  13338,  13362,  13386,
-   13409,  13433,  13455,  13478,
-   13500,  13522,  13544,  13565,
-   13586,  13607,  13628,  13648,
-   13668,  13688,  13708,  13727,
-   13746,  13765,  13784,  13802,
-   13821,  13839,  13856,  13874,
-   13892,  13909,  13926,  13943,
-   13960,  13976,  13993,  14009,
-   14025,  14041,  14056,  14072,
-   14087,  14102,  14118,  14132,
-   14147,  14162,  14176,  14191,
-   14205,  14219,  14233,  14247,
-   14260,  14274,  14287,  14300,
-   14314,  14327,  14340,  14352,
-   14365,  14378,  14390,  14403,
-   14415,  14427,  14439,  14451,
-   14463,  14474,  14486,  14498,
-   14509,  14520,  14532,  14543,
-   14554,  14565,  14576,  14587,
-   14597,  14608,  14619,  14629,
-   14639,  14650,  14660,  14670,
-   14680,  14690,  14700,  14710,
-   14720,  14730,  14739,  14749,
-   14758,  14768,  14777,  14786,
-   14796,  14805,  14814,  14823,
-   14832,  14841,  14850,  14859,
-   14867,  14876,  14885,  14893,
-   14902,  14910,  14919,  14927,
-   14935,  14944,  14952,  14960,
-   14968,  14976,  14984,  14992,
-   15000,  15008,  15016,  15023,
-   15031,  15039,  15046,  15054,
-   15061,  15069,  15076,  15084,
-   15091,  15098,  15106,  15113,
-   15120,  15127,  15134,  15142,
-   15149,  15156,  15163,  15169,
-   15176,  15183,  15190,  15197,
-   15204,  15210,  15217,  15224,
-   15230,  15237,  15243,  15250,
-   15256,  15263,  15269,  15276,
-   15282,  15288,  15295,  15301,
-   15307,  15313,  15319,  15326,
-   15332,  15338,  15344,  15350,
-   15356,  15362,  15368,  15374,
-   15380,  15386,  15391,  15397,
-   15403,  15409,  15415,  15420,
-   15426,  15432,  15437,  15443,
-   15448,  15454,  15460,  15465,
-   15471,  15476,  15482,  15487,
-   15493,  15498,  15503,  15509,
-   15514,  15519,  15525,  15530,
-   15535,  15540,  15546,  15551,
-   15556,  15561,  15566,  15572,
-   15577,  15582,  15587,  15592,
-   15597,  15602,  15607,  15612,
-   15617,  15622,  15627,  15632,
-   15637,  15642,  15646,  15651,
-   15656,  15661,  15666,  15671,
-   15675,  15680,  15685,  15690,
-   15694,  15699,  15704,  15709,
-   15713,  15718,  15722,  15727,
-   15732,  15736,  15741,  15746,
-   15750,  15755,  15759,  15764,
-   15768,  15773,  15777,  15782,
-   15786,  15791,  15795,  15800,
-   15804,  15808,  15813,  15817,
-   15822,  15826,  15830,  15835,
-   15839,  15843,  15848,  15852,
-   15856,  15860,  15865,  15869,
-   15873,  15877,  15882,  15886,
-   15890,  15894,  15899,  15903,
-   15907,  15911,  15915,  15919,
-   15924,  15928,  15932,  15936,
-   15940,  15944,  15948,  15952,
-   15957,  15961,  15965,  15969,
-   15973,  15977,  15981,  15985,
-   15989,  15993,  15997,  16001,
-   16005,  16009,  16013,  16017,
-   16021,  16025,  16029,  16033,
-   16037,  16041,  16045,  16049,
-   16052,  16056,  16060,  16064,
-   16068,  16072,  16076,  16080,
-   16084,  16088,  16091,  16095,
-   16099,  16103,  16107,  16111,
-   16115,  16118,  16122,  16126,
-   16130,  16134,  16138,  16141,
-   16145,  16149,  16153,  16157,
-   16160,  16164,  16168,  16172,
-   16175,  16179,  16183,  16187,
-   16191,  16194,  16198,  16202,
-   16206,  16209,  16213,  16217,
-   16221,  16224,  16228,  16232,
-   16236,  16239,  16243,  16247,
-   16250,  16254,  16258,  16262,
-   16265,  16269,  16273,  16276,
-   16280,  16284,  16288,  16291,
-   16295,  16299,  16302,  16306,
-   16310,  16313,  16317,  16321,
-   16325,  16328,  16332,  16336,
-   16339,  16343,  16347,  16350,
-   16354,  16358,  16361,  16365,
-   16369,  16372,  16376,  16380,
-   16384,  16387,  16391,  16395,
-   16398,  16402,  16406,  16409,
-   16413,  16417,  16420,  16424,
-   16428,  16431,  16435,  16439,
-   16442,  16446,  16450,  16454,
-   16457,  16461,  16465,  16468,
-   16472,  16476,  16479,  16483,
-   16487,  16491,  16494,  16498,
-   16502,  16505,  16509,  16513,
-   16517,  16520,  16524,  16528,
-   16531,  16535,  16539,  16543,
-   16546,  16550,  16554,  16558,
-   16561,  16565,  16569,  16573,
-   16576,  16580,  16584,  16588,
-   16592,  16595,  16599,  16603,
-   16607,  16610,  16614,  16618,
-   16622,  16626,  16629,  16633,
-   16637,  16641,  16645,  16649,
-   16652,  16656,  16660,  16664,
-   16668,  16672,  16676,  16679,
-   16683,  16687,  16691,  16695,
-   16699,  16703,  16707,  16711,
-   16715,  16718,  16722,  16726,
-   16730,  16734,  16738,  16742,
-   16746,  16750,  16754,  16758,
-   16762,  16766,  16770,  16774,
-   16778,  16782,  16786,  16790,
-   16794,  16798,  16802,  16806,
-   16810,  16815,  16819,  16823,
-   16827,  16831,  16835,  16839,
-   16843,  16848,  16852,  16856,
-   16860,  16864,  16868,  16873,
-   16877,  16881,  16885,  16890,
-   16894,  16898,  16902,  16907,
-   16911,  16915,  16919,  16924,
-   16928,  16932,  16937,  16941,
-   16945,  16950,  16954,  16959,
-   16963,  16967,  16972,  16976,
-   16981,  16985,  16990,  16994,
-   16999,  17003,  17008,  17012,
-   17017,  17021,  17026,  17031,
-   17035,  17040,  17045,  17049,
-   17054,  17058,  17063,  17068,
-   17073,  17077,  17082,  17087,
-   17092,  17096,  17101,  17106,
-   17111,  17116,  17121,  17125,
-   17130,  17135,  17140,  17145,
-   17150,  17155,  17160,  17165,
-   17170,  17175,  17180,  17185,
-   17190,  17195,  17201,  17206,
-   17211,  17216,  17221,  17227,
-   17232,  17237,  17242,  17248,
-   17253,  17258,  17264,  17269,
-   17274,  17280,  17285,  17291,
-   17296,  17302,  17307,  17313,
-   17319,  17324,  17330,  17335,
-   17341,  17347,  17352,  17358,
-   17364,  17370,  17376,  17381,
-   17387,  17393,  17399,  17405,
-   17411,  17417,  17423,  17429,
-   17435,  17441,  17448,  17454,
-   17460,  17466,  17472,  17479,
-   17485,  17491,  17498,  17504,
-   17511,  17517,  17524,  17530,
-   17537,  17543,  17550,  17557,
-   17563,  17570,  17577,  17584,
-   17591,  17598,  17604,  17611,
-   17618,  17625,  17633,  17640,
-   17647,  17654,  17661,  17669,
-   17676,  17683,  17691,  17698,
-   17706,  17713,  17721,  17728,
-   17736,  17744,  17751,  17759,
-   17767,  17775,  17783,  17791,
-   17799,  17807,  17815,  17823,
-   17832,  17840,  17848,  17857,
-   17865,  17874,  17882,  17891,
-   17900,  17908,  17917,  17926,
-   17935,  17944,  17953,  17962,
-   17971,  17981,  17990,  17999,
-   18009,  18018,  18028,  18037,
-   18047,  18057,  18067,  18077,
-   18087,  18097,  18107,  18117,
-   18128,  18138,  18148,  18159,
-   18170,  18180,  18191,  18202,
-   18213,  18224,  18235,  18247,
-   18258,  18269,  18281,  18293,
-   18304,  18316,  18328,  18340,
-   18352,  18364,  18377,  18389,
-   18402,  18415,  18427,  18440,
-   18453,  18467,  18480,  18493,
-   18507,  18520,  18534,  18548,
-   18562,  18576,  18591,  18605,
-   18620,  18635,  18649,  18665,
-   18680,  18695,  18711,  18726,
-   18742,  18758,  18774,  18791,
-   18807,  18824,  18841,  18858,
-   18875,  18893,  18911,  18928,
-   18946,  18965,  18983,  19002,
-   19021,  19040,  19059,  19079,
-   19099,  19119,  19139,  19160,
-   19181,  19202,  19223,  19245,
-   19267,  19289,  19312,  19334,
-   19358,  19381,  19405,  19429,
-   19453,  19478,  19503,  19529,
-   19554,  19581,  19607,  19634,
-   19661,  19689,  19717,  19746,
-   19775,  19805,  19834,  19865,
-   19896,  19927,  19959,  19992,
-   20025,  20058,  20092,  20127,
-   20162,  20198,  20235,  20272,
-   20310,  20348,  20388,  20428,
-   20468,  20510,  20552,  20596,
-   20640,  20684,  20730,  20777,
-   20825,  20873,  20923,  20974,
-   21026,  21079,  21133,  21189,
-   21246,  21304,  21363,  21424,
-   21486,  21550,  21616,  21683,
-   21752,  21823,  21896,  21970,
-   22047,  22126,  22207,  22291,
-   22377,  22465,  22557,  22651,
-   22748,  22849,  22953,  23061,
-   23172,  23288,  23407,  23532,
-   23661,  23795,  23935,  24082,
-   24234,  24394,  24561,  24736,
-   24921,  25115,  25321,  25538,
-   25769,  26016,  26280,  26564,
-   26872,  27207,  27577,  27989,
-   28456,  29001,  29664,  30553,
-   32767,
-};
-
-const int16_t wav_inverse_sin_audio[] = {
-  -32767, -32115, -31845, -31637,
-  -31462, -31308, -31169, -31040,
-  -30921, -30808, -30702, -30601,
-  -30504, -30412, -30322, -30236,
-  -30153, -30072, -29993, -29917,
-  -29842, -29769, -29698, -29629,
-  -29561, -29494, -29429, -29365,
-  -29302, -29240, -29179, -29119,
-  -29060, -29002, -28945, -28888,
-  -28832, -28778, -28723, -28670,
-  -28617, -28565, -28513, -28462,
-  -28411, -28361, -28312, -28263,
-  -28215, -28167, -28119, -28072,
-  -28026, -27979, -27934, -27888,
-  -27843, -27799, -27754, -27710,
-  -27667, -27624, -27581, -27538,
-  -27496, -27454, -27413, -27371,
-  -27330, -27289, -27249, -27209,
-  -27169, -27129, -27089, -27050,
-  -27011, -26973, -26934, -26896,
-  -26858, -26820, -26782, -26745,
-  -26708, -26671, -26634, -26597,
-  -26561, -26524, -26488, -26452,
-  -26417, -26381, -26346, -26311,
-  -26276, -26241, -26206, -26172,
-  -26137, -26103, -26069, -26035,
-  -26001, -25967, -25934, -25901,
-  -25867, -25834, -25801, -25768,
-  -25736, -25703, -25671, -25638,
-  -25606, -25574, -25542, -25510,
-  -25479, -25447, -25416, -25384,
-  -25353, -25322, -25291, -25260,
-  -25229, -25198, -25167, -25137,
-  -25106, -25076, -25046, -25016,
-  -24986, -24956, -24926, -24896,
-  -24866, -24837, -24807, -24778,
-  -24748, -24719, -24690, -24661,
-  -24632, -24603, -24574, -24545,
-  -24517, -24488, -24460, -24431,
-  -24403, -24374, -24346, -24318,
-  -24290, -24262, -24234, -24206,
-  -24178, -24151, -24123, -24095,
-  -24068, -24040, -24013, -23985,
-  -23958, -23931, -23904, -23877,
-  -23850, -23823, -23796, -23769,
-  -23742, -23715, -23689, -23662,
-  -23636, -23609, -23583, -23556,
-  -23530, -23504, -23477, -23451,
-  -23425, -23399, -23373, -23347,
-  -23321, -23295, -23270, -23244,
-  -23218, -23192, -23167, -23141,
-  -23116, -23090, -23065, -23039,
-  -23014, -22989, -22963, -22938,
-  -22913, -22888, -22863, -22838,
-  -22813, -22788, -22763, -22738,
-  -22713, -22689, -22664, -22639,
-  -22614, -22590, -22565, -22541,
-  -22516, -22492, -22467, -22443,
-  -22419, -22394, -22370, -22346,
-  -22322, -22297, -22273, -22249,
-  -22225, -22201, -22177, -22153,
-  -22129, -22105, -22081, -22058,
-  -22034, -22010, -21986, -21963,
-  -21939, -21915, -21892, -21868,
-  -21845, -21821, -21798, -21774,
-  -21751, -21727, -21704, -21681,
-  -21657, -21634, -21611, -21588,
-  -21565, -21541, -21518, -21495,
-  -21472, -21449, -21426, -21403,
-  -21380, -21357, -21334, -21311,
-  -21288, -21266, -21243, -21220,
-  -21197, -21174, -21152, -21129,
-  -21106, -21084, -21061, -21039,
-  -21016, -20993, -20971, -20948,
-  -20926, -20903, -20881, -20859,
-  -20836, -20814, -20792, -20769,
-  -20747, -20725, -20702, -20680,
-  -20658, -20636, -20613, -20591,
-  -20569, -20547, -20525, -20503,
-  -20481, -20459, -20437, -20415,
-  -20393, -20371, -20349, -20327,
-  -20305, -20283, -20261, -20239,
-  -20218, -20196, -20174, -20152,
-  -20130, -20109, -20087, -20065,
-  -20043, -20022, -20000, -19978,
-  -19957, -19935, -19914, -19892,
-  -19870, -19849, -19827, -19806,
-  -19784, -19763, -19741, -19720,
-  -19698, -19677, -19656, -19634,
-  -19613, -19591, -19570, -19549,
-  -19527, -19506, -19485, -19463,
-  -19442, -19421, -19400, -19378,
-  -19357, -19336, -19315, -19293,
-  -19272, -19251, -19230, -19209,
-  -19188, -19167, -19145, -19124,
-  -19103, -19082, -19061, -19040,
-  -19019, -18998, -18977, -18956,
-  -18935, -18914, -18893, -18872,
-  -18851, -18830, -18809, -18788,
-  -18767, -18746, -18725, -18705,
-  -18684, -18663, -18642, -18621,
-  -18600, -18579, -18559, -18538,
-  -18517, -18496, -18475, -18455,
-  -18434, -18413, -18392, -18372,
-  -18351, -18330, -18309, -18289,
-  -18268, -18247, -18226, -18206,
-  -18185, -18164, -18144, -18123,
-  -18102, -18082, -18061, -18041,
-  -18020, -17999, -17979, -17958,
-  -17937, -17917, -17896, -17876,
-  -17855, -17835, -17814, -17793,
-  -17773, -17752, -17732, -17711,
-  -17691, -17670, -17650, -17629,
-  -17609, -17588, -17568, -17547,
-  -17527, -17506, -17486, -17465,
-  -17445, -17424, -17404, -17383,
-  -17363, -17342, -17322, -17301,
-  -17281, -17260, -17240, -17220,
-  -17199, -17179, -17158, -17138,
-  -17117, -17097, -17077, -17056,
-  -17036, -17015, -16995, -16975,
-  -16954, -16934, -16913, -16893,
-  -16873, -16852, -16832, -16811,
-  -16791, -16771, -16750, -16730,
-  -16709, -16689, -16669, -16648,
-  -16628, -16608, -16587, -16567,
-  -16546, -16526, -16506, -16485,
-  -16465, -16445, -16424, -16404,
-  -16384, -16363, -16343, -16322,
-  -16302, -16282, -16261, -16241,
-  -16221, -16200, -16180, -16159,
-  -16139, -16119, -16098, -16078,
-  -16058, -16037, -16017, -15996,
-  -15976, -15956, -15935, -15915,
-  -15894, -15874, -15854, -15833,
-  -15813, -15792, -15772, -15752,
-  -15731, -15711, -15690, -15670,
-  -15650, -15629, -15609, -15588,
-  -15568, -15547, -15527, -15507,
-  -15486, -15466, -15445, -15425,
-  -15404, -15384, -15363, -15343,
-  -15322, -15302, -15281, -15261,
-  -15240, -15220, -15199, -15179,
-  -15158, -15138, -15117, -15097,
-  -15076, -15056, -15035, -15015,
-  -14994, -14974, -14953, -14932,
-  -14912, -14891, -14871, -14850,
-  -14830, -14809, -14788, -14768,
-  -14747, -14726, -14706, -14685,
-  -14665, -14644, -14623, -14603,
-  -14582, -14561, -14541, -14520,
-  -14499, -14478, -14458, -14437,
-  -14416, -14395, -14375, -14354,
-  -14333, -14312, -14292, -14271,
-  -14250, -14229, -14208, -14188,
-  -14167, -14146, -14125, -14104,
-  -14083, -14062, -14042, -14021,
-  -14000, -13979, -13958, -13937,
-  -13916, -13895, -13874, -13853,
-  -13832, -13811, -13790, -13769,
-  -13748, -13727, -13706, -13685,
-  -13664, -13643, -13622, -13600,
-  -13579, -13558, -13537, -13516,
-  -13495, -13474, -13452, -13431,
-  -13410, -13389, -13367, -13346,
-  -13325, -13304, -13282, -13261,
-  -13240, -13218, -13197, -13176,
-  -13154, -13133, -13111, -13090,
-  -13069, -13047, -13026, -13004,
-  -12983, -12961, -12940, -12918,
-  -12897, -12875, -12853, -12832,
-  -12810, -12789, -12767, -12745,
-  -12724, -12702, -12680, -12658,
-  -12637, -12615, -12593, -12571,
-  -12549, -12528, -12506, -12484,
-  -12462, -12440, -12418, -12396,
-  -12374, -12352, -12330, -12308,
-  -12286, -12264, -12242, -12220,
-  -12198, -12176, -12154, -12131,
-  -12109, -12087, -12065, -12042,
-  -12020, -11998, -11975, -11953,
-  -11931, -11908, -11886, -11864,
-  -11841, -11819, -11796, -11774,
-  -11751, -11728, -11706, -11683,
-  -11661, -11638, -11615, -11593,
-  -11570, -11547, -11524, -11501,
-  -11479, -11456, -11433, -11410,
-  -11387, -11364, -11341, -11318,
-  -11295, -11272, -11249, -11226,
-  -11202, -11179, -11156, -11133,
-  -11110, -11086, -11063, -11040,
-  -11016, -10993, -10969, -10946,
-  -10922, -10899, -10875, -10852,
-  -10828, -10804, -10781, -10757,
-  -10733, -10709, -10686, -10662,
-  -10638, -10614, -10590, -10566,
-  -10542, -10518, -10494, -10470,
-  -10445, -10421, -10397, -10373,
-  -10348, -10324, -10300, -10275,
-  -10251, -10226, -10202, -10177,
-  -10153, -10128, -10103, -10078,
-  -10054, -10029, -10004,  -9979,
-   -9954,  -9929,  -9904,  -9879,
-   -9854,  -9829,  -9804,  -9778,
-   -9753,  -9728,  -9702,  -9677,
-   -9651,  -9626,  -9600,  -9575,
-   -9549,  -9523,  -9497,  -9472,
-   -9446,  -9420,  -9394,  -9368,
-   -9342,  -9316,  -9290,  -9263,
-   -9237,  -9211,  -9184,  -9158,
-   -9131,  -9105,  -9078,  -9052,
-   -9025,  -8998,  -8971,  -8944,
-   -8917,  -8890,  -8863,  -8836,
-   -8809,  -8782,  -8754,  -8727,
-   -8699,  -8672,  -8644,  -8616,
-   -8589,  -8561,  -8533,  -8505,
-   -8477,  -8449,  -8421,  -8393,
-   -8364,  -8336,  -8307,  -8279,
-   -8250,  -8222,  -8193,  -8164,
-   -8135,  -8106,  -8077,  -8048,
-   -8019,  -7989,  -7960,  -7930,
-   -7901,  -7871,  -7841,  -7811,
-   -7781,  -7751,  -7721,  -7691,
-   -7661,  -7630,  -7600,  -7569,
-   -7538,  -7507,  -7476,  -7445,
-   -7414,  -7383,  -7351,  -7320,
-   -7288,  -7257,  -7225,  -7193,
-   -7161,  -7129,  -7096,  -7064,
-   -7031,  -6999,  -6966,  -6933,
-   -6900,  -6866,  -6833,  -6800,
-   -6766,  -6732,  -6698,  -6664,
-   -6630,  -6595,  -6561,  -6526,
-   -6491,  -6456,  -6421,  -6386,
-   -6350,  -6315,  -6279,  -6243,
-   -6206,  -6170,  -6133,  -6096,
-   -6059,  -6022,  -5985,  -5947,
-   -5909,  -5871,  -5833,  -5794,
-   -5756,  -5717,  -5678,  -5638,
-   -5598,  -5558,  -5518,  -5478,
-   -5437,  -5396,  -5354,  -5313,
-   -5271,  -5229,  -5186,  -5143,
-   -5100,  -5057,  -5013,  -4968,
-   -4924,  -4879,  -4833,  -4788,
-   -4741,  -4695,  -4648,  -4600,
-   -4552,  -4504,  -4455,  -4406,
-   -4356,  -4305,  -4254,  -4202,
-   -4150,  -4097,  -4044,  -3989,
-   -3935,  -3879,  -3822,  -3765,
-   -3707,  -3648,  -3588,  -3527,
-   -3465,  -3402,  -3338,  -3273,
-   -3206,  -3138,  -3069,  -2998,
-   -2925,  -2850,  -2774,  -2695,
-   -2614,  -2531,  -2445,  -2355,
-   -2263,  -2166,  -2065,  -1959,
-   -1846,  -1727,  -1598,  -1459,
-   -1305,  -1130,   -922,   -652,
-       0,    652,    922,   1130,
-    1305,   1459,   1598,   1727,
-    1846,   1959,   2065,   2166,
-    2263,   2355,   2445,   2531,
-    2614,   2695,   2774,   2850,
-    2925,   2998,   3069,   3138,
-    3206,   3273,   3338,   3402,
-    3465,   3527,   3588,   3648,
-    3707,   3765,   3822,   3879,
-    3935,   3989,   4044,   4097,
-    4150,   4202,   4254,   4305,
-    4356,   4406,   4455,   4504,
-    4552,   4600,   4648,   4695,
-    4741,   4788,   4833,   4879,
-    4924,   4968,   5013,   5057,
-    5100,   5143,   5186,   5229,
-    5271,   5313,   5354,   5396,
-    5437,   5478,   5518,   5558,
-    5598,   5638,   5678,   5717,
-    5756,   5794,   5833,   5871,
-    5909,   5947,   5985,   6022,
-    6059,   6096,   6133,   6170,
-    6206,   6243,   6279,   6315,
-    6350,   6386,   6421,   6456,
-    6491,   6526,   6561,   6595,
-    6630,   6664,   6698,   6732,
-    6766,   6800,   6833,   6866,
-    6900,   6933,   6966,   6999,
-    7031,   7064,   7096,   7129,
-    7161,   7193,   7225,   7257,
-    7288,   7320,   7351,   7383,
-    7414,   7445,   7476,   7507,
-    7538,   7569,   7600,   7630,
-    7661,   7691,   7721,   7751,
-    7781,   7811,   7841,   7871,
-    7901,   7930,   7960,   7989,
-    8019,   8048,   8077,   8106,
-    8135,   8164,   8193,   8222,
-    8250,   8279,   8307,   8336,
-    8364,   8393,   8421,   8449,
-    8477,   8505,   8533,   8561,
-    8589,   8616,   8644,   8672,
-    8699,   8727,   8754,   8782,
-    8809,   8836,   8863,   8890,
-    8917,   8944,   8971,   8998,
-    9025,   9052,   9078,   9105,
-    9131,   9158,   9184,   9211,
-    9237,   9263,   9290,   9316,
-    9342,   9368,   9394,   9420,
-    9446,   9472,   9497,   9523,
-    9549,   9575,   9600,   9626,
-    9651,   9677,   9702,   9728,
-    9753,   9778,   9804,   9829,
-    9854,   9879,   9904,   9929,
-    9954,   9979,  10004,  10029,
-   10054,  10078,  10103,  10128,
-   10153,  10177,  10202,  10226,
-   10251,  10275,  10300,  10324,
-   10348,  10373,  10397,  10421,
-   10445,  10470,  10494,  10518,
-   10542,  10566,  10590,  10614,
-   10638,  10662,  10686,  10709,
-   10733,  10757,  10781,  10804,
-   10828,  10852,  10875,  10899,
-   10922,  10946,  10969,  10993,
-   11016,  11040,  11063,  11086,
-   11110,  11133,  11156,  11179,
-   11202,  11226,  11249,  11272,
-   11295,  11318,  11341,  11364,
-   11387,  11410,  11433,  11456,
-   11479,  11501,  11524,  11547,
-   11570,  11593,  11615,  11638,
-   11661,  11683,  11706,  11728,
-   11751,  11774,  11796,  11819,
-   11841,  11864,  11886,  11908,
-   11931,  11953,  11975,  11998,
-   12020,  12042,  12065,  12087,
-   12109,  12131,  12154,  12176,
-   12198,  12220,  12242,  12264,
-   12286,  12308,  12330,  12352,
-   12374,  12396,  12418,  12440,
-   12462,  12484,  12506,  12528,
-   12549,  12571,  12593,  12615,
-   12637,  12658,  12680,  12702,
-   12724,  12745,  12767,  12789,
-   12810,  12832,  12853,  12875,
-   12897,  12918,  12940,  12961,
-   12983,  13004,  13026,  13047,
-   13069,  13090,  13111,  13133,
-   13154,  13176,  13197,  13218,
-   13240,  13261,  13282,  13304,
-   13325,  13346,  13367,  13389,
-   13410,  13431,  13452,  13474,
-   13495,  13516,  13537,  13558,
-   13579,  13600,  13622,  13643,
-   13664,  13685,  13706,  13727,
-   13748,  13769,  13790,  13811,
-   13832,  13853,  13874,  13895,
-   13916,  13937,  13958,  13979,
-   14000,  14021,  14042,  14062,
-   14083,  14104,  14125,  14146,
-   14167,  14188,  14208,  14229,
-   14250,  14271,  14292,  14312,
-   14333,  14354,  14375,  14395,
-   14416,  14437,  14458,  14478,
-   14499,  14520,  14541,  14561,
-   14582,  14603,  14623,  14644,
-   14665,  14685,  14706,  14726,
-   14747,  14768,  14788,  14809,
-   14830,  14850,  14871,  14891,
-   14912,  14932,  14953,  14974,
-   14994,  15015,  15035,  15056,
-   15076,  15097,  15117,  15138,
-   15158,  15179,  15199,  15220,
-   15240,  15261,  15281,  15302,
-   15322,  15343,  15363,  15384,
-   15404,  15425,  15445,  15466,
-   15486,  15507,  15527,  15547,
-   15568,  15588,  15609,  15629,
-   15650,  15670,  15690,  15711,
-   15731,  15752,  15772,  15792,
-   15813,  15833,  15854,  15874,
-   15894,  15915,  15935,  15956,
-   15976,  15996,  16017,  16037,
-   16058,  16078,  16098,  16119,
-   16139,  16159,  16180,  16200,
-   16221,  16241,  16261,  16282,
-   16302,  16322,  16343,  16363,
-   16384,  16404,  16424,  16445,
-   16465,  16485,  16506,  16526,
-   16546,  16567,  16587,  16608,
-   16628,  16648,  16669,  16689,
-   16709,  16730,  16750,  16771,
-   16791,  16811,  16832,  16852,
-   16873,  16893,  16913,  16934,
-   16954,  16975,  16995,  17015,
-   17036,  17056,  17077,  17097,
-   17117,  17138,  17158,  17179,
-   17199,  17220,  17240,  17260,
-   17281,  17301,  17322,  17342,
-   17363,  17383,  17404,  17424,
-   17445,  17465,  17486,  17506,
-   17527,  17547,  17568,  17588,
-   17609,  17629,  17650,  17670,
-   17691,  17711,  17732,  17752,
-   17773,  17793,  17814,  17835,
-   17855,  17876,  17896,  17917,
-   17937,  17958,  17979,  17999,
-   18020,  18041,  18061,  18082,
-   18102,  18123,  18144,  18164,
-   18185,  18206,  18226,  18247,
-   18268,  18289,  18309,  18330,
-   18351,  18372,  18392,  18413,
-   18434,  18455,  18475,  18496,
-   18517,  18538,  18559,  18579,
-   18600,  18621,  18642,  18663,
-   18684,  18705,  18725,  18746,
-   18767,  18788,  18809,  18830,
-   18851,  18872,  18893,  18914,
-   18935,  18956,  18977,  18998,
-   19019,  19040,  19061,  19082,
-   19103,  19124,  19145,  19167,
-   19188,  19209,  19230,  19251,
-   19272,  19293,  19315,  19336,
-   19357,  19378,  19400,  19421,
-   19442,  19463,  19485,  19506,
-   19527,  19549,  19570,  19591,
-   19613,  19634,  19656,  19677,
-   19698,  19720,  19741,  19763,
-   19784,  19806,  19827,  19849,
-   19870,  19892,  19914,  19935,
-   19957,  19978,  20000,  20022,
-   20043,  20065,  20087,  20109,
-   20130,  20152,  20174,  20196,
-   20218,  20239,  20261,  20283,
-   20305,  20327,  20349,  20371,
-   20393,  20415,  20437,  20459,
-   20481,  20503,  20525,  20547,
-   20569,  20591,  20613,  20636,
-   20658,  20680,  20702,  20725,
-   20747,  20769,  20792,  20814,
-   20836,  20859,  20881,  20903,
-   20926,  20948,  20971,  20993,
-   21016,  21039,  21061,  21084,
-   21106,  21129,  21152,  21174,
-   21197,  21220,  21243,  21266,
-   21288,  21311,  21334,  21357,
-   21380,  21403,  21426,  21449,
-   21472,  21495,  21518,  21541,
-   21565,  21588,  21611,  21634,
-   21657,  21681,  21704,  21727,
-   21751,  21774,  21798,  21821,
-   21845,  21868,  21892,  21915,
-   21939,  21963,  21986,  22010,
-   22034,  22058,  22081,  22105,
-   22129,  22153,  22177,  22201,
-   22225,  22249,  22273,  22297,
-   22322,  22346,  22370,  22394,
-   22419,  22443,  22467,  22492,
-   22516,  22541,  22565,  22590,
-   22614,  22639,  22664,  22689,
-   22713,  22738,  22763,  22788,
-   22813,  22838,  22863,  22888,
-   22913,  22938,  22963,  22989,
-   23014,  23039,  23065,  23090,
-   23116,  23141,  23167,  23192,
-   23218,  23244,  23270,  23295,
-   23321,  23347,  23373,  23399,
-   23425,  23451,  23477,  23504,
-   23530,  23556,  23583,  23609,
-   23636,  23662,  23689,  23715,
-   23742,  23769,  23796,  23823,
-   23850,  23877,  23904,  23931,
-   23958,  23985,  24013,  24040,
-   24068,  24095,  24123,  24151,
-   24178,  24206,  24234,  24262,
-   24290,  24318,  24346,  24374,
-   24403,  24431,  24460,  24488,
-   24517,  24545,  24574,  24603,
-   24632,  24661,  24690,  24719,
-   24748,  24778,  24807,  24837,
-   24866,  24896,  24926,  24956,
-   24986,  25016,  25046,  25076,
-   25106,  25137,  25167,  25198,
-   25229,  25260,  25291,  25322,
-   25353,  25384,  25416,  25447,
-   25479,  25510,  25542,  25574,
-   25606,  25638,  25671,  25703,
-   25736,  25768,  25801,  25834,
-   25867,  25901,  25934,  25967,
-   26001,  26035,  26069,  26103,
-   26137,  26172,  26206,  26241,
-   26276,  26311,  26346,  26381,
-   26417,  26452,  26488,  26524,
-   26561,  26597,  26634,  26671,
-   26708,  26745,  26782,  26820,
-   26858,  26896,  26934,  26973,
-   27011,  27050,  27089,  27129,
-   27169,  27209,  27249,  27289,
-   27330,  27371,  27413,  27454,
-   27496,  27538,  27581,  27624,
-   27667,  27710,  27754,  27799,
-   27843,  27888,  27934,  27979,
-   28026,  28072,  28119,  28167,
-   28215,  28263,  28312,  28361,
-   28411,  28462,  28513,  28565,
-   28617,  28670,  28723,  28778,
-   28832,  28888,  28945,  29002,
-   29060,  29119,  29179,  29240,
-   29302,  29365,  29429,  29494,
-   29561,  29629,  29698,  29769,
-   29842,  29917,  29993,  30072,
-   30153,  30236,  30322,  30412,
-   30504,  30601,  30702,  30808,
-   30921,  31040,  31169,  31308,
-   31462,  31637,  31845,  32115,
-   32767,
-};
-
-const int16_t wav_linear_audio[] = {
-  -32767, -32735, -32703, -32671,
-  -32639, -32607, -32575, -32543,
-  -32511, -32479, -32447, -32415,
-  -32383, -32351, -32319, -32287,
-  -32255, -32223, -32191, -32159,
-  -32127, -32095, -32063, -32031,
-  -31999, -31967, -31935, -31903,
-  -31871, -31839, -31807, -31775,
-  -31743, -31711, -31679, -31647,
-  -31615, -31583, -31551, -31519,
-  -31487, -31455, -31423, -31391,
-  -31359, -31327, -31295, -31263,
-  -31231, -31199, -31167, -31135,
-  -31103, -31071, -31039, -31007,
-  -30975, -30943, -30911, -30879,
-  -30847, -30815, -30783, -30751,
-  -30719, -30687, -30655, -30623,
-  -30591, -30559, -30527, -30495,
-  -30463, -30431, -30399, -30367,
-  -30335, -30303, -30271, -30239,
-  -30207, -30175, -30143, -30111,
-  -30079, -30047, -30015, -29983,
-  -29951, -29919, -29887, -29855,
-  -29823, -29791, -29759, -29727,
-  -29695, -29663, -29631, -29599,
-  -29567, -29535, -29503, -29471,
-  -29439, -29407, -29375, -29343,
-  -29311, -29279, -29247, -29215,
-  -29183, -29151, -29119, -29087,
-  -29055, -29023, -28991, -28959,
-  -28927, -28895, -28863, -28831,
-  -28799, -28767, -28735, -28703,
-  -28671, -28639, -28607, -28575,
-  -28543, -28511, -28479, -28447,
-  -28415, -28383, -28351, -28319,
-  -28287, -28255, -28223, -28191,
-  -28159, -28127, -28095, -28063,
-  -28031, -27999, -27967, -27935,
-  -27903, -27871, -27839, -27807,
-  -27775, -27743, -27711, -27679,
-  -27647, -27615, -27583, -27551,
-  -27519, -27487, -27455, -27423,
-  -27391, -27359, -27327, -27295,
-  -27263, -27231, -27199, -27167,
-  -27135, -27103, -27071, -27039,
-  -27007, -26975, -26943, -26911,
-  -26879, -26847, -26815, -26783,
-  -26751, -26719, -26687, -26655,
-  -26623, -26591, -26559, -26527,
-  -26495, -26463, -26431, -26399,
-  -26367, -26335, -26303, -26271,
-  -26239, -26207, -26175, -26143,
-  -26111, -26079, -26047, -26015,
-  -25983, -25951, -25919, -25887,
-  -25855, -25823, -25791, -25759,
-  -25727, -25695, -25663, -25631,
-  -25599, -25567, -25535, -25503,
-  -25471, -25439, -25407, -25375,
-  -25343, -25311, -25279, -25247,
-  -25215, -25183, -25151, -25119,
-  -25087, -25055, -25023, -24991,
-  -24959, -24927, -24895, -24863,
-  -24831, -24799, -24767, -24735,
-  -24703, -24671, -24639, -24607,
-  -24575, -24543, -24511, -24479,
-  -24447, -24415, -24383, -24351,
-  -24319, -24287, -24255, -24223,
-  -24191, -24159, -24127, -24095,
-  -24063, -24031, -23999, -23967,
-  -23935, -23903, -23871, -23839,
-  -23807, -23775, -23743, -23711,
-  -23679, -23647, -23615, -23583,
-  -23551, -23519, -23487, -23455,
-  -23423, -23391, -23359, -23327,
-  -23295, -23263, -23231, -23199,
-  -23167, -23135, -23103, -23071,
-  -23039, -23007, -22975, -22943,
-  -22911, -22879, -22847, -22815,
-  -22783, -22751, -22719, -22687,
-  -22655, -22623, -22591, -22559,
-  -22527, -22495, -22463, -22431,
-  -22399, -22367, -22335, -22303,
-  -22271, -22239, -22207, -22175,
-  -22143, -22111, -22079, -22047,
-  -22015, -21983, -21951, -21919,
-  -21887, -21855, -21823, -21791,
-  -21759, -21727, -21695, -21663,
-  -21631, -21599, -21567, -21535,
-  -21503, -21471, -21439, -21407,
-  -21375, -21343, -21311, -21279,
-  -21247, -21215, -21183, -21151,
-  -21119, -21087, -21055, -21023,
-  -20991, -20959, -20927, -20895,
-  -20863, -20831, -20799, -20767,
-  -20735, -20703, -20671, -20639,
-  -20607, -20575, -20543, -20511,
-  -20479, -20447, -20415, -20383,
-  -20351, -20319, -20287, -20255,
-  -20223, -20191, -20159, -20127,
-  -20095, -20063, -20031, -19999,
-  -19967, -19935, -19903, -19871,
-  -19839, -19807, -19775, -19743,
-  -19711, -19679, -19647, -19615,
-  -19583, -19551, -19519, -19487,
-  -19455, -19423, -19391, -19359,
-  -19327, -19295, -19263, -19231,
-  -19199, -19167, -19135, -19103,
-  -19071, -19039, -19007, -18975,
-  -18943, -18911, -18879, -18847,
-  -18815, -18783, -18751, -18719,
-  -18687, -18655, -18623, -18591,
-  -18559, -18527, -18495, -18463,
-  -18431, -18399, -18367, -18335,
-  -18303, -18271, -18239, -18207,
-  -18175, -18143, -18111, -18079,
-  -18047, -18015, -17983, -17951,
-  -17919, -17887, -17855, -17823,
-  -17791, -17759, -17727, -17695,
-  -17663, -17631, -17599, -17567,
-  -17535, -17503, -17471, -17439,
-  -17407, -17375, -17343, -17311,
-  -17279, -17247, -17215, -17183,
-  -17151, -17119, -17087, -17055,
-  -17023, -16991, -16959, -16927,
-  -16895, -16863, -16831, -16799,
-  -16767, -16735, -16703, -16671,
-  -16639, -16607, -16575, -16543,
-  -16511, -16479, -16447, -16415,
-  -16384, -16352, -16320, -16288,
-  -16256, -16224, -16192, -16160,
-  -16128, -16096, -16064, -16032,
-  -16000, -15968, -15936, -15904,
-  -15872, -15840, -15808, -15776,
-  -15744, -15712, -15680, -15648,
-  -15616, -15584, -15552, -15520,
-  -15488, -15456, -15424, -15392,
-  -15360, -15328, -15296, -15264,
-  -15232, -15200, -15168, -15136,
-  -15104, -15072, -15040, -15008,
-  -14976, -14944, -14912, -14880,
-  -14848, -14816, -14784, -14752,
-  -14720, -14688, -14656, -14624,
-  -14592, -14560, -14528, -14496,
-  -14464, -14432, -14400, -14368,
-  -14336, -14304, -14272, -14240,
-  -14208, -14176, -14144, -14112,
-  -14080, -14048, -14016, -13984,
-  -13952, -13920, -13888, -13856,
-  -13824, -13792, -13760, -13728,
-  -13696, -13664, -13632, -13600,
-  -13568, -13536, -13504, -13472,
-  -13440, -13408, -13376, -13344,
-  -13312, -13280, -13248, -13216,
-  -13184, -13152, -13120, -13088,
-  -13056, -13024, -12992, -12960,
-  -12928, -12896, -12864, -12832,
-  -12800, -12768, -12736, -12704,
-  -12672, -12640, -12608, -12576,
-  -12544, -12512, -12480, -12448,
-  -12416, -12384, -12352, -12320,
-  -12288, -12256, -12224, -12192,
-  -12160, -12128, -12096, -12064,
-  -12032, -12000, -11968, -11936,
-  -11904, -11872, -11840, -11808,
-  -11776, -11744, -11712, -11680,
-  -11648, -11616, -11584, -11552,
-  -11520, -11488, -11456, -11424,
-  -11392, -11360, -11328, -11296,
-  -11264, -11232, -11200, -11168,
-  -11136, -11104, -11072, -11040,
-  -11008, -10976, -10944, -10912,
-  -10880, -10848, -10816, -10784,
-  -10752, -10720, -10688, -10656,
-  -10624, -10592, -10560, -10528,
-  -10496, -10464, -10432, -10400,
-  -10368, -10336, -10304, -10272,
-  -10240, -10208, -10176, -10144,
-  -10112, -10080, -10048, -10016,
-   -9984,  -9952,  -9920,  -9888,
-   -9856,  -9824,  -9792,  -9760,
-   -9728,  -9696,  -9664,  -9632,
-   -9600,  -9568,  -9536,  -9504,
-   -9472,  -9440,  -9408,  -9376,
-   -9344,  -9312,  -9280,  -9248,
-   -9216,  -9184,  -9152,  -9120,
-   -9088,  -9056,  -9024,  -8992,
-   -8960,  -8928,  -8896,  -8864,
-   -8832,  -8800,  -8768,  -8736,
-   -8704,  -8672,  -8640,  -8608,
-   -8576,  -8544,  -8512,  -8480,
-   -8448,  -8416,  -8384,  -8352,
-   -8320,  -8288,  -8256,  -8224,
-   -8192,  -8160,  -8128,  -8096,
-   -8064,  -8032,  -8000,  -7968,
-   -7936,  -7904,  -7872,  -7840,
-   -7808,  -7776,  -7744,  -7712,
-   -7680,  -7648,  -7616,  -7584,
-   -7552,  -7520,  -7488,  -7456,
-   -7424,  -7392,  -7360,  -7328,
-   -7296,  -7264,  -7232,  -7200,
-   -7168,  -7136,  -7104,  -7072,
-   -7040,  -7008,  -6976,  -6944,
-   -6912,  -6880,  -6848,  -6816,
-   -6784,  -6752,  -6720,  -6688,
-   -6656,  -6624,  -6592,  -6560,
-   -6528,  -6496,  -6464,  -6432,
-   -6400,  -6368,  -6336,  -6304,
-   -6272,  -6240,  -6208,  -6176,
-   -6144,  -6112,  -6080,  -6048,
-   -6016,  -5984,  -5952,  -5920,
-   -5888,  -5856,  -5824,  -5792,
-   -5760,  -5728,  -5696,  -5664,
-   -5632,  -5600,  -5568,  -5536,
-   -5504,  -5472,  -5440,  -5408,
-   -5376,  -5344,  -5312,  -5280,
-   -5248,  -5216,  -5184,  -5152,
-   -5120,  -5088,  -5056,  -5024,
-   -4992,  -4960,  -4928,  -4896,
-   -4864,  -4832,  -4800,  -4768,
-   -4736,  -4704,  -4672,  -4640,
-   -4608,  -4576,  -4544,  -4512,
-   -4480,  -4448,  -4416,  -4384,
-   -4352,  -4320,  -4288,  -4256,
-   -4224,  -4192,  -4160,  -4128,
-   -4096,  -4064,  -4032,  -4000,
-   -3968,  -3936,  -3904,  -3872,
-   -3840,  -3808,  -3776,  -3744,
-   -3712,  -3680,  -3648,  -3616,
-   -3584,  -3552,  -3520,  -3488,
-   -3456,  -3424,  -3392,  -3360,
-   -3328,  -3296,  -3264,  -3232,
-   -3200,  -3168,  -3136,  -3104,
-   -3072,  -3040,  -3008,  -2976,
-   -2944,  -2912,  -2880,  -2848,
-   -2816,  -2784,  -2752,  -2720,
-   -2688,  -2656,  -2624,  -2592,
-   -2560,  -2528,  -2496,  -2464,
-   -2432,  -2400,  -2368,  -2336,
-   -2304,  -2272,  -2240,  -2208,
-   -2176,  -2144,  -2112,  -2080,
-   -2048,  -2016,  -1984,  -1952,
-   -1920,  -1888,  -1856,  -1824,
-   -1792,  -1760,  -1728,  -1696,
-   -1664,  -1632,  -1600,  -1568,
-   -1536,  -1504,  -1472,  -1440,
-   -1408,  -1376,  -1344,  -1312,
-   -1280,  -1248,  -1216,  -1184,
-   -1152,  -1120,  -1088,  -1056,
-   -1024,   -992,   -960,   -928,
-    -896,   -864,   -832,   -800,
-    -768,   -736,   -704,   -672,
-    -640,   -608,   -576,   -544,
-    -512,   -480,   -448,   -416,
-    -384,   -352,   -320,   -288,
-    -256,   -224,   -192,   -160,
-    -128,    -96,    -64,    -32,
-       0,     32,     64,     96,
-     128,    160,    192,    224,
-     256,    288,    320,    352,
-     384,    416,    448,    480,
-     512,    544,    576,    608,
-     640,    672,    704,    736,
-     768,    800,    832,    864,
-     896,    928,    960,    992,
-    1024,   1056,   1088,   1120,
-    1152,   1184,   1216,   1248,
-    1280,   1312,   1344,   1376,
-    1408,   1440,   1472,   1504,
-    1536,   1568,   1600,   1632,
-    1664,   1696,   1728,   1760,
-    1792,   1824,   1856,   1888,
-    1920,   1952,   1984,   2016,
-    2048,   2080,   2112,   2144,
-    2176,   2208,   2240,   2272,
-    2304,   2336,   2368,   2400,
-    2432,   2464,   2496,   2528,
-    2560,   2592,   2624,   2656,
-    2688,   2720,   2752,   2784,
-    2816,   2848,   2880,   2912,
-    2944,   2976,   3008,   3040,
-    3072,   3104,   3136,   3168,
-    3200,   3232,   3264,   3296,
-    3328,   3360,   3392,   3424,
-    3456,   3488,   3520,   3552,
-    3584,   3616,   3648,   3680,
-    3712,   3744,   3776,   3808,
-    3840,   3872,   3904,   3936,
-    3968,   4000,   4032,   4064,
-    4096,   4128,   4160,   4192,
-    4224,   4256,   4288,   4320,
-    4352,   4384,   4416,   4448,
-    4480,   4512,   4544,   4576,
-    4608,   4640,   4672,   4704,
-    4736,   4768,   4800,   4832,
-    4864,   4896,   4928,   4960,
-    4992,   5024,   5056,   5088,
-    5120,   5152,   5184,   5216,
-    5248,   5280,   5312,   5344,
-    5376,   5408,   5440,   5472,
-    5504,   5536,   5568,   5600,
-    5632,   5664,   5696,   5728,
-    5760,   5792,   5824,   5856,
-    5888,   5920,   5952,   5984,
-    6016,   6048,   6080,   6112,
-    6144,   6176,   6208,   6240,
-    6272,   6304,   6336,   6368,
-    6400,   6432,   6464,   6496,
-    6528,   6560,   6592,   6624,
-    6656,   6688,   6720,   6752,
-    6784,   6816,   6848,   6880,
-    6912,   6944,   6976,   7008,
-    7040,   7072,   7104,   7136,
-    7168,   7200,   7232,   7264,
-    7296,   7328,   7360,   7392,
-    7424,   7456,   7488,   7520,
-    7552,   7584,   7616,   7648,
-    7680,   7712,   7744,   7776,
-    7808,   7840,   7872,   7904,
-    7936,   7968,   8000,   8032,
-    8064,   8096,   8128,   8160,
-    8192,   8224,   8256,   8288,
-    8320,   8352,   8384,   8416,
-    8448,   8480,   8512,   8544,
-    8576,   8608,   8640,   8672,
-    8704,   8736,   8768,   8800,
-    8832,   8864,   8896,   8928,
-    8960,   8992,   9024,   9056,
-    9088,   9120,   9152,   9184,
-    9216,   9248,   9280,   9312,
-    9344,   9376,   9408,   9440,
-    9472,   9504,   9536,   9568,
-    9600,   9632,   9664,   9696,
-    9728,   9760,   9792,   9824,
-    9856,   9888,   9920,   9952,
-    9984,  10016,  10048,  10080,
-   10112,  10144,  10176,  10208,
-   10240,  10272,  10304,  10336,
-   10368,  10400,  10432,  10464,
-   10496,  10528,  10560,  10592,
-   10624,  10656,  10688,  10720,
-   10752,  10784,  10816,  10848,
-   10880,  10912,  10944,  10976,
-   11008,  11040,  11072,  11104,
-   11136,  11168,  11200,  11232,
-   11264,  11296,  11328,  11360,
-   11392,  11424,  11456,  11488,
-   11520,  11552,  11584,  11616,
-   11648,  11680,  11712,  11744,
-   11776,  11808,  11840,  11872,
-   11904,  11936,  11968,  12000,
-   12032,  12064,  12096,  12128,
-   12160,  12192,  12224,  12256,
-   12288,  12320,  12352,  12384,
-   12416,  12448,  12480,  12512,
-   12544,  12576,  12608,  12640,
-   12672,  12704,  12736,  12768,
-   12800,  12832,  12864,  12896,
-   12928,  12960,  12992,  13024,
-   13056,  13088,  13120,  13152,
-   13184,  13216,  13248,  13280,
-   13312,  13344,  13376,  13408,
-   13440,  13472,  13504,  13536,
-   13568,  13600,  13632,  13664,
-   13696,  13728,  13760,  13792,
-   13824,  13856,  13888,  13920,
-   13952,  13984,  14016,  14048,
-   14080,  14112,  14144,  14176,
-   14208,  14240,  14272,  14304,
-   14336,  14368,  14400,  14432,
-   14464,  14496,  14528,  14560,
-   14592,  14624,  14656,  14688,
-   14720,  14752,  14784,  14816,
-   14848,  14880,  14912,  14944,
-   14976,  15008,  15040,  15072,
-   15104,  15136,  15168,  15200,
-   15232,  15264,  15296,  15328,
-   15360,  15392,  15424,  15456,
-   15488,  15520,  15552,  15584,
-   15616,  15648,  15680,  15712,
-   15744,  15776,  15808,  15840,
-   15872,  15904,  15936,  15968,
-   16000,  16032,  16064,  16096,
-   16128,  16160,  16192,  16224,
-   16256,  16288,  16320,  16352,
-   16384,  16415,  16447,  16479,
-   16511,  16543,  16575,  16607,
-   16639,  16671,  16703,  16735,
-   16767,  16799,  16831,  16863,
-   16895,  16927,  16959,  16991,
-   17023,  17055,  17087,  17119,
-   17151,  17183,  17215,  17247,
-   17279,  17311,  17343,  17375,
-   17407,  17439,  17471,  17503,
-   17535,  17567,  17599,  17631,
-   17663,  17695,  17727,  17759,
-   17791,  17823,  17855,  17887,
-   17919,  17951,  17983,  18015,
-   18047,  18079,  18111,  18143,
-   18175,  18207,  18239,  18271,
-   18303,  18335,  18367,  18399,
-   18431,  18463,  18495,  18527,
-   18559,  18591,  18623,  18655,
-   18687,  18719,  18751,  18783,
-   18815,  18847,  18879,  18911,
-   18943,  18975,  19007,  19039,
-   19071,  19103,  19135,  19167,
-   19199,  19231,  19263,  19295,
-   19327,  19359,  19391,  19423,
-   19455,  19487,  19519,  19551,
-   19583,  19615,  19647,  19679,
-   19711,  19743,  19775,  19807,
-   19839,  19871,  19903,  19935,
-   19967,  19999,  20031,  20063,
-   20095,  20127,  20159,  20191,
-   20223,  20255,  20287,  20319,
-   20351,  20383,  20415,  20447,
-   20479,  20511,  20543,  20575,
-   20607,  20639,  20671,  20703,
-   20735,  20767,  20799,  20831,
-   20863,  20895,  20927,  20959,
-   20991,  21023,  21055,  21087,
-   21119,  21151,  21183,  21215,
-   21247,  21279,  21311,  21343,
-   21375,  21407,  21439,  21471,
-   21503,  21535,  21567,  21599,
-   21631,  21663,  21695,  21727,
-   21759,  21791,  21823,  21855,
-   21887,  21919,  21951,  21983,
-   22015,  22047,  22079,  22111,
-   22143,  22175,  22207,  22239,
-   22271,  22303,  22335,  22367,
-   22399,  22431,  22463,  22495,
-   22527,  22559,  22591,  22623,
-   22655,  22687,  22719,  22751,
-   22783,  22815,  22847,  22879,
-   22911,  22943,  22975,  23007,
-   23039,  23071,  23103,  23135,
-   23167,  23199,  23231,  23263,
-   23295,  23327,  23359,  23391,
-   23423,  23455,  23487,  23519,
-   23551,  23583,  23615,  23647,
-   23679,  23711,  23743,  23775,
-   23807,  23839,  23871,  23903,
-   23935,  23967,  23999,  24031,
-   24063,  24095,  24127,  24159,
-   24191,  24223,  24255,  24287,
-   24319,  24351,  24383,  24415,
-   24447,  24479,  24511,  24543,
-   24575,  24607,  24639,  24671,
-   24703,  24735,  24767,  24799,
-   24831,  24863,  24895,  24927,
-   24959,  24991,  25023,  25055,
-   25087,  25119,  25151,  25183,
-   25215,  25247,  25279,  25311,
-   25343,  25375,  25407,  25439,
-   25471,  25503,  25535,  25567,
-   25599,  25631,  25663,  25695,
-   25727,  25759,  25791,  25823,
-   25855,  25887,  25919,  25951,
-   25983,  26015,  26047,  26079,
-   26111,  26143,  26175,  26207,
-   26239,  26271,  26303,  26335,
-   26367,  26399,  26431,  26463,
-   26495,  26527,  26559,  26591,
-   26623,  26655,  26687,  26719,
-   26751,  26783,  26815,  26847,
-   26879,  26911,  26943,  26975,
-   27007,  27039,  27071,  27103,
-   27135,  27167,  27199,  27231,
-   27263,  27295,  27327,  27359,
-   27391,  27423,  27455,  27487,
-   27519,  27551,  27583,  27615,
-   27647,  27679,  27711,  27743,
-   27775,  27807,  27839,  27871,
-   27903,  27935,  27967,  27999,
-   28031,  28063,  28095,  28127,
-   28159,  28191,  28223,  28255,
-   28287,  28319,  28351,  28383,
-   28415,  28447,  28479,  28511,
-   28543,  28575,  28607,  28639,
-   28671,  28703,  28735,  28767,
-   28799,  28831,  28863,  28895,
-   28927,  28959,  28991,  29023,
-   29055,  29087,  29119,  29151,
-   29183,  29215,  29247,  29279,
-   29311,  29343,  29375,  29407,
-   29439,  29471,  29503,  29535,
-   29567,  29599,  29631,  29663,
-   29695,  29727,  29759,  29791,
-   29823,  29855,  29887,  29919,
-   29951,  29983,  30015,  30047,
-   30079,  30111,  30143,  30175,
-   30207,  30239,  30271,  30303,
-   30335,  30367,  30399,  30431,
-   30463,  30495,  30527,  30559,
-   30591,  30623,  30655,  30687,
-   30719,  30751,  30783,  30815,
-   30847,  30879,  30911,  30943,
-   30975,  31007,  31039,  31071,
-   31103,  31135,  31167,  31199,
-   31231,  31263,  31295,  31327,
-   31359,  31391,  31423,  31455,
-   31487,  31519,  31551,  31583,
-   31615,  31647,  31679,  31711,
-   31743,  31775,  31807,  31839,
-   31871,  31903,  31935,  31967,
-   31999,  32031,  32063,  32095,
-   32127,  32159,  32191,  32223,
-   32255,  32287,  32319,  32351,
-   32383,  32415,  32447,  32479,
-   32511,  32543,  32575,  32607,
-   32639,  32671,  32703,  32735,
-   32767,
-};
-
-const int16_t wav_sin_audio[] = {
-  -32767, -32767, -32767, -32766,
-  -32766, -32765, -32764, -32763,
-  -32762, -32761, -32759, -32758,
-  -32756, -32754, -32752, -32750,
-  -32747, -32745, -32742, -32739,
-  -32736, -32733, -32730, -32726,
-  -32723, -32719, -32715, -32711,
-  -32707, -32702, -32698, -32693,
-  -32688, -32683, -32678, -32673,
-  -32667, -32662, -32656, -32650,
-  -32644, -32638, -32631, -32625,
-  -32618, -32611, -32604, -32597,
-  -32590, -32582, -32575, -32567,
-  -32559, -32551, -32543, -32534,
-  -32526, -32517, -32508, -32499,
-  -32490, -32481, -32472, -32462,
-  -32452, -32442, -32432, -32422,
-  -32412, -32401, -32391, -32380,
-  -32369, -32358, -32347, -32335,
-  -32324, -32312, -32300, -32288,
-  -32276, -32264, -32251, -32239,
-  -32226, -32213, -32200, -32187,
-  -32174, -32160, -32146, -32133,
-  -32119, -32105, -32090, -32076,
-  -32062, -32047, -32032, -32017,
-  -32002, -31987, -31971, -31956,
-  -31940, -31924, -31908, -31892,
-  -31876, -31859, -31843, -31826,
-  -31809, -31792, -31775, -31758,
-  -31740, -31723, -31705, -31687,
-  -31669, -31651, -31633, -31614,
-  -31596, -31577, -31558, -31539,
-  -31520, -31501, -31481, -31462,
-  -31442, -31422, -31402, -31382,
-  -31361, -31341, -31320, -31300,
-  -31279, -31258, -31237, -31215,
-  -31194, -31172, -31151, -31129,
-  -31107, -31085, -31063, -31040,
-  -31018, -30995, -30972, -30949,
-  -30926, -30903, -30880, -30856,
-  -30832, -30809, -30785, -30761,
-  -30737, -30712, -30688, -30663,
-  -30639, -30614, -30589, -30564,
-  -30538, -30513, -30488, -30462,
-  -30436, -30410, -30384, -30358,
-  -30332, -30305, -30279, -30252,
-  -30225, -30198, -30171, -30144,
-  -30117, -30089, -30061, -30034,
-  -30006, -29978, -29950, -29922,
-  -29893, -29865, -29836, -29807,
-  -29778, -29749, -29720, -29691,
-  -29662, -29632, -29602, -29573,
-  -29543, -29513, -29483, -29452,
-  -29422, -29392, -29361, -29330,
-  -29299, -29268, -29237, -29206,
-  -29175, -29143, -29112, -29080,
-  -29048, -29016, -28984, -28952,
-  -28920, -28887, -28855, -28822,
-  -28789, -28756, -28723, -28690,
-  -28657, -28624, -28590, -28557,
-  -28523, -28489, -28455, -28421,
-  -28387, -28353, -28318, -28284,
-  -28249, -28214, -28180, -28145,
-  -28110, -28075, -28039, -28004,
-  -27968, -27933, -27897, -27861,
-  -27825, -27789, -27753, -27717,
-  -27681, -27644, -27608, -27571,
-  -27534, -27497, -27460, -27423,
-  -27386, -27349, -27311, -27274,
-  -27236, -27198, -27161, -27123,
-  -27085, -27047, -27008, -26970,
-  -26932, -26893, -26855, -26816,
-  -26777, -26738, -26699, -26660,
-  -26621, -26582, -26542, -26503,
-  -26463, -26423, -26384, -26344,
-  -26304, -26264, -26224, -26183,
-  -26143, -26103, -26062, -26022,
-  -25981, -25940, -25899, -25858,
-  -25817, -25776, -25735, -25694,
-  -25652, -25611, -25569, -25527,
-  -25486, -25444, -25402, -25360,
-  -25318, -25276, -25233, -25191,
-  -25149, -25106, -25064, -25021,
-  -24978, -24935, -24892, -24849,
-  -24806, -24763, -24720, -24677,
-  -24633, -24590, -24546, -24503,
-  -24459, -24415, -24371, -24327,
-  -24283, -24239, -24195, -24151,
-  -24107, -24062, -24018, -23973,
-  -23929, -23884, -23839, -23795,
-  -23750, -23705, -23660, -23615,
-  -23570, -23524, -23479, -23434,
-  -23388, -23343, -23297, -23252,
-  -23206, -23160, -23115, -23069,
-  -23023, -22977, -22931, -22885,
-  -22838, -22792, -22746, -22700,
-  -22653, -22607, -22560, -22514,
-  -22467, -22420, -22374, -22327,
-  -22280, -22233, -22186, -22139,
-  -22092, -22045, -21997, -21950,
-  -21903, -21856, -21808, -21761,
-  -21713, -21666, -21618, -21570,
-  -21523, -21475, -21427, -21379,
-  -21331, -21283, -21235, -21187,
-  -21139, -21091, -21043, -20995,
-  -20947, -20898, -20850, -20802,
-  -20753, -20705, -20656, -20608,
-  -20559, -20510, -20462, -20413,
-  -20364, -20316, -20267, -20218,
-  -20169, -20120, -20071, -20022,
-  -19973, -19924, -19875, -19826,
-  -19777, -19728, -19678, -19629,
-  -19580, -19530, -19481, -19432,
-  -19382, -19333, -19283, -19234,
-  -19184, -19135, -19085, -19036,
-  -18986, -18937, -18887, -18837,
-  -18787, -18738, -18688, -18638,
-  -18588, -18539, -18489, -18439,
-  -18389, -18339, -18289, -18239,
-  -18189, -18139, -18089, -18039,
-  -17989, -17939, -17889, -17839,
-  -17789, -17739, -17689, -17639,
-  -17589, -17539, -17488, -17438,
-  -17388, -17338, -17288, -17238,
-  -17187, -17137, -17087, -17037,
-  -16987, -16936, -16886, -16836,
-  -16786, -16735, -16685, -16635,
-  -16585, -16534, -16484, -16434,
-  -16383, -16333, -16283, -16233,
-  -16182, -16132, -16082, -16032,
-  -15981, -15931, -15881, -15831,
-  -15780, -15730, -15680, -15630,
-  -15580, -15529, -15479, -15429,
-  -15379, -15329, -15279, -15228,
-  -15178, -15128, -15078, -15028,
-  -14978, -14928, -14878, -14828,
-  -14778, -14728, -14678, -14628,
-  -14578, -14528, -14478, -14428,
-  -14378, -14328, -14278, -14228,
-  -14179, -14129, -14079, -14029,
-  -13980, -13930, -13880, -13830,
-  -13781, -13731, -13682, -13632,
-  -13583, -13533, -13484, -13434,
-  -13385, -13335, -13286, -13237,
-  -13187, -13138, -13089, -13039,
-  -12990, -12941, -12892, -12843,
-  -12794, -12745, -12696, -12647,
-  -12598, -12549, -12500, -12451,
-  -12403, -12354, -12305, -12257,
-  -12208, -12159, -12111, -12062,
-  -12014, -11965, -11917, -11869,
-  -11820, -11772, -11724, -11676,
-  -11628, -11580, -11532, -11484,
-  -11436, -11388, -11340, -11292,
-  -11244, -11197, -11149, -11101,
-  -11054, -11006, -10959, -10911,
-  -10864, -10817, -10770, -10722,
-  -10675, -10628, -10581, -10534,
-  -10487, -10440, -10393, -10347,
-  -10300, -10253, -10207, -10160,
-  -10114, -10067, -10021,  -9975,
-   -9929,  -9882,  -9836,  -9790,
-   -9744,  -9698,  -9652,  -9607,
-   -9561,  -9515,  -9470,  -9424,
-   -9379,  -9333,  -9288,  -9243,
-   -9197,  -9152,  -9107,  -9062,
-   -9017,  -8972,  -8928,  -8883,
-   -8838,  -8794,  -8749,  -8705,
-   -8660,  -8616,  -8572,  -8528,
-   -8484,  -8440,  -8396,  -8352,
-   -8308,  -8264,  -8221,  -8177,
-   -8134,  -8090,  -8047,  -8004,
-   -7961,  -7918,  -7875,  -7832,
-   -7789,  -7746,  -7703,  -7661,
-   -7618,  -7576,  -7534,  -7491,
-   -7449,  -7407,  -7365,  -7323,
-   -7281,  -7240,  -7198,  -7156,
-   -7115,  -7073,  -7032,  -6991,
-   -6950,  -6909,  -6868,  -6827,
-   -6786,  -6745,  -6705,  -6664,
-   -6624,  -6584,  -6543,  -6503,
-   -6463,  -6423,  -6383,  -6344,
-   -6304,  -6264,  -6225,  -6185,
-   -6146,  -6107,  -6068,  -6029,
-   -5990,  -5951,  -5912,  -5874,
-   -5835,  -5797,  -5759,  -5720,
-   -5682,  -5644,  -5606,  -5569,
-   -5531,  -5493,  -5456,  -5418,
-   -5381,  -5344,  -5307,  -5270,
-   -5233,  -5196,  -5159,  -5123,
-   -5086,  -5050,  -5014,  -4978,
-   -4942,  -4906,  -4870,  -4834,
-   -4799,  -4763,  -4728,  -4692,
-   -4657,  -4622,  -4587,  -4553,
-   -4518,  -4483,  -4449,  -4414,
-   -4380,  -4346,  -4312,  -4278,
-   -4244,  -4210,  -4177,  -4143,
-   -4110,  -4077,  -4044,  -4011,
-   -3978,  -3945,  -3912,  -3880,
-   -3847,  -3815,  -3783,  -3751,
-   -3719,  -3687,  -3655,  -3624,
-   -3592,  -3561,  -3530,  -3499,
-   -3468,  -3437,  -3406,  -3375,
-   -3345,  -3315,  -3284,  -3254,
-   -3224,  -3194,  -3165,  -3135,
-   -3105,  -3076,  -3047,  -3018,
-   -2989,  -2960,  -2931,  -2902,
-   -2874,  -2845,  -2817,  -2789,
-   -2761,  -2733,  -2706,  -2678,
-   -2650,  -2623,  -2596,  -2569,
-   -2542,  -2515,  -2488,  -2462,
-   -2435,  -2409,  -2383,  -2357,
-   -2331,  -2305,  -2279,  -2254,
-   -2229,  -2203,  -2178,  -2153,
-   -2128,  -2104,  -2079,  -2055,
-   -2030,  -2006,  -1982,  -1958,
-   -1935,  -1911,  -1887,  -1864,
-   -1841,  -1818,  -1795,  -1772,
-   -1749,  -1727,  -1704,  -1682,
-   -1660,  -1638,  -1616,  -1595,
-   -1573,  -1552,  -1530,  -1509,
-   -1488,  -1467,  -1447,  -1426,
-   -1406,  -1385,  -1365,  -1345,
-   -1325,  -1305,  -1286,  -1266,
-   -1247,  -1228,  -1209,  -1190,
-   -1171,  -1153,  -1134,  -1116,
-   -1098,  -1080,  -1062,  -1044,
-   -1027,  -1009,   -992,   -975,
-    -958,   -941,   -924,   -908,
-    -891,   -875,   -859,   -843,
-    -827,   -811,   -796,   -780,
-    -765,   -750,   -735,   -720,
-    -705,   -691,   -677,   -662,
-    -648,   -634,   -621,   -607,
-    -593,   -580,   -567,   -554,
-    -541,   -528,   -516,   -503,
-    -491,   -479,   -467,   -455,
-    -443,   -432,   -420,   -409,
-    -398,   -387,   -376,   -366,
-    -355,   -345,   -335,   -325,
-    -315,   -305,   -295,   -286,
-    -277,   -268,   -259,   -250,
-    -241,   -233,   -224,   -216,
-    -208,   -200,   -192,   -185,
-    -177,   -170,   -163,   -156,
-    -149,   -142,   -136,   -129,
-    -123,   -117,   -111,   -105,
-    -100,    -94,    -89,    -84,
-     -79,    -74,    -69,    -65,
-     -60,    -56,    -52,    -48,
-     -44,    -41,    -37,    -34,
-     -31,    -28,    -25,    -22,
-     -20,    -17,    -15,    -13,
-     -11,     -9,     -8,     -6,
-      -5,     -4,     -3,     -2,
-      -1,     -1,      0,      0,
-       0,      0,      0,      1,
-       1,      2,      3,      4,
-       5,      6,      8,      9,
-      11,     13,     15,     17,
-      20,     22,     25,     28,
-      31,     34,     37,     41,
-      44,     48,     52,     56,
-      60,     65,     69,     74,
-      79,     84,     89,     94,
-     100,    105,    111,    117,
-     123,    129,    136,    142,
-     149,    156,    163,    170,
-     177,    185,    192,    200,
-     208,    216,    224,    233,
-     241,    250,    259,    268,
-     277,    286,    295,    305,
-     315,    325,    335,    345,
-     355,    366,    376,    387,
-     398,    409,    420,    432,
-     443,    455,    467,    479,
-     491,    503,    516,    528,
-     541,    554,    567,    580,
-     593,    607,    621,    634,
-     648,    662,    677,    691,
-     705,    720,    735,    750,
-     765,    780,    796,    811,
-     827,    843,    859,    875,
-     891,    908,    924,    941,
-     958,    975,    992,   1009,
-    1027,   1044,   1062,   1080,
-    1098,   1116,   1134,   1153,
-    1171,   1190,   1209,   1228,
-    1247,   1266,   1286,   1305,
-    1325,   1345,   1365,   1385,
-    1406,   1426,   1447,   1467,
-    1488,   1509,   1530,   1552,
-    1573,   1595,   1616,   1638,
-    1660,   1682,   1704,   1727,
-    1749,   1772,   1795,   1818,
-    1841,   1864,   1887,   1911,
-    1935,   1958,   1982,   2006,
-    2030,   2055,   2079,   2104,
-    2128,   2153,   2178,   2203,
-    2229,   2254,   2279,   2305,
-    2331,   2357,   2383,   2409,
-    2435,   2462,   2488,   2515,
-    2542,   2569,   2596,   2623,
-    2650,   2678,   2706,   2733,
-    2761,   2789,   2817,   2845,
-    2874,   2902,   2931,   2960,
-    2989,   3018,   3047,   3076,
-    3105,   3135,   3165,   3194,
-    3224,   3254,   3284,   3315,
-    3345,   3375,   3406,   3437,
-    3468,   3499,   3530,   3561,
-    3592,   3624,   3655,   3687,
-    3719,   3751,   3783,   3815,
-    3847,   3880,   3912,   3945,
-    3978,   4011,   4044,   4077,
-    4110,   4143,   4177,   4210,
-    4244,   4278,   4312,   4346,
-    4380,   4414,   4449,   4483,
-    4518,   4553,   4587,   4622,
-    4657,   4692,   4728,   4763,
-    4799,   4834,   4870,   4906,
-    4942,   4978,   5014,   5050,
-    5086,   5123,   5159,   5196,
-    5233,   5270,   5307,   5344,
-    5381,   5418,   5456,   5493,
-    5531,   5569,   5606,   5644,
-    5682,   5720,   5759,   5797,
-    5835,   5874,   5912,   5951,
-    5990,   6029,   6068,   6107,
-    6146,   6185,   6225,   6264,
-    6304,   6344,   6383,   6423,
-    6463,   6503,   6543,   6584,
-    6624,   6664,   6705,   6745,
-    6786,   6827,   6868,   6909,
-    6950,   6991,   7032,   7073,
-    7115,   7156,   7198,   7240,
-    7281,   7323,   7365,   7407,
-    7449,   7491,   7534,   7576,
-    7618,   7661,   7703,   7746,
-    7789,   7832,   7875,   7918,
-    7961,   8004,   8047,   8090,
-    8134,   8177,   8221,   8264,
-    8308,   8352,   8396,   8440,
-    8484,   8528,   8572,   8616,
-    8660,   8705,   8749,   8794,
-    8838,   8883,   8928,   8972,
-    9017,   9062,   9107,   9152,
-    9197,   9243,   9288,   9333,
-    9379,   9424,   9470,   9515,
-    9561,   9607,   9652,   9698,
-    9744,   9790,   9836,   9882,
-    9929,   9975,  10021,  10067,
-   10114,  10160,  10207,  10253,
-   10300,  10347,  10393,  10440,
-   10487,  10534,  10581,  10628,
-   10675,  10722,  10770,  10817,
-   10864,  10911,  10959,  11006,
-   11054,  11101,  11149,  11197,
-   11244,  11292,  11340,  11388,
-   11436,  11484,  11532,  11580,
-   11628,  11676,  11724,  11772,
-   11820,  11869,  11917,  11965,
-   12014,  12062,  12111,  12159,
-   12208,  12257,  12305,  12354,
-   12403,  12451,  12500,  12549,
-   12598,  12647,  12696,  12745,
-   12794,  12843,  12892,  12941,
-   12990,  13039,  13089,  13138,
-   13187,  13237,  13286,  13335,
-   13385,  13434,  13484,  13533,
-   13583,  13632,  13682,  13731,
-   13781,  13830,  13880,  13930,
-   13980,  14029,  14079,  14129,
-   14179,  14228,  14278,  14328,
-   14378,  14428,  14478,  14528,
-   14578,  14628,  14678,  14728,
-   14778,  14828,  14878,  14928,
-   14978,  15028,  15078,  15128,
-   15178,  15228,  15279,  15329,
-   15379,  15429,  15479,  15529,
-   15580,  15630,  15680,  15730,
-   15780,  15831,  15881,  15931,
-   15981,  16032,  16082,  16132,
-   16182,  16233,  16283,  16333,
-   16383,  16434,  16484,  16534,
-   16585,  16635,  16685,  16735,
-   16786,  16836,  16886,  16936,
-   16987,  17037,  17087,  17137,
-   17187,  17238,  17288,  17338,
-   17388,  17438,  17488,  17539,
-   17589,  17639,  17689,  17739,
-   17789,  17839,  17889,  17939,
-   17989,  18039,  18089,  18139,
-   18189,  18239,  18289,  18339,
-   18389,  18439,  18489,  18539,
-   18588,  18638,  18688,  18738,
-   18787,  18837,  18887,  18937,
-   18986,  19036,  19085,  19135,
-   19184,  19234,  19283,  19333,
-   19382,  19432,  19481,  19530,
-   19580,  19629,  19678,  19728,
-   19777,  19826,  19875,  19924,
-   19973,  20022,  20071,  20120,
-   20169,  20218,  20267,  20316,
-   20364,  20413,  20462,  20510,
-   20559,  20608,  20656,  20705,
-   20753,  20802,  20850,  20898,
-   20947,  20995,  21043,  21091,
-   21139,  21187,  21235,  21283,
-   21331,  21379,  21427,  21475,
-   21523,  21570,  21618,  21666,
-   21713,  21761,  21808,  21856,
-   21903,  21950,  21997,  22045,
-   22092,  22139,  22186,  22233,
-   22280,  22327,  22374,  22420,
-   22467,  22514,  22560,  22607,
-   22653,  22700,  22746,  22792,
-   22838,  22885,  22931,  22977,
-   23023,  23069,  23115,  23160,
-   23206,  23252,  23297,  23343,
-   23388,  23434,  23479,  23524,
-   23570,  23615,  23660,  23705,
-   23750,  23795,  23839,  23884,
-   23929,  23973,  24018,  24062,
-   24107,  24151,  24195,  24239,
-   24283,  24327,  24371,  24415,
-   24459,  24503,  24546,  24590,
-   24633,  24677,  24720,  24763,
-   24806,  24849,  24892,  24935,
-   24978,  25021,  25064,  25106,
-   25149,  25191,  25233,  25276,
-   25318,  25360,  25402,  25444,
-   25486,  25527,  25569,  25611,
-   25652,  25694,  25735,  25776,
-   25817,  25858,  25899,  25940,
-   25981,  26022,  26062,  26103,
-   26143,  26183,  26224,  26264,
-   26304,  26344,  26384,  26423,
-   26463,  26503,  26542,  26582,
-   26621,  26660,  26699,  26738,
-   26777,  26816,  26855,  26893,
-   26932,  26970,  27008,  27047,
-   27085,  27123,  27161,  27198,
-   27236,  27274,  27311,  27349,
-   27386,  27423,  27460,  27497,
-   27534,  27571,  27608,  27644,
-   27681,  27717,  27753,  27789,
-   27825,  27861,  27897,  27933,
-   27968,  28004,  28039,  28075,
-   28110,  28145,  28180,  28214,
-   28249,  28284,  28318,  28353,
-   28387,  28421,  28455,  28489,
-   28523,  28557,  28590,  28624,
-   28657,  28690,  28723,  28756,
-   28789,  28822,  28855,  28887,
-   28920,  28952,  28984,  29016,
-   29048,  29080,  29112,  29143,
-   29175,  29206,  29237,  29268,
-   29299,  29330,  29361,  29392,
-   29422,  29452,  29483,  29513,
-   29543,  29573,  29602,  29632,
-   29662,  29691,  29720,  29749,
-   29778,  29807,  29836,  29865,
-   29893,  29922,  29950,  29978,
-   30006,  30034,  30061,  30089,
-   30117,  30144,  30171,  30198,
-   30225,  30252,  30279,  30305,
-   30332,  30358,  30384,  30410,
-   30436,  30462,  30488,  30513,
-   30538,  30564,  30589,  30614,
-   30639,  30663,  30688,  30712,
-   30737,  30761,  30785,  30809,
-   30832,  30856,  30880,  30903,
-   30926,  30949,  30972,  30995,
-   31018,  31040,  31063,  31085,
-   31107,  31129,  31151,  31172,
-   31194,  31215,  31237,  31258,
-   31279,  31300,  31320,  31341,
-   31361,  31382,  31402,  31422,
-   31442,  31462,  31481,  31501,
-   31520,  31539,  31558,  31577,
-   31596,  31614,  31633,  31651,
-   31669,  31687,  31705,  31723,
-   31740,  31758,  31775,  31792,
-   31809,  31826,  31843,  31859,
-   31876,  31892,  31908,  31924,
-   31940,  31956,  31971,  31987,
-   32002,  32017,  32032,  32047,
-   32062,  32076,  32090,  32105,
-   32119,  32133,  32146,  32160,
-   32174,  32187,  32200,  32213,
-   32226,  32239,  32251,  32264,
-   32276,  32288,  32300,  32312,
-   32324,  32335,  32347,  32358,
-   32369,  32380,  32391,  32401,
-   32412,  32422,  32432,  32442,
-   32452,  32462,  32472,  32481,
-   32490,  32499,  32508,  32517,
-   32526,  32534,  32543,  32551,
-   32559,  32567,  32575,  32582,
-   32590,  32597,  32604,  32611,
-   32618,  32625,  32631,  32638,
-   32644,  32650,  32656,  32662,
-   32667,  32673,  32678,  32683,
-   32688,  32693,  32698,  32702,
-   32707,  32711,  32715,  32719,
-   32723,  32726,  32730,  32733,
-   32736,  32739,  32742,  32745,
-   32747,  32750,  32752,  32754,
-   32756,  32758,  32759,  32761,
-   32762,  32763,  32764,  32765,
-   32766,  32766,  32767,  32767,
-   32767,
-};
-
-const int16_t wav_tan_audio[] = {
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32765, -32765, -32765, -32765,
-  -32764, -32764, -32764, -32764,
-  -32763, -32763, -32763, -32762,
-  -32762, -32761, -32761, -32761,
-  -32760, -32760, -32759, -32759,
-  -32758, -32758, -32757, -32757,
-  -32756, -32756, -32755, -32755,
-  -32754, -32754, -32753, -32752,
-  -32752, -32751, -32750, -32750,
-  -32749, -32748, -32748, -32747,
-  -32746, -32745, -32745, -32744,
-  -32743, -32742, -32741, -32741,
-  -32740, -32739, -32738, -32737,
-  -32736, -32735, -32734, -32733,
-  -32732, -32731, -32730, -32729,
-  -32728, -32727, -32726, -32725,
-  -32724, -32723, -32722, -32721,
-  -32719, -32718, -32717, -32716,
-  -32715, -32713, -32712, -32711,
-  -32710, -32708, -32707, -32706,
-  -32704, -32703, -32702, -32700,
-  -32699, -32697, -32696, -32694,
-  -32693, -32691, -32690, -32688,
-  -32687, -32685, -32684, -32682,
-  -32681, -32679, -32677, -32676,
-  -32674, -32672, -32670, -32669,
-  -32667, -32665, -32663, -32662,
-  -32660, -32658, -32656, -32654,
-  -32652, -32650, -32648, -32646,
-  -32644, -32642, -32640, -32638,
-  -32636, -32634, -32632, -32630,
-  -32628, -32626, -32624, -32621,
-  -32619, -32617, -32615, -32612,
-  -32610, -32608, -32605, -32603,
-  -32601, -32598, -32596, -32593,
-  -32591, -32588, -32586, -32583,
-  -32581, -32578, -32576, -32573,
-  -32570, -32568, -32565, -32562,
-  -32559, -32557, -32554, -32551,
-  -32548, -32545, -32542, -32539,
-  -32536, -32533, -32530, -32527,
-  -32524, -32521, -32518, -32515,
-  -32512, -32509, -32505, -32502,
-  -32499, -32495, -32492, -32489,
-  -32485, -32482, -32478, -32475,
-  -32471, -32468, -32464, -32461,
-  -32457, -32453, -32450, -32446,
-  -32442, -32438, -32435, -32431,
-  -32427, -32423, -32419, -32415,
-  -32411, -32407, -32403, -32399,
-  -32394, -32390, -32386, -32382,
-  -32377, -32373, -32369, -32364,
-  -32360, -32355, -32351, -32346,
-  -32341, -32337, -32332, -32327,
-  -32322, -32318, -32313, -32308,
-  -32303, -32298, -32293, -32288,
-  -32283, -32277, -32272, -32267,
-  -32261, -32256, -32251, -32245,
-  -32240, -32234, -32229, -32223,
-  -32217, -32211, -32206, -32200,
-  -32194, -32188, -32182, -32176,
-  -32169, -32163, -32157, -32151,
-  -32144, -32138, -32131, -32125,
-  -32118, -32112, -32105, -32098,
-  -32091, -32084, -32077, -32070,
-  -32063, -32056, -32049, -32041,
-  -32034, -32026, -32019, -32011,
-  -32003, -31996, -31988, -31980,
-  -31972, -31964, -31956, -31948,
-  -31939, -31931, -31922, -31914,
-  -31905, -31896, -31888, -31879,
-  -31870, -31861, -31851, -31842,
-  -31833, -31823, -31814, -31804,
-  -31794, -31784, -31774, -31764,
-  -31754, -31744, -31734, -31723,
-  -31712, -31702, -31691, -31680,
-  -31669, -31658, -31646, -31635,
-  -31623, -31612, -31600, -31588,
-  -31576, -31564, -31551, -31539,
-  -31526, -31513, -31500, -31487,
-  -31474, -31461, -31447, -31433,
-  -31419, -31405, -31391, -31377,
-  -31362, -31348, -31333, -31318,
-  -31302, -31287, -31271, -31256,
-  -31240, -31223, -31207, -31190,
-  -31174, -31156, -31139, -31122,
-  -31104, -31086, -31068, -31050,
-  -31031, -31012, -30993, -30973,
-  -30954, -30934, -30914, -30893,
-  -30873, -30851, -30830, -30809,
-  -30787, -30764, -30742, -30719,
-  -30696, -30672, -30648, -30624,
-  -30600, -30575, -30549, -30524,
-  -30497, -30471, -30444, -30417,
-  -30389, -30361, -30332, -30303,
-  -30274, -30244, -30214, -30183,
-  -30151, -30119, -30087, -30054,
-  -30020, -29986, -29951, -29916,
-  -29880, -29844, -29807, -29769,
-  -29731, -29691, -29652, -29611,
-  -29570, -29528, -29485, -29442,
-  -29397, -29352, -29306, -29259,
-  -29211, -29163, -29113, -29062,
-  -29011, -28958, -28904, -28850,
-  -28794, -28737, -28679, -28619,
-  -28559, -28497, -28434, -28369,
-  -28303, -28236, -28167, -28097,
-  -28025, -27951, -27876, -27800,
-  -27721, -27641, -27559, -27475,
-  -27389, -27301, -27211, -27119,
-  -27025, -26928, -26829, -26728,
-  -26624, -26518, -26409, -26298,
-  -26183, -26066, -25946, -25823,
-  -25697, -25568, -25436, -25300,
-  -25161, -25018, -24872, -24722,
-  -24569, -24411, -24250, -24085,
-  -23916, -23742, -23565, -23383,
-  -23197, -23006, -22812, -22612,
-  -22409, -22200, -21988, -21771,
-  -21549, -21323, -21093, -20859,
-  -20620, -20378, -20131, -19881,
-  -19627, -19370, -19109, -18846,
-  -18579, -18311, -18040, -17767,
-  -17492, -17216, -16939, -16661,
-  -16383, -16106, -15828, -15551,
-  -15275, -15000, -14727, -14456,
-  -14188, -13921, -13658, -13397,
-  -13140, -12886, -12636, -12389,
-  -12147, -11908, -11674, -11444,
-  -11218, -10996, -10779, -10567,
-  -10358, -10155,  -9955,  -9761,
-   -9570,  -9384,  -9202,  -9025,
-   -8851,  -8682,  -8517,  -8356,
-   -8198,  -8045,  -7895,  -7749,
-   -7606,  -7467,  -7331,  -7199,
-   -7070,  -6944,  -6821,  -6701,
-   -6584,  -6469,  -6358,  -6249,
-   -6143,  -6039,  -5938,  -5839,
-   -5742,  -5648,  -5556,  -5466,
-   -5378,  -5292,  -5208,  -5126,
-   -5046,  -4967,  -4891,  -4816,
-   -4742,  -4670,  -4600,  -4531,
-   -4464,  -4398,  -4333,  -4270,
-   -4208,  -4148,  -4088,  -4030,
-   -3973,  -3917,  -3863,  -3809,
-   -3756,  -3705,  -3654,  -3604,
-   -3556,  -3508,  -3461,  -3415,
-   -3370,  -3325,  -3282,  -3239,
-   -3197,  -3156,  -3115,  -3076,
-   -3036,  -2998,  -2960,  -2923,
-   -2887,  -2851,  -2816,  -2781,
-   -2747,  -2713,  -2680,  -2648,
-   -2616,  -2584,  -2553,  -2523,
-   -2493,  -2464,  -2435,  -2406,
-   -2378,  -2350,  -2323,  -2296,
-   -2270,  -2243,  -2218,  -2192,
-   -2167,  -2143,  -2119,  -2095,
-   -2071,  -2048,  -2025,  -2003,
-   -1980,  -1958,  -1937,  -1916,
-   -1894,  -1874,  -1853,  -1833,
-   -1813,  -1794,  -1774,  -1755,
-   -1736,  -1717,  -1699,  -1681,
-   -1663,  -1645,  -1628,  -1611,
-   -1593,  -1577,  -1560,  -1544,
-   -1527,  -1511,  -1496,  -1480,
-   -1465,  -1449,  -1434,  -1419,
-   -1405,  -1390,  -1376,  -1362,
-   -1348,  -1334,  -1320,  -1306,
-   -1293,  -1280,  -1267,  -1254,
-   -1241,  -1228,  -1216,  -1203,
-   -1191,  -1179,  -1167,  -1155,
-   -1144,  -1132,  -1121,  -1109,
-   -1098,  -1087,  -1076,  -1065,
-   -1055,  -1044,  -1033,  -1023,
-   -1013,  -1003,   -993,   -983,
-    -973,   -963,   -953,   -944,
-    -934,   -925,   -916,   -906,
-    -897,   -888,   -879,   -871,
-    -862,   -853,   -845,   -836,
-    -828,   -819,   -811,   -803,
-    -795,   -787,   -779,   -771,
-    -764,   -756,   -748,   -741,
-    -733,   -726,   -718,   -711,
-    -704,   -697,   -690,   -683,
-    -676,   -669,   -662,   -655,
-    -649,   -642,   -636,   -629,
-    -623,   -616,   -610,   -604,
-    -598,   -591,   -585,   -579,
-    -573,   -567,   -561,   -556,
-    -550,   -544,   -538,   -533,
-    -527,   -522,   -516,   -511,
-    -506,   -500,   -495,   -490,
-    -484,   -479,   -474,   -469,
-    -464,   -459,   -454,   -449,
-    -445,   -440,   -435,   -430,
-    -426,   -421,   -416,   -412,
-    -407,   -403,   -398,   -394,
-    -390,   -385,   -381,   -377,
-    -373,   -368,   -364,   -360,
-    -356,   -352,   -348,   -344,
-    -340,   -336,   -332,   -329,
-    -325,   -321,   -317,   -314,
-    -310,   -306,   -303,   -299,
-    -296,   -292,   -289,   -285,
-    -282,   -278,   -275,   -272,
-    -268,   -265,   -262,   -258,
-    -255,   -252,   -249,   -246,
-    -243,   -240,   -237,   -234,
-    -231,   -228,   -225,   -222,
-    -219,   -216,   -213,   -210,
-    -208,   -205,   -202,   -199,
-    -197,   -194,   -191,   -189,
-    -186,   -184,   -181,   -179,
-    -176,   -174,   -171,   -169,
-    -166,   -164,   -162,   -159,
-    -157,   -155,   -152,   -150,
-    -148,   -146,   -143,   -141,
-    -139,   -137,   -135,   -133,
-    -131,   -129,   -127,   -125,
-    -123,   -121,   -119,   -117,
-    -115,   -113,   -111,   -109,
-    -107,   -105,   -104,   -102,
-    -100,    -98,    -97,    -95,
-     -93,    -91,    -90,    -88,
-     -86,    -85,    -83,    -82,
-     -80,    -79,    -77,    -76,
-     -74,    -73,    -71,    -70,
-     -68,    -67,    -65,    -64,
-     -63,    -61,    -60,    -59,
-     -57,    -56,    -55,    -54,
-     -52,    -51,    -50,    -49,
-     -48,    -46,    -45,    -44,
-     -43,    -42,    -41,    -40,
-     -39,    -38,    -37,    -36,
-     -35,    -34,    -33,    -32,
-     -31,    -30,    -29,    -28,
-     -27,    -26,    -26,    -25,
-     -24,    -23,    -22,    -22,
-     -21,    -20,    -19,    -19,
-     -18,    -17,    -17,    -16,
-     -15,    -15,    -14,    -13,
-     -13,    -12,    -12,    -11,
-     -11,    -10,    -10,     -9,
-      -9,     -8,     -8,     -7,
-      -7,     -6,     -6,     -6,
-      -5,     -5,     -4,     -4,
-      -4,     -3,     -3,     -3,
-      -3,     -2,     -2,     -2,
-      -2,     -1,     -1,     -1,
-      -1,     -1,     -1,     -1,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      1,      1,      1,
-       1,      1,      1,      1,
-       2,      2,      2,      2,
-       3,      3,      3,      3,
-       4,      4,      4,      5,
-       5,      6,      6,      6,
-       7,      7,      8,      8,
-       9,      9,     10,     10,
-      11,     11,     12,     12,
-      13,     13,     14,     15,
-      15,     16,     17,     17,
-      18,     19,     19,     20,
-      21,     22,     22,     23,
-      24,     25,     26,     26,
-      27,     28,     29,     30,
-      31,     32,     33,     34,
-      35,     36,     37,     38,
-      39,     40,     41,     42,
-      43,     44,     45,     46,
-      48,     49,     50,     51,
-      52,     54,     55,     56,
-      57,     59,     60,     61,
-      63,     64,     65,     67,
-      68,     70,     71,     73,
-      74,     76,     77,     79,
-      80,     82,     83,     85,
-      86,     88,     90,     91,
-      93,     95,     97,     98,
-     100,    102,    104,    105,
-     107,    109,    111,    113,
-     115,    117,    119,    121,
-     123,    125,    127,    129,
-     131,    133,    135,    137,
-     139,    141,    143,    146,
-     148,    150,    152,    155,
-     157,    159,    162,    164,
-     166,    169,    171,    174,
-     176,    179,    181,    184,
-     186,    189,    191,    194,
-     197,    199,    202,    205,
-     208,    210,    213,    216,
-     219,    222,    225,    228,
-     231,    234,    237,    240,
-     243,    246,    249,    252,
-     255,    258,    262,    265,
-     268,    272,    275,    278,
-     282,    285,    289,    292,
-     296,    299,    303,    306,
-     310,    314,    317,    321,
-     325,    329,    332,    336,
-     340,    344,    348,    352,
-     356,    360,    364,    368,
-     373,    377,    381,    385,
-     390,    394,    398,    403,
-     407,    412,    416,    421,
-     426,    430,    435,    440,
-     445,    449,    454,    459,
-     464,    469,    474,    479,
-     484,    490,    495,    500,
-     506,    511,    516,    522,
-     527,    533,    538,    544,
-     550,    556,    561,    567,
-     573,    579,    585,    591,
-     598,    604,    610,    616,
-     623,    629,    636,    642,
-     649,    655,    662,    669,
-     676,    683,    690,    697,
-     704,    711,    718,    726,
-     733,    741,    748,    756,
-     764,    771,    779,    787,
-     795,    803,    811,    819,
-     828,    836,    845,    853,
-     862,    871,    879,    888,
-     897,    906,    916,    925,
-     934,    944,    953,    963,
-     973,    983,    993,   1003,
-    1013,   1023,   1033,   1044,
-    1055,   1065,   1076,   1087,
-    1098,   1109,   1121,   1132,
-    1144,   1155,   1167,   1179,
-    1191,   1203,   1216,   1228,
-    1241,   1254,   1267,   1280,
-    1293,   1306,   1320,   1334,
-    1348,   1362,   1376,   1390,
-    1405,   1419,   1434,   1449,
-    1465,   1480,   1496,   1511,
-    1527,   1544,   1560,   1577,
-    1593,   1611,   1628,   1645,
-    1663,   1681,   1699,   1717,
-    1736,   1755,   1774,   1794,
-    1813,   1833,   1853,   1874,
-    1894,   1916,   1937,   1958,
-    1980,   2003,   2025,   2048,
-    2071,   2095,   2119,   2143,
-    2167,   2192,   2218,   2243,
-    2270,   2296,   2323,   2350,
-    2378,   2406,   2435,   2464,
-    2493,   2523,   2553,   2584,
-    2616,   2648,   2680,   2713,
-    2747,   2781,   2816,   2851,
-    2887,   2923,   2960,   2998,
-    3036,   3076,   3115,   3156,
-    3197,   3239,   3282,   3325,
-    3370,   3415,   3461,   3508,
-    3556,   3604,   3654,   3705,
-    3756,   3809,   3863,   3917,
-    3973,   4030,   4088,   4148,
-    4208,   4270,   4333,   4398,
-    4464,   4531,   4600,   4670,
-    4742,   4816,   4891,   4967,
-    5046,   5126,   5208,   5292,
-    5378,   5466,   5556,   5648,
-    5742,   5839,   5938,   6039,
-    6143,   6249,   6358,   6469,
-    6584,   6701,   6821,   6944,
-    7070,   7199,   7331,   7467,
-    7606,   7749,   7895,   8045,
-    8198,   8356,   8517,   8682,
-    8851,   9025,   9202,   9384,
-    9570,   9761,   9955,  10155,
-   10358,  10567,  10779,  10996,
-   11218,  11444,  11674,  11908,
-   12147,  12389,  12636,  12886,
-   13140,  13397,  13658,  13921,
-   14188,  14456,  14727,  15000,
-   15275,  15551,  15828,  16106,
-   16383,  16661,  16939,  17216,
-   17492,  17767,  18040,  18311,
-   18579,  18846,  19109,  19370,
-   19627,  19881,  20131,  20378,
-   20620,  20859,  21093,  21323,
-   21549,  21771,  21988,  22200,
-   22409,  22612,  22812,  23006,
-   23197,  23383,  23565,  23742,
-   23916,  24085,  24250,  24411,
-   24569,  24722,  24872,  25018,
-   25161,  25300,  25436,  25568,
-   25697,  25823,  25946,  26066,
-   26183,  26298,  26409,  26518,
-   26624,  26728,  26829,  26928,
-   27025,  27119,  27211,  27301,
-   27389,  27475,  27559,  27641,
-   27721,  27800,  27876,  27951,
-   28025,  28097,  28167,  28236,
-   28303,  28369,  28434,  28497,
-   28559,  28619,  28679,  28737,
-   28794,  28850,  28904,  28958,
-   29011,  29062,  29113,  29163,
-   29211,  29259,  29306,  29352,
-   29397,  29442,  29485,  29528,
-   29570,  29611,  29652,  29691,
-   29731,  29769,  29807,  29844,
-   29880,  29916,  29951,  29986,
-   30020,  30054,  30087,  30119,
-   30151,  30183,  30214,  30244,
-   30274,  30303,  30332,  30361,
-   30389,  30417,  30444,  30471,
-   30497,  30524,  30549,  30575,
-   30600,  30624,  30648,  30672,
-   30696,  30719,  30742,  30764,
-   30787,  30809,  30830,  30851,
-   30873,  30893,  30914,  30934,
-   30954,  30973,  30993,  31012,
-   31031,  31050,  31068,  31086,
-   31104,  31122,  31139,  31156,
-   31174,  31190,  31207,  31223,
-   31240,  31256,  31271,  31287,
-   31302,  31318,  31333,  31348,
-   31362,  31377,  31391,  31405,
-   31419,  31433,  31447,  31461,
-   31474,  31487,  31500,  31513,
-   31526,  31539,  31551,  31564,
-   31576,  31588,  31600,  31612,
-   31623,  31635,  31646,  31658,
-   31669,  31680,  31691,  31702,
-   31712,  31723,  31734,  31744,
-   31754,  31764,  31774,  31784,
-   31794,  31804,  31814,  31823,
-   31833,  31842,  31851,  31861,
-   31870,  31879,  31888,  31896,
-   31905,  31914,  31922,  31931,
-   31939,  31948,  31956,  31964,
-   31972,  31980,  31988,  31996,
-   32003,  32011,  32019,  32026,
-   32034,  32041,  32049,  32056,
-   32063,  32070,  32077,  32084,
-   32091,  32098,  32105,  32112,
-   32118,  32125,  32131,  32138,
-   32144,  32151,  32157,  32163,
-   32169,  32176,  32182,  32188,
-   32194,  32200,  32206,  32211,
-   32217,  32223,  32229,  32234,
-   32240,  32245,  32251,  32256,
-   32261,  32267,  32272,  32277,
-   32283,  32288,  32293,  32298,
-   32303,  32308,  32313,  32318,
-   32322,  32327,  32332,  32337,
-   32341,  32346,  32351,  32355,
-   32360,  32364,  32369,  32373,
-   32377,  32382,  32386,  32390,
-   32394,  32399,  32403,  32407,
-   32411,  32415,  32419,  32423,
-   32427,  32431,  32435,  32438,
-   32442,  32446,  32450,  32453,
-   32457,  32461,  32464,  32468,
-   32471,  32475,  32478,  32482,
-   32485,  32489,  32492,  32495,
-   32499,  32502,  32505,  32509,
-   32512,  32515,  32518,  32521,
-   32524,  32527,  32530,  32533,
-   32536,  32539,  32542,  32545,
-   32548,  32551,  32554,  32557,
-   32559,  32562,  32565,  32568,
-   32570,  32573,  32576,  32578,
-   32581,  32583,  32586,  32588,
-   32591,  32593,  32596,  32598,
-   32601,  32603,  32605,  32608,
-   32610,  32612,  32615,  32617,
-   32619,  32621,  32624,  32626,
-   32628,  32630,  32632,  32634,
-   32636,  32638,  32640,  32642,
-   32644,  32646,  32648,  32650,
-   32652,  32654,  32656,  32658,
-   32660,  32662,  32663,  32665,
-   32667,  32669,  32670,  32672,
-   32674,  32676,  32677,  32679,
-   32681,  32682,  32684,  32685,
-   32687,  32688,  32690,  32691,
-   32693,  32694,  32696,  32697,
-   32699,  32700,  32702,  32703,
-   32704,  32706,  32707,  32708,
-   32710,  32711,  32712,  32713,
-   32715,  32716,  32717,  32718,
-   32719,  32721,  32722,  32723,
-   32724,  32725,  32726,  32727,
-   32728,  32729,  32730,  32731,
-   32732,  32733,  32734,  32735,
-   32736,  32737,  32738,  32739,
-   32740,  32741,  32741,  32742,
-   32743,  32744,  32745,  32745,
-   32746,  32747,  32748,  32748,
-   32749,  32750,  32750,  32751,
-   32752,  32752,  32753,  32754,
-   32754,  32755,  32755,  32756,
-   32756,  32757,  32757,  32758,
-   32758,  32759,  32759,  32760,
-   32760,  32761,  32761,  32761,
-   32762,  32762,  32763,  32763,
-   32763,  32764,  32764,  32764,
-   32764,  32765,  32765,  32765,
-   32765,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,
-};
-
 const int16_t wav_reversed_control[] = {
        0,      0,      0,      0,
        0,      0,      0,      1,
@@ -9228,528 +6345,6 @@ const int16_t wav_normal_control[] = {
        0,
 };
 
-const int16_t wav_bipolar_fold[] = {
-  -32767, -32751, -32735, -32718,
-  -32702, -32685, -32668, -32652,
-  -32635, -32618, -32601, -32584,
-  -32567, -32549, -32532, -32514,
-  -32497, -32479, -32461, -32444,
-  -32426, -32408, -32390, -32371,
-  -32353, -32335, -32317, -32298,
-  -32280, -32261, -32242, -32224,
-  -32205, -32186, -32167, -32149,
-  -32130, -32111, -32092, -32073,
-  -32054, -32035, -32016, -31997,
-  -31978, -31958, -31939, -31920,
-  -31901, -31882, -31863, -31844,
-  -31825, -31806, -31788, -31769,
-  -31750, -31731, -31712, -31694,
-  -31675, -31656, -31638, -31619,
-  -31601, -31582, -31564, -31545,
-  -31527, -31508, -31490, -31472,
-  -31453, -31435, -31416, -31398,
-  -31379, -31361, -31342, -31324,
-  -31305, -31286, -31267, -31248,
-  -31229, -31210, -31190, -31170,
-  -31151, -31130, -31110, -31089,
-  -31068, -31047, -31025, -31003,
-  -30981, -30958, -30934, -30911,
-  -30886, -30862, -30836, -30810,
-  -30784, -30757, -30729, -30700,
-  -30671, -30641, -30611, -30579,
-  -30547, -30514, -30480, -30445,
-  -30410, -30373, -30336, -30297,
-  -30258, -30218, -30177, -30135,
-  -30092, -30048, -30003, -29957,
-  -29910, -29863, -29814, -29764,
-  -29714, -29663, -29610, -29557,
-  -29504, -29449, -29394, -29338,
-  -29282, -29224, -29167, -29109,
-  -29050, -28991, -28932, -28872,
-  -28812, -28752, -28692, -28632,
-  -28573, -28513, -28453, -28394,
-  -28336, -28277, -28220, -28163,
-  -28107, -28051, -27997, -27943,
-  -27891, -27840, -27790, -27741,
-  -27694, -27648, -27604, -27561,
-  -27520, -27481, -27444, -27408,
-  -27375, -27343, -27314, -27286,
-  -27261, -27238, -27217, -27197,
-  -27180, -27166, -27153, -27142,
-  -27133, -27127, -27122, -27119,
-  -27118, -27118, -27120, -27124,
-  -27129, -27135, -27143, -27152,
-  -27161, -27171, -27182, -27193,
-  -27204, -27215, -27226, -27237,
-  -27246, -27255, -27263, -27270,
-  -27274, -27277, -27278, -27276,
-  -27272, -27265, -27254, -27240,
-  -27222, -27201, -27174, -27144,
-  -27108, -27067, -27021, -26970,
-  -26912, -26848, -26778, -26701,
-  -26618, -26527, -26430, -26325,
-  -26212, -26092, -25964, -25828,
-  -25684, -25532, -25372, -25203,
-  -25027, -24842, -24650, -24449,
-  -24240, -24023, -23799, -23567,
-  -23328, -23081, -22827, -22567,
-  -22300, -22028, -21749, -21465,
-  -21176, -20883, -20585, -20283,
-  -19979, -19671, -19362, -19051,
-  -18738, -18425, -18113, -17801,
-  -17490, -17181, -16875, -16572,
-  -16274, -15979, -15690, -15408,
-  -15131, -14862, -14601, -14349,
-  -14106, -13873, -13651, -13440,
-  -13241, -13054, -12880, -12719,
-  -12573, -12441, -12323, -12221,
-  -12135, -12065, -12011, -11974,
-  -11953, -11950, -11963, -11994,
-  -12041, -12106, -12188, -12287,
-  -12403, -12535, -12684, -12848,
-  -13028, -13223, -13433, -13657,
-  -13893, -14143, -14405, -14678,
-  -14961, -15253, -15555, -15864,
-  -16179, -16500, -16825, -17154,
-  -17485, -17817, -18148, -18478,
-  -18805, -19128, -19446, -19757,
-  -20059, -20352, -20635, -20905,
-  -21162, -21404, -21629, -21838,
-  -22027, -22197, -22345, -22472,
-  -22575, -22653, -22706, -22732,
-  -22730, -22701, -22642, -22553,
-  -22433, -22283, -22100, -21886,
-  -21639, -21359, -21047, -20701,
-  -20322, -19910, -19466, -18988,
-  -18479, -17938, -17366, -16764,
-  -16132, -15471, -14783, -14068,
-  -13327, -12562, -11773, -10963,
-  -10133,  -9285,  -8419,  -7539,
-   -6645,  -5739,  -4824,  -3901,
-   -2973,  -2042,  -1109,   -177,
-     752,   1676,   2592,   3499,
-    4394,   5274,   6138,   6983,
-    7807,   8608,   9383,  10132,
-   10850,  11538,  12192,  12810,
-   13391,  13934,  14435,  14895,
-   15311,  15682,  16006,  16284,
-   16512,  16692,  16821,  16899,
-   16926,  16901,  16823,  16694,
-   16512,  16278,  15993,  15656,
-   15267,  14829,  14342,  13806,
-   13223,  12594,  11921,  11204,
-   10447,   9649,   8814,   7944,
-    7040,   6105,   5141,   4151,
-    3136,   2101,   1047,    -23,
-   -1106,  -2199,  -3300,  -4404,
-   -5510,  -6614,  -7713,  -8805,
-   -9885, -10952, -12002, -13032,
-  -14039, -15021, -15974, -16897,
-  -17785, -18636, -19449, -20220,
-  -20948, -21629, -22263, -22846,
-  -23377, -23855, -24278, -24644,
-  -24952, -25201, -25390, -25518,
-  -25585, -25590, -25532, -25413,
-  -25231, -24986, -24681, -24314,
-  -23886, -23399, -22854, -22251,
-  -21592, -20879, -20113, -19296,
-  -18431, -17518, -16562, -15562,
-  -14524, -13448, -12338, -11196,
-  -10025,  -8829,  -7610,  -6372,
-   -5117,  -3850,  -2572,  -1288,
-       0,   1288,   2572,   3850,
-    5117,   6372,   7610,   8829,
-   10025,  11196,  12338,  13448,
-   14524,  15562,  16562,  17518,
-   18431,  19296,  20113,  20879,
-   21592,  22251,  22854,  23399,
-   23886,  24314,  24681,  24986,
-   25231,  25413,  25532,  25590,
-   25585,  25518,  25390,  25201,
-   24952,  24644,  24278,  23855,
-   23377,  22846,  22263,  21629,
-   20948,  20220,  19449,  18636,
-   17785,  16897,  15974,  15021,
-   14039,  13032,  12002,  10952,
-    9885,   8805,   7713,   6614,
-    5510,   4404,   3300,   2199,
-    1106,     23,  -1047,  -2101,
-   -3136,  -4151,  -5141,  -6105,
-   -7040,  -7944,  -8814,  -9649,
-  -10447, -11204, -11921, -12594,
-  -13223, -13806, -14342, -14829,
-  -15267, -15656, -15993, -16278,
-  -16512, -16694, -16823, -16901,
-  -16926, -16899, -16821, -16692,
-  -16512, -16284, -16006, -15682,
-  -15311, -14895, -14435, -13934,
-  -13391, -12810, -12192, -11538,
-  -10850, -10132,  -9383,  -8608,
-   -7807,  -6983,  -6138,  -5274,
-   -4394,  -3499,  -2592,  -1676,
-    -752,    177,   1109,   2042,
-    2973,   3901,   4824,   5739,
-    6645,   7539,   8419,   9285,
-   10133,  10963,  11773,  12562,
-   13327,  14068,  14783,  15471,
-   16132,  16764,  17366,  17938,
-   18479,  18988,  19466,  19910,
-   20322,  20701,  21047,  21359,
-   21639,  21886,  22100,  22283,
-   22433,  22553,  22642,  22701,
-   22730,  22732,  22706,  22653,
-   22575,  22472,  22345,  22197,
-   22027,  21838,  21629,  21404,
-   21162,  20905,  20635,  20352,
-   20059,  19757,  19446,  19128,
-   18805,  18478,  18148,  17817,
-   17485,  17154,  16825,  16500,
-   16179,  15864,  15555,  15253,
-   14961,  14678,  14405,  14143,
-   13893,  13657,  13433,  13223,
-   13028,  12848,  12684,  12535,
-   12403,  12287,  12188,  12106,
-   12041,  11994,  11963,  11950,
-   11953,  11974,  12011,  12065,
-   12135,  12221,  12323,  12441,
-   12573,  12719,  12880,  13054,
-   13241,  13440,  13651,  13873,
-   14106,  14349,  14601,  14862,
-   15131,  15408,  15690,  15979,
-   16274,  16572,  16875,  17181,
-   17490,  17801,  18113,  18425,
-   18738,  19051,  19362,  19671,
-   19979,  20283,  20585,  20883,
-   21176,  21465,  21749,  22028,
-   22300,  22567,  22827,  23081,
-   23328,  23567,  23799,  24023,
-   24240,  24449,  24650,  24842,
-   25027,  25203,  25372,  25532,
-   25684,  25828,  25964,  26092,
-   26212,  26325,  26430,  26527,
-   26618,  26701,  26778,  26848,
-   26912,  26970,  27021,  27067,
-   27108,  27144,  27174,  27201,
-   27222,  27240,  27254,  27265,
-   27272,  27276,  27278,  27277,
-   27274,  27270,  27263,  27255,
-   27246,  27237,  27226,  27215,
-   27204,  27193,  27182,  27171,
-   27161,  27152,  27143,  27135,
-   27129,  27124,  27120,  27118,
-   27118,  27119,  27122,  27127,
-   27133,  27142,  27153,  27166,
-   27180,  27197,  27217,  27238,
-   27261,  27286,  27314,  27343,
-   27375,  27408,  27444,  27481,
-   27520,  27561,  27604,  27648,
-   27694,  27741,  27790,  27840,
-   27891,  27943,  27997,  28051,
-   28107,  28163,  28220,  28277,
-   28336,  28394,  28453,  28513,
-   28573,  28632,  28692,  28752,
-   28812,  28872,  28932,  28991,
-   29050,  29109,  29167,  29224,
-   29282,  29338,  29394,  29449,
-   29504,  29557,  29610,  29663,
-   29714,  29764,  29814,  29863,
-   29910,  29957,  30003,  30048,
-   30092,  30135,  30177,  30218,
-   30258,  30297,  30336,  30373,
-   30410,  30445,  30480,  30514,
-   30547,  30579,  30611,  30641,
-   30671,  30700,  30729,  30757,
-   30784,  30810,  30836,  30862,
-   30886,  30911,  30934,  30958,
-   30981,  31003,  31025,  31047,
-   31068,  31089,  31110,  31130,
-   31151,  31170,  31190,  31210,
-   31229,  31248,  31267,  31286,
-   31305,  31324,  31342,  31361,
-   31379,  31398,  31416,  31435,
-   31453,  31472,  31490,  31508,
-   31527,  31545,  31564,  31582,
-   31601,  31619,  31638,  31656,
-   31675,  31694,  31712,  31731,
-   31750,  31769,  31788,  31806,
-   31825,  31844,  31863,  31882,
-   31901,  31920,  31939,  31958,
-   31978,  31997,  32016,  32035,
-   32054,  32073,  32092,  32111,
-   32130,  32149,  32167,  32186,
-   32205,  32224,  32242,  32261,
-   32280,  32298,  32317,  32335,
-   32353,  32371,  32390,  32408,
-   32426,  32444,  32461,  32479,
-   32497,  32514,  32532,  32549,
-   32567,  32584,  32601,  32618,
-   32635,  32652,  32668,  32685,
-   32702,  32718,  32735,  32751,
-   32751,
-};
-
-const int16_t wav_unipolar_fold[] = {
-       0,    352,    703,   1054,
-    1404,   1754,   2102,   2450,
-    2796,   3141,   3483,   3824,
-    4163,   4500,   4834,   5165,
-    5494,   5819,   6141,   6460,
-    6776,   7088,   7395,   7699,
-    7999,   8294,   8585,   8871,
-    9152,   9429,   9700,   9966,
-   10227,  10482,  10731,  10975,
-   11213,  11445,  11671,  11891,
-   12104,  12311,  12512,  12706,
-   12893,  13073,  13247,  13414,
-   13574,  13727,  13873,  14012,
-   14144,  14268,  14386,  14496,
-   14598,  14694,  14782,  14863,
-   14937,  15003,  15062,  15113,
-   15158,  15195,  15225,  15247,
-   15263,  15271,  15272,  15266,
-   15253,  15234,  15207,  15174,
-   15133,  15087,  15033,  14973,
-   14907,  14834,  14756,  14671,
-   14580,  14483,  14381,  14273,
-   14159,  14040,  13915,  13786,
-   13651,  13512,  13368,  13219,
-   13066,  12909,  12747,  12582,
-   12412,  12239,  12063,  11883,
-   11700,  11513,  11324,  11133,
-   10939,  10742,  10544,  10343,
-   10141,   9936,   9731,   9524,
-    9316,   9107,   8898,   8688,
-    8477,   8266,   8055,   7845,
-    7634,   7424,   7215,   7007,
-    6799,   6593,   6388,   6184,
-    5983,   5783,   5585,   5389,
-    5196,   5005,   4816,   4631,
-    4448,   4269,   4092,   3919,
-    3750,   3584,   3422,   3264,
-    3110,   2960,   2814,   2673,
-    2536,   2403,   2276,   2153,
-    2035,   1922,   1815,   1712,
-    1615,   1523,   1436,   1355,
-    1280,   1210,   1146,   1087,
-    1035,    988,    947,    912,
-     883,    860,    843,    832,
-     827,    828,    835,    848,
-     867,    893,    924,    962,
-    1005,   1055,   1110,   1172,
-    1239,   1312,   1391,   1476,
-    1567,   1663,   1766,   1873,
-    1987,   2105,   2229,   2359,
-    2494,   2634,   2779,   2929,
-    3084,   3244,   3408,   3578,
-    3751,   3930,   4112,   4299,
-    4490,   4686,   4885,   5087,
-    5294,   5504,   5718,   5935,
-    6155,   6378,   6604,   6834,
-    7065,   7300,   7537,   7776,
-    8017,   8261,   8506,   8753,
-    9002,   9253,   9504,   9757,
-   10012,  10267,  10523,  10780,
-   11037,  11295,  11553,  11812,
-   12070,  12329,  12587,  12845,
-   13103,  13360,  13616,  13871,
-   14126,  14380,  14632,  14883,
-   15133,  15381,  15627,  15872,
-   16115,  16356,  16595,  16832,
-   17067,  17299,  17529,  17756,
-   17980,  18202,  18422,  18638,
-   18851,  19061,  19268,  19472,
-   19673,  19871,  20065,  20255,
-   20442,  20626,  20806,  20982,
-   21154,  21323,  21488,  21649,
-   21807,  21960,  22110,  22255,
-   22397,  22534,  22668,  22797,
-   22923,  23044,  23162,  23275,
-   23384,  23489,  23590,  23687,
-   23780,  23869,  23954,  24035,
-   24112,  24185,  24254,  24320,
-   24381,  24438,  24492,  24542,
-   24588,  24631,  24669,  24705,
-   24736,  24764,  24789,  24810,
-   24828,  24843,  24854,  24862,
-   24867,  24869,  24868,  24865,
-   24858,  24848,  24836,  24821,
-   24803,  24783,  24761,  24736,
-   24709,  24680,  24648,  24614,
-   24579,  24541,  24502,  24461,
-   24418,  24374,  24328,  24281,
-   24232,  24183,  24131,  24079,
-   24026,  23972,  23917,  23861,
-   23804,  23747,  23689,  23631,
-   23572,  23513,  23454,  23394,
-   23335,  23275,  23216,  23156,
-   23097,  23038,  22979,  22920,
-   22862,  22805,  22748,  22692,
-   22636,  22581,  22527,  22474,
-   22422,  22370,  22320,  22271,
-   22223,  22176,  22130,  22086,
-   22043,  22001,  21961,  21922,
-   21884,  21849,  21814,  21782,
-   21750,  21721,  21693,  21667,
-   21642,  21620,  21599,  21580,
-   21562,  21547,  21533,  21521,
-   21511,  21503,  21497,  21493,
-   21490,  21490,  21491,  21495,
-   21500,  21507,  21516,  21527,
-   21539,  21554,  21571,  21589,
-   21609,  21631,  21655,  21681,
-   21708,  21738,  21769,  21801,
-   21836,  21872,  21910,  21949,
-   21990,  22033,  22077,  22123,
-   22171,  22219,  22270,  22321,
-   22375,  22429,  22485,  22542,
-   22600,  22660,  22721,  22782,
-   22845,  22910,  22975,  23041,
-   23108,  23176,  23245,  23315,
-   23386,  23457,  23529,  23602,
-   23676,  23750,  23824,  23900,
-   23975,  24052,  24128,  24205,
-   24283,  24361,  24438,  24517,
-   24595,  24674,  24752,  24831,
-   24910,  24989,  25068,  25146,
-   25225,  25304,  25382,  25460,
-   25538,  25616,  25693,  25770,
-   25847,  25923,  25999,  26075,
-   26150,  26224,  26298,  26372,
-   26445,  26517,  26589,  26660,
-   26730,  26800,  26869,  26937,
-   27004,  27071,  27137,  27202,
-   27266,  27330,  27392,  27454,
-   27515,  27575,  27634,  27692,
-   27749,  27805,  27861,  27915,
-   27968,  28021,  28072,  28123,
-   28172,  28221,  28268,  28315,
-   28360,  28404,  28448,  28490,
-   28532,  28572,  28612,  28650,
-   28688,  28725,  28760,  28795,
-   28828,  28861,  28893,  28923,
-   28953,  28982,  29010,  29037,
-   29063,  29089,  29113,  29136,
-   29159,  29181,  29202,  29222,
-   29241,  29260,  29277,  29294,
-   29310,  29326,  29341,  29355,
-   29368,  29380,  29392,  29404,
-   29414,  29424,  29434,  29443,
-   29451,  29459,  29466,  29472,
-   29478,  29484,  29489,  29494,
-   29498,  29502,  29505,  29508,
-   29511,  29513,  29515,  29517,
-   29518,  29519,  29520,  29521,
-   29521,  29521,  29520,  29520,
-   29519,  29519,  29518,  29517,
-   29515,  29514,  29513,  29511,
-   29510,  29508,  29506,  29505,
-   29503,  29501,  29499,  29498,
-   29496,  29494,  29493,  29491,
-   29490,  29488,  29487,  29486,
-   29484,  29483,  29483,  29482,
-   29481,  29481,  29481,  29480,
-   29480,  29481,  29481,  29482,
-   29482,  29483,  29485,  29486,
-   29488,  29490,  29492,  29494,
-   29496,  29499,  29502,  29505,
-   29509,  29513,  29517,  29521,
-   29525,  29530,  29535,  29540,
-   29546,  29551,  29557,  29564,
-   29570,  29577,  29584,  29591,
-   29598,  29606,  29614,  29622,
-   29631,  29639,  29648,  29657,
-   29667,  29676,  29686,  29696,
-   29706,  29717,  29728,  29738,
-   29749,  29761,  29772,  29784,
-   29796,  29808,  29820,  29832,
-   29845,  29857,  29870,  29883,
-   29896,  29910,  29923,  29937,
-   29950,  29964,  29978,  29992,
-   30006,  30021,  30035,  30050,
-   30064,  30079,  30093,  30108,
-   30123,  30138,  30153,  30168,
-   30183,  30198,  30213,  30229,
-   30244,  30259,  30274,  30290,
-   30305,  30320,  30336,  30351,
-   30366,  30382,  30397,  30412,
-   30428,  30443,  30458,  30473,
-   30488,  30504,  30519,  30534,
-   30549,  30564,  30579,  30593,
-   30608,  30623,  30637,  30652,
-   30667,  30681,  30695,  30710,
-   30724,  30738,  30752,  30766,
-   30780,  30794,  30807,  30821,
-   30834,  30848,  30861,  30874,
-   30887,  30900,  30913,  30926,
-   30939,  30951,  30964,  30976,
-   30988,  31001,  31013,  31025,
-   31036,  31048,  31060,  31071,
-   31083,  31094,  31105,  31117,
-   31128,  31138,  31149,  31160,
-   31171,  31181,  31191,  31202,
-   31212,  31222,  31232,  31242,
-   31252,  31262,  31271,  31281,
-   31290,  31299,  31309,  31318,
-   31327,  31336,  31345,  31354,
-   31362,  31371,  31380,  31388,
-   31397,  31405,  31413,  31422,
-   31430,  31438,  31446,  31454,
-   31462,  31469,  31477,  31485,
-   31492,  31500,  31508,  31515,
-   31522,  31530,  31537,  31544,
-   31552,  31559,  31566,  31573,
-   31580,  31587,  31594,  31601,
-   31608,  31615,  31621,  31628,
-   31635,  31642,  31648,  31655,
-   31662,  31668,  31675,  31682,
-   31688,  31695,  31701,  31708,
-   31714,  31721,  31727,  31733,
-   31740,  31746,  31753,  31759,
-   31765,  31772,  31778,  31785,
-   31791,  31797,  31804,  31810,
-   31816,  31823,  31829,  31835,
-   31842,  31848,  31854,  31861,
-   31867,  31873,  31880,  31886,
-   31892,  31898,  31905,  31911,
-   31917,  31924,  31930,  31937,
-   31943,  31949,  31956,  31962,
-   31968,  31975,  31981,  31987,
-   31994,  32000,  32007,  32013,
-   32019,  32026,  32032,  32039,
-   32045,  32052,  32058,  32065,
-   32071,  32077,  32084,  32090,
-   32097,  32103,  32110,  32116,
-   32123,  32129,  32136,  32142,
-   32149,  32155,  32162,  32168,
-   32175,  32181,  32188,  32194,
-   32201,  32207,  32214,  32220,
-   32227,  32233,  32240,  32246,
-   32253,  32259,  32266,  32272,
-   32279,  32285,  32292,  32298,
-   32305,  32311,  32318,  32324,
-   32331,  32337,  32344,  32350,
-   32357,  32363,  32370,  32376,
-   32382,  32389,  32395,  32402,
-   32408,  32414,  32421,  32427,
-   32434,  32440,  32446,  32453,
-   32459,  32465,  32472,  32478,
-   32484,  32490,  32497,  32503,
-   32509,  32516,  32522,  32528,
-   32534,  32540,  32547,  32553,
-   32559,  32565,  32571,  32577,
-   32583,  32590,  32596,  32602,
-   32608,  32614,  32620,  32626,
-   32632,  32638,  32644,  32650,
-   32656,  32662,  32668,  32674,
-   32680,  32686,  32692,  32697,
-   32703,  32709,  32715,  32721,
-   32727,  32732,  32738,  32744,
-   32750,  32756,  32761,  32767,
-   32767,
-};
-
-
-
 const int16_t* waveform_table[] = {
   wav_sine1024,
   wav_sine128,
@@ -9791,11717 +6386,6 @@ const int16_t* waveform_table[] = {
   wav_unipolar_fold,
 };
 
-const int16_t wt_waves[] = {
-       0,    804,   1608,   2410,
-    3212,   4011,   4808,   5602,
-    6392,   7179,   7961,   8739,
-    9511,  10278,  11039,  11792,
-   12539,  13278,  14009,  14732,
-   15446,  16150,  16845,  17530,
-   18204,  18867,  19519,  20159,
-   20787,  21402,  22004,  22593,
-   23169,  23731,  24278,  24811,
-   25328,  25831,  26318,  26789,
-   27244,  27682,  28104,  28509,
-   28897,  29267,  29620,  29955,
-   30272,  30570,  30851,  31112,
-   31355,  31579,  31784,  31970,
-   32136,  32284,  32411,  32520,
-   32608,  32677,  32727,  32756,
-   32766,  32756,  32727,  32677,
-   32608,  32520,  32411,  32284,
-   32136,  31970,  31784,  31579,
-   31355,  31112,  30851,  30570,
-   30272,  29955,  29620,  29267,
-   28897,  28509,  28104,  27682,
-   27244,  26789,  26318,  25831,
-   25328,  24811,  24278,  23731,
-   23169,  22593,  22004,  21402,
-   20787,  20159,  19519,  18867,
-   18204,  17530,  16845,  16150,
-   15446,  14732,  14009,  13278,
-   12539,  11792,  11039,  10278,
-    9511,   8739,   7961,   7179,
-    6392,   5602,   4808,   4011,
-    3212,   2410,   1608,    804,
-       0,   -804,  -1608,  -2410,
-   -3212,  -4011,  -4808,  -5602,
-   -6392,  -7179,  -7961,  -8739,
-   -9511, -10278, -11039, -11792,
-  -12539, -13278, -14009, -14732,
-  -15446, -16150, -16845, -17530,
-  -18204, -18867, -19519, -20159,
-  -20787, -21402, -22004, -22593,
-  -23169, -23731, -24278, -24811,
-  -25328, -25831, -26318, -26789,
-  -27244, -27682, -28104, -28509,
-  -28897, -29267, -29620, -29955,
-  -30272, -30570, -30851, -31112,
-  -31355, -31579, -31784, -31970,
-  -32136, -32284, -32411, -32520,
-  -32608, -32677, -32727, -32756,
-  -32766, -32756, -32727, -32677,
-  -32608, -32520, -32411, -32284,
-  -32136, -31970, -31784, -31579,
-  -31355, -31112, -30851, -30570,
-  -30272, -29955, -29620, -29267,
-  -28897, -28509, -28104, -27682,
-  -27244, -26789, -26318, -25831,
-  -25328, -24811, -24278, -23731,
-  -23169, -22593, -22004, -21402,
-  -20787, -20159, -19519, -18867,
-  -18204, -17530, -16845, -16150,
-  -15446, -14732, -14009, -13278,
-  -12539, -11792, -11039, -10278,
-   -9511,  -8739,  -7961,  -7179,
-   -6392,  -5602,  -4808,  -4011,
-   -3212,  -2410,  -1608,   -804,
-       0,      0,   1608,   3212,
-    4808,   6392,   7961,   9511,
-   11039,  12539,  14009,  15446,
-   16845,  18204,  19519,  20787,
-   22004,  23169,  24278,  25328,
-   26318,  27244,  28104,  28897,
-   29620,  30272,  30851,  31355,
-   31784,  32136,  32411,  32608,
-   32727,  32766,  32727,  32608,
-   32411,  32136,  31784,  31355,
-   30851,  30272,  29620,  28897,
-   28104,  27244,  26318,  25328,
-   24278,  23169,  22004,  20787,
-   19519,  18204,  16845,  15446,
-   14009,  12539,  11039,   9511,
-    7961,   6392,   4808,   3212,
-    1608,      0,  -1608,  -3212,
-   -4808,  -6392,  -7961,  -9511,
-  -11039, -12539, -14009, -15446,
-  -16845, -18204, -19519, -20787,
-  -22004, -23169, -24278, -25328,
-  -26318, -27244, -28104, -28897,
-  -29620, -30272, -30851, -31355,
-  -31784, -32136, -32411, -32608,
-  -32727, -32766, -32727, -32608,
-  -32411, -32136, -31784, -31355,
-  -30851, -30272, -29620, -28897,
-  -28104, -27244, -26318, -25328,
-  -24278, -23169, -22004, -20787,
-  -19519, -18204, -16845, -15446,
-  -14009, -12539, -11039,  -9511,
-   -7961,  -6392,  -4808,  -3212,
-   -1608,      0,   1608,   3212,
-    4808,   6392,   7961,   9511,
-   11039,  12539,  14009,  15446,
-   16845,  18204,  19519,  20787,
-   22004,  23169,  24278,  25328,
-   26318,  27244,  28104,  28897,
-   29620,  30272,  30851,  31355,
-   31784,  32136,  32411,  32608,
-   32727,  32766,  32727,  32608,
-   32411,  32136,  31784,  31355,
-   30851,  30272,  29620,  28897,
-   28104,  27244,  26318,  25328,
-   24278,  23169,  22004,  20787,
-   19519,  18204,  16845,  15446,
-   14009,  12539,  11039,   9511,
-    7961,   6392,   4808,   3212,
-    1608,      0,  -1608,  -3212,
-   -4808,  -6392,  -7961,  -9511,
-  -11039, -12539, -14009, -15446,
-  -16845, -18204, -19519, -20787,
-  -22004, -23169, -24278, -25328,
-  -26318, -27244, -28104, -28897,
-  -29620, -30272, -30851, -31355,
-  -31784, -32136, -32411, -32608,
-  -32727, -32766, -32727, -32608,
-  -32411, -32136, -31784, -31355,
-  -30851, -30272, -29620, -28897,
-  -28104, -27244, -26318, -25328,
-  -24278, -23169, -22004, -20787,
-  -19519, -18204, -16845, -15446,
-  -14009, -12539, -11039,  -9511,
-   -7961,  -6392,  -4808,  -3212,
-   -1608,      0,      0,   2410,
-    4808,   7179,   9511,  11792,
-   14009,  16150,  18204,  20159,
-   22004,  23731,  25328,  26789,
-   28104,  29267,  30272,  31112,
-   31784,  32284,  32608,  32756,
-   32727,  32520,  32136,  31579,
-   30851,  29955,  28897,  27682,
-   26318,  24811,  23169,  21402,
-   19519,  17530,  15446,  13278,
-   11039,   8739,   6392,   4011,
-    1608,   -804,  -3212,  -5602,
-   -7961, -10278, -12539, -14732,
-  -16845, -18867, -20787, -22593,
-  -24278, -25831, -27244, -28509,
-  -29620, -30570, -31355, -31970,
-  -32411, -32677, -32766, -32677,
-  -32411, -31970, -31355, -30570,
-  -29620, -28509, -27244, -25831,
-  -24278, -22593, -20787, -18867,
-  -16845, -14732, -12539, -10278,
-   -7961,  -5602,  -3212,   -804,
-    1608,   4011,   6392,   8739,
-   11039,  13278,  15446,  17530,
-   19519,  21402,  23169,  24811,
-   26318,  27682,  28897,  29955,
-   30851,  31579,  32136,  32520,
-   32727,  32756,  32608,  32284,
-   31784,  31112,  30272,  29267,
-   28104,  26789,  25328,  23731,
-   22004,  20159,  18204,  16150,
-   14009,  11792,   9511,   7179,
-    4808,   2410,      0,  -2410,
-   -4808,  -7179,  -9511, -11792,
-  -14009, -16150, -18204, -20159,
-  -22004, -23731, -25328, -26789,
-  -28104, -29267, -30272, -31112,
-  -31784, -32284, -32608, -32756,
-  -32727, -32520, -32136, -31579,
-  -30851, -29955, -28897, -27682,
-  -26318, -24811, -23169, -21402,
-  -19519, -17530, -15446, -13278,
-  -11039,  -8739,  -6392,  -4011,
-   -1608,    804,   3212,   5602,
-    7961,  10278,  12539,  14732,
-   16845,  18867,  20787,  22593,
-   24278,  25831,  27244,  28509,
-   29620,  30570,  31355,  31970,
-   32411,  32677,  32766,  32677,
-   32411,  31970,  31355,  30570,
-   29620,  28509,  27244,  25831,
-   24278,  22593,  20787,  18867,
-   16845,  14732,  12539,  10278,
-    7961,   5602,   3212,    804,
-   -1608,  -4011,  -6392,  -8739,
-  -11039, -13278, -15446, -17530,
-  -19519, -21402, -23169, -24811,
-  -26318, -27682, -28897, -29955,
-  -30851, -31579, -32136, -32520,
-  -32727, -32756, -32608, -32284,
-  -31784, -31112, -30272, -29267,
-  -28104, -26789, -25328, -23731,
-  -22004, -20159, -18204, -16150,
-  -14009, -11792,  -9511,  -7179,
-   -4808,  -2410,      0,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-       0,   4011,   7961,  11792,
-   15446,  18867,  22004,  24811,
-   27244,  29267,  30851,  31970,
-   32608,  32756,  32411,  31579,
-   30272,  28509,  26318,  23731,
-   20787,  17530,  14009,  10278,
-    6392,   2410,  -1608,  -5602,
-   -9511, -13278, -16845, -20159,
-  -23169, -25831, -28104, -29955,
-  -31355, -32284, -32727, -32677,
-  -32136, -31112, -29620, -27682,
-  -25328, -22593, -19519, -16150,
-  -12539,  -8739,  -4808,   -804,
-    3212,   7179,  11039,  14732,
-   18204,  21402,  24278,  26789,
-   28897,  30570,  31784,  32520,
-   32766,  32520,  31784,  30570,
-   28897,  26789,  24278,  21402,
-   18204,  14732,  11039,   7179,
-    3212,   -804,  -4808,  -8739,
-  -12539, -16150, -19519, -22593,
-  -25328, -27682, -29620, -31112,
-  -32136, -32677, -32727, -32284,
-  -31355, -29955, -28104, -25831,
-  -23169, -20159, -16845, -13278,
-   -9511,  -5602,  -1608,   2410,
-    6392,  10278,  14009,  17530,
-   20787,  23731,  26318,  28509,
-   30272,  31579,  32411,  32756,
-   32608,  31970,  30851,  29267,
-   27244,  24811,  22004,  18867,
-   15446,  11792,   7961,   4011,
-       0,  -4011,  -7961, -11792,
-  -15446, -18867, -22004, -24811,
-  -27244, -29267, -30851, -31970,
-  -32608, -32756, -32411, -31579,
-  -30272, -28509, -26318, -23731,
-  -20787, -17530, -14009, -10278,
-   -6392,  -2410,   1608,   5602,
-    9511,  13278,  16845,  20159,
-   23169,  25831,  28104,  29955,
-   31355,  32284,  32727,  32677,
-   32136,  31112,  29620,  27682,
-   25328,  22593,  19519,  16150,
-   12539,   8739,   4808,    804,
-   -3212,  -7179, -11039, -14732,
-  -18204, -21402, -24278, -26789,
-  -28897, -30570, -31784, -32520,
-  -32766, -32520, -31784, -30570,
-  -28897, -26789, -24278, -21402,
-  -18204, -14732, -11039,  -7179,
-   -3212,    804,   4808,   8739,
-   12539,  16150,  19519,  22593,
-   25328,  27682,  29620,  31112,
-   32136,  32677,  32727,  32284,
-   31355,  29955,  28104,  25831,
-   23169,  20159,  16845,  13278,
-    9511,   5602,   1608,  -2410,
-   -6392, -10278, -14009, -17530,
-  -20787, -23731, -26318, -28509,
-  -30272, -31579, -32411, -32756,
-  -32608, -31970, -30851, -29267,
-  -27244, -24811, -22004, -18867,
-  -15446, -11792,  -7961,  -4011,
-       0,      0,   4808,   9511,
-   14009,  18204,  22004,  25328,
-   28104,  30272,  31784,  32608,
-   32727,  32136,  30851,  28897,
-   26318,  23169,  19519,  15446,
-   11039,   6392,   1608,  -3212,
-   -7961, -12539, -16845, -20787,
-  -24278, -27244, -29620, -31355,
-  -32411, -32766, -32411, -31355,
-  -29620, -27244, -24278, -20787,
-  -16845, -12539,  -7961,  -3212,
-    1608,   6392,  11039,  15446,
-   19519,  23169,  26318,  28897,
-   30851,  32136,  32727,  32608,
-   31784,  30272,  28104,  25328,
-   22004,  18204,  14009,   9511,
-    4808,      0,  -4808,  -9511,
-  -14009, -18204, -22004, -25328,
-  -28104, -30272, -31784, -32608,
-  -32727, -32136, -30851, -28897,
-  -26318, -23169, -19519, -15446,
-  -11039,  -6392,  -1608,   3212,
-    7961,  12539,  16845,  20787,
-   24278,  27244,  29620,  31355,
-   32411,  32766,  32411,  31355,
-   29620,  27244,  24278,  20787,
-   16845,  12539,   7961,   3212,
-   -1608,  -6392, -11039, -15446,
-  -19519, -23169, -26318, -28897,
-  -30851, -32136, -32727, -32608,
-  -31784, -30272, -28104, -25328,
-  -22004, -18204, -14009,  -9511,
-   -4808,      0,   4808,   9511,
-   14009,  18204,  22004,  25328,
-   28104,  30272,  31784,  32608,
-   32727,  32136,  30851,  28897,
-   26318,  23169,  19519,  15446,
-   11039,   6392,   1608,  -3212,
-   -7961, -12539, -16845, -20787,
-  -24278, -27244, -29620, -31355,
-  -32411, -32766, -32411, -31355,
-  -29620, -27244, -24278, -20787,
-  -16845, -12539,  -7961,  -3212,
-    1608,   6392,  11039,  15446,
-   19519,  23169,  26318,  28897,
-   30851,  32136,  32727,  32608,
-   31784,  30272,  28104,  25328,
-   22004,  18204,  14009,   9511,
-    4808,      0,  -4808,  -9511,
-  -14009, -18204, -22004, -25328,
-  -28104, -30272, -31784, -32608,
-  -32727, -32136, -30851, -28897,
-  -26318, -23169, -19519, -15446,
-  -11039,  -6392,  -1608,   3212,
-    7961,  12539,  16845,  20787,
-   24278,  27244,  29620,  31355,
-   32411,  32766,  32411,  31355,
-   29620,  27244,  24278,  20787,
-   16845,  12539,   7961,   3212,
-   -1608,  -6392, -11039, -15446,
-  -19519, -23169, -26318, -28897,
-  -30851, -32136, -32727, -32608,
-  -31784, -30272, -28104, -25328,
-  -22004, -18204, -14009,  -9511,
-   -4808,      0,      0,   5602,
-   11039,  16150,  20787,  24811,
-   28104,  30570,  32136,  32756,
-   32411,  31112,  28897,  25831,
-   22004,  17530,  12539,   7179,
-    1608,  -4011,  -9511, -14732,
-  -19519, -23731, -27244, -29955,
-  -31784, -32677, -32608, -31579,
-  -29620, -26789, -23169, -18867,
-  -14009,  -8739,  -3212,   2410,
-    7961,  13278,  18204,  22593,
-   26318,  29267,  31355,  32520,
-   32727,  31970,  30272,  27682,
-   24278,  20159,  15446,  10278,
-    4808,   -804,  -6392, -11792,
-  -16845, -21402, -25328, -28509,
-  -30851, -32284, -32766, -32284,
-  -30851, -28509, -25328, -21402,
-  -16845, -11792,  -6392,   -804,
-    4808,  10278,  15446,  20159,
-   24278,  27682,  30272,  31970,
-   32727,  32520,  31355,  29267,
-   26318,  22593,  18204,  13278,
-    7961,   2410,  -3212,  -8739,
-  -14009, -18867, -23169, -26789,
-  -29620, -31579, -32608, -32677,
-  -31784, -29955, -27244, -23731,
-  -19519, -14732,  -9511,  -4011,
-    1608,   7179,  12539,  17530,
-   22004,  25831,  28897,  31112,
-   32411,  32756,  32136,  30570,
-   28104,  24811,  20787,  16150,
-   11039,   5602,      0,  -5602,
-  -11039, -16150, -20787, -24811,
-  -28104, -30570, -32136, -32756,
-  -32411, -31112, -28897, -25831,
-  -22004, -17530, -12539,  -7179,
-   -1608,   4011,   9511,  14732,
-   19519,  23731,  27244,  29955,
-   31784,  32677,  32608,  31579,
-   29620,  26789,  23169,  18867,
-   14009,   8739,   3212,  -2410,
-   -7961, -13278, -18204, -22593,
-  -26318, -29267, -31355, -32520,
-  -32727, -31970, -30272, -27682,
-  -24278, -20159, -15446, -10278,
-   -4808,    804,   6392,  11792,
-   16845,  21402,  25328,  28509,
-   30851,  32284,  32766,  32284,
-   30851,  28509,  25328,  21402,
-   16845,  11792,   6392,    804,
-   -4808, -10278, -15446, -20159,
-  -24278, -27682, -30272, -31970,
-  -32727, -32520, -31355, -29267,
-  -26318, -22593, -18204, -13278,
-   -7961,  -2410,   3212,   8739,
-   14009,  18867,  23169,  26789,
-   29620,  31579,  32608,  32677,
-   31784,  29955,  27244,  23731,
-   19519,  14732,   9511,   4011,
-   -1608,  -7179, -12539, -17530,
-  -22004, -25831, -28897, -31112,
-  -32411, -32756, -32136, -30570,
-  -28104, -24811, -20787, -16150,
-  -11039,  -5602,      0,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,      0,   7961,  15446,
-   22004,  27244,  30851,  32608,
-   32411,  30272,  26318,  20787,
-   14009,   6392,  -1608,  -9511,
-  -16845, -23169, -28104, -31355,
-  -32727, -32136, -29620, -25328,
-  -19519, -12539,  -4808,   3212,
-   11039,  18204,  24278,  28897,
-   31784,  32766,  31784,  28897,
-   24278,  18204,  11039,   3212,
-   -4808, -12539, -19519, -25328,
-  -29620, -32136, -32727, -31355,
-  -28104, -23169, -16845,  -9511,
-   -1608,   6392,  14009,  20787,
-   26318,  30272,  32411,  32608,
-   30851,  27244,  22004,  15446,
-    7961,      0,  -7961, -15446,
-  -22004, -27244, -30851, -32608,
-  -32411, -30272, -26318, -20787,
-  -14009,  -6392,   1608,   9511,
-   16845,  23169,  28104,  31355,
-   32727,  32136,  29620,  25328,
-   19519,  12539,   4808,  -3212,
-  -11039, -18204, -24278, -28897,
-  -31784, -32766, -31784, -28897,
-  -24278, -18204, -11039,  -3212,
-    4808,  12539,  19519,  25328,
-   29620,  32136,  32727,  31355,
-   28104,  23169,  16845,   9511,
-    1608,  -6392, -14009, -20787,
-  -26318, -30272, -32411, -32608,
-  -30851, -27244, -22004, -15446,
-   -7961,      0,   7961,  15446,
-   22004,  27244,  30851,  32608,
-   32411,  30272,  26318,  20787,
-   14009,   6392,  -1608,  -9511,
-  -16845, -23169, -28104, -31355,
-  -32727, -32136, -29620, -25328,
-  -19519, -12539,  -4808,   3212,
-   11039,  18204,  24278,  28897,
-   31784,  32766,  31784,  28897,
-   24278,  18204,  11039,   3212,
-   -4808, -12539, -19519, -25328,
-  -29620, -32136, -32727, -31355,
-  -28104, -23169, -16845,  -9511,
-   -1608,   6392,  14009,  20787,
-   26318,  30272,  32411,  32608,
-   30851,  27244,  22004,  15446,
-    7961,      0,  -7961, -15446,
-  -22004, -27244, -30851, -32608,
-  -32411, -30272, -26318, -20787,
-  -14009,  -6392,   1608,   9511,
-   16845,  23169,  28104,  31355,
-   32727,  32136,  29620,  25328,
-   19519,  12539,   4808,  -3212,
-  -11039, -18204, -24278, -28897,
-  -31784, -32766, -31784, -28897,
-  -24278, -18204, -11039,  -3212,
-    4808,  12539,  19519,  25328,
-   29620,  32136,  32727,  31355,
-   28104,  23169,  16845,   9511,
-    1608,  -6392, -14009, -20787,
-  -26318, -30272, -32411, -32608,
-  -30851, -27244, -22004, -15446,
-   -7961,      0,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,      0,
-   11039,  20787,  28104,  32136,
-   32411,  28897,  22004,  12539,
-    1608,  -9511, -19519, -27244,
-  -31784, -32608, -29620, -23169,
-  -14009,  -3212,   7961,  18204,
-   26318,  31355,  32727,  30272,
-   24278,  15446,   4808,  -6392,
-  -16845, -25328, -30851, -32766,
-  -30851, -25328, -16845,  -6392,
-    4808,  15446,  24278,  30272,
-   32727,  31355,  26318,  18204,
-    7961,  -3212, -14009, -23169,
-  -29620, -32608, -31784, -27244,
-  -19519,  -9511,   1608,  12539,
-   22004,  28897,  32411,  32136,
-   28104,  20787,  11039,      0,
-  -11039, -20787, -28104, -32136,
-  -32411, -28897, -22004, -12539,
-   -1608,   9511,  19519,  27244,
-   31784,  32608,  29620,  23169,
-   14009,   3212,  -7961, -18204,
-  -26318, -31355, -32727, -30272,
-  -24278, -15446,  -4808,   6392,
-   16845,  25328,  30851,  32766,
-   30851,  25328,  16845,   6392,
-   -4808, -15446, -24278, -30272,
-  -32727, -31355, -26318, -18204,
-   -7961,   3212,  14009,  23169,
-   29620,  32608,  31784,  27244,
-   19519,   9511,  -1608, -12539,
-  -22004, -28897, -32411, -32136,
-  -28104, -20787, -11039,      0,
-   11039,  20787,  28104,  32136,
-   32411,  28897,  22004,  12539,
-    1608,  -9511, -19519, -27244,
-  -31784, -32608, -29620, -23169,
-  -14009,  -3212,   7961,  18204,
-   26318,  31355,  32727,  30272,
-   24278,  15446,   4808,  -6392,
-  -16845, -25328, -30851, -32766,
-  -30851, -25328, -16845,  -6392,
-    4808,  15446,  24278,  30272,
-   32727,  31355,  26318,  18204,
-    7961,  -3212, -14009, -23169,
-  -29620, -32608, -31784, -27244,
-  -19519,  -9511,   1608,  12539,
-   22004,  28897,  32411,  32136,
-   28104,  20787,  11039,      0,
-  -11039, -20787, -28104, -32136,
-  -32411, -28897, -22004, -12539,
-   -1608,   9511,  19519,  27244,
-   31784,  32608,  29620,  23169,
-   14009,   3212,  -7961, -18204,
-  -26318, -31355, -32727, -30272,
-  -24278, -15446,  -4808,   6392,
-   16845,  25328,  30851,  32766,
-   30851,  25328,  16845,   6392,
-   -4808, -15446, -24278, -30272,
-  -32727, -31355, -26318, -18204,
-   -7961,   3212,  14009,  23169,
-   29620,  32608,  31784,  27244,
-   19519,   9511,  -1608, -12539,
-  -22004, -28897, -32411, -32136,
-  -28104, -20787, -11039,      0,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,      0,  14009,  25328,
-   31784,  32136,  26318,  15446,
-    1608, -12539, -24278, -31355,
-  -32411, -27244, -16845,  -3212,
-   11039,  23169,  30851,  32608,
-   28104,  18204,   4808,  -9511,
-  -22004, -30272, -32727, -28897,
-  -19519,  -6392,   7961,  20787,
-   29620,  32766,  29620,  20787,
-    7961,  -6392, -19519, -28897,
-  -32727, -30272, -22004,  -9511,
-    4808,  18204,  28104,  32608,
-   30851,  23169,  11039,  -3212,
-  -16845, -27244, -32411, -31355,
-  -24278, -12539,   1608,  15446,
-   26318,  32136,  31784,  25328,
-   14009,      0, -14009, -25328,
-  -31784, -32136, -26318, -15446,
-   -1608,  12539,  24278,  31355,
-   32411,  27244,  16845,   3212,
-  -11039, -23169, -30851, -32608,
-  -28104, -18204,  -4808,   9511,
-   22004,  30272,  32727,  28897,
-   19519,   6392,  -7961, -20787,
-  -29620, -32766, -29620, -20787,
-   -7961,   6392,  19519,  28897,
-   32727,  30272,  22004,   9511,
-   -4808, -18204, -28104, -32608,
-  -30851, -23169, -11039,   3212,
-   16845,  27244,  32411,  31355,
-   24278,  12539,  -1608, -15446,
-  -26318, -32136, -31784, -25328,
-  -14009,      0,  14009,  25328,
-   31784,  32136,  26318,  15446,
-    1608, -12539, -24278, -31355,
-  -32411, -27244, -16845,  -3212,
-   11039,  23169,  30851,  32608,
-   28104,  18204,   4808,  -9511,
-  -22004, -30272, -32727, -28897,
-  -19519,  -6392,   7961,  20787,
-   29620,  32766,  29620,  20787,
-    7961,  -6392, -19519, -28897,
-  -32727, -30272, -22004,  -9511,
-    4808,  18204,  28104,  32608,
-   30851,  23169,  11039,  -3212,
-  -16845, -27244, -32411, -31355,
-  -24278, -12539,   1608,  15446,
-   26318,  32136,  31784,  25328,
-   14009,      0, -14009, -25328,
-  -31784, -32136, -26318, -15446,
-   -1608,  12539,  24278,  31355,
-   32411,  27244,  16845,   3212,
-  -11039, -23169, -30851, -32608,
-  -28104, -18204,  -4808,   9511,
-   22004,  30272,  32727,  28897,
-   19519,   6392,  -7961, -20787,
-  -29620, -32766, -29620, -20787,
-   -7961,   6392,  19519,  28897,
-   32727,  30272,  22004,   9511,
-   -4808, -18204, -28104, -32608,
-  -30851, -23169, -11039,   3212,
-   16845,  27244,  32411,  31355,
-   24278,  12539,  -1608, -15446,
-  -26318, -32136, -31784, -25328,
-  -14009,      0,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,      0,
-   16845,  28897,  32727,  27244,
-   14009,  -3212, -19519, -30272,
-  -32411, -25328, -11039,   6392,
-   22004,  31355,  31784,  23169,
-    7961,  -9511, -24278, -32136,
-  -30851, -20787,  -4808,  12539,
-   26318,  32608,  29620,  18204,
-    1608, -15446, -28104, -32766,
-  -28104, -15446,   1608,  18204,
-   29620,  32608,  26318,  12539,
-   -4808, -20787, -30851, -32136,
-  -24278,  -9511,   7961,  23169,
-   31784,  31355,  22004,   6392,
-  -11039, -25328, -32411, -30272,
-  -19519,  -3212,  14009,  27244,
-   32727,  28897,  16845,      0,
-  -16845, -28897, -32727, -27244,
-  -14009,   3212,  19519,  30272,
-   32411,  25328,  11039,  -6392,
-  -22004, -31355, -31784, -23169,
-   -7961,   9511,  24278,  32136,
-   30851,  20787,   4808, -12539,
-  -26318, -32608, -29620, -18204,
-   -1608,  15446,  28104,  32766,
-   28104,  15446,  -1608, -18204,
-  -29620, -32608, -26318, -12539,
-    4808,  20787,  30851,  32136,
-   24278,   9511,  -7961, -23169,
-  -31784, -31355, -22004,  -6392,
-   11039,  25328,  32411,  30272,
-   19519,   3212, -14009, -27244,
-  -32727, -28897, -16845,      0,
-   16845,  28897,  32727,  27244,
-   14009,  -3212, -19519, -30272,
-  -32411, -25328, -11039,   6392,
-   22004,  31355,  31784,  23169,
-    7961,  -9511, -24278, -32136,
-  -30851, -20787,  -4808,  12539,
-   26318,  32608,  29620,  18204,
-    1608, -15446, -28104, -32766,
-  -28104, -15446,   1608,  18204,
-   29620,  32608,  26318,  12539,
-   -4808, -20787, -30851, -32136,
-  -24278,  -9511,   7961,  23169,
-   31784,  31355,  22004,   6392,
-  -11039, -25328, -32411, -30272,
-  -19519,  -3212,  14009,  27244,
-   32727,  28897,  16845,      0,
-  -16845, -28897, -32727, -27244,
-  -14009,   3212,  19519,  30272,
-   32411,  25328,  11039,  -6392,
-  -22004, -31355, -31784, -23169,
-   -7961,   9511,  24278,  32136,
-   30851,  20787,   4808, -12539,
-  -26318, -32608, -29620, -18204,
-   -1608,  15446,  28104,  32766,
-   28104,  15446,  -1608, -18204,
-  -29620, -32608, -26318, -12539,
-    4808,  20787,  30851,  32136,
-   24278,   9511,  -7961, -23169,
-  -31784, -31355, -22004,  -6392,
-   11039,  25328,  32411,  30272,
-   19519,   3212, -14009, -27244,
-  -32727, -28897, -16845,      0,
-       0,   5372,  10592,  15516,
-   20009,  23951,  27242,  29807,
-   31594,  32579,  32766,  32185,
-   30892,  28963,  26496,  23602,
-   20401,  17020,  13585,  10218,
-    7032,   4126,   1582,   -536,
-   -2184,  -3343,  -4011,  -4209,
-   -3976,  -3367,  -2450,  -1300,
-       0,   1366,   2717,   3976,
-    5077,   5962,   6588,   6926,
-    6960,   6689,   6127,   5297,
-    4233,   2979,   1580,     88,
-   -1450,  -2985,  -4474,  -5882,
-   -7178,  -8342,  -9360, -10228,
-  -10947, -11527, -11980, -12322,
-  -12570, -12743, -12854, -12915,
-  -12935, -12915, -12854, -12743,
-  -12570, -12322, -11980, -11527,
-  -10947, -10228,  -9360,  -8342,
-   -7178,  -5882,  -4474,  -2985,
-   -1450,     88,   1580,   2979,
-    4233,   5297,   6127,   6689,
-    6960,   6926,   6588,   5962,
-    5077,   3976,   2717,   1366,
-       0,  -1300,  -2450,  -3367,
-   -3976,  -4209,  -4011,  -3343,
-   -2184,   -536,   1582,   4126,
-    7032,  10218,  13585,  17020,
-   20401,  23602,  26496,  28963,
-   30892,  32185,  32766,  32579,
-   31594,  29807,  27242,  23951,
-   20009,  15516,  10592,   5372,
-       0,  -5372, -10592, -15516,
-  -20009, -23951, -27242, -29807,
-  -31594, -32579, -32766, -32185,
-  -30892, -28963, -26496, -23602,
-  -20401, -17020, -13585, -10218,
-   -7032,  -4126,  -1582,    536,
-    2184,   3343,   4011,   4209,
-    3976,   3367,   2450,   1300,
-       0,  -1366,  -2717,  -3976,
-   -5077,  -5962,  -6588,  -6926,
-   -6960,  -6689,  -6127,  -5297,
-   -4233,  -2979,  -1580,    -88,
-    1450,   2985,   4474,   5882,
-    7178,   8342,   9360,  10228,
-   10947,  11527,  11980,  12322,
-   12570,  12743,  12854,  12915,
-   12935,  12915,  12854,  12743,
-   12570,  12322,  11980,  11527,
-   10947,  10228,   9360,   8342,
-    7178,   5882,   4474,   2985,
-    1450,    -88,  -1580,  -2979,
-   -4233,  -5297,  -6127,  -6689,
-   -6960,  -6926,  -6588,  -5962,
-   -5077,  -3976,  -2717,  -1366,
-       0,   1300,   2450,   3367,
-    3976,   4209,   4011,   3343,
-    2184,    536,  -1582,  -4126,
-   -7032, -10218, -13585, -17020,
-  -20401, -23602, -26496, -28963,
-  -30892, -32185, -32766, -32579,
-  -31594, -29807, -27242, -23951,
-  -20009, -15516, -10592,  -5372,
-       0,      0,   6754,  13211,
-   19089,  24138,  28151,  30976,
-   32522,  32766,  31747,  29569,
-   26387,  22402,  17847,  12972,
-    8029,   3262,  -1114,  -4915,
-   -8005, -10296, -11752, -12390,
-  -12273, -11506, -10225,  -8587,
-   -6760,  -4911,  -3193,  -1738,
-    -651,      0,    181,   -102,
-    -812,  -1879,  -3212,  -4701,
-   -6232,  -7688,  -8962,  -9961,
-  -10614, -10873, -10713, -10140,
-   -9178,  -7874,  -6291,  -4501,
-   -2582,   -610,   1342,   3213,
-    4950,   6518,   7890,   9057,
-   10017,  10777,  11349,  11745,
-   11977,  12053,  11977,  11745,
-   11349,  10777,  10017,   9057,
-    7890,   6518,   4950,   3213,
-    1342,   -610,  -2582,  -4501,
-   -6291,  -7874,  -9178, -10140,
-  -10713, -10873, -10614,  -9961,
-   -8962,  -7688,  -6232,  -4701,
-   -3212,  -1879,   -812,   -102,
-     181,      0,   -651,  -1738,
-   -3193,  -4911,  -6760,  -8587,
-  -10225, -11506, -12273, -12390,
-  -11752, -10296,  -8005,  -4915,
-   -1114,   3262,   8029,  12972,
-   17847,  22402,  26387,  29569,
-   31747,  32766,  32522,  30976,
-   28151,  24138,  19089,  13211,
-    6754,      0,  -6754, -13211,
-  -19089, -24138, -28151, -30976,
-  -32522, -32766, -31747, -29569,
-  -26387, -22402, -17847, -12972,
-   -8029,  -3262,   1114,   4915,
-    8005,  10296,  11752,  12390,
-   12273,  11506,  10225,   8587,
-    6760,   4911,   3193,   1738,
-     651,      0,   -181,    102,
-     812,   1879,   3212,   4701,
-    6232,   7688,   8962,   9961,
-   10614,  10873,  10713,  10140,
-    9178,   7874,   6291,   4501,
-    2582,    610,  -1342,  -3213,
-   -4950,  -6518,  -7890,  -9057,
-  -10017, -10777, -11349, -11745,
-  -11977, -12053, -11977, -11745,
-  -11349, -10777, -10017,  -9057,
-   -7890,  -6518,  -4950,  -3213,
-   -1342,    610,   2582,   4501,
-    6291,   7874,   9178,  10140,
-   10713,  10873,  10614,   9961,
-    8962,   7688,   6232,   4701,
-    3212,   1879,    812,    102,
-    -181,      0,    651,   1738,
-    3193,   4911,   6760,   8587,
-   10225,  11506,  12273,  12390,
-   11752,  10296,   8005,   4915,
-    1114,  -3262,  -8029, -12972,
-  -17847, -22402, -26387, -29569,
-  -31747, -32766, -32522, -30976,
-  -28151, -24138, -19089, -13211,
-   -6754,      0,      0,   8203,
-   15876,  22528,  27744,  31217,
-   32766,  32349,  30064,  26137,
-   20899,  14763,   8184,   1624,
-   -4481,  -9757, -13917, -16776,
-  -18264, -18423, -17392, -15396,
-  -12716,  -9662,  -6545,  -3648,
-   -1206,    616,   1730,   2128,
-    1877,   1109,      0,  -1248,
-   -2428,  -3351,  -3864,  -3862,
-   -3296,  -2179,   -581,   1382,
-    3559,   5778,   7864,   9654,
-   11012,  11836,  12070,  11700,
-   10757,   9307,   7446,   5288,
-    2953,    561,  -1780,  -3979,
-   -5965,  -7687,  -9112, -10224,
-  -11018, -11493, -11651, -11493,
-  -11018, -10224,  -9112,  -7687,
-   -5965,  -3979,  -1780,    561,
-    2953,   5288,   7446,   9307,
-   10757,  11700,  12070,  11836,
-   11012,   9654,   7864,   5778,
-    3559,   1382,   -581,  -2179,
-   -3296,  -3862,  -3864,  -3351,
-   -2428,  -1248,      0,   1109,
-    1877,   2128,   1730,    616,
-   -1206,  -3648,  -6545,  -9662,
-  -12716, -15396, -17392, -18423,
-  -18264, -16776, -13917,  -9757,
-   -4481,   1624,   8184,  14763,
-   20899,  26137,  30064,  32349,
-   32766,  31217,  27744,  22528,
-   15876,   8203,      0,  -8203,
-  -15876, -22528, -27744, -31217,
-  -32766, -32349, -30064, -26137,
-  -20899, -14763,  -8184,  -1624,
-    4481,   9757,  13917,  16776,
-   18264,  18423,  17392,  15396,
-   12716,   9662,   6545,   3648,
-    1206,   -616,  -1730,  -2128,
-   -1877,  -1109,      0,   1248,
-    2428,   3351,   3864,   3862,
-    3296,   2179,    581,  -1382,
-   -3559,  -5778,  -7864,  -9654,
-  -11012, -11836, -12070, -11700,
-  -10757,  -9307,  -7446,  -5288,
-   -2953,   -561,   1780,   3979,
-    5965,   7687,   9112,  10224,
-   11018,  11493,  11651,  11493,
-   11018,  10224,   9112,   7687,
-    5965,   3979,   1780,   -561,
-   -2953,  -5288,  -7446,  -9307,
-  -10757, -11700, -12070, -11836,
-  -11012,  -9654,  -7864,  -5778,
-   -3559,  -1382,    581,   2179,
-    3296,   3862,   3864,   3351,
-    2428,   1248,      0,  -1109,
-   -1877,  -2128,  -1730,   -616,
-    1206,   3648,   6545,   9662,
-   12716,  15396,  17392,  18423,
-   18264,  16776,  13917,   9757,
-    4481,  -1624,  -8184, -14763,
-  -20899, -26137, -30064, -32349,
-  -32766, -31217, -27744, -22528,
-  -15876,  -8203,      0,      0,
-    9684,  18498,  25657,  30544,
-   32766,  32193,  28962,  23460,
-   16277,   8137,   -176,  -7903,
-  -14385, -19124, -21830, -22432,
-  -21078, -18098, -13961,  -9208,
-   -4392,    -12,   3538,   6005,
-    7294,   7466,   6714,   5326,
-    3645,   2012,    725,      0,
-     -52,    565,   1737,   3266,
-    4894,   6344,   7361,   7738,
-    7349,   6163,   4242,   1740,
-   -1127,  -4097,  -6903,  -9292,
-  -11059, -12063, -12236, -11586,
-  -10186,  -8168,  -5698,  -2957,
-    -131,   2615,   5138,   7325,
-    9095,  10391,  11181,  11446,
-   11181,  10391,   9095,   7325,
-    5138,   2615,   -131,  -2957,
-   -5698,  -8168, -10186, -11586,
-  -12236, -12063, -11059,  -9292,
-   -6903,  -4097,  -1127,   1740,
-    4242,   6163,   7349,   7738,
-    7361,   6344,   4894,   3266,
-    1737,    565,    -52,      0,
-     725,   2012,   3645,   5326,
-    6714,   7466,   7294,   6005,
-    3538,    -12,  -4392,  -9208,
-  -13961, -18098, -21078, -22432,
-  -21830, -19124, -14385,  -7903,
-    -176,   8137,  16277,  23460,
-   28962,  32193,  32766,  30544,
-   25657,  18498,   9684,      0,
-   -9684, -18498, -25657, -30544,
-  -32766, -32193, -28962, -23460,
-  -16277,  -8137,    176,   7903,
-   14385,  19124,  21830,  22432,
-   21078,  18098,  13961,   9208,
-    4392,     12,  -3538,  -6005,
-   -7294,  -7466,  -6714,  -5326,
-   -3645,  -2012,   -725,      0,
-      52,   -565,  -1737,  -3266,
-   -4894,  -6344,  -7361,  -7738,
-   -7349,  -6163,  -4242,  -1740,
-    1127,   4097,   6903,   9292,
-   11059,  12063,  12236,  11586,
-   10186,   8168,   5698,   2957,
-     131,  -2615,  -5138,  -7325,
-   -9095, -10391, -11181, -11446,
-  -11181, -10391,  -9095,  -7325,
-   -5138,  -2615,    131,   2957,
-    5698,   8168,  10186,  11586,
-   12236,  12063,  11059,   9292,
-    6903,   4097,   1127,  -1740,
-   -4242,  -6163,  -7349,  -7738,
-   -7361,  -6344,  -4894,  -3266,
-   -1737,   -565,     52,      0,
-    -725,  -2012,  -3645,  -5326,
-   -6714,  -7466,  -7294,  -6005,
-   -3538,     12,   4392,   9208,
-   13961,  18098,  21078,  22432,
-   21830,  19124,  14385,   7903,
-     176,  -8137, -16277, -23460,
-  -28962, -32193, -32766, -30544,
-  -25657, -18498,  -9684,      0,
-       0,  11241,  21134,  28510,
-   32524,  32766,  29303,  22665,
-   13757,   3735,  -6155, -14746,
-  -21096, -24602, -25061, -22671,
-  -17979, -11781,  -4999,   1460,
-    6827,  10566,  12430,  12466,
-   10981,   8464,   5497,   2647,
-     378,  -1016,  -1444,  -1014,
-       0,   1226,   2265,   2771,
-    2512,   1410,   -444,  -2807,
-   -5329,  -7611,  -9269,  -9998,
-   -9620,  -8109,  -5597,  -2347,
-    1278,   4875,   8050,  10470,
-   11902,  12229,  11459,   9710,
-    7184,   4139,    852,  -2406,
-   -5395,  -7916,  -9818, -10999,
-  -11399, -10999,  -9818,  -7916,
-   -5395,  -2406,    852,   4139,
-    7184,   9710,  11459,  12229,
-   11902,  10470,   8050,   4875,
-    1278,  -2347,  -5597,  -8109,
-   -9620,  -9998,  -9269,  -7611,
-   -5329,  -2807,   -444,   1410,
-    2512,   2771,   2265,   1226,
-       0,  -1014,  -1444,  -1016,
-     378,   2647,   5497,   8464,
-   10981,  12466,  12430,  10566,
-    6827,   1460,  -4999, -11781,
-  -17979, -22671, -25061, -24602,
-  -21096, -14746,  -6155,   3735,
-   13757,  22665,  29303,  32766,
-   32524,  28510,  21134,  11241,
-       0, -11241, -21134, -28510,
-  -32524, -32766, -29303, -22665,
-  -13757,  -3735,   6155,  14746,
-   21096,  24602,  25061,  22671,
-   17979,  11781,   4999,  -1460,
-   -6827, -10566, -12430, -12466,
-  -10981,  -8464,  -5497,  -2647,
-    -378,   1016,   1444,   1014,
-       0,  -1226,  -2265,  -2771,
-   -2512,  -1410,    444,   2807,
-    5329,   7611,   9269,   9998,
-    9620,   8109,   5597,   2347,
-   -1278,  -4875,  -8050, -10470,
-  -11902, -12229, -11459,  -9710,
-   -7184,  -4139,   -852,   2406,
-    5395,   7916,   9818,  10999,
-   11399,  10999,   9818,   7916,
-    5395,   2406,   -852,  -4139,
-   -7184,  -9710, -11459, -12229,
-  -11902, -10470,  -8050,  -4875,
-   -1278,   2347,   5597,   8109,
-    9620,   9998,   9269,   7611,
-    5329,   2807,    444,  -1410,
-   -2512,  -2771,  -2265,  -1226,
-       0,   1014,   1444,   1016,
-    -378,  -2647,  -5497,  -8464,
-  -10981, -12466, -12430, -10566,
-   -6827,  -1460,   4999,  11781,
-   17979,  22671,  25061,  24602,
-   21096,  14746,   6155,  -3735,
-  -13757, -22665, -29303, -32766,
-  -32524, -28510, -21134, -11241,
-       0,      0,  12574,  23208,
-   30284,  32766,  30367,  23580,
-   13582,   2017,  -9283, -18611,
-  -24659, -26710, -24732, -19337,
-  -11638,  -3028,   5074,  11467,
-   15356,  16448,  14958,  11515,
-    7005,   2379,  -1533,  -4166,
-   -5301,  -5063,  -3856,  -2245,
-    -806,      0,    -67,   -988,
-   -2497,  -4155,  -5457,  -5950,
-   -5339,  -3560,   -796,   2553,
-    5944,   8792,  10585,  10976,
-    9843,   7310,   3721,   -423,
-   -4548,  -8102, -10635, -11856,
-  -11663, -10139,  -7523,  -4157,
-    -440,   3227,   6481,   9024,
-   10637,  11190,  10637,   9024,
-    6481,   3227,   -440,  -4157,
-   -7523, -10139, -11663, -11856,
-  -10635,  -8102,  -4548,   -423,
-    3721,   7310,   9843,  10976,
-   10585,   8792,   5944,   2553,
-    -796,  -3560,  -5339,  -5950,
-   -5457,  -4155,  -2497,   -988,
-     -67,      0,   -806,  -2245,
-   -3856,  -5063,  -5301,  -4166,
-   -1533,   2379,   7005,  11515,
-   14958,  16448,  15356,  11467,
-    5074,  -3028, -11638, -19337,
-  -24732, -26710, -24659, -18611,
-   -9283,   2017,  13582,  23580,
-   30367,  32766,  30284,  23208,
-   12574,      0, -12574, -23208,
-  -30284, -32766, -30367, -23580,
-  -13582,  -2017,   9283,  18611,
-   24659,  26710,  24732,  19337,
-   11638,   3028,  -5074, -11467,
-  -15356, -16448, -14958, -11515,
-   -7005,  -2379,   1533,   4166,
-    5301,   5063,   3856,   2245,
-     806,      0,     67,    988,
-    2497,   4155,   5457,   5950,
-    5339,   3560,    796,  -2553,
-   -5944,  -8792, -10585, -10976,
-   -9843,  -7310,  -3721,    423,
-    4548,   8102,  10635,  11856,
-   11663,  10139,   7523,   4157,
-     440,  -3227,  -6481,  -9024,
-  -10637, -11190, -10637,  -9024,
-   -6481,  -3227,    440,   4157,
-    7523,  10139,  11663,  11856,
-   10635,   8102,   4548,    423,
-   -3721,  -7310,  -9843, -10976,
-  -10585,  -8792,  -5944,  -2553,
-     796,   3560,   5339,   5950,
-    5457,   4155,   2497,    988,
-      67,      0,    806,   2245,
-    3856,   5063,   5301,   4166,
-    1533,  -2379,  -7005, -11515,
-  -14958, -16448, -15356, -11467,
-   -5074,   3028,  11638,  19337,
-   24732,  26710,  24659,  18611,
-    9283,  -2017, -13582, -23580,
-  -30367, -32766, -30284, -23208,
-  -12574,      0,      0,  14266,
-   25777,  32340,  32766,  27097,
-   16577,   3370,  -9904, -20716,
-  -27133, -28187, -24017, -15783,
-   -5364,   5074,  13539,  18618,
-   19709,  17080,  11725,   5073,
-   -1362,  -6328,  -9074,  -9463,
-   -7916,  -5241,  -2376,   -136,
-     990,    928,      0,  -1212,
-   -2056,  -2014,   -855,   1284,
-    3940,   6435,   8060,   8257,
-    6778,   3751,   -330,  -4711,
-   -8542, -11058, -11743, -10433,
-   -7342,  -3010,   1814,   6320,
-    9788,  11705,  11835,  10234,
-    7212,   3257,  -1048,  -5117,
-   -8431, -10588, -11335, -10588,
-   -8431,  -5117,  -1048,   3257,
-    7212,  10234,  11835,  11705,
-    9788,   6320,   1814,  -3010,
-   -7342, -10433, -11743, -11058,
-   -8542,  -4711,   -330,   3751,
-    6778,   8257,   8060,   6435,
-    3940,   1284,   -855,  -2014,
-   -2056,  -1212,      0,    928,
-     990,   -136,  -2376,  -5241,
-   -7916,  -9463,  -9074,  -6328,
-   -1362,   5073,  11725,  17080,
-   19709,  18618,  13539,   5074,
-   -5364, -15783, -24017, -28187,
-  -27133, -20716,  -9904,   3370,
-   16577,  27097,  32766,  32340,
-   25777,  14266,      0, -14266,
-  -25777, -32340, -32766, -27097,
-  -16577,  -3370,   9904,  20716,
-   27133,  28187,  24017,  15783,
-    5364,  -5074, -13539, -18618,
-  -19709, -17080, -11725,  -5073,
-    1362,   6328,   9074,   9463,
-    7916,   5241,   2376,    136,
-    -990,   -928,      0,   1212,
-    2056,   2014,    855,  -1284,
-   -3940,  -6435,  -8060,  -8257,
-   -6778,  -3751,    330,   4711,
-    8542,  11058,  11743,  10433,
-    7342,   3010,  -1814,  -6320,
-   -9788, -11705, -11835, -10234,
-   -7212,  -3257,   1048,   5117,
-    8431,  10588,  11335,  10588,
-    8431,   5117,   1048,  -3257,
-   -7212, -10234, -11835, -11705,
-   -9788,  -6320,  -1814,   3010,
-    7342,  10433,  11743,  11058,
-    8542,   4711,    330,  -3751,
-   -6778,  -8257,  -8060,  -6435,
-   -3940,  -1284,    855,   2014,
-    2056,   1212,      0,   -928,
-    -990,    136,   2376,   5241,
-    7916,   9463,   9074,   6328,
-    1362,  -5073, -11725, -17080,
-  -19709, -18618, -13539,  -5074,
-    5364,  15783,  24017,  28187,
-   27133,  20716,   9904,  -3370,
-  -16577, -27097, -32766, -32340,
-  -25777, -14266,      0,      0,
-   15506,  27348,  32766,  30580,
-   21457,   7714,  -7292, -20015,
-  -27597, -28538, -22998, -12674,
-    -295,  11114,  18996,  21856,
-   19546,  13175,   4717,  -3575,
-   -9776, -12740, -12305,  -9204,
-   -4745,   -370,   2777,   4133,
-    3804,   2428,    893,      0,
-     184,   1381,   3070,   4469,
-    4824,   3679,   1055,  -2521,
-   -6154,  -8832,  -9718,  -8401,
-   -5027,   -276,   4802,   9053,
-   11502,  11589,   9291,   5108,
-     -68,  -5170,  -9197, -11409,
-  -11463,  -9437,  -5779,  -1194,
-    3501,   7517,  10207,  11152,
-   10207,   7517,   3501,  -1194,
-   -5779,  -9437, -11463, -11409,
-   -9197,  -5170,    -68,   5108,
-    9291,  11589,  11502,   9053,
-    4802,   -276,  -5027,  -8401,
-   -9718,  -8832,  -6154,  -2521,
-    1055,   3679,   4824,   4469,
-    3070,   1381,    184,      0,
-     893,   2428,   3804,   4133,
-    2777,   -370,  -4745,  -9204,
-  -12305, -12740,  -9776,  -3575,
-    4717,  13175,  19546,  21856,
-   18996,  11114,   -295, -12674,
-  -22998, -28538, -27597, -20015,
-   -7292,   7714,  21457,  30580,
-   32766,  27348,  15506,      0,
-  -15506, -27348, -32766, -30580,
-  -21457,  -7714,   7292,  20015,
-   27597,  28538,  22998,  12674,
-     295, -11114, -18996, -21856,
-  -19546, -13175,  -4717,   3575,
-    9776,  12740,  12305,   9204,
-    4745,    370,  -2777,  -4133,
-   -3804,  -2428,   -893,      0,
-    -184,  -1381,  -3070,  -4469,
-   -4824,  -3679,  -1055,   2521,
-    6154,   8832,   9718,   8401,
-    5027,    276,  -4802,  -9053,
-  -11502, -11589,  -9291,  -5108,
-      68,   5170,   9197,  11409,
-   11463,   9437,   5779,   1194,
-   -3501,  -7517, -10207, -11152,
-  -10207,  -7517,  -3501,   1194,
-    5779,   9437,  11463,  11409,
-    9197,   5170,     68,  -5108,
-   -9291, -11589, -11502,  -9053,
-   -4802,    276,   5027,   8401,
-    9718,   8832,   6154,   2521,
-   -1055,  -3679,  -4824,  -4469,
-   -3070,  -1381,   -184,      0,
-    -893,  -2428,  -3804,  -4133,
-   -2777,    370,   4745,   9204,
-   12305,  12740,   9776,   3575,
-   -4717, -13175, -19546, -21856,
-  -18996, -11114,    295,  12674,
-   22998,  28538,  27597,  20015,
-    7292,  -7714, -21457, -30580,
-  -32766, -27348, -15506,      0,
-       0,   1370,   2738,   4101,
-    5456,   6802,   8135,   9454,
-   10756,  12038,  13298,  14535,
-   15746,  16929,  18081,  19201,
-   20287,  21337,  22349,  23322,
-   24253,  25143,  25988,  26787,
-   27541,  28246,  28903,  29510,
-   30067,  30573,  31027,  31429,
-   31779,  32075,  32319,  32510,
-   32648,  32733,  32766,  32747,
-   32677,  32556,  32384,  32164,
-   31896,  31580,  31218,  30812,
-   30362,  29870,  29337,  28765,
-   28156,  27511,  26833,  26122,
-   25382,  24613,  23818,  22999,
-   22158,  21297,  20418,  19523,
-   18615,  17696,  16768,  15834,
-   14894,  13952,  13010,  12070,
-   11134,  10204,   9282,   8371,
-    7472,   6587,   5718,   4867,
-    4035,   3225,   2438,   1676,
-     939,    230,   -450,  -1101,
-   -1720,  -2308,  -2862,  -3382,
-   -3868,  -4318,  -4733,  -5111,
-   -5452,  -5757,  -6024,  -6255,
-   -6448,  -6605,  -6725,  -6808,
-   -6856,  -6869,  -6847,  -6791,
-   -6703,  -6582,  -6431,  -6249,
-   -6039,  -5802,  -5538,  -5250,
-   -4938,  -4605,  -4252,  -3880,
-   -3492,  -3089,  -2672,  -2244,
-   -1807,  -1362,   -911,   -457,
-       0,    457,    911,   1362,
-    1807,   2244,   2672,   3089,
-    3492,   3880,   4252,   4605,
-    4938,   5250,   5538,   5802,
-    6039,   6249,   6431,   6582,
-    6703,   6791,   6847,   6869,
-    6856,   6808,   6725,   6605,
-    6448,   6255,   6024,   5757,
-    5452,   5111,   4733,   4318,
-    3868,   3382,   2862,   2308,
-    1720,   1101,    450,   -230,
-    -939,  -1676,  -2438,  -3225,
-   -4035,  -4867,  -5718,  -6587,
-   -7472,  -8371,  -9282, -10204,
-  -11134, -12070, -13010, -13952,
-  -14894, -15834, -16768, -17696,
-  -18615, -19523, -20418, -21297,
-  -22158, -22999, -23818, -24613,
-  -25382, -26122, -26833, -27511,
-  -28156, -28765, -29337, -29870,
-  -30362, -30812, -31218, -31580,
-  -31896, -32164, -32384, -32556,
-  -32677, -32747, -32766, -32733,
-  -32648, -32510, -32319, -32075,
-  -31779, -31429, -31027, -30573,
-  -30067, -29510, -28903, -28246,
-  -27541, -26787, -25988, -25143,
-  -24253, -23322, -22349, -21337,
-  -20287, -19201, -18081, -16929,
-  -15746, -14535, -13298, -12038,
-  -10756,  -9454,  -8135,  -6802,
-   -5456,  -4101,  -2738,  -1370,
-       0,      0,   3041,   6054,
-    9013,  11891,  14662,  17303,
-   19790,  22103,  24222,  26131,
-   27817,  29266,  30471,  31426,
-   32126,  32572,  32766,  32713,
-   32421,  31900,  31163,  30225,
-   29103,  27815,  26381,  24822,
-   23161,  21421,  19624,  17793,
-   15951,  14121,  12324,  10580,
-    8908,   7326,   5848,   4489,
-    3261,   2172,   1230,    441,
-    -194,   -674,  -1001,  -1178,
-   -1213,  -1112,   -885,   -543,
-    -100,    432,   1038,   1703,
-    2411,   3147,   3895,   4639,
-    5366,   6060,   6709,   7301,
-    7825,   8272,   8635,   8907,
-    9084,   9164,   9145,   9028,
-    8817,   8515,   8127,   7660,
-    7124,   6526,   5877,   5188,
-    4469,   3734,   2993,   2259,
-    1542,    855,    206,   -394,
-    -937,  -1415,  -1821,  -2151,
-   -2402,  -2570,  -2654,  -2657,
-   -2578,  -2423,  -2195,  -1899,
-   -1544,  -1137,   -686,   -201,
-     308,    831,   1358,   1878,
-    2382,   2859,   3300,   3698,
-    4043,   4329,   4551,   4704,
-    4784,   4790,   4720,   4576,
-    4359,   4073,   3721,   3309,
-    2843,   2332,   1783,   1205,
-     607,      0,   -607,  -1205,
-   -1783,  -2332,  -2843,  -3309,
-   -3721,  -4073,  -4359,  -4576,
-   -4720,  -4790,  -4784,  -4704,
-   -4551,  -4329,  -4043,  -3698,
-   -3300,  -2859,  -2382,  -1878,
-   -1358,   -831,   -308,    201,
-     686,   1137,   1544,   1899,
-    2195,   2423,   2578,   2657,
-    2654,   2570,   2402,   2151,
-    1821,   1415,    937,    394,
-    -206,   -855,  -1542,  -2259,
-   -2993,  -3734,  -4469,  -5188,
-   -5877,  -6526,  -7124,  -7660,
-   -8127,  -8515,  -8817,  -9028,
-   -9145,  -9164,  -9084,  -8907,
-   -8635,  -8272,  -7825,  -7301,
-   -6709,  -6060,  -5366,  -4639,
-   -3895,  -3147,  -2411,  -1703,
-   -1038,   -432,    100,    543,
-     885,   1112,   1213,   1178,
-    1001,    674,    194,   -441,
-   -1230,  -2172,  -3261,  -4489,
-   -5848,  -7326,  -8908, -10580,
-  -12324, -14121, -15951, -17793,
-  -19624, -21421, -23161, -24822,
-  -26381, -27815, -29103, -30225,
-  -31163, -31900, -32421, -32713,
-  -32766, -32572, -32126, -31426,
-  -30471, -29266, -27817, -26131,
-  -24222, -22103, -19790, -17303,
-  -14662, -11891,  -9013,  -6054,
-   -3041,      0,      0,   5244,
-   10346,  15170,  19590,  23493,
-   26785,  29395,  31273,  32396,
-   32766,  32410,  31377,  29739,
-   27586,  25019,  22151,  19100,
-   15983,  12915,  10001,   7335,
-    4994,   3039,   1511,    431,
-    -199,   -398,   -202,    340,
-    1165,   2201,   3372,   4601,
-    5812,   6935,   7909,   8683,
-    9218,   9492,   9495,   9233,
-    8723,   7996,   7093,   6062,
-    4954,   3826,   2731,   1720,
-     838,    121,   -403,   -719,
-    -819,   -711,   -409,     59,
-     662,   1360,   2110,   2868,
-    3589,   4235,   4769,   5163,
-    5397,   5458,   5345,   5064,
-    4632,   4071,   3411,   2687,
-    1935,   1194,    499,   -115,
-    -620,   -993,  -1219,  -1292,
-   -1210,   -984,   -631,   -172,
-     365,    946,   1540,   2111,
-    2629,   3063,   3390,   3593,
-    3658,   3584,   3372,   3035,
-    2589,   2058,   1469,    851,
-     238,   -342,   -857,  -1284,
-   -1602,  -1796,  -1858,  -1788,
-   -1591,  -1281,   -876,   -401,
-     118,    650,   1166,   1636,
-    2034,   2337,   2528,   2594,
-    2532,   2342,   2035,   1624,
-    1131,    580,      0,   -580,
-   -1131,  -1624,  -2035,  -2342,
-   -2532,  -2594,  -2528,  -2337,
-   -2034,  -1636,  -1166,   -650,
-    -118,    401,    876,   1281,
-    1591,   1788,   1858,   1796,
-    1602,   1284,    857,    342,
-    -238,   -851,  -1469,  -2058,
-   -2589,  -3035,  -3372,  -3584,
-   -3658,  -3593,  -3390,  -3063,
-   -2629,  -2111,  -1540,   -946,
-    -365,    172,    631,    984,
-    1210,   1292,   1219,    993,
-     620,    115,   -499,  -1194,
-   -1935,  -2687,  -3411,  -4071,
-   -4632,  -5064,  -5345,  -5458,
-   -5397,  -5163,  -4769,  -4235,
-   -3589,  -2868,  -2110,  -1360,
-    -662,    -59,    409,    711,
-     819,    719,    403,   -121,
-    -838,  -1720,  -2731,  -3826,
-   -4954,  -6062,  -7093,  -7996,
-   -8723,  -9233,  -9495,  -9492,
-   -9218,  -8683,  -7909,  -6935,
-   -5812,  -4601,  -3372,  -2201,
-   -1165,   -340,    202,    398,
-     199,   -431,  -1511,  -3039,
-   -4994,  -7335, -10001, -12915,
-  -15983, -19100, -22151, -25019,
-  -27586, -29739, -31377, -32410,
-  -32766, -32396, -31273, -29395,
-  -26785, -23493, -19590, -15170,
-  -10346,  -5244,      0,      0,
-    8000,  15500,  22039,  27240,
-   30831,  32673,  32766,  31241,
-   28350,  24433,  19892,  15146,
-   10596,   6593,   3405,   1201,
-      41,   -120,    579,   1927,
-    3666,   5524,   7241,   8599,
-    9439,   9675,   9300,   8378,
-    7033,   5434,   3767,   2218,
-     950,     81,   -319,   -242,
-     265,   1107,   2155,   3261,
-    4277,   5074,   5555,   5665,
-    5396,   4789,   3920,   2898,
-    1846,    885,    121,   -364,
-    -529,   -369,     79,    746,
-    1536,   2345,   3065,   3607,
-    3902,   3916,   3650,   3137,
-    2443,   1653,    861,    161,
-    -368,   -668,   -712,   -502,
-     -75,    508,   1169,   1821,
-    2380,   2774,   2954,   2898,
-    2614,   2136,   1523,    850,
-     199,   -355,   -746,   -932,
-    -895,   -646,   -222,    320,
-     909,   1467,   1923,   2218,
-    2316,   2202,   1890,   1418,
-     843,    236,   -332,   -791,
-   -1090,  -1193,  -1093,   -805,
-    -370,    155,    703,   1201,
-    1585,   1807,   1835,   1666,
-    1319,    834,    271,   -303,
-    -818,  -1213,  -1441,  -1476,
-   -1317,   -986,   -527,      0,
-     527,    986,   1317,   1476,
-    1441,   1213,    818,    303,
-    -271,   -834,  -1319,  -1666,
-   -1835,  -1807,  -1585,  -1201,
-    -703,   -155,    370,    805,
-    1093,   1193,   1090,    791,
-     332,   -236,   -843,  -1418,
-   -1890,  -2202,  -2316,  -2218,
-   -1923,  -1467,   -909,   -320,
-     222,    646,    895,    932,
-     746,    355,   -199,   -850,
-   -1523,  -2136,  -2614,  -2898,
-   -2954,  -2774,  -2380,  -1821,
-   -1169,   -508,     75,    502,
-     712,    668,    368,   -161,
-    -861,  -1653,  -2443,  -3137,
-   -3650,  -3916,  -3902,  -3607,
-   -3065,  -2345,  -1536,   -746,
-     -79,    369,    529,    364,
-    -121,   -885,  -1846,  -2898,
-   -3920,  -4789,  -5396,  -5665,
-   -5555,  -5074,  -4277,  -3261,
-   -2155,  -1107,   -265,    242,
-     319,    -81,   -950,  -2218,
-   -3767,  -5434,  -7033,  -8378,
-   -9300,  -9675,  -9439,  -8599,
-   -7241,  -5524,  -3666,  -1927,
-    -579,    120,    -41,  -1201,
-   -3405,  -6593, -10596, -15146,
-  -19892, -24433, -28350, -31241,
-  -32766, -32673, -30831, -27240,
-  -22039, -15500,  -8000,      0,
-       0,  11213,  21036,  28312,
-   32294,  32766,  30049,  24924,
-   18470,  11863,   6160,   2132,
-     145,    142,   1696,   4134,
-    6696,   8701,   9678,   9442,
-    8108,   6030,   3708,   1656,
-     287,   -171,    281,   1438,
-    2943,   4387,   5404,   5752,
-    5364,   4354,   2975,   1558,
-     424,   -188,   -174,    415,
-    1394,   2496,   3433,   3974,
-    3991,   3488,   2596,   1533,
-     552,   -124,   -351,   -101,
-     539,   1393,   2235,   2854,
-    3096,   2906,   2334,   1523,
-     668,    -27,   -405,   -389,
-       0,    652,   1394,   2036,
-    2419,   2446,   2115,   1507,
-     771,     84,   -392,   -550,
-    -362,    113,    749,   1383,
-    1853,   2043,   1906,   1475,
-     856,    199,   -337,   -629,
-    -612,   -298,    227,    828,
-    1351,   1664,   1690,   1420,
-     920,    312,   -257,   -652,
-    -781,   -618,   -210,    338,
-     884,   1292,   1457,   1337,
-     961,    418,   -160,   -634,
-    -890,   -870,   -585,   -108,
-     438,    914,   1200,   1222,
-     972,    510,    -54,   -584,
-    -951,  -1069,   -912,   -522,
-       0,    522,    912,   1069,
-     951,    584,     54,   -510,
-    -972,  -1222,  -1200,   -914,
-    -438,    108,    585,    870,
-     890,    634,    160,   -418,
-    -961,  -1337,  -1457,  -1292,
-    -884,   -338,    210,    618,
-     781,    652,    257,   -312,
-    -920,  -1420,  -1690,  -1664,
-   -1351,   -828,   -227,    298,
-     612,    629,    337,   -199,
-    -856,  -1475,  -1906,  -2043,
-   -1853,  -1383,   -749,   -113,
-     362,    550,    392,    -84,
-    -771,  -1507,  -2115,  -2446,
-   -2419,  -2036,  -1394,   -652,
-       0,    389,    405,     27,
-    -668,  -1523,  -2334,  -2906,
-   -3096,  -2854,  -2235,  -1393,
-    -539,    101,    351,    124,
-    -552,  -1533,  -2596,  -3488,
-   -3991,  -3974,  -3433,  -2496,
-   -1394,   -415,    174,    188,
-    -424,  -1558,  -2975,  -4354,
-   -5364,  -5752,  -5404,  -4387,
-   -2943,  -1438,   -281,    171,
-    -287,  -1656,  -3708,  -6030,
-   -8108,  -9442,  -9678,  -8701,
-   -6696,  -4134,  -1696,   -142,
-    -145,  -2132,  -6160, -11863,
-  -18470, -24924, -30049, -32766,
-  -32294, -28312, -21036, -11213,
-       0,      0,  14981,  26678,
-   32766,  32524,  26959,  18385,
-    9620,   3087,    119,    680,
-    3580,   7043,   9414,   9738,
-    8011,   5055,   2097,    235,
-      22,   1292,   3303,   5085,
-    5853,   5313,   3742,   1826,
-     348,   -143,    453,   1776,
-    3186,   4050,   4001,   3084,
-    1708,    456,   -169,     43,
-     940,   2086,   2958,   3178,
-    2659,   1639,    556,   -138,
-    -177,    417,   1350,   2195,
-    2579,   2339,   1585,    647,
-     -77,   -294,     64,    815,
-    1613,   2101,   2068,   1532,
-     727,      0,   -346,   -180,
-     407,   1142,   1695,   1823,
-    1471,    795,     85,   -356,
-    -350,     85,    745,   1334,
-    1589,   1399,    848,    174,
-    -334,   -465,   -172,    404,
-    1003,   1358,   1312,    885,
-     261,   -291,   -537,   -378,
-     105,    695,   1127,   1209,
-     904,    344,   -231,   -574,
-    -543,   -159,    403,    891,
-    1088,    905,    419,   -160,
-    -583,   -672,   -393,    125,
-     649,    947,    883,    483,
-     -82,   -569,   -770,   -601,
-    -143,    400,    785,    839,
-     534,      0,   -534,   -839,
-    -785,   -400,    143,    601,
-     770,    569,     82,   -483,
-    -883,   -947,   -649,   -125,
-     393,    672,    583,    160,
-    -419,   -905,  -1088,   -891,
-    -403,    159,    543,    574,
-     231,   -344,   -904,  -1209,
-   -1127,   -695,   -105,    378,
-     537,    291,   -261,   -885,
-   -1312,  -1358,  -1003,   -404,
-     172,    465,    334,   -174,
-    -848,  -1399,  -1589,  -1334,
-    -745,    -85,    350,    356,
-     -85,   -795,  -1471,  -1823,
-   -1695,  -1142,   -407,    180,
-     346,      0,   -727,  -1532,
-   -2068,  -2101,  -1613,   -815,
-     -64,    294,     77,   -647,
-   -1585,  -2339,  -2579,  -2195,
-   -1350,   -417,    177,    138,
-    -556,  -1639,  -2659,  -3178,
-   -2958,  -2086,   -940,    -43,
-     169,   -456,  -1708,  -3084,
-   -4001,  -4050,  -3186,  -1776,
-    -453,    143,   -348,  -1826,
-   -3742,  -5313,  -5853,  -5085,
-   -3303,  -1292,    -22,   -235,
-   -2097,  -5055,  -8011,  -9738,
-   -9414,  -7043,  -3580,   -680,
-    -119,  -3087,  -9620, -18385,
-  -26959, -32524, -32766, -26678,
-  -14981,      0,      0,  18782,
-   30875,  32766,  25595,  14213,
-    4438,    100,   1467,   5764,
-    9252,   9514,   6631,   2697,
-     198,    378,   2607,   5010,
-    5836,   4581,   2193,    294,
-      35,   1369,   3185,   4140,
-    3586,   1955,    385,   -100,
-     716,   2145,   3125,   2968,
-    1810,    472,   -144,    322,
-    1462,   2426,   2525,   1705,
-     552,   -140,     69,    975,
-    1898,   2175,   1616,    625,
-    -109,    -97,    609,   1477,
-    1879,   1532,    689,    -60,
-    -205,    325,   1126,   1616,
-    1447,    743,      0,   -269,
-     102,    826,   1376,   1358,
-     786,     66,   -302,    -75,
-     566,   1152,   1262,    818,
-     135,   -310,   -215,    336,
-     938,   1158,    837,    204,
-    -298,   -323,    133,    733,
-    1045,    844,    271,   -270,
-    -404,    -47,    536,    923,
-     836,    334,   -230,   -461,
-    -206,    346,    793,    813,
-     390,   -181,   -498,   -345,
-     162,    654,    776,    438,
-    -124,   -516,   -465,    -16,
-     506,    723,    476,    -63,
-    -517,   -568,   -187,    350,
-     654,    503,      0,   -503,
-    -654,   -350,    187,    568,
-     517,     63,   -476,   -723,
-    -506,     16,    465,    516,
-     124,   -438,   -776,   -654,
-    -162,    345,    498,    181,
-    -390,   -813,   -793,   -346,
-     206,    461,    230,   -334,
-    -836,   -923,   -536,     47,
-     404,    270,   -271,   -844,
-   -1045,   -733,   -133,    323,
-     298,   -204,   -837,  -1158,
-    -938,   -336,    215,    310,
-    -135,   -818,  -1262,  -1152,
-    -566,     75,    302,    -66,
-    -786,  -1358,  -1376,   -826,
-    -102,    269,      0,   -743,
-   -1447,  -1616,  -1126,   -325,
-     205,     60,   -689,  -1532,
-   -1879,  -1477,   -609,     97,
-     109,   -625,  -1616,  -2175,
-   -1898,   -975,    -69,    140,
-    -552,  -1705,  -2525,  -2426,
-   -1462,   -322,    144,   -472,
-   -1810,  -2968,  -3125,  -2145,
-    -716,    100,   -385,  -1955,
-   -3586,  -4140,  -3185,  -1369,
-     -35,   -294,  -2193,  -4581,
-   -5836,  -5010,  -2607,   -378,
-    -198,  -2697,  -6631,  -9514,
-   -9252,  -5764,  -1467,   -100,
-   -4438, -14213, -25595, -32766,
-  -30875, -18782,      0,      0,
-   22434,  32766,  27597,  13893,
-    2643,    233,   4695,   9207,
-    8858,   4445,    529,    457,
-    3369,   5671,   4918,   2056,
-      44,    667,   2868,   4115,
-    3110,    984,    -72,    854,
-    2567,   3160,   2030,    409,
-     -43,   1012,   2328,   2464,
-    1302,     87,     55,   1138,
-    2104,   1909,    781,    -81,
-     188,   1226,   1876,   1443,
-     402,   -148,    333,   1274,
-    1641,   1044,    129,   -143,
-     476,   1282,   1396,    701,
-     -58,    -88,    606,   1250,
-    1146,    410,   -174,      0,
-     713,   1180,    896,    168,
-    -230,    108,    793,   1076,
-     651,    -25,   -236,    224,
-     841,    942,    418,   -169,
-    -201,    338,    853,    784,
-     204,   -268,   -136,    441,
-     830,    608,     13,   -323,
-     -49,    525,    772,    423,
-    -150,   -337,     51,    584,
-     682,    234,   -280,   -316,
-     155,    614,    562,     51,
-    -375,   -264,    253,    612,
-     419,   -121,   -434,   -190,
-     340,    576,    259,   -275,
-    -457,    -99,    406,    506,
-      88,   -405,   -447,      0,
-     447,    405,    -88,   -506,
-    -406,     99,    457,    275,
-    -259,   -576,   -340,    190,
-     434,    121,   -419,   -612,
-    -253,    264,    375,    -51,
-    -562,   -614,   -155,    316,
-     280,   -234,   -682,   -584,
-     -51,    337,    150,   -423,
-    -772,   -525,     49,    323,
-     -13,   -608,   -830,   -441,
-     136,    268,   -204,   -784,
-    -853,   -338,    201,    169,
-    -418,   -942,   -841,   -224,
-     236,     25,   -651,  -1076,
-    -793,   -108,    230,   -168,
-    -896,  -1180,   -713,      0,
-     174,   -410,  -1146,  -1250,
-    -606,     88,     58,   -701,
-   -1396,  -1282,   -476,    143,
-    -129,  -1044,  -1641,  -1274,
-    -333,    148,   -402,  -1443,
-   -1876,  -1226,   -188,     81,
-    -781,  -1909,  -2104,  -1138,
-     -55,    -87,  -1302,  -2464,
-   -2328,  -1012,     43,   -409,
-   -2030,  -3160,  -2567,   -854,
-      72,   -984,  -3110,  -4115,
-   -2868,   -667,    -44,  -2056,
-   -4918,  -5671,  -3369,   -457,
-    -529,  -4445,  -8858,  -9207,
-   -4695,   -233,  -2643, -13893,
-  -27597, -32766, -22434,      0,
-       0,   2221,   4169,   5746,
-    7056,   8269,   9471,  10631,
-   11691,  12651,  13563,  14468,
-   15353,  16184,  16951,  17683,
-   18409,  19124,  19803,  20435,
-   21037,  21633,  22223,  22787,
-   23312,  23812,  24305,  24794,
-   25264,  25701,  26115,  26522,
-   26926,  27315,  27676,  28015,
-   28346,  28675,  28993,  29286,
-   29558,  29821,  30083,  30335,
-   30566,  30776,  30977,  31176,
-   31367,  31540,  31692,  31833,
-   31973,  32107,  32225,  32321,
-   32406,  32489,  32568,  32631,
-   32674,  32704,  32732,  32756,
-   32766,  32756,  32732,  32704,
-   32674,  32631,  32568,  32489,
-   32406,  32321,  32225,  32107,
-   31973,  31833,  31692,  31540,
-   31367,  31176,  30977,  30776,
-   30566,  30335,  30083,  29821,
-   29558,  29286,  28993,  28675,
-   28346,  28015,  27676,  27315,
-   26926,  26522,  26115,  25701,
-   25264,  24794,  24305,  23812,
-   23312,  22787,  22223,  21633,
-   21037,  20435,  19803,  19124,
-   18409,  17683,  16951,  16184,
-   15353,  14468,  13563,  12651,
-   11691,  10631,   9471,   8269,
-    7056,   5746,   4169,   2221,
-       0,  -2221,  -4169,  -5746,
-   -7056,  -8269,  -9471, -10631,
-  -11691, -12651, -13563, -14468,
-  -15353, -16184, -16951, -17683,
-  -18409, -19124, -19803, -20435,
-  -21037, -21633, -22223, -22787,
-  -23312, -23812, -24305, -24794,
-  -25264, -25701, -26115, -26522,
-  -26926, -27315, -27676, -28015,
-  -28346, -28675, -28993, -29286,
-  -29558, -29821, -30083, -30335,
-  -30566, -30776, -30977, -31176,
-  -31367, -31540, -31692, -31833,
-  -31973, -32107, -32225, -32321,
-  -32406, -32489, -32568, -32631,
-  -32674, -32704, -32732, -32756,
-  -32766, -32756, -32732, -32704,
-  -32674, -32631, -32568, -32489,
-  -32406, -32321, -32225, -32107,
-  -31973, -31833, -31692, -31540,
-  -31367, -31176, -30977, -30776,
-  -30566, -30335, -30083, -29821,
-  -29558, -29286, -28993, -28675,
-  -28346, -28015, -27676, -27315,
-  -26926, -26522, -26115, -25701,
-  -25264, -24794, -24305, -23812,
-  -23312, -22787, -22223, -21633,
-  -21037, -20435, -19803, -19124,
-  -18409, -17683, -16951, -16184,
-  -15353, -14468, -13563, -12651,
-  -11691, -10631,  -9471,  -8269,
-   -7056,  -5746,  -4169,  -2221,
-       0,      0,   5540,   9174,
-   12323,  14903,  17298,  19330,
-   21213,  22851,  24386,  25706,
-   26935,  27998,  28981,  29801,
-   30551,  31163,  31702,  32100,
-   32435,  32637,  32766,  32756,
-   32679,  32455,  32147,  31677,
-   31118,  30353,  29468,  28288,
-   26901,  24660,  22369,  20808,
-   19352,  18062,  16778,  15557,
-   14288,  13006,  11603,  10028,
-    7881,   6164,   4899,   3793,
-    2854,   2020,   1299,    658,
-     102,   -380,   -787,  -1129,
-   -1404,  -1608,  -1748,  -1817,
-   -1817,  -1724,  -1557,  -1256,
-    -833,     -2,    863,   1347,
-    1786,   2116,   2442,   2709,
-    2990,   3227,   3483,   3712,
-    3969,   4201,   4471,   4729,
-    5036,   5335,   5710,   6097,
-    6611,   7181,   8160,   9451,
-   10116,  10469,  10633,  10605,
-   10436,  10073,   9575,   8797,
-    7811,   6007,   4169,   3092,
-    2151,   1431,    761,    214,
-    -300,   -722,  -1129,  -1466,
-   -1784,  -2043,  -2295,  -2493,
-   -2675,  -2813,  -2944,  -3024,
-   -3091,  -3119,  -3137,  -3098,
-   -3048,  -2954,  -2842,  -2653,
-   -2458,  -2190,  -1874,  -1409,
-    -937,      0,    937,   1409,
-    1874,   2190,   2458,   2653,
-    2842,   2954,   3048,   3098,
-    3137,   3119,   3091,   3024,
-    2944,   2813,   2675,   2493,
-    2295,   2043,   1784,   1466,
-    1129,    722,    300,   -214,
-    -761,  -1431,  -2151,  -3092,
-   -4169,  -6007,  -7811,  -8797,
-   -9575, -10073, -10436, -10605,
-  -10633, -10469, -10116,  -9451,
-   -8160,  -7181,  -6611,  -6097,
-   -5710,  -5335,  -5036,  -4729,
-   -4471,  -4201,  -3969,  -3712,
-   -3483,  -3227,  -2990,  -2709,
-   -2442,  -2116,  -1786,  -1347,
-    -863,      2,    833,   1256,
-    1557,   1724,   1817,   1817,
-    1748,   1608,   1404,   1129,
-     787,    380,   -102,   -658,
-   -1299,  -2020,  -2854,  -3793,
-   -4899,  -6164,  -7881, -10028,
-  -11603, -13006, -14288, -15557,
-  -16778, -18062, -19352, -20808,
-  -22369, -24660, -26901, -28288,
-  -29468, -30353, -31118, -31677,
-  -32147, -32455, -32679, -32756,
-  -32766, -32637, -32435, -32100,
-  -31702, -31163, -30551, -29801,
-  -28981, -27998, -26935, -25706,
-  -24386, -22851, -21213, -19330,
-  -17298, -14903, -12323,  -9174,
-   -5540,      0,      0,   8456,
-   13476,  17775,  21023,  23920,
-   26164,  28156,  29653,  30936,
-   31795,  32453,  32715,  32766,
-   32408,  31804,  30709,  29264,
-   26861,  23704,  21122,  18231,
-   14890,  12333,   9950,   7569,
-    4687,   2464,    692,   -806,
-   -2193,  -3422,  -4939,  -6189,
-   -6682,  -6725,  -6117,  -4502,
-   -3423,  -2735,  -2093,  -1458,
-    -714,    372,   1191,   1724,
-    2169,   2534,   2856,   3187,
-    3525,   4211,   5012,   4858,
-    4239,   2484,    866,    -76,
-    -962,  -1685,  -2442,  -3128,
-   -3926,  -4732,  -6010,  -7193,
-   -7831,  -8258,  -8488,  -8535,
-   -8425,  -8065,  -7506,  -6187,
-   -4612,  -4085,  -3913,  -4595,
-   -5051,  -5031,  -4879,  -4535,
-   -4072,  -3367,  -2468,   -822,
-    1498,   2547,   3045,   3038,
-    2660,   1542,   -411,  -1676,
-   -2679,  -3637,  -4924,  -6130,
-   -6675,  -7044,  -7073,  -6946,
-   -6290,  -5185,  -4630,  -4462,
-   -4550,  -5375,  -5509,  -4837,
-   -3124,  -1765,  -1024,   -374,
-      88,    509,    817,   1098,
-    1294,   1466,   1564,   1639,
-    1641,   1615,   1506,   1358,
-    1086,    735,      0,   -735,
-   -1086,  -1358,  -1506,  -1615,
-   -1641,  -1639,  -1564,  -1466,
-   -1294,  -1098,   -817,   -509,
-     -88,    374,   1024,   1765,
-    3124,   4837,   5509,   5375,
-    4550,   4462,   4630,   5185,
-    6290,   6946,   7073,   7044,
-    6675,   6130,   4924,   3637,
-    2679,   1676,    411,  -1542,
-   -2660,  -3038,  -3045,  -2547,
-   -1498,    822,   2468,   3367,
-    4072,   4535,   4879,   5031,
-    5051,   4595,   3913,   4085,
-    4612,   6187,   7506,   8065,
-    8425,   8535,   8488,   8258,
-    7831,   7193,   6010,   4732,
-    3926,   3128,   2442,   1685,
-     962,     76,   -866,  -2484,
-   -4239,  -4858,  -5012,  -4211,
-   -3525,  -3187,  -2856,  -2534,
-   -2169,  -1724,  -1191,   -372,
-     714,   1458,   2093,   2735,
-    3423,   4502,   6117,   6725,
-    6682,   6189,   4939,   3422,
-    2193,    806,   -692,  -2464,
-   -4687,  -7569,  -9950, -12333,
-  -14890, -18231, -21122, -23704,
-  -26861, -29264, -30709, -31804,
-  -32408, -32766, -32715, -32453,
-  -31795, -30936, -29653, -28156,
-  -26164, -23920, -21023, -17775,
-  -13476,  -8456,      0,      0,
-    9956,  15621,  20381,  23809,
-   26788,  28912,  30704,  31806,
-   32611,  32766,  32610,  31723,
-   30428,  27835,  24503,  20930,
-   17371,  14123,  10594,   7924,
-    5202,   2447,    455,  -1108,
-   -2491,  -3904,  -4557,  -4158,
-   -2768,  -1855,  -1100,     -2,
-    1116,   1893,   2711,   3664,
-    5173,   5989,   6286,   6254,
-    5917,   5166,   3735,   2490,
-    1587,    544,   -484,  -2222,
-   -3779,  -4462,  -4553,  -4222,
-   -4355,  -4569,  -5312,  -5588,
-   -4373,  -3174,  -2607,  -2070,
-   -1673,  -1206,   -773,      7,
-     686,    927,    970,    827,
-     463,   -112,  -1377,  -2826,
-   -2838,  -2568,  -2885,  -3528,
-   -4723,  -5905,  -6725,  -8141,
-   -9235,  -9353,  -8877,  -7833,
-   -5491,  -1915,   -128,   1019,
-    1595,   1870,   1485,    507,
-       5,   -164,   -274,     10,
-     170,   -164,   -973,  -2575,
-   -3445,  -3530,  -3142,  -3097,
-   -3287,  -3655,  -4549,  -4930,
-   -4676,  -3700,  -3030,  -3352,
-   -3461,  -2016,   -824,   -209,
-     304,    653,    951,   1146,
-    1304,   1374,   1408,   1351,
-    1249,   1019,    706,      0,
-    -706,  -1019,  -1249,  -1351,
-   -1408,  -1374,  -1304,  -1146,
-    -951,   -653,   -304,    209,
-     824,   2016,   3461,   3352,
-    3030,   3700,   4676,   4930,
-    4549,   3655,   3287,   3097,
-    3142,   3530,   3445,   2575,
-     973,    164,   -170,    -10,
-     274,    164,     -5,   -507,
-   -1485,  -1870,  -1595,  -1019,
-     128,   1915,   5491,   7833,
-    8877,   9353,   9235,   8141,
-    6725,   5905,   4723,   3528,
-    2885,   2568,   2838,   2826,
-    1377,    112,   -463,   -827,
-    -970,   -927,   -686,     -7,
-     773,   1206,   1673,   2070,
-    2607,   3174,   4373,   5588,
-    5312,   4569,   4355,   4222,
-    4553,   4462,   3779,   2222,
-     484,   -544,  -1587,  -2490,
-   -3735,  -5166,  -5917,  -6254,
-   -6286,  -5989,  -5173,  -3664,
-   -2711,  -1893,  -1116,      2,
-    1100,   1855,   2768,   4158,
-    4557,   3904,   2491,   1108,
-    -455,  -2447,  -5202,  -7924,
-  -10594, -14123, -17371, -20930,
-  -24503, -27835, -30428, -31723,
-  -32610, -32766, -32611, -31806,
-  -30704, -28912, -26788, -23809,
-  -20381, -15621,  -9956,      0,
-       0,  12271,  18781,  24044,
-   27490,  30257,  31809,  32766,
-   32653,  31825,  29680,  25854,
-   20898,  16157,  11421,   7292,
-    3416,    204,  -2433,  -4654,
-   -5818,  -5923,  -5206,  -3943,
-   -2108,   -862,    570,   1650,
-    2690,   4042,   4404,   4154,
-    2973,   1462,    231,  -1718,
-   -3317,  -3688,  -4743,  -6329,
-   -7129,  -7360,  -7213,  -6334,
-   -5601,  -4898,  -3976,  -2361,
-   -2030,  -2040,  -1548,   -386,
-    1077,    564,   -988,  -2389,
-   -3381,  -3273,  -3793,  -5083,
-   -5406,  -5559,  -5268,  -4825,
-   -3593,  -2351,  -1557,   -879,
-    -172,    555,   1931,   2387,
-    1865,   2183,   2190,    921,
-      22,     51,   -215,   -757,
-   -2036,  -3547,  -4992,  -5052,
-   -4178,  -1492,   2767,   4716,
-    5680,   5765,   4789,   3948,
-    3135,   3491,   4195,   3926,
-    3008,   1772,   1140,    213,
-    -908,  -1391,   -628,    906,
-    1397,    643,    462,   1212,
-    1902,   2442,   3442,   3881,
-    3493,   2925,   3538,   3180,
-    2473,   2358,    947,    254,
-    -240,   -553,   -794,   -931,
-    -994,   -977,   -844,   -613,
-       0,    613,    844,    977,
-     994,    931,    794,    553,
-     240,   -254,   -947,  -2358,
-   -2473,  -3180,  -3538,  -2925,
-   -3493,  -3881,  -3442,  -2442,
-   -1902,  -1212,   -462,   -643,
-   -1397,   -906,    628,   1391,
-     908,   -213,  -1140,  -1772,
-   -3008,  -3926,  -4195,  -3491,
-   -3135,  -3948,  -4789,  -5765,
-   -5680,  -4716,  -2767,   1492,
-    4178,   5052,   4992,   3547,
-    2036,    757,    215,    -51,
-     -22,   -921,  -2190,  -2183,
-   -1865,  -2387,  -1931,   -555,
-     172,    879,   1557,   2351,
-    3593,   4825,   5268,   5559,
-    5406,   5083,   3793,   3273,
-    3381,   2389,    988,   -564,
-   -1077,    386,   1548,   2040,
-    2030,   2361,   3976,   4898,
-    5601,   6334,   7213,   7360,
-    7129,   6329,   4743,   3688,
-    3317,   1718,   -231,  -1462,
-   -2973,  -4154,  -4404,  -4042,
-   -2690,  -1650,   -570,    862,
-    2108,   3943,   5206,   5923,
-    5818,   4654,   2433,   -204,
-   -3416,  -7292, -11421, -16157,
-  -20898, -25854, -29680, -31825,
-  -32653, -32766, -31809, -30257,
-  -27490, -24044, -18781, -12271,
-       0,      0,  14366,  21477,
-   26975,  30120,  32291,  32766,
-   32189,  29681,  24770,  18374,
-   12441,   6763,   2065,  -2057,
-   -4977,  -7057,  -7253,  -5935,
-   -4390,  -2321,   -491,    924,
-    2196,   3233,   2987,   1547,
-    -180,  -2248,  -3378,  -5376,
-   -6731,  -7867,  -8601,  -7857,
-   -6964,  -6215,  -3605,  -2406,
-   -1761,   -368,    300,    313,
-    -199,   -852,  -1418,  -2762,
-   -2941,  -3617,  -4677,  -5346,
-   -3528,   -703,     80,     25,
-     969,   1855,   2907,   3106,
-    2819,   2299,   1342,   1063,
-     562,     57,   -561,   -427,
-    -298,    731,   1541,   2257,
-    2854,   2766,   4178,   5516,
-    4755,   3847,   2677,   1725,
-    2022,   1276,   -276,  -2483,
-   -4056,  -3879,  -1517,   2765,
-    4284,   4523,   3177,   1627,
-    1072,   1216,   1366,    614,
-    -822,  -1837,  -2956,  -2877,
-   -2515,  -3121,  -4325,  -3285,
-    -607,    437,     -8,   -186,
-      86,   -146,  -1038,     37,
-    -570,  -2094,  -2946,  -2600,
-   -2812,  -3038,  -2593,  -2500,
-   -1883,   -920,    -71,    250,
-     588,    694,    794,    706,
-     553,      0,   -553,   -706,
-    -794,   -694,   -588,   -250,
-      71,    920,   1883,   2500,
-    2593,   3038,   2812,   2600,
-    2946,   2094,    570,    -37,
-    1038,    146,    -86,    186,
-       8,   -437,    607,   3285,
-    4325,   3121,   2515,   2877,
-    2956,   1837,    822,   -614,
-   -1366,  -1216,  -1072,  -1627,
-   -3177,  -4523,  -4284,  -2765,
-    1517,   3879,   4056,   2483,
-     276,  -1276,  -2022,  -1725,
-   -2677,  -3847,  -4755,  -5516,
-   -4178,  -2766,  -2854,  -2257,
-   -1541,   -731,    298,    427,
-     561,    -57,   -562,  -1063,
-   -1342,  -2299,  -2819,  -3106,
-   -2907,  -1855,   -969,    -25,
-     -80,    703,   3528,   5346,
-    4677,   3617,   2941,   2762,
-    1418,    852,    199,   -313,
-    -300,    368,   1761,   2406,
-    3605,   6215,   6964,   7857,
-    8601,   7867,   6731,   5376,
-    3378,   2248,    180,  -1547,
-   -2987,  -3233,  -2196,   -924,
-     491,   2321,   4390,   5935,
-    7253,   7057,   4977,   2057,
-   -2065,  -6763, -12441, -18374,
-  -24770, -29681, -32189, -32766,
-  -32291, -30120, -26975, -21477,
-  -14366,      0,      0,  15443,
-   22783,  28303,  31117,  32766,
-   32290,  30250,  24755,  18019,
-   11402,   5697,    752,  -2885,
-   -5465,  -5904,  -4602,  -2651,
-    -520,   1255,   2970,   4005,
-    3944,   2613,    948,  -1260,
-   -3309,  -5183,  -6705,  -7053,
-   -6962,  -5872,  -4702,  -3433,
-   -2138,  -1085,   -840,    518,
-    -659,  -1838,  -2639,  -3785,
-   -4364,  -4899,  -4983,  -4058,
-   -3109,  -1970,   -634,      9,
-     -68,   1444,   3169,   1993,
-     339,     34,   -949,  -1529,
-   -1675,  -1789,  -1027,    -35,
-     859,   1468,   2605,   3481,
-    3752,   3528,   2731,   2087,
-    1773,   1408,   -162,   -178,
-     900,   1051,   1987,   1823,
-    1857,   2810,   3591,   3313,
-    1312,  -1357,  -2486,  -1058,
-    1934,   2638,   1584,   -558,
-   -1356,   -423,    464,   1129,
-     996,    301,    504,    370,
-    -624,  -1329,  -2348,  -3783,
-   -3300,  -1381,  -1466,  -2272,
-   -1194,   -475,   -264,   -830,
-     456,    136,   -317,  -1168,
-   -1754,  -2118,  -2599,  -2304,
-   -2441,  -2011,  -1667,   -586,
-      35,    414,    599,    720,
-     669,    534,      0,   -534,
-    -669,   -720,   -599,   -414,
-     -35,    586,   1667,   2011,
-    2441,   2304,   2599,   2118,
-    1754,   1168,    317,   -136,
-    -456,    830,    264,    475,
-    1194,   2272,   1466,   1381,
-    3300,   3783,   2348,   1329,
-     624,   -370,   -504,   -301,
-    -996,  -1129,   -464,    423,
-    1356,    558,  -1584,  -2638,
-   -1934,   1058,   2486,   1357,
-   -1312,  -3313,  -3591,  -2810,
-   -1857,  -1823,  -1987,  -1051,
-    -900,    178,    162,  -1408,
-   -1773,  -2087,  -2731,  -3528,
-   -3752,  -3481,  -2605,  -1468,
-    -859,     35,   1027,   1789,
-    1675,   1529,    949,    -34,
-    -339,  -1993,  -3169,  -1444,
-      68,     -9,    634,   1970,
-    3109,   4058,   4983,   4899,
-    4364,   3785,   2639,   1838,
-     659,   -518,    840,   1085,
-    2138,   3433,   4702,   5872,
-    6962,   7053,   6705,   5183,
-    3309,   1260,   -948,  -2613,
-   -3944,  -4005,  -2970,  -1255,
-     520,   2651,   4602,   5904,
-    5465,   2885,   -752,  -5697,
-  -11402, -18019, -24755, -30250,
-  -32290, -32766, -31117, -28303,
-  -22783, -15443,      0,      0,
-   17310,  24974,  30370,  32425,
-   32766,  29921,  23383,  14942,
-    7667,   1200,  -3398,  -6572,
-   -6687,  -4867,  -2347,    -33,
-    1972,   3232,   2950,   1133,
-   -1172,  -3783,  -5823,  -7285,
-   -8034,  -7275,  -5773,  -4256,
-   -2039,   -898,    190,    -14,
-    -758,  -1892,  -2920,  -4420,
-   -3815,  -3893,  -2820,  -1482,
-       7,   1207,   2483,   2962,
-    2373,   1666,    932,    -44,
-    -534,  -2096,   -681,   2241,
-    2202,   2533,   3822,   3574,
-    3885,   3057,   1933,   1486,
-     349,   -241,   -400,     -7,
-     562,    835,   1442,   2043,
-    2004,   1341,    533,   -548,
-    -878,  -1084,  -2224,  -1606,
-    -917,   -767,   -836,     60,
-     791,    -82,  -3070,  -4942,
-   -3398,    307,    888,   -863,
-   -2755,  -2053,   -661,    -31,
-    -408,   -190,    208,     68,
-    -648,  -1213,  -1311,   -661,
-   -1865,  -1277,   1832,   2363,
-    1724,   2389,   1809,   1960,
-     650,    771,    380,     -7,
-    -236,    312,    735,   1421,
-    2139,   2065,   2208,   1902,
-    1589,    598,    -60,   -381,
-    -557,   -581,   -484,      0,
-     484,    581,    557,    381,
-      60,   -598,  -1589,  -1902,
-   -2208,  -2065,  -2139,  -1421,
-    -735,   -312,    236,      7,
-    -380,   -771,   -650,  -1960,
-   -1809,  -2389,  -1724,  -2363,
-   -1832,   1277,   1865,    661,
-    1311,   1213,    648,    -68,
-    -208,    190,    408,     31,
-     661,   2053,   2755,    863,
-    -888,   -307,   3398,   4942,
-    3070,     82,   -791,    -60,
-     836,    767,    917,   1606,
-    2224,   1084,    878,    548,
-    -533,  -1341,  -2004,  -2043,
-   -1442,   -835,   -562,      7,
-     400,    241,   -349,  -1486,
-   -1933,  -3057,  -3885,  -3574,
-   -3822,  -2533,  -2202,  -2241,
-     681,   2096,    534,     44,
-    -932,  -1666,  -2373,  -2962,
-   -2483,  -1207,     -7,   1482,
-    2820,   3893,   3815,   4420,
-    2920,   1892,    758,     14,
-    -190,    898,   2039,   4256,
-    5773,   7275,   8034,   7285,
-    5823,   3783,   1172,  -1133,
-   -2950,  -3232,  -1972,     33,
-    2347,   4867,   6687,   6572,
-    3398,  -1200,  -7667, -14942,
-  -23383, -29921, -32766, -32425,
-  -30370, -24974, -17310,      0,
-       0,   3170,   5785,   7881,
-    9737,  11400,  12865,  14256,
-   15624,  16894,  18056,  19153,
-   20169,  21106,  22022,  22916,
-   23746,  24518,  25251,  25925,
-   26555,  27176,  27772,  28316,
-   28823,  29297,  29722,  30120,
-   30512,  30873,  31190,  31481,
-   31738,  31953,  32150,  32339,
-   32490,  32603,  32694,  32749,
-   32763,  32766,  32753,  32696,
-   32604,  32490,  32331,  32131,
-   31924,  31686,  31391,  31066,
-   30709,  30286,  29820,  29342,
-   28798,  28169,  27508,  26775,
-   25898,  24952,  23941,  22579,
-   20761,  18929,  17533,  16477,
-   15486,  14559,  13764,  13017,
-   12275,  11600,  10984,  10378,
-    9810,   9292,   8778,   8268,
-    7800,   7356,   6919,   6513,
-    6132,   5744,   5363,   5012,
-    4674,   4345,   4043,   3751,
-    3447,   3155,   2888,   2627,
-    2378,   2154,   1928,   1690,
-    1469,   1268,   1071,    893,
-     734,    562,    381,    224,
-      83,    -52,   -160,   -257,
-    -378,   -502,   -592,   -669,
-    -731,   -754,   -780,   -848,
-    -899,   -897,   -880,   -816,
-    -675,   -593,   -623,   -480,
-       0,    480,    623,    593,
-     675,    816,    880,    897,
-     899,    848,    780,    754,
-     731,    669,    592,    502,
-     378,    257,    160,     52,
-     -83,   -224,   -381,   -562,
-    -734,   -893,  -1071,  -1268,
-   -1469,  -1690,  -1928,  -2154,
-   -2378,  -2627,  -2888,  -3155,
-   -3447,  -3751,  -4043,  -4345,
-   -4674,  -5012,  -5363,  -5744,
-   -6132,  -6513,  -6919,  -7356,
-   -7800,  -8268,  -8778,  -9292,
-   -9810, -10378, -10984, -11600,
-  -12275, -13017, -13764, -14559,
-  -15486, -16477, -17533, -18929,
-  -20761, -22579, -23941, -24952,
-  -25898, -26775, -27508, -28169,
-  -28798, -29342, -29820, -30286,
-  -30709, -31066, -31391, -31686,
-  -31924, -32131, -32331, -32490,
-  -32604, -32696, -32753, -32766,
-  -32763, -32749, -32694, -32603,
-  -32490, -32339, -32150, -31953,
-  -31738, -31481, -31190, -30873,
-  -30512, -30120, -29722, -29297,
-  -28823, -28316, -27772, -27176,
-  -26555, -25925, -25251, -24518,
-  -23746, -22916, -22022, -21106,
-  -20169, -19153, -18056, -16894,
-  -15624, -14256, -12865, -11400,
-   -9737,  -7881,  -5785,  -3170,
-       0,      0,   4230,   7258,
-    9823,  11996,  13958,  15779,
-   17451,  18958,  20350,  21618,
-   22841,  23949,  24983,  25917,
-   26791,  27610,  28361,  29038,
-   29653,  30206,  30724,  31169,
-   31565,  31891,  32173,  32409,
-   32585,  32703,  32761,  32766,
-   32725,  32613,  32442,  32197,
-   31891,  31518,  31052,  30502,
-   29830,  29049,  28093,  26866,
-   25022,  23521,  22442,  21453,
-   20584,  19754,  18983,  18239,
-   17537,  16829,  16154,  15453,
-   14789,  14096,  13402,  12685,
-   11928,  11161,  10318,   9398,
-    8360,   6873,   5425,   4450,
-    3654,   2951,   2399,   1891,
-    1500,   1152,    879,    673,
-     532,    458,    450,    492,
-     634,    828,   1147,   1527,
-    2074,   2754,   3877,   5398,
-    6319,   7013,   7565,   8028,
-    8419,   8739,   9010,   9242,
-    9436,   9600,   9718,   9811,
-    9880,   9925,   9952,   9936,
-    9907,   9854,   9791,   9702,
-    9579,   9439,   9285,   9113,
-    8923,   8684,   8442,   8170,
-    7896,   7578,   7220,   6837,
-    6440,   6014,   5550,   4984,
-    4428,   3786,   3159,   2309,
-    1295,      0,  -1295,  -2309,
-   -3159,  -3786,  -4428,  -4984,
-   -5550,  -6014,  -6440,  -6837,
-   -7220,  -7578,  -7896,  -8170,
-   -8442,  -8684,  -8923,  -9113,
-   -9285,  -9439,  -9579,  -9702,
-   -9791,  -9854,  -9907,  -9936,
-   -9952,  -9925,  -9880,  -9811,
-   -9718,  -9600,  -9436,  -9242,
-   -9010,  -8739,  -8419,  -8028,
-   -7565,  -7013,  -6319,  -5398,
-   -3877,  -2754,  -2074,  -1527,
-   -1147,   -828,   -634,   -492,
-    -450,   -458,   -532,   -673,
-    -879,  -1152,  -1500,  -1891,
-   -2399,  -2951,  -3654,  -4450,
-   -5425,  -6873,  -8360,  -9398,
-  -10318, -11161, -11928, -12685,
-  -13402, -14096, -14789, -15453,
-  -16154, -16829, -17537, -18239,
-  -18983, -19754, -20584, -21453,
-  -22442, -23521, -25022, -26866,
-  -28093, -29049, -29830, -30502,
-  -31052, -31518, -31891, -32197,
-  -32442, -32613, -32725, -32766,
-  -32761, -32703, -32585, -32409,
-  -32173, -31891, -31565, -31169,
-  -30724, -30206, -29653, -29038,
-  -28361, -27610, -26791, -25917,
-  -24983, -23949, -22841, -21618,
-  -20350, -18958, -17451, -15779,
-  -13958, -11996,  -9823,  -7258,
-   -4230,      0,      0,   5139,
-    8598,  11570,  14026,  16326,
-   18307,  20133,  21738,  23260,
-   24594,  25831,  26920,  27946,
-   28830,  29638,  30328,  30962,
-   31471,  31913,  32247,  32524,
-   32678,  32766,  32737,  32644,
-   32409,  32096,  31625,  31057,
-   30252,  29282,  27675,  26021,
-   24887,  23821,  22870,  21910,
-   20974,  19990,  18983,  17860,
-   16569,  14786,  13358,  12305,
-   11371,  10577,   9859,   9227,
-    8646,   8136,   7673,   7262,
-    6889,   6569,   6288,   6049,
-    5847,   5693,   5585,   5522,
-    5521,   5588,   5837,   6112,
-    6224,   6332,   6397,   6470,
-    6521,   6595,   6652,   6730,
-    6799,   6901,   6996,   7123,
-    7252,   7430,   7612,   7857,
-    8125,   8509,   8949,   9736,
-   10805,  11346,  11628,  11748,
-   11723,  11586,  11294,  10892,
-   10287,   9522,   8143,   6731,
-    5890,   5142,   4549,   3990,
-    3528,   3083,   2695,   2320,
-    2002,   1686,   1406,   1134,
-     905,    674,    469,    273,
-     115,    -50,   -190,   -319,
-    -409,   -511,   -585,   -640,
-    -648,   -679,   -662,   -606,
-    -462,   -389,      0,    389,
-     462,    606,    662,    679,
-     648,    640,    585,    511,
-     409,    319,    190,     50,
-    -115,   -273,   -469,   -674,
-    -905,  -1134,  -1406,  -1686,
-   -2002,  -2320,  -2695,  -3083,
-   -3528,  -3990,  -4549,  -5142,
-   -5890,  -6731,  -8143,  -9522,
-  -10287, -10892, -11294, -11586,
-  -11723, -11748, -11628, -11346,
-  -10805,  -9736,  -8949,  -8509,
-   -8125,  -7857,  -7612,  -7430,
-   -7252,  -7123,  -6996,  -6901,
-   -6799,  -6730,  -6652,  -6595,
-   -6521,  -6470,  -6397,  -6332,
-   -6224,  -6112,  -5837,  -5588,
-   -5521,  -5522,  -5585,  -5693,
-   -5847,  -6049,  -6288,  -6569,
-   -6889,  -7262,  -7673,  -8136,
-   -8646,  -9227,  -9859, -10577,
-  -11371, -12305, -13358, -14786,
-  -16569, -17860, -18983, -19990,
-  -20974, -21910, -22870, -23821,
-  -24887, -26021, -27675, -29282,
-  -30252, -31057, -31625, -32096,
-  -32409, -32644, -32737, -32766,
-  -32678, -32524, -32247, -31913,
-  -31471, -30962, -30328, -29638,
-  -28830, -27946, -26920, -25831,
-  -24594, -23260, -21738, -20133,
-  -18307, -16326, -14026, -11570,
-   -8598,  -5139,      0,      0,
-    5974,   9842,  13176,  15911,
-   18417,  20517,  22472,  24152,
-   25693,  27010,  28231,  29244,
-   30161,  30908,  31558,  32034,
-   32426,  32647,  32766,  32713,
-   32549,  32179,  31663,  30884,
-   29786,  28003,  26594,  25404,
-   24260,  23041,  21753,  19974,
-   18220,  16985,  15861,  14885,
-   13951,  13082,  12221,  11376,
-   10480,   9479,   8103,   7077,
-    6456,   5995,   5750,   5633,
-    5754,   6037,   6863,   7971,
-    8516,   8925,   9205,   9450,
-    9623,   9787,   9910,  10035,
-   10132,  10257,  10374,  10623,
-   10837,  10879,  10848,  10752,
-   10597,  10383,  10106,   9771,
-    9347,   8845,   8197,   7372,
-    5968,   4804,   4166,   3646,
-    3346,   3126,   3101,   3180,
-    3639,   4384,   4722,   4874,
-    4935,   4904,   4825,   4652,
-    4432,   4080,   3636,   2708,
-    1819,   1505,   1352,   1470,
-    1749,   2473,   3655,   4327,
-    4750,   5061,   5289,   5451,
-    5558,   5628,   5653,   5639,
-    5600,   5525,   5414,   5279,
-    5116,   4908,   4680,   4419,
-    4109,   3761,   3386,   2927,
-    2413,   1833,   1087,      0,
-   -1087,  -1833,  -2413,  -2927,
-   -3386,  -3761,  -4109,  -4419,
-   -4680,  -4908,  -5116,  -5279,
-   -5414,  -5525,  -5600,  -5639,
-   -5653,  -5628,  -5558,  -5451,
-   -5289,  -5061,  -4750,  -4327,
-   -3655,  -2473,  -1749,  -1470,
-   -1352,  -1505,  -1819,  -2708,
-   -3636,  -4080,  -4432,  -4652,
-   -4825,  -4904,  -4935,  -4874,
-   -4722,  -4384,  -3639,  -3180,
-   -3101,  -3126,  -3346,  -3646,
-   -4166,  -4804,  -5968,  -7372,
-   -8197,  -8845,  -9347,  -9771,
-  -10106, -10383, -10597, -10752,
-  -10848, -10879, -10837, -10623,
-  -10374, -10257, -10132, -10035,
-   -9910,  -9787,  -9623,  -9450,
-   -9205,  -8925,  -8516,  -7971,
-   -6863,  -6037,  -5754,  -5633,
-   -5750,  -5995,  -6456,  -7077,
-   -8103,  -9479, -10480, -11376,
-  -12221, -13082, -13951, -14885,
-  -15861, -16985, -18220, -19974,
-  -21753, -23041, -24260, -25404,
-  -26594, -28003, -29786, -30884,
-  -31663, -32179, -32549, -32713,
-  -32766, -32647, -32426, -32034,
-  -31558, -30908, -30161, -29244,
-  -28231, -27010, -25693, -24152,
-  -22472, -20517, -18417, -15911,
-  -13176,  -9842,  -5974,      0,
-       0,   6764,  11016,  14691,
-   17644,  20303,  22514,  24540,
-   26217,  27750,  29003,  30114,
-   30991,  31728,  32240,  32618,
-   32766,  32757,  32512,  32044,
-   31290,  30031,  28207,  26846,
-   25454,  23951,  21905,  20301,
-   18952,  17731,  16474,  15238,
-   13589,  12032,  10984,  10113,
-    9413,   8838,   8372,   8023,
-    7766,   7635,   7625,   7864,
-    8041,   8188,   8343,   8567,
-    8825,   9217,   9690,  10599,
-   11698,  12242,  12600,  12796,
-   12892,  12882,  12783,  12597,
-   12306,  11931,  11402,  10744,
-    9634,   8488,   7763,   7097,
-    6542,   5997,   5509,   5007,
-    4537,   4027,   3516,   2913,
-    2214,   1038,    140,   -223,
-    -408,   -320,    -75,    482,
-    1259,   2782,   4949,   6150,
-    6969,   7536,   7937,   8188,
-    8303,   8290,   8117,   7784,
-    6983,   6138,   5780,   5498,
-    5418,   5396,   5736,   6374,
-    6471,   6177,   5562,   4278,
-    3319,   2709,   2195,   1771,
-    1399,   1079,    791,    537,
-     318,    113,    -50,   -203,
-    -325,   -424,   -495,   -551,
-    -545,   -553,   -448,   -343,
-       0,    343,    448,    553,
-     545,    551,    495,    424,
-     325,    203,     50,   -113,
-    -318,   -537,   -791,  -1079,
-   -1399,  -1771,  -2195,  -2709,
-   -3319,  -4278,  -5562,  -6177,
-   -6471,  -6374,  -5736,  -5396,
-   -5418,  -5498,  -5780,  -6138,
-   -6983,  -7784,  -8117,  -8290,
-   -8303,  -8188,  -7937,  -7536,
-   -6969,  -6150,  -4949,  -2782,
-   -1259,   -482,     75,    320,
-     408,    223,   -140,  -1038,
-   -2214,  -2913,  -3516,  -4027,
-   -4537,  -5007,  -5509,  -5997,
-   -6542,  -7097,  -7763,  -8488,
-   -9634, -10744, -11402, -11931,
-  -12306, -12597, -12783, -12882,
-  -12892, -12796, -12600, -12242,
-  -11698, -10599,  -9690,  -9217,
-   -8825,  -8567,  -8343,  -8188,
-   -8041,  -7864,  -7625,  -7635,
-   -7766,  -8023,  -8372,  -8838,
-   -9413, -10113, -10984, -12032,
-  -13589, -15238, -16474, -17731,
-  -18952, -20301, -21905, -23951,
-  -25454, -26846, -28207, -30031,
-  -31290, -32044, -32512, -32757,
-  -32766, -32618, -32240, -31728,
-  -30991, -30114, -29003, -27750,
-  -26217, -24540, -22514, -20303,
-  -17644, -14691, -11016,  -6764,
-       0,      0,   7512,  12118,
-   16099,  19213,  22007,  24278,
-   26318,  27964,  29422,  30542,
-   31498,  32136,  32611,  32766,
-   32736,  32340,  31687,  30373,
-   28538,  27024,  25255,  23128,
-   21513,  19972,  18393,  16387,
-   14851,  13615,  12554,  11532,
-   10589,   9351,   8280,   7791,
-    7608,   7861,   8765,   9326,
-    9633,   9902,  10152,  10439,
-   10862,  11176,  11377,  11544,
-   11691,  11825,  11997,  12188,
-   12675,  13263,  13166,  12743,
-   11574,  10476,   9801,   9149,
-    8589,   7992,   7428,   6766,
-    6081,   5012,   4003,   3415,
-    2975,   2682,   2510,   2448,
-    2547,   2779,   3495,   4376,
-    4572,   4526,   3867,   3390,
-    3301,   3319,   3504,   3789,
-    4278,   4927,   6181,   7974,
-    8783,   9168,   9184,   8926,
-    8165,   6838,   5929,   5150,
-    4366,   3265,   2207,   1681,
-    1285,   1146,   1122,   1492,
-    2201,   2484,   2473,   2267,
-    1531,   1258,   1514,   2445,
-    3143,   3444,   3683,   3795,
-    3878,   3880,   3861,   3779,
-    3672,   3514,   3321,   3083,
-    2797,   2457,   2057,   1557,
-     964,      0,   -964,  -1557,
-   -2057,  -2457,  -2797,  -3083,
-   -3321,  -3514,  -3672,  -3779,
-   -3861,  -3880,  -3878,  -3795,
-   -3683,  -3444,  -3143,  -2445,
-   -1514,  -1258,  -1531,  -2267,
-   -2473,  -2484,  -2201,  -1492,
-   -1122,  -1146,  -1285,  -1681,
-   -2207,  -3265,  -4366,  -5150,
-   -5929,  -6838,  -8165,  -8926,
-   -9184,  -9168,  -8783,  -7974,
-   -6181,  -4927,  -4278,  -3789,
-   -3504,  -3319,  -3301,  -3390,
-   -3867,  -4526,  -4572,  -4376,
-   -3495,  -2779,  -2547,  -2448,
-   -2510,  -2682,  -2975,  -3415,
-   -4003,  -5012,  -6081,  -6766,
-   -7428,  -7992,  -8589,  -9149,
-   -9801, -10476, -11574, -12743,
-  -13166, -13263, -12675, -12188,
-  -11997, -11825, -11691, -11544,
-  -11377, -11176, -10862, -10439,
-  -10152,  -9902,  -9633,  -9326,
-   -8765,  -7861,  -7608,  -7791,
-   -8280,  -9351, -10589, -11532,
-  -12554, -13615, -14851, -16387,
-  -18393, -19972, -21513, -23128,
-  -25255, -27024, -28538, -30373,
-  -31687, -32340, -32736, -32766,
-  -32611, -32136, -31498, -30542,
-  -29422, -27964, -26318, -24278,
-  -22007, -19213, -16099, -12118,
-   -7512,      0,      0,   8218,
-   13153,  17397,  20636,  23536,
-   25810,  27840,  29388,  30728,
-   31648,  32367,  32676,  32766,
-   32384,  31703,  30114,  28284,
-   26411,  24173,  22414,  20478,
-   18329,  16702,  15247,  13796,
-   12053,  10790,   9928,   9288,
-    8866,   8639,   8707,   8932,
-    9126,   9486,  10070,  11200,
-   11892,  12300,  12572,  12783,
-   12927,  13154,  13156,  12996,
-   12620,  12109,  11011,   9949,
-    9477,   9401,   9600,   9221,
-    8659,   7447,   6404,   5797,
-    5312,   4960,   4692,   4515,
-    4429,   4440,   4668,   4948,
-    5052,   5172,   5248,   5376,
-    5487,   5701,   5939,   6585,
-    7282,   7296,   6965,   6002,
-    5029,   4295,   3090,   2042,
-    1655,   1583,   1837,   2718,
-    4218,   4849,   5186,   5222,
-    5104,   4564,   3617,   3119,
-    2923,   2845,   3040,   3277,
-    3437,   3598,   3818,   4082,
-    4598,   5378,   5665,   5632,
-    5319,   4464,   3921,   3812,
-    4148,   4148,   3208,   2206,
-    1663,   1208,    864,    555,
-     312,     90,    -81,   -234,
-    -341,   -429,   -467,   -482,
-    -425,   -322,      0,    322,
-     425,    482,    467,    429,
-     341,    234,     81,    -90,
-    -312,   -555,   -864,  -1208,
-   -1663,  -2206,  -3208,  -4148,
-   -4148,  -3812,  -3921,  -4464,
-   -5319,  -5632,  -5665,  -5378,
-   -4598,  -4082,  -3818,  -3598,
-   -3437,  -3277,  -3040,  -2845,
-   -2923,  -3119,  -3617,  -4564,
-   -5104,  -5222,  -5186,  -4849,
-   -4218,  -2718,  -1837,  -1583,
-   -1655,  -2042,  -3090,  -4295,
-   -5029,  -6002,  -6965,  -7296,
-   -7282,  -6585,  -5939,  -5701,
-   -5487,  -5376,  -5248,  -5172,
-   -5052,  -4948,  -4668,  -4440,
-   -4429,  -4515,  -4692,  -4960,
-   -5312,  -5797,  -6404,  -7447,
-   -8659,  -9221,  -9600,  -9401,
-   -9477,  -9949, -11011, -12109,
-  -12620, -12996, -13156, -13154,
-  -12927, -12783, -12572, -12300,
-  -11892, -11200, -10070,  -9486,
-   -9126,  -8932,  -8707,  -8639,
-   -8866,  -9288,  -9928, -10790,
-  -12053, -13796, -15247, -16702,
-  -18329, -20478, -22414, -24173,
-  -26411, -28284, -30114, -31703,
-  -32384, -32766, -32676, -32367,
-  -31648, -30728, -29388, -27840,
-  -25810, -23536, -20636, -17397,
-  -13153,  -8218,      0,      0,
-    8899,  14141,  18614,  21959,
-   24925,  27174,  29148,  30555,
-   31720,  32366,  32766,  32605,
-   32137,  30743,  28823,  26637,
-   24413,  22313,  19960,  18164,
-   16272,  14271,  12830,  11648,
-   10552,   9316,   8660,   8730,
-    9464,   9876,  10186,  10629,
-   11103,  11457,  11877,  12433,
-   13417,  13911,  14037,  13935,
-   13619,  13008,  11905,  10950,
-   10260,   9479,   8728,   7493,
-    6406,   5927,   5926,   6239,
-    6130,   5919,   5277,   4939,
-    5604,   6254,   6500,   6715,
-    6839,   6985,   7101,   7370,
-    7578,   7571,   7455,   7238,
-    6891,   6419,   5514,   4501,
-    4466,   4624,   4320,   3763,
-    2731,   1747,   1092,     49,
-    -733,   -826,   -466,    313,
-    2097,   4823,   6163,   6993,
-    7385,   7532,   7180,   6369,
-    5894,   5627,   5382,   5304,
-    5146,   4774,   4116,   2988,
-    2356,   2309,   2640,   2643,
-    2426,   2044,   1222,    784,
-     824,   1390,   1729,   1349,
-    1101,   1871,   2478,   2708,
-    2869,   2915,   2926,   2859,
-    2764,   2597,   2401,   2126,
-    1812,   1381,    873,      0,
-    -873,  -1381,  -1812,  -2126,
-   -2401,  -2597,  -2764,  -2859,
-   -2926,  -2915,  -2869,  -2708,
-   -2478,  -1871,  -1101,  -1349,
-   -1729,  -1390,   -824,   -784,
-   -1222,  -2044,  -2426,  -2643,
-   -2640,  -2309,  -2356,  -2988,
-   -4116,  -4774,  -5146,  -5304,
-   -5382,  -5627,  -5894,  -6369,
-   -7180,  -7532,  -7385,  -6993,
-   -6163,  -4823,  -2097,   -313,
-     466,    826,    733,    -49,
-   -1092,  -1747,  -2731,  -3763,
-   -4320,  -4624,  -4466,  -4501,
-   -5514,  -6419,  -6891,  -7238,
-   -7455,  -7571,  -7578,  -7370,
-   -7101,  -6985,  -6839,  -6715,
-   -6500,  -6254,  -5604,  -4939,
-   -5277,  -5919,  -6130,  -6239,
-   -5926,  -5927,  -6406,  -7493,
-   -8728,  -9479, -10260, -10950,
-  -11905, -13008, -13619, -13935,
-  -14037, -13911, -13417, -12433,
-  -11877, -11457, -11103, -10629,
-  -10186,  -9876,  -9464,  -8730,
-   -8660,  -9316, -10552, -11648,
-  -12830, -14271, -16272, -18164,
-  -19960, -22313, -24413, -26637,
-  -28823, -30743, -32137, -32605,
-  -32766, -32366, -31720, -30555,
-  -29148, -27174, -24925, -21959,
-  -18614, -14141,  -8899,      0,
-       0,  10331,  19586,  26824,
-   31342,  32766,  31083,  26634,
-   20058,  12204,   4013,  -3599,
-   -9856, -14210, -16388, -16409,
-  -14548, -11278,  -7181,  -2853,
-    1186,   4556,   7066,   8715,
-    9666,  10197,  10626,  11241,
-   12235,  13656,  15399,  17214,
-   18751,  19625,  19490,  18113,
-   15429,  11577,   6893,   1885,
-   -2837,  -6645,  -8979,  -9444,
-   -7867,  -4339,    784,   6928,
-   13365,  19316,  24054,  27007,
-   27842,  26507,  23247,  18565,
-   13154,   7797,   3256,    164,
-   -1068,   -308,   2279,   6258,
-   10984,  15704,  19663,  22217,
-   22931,  21639,  18474,  13848,
-    8392,   2869,  -1937,  -5335,
-   -6819,  -6148,  -3369,   1180,
-    6931,  13156,  19075,  23962,
-   27241,  28558,  27822,  25205,
-   21103,  16076,  10752,   5742,
-    1552,  -1479,  -3213,  -3715,
-   -3217,  -2066,   -646,    693,
-    1702,   2274,   2460,   2453,
-    2539,   3038,   4228,   6272,
-    9170,  12730,  16574,  20180,
-   22955,  24315,  23789,  21101,
-   16233,   9458,   1325,  -7390,
-  -15772, -22878, -27860, -30077,
-  -29189, -25207, -18508,  -9791,
-       0,   9791,  18508,  25207,
-   29189,  30077,  27860,  22878,
-   15772,   7390,  -1325,  -9458,
-  -16233, -21101, -23789, -24315,
-  -22955, -20180, -16574, -12730,
-   -9170,  -6272,  -4228,  -3038,
-   -2539,  -2453,  -2460,  -2274,
-   -1702,   -693,    646,   2066,
-    3217,   3715,   3213,   1479,
-   -1552,  -5742, -10752, -16076,
-  -21103, -25205, -27822, -28558,
-  -27241, -23962, -19075, -13156,
-   -6931,  -1180,   3369,   6148,
-    6819,   5335,   1937,  -2869,
-   -8392, -13848, -18474, -21639,
-  -22931, -22217, -19663, -15704,
-  -10984,  -6258,  -2279,    308,
-    1068,   -164,  -3256,  -7797,
-  -13154, -18565, -23247, -26507,
-  -27842, -27007, -24054, -19316,
-  -13365,  -6928,   -784,   4339,
-    7867,   9444,   8979,   6645,
-    2837,  -1885,  -6893, -11577,
-  -15429, -18113, -19490, -19625,
-  -18751, -17214, -15399, -13656,
-  -12235, -11241, -10626, -10197,
-   -9666,  -8715,  -7066,  -4556,
-   -1186,   2853,   7181,  11278,
-   14548,  16409,  16388,  14210,
-    9856,   3599,  -4013, -12204,
-  -20058, -26634, -31083, -32766,
-  -31342, -26824, -19586, -10331,
-       0,      0,   9714,  18530,
-   25657,  30508,  32766,  32417,
-   29738,  25259,  19680,  13782,
-    8322,   3941,   1093,      1,
-     648,   2801,   6065,   9953,
-   13969,  17677,  20762,  23063,
-   24578,  25445,  25892,  26187,
-   26569,  27198,  28119,  29243,
-   30365,  31197,  31421,  30750,
-   28995,  26105,  22197,  17557,
-   12609,   7864,   3851,   1037,
-    -243,    158,   2167,   5496,
-    9668,  14083,  18096,  21109,
-   22648,  22441,  20448,  16876,
-   12147,   6842,   1614,  -2899,
-   -6168,  -7850,  -7831,  -6247,
-   -3459,      0,   3503,   6423,
-    8225,   8549,   7255,   4456,
-     491,  -4113,  -8723, -12689,
-  -15436, -16546, -15819, -13297,
-   -9263,  -4192,   1307,   6584,
-   11032,  14168,  15695,  15534,
-   13825,  10896,   7207,   3279,
-    -384,  -3363,  -5380,  -6323,
-   -6248,  -5353,  -3926,  -2292,
-    -742,    512,   1382,   1906,
-    2244,   2632,   3336,   4585,
-    6515,   9124,  12253,  15587,
-   18693,  21076,  22252,  21830,
-   19581,  15491,   9788,   2931,
-   -4433, -11541, -17606, -21921,
-  -23952, -23411, -20308, -14952,
-   -7921,      0,   7921,  14952,
-   20308,  23411,  23952,  21921,
-   17606,  11541,   4433,  -2931,
-   -9788, -15491, -19581, -21830,
-  -22252, -21076, -18693, -15587,
-  -12253,  -9124,  -6515,  -4585,
-   -3336,  -2632,  -2244,  -1906,
-   -1382,   -512,    742,   2292,
-    3926,   5353,   6248,   6323,
-    5380,   3363,    384,  -3279,
-   -7207, -10896, -13825, -15534,
-  -15695, -14168, -11032,  -6584,
-   -1307,   4192,   9263,  13297,
-   15819,  16546,  15436,  12689,
-    8723,   4113,   -491,  -4456,
-   -7255,  -8549,  -8225,  -6423,
-   -3503,      0,   3459,   6247,
-    7831,   7850,   6168,   2899,
-   -1614,  -6842, -12147, -16876,
-  -20448, -22441, -22648, -21109,
-  -18096, -14083,  -9668,  -5496,
-   -2167,   -158,    243,  -1037,
-   -3851,  -7864, -12609, -17557,
-  -22197, -26105, -28995, -30750,
-  -31421, -31197, -30365, -29243,
-  -28119, -27198, -26569, -26187,
-  -25892, -25445, -24578, -23063,
-  -20762, -17677, -13969,  -9953,
-   -6065,  -2801,   -648,     -1,
-   -1093,  -3941,  -8322, -13782,
-  -19680, -25259, -29738, -32417,
-  -32766, -30508, -25657, -18530,
-   -9714,      0,      0,   4908,
-    9288,  12691,  14814,  15550,
-   14997,  13448,  11342,   9197,
-    7534,   6791,   7263,   9048,
-   12041,  15940,  20300,  24595,
-   28298,  30963,  32294,  32183,
-   30735,  28244,  25156,  21992,
-   19276,  17454,  16822,  17486,
-   19343,  22098,  25310,  28457,
-   31018,  32552,  32766,  31559,
-   29037,  25502,  21401,  17261,
-   13609,  10894,   9417,   9284,
-   10398,  12464,  15044,  17618,
-   19666,  20750,  20575,  19043,
-   16260,  12527,   8291,   4079,
-     418,  -2247,  -3616,  -3583,
-   -2248,     92,   2995,   5940,
-    8405,   9945,  10265,   9262,
-    7039,   3893,    268,  -3315,
-   -6332,  -8341,  -9046,  -8345,
-   -6344,  -3341,    217,   3806,
-    6898,   9047,   9955,   9514,
-    7826,   5184,   2030,  -1117,
-   -3736,  -5385,  -5771,  -4792,
-   -2557,    637,   4342,   8034,
-   11185,  13350,  14230,  13719,
-   11920,   9127,   5784,   2412,
-    -465,  -2405,  -3112,  -2482,
-    -619,   2181,   5474,   8737,
-   11447,  13162,  13586,  12616,
-   10358,   7110,   3318,   -493,
-   -3797,  -6149,  -7248,  -6990,
-   -5475,  -2998,      0,   2998,
-    5475,   6990,   7248,   6149,
-    3797,    493,  -3318,  -7110,
-  -10358, -12616, -13586, -13162,
-  -11447,  -8737,  -5474,  -2181,
-     619,   2482,   3112,   2405,
-     465,  -2412,  -5784,  -9127,
-  -11920, -13719, -14230, -13350,
-  -11185,  -8034,  -4342,   -637,
-    2557,   4792,   5771,   5385,
-    3736,   1117,  -2030,  -5184,
-   -7826,  -9514,  -9955,  -9047,
-   -6898,  -3806,   -217,   3341,
-    6344,   8345,   9046,   8341,
-    6332,   3315,   -268,  -3893,
-   -7039,  -9262, -10265,  -9945,
-   -8405,  -5940,  -2995,    -92,
-    2248,   3583,   3616,   2247,
-    -418,  -4079,  -8291, -12527,
-  -16260, -19043, -20575, -20750,
-  -19666, -17618, -15044, -12464,
-  -10398,  -9284,  -9417, -10894,
-  -13609, -17261, -21401, -25502,
-  -29037, -31559, -32766, -32552,
-  -31018, -28457, -25310, -22098,
-  -19343, -17486, -16822, -17454,
-  -19276, -21992, -25156, -28244,
-  -30735, -32183, -32294, -30963,
-  -28298, -24595, -20300, -15940,
-  -12041,  -9048,  -7263,  -6791,
-   -7534,  -9197, -11342, -13448,
-  -14997, -15550, -14814, -12691,
-   -9288,  -4908,      0,      0,
-    3172,   6311,   9384,  12359,
-   15208,  17901,  20416,  22729,
-   24823,  26682,  28297,  29661,
-   30771,  31629,  32241,  32616,
-   32766,  32708,  32460,  32042,
-   31479,  30793,  30009,  29152,
-   28247,  27317,  26383,  25467,
-   24586,  23755,  22988,  22292,
-   21675,  21140,  20684,  20306,
-   19997,  19749,  19548,  19381,
-   19231,  19082,  18915,  18712,
-   18454,  18124,  17707,  17187,
-   16552,  15792,  14901,  13875,
-   12712,  11416,   9993,   8453,
-    6808,   5074,   3272,   1421,
-    -455,  -2331,  -4180,  -5975,
-   -7690,  -9299, -10775, -12095,
-  -13236, -14181, -14911, -15415,
-  -15682, -15708, -15490, -15032,
-  -14339, -13423, -12297, -10981,
-   -9494,  -7862,  -6111,  -4270,
-   -2367,   -435,   1497,   3397,
-    5236,   6985,   8619,  10113,
-   11446,  12602,  13565,  14325,
-   14877,  15217,  15348,  15274,
-   15005,  14553,  13935,  13169,
-   12275,  11276,  10197,   9061,
-    7894,   6721,   5565,   4448,
-    3392,   2414,   1531,    755,
-      95,   -442,   -853,  -1138,
-   -1303,  -1354,  -1300,  -1156,
-    -936,   -657,   -339,      0,
-     339,    657,    936,   1156,
-    1300,   1354,   1303,   1138,
-     853,    442,    -95,   -755,
-   -1531,  -2414,  -3392,  -4448,
-   -5565,  -6721,  -7894,  -9061,
-  -10197, -11276, -12275, -13169,
-  -13935, -14553, -15005, -15274,
-  -15348, -15217, -14877, -14325,
-  -13565, -12602, -11446, -10113,
-   -8619,  -6985,  -5236,  -3397,
-   -1497,    435,   2367,   4270,
-    6111,   7862,   9494,  10981,
-   12297,  13423,  14339,  15032,
-   15490,  15708,  15682,  15415,
-   14911,  14181,  13236,  12095,
-   10775,   9299,   7690,   5975,
-    4180,   2331,    455,  -1421,
-   -3272,  -5074,  -6808,  -8453,
-   -9993, -11416, -12712, -13875,
-  -14901, -15792, -16552, -17187,
-  -17707, -18124, -18454, -18712,
-  -18915, -19082, -19231, -19381,
-  -19548, -19749, -19997, -20306,
-  -20684, -21140, -21675, -22292,
-  -22988, -23755, -24586, -25467,
-  -26383, -27317, -28247, -29152,
-  -30009, -30793, -31479, -32042,
-  -32460, -32708, -32766, -32616,
-  -32241, -31629, -30771, -29661,
-  -28297, -26682, -24823, -22729,
-  -20416, -17901, -15208, -12359,
-   -9384,  -6311,  -3172,      0,
-       0,   3516,   6941,  10189,
-   13179,  15839,  18111,  19950,
-   21325,  22226,  22656,  22636,
-   22203,  21409,  20317,  19001,
-   17540,  16017,  14517,  13120,
-   11901,  10925,  10247,   9907,
-    9930,  10325,  11084,  12184,
-   13586,  15236,  17070,  19015,
-   20992,  22916,  24707,  26285,
-   27578,  28523,  29069,  29180,
-   28835,  28031,  26779,  25109,
-   23066,  20709,  18110,  15347,
-   12509,   9683,   6961,   4429,
-    2165,    240,  -1288,  -2375,
-   -2994,  -3133,  -2800,  -2015,
-    -819,    735,   2583,   4649,
-    6851,   9104,  11322,  13422,
-   15328,  16972,  18298,  19264,
-   19842,  20022,  19810,  19227,
-   18312,  17116,  15700,  14138,
-   12509,  10892,   9371,   8023,
-    6919,   6121,   5681,   5634,
-    5999,   6783,   7971,   9535,
-   11431,  13598,  15968,  18461,
-   20992,  23470,  25809,  27923,
-   29733,  31172,  32182,  32722,
-   32766,  32304,  31345,  29913,
-   28048,  25807,  23256,  20472,
-   17540,  14546,  11579,   8722,
-    6056,   3648,   1558,   -171,
-   -1510,  -2447,  -2986,  -3148,
-   -2969,  -2498,  -1798,   -939,
-       0,    939,   1798,   2498,
-    2969,   3148,   2986,   2447,
-    1510,    171,  -1558,  -3648,
-   -6056,  -8722, -11579, -14546,
-  -17540, -20472, -23256, -25807,
-  -28048, -29913, -31345, -32304,
-  -32766, -32722, -32182, -31172,
-  -29733, -27923, -25809, -23470,
-  -20992, -18461, -15968, -13598,
-  -11431,  -9535,  -7971,  -6783,
-   -5999,  -5634,  -5681,  -6121,
-   -6919,  -8023,  -9371, -10892,
-  -12509, -14138, -15700, -17116,
-  -18312, -19227, -19810, -20022,
-  -19842, -19264, -18298, -16972,
-  -15328, -13422, -11322,  -9104,
-   -6851,  -4649,  -2583,   -735,
-     819,   2015,   2800,   3133,
-    2994,   2375,   1288,   -240,
-   -2165,  -4429,  -6961,  -9683,
-  -12509, -15347, -18110, -20709,
-  -23066, -25109, -26779, -28031,
-  -28835, -29180, -29069, -28523,
-  -27578, -26285, -24707, -22916,
-  -20992, -19015, -17070, -15236,
-  -13586, -12184, -11084, -10325,
-   -9930,  -9907, -10247, -10925,
-  -11901, -13120, -14517, -16017,
-  -17540, -19001, -20317, -21409,
-  -22203, -22636, -22656, -22226,
-  -21325, -19950, -18111, -15839,
-  -13179, -10189,  -6941,  -3516,
-       0,      0,   4500,   8902,
-   13113,  17047,  20628,  23796,
-   26503,  28723,  30444,  31673,
-   32435,  32766,  32718,  32350,
-   31727,  30919,  29993,  29013,
-   28035,  27109,  26272,  25548,
-   24952,  24485,  24136,  23887,
-   23711,  23576,  23447,  23288,
-   23068,  22757,  22332,  21777,
-   21085,  20257,  19302,  18234,
-   17078,  15858,  14604,  13347,
-   12115,  10935,   9830,   8816,
-    7904,   7098,   6398,   5795,
-    5277,   4829,   4431,   4065,
-    3714,   3360,   2993,   2604,
-    2190,   1754,   1303,    850,
-     409,      0,   -359,   -647,
-    -849,   -950,   -939,   -812,
-    -571,   -220,    226,    752,
-    1336,   1955,   2582,   3194,
-    3767,   4283,   4725,   5085,
-    5359,   5550,   5667,   5723,
-    5738,   5731,   5725,   5742,
-    5800,   5913,   6090,   6333,
-    6636,   6984,   7357,   7726,
-    8057,   8312,   8453,   8441,
-    8241,   7825,   7171,   6268,
-    5118,   3733,   2141,    379,
-   -1502,  -3442,  -5374,  -7227,
-   -8927, -10405, -11595, -12440,
-  -12898, -12936, -12542, -11718,
-  -10485,  -8881,  -6959,  -4785,
-   -2437,      0,   2437,   4785,
-    6959,   8881,  10485,  11718,
-   12542,  12936,  12898,  12440,
-   11595,  10405,   8927,   7227,
-    5374,   3442,   1502,   -379,
-   -2141,  -3733,  -5118,  -6268,
-   -7171,  -7825,  -8241,  -8441,
-   -8453,  -8312,  -8057,  -7726,
-   -7357,  -6984,  -6636,  -6333,
-   -6090,  -5913,  -5800,  -5742,
-   -5725,  -5731,  -5738,  -5723,
-   -5667,  -5550,  -5359,  -5085,
-   -4725,  -4283,  -3767,  -3194,
-   -2582,  -1955,  -1336,   -752,
-    -226,    220,    571,    812,
-     939,    950,    849,    647,
-     359,      0,   -409,   -850,
-   -1303,  -1754,  -2190,  -2604,
-   -2993,  -3360,  -3714,  -4065,
-   -4431,  -4829,  -5277,  -5795,
-   -6398,  -7098,  -7904,  -8816,
-   -9830, -10935, -12115, -13347,
-  -14604, -15858, -17078, -18234,
-  -19302, -20257, -21085, -21777,
-  -22332, -22757, -23068, -23288,
-  -23447, -23576, -23711, -23887,
-  -24136, -24485, -24952, -25548,
-  -26272, -27109, -28035, -29013,
-  -29993, -30919, -31727, -32350,
-  -32718, -32766, -32435, -31673,
-  -30444, -28723, -26503, -23796,
-  -20628, -17047, -13113,  -8902,
-   -4500,      0,      0,   7240,
-   14078,  20149,  25169,  28953,
-   31433,  32655,  32766,  31988,
-   30585,  28828,  26965,  25189,
-   23625,  22325,  21275,  20409,
-   19632,  18846,  17973,  16970,
-   15844,  14646,  13466,  12416,
-   11607,  11128,  11030,  11309,
-   11908,  12717,  13593,  14374,
-   14910,  15080,  14817,  14113,
-   13025,  11667,  10190,   8761,
-    7537,   6637,   6125,   6000,
-    6189,   6564,   6960,   7195,
-    7108,   6580,   5559,   4071,
-    2219,    176,  -1840,  -3593,
-   -4864,  -5482,  -5346,  -4447,
-   -2868,   -778,   1592,   3977,
-    6111,   7761,   8759,   9022,
-    8558,   7465,   5915,   4125,
-    2330,    746,   -457,  -1175,
-   -1386,  -1144,   -570,    173,
-     901,   1446,   1677,   1520,
-     971,     91,  -1003,  -2156,
-   -3205,  -3999,  -4428,  -4437,
-   -4035,  -3293,  -2332,  -1305,
-    -375,    314,    650,    574,
-      82,   -775,  -1910,  -3212,
-   -4569,  -5893,  -7129,  -8274,
-   -9368, -10489, -11734, -13197,
-  -14942, -16983, -19267, -21667,
-  -23985, -25975, -27363, -27882,
-  -27308, -25491, -22383, -18051,
-  -12674,  -6537,      0,   6537,
-   12674,  18051,  22383,  25491,
-   27308,  27882,  27363,  25975,
-   23985,  21667,  19267,  16983,
-   14942,  13197,  11734,  10489,
-    9368,   8274,   7129,   5893,
-    4569,   3212,   1910,    775,
-     -82,   -574,   -650,   -314,
-     375,   1305,   2332,   3293,
-    4035,   4437,   4428,   3999,
-    3205,   2156,   1003,    -91,
-    -971,  -1520,  -1677,  -1446,
-    -901,   -173,    570,   1144,
-    1386,   1175,    457,   -746,
-   -2330,  -4125,  -5915,  -7465,
-   -8558,  -9022,  -8759,  -7761,
-   -6111,  -3977,  -1592,    778,
-    2868,   4447,   5346,   5482,
-    4864,   3593,   1840,   -176,
-   -2219,  -4071,  -5559,  -6580,
-   -7108,  -7195,  -6960,  -6564,
-   -6189,  -6000,  -6125,  -6637,
-   -7537,  -8761, -10190, -11667,
-  -13025, -14113, -14817, -15080,
-  -14910, -14374, -13593, -12717,
-  -11908, -11309, -11030, -11128,
-  -11607, -12416, -13466, -14646,
-  -15844, -16970, -17973, -18846,
-  -19632, -20409, -21275, -22325,
-  -23625, -25189, -26965, -28828,
-  -30585, -31988, -32766, -32655,
-  -31433, -28953, -25169, -20149,
-  -14078,  -7240,      0,      0,
-    7802,  15121,  21519,  26647,
-   30272,  32298,  32766,  31840,
-   29787,  26934,  23638,  20241,
-   17043,  14269,  12065,  10488,
-    9522,   9087,   9070,   9340,
-    9774,  10267,  10748,  11174,
-   11529,  11812,  12025,  12166,
-   12219,  12150,  11917,  11473,
-   10782,   9832,   8650,   7303,
-    5907,   4616,   3606,   3062,
-    3145,   3973,   5598,   7994,
-   11049,  14570,  18305,  21961,
-   25239,  27865,  29621,  30368,
-   30062,  28752,  26574,  23728,
-   20453,  16990,  13555,  10311,
-    7351,   4691,   2277,      0,
-   -2277,  -4691,  -7351, -10311,
-  -13555, -16990, -20453, -23728,
-  -26574, -28752, -30062, -30368,
-  -29621, -27865, -25239, -21961,
-  -18305, -14570, -11049,  -7994,
-   -5598,  -3973,  -3145,  -3062,
-   -3606,  -4616,  -5907,  -7303,
-   -8650,  -9832, -10782, -11473,
-  -11917, -12150, -12219, -12166,
-  -12025, -11812, -11529, -11174,
-  -10748, -10267,  -9774,  -9340,
-   -9070,  -9087,  -9522, -10488,
-  -12065, -14269, -17043, -20241,
-  -23638, -26934, -29787, -31840,
-  -32766, -32298, -30272, -26647,
-  -21519, -15121,  -7802,      0,
-    7802,  15121,  21519,  26647,
-   30272,  32298,  32766,  31840,
-   29787,  26934,  23638,  20241,
-   17043,  14269,  12065,  10488,
-    9522,   9087,   9070,   9340,
-    9774,  10267,  10748,  11174,
-   11529,  11812,  12025,  12166,
-   12219,  12150,  11917,  11473,
-   10782,   9832,   8650,   7303,
-    5907,   4616,   3606,   3062,
-    3145,   3973,   5598,   7994,
-   11049,  14570,  18305,  21961,
-   25239,  27865,  29621,  30368,
-   30062,  28752,  26574,  23728,
-   20453,  16990,  13555,  10311,
-    7351,   4691,   2277,      0,
-   -2277,  -4691,  -7351, -10311,
-  -13555, -16990, -20453, -23728,
-  -26574, -28752, -30062, -30368,
-  -29621, -27865, -25239, -21961,
-  -18305, -14570, -11049,  -7994,
-   -5598,  -3973,  -3145,  -3062,
-   -3606,  -4616,  -5907,  -7303,
-   -8650,  -9832, -10782, -11473,
-  -11917, -12150, -12219, -12166,
-  -12025, -11812, -11529, -11174,
-  -10748, -10267,  -9774,  -9340,
-   -9070,  -9087,  -9522, -10488,
-  -12065, -14269, -17043, -20241,
-  -23638, -26934, -29787, -31840,
-  -32766, -32298, -30272, -26647,
-  -21519, -15121,  -7802,      0,
-       0,   7655,  14867,  21224,
-   26374,  30047,  32077,  32409,
-   31101,  28321,  24329,  19459,
-   14093,   8631,   3465,  -1053,
-   -4631,  -7058,  -8216,  -8084,
-   -6736,  -4331,  -1096,   2694,
-    6736,  10732,  14401,  17509,
-   19877,  21399,  22039,  21832,
-   20879,  19328,  17361,  15177,
-   12971,  10915,   9149,   7764,
-    6802,   6250,   6048,   6098,
-    6275,   6440,   6460,   6218,
-    5628,   4646,   3271,   1550,
-    -429,  -2544,  -4647,  -6584,
-   -8204,  -9375, -10000, -10020,
-   -9426,  -8256,  -6597,  -4572,
-   -2333,    -48,   2116,   4006,
-    5496,   6499,   6974,   6928,
-    6414,   5528,   4397,   3165,
-    1984,    995,    313,     22,
-     162,    725,   1659,   2872,
-    4241,   5623,   6874,   7861,
-    8478,   8658,   8382,   7683,
-    6648,   5407,   4128,   3000,
-    2216,   1952,   2352,   3512,
-    5463,   8166,  11510,  15315,
-   19345,  23318,  26933,  29888,
-   31908,  32766,  32305,  30451,
-   27230,  22761,  17259,  11018,
-    4397,  -2209,  -8395, -13772,
-  -18002, -20817, -22044, -21617,
-  -19584, -16105, -11442,  -5939,
-       0,   5939,  11442,  16105,
-   19584,  21617,  22044,  20817,
-   18002,  13772,   8395,   2209,
-   -4397, -11018, -17259, -22761,
-  -27230, -30451, -32305, -32766,
-  -31908, -29888, -26933, -23318,
-  -19345, -15315, -11510,  -8166,
-   -5463,  -3512,  -2352,  -1952,
-   -2216,  -3000,  -4128,  -5407,
-   -6648,  -7683,  -8382,  -8658,
-   -8478,  -7861,  -6874,  -5623,
-   -4241,  -2872,  -1659,   -725,
-    -162,    -22,   -313,   -995,
-   -1984,  -3165,  -4397,  -5528,
-   -6414,  -6928,  -6974,  -6499,
-   -5496,  -4006,  -2116,     48,
-    2333,   4572,   6597,   8256,
-    9426,  10020,  10000,   9375,
-    8204,   6584,   4647,   2544,
-     429,  -1550,  -3271,  -4646,
-   -5628,  -6218,  -6460,  -6440,
-   -6275,  -6098,  -6048,  -6250,
-   -6802,  -7764,  -9149, -10915,
-  -12971, -15177, -17361, -19328,
-  -20879, -21832, -22039, -21399,
-  -19877, -17509, -14401, -10732,
-   -6736,  -2694,   1096,   4331,
-    6736,   8084,   8216,   7058,
-    4631,   1053,  -3465,  -8631,
-  -14093, -19459, -24329, -28321,
-  -31101, -32409, -32077, -30047,
-  -26374, -21224, -14867,  -7655,
-       0,      0,   8611,  16573,
-   23312,  28391,  31557,  32766,
-   32173,  30108,  27023,  23429,
-   19830,  16660,  14234,  12718,
-   12128,  12337,  13117,  14184,
-   15247,  16061,  16459,  16379,
-   15863,  15039,  14097,  13241,
-   12652,  12449,  12666,  13239,
-   14018,  14791,  15318,  15376,
-   14802,  13525,  11585,   9137,
-    6430,   3777,   1507,    -87,
-    -790,   -508,    714,   2694,
-    5132,   7648,   9840,  11336,
-   11855,  11245,   9513,   6825,
-    3487,    -95,  -3471,  -6211,
-   -7965,  -8515,  -7804,  -5947,
-   -3215,      0,   3245,   6065,
-    8069,   8984,   8694,   7255,
-    4882,   1924,  -1191,  -4018,
-   -6153,  -7293,  -7276,  -6099,
-   -3917,  -1016,   2227,   5405,
-    8136,  10114,  11151,  11198,
-   10346,   8801,   6856,   4833,
-    3040,   1723,   1032,   1003,
-    1560,   2538,   3709,   4832,
-    5690,   6131,   6089,   5595,
-    4768,   3786,   2854,   2159,
-    1830,   1910,   2335,   2941,
-    3483,   3673,   3227,   1920,
-    -372,  -3631,  -7688, -12223,
-  -16800, -20910, -24039, -25729,
-  -25647, -23633, -19726, -14174,
-   -7409,      0,   7409,  14174,
-   19726,  23633,  25647,  25729,
-   24039,  20910,  16800,  12223,
-    7688,   3631,    372,  -1920,
-   -3227,  -3673,  -3483,  -2941,
-   -2335,  -1910,  -1830,  -2159,
-   -2854,  -3786,  -4768,  -5595,
-   -6089,  -6131,  -5690,  -4832,
-   -3709,  -2538,  -1560,  -1003,
-   -1032,  -1723,  -3040,  -4833,
-   -6856,  -8801, -10346, -11198,
-  -11151, -10114,  -8136,  -5405,
-   -2227,   1016,   3917,   6099,
-    7276,   7293,   6153,   4018,
-    1191,  -1924,  -4882,  -7255,
-   -8694,  -8984,  -8069,  -6065,
-   -3245,      0,   3215,   5947,
-    7804,   8515,   7965,   6211,
-    3471,     95,  -3487,  -6825,
-   -9513, -11245, -11855, -11336,
-   -9840,  -7648,  -5132,  -2694,
-    -714,    508,    790,     87,
-   -1507,  -3777,  -6430,  -9137,
-  -11585, -13525, -14802, -15376,
-  -15318, -14791, -14018, -13239,
-  -12666, -12449, -12652, -13241,
-  -14097, -15039, -15863, -16379,
-  -16459, -16061, -15247, -14184,
-  -13117, -12337, -12128, -12718,
-  -14234, -16660, -19830, -23429,
-  -27023, -30108, -32173, -32766,
-  -31557, -28391, -23312, -16573,
-   -8611,      0,      0,   6396,
-   12198,  16892,  20113,  21694,
-   21681,  20330,  18060,  15395,
-   12885,  11031,  10216,  10650,
-   12352,  15148,  18707,  22592,
-   26328,  29475,  31688,  32766,
-   32673,  31540,  29629,  27296,
-   24920,  22848,  21337,  20517,
-   20372,  20751,  21395,  21990,
-   22221,  21830,  20667,  18718,
-   16112,  13111,  10061,   7347,
-    5323,   4259,   4286,   5373,
-    7323,   9795,  12352,  14524,
-   15879,  16090,  14990,  12600,
-    9138,   4990,    663,  -3288,
-   -6333,  -8048,  -8173,  -6655,
-   -3657,    462,   5191,   9943,
-   14127,  17234,  18903,  18970,
-   17488,  14713,  11071,   7085,
-    3312,    254,  -1705,  -2351,
-   -1665,    182,   2860,   5932,
-    8926,  11400,  13010,  13554,
-   12997,  11468,   9230,   6636,
-    4064,   1860,    279,   -552,
-    -650,   -169,    630,   1430,
-    1913,   1818,    993,   -581,
-   -2774,  -5332,  -7910, -10125,
-  -11628, -12151, -11567,  -9909,
-   -7378,  -4318,  -1168,   1599,
-    3549,   4352,   3838,   2027,
-    -866,  -4457,  -8241, -11662,
-  -14195, -15415, -15064, -13090,
-   -9656,  -5123,      0,   5123,
-    9656,  13090,  15064,  15415,
-   14195,  11662,   8241,   4457,
-     866,  -2027,  -3838,  -4352,
-   -3549,  -1599,   1168,   4318,
-    7378,   9909,  11567,  12151,
-   11628,  10125,   7910,   5332,
-    2774,    581,   -993,  -1818,
-   -1913,  -1430,   -630,    169,
-     650,    552,   -279,  -1860,
-   -4064,  -6636,  -9230, -11468,
-  -12997, -13554, -13010, -11400,
-   -8926,  -5932,  -2860,   -182,
-    1665,   2351,   1705,   -254,
-   -3312,  -7085, -11071, -14713,
-  -17488, -18970, -18903, -17234,
-  -14127,  -9943,  -5191,   -462,
-    3657,   6655,   8173,   8048,
-    6333,   3288,   -663,  -4990,
-   -9138, -12600, -14990, -16090,
-  -15879, -14524, -12352,  -9795,
-   -7323,  -5373,  -4286,  -4259,
-   -5323,  -7347, -10061, -13111,
-  -16112, -18718, -20667, -21830,
-  -22221, -21990, -21395, -20751,
-  -20372, -20517, -21337, -22848,
-  -24920, -27296, -29629, -31540,
-  -32673, -32766, -31688, -29475,
-  -26328, -22592, -18707, -15148,
-  -12352, -10650, -10216, -11031,
-  -12885, -15395, -18060, -20330,
-  -21681, -21694, -20113, -16892,
-  -12198,  -6396,      0,      0,
-    2433,   4851,   7242,   9591,
-   11885,  14111,  16257,  18310,
-   20260,  22096,  23808,  25388,
-   26829,  28123,  29265,  30250,
-   31076,  31739,  32239,  32576,
-   32751,  32766,  32625,  32333,
-   31894,  31315,  30604,  29768,
-   28817,  27760,  26607,  25368,
-   24055,  22679,  21252,  19784,
-   18288,  16775,  15257,  13745,
-   12248,  10779,   9346,   7959,
-    6627,   5357,   4156,   3031,
-    1988,   1030,    162,   -613,
-   -1293,  -1878,  -2367,  -2761,
-   -3062,  -3271,  -3392,  -3429,
-   -3387,  -3270,  -3084,  -2835,
-   -2529,  -2174,  -1777,  -1345,
-    -885,   -405,     88,    587,
-    1084,   1573,   2048,   2502,
-    2929,   3325,   3684,   4004,
-    4279,   4508,   4688,   4817,
-    4895,   4921,   4896,   4820,
-    4696,   4524,   4309,   4052,
-    3758,   3430,   3073,   2692,
-    2291,   1875,   1450,   1020,
-     590,    167,   -246,   -643,
-   -1021,  -1374,  -1698,  -1992,
-   -2250,  -2471,  -2652,  -2792,
-   -2889,  -2943,  -2954,  -2922,
-   -2849,  -2735,  -2582,  -2394,
-   -2172,  -1920,  -1642,  -1341,
-   -1022,   -689,   -347,      0,
-     347,    689,   1022,   1341,
-    1642,   1920,   2172,   2394,
-    2582,   2735,   2849,   2922,
-    2954,   2943,   2889,   2792,
-    2652,   2471,   2250,   1992,
-    1698,   1374,   1021,    643,
-     246,   -167,   -590,  -1020,
-   -1450,  -1875,  -2291,  -2692,
-   -3073,  -3430,  -3758,  -4052,
-   -4309,  -4524,  -4696,  -4820,
-   -4896,  -4921,  -4895,  -4817,
-   -4688,  -4508,  -4279,  -4004,
-   -3684,  -3325,  -2929,  -2502,
-   -2048,  -1573,  -1084,   -587,
-     -88,    405,    885,   1345,
-    1777,   2174,   2529,   2835,
-    3084,   3270,   3387,   3429,
-    3392,   3271,   3062,   2761,
-    2367,   1878,   1293,    613,
-    -162,  -1030,  -1988,  -3031,
-   -4156,  -5357,  -6627,  -7959,
-   -9346, -10779, -12248, -13745,
-  -15257, -16775, -18288, -19784,
-  -21252, -22679, -24055, -25368,
-  -26607, -27760, -28817, -29768,
-  -30604, -31315, -31894, -32333,
-  -32625, -32766, -32751, -32576,
-  -32239, -31739, -31076, -30250,
-  -29265, -28123, -26829, -25388,
-  -23808, -22096, -20260, -18310,
-  -16257, -14111, -11885,  -9591,
-   -7242,  -4851,  -2433,      0,
-       0,   4355,   8624,  12725,
-   16581,  20122,  23289,  26034,
-   28325,  30141,  31477,  32342,
-   32760,  32766,  32406,  31737,
-   30819,  29719,  28504,  27241,
-   25992,  24813,  23752,  22848,
-   22127,  21604,  21280,  21146,
-   21180,  21350,  21615,  21925,
-   22230,  22473,  22600,  22559,
-   22302,  21791,  20996,  19896,
-   18486,  16771,  14769,  12512,
-   10043,   7413,   4687,   1931,
-    -783,  -3380,  -5788,  -7938,
-   -9768, -11225, -12265, -12859,
-  -12991, -12657, -11871, -10658,
-   -9061,  -7130,  -4928,  -2526,
-       0,   2570,   5105,   7527,
-    9765,  11754,  13439,  14778,
-   15740,  16310,  16484,  16275,
-   15708,  14820,  13659,  12282,
-   10750,   9129,   7486,   5888,
-    4394,   3059,   1930,   1042,
-     419,     72,      0,    190,
-     615,   1239,   2016,   2893,
-    3814,   4718,   5545,   6237,
-    6744,   7020,   7030,   6749,
-    6166,   5282,   4109,   2674,
-    1016,   -816,  -2767,  -4770,
-   -6757,  -8660, -10407, -11933,
-  -13179, -14093, -14635, -14776,
-  -14501, -13809, -12713, -11240,
-   -9430,  -7336,  -5019,  -2548,
-       0,   2548,   5019,   7336,
-    9430,  11240,  12713,  13809,
-   14501,  14776,  14635,  14093,
-   13179,  11933,  10407,   8660,
-    6757,   4770,   2767,    816,
-   -1016,  -2674,  -4109,  -5282,
-   -6166,  -6749,  -7030,  -7020,
-   -6744,  -6237,  -5545,  -4718,
-   -3814,  -2893,  -2016,  -1239,
-    -615,   -190,      0,    -72,
-    -419,  -1042,  -1930,  -3059,
-   -4394,  -5888,  -7486,  -9129,
-  -10750, -12282, -13659, -14820,
-  -15708, -16275, -16484, -16310,
-  -15740, -14778, -13439, -11754,
-   -9765,  -7527,  -5105,  -2570,
-       0,   2526,   4928,   7130,
-    9061,  10658,  11871,  12657,
-   12991,  12859,  12265,  11225,
-    9768,   7938,   5788,   3380,
-     783,  -1931,  -4687,  -7413,
-  -10043, -12512, -14769, -16771,
-  -18486, -19896, -20996, -21791,
-  -22302, -22559, -22600, -22473,
-  -22230, -21925, -21615, -21350,
-  -21180, -21146, -21280, -21604,
-  -22127, -22848, -23752, -24813,
-  -25992, -27241, -28504, -29719,
-  -30819, -31737, -32406, -32766,
-  -32760, -32342, -31477, -30141,
-  -28325, -26034, -23289, -20122,
-  -16581, -12725,  -8624,  -4355,
-       0,      0,   8045,  15543,
-   22013,  27090,  30567,  32412,
-   32766,  31914,  30241,  28179,
-   26148,  24500,  23478,  23193,
-   23621,  24614,  25936,  27303,
-   28435,  29095,  29128,  28478,
-   27193,  25410,  23332,  21186,
-   19189,  17509,  16245,  15409,
-   14933,  14683,  14489,  14181,
-   13616,  12717,  11479,   9983,
-    8376,   6849,   5604,   4812,
-    4584,   4937,   5787,   6951,
-    8167,   9131,   9540,   9142,
-    7778,   5415,   2162,  -1735,
-   -5915,  -9948, -13384, -15816,
-  -16931, -16561, -14703, -11528,
-   -7363,  -2652,   2098,   6383,
-    9756,  11890,  12613,  11924,
-    9991,   7122,   3721,    234,
-   -2910,  -5358,  -6868,  -7334,
-   -6796,  -5419,  -3460,  -1227,
-     969,   2860,   4257,   5069,
-    5308,   5078,   4543,   3900,
-    3334,   2987,   2932,   3161,
-    3590,   4073,   4434,   4499,
-    4131,   3258,   1889,    119,
-   -1884,  -3907,  -5721,  -7128,
-   -7988,  -8255,  -7984,  -7329,
-   -6524,  -5850,  -5587,  -5968,
-   -7138,  -9117, -11792, -14914,
-  -18125, -21002, -23108, -24051,
-  -23540, -21430, -17746, -12687,
-   -6613,      0,   6613,  12687,
-   17746,  21430,  23540,  24051,
-   23108,  21002,  18125,  14914,
-   11792,   9117,   7138,   5968,
-    5587,   5850,   6524,   7329,
-    7984,   8255,   7988,   7128,
-    5721,   3907,   1884,   -119,
-   -1889,  -3258,  -4131,  -4499,
-   -4434,  -4073,  -3590,  -3161,
-   -2932,  -2987,  -3334,  -3900,
-   -4543,  -5078,  -5308,  -5069,
-   -4257,  -2860,   -969,   1227,
-    3460,   5419,   6796,   7334,
-    6868,   5358,   2910,   -234,
-   -3721,  -7122,  -9991, -11924,
-  -12613, -11890,  -9756,  -6383,
-   -2098,   2652,   7363,  11528,
-   14703,  16561,  16931,  15816,
-   13384,   9948,   5915,   1735,
-   -2162,  -5415,  -7778,  -9142,
-   -9540,  -9131,  -8167,  -6951,
-   -5787,  -4937,  -4584,  -4812,
-   -5604,  -6849,  -8376,  -9983,
-  -11479, -12717, -13616, -14181,
-  -14489, -14683, -14933, -15409,
-  -16245, -17509, -19189, -21186,
-  -23332, -25410, -27193, -28478,
-  -29128, -29095, -28435, -27303,
-  -25936, -24614, -23621, -23193,
-  -23478, -24500, -26148, -28179,
-  -30241, -31914, -32766, -32412,
-  -30567, -27090, -22013, -15543,
-   -8045,      0,      0,   5633,
-   11090,  16204,  20820,  24805,
-   28054,  30487,  32061,  32766,
-   32624,  31689,  30042,  27790,
-   25054,  21969,  18675,  15310,
-   12003,   8873,   6019,   3519,
-    1429,   -221,  -1424,  -2195,
-   -2571,  -2603,  -2355,  -1898,
-   -1306,   -651,      0,    590,
-    1075,   1422,   1617,   1655,
-    1549,   1321,   1003,    631,
-     245,   -115,   -414,   -623,
-    -721,   -697,   -550,   -289,
-      67,    492,    952,   1413,
-    1837,   2192,   2446,   2578,
-    2571,   2422,   2134,   1722,
-    1208,    623,      0,   -623,
-   -1208,  -1722,  -2134,  -2422,
-   -2571,  -2578,  -2446,  -2192,
-   -1837,  -1413,   -952,   -492,
-     -67,    289,    550,    697,
-     721,    623,    414,    115,
-    -245,   -631,  -1003,  -1321,
-   -1549,  -1655,  -1617,  -1422,
-   -1075,   -590,      0,    651,
-    1306,   1898,   2355,   2603,
-    2571,   2195,   1424,    221,
-   -1429,  -3519,  -6019,  -8873,
-  -12003, -15310, -18675, -21969,
-  -25054, -27790, -30042, -31689,
-  -32624, -32766, -32061, -30487,
-  -28054, -24805, -20820, -16204,
-  -11090,  -5633,      0,   5633,
-   11090,  16204,  20820,  24805,
-   28054,  30487,  32061,  32766,
-   32624,  31689,  30042,  27790,
-   25054,  21969,  18675,  15310,
-   12003,   8873,   6019,   3519,
-    1429,   -221,  -1424,  -2195,
-   -2571,  -2603,  -2355,  -1898,
-   -1306,   -651,      0,    590,
-    1075,   1422,   1617,   1655,
-    1549,   1321,   1003,    631,
-     245,   -115,   -414,   -623,
-    -721,   -697,   -550,   -289,
-      67,    492,    952,   1413,
-    1837,   2192,   2446,   2578,
-    2571,   2422,   2134,   1722,
-    1208,    623,      0,   -623,
-   -1208,  -1722,  -2134,  -2422,
-   -2571,  -2578,  -2446,  -2192,
-   -1837,  -1413,   -952,   -492,
-     -67,    289,    550,    697,
-     721,    623,    414,    115,
-    -245,   -631,  -1003,  -1321,
-   -1549,  -1655,  -1617,  -1422,
-   -1075,   -590,      0,    651,
-    1306,   1898,   2355,   2603,
-    2571,   2195,   1424,    221,
-   -1429,  -3519,  -6019,  -8873,
-  -12003, -15310, -18675, -21969,
-  -25054, -27790, -30042, -31689,
-  -32624, -32766, -32061, -30487,
-  -28054, -24805, -20820, -16204,
-  -11090,  -5633,      0,      0,
-    6202,  12174,  17697,  22572,
-   26628,  29733,  31794,  32766,
-   32649,  31491,  29381,  26444,
-   22839,  18745,  14355,   9865,
-    5465,   1333,  -2378,  -5543,
-   -8069,  -9900, -11017, -11436,
-  -11208, -10410,  -9142,  -7522,
-   -5675,  -3727,  -1799,      0,
-    1578,   2864,   3812,   4399,
-    4629,   4525,   4131,   3506,
-    2720,   1846,    958,    124,
-    -596,  -1157,  -1527,  -1693,
-   -1656,  -1436,  -1063,   -578,
-     -32,    526,   1045,   1479,
-    1791,   1956,   1961,   1804,
-    1500,   1074,    560,      0,
-    -560,  -1074,  -1500,  -1804,
-   -1961,  -1956,  -1791,  -1479,
-   -1045,   -526,     32,    578,
-    1063,   1436,   1656,   1693,
-    1527,   1157,    596,   -124,
-    -958,  -1846,  -2720,  -3506,
-   -4131,  -4525,  -4629,  -4399,
-   -3812,  -2864,  -1578,      0,
-    1799,   3727,   5675,   7522,
-    9142,  10410,  11208,  11436,
-   11017,   9900,   8069,   5543,
-    2378,  -1333,  -5465,  -9865,
-  -14355, -18745, -22839, -26444,
-  -29381, -31491, -32649, -32766,
-  -31794, -29733, -26628, -22572,
-  -17697, -12174,  -6202,      0,
-    6202,  12174,  17697,  22572,
-   26628,  29733,  31794,  32766,
-   32649,  31491,  29381,  26444,
-   22839,  18745,  14355,   9865,
-    5465,   1333,  -2378,  -5543,
-   -8069,  -9900, -11017, -11436,
-  -11208, -10410,  -9142,  -7522,
-   -5675,  -3727,  -1799,      0,
-    1578,   2864,   3812,   4399,
-    4629,   4525,   4131,   3506,
-    2720,   1846,    958,    124,
-    -596,  -1157,  -1527,  -1693,
-   -1656,  -1436,  -1063,   -578,
-     -32,    526,   1045,   1479,
-    1791,   1956,   1961,   1804,
-    1500,   1074,    560,      0,
-    -560,  -1074,  -1500,  -1804,
-   -1961,  -1956,  -1791,  -1479,
-   -1045,   -526,     32,    578,
-    1063,   1436,   1656,   1693,
-    1527,   1157,    596,   -124,
-    -958,  -1846,  -2720,  -3506,
-   -4131,  -4525,  -4629,  -4399,
-   -3812,  -2864,  -1578,      0,
-    1799,   3727,   5675,   7522,
-    9142,  10410,  11208,  11436,
-   11017,   9900,   8069,   5543,
-    2378,  -1333,  -5465,  -9865,
-  -14355, -18745, -22839, -26444,
-  -29381, -31491, -32649, -32766,
-  -31794, -29733, -26628, -22572,
-  -17697, -12174,  -6202,      0,
-       0,   2403,   4113,   5679,
-    7038,   8329,   9496,  10620,
-   11654,  12656,  13588,  14494,
-   15343,  16170,  16948,  17708,
-   18425,  19126,  19789,  20437,
-   21052,  21653,  22223,  22781,
-   23311,  23829,  24320,  24801,
-   25257,  25704,  26127,  26540,
-   26931,  27314,  27675,  28028,
-   28361,  28686,  28991,  29288,
-   29567,  29838,  30092,  30337,
-   30566,  30787,  30991,  31188,
-   31369,  31542,  31699,  31850,
-   31984,  32112,  32224,  32330,
-   32420,  32504,  32572,  32633,
-   32680,  32720,  32744,  32763,
-   32766,  32763,  32744,  32720,
-   32680,  32633,  32572,  32504,
-   32420,  32330,  32224,  32112,
-   31984,  31850,  31699,  31542,
-   31369,  31188,  30991,  30787,
-   30566,  30337,  30092,  29838,
-   29567,  29288,  28991,  28686,
-   28361,  28028,  27675,  27314,
-   26931,  26540,  26127,  25704,
-   25257,  24801,  24320,  23829,
-   23311,  22781,  22223,  21653,
-   21052,  20437,  19789,  19126,
-   18425,  17708,  16948,  16170,
-   15343,  14494,  13588,  12656,
-   11654,  10620,   9496,   8329,
-    7038,   5679,   4113,   2403,
-       0,  -2403,  -4113,  -5679,
-   -7038,  -8329,  -9496, -10620,
-  -11654, -12656, -13588, -14494,
-  -15343, -16170, -16948, -17708,
-  -18425, -19126, -19789, -20437,
-  -21052, -21653, -22223, -22781,
-  -23311, -23829, -24320, -24801,
-  -25257, -25704, -26127, -26540,
-  -26931, -27314, -27675, -28028,
-  -28361, -28686, -28991, -29288,
-  -29567, -29838, -30092, -30337,
-  -30566, -30787, -30991, -31188,
-  -31369, -31542, -31699, -31850,
-  -31984, -32112, -32224, -32330,
-  -32420, -32504, -32572, -32633,
-  -32680, -32720, -32744, -32763,
-  -32766, -32763, -32744, -32720,
-  -32680, -32633, -32572, -32504,
-  -32420, -32330, -32224, -32112,
-  -31984, -31850, -31699, -31542,
-  -31369, -31188, -30991, -30787,
-  -30566, -30337, -30092, -29838,
-  -29567, -29288, -28991, -28686,
-  -28361, -28028, -27675, -27314,
-  -26931, -26540, -26127, -25704,
-  -25257, -24801, -24320, -23829,
-  -23311, -22781, -22223, -21653,
-  -21052, -20437, -19789, -19126,
-  -18425, -17708, -16948, -16170,
-  -15343, -14494, -13588, -12656,
-  -11654, -10620,  -9496,  -8329,
-   -7038,  -5679,  -4113,  -2403,
-       0,      0,  19700,  16277,
-   19290,  18389,  19906,  19744,
-   20566,  20784,  21180,  21626,
-   21743,  22318,  22256,  22889,
-   22727,  23357,  23157,  23737,
-   23549,  24042,  23902,  24285,
-   24215,  24474,  24485,  24621,
-   24709,  24732,  24887,  24815,
-   25016,  24874,  25098,  24912,
-   25132,  24930,  25122,  24929,
-   25071,  24907,  24984,  24861,
-   24863,  24788,  24716,  24686,
-   24544,  24553,  24353,  24385,
-   24144,  24183,  23919,  23946,
-   23679,  23675,  23421,  23373,
-   23145,  23041,  22848,  22684,
-   22527,  22303,  22179,  21902,
-   21802,  21483,  21393,  21047,
-   20953,  20595,  20480,  20125,
-   19975,  19637,  19440,  19128,
-   18876,  18595,  18285,  18035,
-   17671,  17444,  17034,  16821,
-   16376,  16162,  15696,  15466,
-   14995,  14733,  14270,  13963,
-   13518,  13155,  12737,  12311,
-   11920,  11432,  11064,  10518,
-   10165,   9570,   9216,   8585,
-    8214,   7562,   7155,   6495,
-    6034,   5379,   4847,   4204,
-    3590,   2960,   2254,   1630,
-     829,    197,   -701,  -1369,
-   -2366,  -3113,  -4223,  -5128,
-   -6421,  -7821,  -9469, -10522,
-  -11649, -12564, -13472, -14348,
-  -15092, -15963, -16571, -17448,
-  -17945, -18824, -19240, -20104,
-  -20470, -21297, -21649, -22410,
-  -22785, -23450, -23882, -24424,
-  -24943, -25340, -25969, -26206,
-  -26955, -27030, -27900, -27823,
-  -28797, -28594, -29640, -29355,
-  -30421, -30119, -31125, -30908,
-  -31723, -31779, -32112, -32766,
-   -7692,    340,  -3184,  -1301,
-   -3296,  -2190,  -3633,  -2936,
-   -4008,  -3617,  -4387,  -4248,
-   -4762,  -4834,  -5132,  -5374,
-   -5500,  -5867,  -5866,  -6314,
-   -6231,  -6714,  -6592,  -7069,
-   -6948,  -7384,  -7295,  -7662,
-   -7627,  -7908,  -7940,  -8126,
-   -8228,  -8321,  -8487,  -8498,
-   -8713,  -8658,  -8902,  -8803,
-   -9053,  -8933,  -9166,  -9046,
-   -9241,  -9140,  -9280,  -9211,
-   -9285,  -9255,  -9257,  -9267,
-   -9200,  -9243,  -9114,  -9178,
-   -9000,  -9069,  -8858,  -8914,
-   -8686,  -8709,  -8479,  -8453,
-   -8233,  -8145,  -7943,  -7783,
-   -7600,  -7364,  -7195,  -6885,
-   -6719,  -6339,  -6160,  -5715,
-   -5502,  -5000,  -4726,  -4166,
-   -3799,  -3169,  -2665,  -1917,
-   -1175,      0,      0,  27884,
-   22731,  27270,  25411,  28096,
-   27037,  28963,  28242,  29739,
-   29195,  30409,  29969,  30978,
-   30603,  31455,  31121,  31847,
-   31540,  32162,  31873,  32405,
-   32128,  32583,  32314,  32700,
-   32435,  32760,  32496,  32766,
-   32502,  32721,  32455,  32627,
-   32359,  32487,  32216,  32303,
-   32028,  32076,  31796,  31807,
-   31523,  31498,  31209,  31151,
-   30856,  30765,  30465,  30342,
-   30036,  29883,  29571,  29388,
-   29070,  28858,  28533,  28292,
-   27962,  27692,  27355,  27057,
-   26714,  26388,  26039,  25685,
-   25330,  24948,  24586,  24176,
-   23808,  23369,  22995,  22528,
-   22148,  21651,  21265,  20739,
-   20347,  19791,  19393,  18805,
-   18401,  17782,  17372,  16720,
-   16305,  15618,  15198,  14475,
-   14051,  13290,  12861,  12061,
-   11628,  10785,  10349,   9462,
-    9023,   8087,   7648,   6659,
-    6220,   5173,   4736,   3625,
-    3193,   2010,   1587,    322,
-     -87,  -1448,  -1836,  -3310,
-   -3665,  -5278,  -5583,  -7373,
-   -7599,  -9624,  -9719, -12084,
-  -11943, -14858, -14226, -18243,
-  -16194, -24065,      0,  24065,
-   16194,  18243,  14226,  14858,
-   11943,  12084,   9719,   9624,
-    7599,   7373,   5583,   5278,
-    3665,   3310,   1836,   1448,
-      87,   -322,  -1587,  -2010,
-   -3193,  -3625,  -4736,  -5173,
-   -6220,  -6659,  -7648,  -8087,
-   -9023,  -9462, -10349, -10785,
-  -11628, -12061, -12861, -13290,
-  -14051, -14475, -15198, -15618,
-  -16305, -16720, -17372, -17782,
-  -18401, -18805, -19393, -19791,
-  -20347, -20739, -21265, -21651,
-  -22148, -22528, -22995, -23369,
-  -23808, -24176, -24586, -24948,
-  -25330, -25685, -26039, -26388,
-  -26714, -27057, -27355, -27692,
-  -27962, -28292, -28533, -28858,
-  -29070, -29388, -29571, -29883,
-  -30036, -30342, -30465, -30765,
-  -30856, -31151, -31209, -31498,
-  -31523, -31807, -31796, -32076,
-  -32028, -32303, -32216, -32487,
-  -32359, -32627, -32455, -32721,
-  -32502, -32766, -32496, -32760,
-  -32435, -32700, -32314, -32583,
-  -32128, -32405, -31873, -32162,
-  -31540, -31847, -31121, -31455,
-  -30603, -30978, -29969, -30409,
-  -29195, -29739, -28242, -28963,
-  -27037, -28096, -25411, -27270,
-  -22731, -27884,      0,      0,
-   19352,  15628,  18682,  17254,
-   19017,  18143,  19381,  18739,
-   19682,  19159,  19908,  19453,
-   20065,  19650,  20156,  19765,
-   20188,  19812,  20167,  19799,
-   20096,  19731,  19979,  19614,
-   19820,  19453,  19621,  19249,
-   19384,  19007,  19111,  18728,
-   18805,  18414,  18467,  18067,
-   18098,  17689,  17699,  17280,
-   17271,  16842,  16815,  16376,
-   16333,  15881,  15824,  15360,
-   15290,  14813,  14730,  14240,
-   14145,  13641,  13537,  13017,
-   12904,  12367,  12248,  11693,
-   11569,  10994,  10867,  10270,
-   10142,   9520,   9395,   8744,
-    8626,   7942,   7837,   7111,
-    7028,   6250,   6203,   5354,
-    5366,   4413,   4532,   3406,
-    3740,   2250,   3182,    336,
-    7210,  32766,  30949,  31458,
-   30177,  30240,  29223,  29080,
-   28187,  27923,  27096,  26749,
-   25961,  25551,  24783,  24322,
-   23565,  23059,  22305,  21758,
-   21001,  20416,  19651,  19029,
-   18252,  17592,  16798,  16099,
-   15285,  14544,  13704,  12918,
-   12047,  11210,  10299,   9403,
-    8442,   7471,   6443,   5373,
-    4244,   3016,   1698,      0,
-   -1698,  -3016,  -4244,  -5373,
-   -6443,  -7471,  -8442,  -9403,
-  -10299, -11210, -12047, -12918,
-  -13704, -14544, -15285, -16099,
-  -16798, -17592, -18252, -19029,
-  -19651, -20416, -21001, -21758,
-  -22305, -23059, -23565, -24322,
-  -24783, -25551, -25961, -26749,
-  -27096, -27923, -28187, -29080,
-  -29223, -30240, -30177, -31458,
-  -30949, -32766,  -7210,   -336,
-   -3182,  -2250,  -3740,  -3406,
-   -4532,  -4413,  -5366,  -5354,
-   -6203,  -6250,  -7028,  -7111,
-   -7837,  -7942,  -8626,  -8744,
-   -9395,  -9520, -10142, -10270,
-  -10867, -10994, -11569, -11693,
-  -12248, -12367, -12904, -13017,
-  -13537, -13641, -14145, -14240,
-  -14730, -14813, -15290, -15360,
-  -15824, -15881, -16333, -16376,
-  -16815, -16842, -17271, -17280,
-  -17699, -17689, -18098, -18067,
-  -18467, -18414, -18805, -18728,
-  -19111, -19007, -19384, -19249,
-  -19621, -19453, -19820, -19614,
-  -19979, -19731, -20096, -19799,
-  -20167, -19812, -20188, -19765,
-  -20156, -19650, -20065, -19453,
-  -19908, -19159, -19682, -18739,
-  -19381, -18143, -19017, -17254,
-  -18682, -15628, -19352,      0,
-       0,  17463,  13979,  16627,
-   15239,  16705,  15832,  16809,
-   16157,  16855,  16322,  16834,
-   16374,  16749,  16337,  16604,
-   16228,  16406,  16055,  16159,
-   15828,  15867,  15552,  15533,
-   15232,  15159,  14871,  14749,
-   14473,  14305,  14040,  13827,
-   13575,  13318,  13079,  12779,
-   12553,  12211,  12000,  11615,
-   11421,  10990,  10817,  10339,
-   10190,   9660,   9541,   8954,
-    8871,   8220,   8183,   7456,
-    7481,   6658,   6769,   5820,
-    6059,   4927,   5373,   3942,
-    4780,   2728,   4600,    262,
-   16516,  32766,  28410,  30257,
-   28164,  28956,  27463,  27840,
-   26624,  26772,  25716,  25715,
-   24763,  24652,  23773,  23578,
-   22752,  22486,  21701,  21376,
-   20623,  20244,  19518,  19090,
-   18386,  17911,  17226,  16707,
-   16038,  15476,  14821,  14217,
-   13575,  12928,  12298,  11607,
-   10989,  10253,   9646,   8863,
-    8268,   7433,   6851,   5962,
-    5395,   4444,   3894,   2874,
-    2347,   1247,    748,   -448,
-    -907,  -2223,  -2624,  -4097,
-   -4408,  -6103,  -6258,  -8309,
-   -8145, -10902,  -9832, -15041,
-       0,  15041,   9832,  10902,
-    8145,   8309,   6258,   6103,
-    4408,   4097,   2624,   2223,
-     907,    448,   -748,  -1247,
-   -2347,  -2874,  -3894,  -4444,
-   -5395,  -5962,  -6851,  -7433,
-   -8268,  -8863,  -9646, -10253,
-  -10989, -11607, -12298, -12928,
-  -13575, -14217, -14821, -15476,
-  -16038, -16707, -17226, -17911,
-  -18386, -19090, -19518, -20244,
-  -20623, -21376, -21701, -22486,
-  -22752, -23578, -23773, -24652,
-  -24763, -25715, -25716, -26772,
-  -26624, -27840, -27463, -28956,
-  -28164, -30257, -28410, -32766,
-  -16516,   -262,  -4600,  -2728,
-   -4780,  -3942,  -5373,  -4927,
-   -6059,  -5820,  -6769,  -6658,
-   -7481,  -7456,  -8183,  -8220,
-   -8871,  -8954,  -9541,  -9660,
-  -10190, -10339, -10817, -10990,
-  -11421, -11615, -12000, -12211,
-  -12553, -12779, -13079, -13318,
-  -13575, -13827, -14040, -14305,
-  -14473, -14749, -14871, -15159,
-  -15232, -15533, -15552, -15867,
-  -15828, -16159, -16055, -16406,
-  -16228, -16604, -16337, -16749,
-  -16374, -16834, -16322, -16855,
-  -16157, -16809, -15832, -16705,
-  -15239, -16627, -13979, -17463,
-       0,      0,  17611,  14019,
-   16661,  15175,  16636,  15654,
-   16636,  15864,  16579,  15911,
-   16454,  15844,  16264,  15686,
-   16014,  15454,  15711,  15159,
-   15359,  14807,  14961,  14406,
-   14522,  13959,  14044,  13470,
-   13530,  12943,  12982,  12379,
-   12402,  11780,  11793,  11148,
-   11155,  10484,  10491,   9789,
-    9802,   9062,   9090,   8305,
-    8358,   7515,   7609,   6690,
-    6848,   5824,   6086,   4903,
-    5345,   3891,   4690,   2661,
-    4419,    270,  19683,  32766,
-   28594,  30307,  28262,  28986,
-   27496,  27839,  26598,  26738,
-   25634,  25646,  24625,  24549,
-   23581,  23439,  22507,  22314,
-   21404,  21171,  20275,  20009,
-   19119,  18826,  17937,  17621,
-   16730,  16394,  15496,  15144,
-   14235,  13870,  12946,  12571,
-   11629,  11246,  10282,   9895,
-    8903,   8517,   7491,   7112,
-    6044,   5678,   4557,   4216,
-    3026,   2728,   1444,   1219,
-    -205,   -298,  -1952,  -1776,
-   -3899,  -2996,  -6682,  14736,
-   23912,  19961,  20814,  18579,
-   18584,  16767,  16415,  14750,
-   14172,  12542,  11771,  10079,
-    9065,   6999,   5586,   3913,
-    2894,   1428,    525,   -823,
-   -1659,  -2923,  -3710,  -4911,
-   -5659,  -6808,  -7524,  -8632,
-   -9317, -10390, -11048, -12093,
-  -12723, -13745, -14348, -15352,
-  -15927, -16918, -17463, -18445,
-  -18959, -19939, -20416, -21401,
-  -21836, -22836, -23216, -24248,
-  -24556, -25646, -25845, -27046,
-  -27058, -28499, -28104, -30035,
-   -6633,   -578,  -3269,  -2671,
-   -4118,  -4068,  -5182,  -5329,
-   -6285,  -6528,  -7390,  -7686,
-   -8484,  -8813,  -9563,  -9911,
-  -10624, -10984, -11667, -12032,
-  -12689, -13056, -13691, -14057,
-  -14671, -15035, -15631, -15990,
-  -16570, -16922, -17487, -17831,
-  -18382, -18717, -19254, -19579,
-  -20104, -20418, -20931, -21231,
-  -21735, -22020, -22515, -22783,
-  -23271, -23520, -24002, -24228,
-  -24707, -24907, -25388, -25555,
-  -26041, -26174, -26649, -26855,
-  -26298,  -1651,   1620,    371,
-     641,     62,     73,   -334,
-    -397,   -717,   -804,  -1065,
-   -1155,  -1366,  -1448,  -1613,
-   -1677,  -1797,  -1834,  -1905,
-   -1908,  -1923,  -1880,  -1827,
-   -1723,  -1578,  -1381,  -1092,
-    -720,      0,      0,  17927,
-   14201,  16843,  15267,  16704,
-   15642,  16590,  15741,  16418,
-   15675,  16176,  15491,  15869,
-   15215,  15501,  14863,  15077,
-   14446,  14604,  13972,  14085,
-   13447,  13523,  12875,  12923,
-   12260,  12285,  11604,  11614,
-   10911,  10912,  10181,  10179,
-    9416,   9420,   8616,   8637,
-    7781,   7832,   6909,   7012,
-    5994,   6185,   5026,   5372,
-    3972,   4632,   2719,   4231,
-     422,  10993,  32766,  29218,
-   30558,  28718,  29221,  27854,
-   28027,  26874,  26868,  25833,
-   25714,  24750,  24551,  23632,
-   23376,  22486,  22183,  21312,
-   20972,  20112,  19741,  18887,
-   18490,  17636,  17218,  16361,
-   15923,  15060,  14607,  13734,
-   13267,  12381,  11905,  11002,
-   10518,   9595,   9108,   8159,
-    7675,   6691,   6218,   5187,
-    4742,   3642,   3253,   2039,
-    1777,    322,    442,  -1932,
-    2202,  26465,  25641,  25189,
-   23989,  23396,  22285,  21583,
-   20514,  19734,  18680,  17837,
-   16782,  15883,  14813,  13859,
-   12764,  11752,  10620,   9544,
-    8360,   7204,   5941,   4677,
-    3280,   1825,      0,  -1825,
-   -3280,  -4677,  -5941,  -7204,
-   -8360,  -9544, -10620, -11752,
-  -12764, -13859, -14813, -15883,
-  -16782, -17837, -18680, -19734,
-  -20514, -21583, -22285, -23396,
-  -23989, -25189, -25641, -26465,
-   -2202,   1932,   -442,   -322,
-   -1777,  -2039,  -3253,  -3642,
-   -4742,  -5187,  -6218,  -6691,
-   -7675,  -8159,  -9108,  -9595,
-  -10518, -11002, -11905, -12381,
-  -13267, -13734, -14607, -15060,
-  -15923, -16361, -17218, -17636,
-  -18490, -18887, -19741, -20112,
-  -20972, -21312, -22183, -22486,
-  -23376, -23632, -24551, -24750,
-  -25714, -25833, -26868, -26874,
-  -28027, -27854, -29221, -28718,
-  -30558, -29218, -32766, -10993,
-    -422,  -4231,  -2719,  -4632,
-   -3972,  -5372,  -5026,  -6185,
-   -5994,  -7012,  -6909,  -7832,
-   -7781,  -8637,  -8616,  -9420,
-   -9416, -10179, -10181, -10912,
-  -10911, -11614, -11604, -12285,
-  -12260, -12923, -12875, -13523,
-  -13447, -14085, -13972, -14604,
-  -14446, -15077, -14863, -15501,
-  -15215, -15869, -15491, -16176,
-  -15675, -16418, -15741, -16590,
-  -15642, -16704, -15267, -16843,
-  -14201, -17927,      0,      0,
-   17250,  13290,  15491,  13685,
-   14658,  13403,  13851,  12851,
-   12984,  12139,  12047,  11313,
-   11042,  10400,   9975,   9416,
-    8849,   8375,   7666,   7287,
-    6427,   6163,   5127,   5018,
-    3755,   3880,   2273,   2820,
-     547,   2165,  -2459,  13764,
-   29981,  25331,  26913,  24582,
-   25062,  23366,  23392,  22006,
-   21765,  20573,  20144,  19093,
-   18513,  17577,  16865,  16031,
-   15194,  14462,  13499,  12874,
-   11772,  11274,  10007,   9674,
-    8188,   8097,   6276,   6613,
-    4133,   5547,    722,  16745,
-   32766,  27922,  29311,  26790,
-   27079,  25196,  25035,  23464,
-   23038,  21663,  21051,  19818,
-   19056,  17939,  17046,  16031,
-   15014,  14100,  12955,  12149,
-   10865,  10184,   8734,   8216,
-    6545,   6267,   4258,   4406,
-    1735,   2956,  -2063,  13764,
-   29586,  24540,  25725,  22996,
-   23077,  20979,  20601,  18808,
-   18158,  16552,  15706,  14231,
-   13224,  11852,  10700,   9416,
-    8124,   6923,   5485,   4369,
-    2768,   1750,    -48,   -939,
-   -2996,  -3696,  -6145,  -6491,
-   -9686,  -9085, -14794,      0,
-   14794,   9085,   9686,   6491,
-    6145,   3696,   2996,    939,
-      48,  -1750,  -2768,  -4369,
-   -5485,  -6923,  -8124,  -9416,
-  -10700, -11852, -13224, -14231,
-  -15706, -16552, -18158, -18808,
-  -20601, -20979, -23077, -22996,
-  -25725, -24540, -29586, -13764,
-    2063,  -2956,  -1735,  -4406,
-   -4258,  -6267,  -6545,  -8216,
-   -8734, -10184, -10865, -12149,
-  -12955, -14100, -15014, -16031,
-  -17046, -17939, -19056, -19818,
-  -21051, -21663, -23038, -23464,
-  -25035, -25196, -27079, -26790,
-  -29311, -27922, -32766, -16745,
-    -722,  -5547,  -4133,  -6613,
-   -6276,  -8097,  -8188,  -9674,
-  -10007, -11274, -11772, -12874,
-  -13499, -14462, -15194, -16031,
-  -16865, -17577, -18513, -19093,
-  -20144, -20573, -21765, -22006,
-  -23392, -23366, -25062, -24582,
-  -26913, -25331, -29981, -13764,
-    2459,  -2165,   -547,  -2820,
-   -2273,  -3880,  -3755,  -5018,
-   -5127,  -6163,  -6427,  -7287,
-   -7666,  -8375,  -8849,  -9416,
-   -9975, -10400, -11042, -11313,
-  -12047, -12139, -12984, -12851,
-  -13851, -13403, -14658, -13685,
-  -15491, -13290, -17250,      0,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,  32766,
-       0,   1608,   3212,   4808,
-    6392,   7961,   9511,  11039,
-   12539,  14009,  15446,  16845,
-   18204,  19519,  20787,  22004,
-   23169,  24278,  25328,  26318,
-   27244,  28104,  28897,  29620,
-   30272,  30851,  31355,  31784,
-   32136,  32411,  32608,  32727,
-   32766,  32727,  32608,  32411,
-   32136,  31784,  31355,  30851,
-   30272,  29620,  28897,  28104,
-   27244,  26318,  25328,  24278,
-   23169,  22004,  20787,  19519,
-   18204,  16845,  15446,  14009,
-   12539,  11039,   9511,   7961,
-    6392,   4808,   3212,   1608,
-       0,  -1608,  -3212,  -4808,
-   -6392,  -7961,  -9511, -11039,
-  -12539, -14009, -15446, -16845,
-  -18204, -19519, -20787, -22004,
-  -23169, -24278, -25328, -26318,
-  -27244, -28104, -28897, -29620,
-  -30272, -30851, -31355, -31784,
-  -32136, -32411, -32608, -32727,
-  -32766, -32727, -32608, -32411,
-  -32136, -31784, -31355, -30851,
-  -30272, -29620, -28897, -28104,
-  -27244, -26318, -25328, -24278,
-  -23169, -22004, -20787, -19519,
-  -18204, -16845, -15446, -14009,
-  -12539, -11039,  -9511,  -7961,
-   -6392,  -4808,  -3212,  -1608,
-       0,   1608,   3212,   4808,
-    6392,   7961,   9511,  11039,
-   12539,  14009,  15446,  16845,
-   18204,  19519,  20787,  22004,
-   23169,  24278,  25328,  26318,
-   27244,  28104,  28897,  29620,
-   30272,  30851,  31355,  31784,
-   32136,  32411,  32608,  32727,
-   32766,  32727,  32608,  32411,
-   32136,  31784,  31355,  30851,
-   30272,  29620,  28897,  28104,
-   27244,  26318,  25328,  24278,
-   23169,  22004,  20787,  19519,
-   18204,  16845,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,   2009,   4011,
-    5997,   7961,   9896,  11792,
-   13645,  15446,  17189,  18867,
-   20474,  22004,  23452,  24811,
-   26076,  27244,  28309,  29267,
-   30116,  30851,  31469,  31970,
-   32350,  32608,  32744,  32756,
-   32645,  32411,  32056,  31579,
-   30984,  30272,  29446,  28509,
-   27465,  26318,  25071,  23731,
-   22301,  20787,  19194,  17530,
-   15799,  14009,  12167,  10278,
-    8351,   6392,   4410,   2410,
-     402,  -1608,  -3612,  -5602,
-   -7571,  -9511, -11416, -13278,
-  -15090, -16845, -18537, -20159,
-  -21705, -23169, -24546, -25831,
-  -27018, -28104, -29084, -29955,
-  -30713, -31355, -31879, -32284,
-  -32566, -32727, -32764, -32677,
-  -32468, -32136, -31684, -31112,
-  -30423, -29620, -28705, -27682,
-  -26555, -25328, -24006, -22593,
-  -21096, -19519, -17868, -16150,
-  -14372, -12539, -10659,  -8739,
-   -6786,  -4808,  -2811,   -804,
-    1206,   3212,   5205,   7179,
-    9126,  11039,  12910,  14732,
-   16499,  18204,  19840,  21402,
-   22883,  24278,  25582,  26789,
-   27896,  28897,  29790,  30570,
-   31236,  31784,  32212,  32520,
-   32704,  32766,  32704,  32520,
-   32212,  31784,  31236,  30570,
-   29790,  28897,  27896,  26789,
-   25582,  24278,  22883,  21402,
-   19840,  18204,  16499,  14732,
-   12910,  11039,   9126,   7179,
-    5205,   3212,   1206,   -804,
-   -2811,  -4808,  -6786,  -8739,
-  -10659, -12539, -14372,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,   2410,
-    4808,   7179,   9511,  11792,
-   14009,  16150,  18204,  20159,
-   22004,  23731,  25328,  26789,
-   28104,  29267,  30272,  31112,
-   31784,  32284,  32608,  32756,
-   32727,  32520,  32136,  31579,
-   30851,  29955,  28897,  27682,
-   26318,  24811,  23169,  21402,
-   19519,  17530,  15446,  13278,
-   11039,   8739,   6392,   4011,
-    1608,   -804,  -3212,  -5602,
-   -7961, -10278, -12539, -14732,
-  -16845, -18867, -20787, -22593,
-  -24278, -25831, -27244, -28509,
-  -29620, -30570, -31355, -31970,
-  -32411, -32677, -32766, -32677,
-  -32411, -31970, -31355, -30570,
-  -29620, -28509, -27244, -25831,
-  -24278, -22593, -20787, -18867,
-  -16845, -14732, -12539, -10278,
-   -7961,  -5602,  -3212,   -804,
-    1608,   4011,   6392,   8739,
-   11039,  13278,  15446,  17530,
-   19519,  21402,  23169,  24811,
-   26318,  27682,  28897,  29955,
-   30851,  31579,  32136,  32520,
-   32727,  32756,  32608,  32284,
-   31784,  31112,  30272,  29267,
-   28104,  26789,  25328,  23731,
-   22004,  20159,  18204,  16150,
-   14009,  11792,   9511,   7179,
-    4808,   2410,      0,  -2410,
-   -4808,  -7179,  -9511, -11792,
-  -14009, -16150, -18204, -20159,
-  -22004, -23731, -25328, -26789,
-  -28104, -29267, -30272, -31112,
-  -31784, -32284,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,   4011,   7961,  11792,
-   15446,  18867,  22004,  24811,
-   27244,  29267,  30851,  31970,
-   32608,  32756,  32411,  31579,
-   30272,  28509,  26318,  23731,
-   20787,  17530,  14009,  10278,
-    6392,   2410,  -1608,  -5602,
-   -9511, -13278, -16845, -20159,
-  -23169, -25831, -28104, -29955,
-  -31355, -32284, -32727, -32677,
-  -32136, -31112, -29620, -27682,
-  -25328, -22593, -19519, -16150,
-  -12539,  -8739,  -4808,   -804,
-    3212,   7179,  11039,  14732,
-   18204,  21402,  24278,  26789,
-   28897,  30570,  31784,  32520,
-   32766,  32520,  31784,  30570,
-   28897,  26789,  24278,  21402,
-   18204,  14732,  11039,   7179,
-    3212,   -804,  -4808,  -8739,
-  -12539, -16150, -19519, -22593,
-  -25328, -27682, -29620, -31112,
-  -32136, -32677, -32727, -32284,
-  -31355, -29955, -28104, -25831,
-  -23169, -20159, -16845, -13278,
-   -9511,  -5602,  -1608,   2410,
-    6392,  10278,  14009,  17530,
-   20787,  23731,  26318,  28509,
-   30272,  31579,  32411,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-  -27244, -23169, -18204, -12539,
-   -6392,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-  -27244, -23169, -18204, -12539,
-   -6392,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    1089,   2334,   3576,   4814,
-    6044,   7266,   8478,   9678,
-   10863,  12033,  13186,  14320,
-   15432,  16523,  17589,  18630,
-   19644,  20629,  21584,  22508,
-   23399,  24256,  25077,  25863,
-   26610,  27319,  27988,  28616,
-   29203,  29747,  30249,  30706,
-   31119,  31486,  31809,  32085,
-   32315,  32498,  32634,  32724,
-   32766,  32761,  32710,  32611,
-   32466,  32275,  32037,  31754,
-   31426,  31053,  30637,  30177,
-   29675,  29131,  28546,  27921,
-   27258,  26556,  25818,  25045,
-   24236,  23395,  22522,  21618,
-   20684,  19724,  18736,  17724,
-   16688,  15631,  14553,  13456,
-   12342,  11213,  10070,   8914,
-    7748,   6573,   5391,   4203,
-    3011,   1817,    622,   -571,
-   -1763,  -2949,  -4131,  -5304,
-   -6469,  -7623,  -8766,  -9895,
-  -11009, -12106, -13186, -14247,
-  -15288, -16307, -17303, -18276,
-  -19223, -20145, -21039, -21905,
-  -22742, -23550, -24326, -25072,
-  -25785, -26465, -27112, -27726,
-  -28305, -28849, -29359, -29833,
-  -30272, -30675, -31042, -31373,
-  -31669, -31929, -32153, -32342,
-  -32496, -32615, -32699, -32749,
-  -32766, -32750, -32700, -32619,
-  -32507, -32364, -32192, -31990,
-  -31760, -31502, -31218, -30909,
-  -30574, -30217, -29836, -29435,
-  -29013, -28571, -28111, -27634,
-  -27142, -26634, -26113, -25580,
-  -25035, -24481, -23917, -23347,
-  -22769, -22187, -21601, -21012,
-  -20421, -19830, -19240, -18651,
-  -18066, -17485, -16909, -16339,
-  -15777, -15222, -14678, -14143,
-  -13620, -13108, -12610, -12126,
-  -11656, -11201, -10762, -10340,
-   -9936,  -9549,  -9181,  -8833,
-   -8503,  -8194,  -7905,  -7637,
-   -7390,  -7165,  -6961,  -6779,
-   -6619,  -6481,  -6365,  -6271,
-   -6199,  -6150,  -6122,  -6117,
-   -6133,  -6171,  -6230,  -6310,
-   -6411,  -6533,  -6674,  -6835,
-   -7015,  -7214,  -7431,  -7666,
-   -7918,  -8187,  -8472,  -8773,
-   -9088,  -9417,  -9760, -10116,
-  -10485, -10865, -11255, -11656,
-  -12066, -12485, -12912, -13347,
-  -13787, -14234, -14686, -15142,
-  -15602, -16065, -16530, -16997,
-  -17464, -17932, -18399, -18866,
-  -19330, -19793, -20252, -20708,
-  -21160, -21607, -22050, -22486,
-  -22917, -23341, -23758, -24167,
-  -24569, -24963, -25348, -25724,
-  -26092,    737,   2585,   4426,
-    6252,   8059,   9841,  11591,
-   13304,  14975,  16598,  18168,
-   19680,  21130,  22511,  23821,
-   25054,  26207,  27276,  28259,
-   29150,  29949,  30652,  31258,
-   31764,  32168,  32471,  32670,
-   32766,  32758,  32646,  32431,
-   32114,  31696,  31178,  30563,
-   29852,  29048,  28153,  27171,
-   26105,  24958,  23735,  22440,
-   21075,  19647,  18160,  16618,
-   15027,  13392,  11718,  10010,
-    8273,   6514,   4738,   2949,
-    1155,   -641,  -2431,  -4211,
-   -5976,  -7720,  -9438, -11124,
-  -12775, -14385, -15950, -17465,
-  -18927, -20331, -21673, -22950,
-  -24159, -25297, -26361, -27348,
-  -28257, -29086, -29832, -30496,
-  -31075, -31569, -31978, -32301,
-  -32539, -32692, -32762, -32748,
-  -32653, -32477, -32224, -31894,
-  -31491, -31016, -30474, -29865,
-  -29195, -28466, -27682, -26846,
-  -25963, -25036, -24069, -23067,
-  -22033, -20973, -19890, -18789,
-  -17674, -16550, -15420, -14290,
-  -13164, -12045, -10938,  -9848,
-   -8777,  -7730,  -6710,  -5721,
-   -4767,  -3850,  -2974,  -2141,
-   -1355,   -617,     70,    703,
-    1282,   1804,   2269,   2674,
-    3019,   3304,   3527,   3688,
-    3788,   3826,   3804,   3720,
-    3577,   3375,   3116,   2800,
-    2430,   2006,   1532,   1008,
-     438,   -177,   -835,  -1532,
-   -2266,  -3034,  -3834,  -4663,
-   -5518,  -6396,  -7293,  -8208,
-   -9137, -10077, -11025, -11978,
-  -12933, -13888, -14840, -15785,
-  -16723, -17649, -18561, -19458,
-  -20336, -21194, -22030, -22842,
-  -23628, -24387, -25117, -25817,
-  -26486, -27122, -27725, -28294,
-  -28829, -29329, -29794, -30223,
-  -30617, -30977, -31301, -31590,
-  -31846, -32068, -32258, -32416,
-  -32543, -32640, -32709, -32751,
-  -32766, -32757, -32724, -32669,
-  -32594, -32501, -32390, -32263,
-  -32122, -31969, -31805, -31632,
-  -31451, -31264, -31072, -30877,
-  -30680, -30484, -30288, -30094,
-  -29905, -29719, -29540, -29368,
-  -29203, -29047, -28900, -28764,
-  -28638, -28524, -28421, -28331,
-  -28253, -28188, -28135, -28096,
-  -28069, -28055, -28054, -28065,
-  -28088, -28123, -28170, -28227,
-  -28295, -28373, -28460, -28556,
-  -28659, -28771, -28889, -29013,
-  -29142, -29276, -29413, -29554,
-  -29697, -31304,    555,   3005,
-    5439,   7842,  10202,  12505,
-   14737,  16887,  18943,  20891,
-   22723,  24427,  25993,  27413,
-   28680,  29785,  30724,  31490,
-   32080,  32491,  32720,  32766,
-   32630,  32312,  31815,  31142,
-   30296,  29283,  28109,  26781,
-   25306,  23693,  21952,  20092,
-   18124,  16059,  13909,  11686,
-    9402,   7071,   4705,   2316,
-     -81,  -2473,  -4849,  -7195,
-   -9498, -11747, -13930, -16035,
-  -18052, -19971, -21782, -23477,
-  -25048, -26487, -27788, -28945,
-  -29955, -30813, -31517, -32065,
-  -32455, -32689, -32766, -32689,
-  -32461, -32086, -31567, -30910,
-  -30122, -29208, -28177, -27036,
-  -25795, -24462, -23046, -21559,
-  -20009, -18409, -16767, -15096,
-  -13406, -11708, -10013,  -8331,
-   -6673,  -5049,  -3469,  -1943,
-    -478,    915,   2230,   3458,
-    4593,   5628,   6559,   7381,
-    8089,   8679,   9151,   9501,
-    9728,   9833,   9815,   9676,
-    9417,   9041,   8552,   7952,
-    7247,   6441,   5540,   4550,
-    3476,   2327,   1108,   -173,
-   -1508,  -2889,  -4309,  -5759,
-   -7232,  -8720, -10214, -11707,
-  -13192, -14660, -16105, -17520,
-  -18899, -20235, -21522, -22755,
-  -23930, -25042, -26087, -27062,
-  -27964, -28790, -29539, -30210,
-  -30801, -31313, -31745, -32099,
-  -32376, -32577, -32705, -32762,
-  -32751, -32676, -32539, -32345,
-  -32098, -31802, -31461, -31082,
-  -30667, -30223, -29754, -29264,
-  -28760, -28245, -27725, -27203,
-  -26685, -26175, -25677, -25195,
-  -24732, -24292, -23877, -23491,
-  -23136, -22815, -22528, -22278,
-  -22065, -21892, -21757, -21662,
-  -21606, -21589, -21610, -21669,
-  -21764, -21894, -22058, -22253,
-  -22477, -22729, -23006, -23307,
-  -23627, -23966, -24320, -24687,
-  -25064, -25449, -25840, -26233,
-  -26627, -27019, -27407, -27790,
-  -28164, -28530, -28884, -29225,
-  -29553, -29866, -30163, -30444,
-  -30708, -30954, -31183, -31393,
-  -31586, -31762, -31920, -32062,
-  -32188, -32299, -32395, -32477,
-  -32546, -32604, -32651, -32688,
-  -32717, -32738, -32752, -32761,
-  -32765, -32766, -32764, -32759,
-  -32754, -32748, -32742, -32736,
-  -32731, -32727, -32725, -32724,
-  -32725, -32727, -32730, -32735,
-  -32740, -32746, -32752, -32757,
-  -32762, -32765, -32766,    370,
-    4021,   7621,  11128,  14495,
-   17682,  20648,  23356,  25773,
-   27868,  29615,  30993,  31984,
-   32578,  32766,  32548,  31926,
-   30909,  29510,  27749,  25646,
-   23230,  20530,  17582,  14422,
-   11089,   7626,   4075,    480,
-   -3116,  -6667, -10133, -13471,
-  -16641, -19608, -22336, -24795,
-  -26958, -28803, -30309, -31464,
-  -32258, -32685, -32746, -32445,
-  -31792, -30801, -29488, -27877,
-  -25993, -23864, -21522, -19001,
-  -16337, -13568, -10731,  -7866,
-   -5010,  -2203,    519,   3121,
-    5569,   7833,   9883,  11695,
-   13247,  14521,  15502,  16182,
-   16552,  16612,  16362,  15808,
-   14961,  13833,  12440,  10803,
-    8943,   6886,   4658,   2289,
-    -193,  -2756,  -5370,  -8002,
-  -10622, -13201, -15709, -18119,
-  -20406, -22546, -24519, -26307,
-  -27894, -29268, -30420, -31344,
-  -32037, -32498, -32732, -32745,
-  -32545, -32143, -31555, -30795,
-  -29881, -28833, -27672, -26419,
-  -25095, -23724, -22327, -20928,
-  -19546, -18204, -16919, -15710,
-  -14594, -13584, -12694, -11934,
-  -11312, -10835, -10507, -10329,
-  -10301, -10421, -10685, -11086,
-  -11617, -12268, -13028, -13886,
-  -14829, -15843, -16914, -18030,
-  -19174, -20333, -21494, -22643,
-  -23768, -24858, -25901, -26888,
-  -27813, -28666, -29443, -30141,
-  -30755, -31284, -31729, -32090,
-  -32370, -32572, -32700, -32760,
-  -32757, -32698, -32589, -32439,
-  -32254, -32042, -31811, -31567,
-  -31318, -31070, -30829, -30601,
-  -30390, -30201, -30036, -29900,
-  -29792, -29716, -29670, -29656,
-  -29672, -29716, -29788, -29884,
-  -30002, -30138, -30291, -30456,
-  -30629, -30809, -30992, -31173,
-  -31352, -31525, -31690, -31845,
-  -31989, -32120, -32239, -32343,
-  -32434, -32511, -32576, -32629,
-  -32671, -32703, -32726, -32743,
-  -32754, -32761, -32764, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-     320,   5172,   9912,  14434,
-   18640,  22436,  25737,  28473,
-   30582,  32018,  32751,  32766,
-   32063,  30658,  28585,  25890,
-   22634,  18889,  14739,  10275,
-    5596,    804,  -3997,  -8704,
-  -13214, -17434, -21275, -24657,
-  -27513, -29786, -31436, -32433,
-  -32766, -32436, -31462, -29873,
-  -27717, -25049, -21938, -18461,
-  -14705, -10758,  -6714,  -2669,
-    1286,   5058,   8564,  11724,
-   14471,  16744,  18496,  19691,
-   20308,  20337,  19783,  18662,
-   17003,  14849,  12250,   9266,
-    5966,   2423,  -1285,  -5079,
-   -8877, -12603, -16180, -19538,
-  -22614, -25351, -27702, -29631,
-  -31109, -32122, -32664, -32741,
-  -32369, -31574, -30392, -28864,
-  -27042, -24979, -22734, -20370,
-  -17949, -15533, -13181, -10951,
-   -8896,  -7062,  -5489,  -4210,
-   -3251,  -2629,  -2352,  -2421,
-   -2828,  -3558,  -4589,  -5892,
-   -7435,  -9180, -11084, -13105,
-  -15199, -17320, -19426, -21476,
-  -23430, -25256, -26923, -28406,
-  -29686, -30749, -31587, -32198,
-  -32584, -32755, -32723, -32505,
-  -32123, -31601, -30962, -30237,
-  -29450, -28632, -27808, -27004,
-  -26243, -25546, -24931, -24413,
-  -24002, -23706, -23530, -23474,
-  -23536, -23709, -23986, -24356,
-  -24807, -25326, -25896, -26504,
-  -27135, -27774, -28407, -29022,
-  -29608, -30155, -30655, -31104,
-  -31498, -31834, -32113, -32336,
-  -32507, -32630, -32710, -32753,
-  -32766, -32755, -32728, -32689,
-  -32645, -32601, -32562, -32529,
-  -32506, -32495, -32494, -32504,
-  -32524, -32552, -32586, -32622,
-  -32659, -32693, -32723, -32746,
-  -32761, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,    187,   7402,  14255,
-   20407,  25554,  29445,  31889,
-   32766,  32036,  29738,  25986,
-   20970,  14937,   8184,   1044,
-   -6135, -13006, -19239, -24538,
-  -28657, -31410, -32681, -32428,
-  -30687, -27566, -23241, -17946,
-  -11961,  -5598,    817,   6960,
-   12522,  17229,  20851,  23217,
-   24219,  23818,  22045,  18998,
-   14838,   9776,   4063,  -2020,
-   -8181, -14131, -19595, -24330,
-  -28134, -30856, -32401, -32736,
-  -31890, -29947, -27046, -23370,
-  -19135, -14579,  -9951,  -5495,
-   -1443,   2004,   4679,   6456,
-    7262,   7071,   5909,   3849,
-    1006,  -2468,  -6398, -10590,
-  -14845, -18968, -22779, -26119,
-  -28859, -30907, -32208, -32748,
-  -32550, -31674, -30212, -28281,
-  -26017, -23563, -21069, -18678,
-  -16518, -14702, -13318, -12428,
-  -12064, -12229, -12901, -14031,
-  -15549, -17370, -19399, -21535,
-  -23677, -25733, -27617, -29262,
-  -30617, -31647, -32340, -32700,
-  -32750, -32527, -32078, -31461,
-  -30735, -29960, -29196, -28493,
-  -27895, -27435, -27134, -27002,
-  -27038, -27231, -27563, -28006,
-  -28531, -29107, -29701, -30285,
-  -30834, -31328, -31752, -32099,
-  -32366, -32557, -32680, -32745,
-  -32766, -32756, -32729, -32696,
-  -32666, -32647, -32640, -32647,
-  -32666, -32692, -32720, -32745,
-  -32762, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,    203,   9767,
-   18489,  25609,  30510,  32766,
-   32185,  28822,  22975,  15155,
-    6045,  -3567, -12852, -21016,
-  -27372, -31394, -32766, -31407,
-  -27476, -21356, -13615,  -4960,
-    3832,  11981,  18773,  23620,
-   26113,  26052,  23464,  18592,
-   11877,   3908,  -4625, -13000,
-  -20520, -26580, -30715, -32638,
-  -32261, -29699, -25255, -19390,
-  -12676,  -5744,    771,   6290,
-   10333,  12566,  12820,  11103,
-    7596,   2627,  -3357,  -9838,
-  -16273, -22143, -26996, -30487,
-  -32403, -32677, -31388, -28749,
-  -25080, -20780, -16281, -12018,
-   -8381,  -5689,  -4160,  -3902,
-   -4905,  -7047, -10115, -13825,
-  -17852, -21863, -25544, -28630,
-  -30924, -32312, -32766, -32344,
-  -31176, -29449, -27387, -25226,
-  -23194, -21487, -20259, -19606,
-  -19565, -20111, -21171, -22629,
-  -24344, -26163, -27938, -29540,
-  -30868, -31858, -32481, -32749,
-  -32704, -32411, -31952, -31414,
-  -30878, -30415, -30075, -29889,
-  -29867, -29998, -30256, -30604,
-  -31001, -31406, -31785, -32110,
-  -32368, -32554, -32673, -32737,
-  -32763, -32765, -32760, -32756,
-  -32757, -32762, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,    438,
-   14623,  26051,  32513,  32766,
-   26770,  15694,   1683, -12564,
-  -24321, -31368, -32416, -27350,
-  -17241,  -4123,   9405,  20701,
-   27583,  28750,  24023,  14356,
-    1641, -11685, -23113, -30553,
-  -32731, -29414, -21434, -10500,
-    1149,  11197,  17694,  19429,
-   16136,   8522,  -1900, -13130,
-  -23083, -29991, -32738, -31047,
-  -25503, -17408,  -8499,   -597,
-    4749,   6550,   4539,   -809,
-   -8402, -16777, -24395, -29947,
-  -32590, -32089, -28820, -23668,
-  -17825, -12535,  -8857,  -7468,
-   -8558, -11830, -16588, -21904,
-  -26815, -30511, -32482, -32592,
-  -31075, -28452, -25411, -22649,
-  -20740, -20033, -20602, -22266,
-  -24649, -27277, -29684, -31505,
-  -32534, -32748, -32289, -31407,
-  -30399, -29534, -29009, -28912,
-  -29224, -29840, -30611, -31379,
-  -32021, -32466, -32701, -32766,
-  -32726, -32650, -32594, -32584,
-  -32619, -32677, -32732, -32762,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-       0,   2616,   5198,   7731,
-   10203,  12599,  14908,  17118,
-   19217,  21194,  23041,  24748,
-   26306,  27709,  28950,  30024,
-   30925,  31651,  32199,  32568,
-   32757,  32766,  32597,  32253,
-   31736,  31051,  30203,  29199,
-   28045,  26748,  25318,  23762,
-   22091,  20315,  18444,  16490,
-   14464,  12378,  10243,   8072,
-    5877,   3671,   1465,   -729,
-   -2898,  -5031,  -7117,  -9144,
-  -11102, -12981, -14771, -16463,
-  -18050, -19523, -20875, -22100,
-  -23193, -24149, -24964, -25635,
-  -26159, -26536, -26765, -26845,
-  -26779, -26567, -26213, -25720,
-  -25092, -24334, -23451, -22450,
-  -21338, -20121, -18808, -17407,
-  -15926, -14375, -12763, -11099,
-   -9394,  -7656,  -5897,  -4125,
-   -2351,   -585,   1163,   2885,
-    4571,   6212,   7800,   9326,
-   10782,  12163,  13459,  14667,
-   15779,  16792,  17700,  18500,
-   19188,  19764,  20223,  20566,
-   20792,  20902,  20896,  20775,
-   20542,  20201,  19753,  19203,
-   18555,  17815,  16987,  16078,
-   15094,  14041,  12926,  11756,
-   10538,   9281,   7991,   6676,
-    5344,   4003,   2660,   1324,
-       0,  -1303,  -2579,  -3820,
-   -5020,  -6174,  -7275,  -8318,
-   -9298, -10211, -11052, -11818,
-  -12506, -13113, -13638, -14077,
-  -14432, -14700, -14882, -14979,
-  -14990, -14919, -14766, -14534,
-  -14226, -13845, -13395, -12878,
-  -12300, -11665, -10978, -10244,
-   -9468,  -8654,  -7810,  -6939,
-   -6049,  -5143,  -4229,  -3311,
-   -2394,  -1485,   -589,    291,
-    1148,   1979,   2779,   3544,
-    4270,   4954,   5593,   6184,
-    6724,   7213,   7647,   8027,
-    8350,   8616,   8826,   8979,
-    9076,   9118,   9106,   9041,
-    8926,   8763,   8554,   8301,
-    8008,   7677,   7313,   6917,
-    6494,   6047,   5580,   5097,
-    4601,   4096,   3585,   3073,
-    2562,   2056,   1559,   1073,
-     602,    147,   -287,   -700,
-   -1088,  -1451,  -1785,  -2091,
-   -2367,  -2612,  -2825,  -3006,
-   -3156,  -3274,  -3361,  -3417,
-   -3444,  -3443,  -3414,  -3360,
-   -3283,  -3184,  -3065,  -2928,
-   -2776,  -2611,  -2435,  -2251,
-   -2062,  -1869,  -1675,  -1482,
-   -1294,  -1111,   -937,   -772,
-    -620,   -481,   -358,   -251,
-    -162,    -92,    -41,    -10,
-       0,      0,   3807,   7537,
-   11147,  14593,  17833,  20831,
-   23552,  25964,  28041,  29760,
-   31103,  32056,  32612,  32766,
-   32520,  31880,  30858,  29469,
-   27732,  25673,  23319,  20701,
-   17853,  14812,  11617,   8308,
-    4927,   1515,  -1885,  -5233,
-   -8487, -11610, -14563, -17313,
-  -19827, -22078, -24039, -25690,
-  -27013, -27995, -28627, -28905,
-  -28829, -28402, -27634, -26536,
-  -25126, -23423, -21452, -19238,
-  -16812, -14204, -11449,  -8582,
-   -5638,  -2655,    331,   3283,
-    6165,   8943,  11584,  14057,
-   16333,  18388,  20197,  21741,
-   23004,  23974,  24641,  25002,
-   25054,  24800,  24248,  23406,
-   22288,  20910,  19294,  17460,
-   15434,  13243,  10915,   8481,
-    5972,   3418,    852,  -1694,
-   -4190,  -6605,  -8911, -11082,
-  -13091, -14916, -16538, -17939,
-  -19103, -20020, -20682, -21084,
-  -21224, -21103, -20726, -20102,
-  -19240, -18156, -16864, -15383,
-  -13735, -11941, -10025,  -8013,
-   -5931,  -3805,  -1662,    472,
-    2570,   4607,   6559,   8403,
-   10118,  11685,  13086,  14307,
-   15336,  16161,  16777,  17179,
-   17365,  17336,  17096,  16650,
-   16009,  15182,  14183,  13026,
-   11729,  10310,   8789,   7186,
-    5521,   3817,   2096,    379,
-   -1313,  -2959,  -4540,  -6037,
-   -7434,  -8713,  -9863, -10871,
-  -11726, -12422, -12953, -13314,
-  -13505, -13527, -13383, -13077,
-  -12618, -12012, -11272, -10409,
-   -9436,  -8368,  -7220,  -6008,
-   -4749,  -3460,  -2157,   -857,
-     424,   1669,   2865,   3997,
-    5052,   6020,   6889,   7651,
-    8300,   8829,   9235,   9517,
-    9673,   9705,   9615,   9409,
-    9092,   8671,   8155,   7552,
-    6873,   6129,   5332,   4492,
-    3624,   2738,   1846,    962,
-      95,   -743,  -1543,  -2294,
-   -2989,  -3621,  -4182,  -4669,
-   -5078,  -5405,  -5650,  -5813,
-   -5893,  -5895,  -5820,  -5673,
-   -5459,  -5184,  -4855,  -4478,
-   -4061,  -3613,  -3140,  -2652,
-   -2155,  -1659,  -1169,   -695,
-    -241,    186,    581,    939,
-    1257,   1532,   1762,   1946,
-    2084,   2176,   2223,   2229,
-    2195,   2125,   2024,   1896,
-    1745,   1577,   1396,   1210,
-    1022,    838,    662,    500,
-     355,    232,    132,     59,
-      15,      0,      0,   5008,
-    9868,  14478,  18738,  22560,
-   25865,  28585,  30666,  32068,
-   32766,  32751,  32029,  30622,
-   28565,  25908,  22713,  19055,
-   15016,  10686,   6162,   1543,
-   -3070,  -7577, -11883, -15894,
-  -19529, -22710, -25373, -27465,
-  -28945, -29788, -29980, -29523,
-  -28433, -26739, -24482, -21718,
-  -18510, -14931, -11063,  -6992,
-   -2807,   1399,   5535,   9514,
-   13249,  16663,  19685,  22253,
-   24315,  25833,  26779,  27137,
-   26905,  26096,  24730,  22845,
-   20485,  17707,  14574,  11159,
-    7537,   3790,      0,  -3751,
-   -7382, -10815, -13979, -16808,
-  -19243, -21238, -22752, -23759,
-  -24242, -24196, -23628, -22557,
-  -21010, -19028, -16656, -13952,
-  -10978,  -7800,  -4491,  -1123,
-    2230,   5496,   8605,  11491,
-   14095,  16363,  18251,  19721,
-   20748,  21315,  21414,  21050,
-   20236,  18995,  17360,  15371,
-   13076,  10528,   7785,   4911,
-    1968,   -979,  -3864,  -6628,
-   -9211, -11561, -13628, -15373,
-  -16761, -17768, -18378, -18581,
-  -18381, -17787, -16817, -15498,
-  -13864, -11954,  -9815,  -7496,
-   -5051,  -2533,      0,   2494,
-    4895,   7153,   9220,  11055,
-   12622,  13891,  14838,  15450,
-   15717,  15640,  15227,  14492,
-   13456,  12148,  10600,   8850,
-    6940,   4915,   2820,    703,
-   -1391,  -3415,  -5327,  -7087,
-   -8661, -10016, -11128, -11978,
-  -12551, -12842, -12849, -12577,
-  -12039, -11252, -10238,  -9024,
-   -7642,  -6124,  -4507,  -2829,
-   -1128,    558,   2193,   3742,
-    5174,   6458,   7571,   8493,
-    9207,   9703,   9976,  10026,
-    9856,   9477,   8903,   8151,
-    7242,   6202,   5056,   3834,
-    2564,   1276,      0,  -1237,
-   -2409,  -3491,  -4461,  -5303,
-   -6001,  -6543,  -6924,  -7141,
-   -7193,  -7085,  -6826,  -6427,
-   -5902,  -5268,  -4543,  -3747,
-   -2902,  -2029,  -1149,   -282,
-     551,   1333,   2049,   2683,
-    3226,   3669,   4006,   4235,
-    4355,   4369,   4283,   4104,
-    3842,   3509,   3116,   2678,
-    2208,   1720,   1229,    748,
-     289,   -138,   -522,   -857,
-   -1136,  -1355,  -1514,  -1613,
-   -1653,  -1638,  -1575,  -1470,
-   -1332,  -1168,   -989,   -804,
-    -621,   -449,   -297,   -172,
-     -78,    -20,      0,      0,
-    7354,  14295,  20489,  25641,
-   29511,  31921,  32766,  32017,
-   29723,  26009,  21064,  15140,
-    8531,   1563,  -5423, -12089,
-  -18115, -23212, -27144, -29727,
-  -30849, -30468, -28615, -25392,
-  -20967, -15564,  -9455,  -2942,
-    3658,  10022,  15845,  20849,
-   24799,  27514,  28871,  28819,
-   27372,  24613,  20687,  15796,
-   10185,   4133,  -2063,  -8101,
-  -13690, -18563, -22492, -25295,
-  -26846, -27083, -26007, -23682,
-  -20233, -15839, -10722,  -5136,
-     643,   6333,  11659,  16367,
-   20235,  23084,  24787,  25273,
-   24530,  22609,  19613,  15699,
-   11067,   5949,    598,  -4725,
-   -9762, -14271, -18041, -20896,
-  -22708, -23402, -22956, -21403,
-  -18833, -15381, -11224,  -6572,
-   -1656,   3283,   8006,  12286,
-   15921,  18742,  20623,  21483,
-   21294,  20078,  17905,  14892,
-   11197,   7006,   2530,  -2013,
-   -6400, -10421, -13887, -16636,
-  -18544, -19531, -19560, -18642,
-  -16836, -14240, -10990,  -7254,
-   -3218,    917,   4950,   8687,
-   11951,  14590,  16486,  17558,
-   17765,  17110,  15637,  13431,
-   10609,   7316,   3720,      0,
-   -3663,  -7091, -10123, -12617,
-  -14462, -15578, -15922, -15492,
-  -14320, -12476, -10059,  -7198,
-   -4037,   -736,   2543,   5642,
-    8413,  10728,  12484,  13604,
-   14046,  13802,  12895,  11382,
-    9349,   6902,   4170,   1290,
-   -1595,  -4346,  -6831,  -8935,
-  -10565, -11650, -12150, -12052,
-  -11374, -10161,  -8485,  -6435,
-   -4121,  -1661,    823,   3210,
-    5385,   7249,   8717,   9729,
-   10246,  10255,   9768,   8823,
-    7475,   5802,   3894,   1849,
-    -229,  -2239,  -4084,  -5678,
-   -6953,  -7853,  -8348,  -8424,
-   -8091,  -7378,  -6330,  -5010,
-   -3492,  -1855,   -184,   1438,
-    2934,   4234,   5283,   6037,
-    6470,   6574,   6355,   5837,
-    5058,   4066,   2920,   1681,
-     416,   -811,  -1942,  -2925,
-   -3718,  -4290,  -4624,  -4716,
-   -4572,  -4214,  -3670,  -2978,
-   -2183,  -1330,   -467,    361,
-    1115,   1759,   2269,   2627,
-    2825,   2865,   2757,   2519,
-    2176,   1756,   1288,    806,
-     338,    -90,   -456,   -745,
-    -946,  -1057,  -1083,  -1033,
-    -921,   -766,   -588,   -407,
-    -243,   -113,    -29,      0,
-       0,   9710,  18511,  25654,
-   30539,  32766,  32163,  28805,
-   23003,  15273,   6295,  -3150,
-  -12248, -20221, -26394, -30252,
-  -31482, -30001, -25958, -19722,
-  -11847,  -3021,   5988,  14407,
-   21519,  26723,  29590,  29894,
-   27631,  23017,  16470,   8567,
-       0,  -8491, -16178, -22409,
-  -26661, -28589, -28046, -25104,
-  -20035, -13294,  -5476,   2739,
-   10642,  17558,  22904,  26235,
-   27284,  25984,  22468,  17059,
-   10240,   2610,  -5169, -12429,
-  -18551, -23021, -25473, -25717,
-  -23753, -19773, -14138,  -7349,
-       0,   7273,  13846,  19164,
-   22783,  24411,  23929,  21402,
-   17067,  11316,   4658,  -2327,
-   -9036, -14896, -19414, -22218,
-  -23087, -21967, -18978, -14396,
-   -8634,  -2199,   4350,  10450,
-   15583,  19319,  21356,  21539,
-   19875,  16528,  11806,   6131,
-       0,  -6054, -11514, -15920,
-  -18905, -20234, -19813, -17700,
-  -14099,  -9337,  -3839,   1916,
-    7429,  12233,  15924,  18201,
-   18889,  17950,  15487,  11733,
-    7028,   1787,  -3532,  -8471,
-  -12614, -15617, -17240, -17362,
-  -15997, -13283,  -9474,  -4912,
-       0,   4836,   9182,  12675,
-   15027,  16057,  15696,  13998,
-   11130,   7358,   3020,  -1504,
-   -5823,  -9570, -12434, -14184,
-  -14691, -13933, -11997,  -9070,
-   -5421,  -1376,   2713,   6493,
-    9646,  11916,  13123,  13185,
-   12119,  10038,   7142,   3694,
-       0,  -3617,  -6850,  -9430,
-  -11149, -11879, -11579, -10296,
-   -8162,  -5380,  -2201,   1093,
-    4217,   6907,   8943,  10168,
-   10494,   9916,   8507,   6408,
-    3815,    964,  -1894,  -4514,
-   -6678,  -8214,  -9006,  -9007,
-   -8241,  -6794,  -4810,  -2475,
-       0,   2399,   4518,   6185,
-    7271,   7702,   7462,   6594,
-    5194,   3401,   1382,   -681,
-   -2610,  -4244,  -5453,  -6151,
-   -6296,  -5900,  -5017,  -3745,
-   -2209,   -553,   1075,   2535,
-    3710,   4512,   4889,   4830,
-    4363,   3549,   2478,   1257,
-       0,  -1180,  -2186,  -2941,
-   -3393,  -3525,  -3345,  -2892,
-   -2226,  -1422,   -563,    270,
-    1004,   1581,   1963,   2134,
-    2099,   1883,   1527,   1082,
-     602,    141,   -256,   -557,
-    -742,   -810,   -772,   -653,
-    -485,   -304,   -146,    -38,
-       0,      0,  14454,  26030,
-   32535,  32766,  26727,  15623,
-    1620, -12582, -24262, -31208,
-  -32128, -26896, -16562,  -3145,
-   10764,  22498,  29832,  31400,
-   26949,  17382,   4571,  -9005,
-  -20744, -28415, -30587, -26891,
-  -18085,  -5897,   7312,  19007,
-   26965,  29696,  26725,  18671,
-    7119,  -5690, -17295, -25488,
-  -28733, -26456, -19141,  -8235,
-    4143,  15614,  23993,  27706,
-   26088,  19498,   9245,  -2677,
-  -13972, -22487, -26621, -25626,
-  -19744, -10147,   1294,  12374,
-   20977,  25485,  25077,  19881,
-   10940,      0, -10826, -19471,
-  -24305, -24444, -19912, -11624,
-   -1203,   9335,  17976,  23089,
-   23736,  19841,  12200,   2313,
-   -7905, -16499, -21844, -22956,
-  -19672, -12668,  -3326,   6542,
-   15046,  20577,  22113,  19408,
-   13030,   4242,  -5251, -13625,
-  -19295, -21211, -19055, -13288,
-   -5057,   4035,  12241,  18005,
-   20259,  18617,  13443,   5773,
-   -2898, -10901, -16715, -19262,
-  -18099, -13499,  -6387,   1845,
-    9610,  15432,  18228,  17507,
-   13457,   6900,   -878,  -8374,
-  -14162, -17163, -16846, -13322,
-   -7312,      0,   7199,  12912,
-   16075,  16123,  13097,   7624,
-     787,  -6088, -11689, -14970,
-  -15343, -12787,  -7838,  -1481,
-    5047,  10499,  13855,  14513,
-   12394,   7954,   2081,  -4079,
-   -9348, -12738, -13638, -11926,
-   -7976,  -2586,   3189,   8242,
-   11625,  12727,  11385,   7906,
-    2996,  -2379,  -7187, -10523,
-  -11785, -10778,  -7746,  -3310,
-    1653,   6187,   9438,  10818,
-   10111,   7499,   3528,  -1014,
-   -5248,  -8377,  -9835,  -9388,
-   -7171,  -3653,    462,   4375,
-    7347,   8842,   8616,   6764,
-    3684,      0,  -3571,  -6354,
-   -7844,  -7801,  -6282,  -3625,
-    -371,   2841,   5403,   6851,
-    6950,   5732,   3476,    650,
-   -2188,  -4500,  -5867,  -6069,
-   -5117,  -3241,   -836,   1616,
-    3650,   4899,   5164,   4443,
-    2922,    931,  -1127,  -2859,
-   -3955,  -4242,  -3715,  -2523,
-    -934,    724,   2132,   3040,
-    3310,   2940,   2048,    847,
-    -408,  -1473,  -2160,  -2375,
-   -2122,  -1500,   -670,    182,
-     886,   1323,   1442,   1269,
-     884,    406,    -46,   -375,
-    -532,   -520,   -386,   -205,
-     -57,      0,      0,  18707,
-   30987,  32766,  23530,   6466,
-  -12633, -27339, -32748, -27119,
-  -12431,   6311,  22783,  31471,
-   29523,  17680,      0, -17533,
-  -29035, -30694, -22036,  -6054,
-   11825,  25582,  30635,  25362,
-   11622,  -5899, -21289, -29399,
-  -27571, -16506,      0,  16360,
-   27083,  28622,  20542,   5642,
-  -11016, -23825, -28522, -23606,
-  -10814,   5487,  19795,  27327,
-   25619,  15333,      0, -15186,
-  -25131, -26550, -19048,  -5230,
-   10208,  22068,  26409,  21849,
-   10005,  -5075, -18301, -25254,
-  -23667, -14159,      0,  14012,
-   23179,  24477,  17554,   4817,
-   -9399, -20312, -24297, -20092,
-   -9197,   4663,  16807,  23182,
-   21715,  12985,      0, -12838,
-  -21227, -22405, -16060,  -4405,
-    8590,  18555,  22184,  18335,
-    8388,  -4251, -15313, -21110,
-  -19763, -11811,      0,  11664,
-   19275,  20333,  14566,   3993,
-   -7782, -16798, -20071, -16579,
-   -7580,   3838,  13819,  19038,
-   17811,  10637,      0, -10491,
-  -17323, -18261, -13072,  -3581,
-    6973,  15042,  17958,  14822,
-    6771,  -3426, -12325, -16966,
-  -15859,  -9464,      0,   9317,
-   15371,  16189,  11578,   3169,
-   -6165, -13285, -15846, -13065,
-   -5963,   3014,  10831,  14894,
-   13908,   8290,      0,  -8143,
-  -13420, -14117, -10084,  -2756,
-    5356,  11528,  13733,  11309,
-    5154,  -2602,  -9337, -12821,
-  -11956,  -7116,      0,   6969,
-   11468,  12044,   8590,   2344,
-   -4548,  -9772, -11620,  -9552,
-   -4346,   2190,   7843,  10749,
-   10004,   5942,      0,  -5796,
-   -9516,  -9972,  -7096,  -1932,
-    3739,   8015,   9507,   7795,
-    3537,  -1778,  -6349,  -8677,
-   -8052,  -4768,      0,   4622,
-    7564,   7900,   5602,   1520,
-   -2931,  -6258,  -7395,  -6039,
-   -2729,   1365,   4855,   6605,
-    6100,   3595,      0,  -3448,
-   -5612,  -5828,  -4108,  -1108,
-    2122,   4502,   5282,   4282,
-    1920,   -953,  -3361,  -4533,
-   -4148,  -2421,      0,   2274,
-    3660,   3756,   2614,    696,
-   -1314,  -2745,  -3169,  -2525,
-   -1112,    541,   1867,   2461,
-    2196,   1247,      0,  -1100,
-   -1708,  -1684,  -1120,   -283,
-     505,    988,   1056,    769,
-     303,   -129,   -373,   -389,
-    -244,    -73,      0,      0,
-   30632,  23353, -12589, -32766,
-  -12489,  22985,  29911,      0,
-  -29671, -22617,  12191,  31726,
-   12091, -22250, -28950,      0,
-   28710,  21882, -11793, -30686,
-  -11693,  21514,  27989,      0,
-  -27749, -21146,  11395,  29645,
-   11295, -20779, -27028,      0,
-   26788,  20411, -10997, -28605,
-  -10897,  20043,  26067,      0,
-  -25827, -19675,  10598,  27565,
-   10499, -19308, -25106,      0,
-   24866,  18940, -10200, -26525,
-  -10101,  18572,  24145,      0,
-  -23905, -18204,   9802,  25485,
-    9703, -17836, -23184,      0,
-   22944,  17469,  -9404, -24444,
-   -9305,  17101,  22223,      0,
-  -21983, -16733,   9006,  23404,
-    8907, -16365, -21262,      0,
-   21022,  15998,  -8608, -22364,
-   -8509,  15630,  20301,      0,
-  -20061, -15262,   8210,  21324,
-    8111, -14894, -19340,      0,
-   19100,  14527,  -7812, -20284,
-   -7712,  14159,  18379,      0,
-  -18139, -13791,   7414,  19244,
-    7314, -13423, -17418,      0,
-   17178,  13056,  -7016, -18203,
-   -6916,  12688,  16457,      0,
-  -16217, -12320,   6618,  17163,
-    6518, -11952, -15496,      0,
-   15256,  11585,  -6220, -16123,
-   -6120,  11217,  14535,      0,
-  -14295, -10849,   5822,  15083,
-    5722, -10481, -13574,      0,
-   13334,  10113,  -5424, -14043,
-   -5324,   9746,  12613,      0,
-  -12373,  -9378,   5026,  13002,
-    4926,  -9010, -11652,      0,
-   11412,   8642,  -4627, -11962,
-   -4528,   8275,  10691,      0,
-  -10451,  -7907,   4229,  10922,
-    4130,  -7539,  -9730,      0,
-    9490,   7171,  -3831,  -9882,
-   -3732,   6804,   8769,      0,
-   -8529,  -6436,   3433,   8842,
-    3334,  -6068,  -7808,      0,
-    7568,   5700,  -3035,  -7801,
-   -2936,   5333,   6847,      0,
-   -6607,  -4965,   2637,   6761,
-    2538,  -4597,  -5886,      0,
-    5646,   4229,  -2239,  -5721,
-   -2140,   3862,   4925,      0,
-   -4685,  -3494,   1841,   4681,
-    1742,  -3126,  -3964,      0,
-    3724,   2758,  -1443,  -3641,
-   -1343,   2390,   3003,      0,
-   -2763,  -2023,   1045,   2600,
-     945,  -1655,  -2042,      0,
-    1802,   1287,   -647,  -1560,
-    -547,    919,   1081,      0,
-    -841,   -552,    249,    520,
-     149,   -184,   -120,      0,
-   -9377,  -4839,   -429,   3819,
-    7870,  11693,  15260,  18546,
-   21527,  24184,  26500,  28464,
-   30064,  31295,  32155,  32644,
-   32766,  32529,  31943,  31022,
-   29781,  28240,  26420,  24344,
-   22036,  19524,  16835,  13998,
-   11042,   7998,   4896,   1765,
-   -1366,  -4467,  -7510, -10471,
-  -13322, -16042, -18608, -21002,
-  -23205, -25202, -26981, -28532,
-  -29846, -30919, -31746, -32328,
-  -32667, -32766, -32632, -32274,
-  -31702, -30927, -29965, -28830,
-  -27539, -26109, -24560, -22910,
-  -21179, -19386, -17553, -15698,
-  -13841, -12001, -10197,  -8445,
-   -6763,  -5164,  -3664,  -2274,
-   -1007,    130,   1128,   1980,
-    2682,   3231,   3626,   3867,
-    3956,   3896,   3693,   3352,
-    2881,   2289,   1585,    779,
-    -117,  -1091,  -2131,  -3224,
-   -4357,  -5517,  -6692,  -7868,
-   -9033, -10176, -11284, -12347,
-  -13355, -14299, -15171, -15963,
-  -16669, -17284, -17804, -18225,
-  -18546, -18766, -18886, -18905,
-  -18828, -18657, -18395, -18049,
-  -17623, -17124, -16559, -15936,
-  -15261, -14544, -13792, -13014,
-  -12219, -11415, -10609,  -9812,
-   -9029,  -8269,  -7538,  -6844,
-   -6191,  -5585,  -5031,  -4533,
-   -4094,  -3717,  -3404,  -3155,
-   -2971,  -2853,  -2799,  -2808,
-   -2877,  -3005,  -3187,  -3421,
-   -3702,  -4027,  -4389,  -4785,
-   -5209,  -5656,  -6121,  -6599,
-   -7084,  -7571,  -8056,  -8534,
-   -8999,  -9449,  -9879, -10286,
-  -10667, -11018, -11338, -11625,
-  -11877, -12093, -12273, -12416,
-  -12524, -12595, -12632, -12636,
-  -12608, -12550, -12465, -12354,
-  -12221, -12067, -11897, -11711,
-  -11515, -11309, -11098, -10883,
-  -10668, -10455, -10246, -10044,
-   -9851,  -9668,  -9497,  -9339,
-   -9196,  -9068,  -8955,  -8859,
-   -8779,  -8715,  -8667,  -8634,
-   -8616,  -8611,  -8620,  -8639,
-   -8669,  -8708,  -8755,  -8807,
-   -8864,  -8924,  -8986,  -9048,
-   -9110,  -9168,  -9224,  -9275,
-   -9321,  -9360,  -9393,  -9419,
-   -9437,  -9448,  -9450,  -9445,
-   -9433,  -9413,  -9387,  -9356,
-   -9319,  -9278,  -9233,  -9186,
-   -9137,  -9088,  -9039,  -8992,
-   -8947,  -8906,  -8870,  -8838,
-   -8813,  -8794,  -8782,  -8778,
-   -8782,  -8795,  -8816,  -8845,
-   -8884,  -8932,  -8990,  -9066,
-   -9377,  -7511,    855,   8744,
-   15865,  21962,  26826,  30301,
-   32293,  32766,  31749,  29331,
-   25654,  20910,  15328,   9167,
-    2702,  -3786, -10025, -15760,
-  -20764, -24850, -27872, -29739,
-  -30407, -29889, -28248, -25596,
-  -22085, -17900, -13256,  -8378,
-   -3499,   1151,   5361,   8939,
-   11729,  13608,  14499,  14367,
-   13224,  11125,   8167,   4481,
-     229,  -4405,  -9223, -14022,
-  -18604, -22781, -26386, -29278,
-  -31348, -32522, -32766, -32084,
-  -30519, -28148, -25080, -21450,
-  -17415, -13141,  -8804,  -4575,
-    -618,   2920,   5912,   8257,
-    9886,  10757,  10866,  10237,
-    8926,   7014,   4607,   1825,
-   -1196,  -4318,  -7402, -10314,
-  -12934, -15157, -16900, -18103,
-  -18731, -18776, -18255, -17209,
-  -15704, -13820, -11654,  -9312,
-   -6905,  -4544,  -2334,   -372,
-    1258,   2490,   3276,   3589,
-    3423,   2793,   1734,    297,
-   -1451,  -3431,  -5556,  -7736,
-   -9880, -11902, -13723, -15274,
-  -16499, -17358, -17827, -17900,
-  -17586, -16911, -15914, -14647,
-  -13170, -11552,  -9863,  -8174,
-   -6554,  -5065,  -3762,  -2689,
-   -1880,  -1355,  -1121,  -1173,
-   -1493,  -2054,  -2818,  -3740,
-   -4772,  -5860,  -6954,  -8004,
-   -8963,  -9792, -10459, -10941,
-  -11224, -11304, -11185, -10882,
-  -10416,  -9815,  -9113,  -8345,
-   -7549,  -6763,  -6023,  -5360,
-   -4802,  -4371,  -4081,  -3942,
-   -3953,  -4109,  -4399,  -4805,
-   -5305,  -5875,  -6488,  -7117,
-   -7734,  -8315,  -8837,  -9282,
-   -9636,  -9889, -10037, -10081,
-  -10025,  -9879,  -9656,  -9370,
-   -9040,  -8683,  -8317,  -7960,
-   -7628,  -7332,  -7084,  -6892,
-   -6758,  -6684,  -6668,  -6703,
-   -6783,  -6898,  -7038,  -7191,
-   -7346,  -7492,  -7622,  -7726,
-   -7800,  -7840,  -7845,  -7817,
-   -7758,  -7673,  -7570,  -7454,
-   -7335,  -7220,  -7116,  -7031,
-   -6968,  -6933,  -6927,  -6951,
-   -7003,  -7080,  -7177,  -7289,
-   -7408,  -7528,  -7642,  -7743,
-   -7825,  -7883,  -7915,  -7917,
-   -7892,  -7838,  -7761,  -7665,
-   -7554,  -7437,  -7320,  -7209,
-   -7113,  -7037,  -6986,  -6964,
-   -6972,  -7012,  -7082,  -7179,
-   -7298,  -7434,  -7579,  -7726,
-   -7867,  -7994,  -8100,  -8179,
-   -8225,  -8235,  -8206,  -8136,
-   -8018,  -7511,  -9045,    688,
-    9758,  17734,  24254,  29037,
-   31900,  32766,  31664,  28723,
-   24169,  18301,  11478,   4097,
-   -3434, -10713, -17372, -23093,
-  -27624, -30791, -32506, -32766,
-  -31651, -29316, -25978, -21899,
-  -17373, -12703,  -8184,  -4087,
-    -644,   1968,   3629,   4287,
-    3950,   2693,    640,  -2039,
-   -5144,  -8457, -11757, -14836,
-  -17506, -19617, -21057, -21765,
-  -21724, -20968, -19571, -17645,
-  -15328, -12773, -10143,  -7593,
-   -5264,  -3275,  -1716,   -643,
-     -75,      0,   -372,  -1120,
-   -2153,  -3367,  -4655,  -5917,
-   -7061,  -8014,  -8727,  -9176,
-   -9362,  -9312,  -9074,  -8714,
-   -8307,  -7934,  -7673,  -7592,
-   -7743,  -8158,  -8848,  -9795,
-  -10959, -12277, -13669, -15040,
-  -16291, -17322, -18042, -18374,
-  -18265, -17683, -16627, -15127,
-  -13241, -11052,  -8668,  -6211,
-   -3813,  -1606,    285,   1748,
-    2696,   3066,   2830,   1993,
-     592,  -1300,  -3583,  -6136,
-   -8818, -11484, -13987, -16190,
-  -17972, -19236, -19917, -19981,
-  -19429, -18299, -16659, -14609,
-  -12270,  -9777,  -7276,  -4910,
-   -2814,  -1104,    124,    804,
-     903,    422,   -608,  -2122,
-   -4028,  -6215,  -8555, -10915,
-  -13161, -15169, -16828, -18051,
-  -18774, -18966, -18622, -17770,
-  -16465, -14785, -12829, -10708,
-   -8539,  -6439,  -4520,  -2878,
-   -1594,   -724,   -301,   -334,
-    -803,  -1669,  -2870,  -4328,
-   -5956,  -7660,  -9345, -10924,
-  -12318, -13462, -14310, -14834,
-  -15024, -14893, -14468, -13792,
-  -12921, -11917, -10847,  -9776,
-   -8765,  -7869,  -7129,  -6575,
-   -6224,  -6079,  -6129,  -6352,
-   -6716,  -7185,  -7716,  -8267,
-   -8799,  -9275,  -9668,  -9957,
-  -10132, -10191, -10142, -10000,
-   -9786,  -9526,  -9247,  -8976,
-   -8738,  -8554,  -8439,  -8401,
-   -8441,  -8553,  -8727,  -8944,
-   -9184,  -9423,  -9640,  -9812,
-   -9923,  -9959,  -9913,  -9785,
-   -9582,  -9315,  -9002,  -8666,
-   -8331,  -8022,  -7763,  -7577,
-   -7479,  -7482,  -7590,  -7800,
-   -8103,  -8483,  -8918,  -9382,
-   -9847, -10283, -10663, -10961,
-  -11158, -11240, -11199, -11037,
-  -10761, -10389,  -9941,  -9444,
-   -8929,  -8428,  -7970,  -7585,
-   -7296,  -7121,  -7072,  -7153,
-   -7366,  -7718,  -9045, -12446,
-   -3592,   4783,  12412,  19060,
-   24536,  28697,  31452,  32766,
-   32659,  31204,  28523,  24778,
-   20166,  14909,   9243,   3409,
-   -2359,  -7839, -12837, -17188,
-  -20765, -23480, -25292, -26199,
-  -26242, -25501, -24086, -22136,
-  -19806, -17264, -14679, -12215,
-  -10022,  -8233,  -6952,  -6254,
-   -6183,  -6748,  -7925,  -9659,
-  -11866, -14440, -17255, -20177,
-  -23064, -25777, -28185, -30173,
-  -31643, -32523, -32766, -32355,
-  -31300, -29639, -27438, -24781,
-  -21774, -18532, -15181, -11845,
-   -8647,  -5699,  -3099,   -928,
-     756,   1917,   2543,   2646,
-    2260,   1441,    259,  -1200,
-   -2845,  -4578,  -6305,  -7936,
-   -9391, -10603, -11525, -12124,
-  -12388, -12328, -11969, -11355,
-  -10546,  -9611,  -8627,  -7675,
-   -6834,  -6179,  -5775,  -5676,
-   -5919,  -6526,  -7499,  -8823,
-  -10462, -12368, -14474, -16704,
-  -18974, -21195, -23277, -25135,
-  -26692, -27881, -28648, -28957,
-  -28791, -28148, -27048, -25529,
-  -23643, -21457, -19049, -16507,
-  -13919, -11375,  -8964,  -6763,
-   -4844,  -3263,  -2062,  -1266,
-    -883,   -905,  -1308,  -2052,
-   -3086,  -4347,  -5766,  -7272,
-   -8791, -10254, -11595, -12760,
-  -13704, -14394, -14812, -14952,
-  -14825, -14453, -13869, -13118,
-  -12251, -11323, -10394,  -9520,
-   -8756,  -8150,  -7741,  -7560,
-   -7625,  -7943,  -8509,  -9306,
-  -10305, -11470, -12754, -14108,
-  -15477, -16806, -18042, -19135,
-  -20043, -20731, -21171, -21348,
-  -21257, -20904, -20306, -19487,
-  -18482, -17330, -16079, -14774,
-  -13464, -12196, -11014,  -9955,
-   -9051,  -8326,  -7794,  -7461,
-   -7326,  -7378,  -7597,  -7959,
-   -8434,  -8990,  -9591, -10202,
-  -10790, -11326, -11784, -12144,
-  -12392, -12522, -12534, -12434,
-  -12237, -11959, -11624, -11257,
-  -10884, -10533, -10230,  -9999,
-   -9858,  -9824,  -9905, -10106,
-  -10424, -10853, -11377, -11979,
-  -12638, -13327, -14020, -14691,
-  -15312, -15860, -16313, -16655,
-  -16871, -16957, -16908, -16730,
-  -16431, -16025, -15529, -14965,
-  -14354, -13723, -13093, -12490,
-  -11934, -11443, -11032, -10712,
-  -10488, -10361, -10329, -10385,
-  -10517, -10711, -10953, -11223,
-  -11504, -11780, -12034, -12252,
-  -12423, -12539, -12593, -12446,
-  -11290,  -2300,   6165,  13815,
-   20398,  25708,  29592,  31956,
-   32766,  32047,  29881,  26406,
-   21803,  16293,  10126,   3570,
-   -3099,  -9607, -15696, -21126,
-  -25694, -29230, -31613, -32766,
-  -32662, -31324, -28821, -25265,
-  -20807, -15629,  -9934,  -3943,
-    2118,   8024,  13564,  18542,
-   22790,  26171,  28583,  29963,
-   30288,  29576,  27883,  25298,
-   21944,  17968,  13537,   8831,
-    4033,   -673,  -5111,  -9124,
-  -12570, -15335, -17335, -18515,
-  -18854, -18362, -17083, -15085,
-  -12468,  -9347,  -5857,  -2142,
-    1647,   5363,   8861,  12011,
-   14698,  16826,  18324,  19143,
-   19264,  18691,  17457,  15615,
-   13242,  10431,   7289,   3933,
-     485,  -2934,  -6207,  -9223,
-  -11887, -14118, -15853, -17050,
-  -17686, -17762, -17298, -16335,
-  -14929, -13155, -11095,  -8843,
-   -6497,  -4154,  -1912,    140,
-    1922,   3365,   4415,   5033,
-    5197,   4904,   4166,   3013,
-    1487,   -355,  -2448,  -4716,
-   -7081,  -9463, -11782, -13964,
-  -15941, -17653, -19053, -20105,
-  -20786, -21090, -21022, -20600,
-  -19857, -18834, -17583, -16163,
-  -14635, -13066, -11519, -10057,
-   -8737,  -7611,  -6719,  -6096,
-   -5762,  -5728,  -5993,  -6545,
-   -7363,  -8415,  -9660, -11055,
-  -12548, -14087, -15619, -17092,
-  -18456, -19670, -20694, -21500,
-  -22066, -22379, -22438, -22247,
-  -21822, -21186, -20368, -19405,
-  -18335, -17201, -16048, -14918,
-  -13852, -12889, -12061, -11396,
-  -10914, -10628, -10545, -10662,
-  -10970, -11453, -12089, -12851,
-  -13708, -14624, -15566, -16497,
-  -17382, -18189, -18889, -19458,
-  -19876, -20131, -20215, -20126,
-  -19871, -19460, -18910, -18241,
-  -17479, -16650, -15784, -14911,
-  -14060, -13259, -12532, -11902,
-  -11387, -11000, -10748, -10636,
-  -10660, -10814, -11086, -11461,
-  -11919, -12439, -12996, -13568,
-  -14129, -14657, -15130, -15529,
-  -15839, -16047, -16145, -16130,
-  -16003, -15767, -15431, -15008,
-  -14512, -13960, -13373, -12768,
-  -12167, -11588, -11050, -10568,
-  -10157,  -9826,  -9584,  -9432,
-   -9373,  -9403,  -9515,  -9701,
-   -9947, -10242, -10568, -10911,
-  -11255, -11584, -11883, -12140,
-  -12344, -12488, -12566, -12575,
-  -12517, -12394, -12211, -11969,
-  -11290,  -8649,   1634,  11126,
-   19325,  25820,  30312,  32637,
-   32766,  30809,  27003,  21691,
-   15302,   8317,   1240,  -5436,
-  -11262, -15858, -18939, -20330,
-  -19974, -17933, -14383,  -9597,
-   -3926,   2224,   8422,  14239,
-   19279,  23200,  25737,  26718,
-   26073,  23836,  20140,  15207,
-    9332,   2861,  -3831, -10367,
-  -16388, -21582, -25695, -28554,
-  -30067, -30236, -29146, -26961,
-  -23909, -20268, -16344, -12447,
-   -8878,  -5900,  -3730,  -2520,
-   -2351,  -3230,  -5088,  -7792,
-  -11152, -14935, -18883, -22732,
-  -26225, -29134, -31274, -32509,
-  -32766, -32036, -30373, -27886,
-  -24737, -21123, -17263, -13386,
-   -9713,  -6443,  -3742,  -1729,
-    -475,      2,   -260,  -1176,
-   -2620,  -4433,  -6437,  -8447,
-  -10285, -11789, -12829, -13309,
-  -13177, -12428, -11099,  -9270,
-   -7055,  -4592,  -2039,    445,
-    2705,   4603,   6028,   6899,
-    7174,   6850,   5962,   4580,
-    2805,    758,  -1425,  -3607,
-   -5653,  -7447,  -8892,  -9920,
-  -10497, -10621, -10323,  -9663,
-   -8727,  -7617,  -6448,  -5333,
-   -4383,  -3693,  -3336,  -3362,
-   -3792,  -4619,  -5804,  -7287,
-   -8985, -10800, -12628, -14363,
-  -15907, -17175, -18101, -18642,
-  -18782, -18528, -17917, -17003,
-  -15861, -14579, -13249, -11965,
-  -10811,  -9863,  -9175,  -8783,
-   -8700,  -8916,  -9396, -10091,
-  -10932, -11842, -12739, -13543,
-  -14179, -14588, -14722, -14556,
-  -14084, -13323, -12307, -11090,
-   -9736,  -8320,  -6921,  -5614,
-   -4470,  -3544,  -2882,  -2507,
-   -2425,  -2624,  -3072,  -3724,
-   -4520,  -5394,  -6278,  -7104,
-   -7811,  -8349,  -8681,  -8785,
-   -8659,  -8315,  -7782,  -7103,
-   -6332,  -5527,  -4751,  -4064,
-   -3519,  -3160,  -3020,  -3115,
-   -3445,  -3998,  -4743,  -5641,
-   -6641,  -7688,  -8722,  -9689,
-  -10537, -11226, -11724, -12014,
-  -12094, -11974, -11677, -11239,
-  -10702, -10113,  -9522,  -8978,
-   -8524,  -8194,  -8015,  -7999,
-   -8149,  -8454,  -8892,  -9433,
-  -10037, -10664, -11269, -11811,
-  -12253, -12564, -12724, -12722,
-  -12557, -12242, -11795, -11245,
-  -10626,  -9976,  -9333,  -8733,
-   -8209,  -7786,  -7482,  -7306,
-   -7256,  -7324,  -7492,  -7734,
-   -8022,  -8325,  -8609,  -8842,
-   -8987,  -8649,  -9756,   3864,
-   15870,  25143,  30898,  32766,
-   30824,  25566,  17824,   8651,
-    -816,  -9506, -16540, -21332,
-  -23640, -23581, -21582, -18306,
-  -14539, -11073,  -8587,  -7556,
-   -8186, -10397, -13841, -17963,
-  -22088, -25523, -27663, -28076,
-  -26572, -23221, -18353, -12504,
-   -6341,   -575,   4143,   7309,
-    8629,   8058,   5798,   2269,
-   -1960,  -6251,  -9990, -12675,
-  -13984, -13818, -12315,  -9822,
-   -6847,  -3981,  -1810,   -830,
-   -1370,  -3545,  -7230, -12075,
-  -17545, -22991, -27733, -31152,
-  -32766, -32300, -29722, -25245,
-  -19305, -12508,  -5551,    862,
-    6103,   9695,  11368,  11079,
-    9009,   5535,   1168,  -3515,
-   -7950, -11654, -14286, -15684,
-  -15871, -15042, -13526, -11730,
-  -10074,  -8929,  -8560,  -9092,
-  -10493, -12581, -15050, -17524,
-  -19604, -20936, -21255, -20428,
-  -18475, -15565, -11995,  -8153,
-   -4460,  -1321,    933,   2086,
-    2063,    935,  -1087,  -3694,
-   -6515,  -9171, -11330, -12746,
-  -13296, -12989, -11961, -10458,
-   -8790,  -7290,  -6264,  -5947,
-   -6464,  -7818,  -9884, -12426,
-  -15130, -17643, -19624, -20790,
-  -20951, -20038, -18111, -15354,
-  -12049,  -8543,  -5201,  -2362,
-    -298,    818,    927,     92,
-   -1518,  -3654,  -6024,  -8331,
-  -10310, -11767, -12595, -12785,
-  -12424, -11672, -10740,  -9850,
-   -9208,  -8968,  -9213,  -9940,
-  -11065, -12433, -13845, -15082,
-  -15941, -16263, -15955, -15009,
-  -13496, -11564,  -9417,  -7284,
-   -5397,  -3952,  -3093,  -2887,
-   -3322,  -4308,  -5691,  -7279,
-   -8862, -10247, -11278, -11860,
-  -11966, -11640, -10986, -10156,
-   -9319,  -8643,  -8267,  -8280,
-   -8712,  -9527, -10629, -11874,
-  -13096, -14120, -14797, -15015,
-  -14722, -13927, -12703, -11175,
-   -9505,  -7870,  -6440,  -5358,
-   -4721,  -4571,  -4890,  -5606,
-   -6606,  -7749,  -8889,  -9893,
-  -10656, -11119, -11266, -11131,
-  -10787, -10331,  -9874,  -9517,
-   -9341,  -9395,  -9685, -10180,
-  -10811, -11487, -12103, -12561,
-  -12782, -12714, -12347, -11706,
-  -10856,  -9886,  -8901,  -8008,
-   -7301,  -6848,  -6686,  -6815,
-   -7197,  -7770,  -8449,  -9143,
-   -9767, -10254, -10560, -10671,
-  -10604, -10402, -10125,  -9840,
-   -9612,  -9496,  -9756,  -8654,
-    6404,  19251,  28354,  32766,
-   32244,  27262,  18900,   8642,
-   -1878, -11145, -18001, -21810,
-  -22517, -20619, -17029, -12882,
-   -9307,  -7216,  -7138,  -9138,
-  -12817, -17403, -21914, -25348,
-  -26879, -26014, -22692, -17290,
-  -10563,  -3502,   2840,   7537,
-    9951,   9841,   7399,   3205,
-   -1881,  -6889, -10909, -13261,
-  -13619, -12061,  -9054,  -5364,
-   -1905,    428,    931,   -771,
-   -4648, -10257, -16812, -23310,
-  -28701, -32064, -32766, -30567,
-  -25668, -18676, -10509,  -2251,
-    5023,  10412,  13326,  13561,
-   11318,   7147,   1841,  -3708,
-   -8662, -12373, -14479, -14946,
-  -14045, -12286, -10301,  -8714,
-   -8022,  -8498, -10141, -12681,
-  -15635, -18400, -20371, -21057,
-  -20177, -17716, -13933,  -9321,
-   -4522,   -218,   2986,   4665,
-    4643,   3019,    146,  -3438,
-   -7104, -10245, -12383, -13246,
-  -12815, -11313,  -9166,  -6914,
-   -5113,  -4228,  -4546,  -6126,
-   -8782, -12115, -15582, -18592,
-  -20605, -21229, -20286, -17844,
-  -14204,  -9855,  -5386,  -1399,
-    1597,   3255,   3446,   2266,
-      12,  -2879,  -5910,  -8613,
-  -10622, -11734, -11931, -11371,
-  -10349,  -9229,  -8371,  -8059,
-   -8448,  -9532, -11144, -12995,
-  -14720, -15955, -16402, -15886,
-  -14391, -12070,  -9215,  -6213,
-   -3480,  -1394,   -227,   -108,
-    -998,  -2703,  -4914,  -7254,
-   -9354, -10905, -11719, -11748,
-  -11092,  -9973,  -8690,  -7563,
-   -6871,  -6801,  -7415,  -8639,
-  -10276, -12041, -13615, -14698,
-  -15068, -14612, -13355, -11450,
-   -9153,  -6781,  -4659,  -3069,
-   -2200,  -2127,  -2798,  -4053,
-   -5653,  -7322,  -8803,  -9893,
-  -10479, -10551, -10200,  -9588,
-   -8922,  -8404,  -8198,  -8391,
-   -8983,  -9885, -10935, -11930,
-  -12663, -12964, -12730, -11946,
-  -10688,  -9115,  -7438,  -5890,
-   -4680,  -3968,  -3832,  -4260,
-   -5156,  -6356,  -7660,  -8863,
-   -9795, -10344, -10474, -10226,
-   -9708,  -9068,  -8472,  -8065,
-   -7948,  -8162,  -8676,  -9398,
-  -10194, -10910, -11402, -11561,
-  -11337, -10741,  -9848,  -8782,
-   -7694,  -6735,  -6036,  -5679,
-   -5691,  -6041,  -6647,  -7394,
-   -8153,  -8809,  -9276,  -9510,
-   -9517,  -9346,  -9073,  -8790,
-   -8577,  -8491,  -8545,  -8654,
-  -13419,    104,  10628,  17923,
-   22843,  26181,  28470,  30050,
-   31136,  31869,  32343,  32622,
-   32752,  32766,  32689,  32538,
-   32328,  32069,  31769,  31436,
-   31074,  30687,  30279,  29852,
-   29408,  28948,  28473,  27984,
-   27480,  26960,  26425,  25871,
-   25296,  24696,  24066,  23398,
-   22682,  21900,  21030,  20033,
-   18848,  17373,  15432,  12762,
-    9169,   5079,   1430,  -1505,
-   -4066,  -6668,  -9593, -12740,
-  -15560, -17663, -19102, -20077,
-  -20752, -21232, -21585, -21851,
-  -22060, -22230, -22376, -22511,
-  -22645, -22789, -22954, -23152,
-  -23402, -23724, -24148, -24711,
-  -25457, -26425, -27606, -28907,
-  -30151, -31179, -31929, -32415,
-  -32680, -32766, -32698, -32485,
-  -32118, -31560, -30732, -29497,
-  -27687, -25366, -23120, -21441,
-  -20295, -19485, -18867, -18349,
-  -17873, -17389, -16848, -16189,
-  -15337, -14254, -13063, -12030,
-  -11290, -10804, -10490, -10288,
-  -10159, -10079, -10033, -10012,
-  -10010, -10023, -10047, -10080,
-  -10122, -10170, -10226, -10288,
-  -10358, -10435, -10521, -10618,
-  -10728, -10856, -11008, -11194,
-  -11430, -11741, -12173, -12803,
-  -13745, -15064, -16526, -17697,
-  -18454, -18906, -19167, -19306,
-  -19362, -19355, -19296, -19186,
-  -19024, -18802, -18507, -18125,
-  -17650, -17104, -16564, -16148,
-  -15936, -15881, -15863, -15818,
-  -15745, -15659, -15569, -15480,
-  -15394, -15310, -15229, -15149,
-  -15069, -14989, -14907, -14822,
-  -14731, -14632, -14521, -14392,
-  -14237, -14043, -13786, -13428,
-  -12904, -12142, -11186, -10297,
-   -9670,  -9274,  -9028,  -8873,
-   -8775,  -8713,  -8676,  -8656,
-   -8649,  -8651,  -8660,  -8674,
-   -8691,  -8711,  -8732,  -8754,
-   -8774,  -8791,  -8801,  -8802,
-   -8787,  -8745,  -8666,  -8555,
-   -8444,  -8375,  -8357,  -8377,
-   -8423,  -8489,  -8570,  -8664,
-   -8770,  -8889,  -9022,  -9174,
-   -9350,  -9558,  -9812, -10134,
-  -10562, -11148, -11919, -12778,
-  -13557, -14196, -14702, -15088,
-  -15371, -15576, -15721, -15822,
-  -15893, -15939, -15967, -15982,
-  -15985, -15980, -15967, -15948,
-  -15924, -15895, -15862, -15825,
-  -15785, -15740, -15693, -15642,
-  -15587, -15528, -15465, -15398,
-  -15324, -15239, -15123, -14922,
-  -13419,  -6800,  11212,  21398,
-   26634,  29472,  31082,  32001,
-   32501,  32727,  32766,  32669,
-   32470,  32189,  31839,  31427,
-   30954,  30413,  29792,  29060,
-   28160,  26961,  25145,  21835,
-   15776,  10227,   7318,   5558,
-    4157,   2755,   1058,  -1368,
-   -5216, -10497, -15199, -18841,
-  -22526, -26542, -29678, -31471,
-  -32369, -32742, -32766, -32496,
-  -31878, -30662, -28092, -23287,
-  -19282, -17389, -16413, -15806,
-  -15369, -15018, -14711, -14426,
-  -14145, -13856, -13543, -13186,
-  -12752, -12179, -11344,  -9985,
-   -7746,  -5110,  -3390,  -2688,
-   -2809,  -4145,  -7033,  -8471,
-   -7483,  -5526,  -4019,  -3160,
-   -2686,  -2418,  -2263,  -2176,
-   -2131,  -2113,  -2111,  -2120,
-   -2132,  -2143,  -2146,  -2129,
-   -2076,  -1951,  -1674,  -1029,
-     569,   3389,   5015,   4974,
-    3862,   2526,   1657,   1144,
-     792,    502,    220,    -93,
-    -484,  -1022,  -1837,  -3147,
-   -5020,  -6828,  -8043,  -8823,
-   -9415, -10018, -10893, -12602,
-  -15258, -16941, -17633, -17913,
-  -18008, -17999, -17921, -17783,
-  -17579, -17284, -16829, -16093,
-  -15075, -14204, -13660, -13304,
-  -13028, -12775, -12506, -12176,
-  -11707, -10912,  -9324,  -6997,
-   -5456,  -4511,  -3613,  -2443,
-   -1045,     58,    696,   1034,
-    1206,   1281,   1296,   1267,
-    1204,   1110,    985,    821,
-     602,    293,   -181,   -951,
-   -2094,  -3735,  -5661,  -6752,
-   -7257,  -7523,  -7682,  -7786,
-   -7859,  -7915,  -7961,  -8005,
-   -8051,  -8107,  -8179,  -8283,
-   -8444,  -8713,  -9180,  -9925,
-  -10724, -11196, -11289, -10984,
-  -10040,  -8767,  -8077,  -7751,
-   -7550,  -7374,  -7157,  -6855,
-   -6556,  -6374,  -6281,  -6233,
-   -6211,  -6203,  -6206,  -6217,
-   -6236,  -6265,  -6307,  -6370,
-   -6472,  -6653,  -7029,  -7844,
-   -8787,  -9224,  -9359,  -9352,
-   -9241,  -9008,  -8591,  -7987,
-   -7425,  -7072,  -6878,  -6772,
-   -6723,  -6722,  -6780,  -6891,
-   -6978,  -6999,  -6971,  -6895,
-   -6747,  -6435,  -5783,  -5094,
-   -4775,  -4649,  -4600,  -4588,
-   -4596,  -4616,  -4646,  -4682,
-   -4724,  -4772,  -4826,  -4888,
-   -4957,  -5039,  -5136,  -5259,
-   -5424,  -5661,  -6011,  -6453,
-   -6901,  -7406,  -7768,  -7838,
-   -7755,  -6800,  -4958,  17269,
-   26188,  29871,  31586,  32400,
-   32731,  32766,  32598,  32270,
-   31790,  31130,  30191,  28660,
-   25278,  16637,  10620,   8202,
-    6502,   4629,   1743,  -3947,
-  -12732, -21579, -28476, -31535,
-  -32651, -32766, -31907, -28679,
-  -21087, -17427, -16163, -15512,
-  -15065, -14695, -14346, -13983,
-  -13573, -13063, -12349, -11160,
-   -8709,  -4497,  -3828,  -6833,
-   -4582,  -1048,    672,   1422,
-    1784,   1970,   2067,   2122,
-    2166,   2232,   2380,   2755,
-    3880,   7880,  12417,  13369,
-   12969,  11401,   7773,   3838,
-    1733,    269,  -1510,  -4493,
-   -7535,  -9205, -10392, -12203,
-  -16875, -20392, -21375, -21657,
-  -21678, -21559, -21336, -21009,
-  -20543, -19834, -18591, -16014,
-  -12170,  -9477,  -6703,  -1606,
-    1408,   3115,   5231,   7245,
-    8176,   8531,   8634,   8603,
-    8478,   8270,   7957,   7470,
-    6568,   4235,    -74,  -2319,
-   -4272,  -7242,  -9472, -10453,
-  -10939, -11237, -11475, -11753,
-  -12243, -13246, -14177, -14008,
-  -11900,  -8869,  -7848,  -7447,
-   -7209,  -7016,  -6815,  -6554,
-   -6138,  -5305,  -3467,  -1445,
-    -614,   -493,  -1066,  -3403,
-   -5502,  -6020,  -6052,  -5771,
-   -5035,  -4198,  -3796,  -3629,
-   -3551,  -3507,  -3470,  -3406,
-   -3233,  -2591,   -643,   -339,
-   -1783,  -2725,  -3129,  -3343,
-   -3485,  -3601,  -3711,  -3833,
-   -3989,  -4222,  -4643,  -5511,
-   -7123,  -9617, -10668, -10960,
-  -11017, -10952, -10776, -10427,
-   -9676,  -8194,  -6962,  -6384,
-   -6044,  -5736,  -5265,  -4020,
-   -2153,  -1489,  -1249,  -1124,
-   -1024,   -876,   -577,   -251,
-    -144,   -177,   -297,   -515,
-    -909,  -1766,  -4020,  -6505,
-   -7460,  -7838,  -8013,  -8099,
-   -8139,  -8151,  -8144,  -8122,
-   -8085,  -8029,  -7944,  -7791,
-   -7406,  -6293,  -5597,  -5395,
-   -5261,  -5104,  -4842,  -4273,
-   -3341,  -2786,  -2580,  -2512,
-   -2516,  -2580,  -2748,  -3239,
-   -4394,  -4959,  -5131,  -5199,
-   -5227,  -5233,  -5220,  -5176,
-   -5067,  -4943,  -4917,  -4985,
-   -5203,  -5662,  -5690,  -5019,
-   -4787,  -4733,  -4720,  -4721,
-   -4727,  -4737,  -4749,  -4763,
-   -4782,  -4807,  -4844,  -4908,
-   -5053,  -5494,  -5995,  -6115,
-   -6081,  -5877,  -4958,  -4581,
-   20748,  28470,  31243,  32371,
-   32766,  32751,  32444,  31855,
-   30839,  28716,  21245,  11692,
-    8677,   6405,   2673,  -5928,
-  -14006, -22443, -30236, -32766,
-  -32573, -27670, -19020, -16867,
-  -16081, -15588, -15154, -14675,
-  -14033, -12932, -10222,  -4163,
-   -3848, -10147,  -9955,  -5529,
-     122,   2356,   3196,   3587,
-    3831,   4105,   4746,   7505,
-   14818,  15983,  13416,   7473,
-    4563,   3321,   2417,   1382,
-    -373,  -4467, -11310, -20343,
-  -23493, -24270, -24394, -24172,
-  -23597, -22332, -18882, -13491,
-  -10836,  -8140,  -1230,   1922,
-    2942,   3645,   4609,   6845,
-   10055,  11258,  11346,  10767,
-    8870,   2179,  -4183,  -8883,
-  -10533, -11172, -11469, -11608,
-  -11647, -11590, -11356, -10481,
-   -6385,  -4616,  -6270,  -6951,
-   -6794,  -5775,  -2561,    319,
-    1120,   1168,    462,  -3195,
-   -6518,  -7195,  -7371,  -7389,
-   -7318,  -7149,  -6777,  -5798,
-   -4109,  -3670,  -3542,  -2083,
-   -1947,  -1968,  -2017,  -2080,
-   -2157,  -2257,  -2401,  -2646,
-   -3219,  -5517,  -8978,  -9715,
-   -9774,  -9298,  -7796,  -6986,
-   -6688,  -6480,  -6229,  -5738,
-   -3954,   -563,    288,    508,
-     556,    518,    402,    171,
-    -332,  -1744,  -4407,  -6331,
-   -8866,  -9326,  -9427,  -9452,
-   -9438,  -9395,  -9321,  -9205,
-   -9015,  -8641,  -7505,  -4403,
-   -2973,  -1360,    697,   1381,
-    1480,   1211,    467,   -113,
-    -532,  -1398,  -4022,  -5112,
-   -5418,  -5574,  -5709,  -5903,
-   -6348,  -7692,  -9123,  -9406,
-   -8950,  -6767,  -5591,  -5118,
-   -4521,  -4110,  -3960,  -3900,
-   -3878,  -3882,  -3935,  -4195,
-   -5530,  -5332,  -4468,  -4205,
-   -4112,  -4073,  -4056,  -4052,
-   -4058,  -4091,  -4109,  -2959,
-   -1897,  -1743,  -1786,  -1970,
-   -2482,  -3756,  -4574,  -4875,
-   -5072,  -5379,  -6517,  -7717,
-   -7948,  -7978,  -7927,  -7792,
-   -7494,  -7187,  -6960,  -6647,
-   -5911,  -3986,  -2285,  -1860,
-   -1729,  -1691,  -1696,  -1727,
-   -1780,  -1856,  -1973,  -2192,
-   -2884,  -4088,  -4588,  -4981,
-   -5537,  -6369,  -6683,  -6757,
-   -6750,  -6689,  -6550,  -6101,
-   -5160,  -4890,  -4801,  -4750,
-   -4709,  -4663,  -4594,  -4453,
-   -4068,  -3666,  -3821,  -4581,
-   -3910,  22828,  29617,  31842,
-   32630,  32766,  32490,  31808,
-   30367,  25500,  13226,   9566,
-    7273,   3617,  -6408, -21957,
-  -30712, -32766, -31601, -21897,
-  -17039, -15964, -15434, -15016,
-  -14589, -14069, -13325, -11988,
-  -10518, -10162,  -2418,   2693,
-    4250,   4875,   5210,   5508,
-    6089,   8542,  17419,  19453,
-   19089,  17209,  11220,   5071,
-     877,  -6311, -11272, -19359,
-  -24583, -25542, -25716, -25578,
-  -25218, -24595, -23483, -20940,
-  -12172,    -56,   3480,   6550,
-   11754,  14057,  14618,  14584,
-   14070,  12226,   4906,   1940,
-     747,   -901,  -5433,  -9475,
-  -10776, -11545, -12794, -12004,
-   -8831,  -8423,  -8285,  -8172,
-   -8038,  -7850,  -7534,  -6792,
-   -5042,  -7528,  -7771,  -7459,
-   -6793,  -4945,  -2001,   -856,
-    -248,    866,   5913,   8244,
-    8273,   7284,   3803,    720,
-    -341,  -1035,  -2026,  -5544,
-  -11407, -14260, -15090, -15274,
-  -15200, -14932, -14370, -13002,
-   -8536,  -1171,    976,   1627,
-    1949,   2201,   2612,   3843,
-    5047,   4717,   1201,  -1448,
-   -2233,  -3228,  -5976,  -8208,
-   -8795,  -8906,  -8660,  -6997,
-   -3486,  -3129,  -4074,  -5003,
-   -5218,  -5216,  -5067,  -4573,
-   -3036,  -4645,  -5399,  -5443,
-   -5398,  -5319,  -5199,  -4989,
-   -4504,  -3122,   -196,   2236,
-    2457,   1924,   -148,  -1844,
-   -2387,  -2695,  -3065,  -4212,
-   -7245,  -7992,  -8245,  -8545,
-   -9260,  -9573,  -9392,  -8671,
-   -6308,  -2352,   -660,   -260,
-    -116,    -66,    -66,   -107,
-    -202,   -444,  -1655,  -3235,
-   -3505,  -4033,  -5631,  -6835,
-   -7136,  -7182,  -7058,  -6433,
-   -4170,  -3518,  -3376,  -3341,
-   -3367,  -3534,  -3895,  -3768,
-   -2772,  -3415,  -4335,  -4445,
-   -4458,  -4446,  -4421,  -4381,
-   -4307,  -4128,  -3321,  -1618,
-   -1230,  -1184,  -2224,  -3068,
-   -3326,  -3466,  -3620,  -4019,
-   -5622,  -6218,  -6324,  -6335,
-   -6305,  -6239,  -6123,  -5879,
-   -4922,  -3295,  -2084,  -1847,
-   -1781,  -1771,  -1789,  -1831,
-   -1904,  -2046,  -2528,  -3811,
-   -4183,  -4470,  -5153,  -5541,
-   -5616,  -5605,  -5535,  -5319,
-   -4361,  -3868,  -3770,  -3734,
-   -3713,  -3692,  -3652,  -3527,
-   -3127,  -3301,  -3900,  -3983,
-   -3910,  -4171,  23663,  30104,
-   32119,  32764,  32766,  32309,
-   31241,  28161,  15285,   9873,
-    7171,   2204, -10999, -20195,
-  -29535, -32766, -29513, -18850,
-  -16789, -16116, -15651, -15162,
-  -14482, -13169,  -8975,  -7059,
-  -10499,  -9080,  -3584,   2466,
-    4335,   5101,   5780,   7784,
-   17205,  19629,  18291,  11774,
-    5931,   4132,   2909,   1006,
-   -5508, -20489, -25083, -26217,
-  -26394, -26061, -25104, -22328,
-  -14638,  -5144,    903,   2178,
-    2768,   3323,   4437,   8141,
-   12356,  11761,   3941,    833,
-   -2630,  -7595,  -8956,  -9282,
-   -9229,  -8696,  -5573,    868,
-    1470,      9,  -4586,  -6830,
-   -6691,  -3671,  -1987,  -6839,
-  -10496, -11037, -11146, -11108,
-  -10960, -10652,  -9964,  -7694,
-    1109,   5495,   3684,   2842,
-    2651,   2513,   2285,   1717,
-   -1077,  -6246,  -7137,  -7373,
-   -7446,  -7408,  -6920,  -7877,
-   -8577,  -4515,  -1842,  -1463,
-   -1399,  -1434,  -1533,  -1720,
-   -2126,  -3571,  -9002, -12021,
-  -12986, -11269,  -8222,  -7122,
-   -6585,  -5946,  -3487,    526,
-    1251,   1508,   1737,   2383,
-    3969,   4208,   3324,  -1288,
-   -6143,  -8302,  -8947,  -9188,
-   -9273,  -9259,  -9102,  -8260,
-   -5274,  -5489,  -5515,  -5424,
-   -5239,  -4814,  -3438,  -1347,
-   -2427,  -5065,  -5362,  -5306,
-   -4979,  -3877,  -3164,  -2866,
-   -2321,    562,   1936,   1910,
-    1258,   -800,  -2336,  -2925,
-   -3450,  -4854,  -8837,  -9848,
-  -10065, -10095, -10039,  -9911,
-   -9680,  -9182,  -7175,  -3879,
-   -1583,   -652,    115,    779,
-     897,    804,    352,  -2011,
-   -3144,  -3397,  -3533,  -3664,
-   -3863,  -4341,  -5788,  -6748,
-   -5086,  -4782,  -4744,  -4741,
-   -4750,  -4771,  -4828,  -5024,
-   -6264,  -7743,  -7800,  -7387,
-   -6220,  -4667,  -4036,  -3742,
-   -3315,  -1500,   -746,   -632,
-    -633,   -686,   -788,   -982,
-   -1478,  -2483,  -4557,  -5908,
-   -6849,  -7109,  -7176,  -7164,
-   -7089,  -6880,  -5836,  -4693,
-   -4405,  -4062,  -3878,  -3785,
-   -3655,  -3282,  -2610,  -3507,
-   -3887,  -3940,  -3956,  -3967,
-   -3987,  -4063,  -4172,  -3832,
-   -2796,  -2654,  -2709,  -2906,
-   -3494,  -4061,  -4256,  -4412,
-   -5015,  -5520,  -5438,  -5279,
-   -5118,  -4171, -10436,  22165,
-   29636,  32008,  32766,  32748,
-   32150,  30710,  26153,   9940,
-    2899, -10235, -22328, -25013,
-  -25890, -26192, -25863, -19985,
-  -17048, -20558, -21142, -19398,
-   -9750,   -611,    487,  -1999,
-  -14619, -18300, -19124, -19472,
-  -19715, -20077, -21272, -27795,
-  -27462, -16556,  -8739,  -4415,
-   -2846,  -2171,  -1899,  -2026,
-   -3665, -12811,  -9211,  -3304,
-   -2217,  -1966,  -1913,  -1844,
-   -1331,   3336,  10083,   7403,
-     414,  -8331, -14979, -16812,
-  -17903, -19997, -29217, -32379,
-  -32766, -32563, -31939, -30427,
-  -24929, -19233, -13536,  -5026,
-   -2379,   1387,   6099,   7849,
-    8149,   7597,   5186,  -6674,
-  -13561, -14928, -15334, -15438,
-  -15380, -15145, -14474, -11064,
-   -4250,  -2846,   -448,   -734,
-   -3806,  -5174,  -6058,  -7564,
-  -14224, -17317, -18012, -18421,
-  -19094, -21835, -24122, -23972,
-  -21277, -15057, -13633, -12723,
-  -11191,  -7762,  -4963,  -3714,
-   -1891,  -4911,  -7142,  -7460,
-   -7558,  -7601,  -7610,  -7556,
-   -7283,  -5483,   -814,  -2027,
-   -3877,  -4775,  -6332,  -9500,
-  -11653, -13075, -17668, -20287,
-  -20607, -20325, -18651, -17103,
-  -16611, -16098, -14373,  -9683,
-   -8678,  -8347,  -8092,  -7689,
-   -6675,  -5666,  -6168,  -9475,
-  -11741, -12045, -12089, -12053,
-  -11962, -11789, -11400,  -9885,
-   -4822,  -3073,  -2798,  -2866,
-   -3153,  -3808,  -5473,  -8125,
-  -11916, -14566, -15302, -16410,
-  -17252, -17377, -17306, -17042,
-  -16011, -12562, -11700, -11416,
-  -11199, -10872,  -9895,  -8818,
-   -7640,  -8217,  -9616,  -9702,
-   -9692,  -9674,  -9657,  -9635,
-   -9607,  -9508,  -7229,  -6669,
-   -6603,  -6641,  -6740,  -6917,
-   -7257,  -8094, -11120, -13966,
-  -14136, -13935, -13925, -13903,
-  -13839, -13680, -13095, -10744,
-  -10103,  -9987, -10022, -10402,
-  -10713, -10752, -10785, -11553,
-  -11944, -11384, -11150, -11021,
-  -10910, -10746, -10274,  -9567,
-   -7644,  -7090,  -7011,  -7028,
-   -7091,  -7194,  -7360,  -7690,
-   -8928, -11045, -12420, -13009,
-  -13190, -13233, -13205, -13102,
-  -12768, -11318, -10812, -10657,
-  -10415, -10240, -10206, -10214,
-  -10289, -10828, -11637, -11353,
-  -10755, -10499, -10426, -10490,
-  -10513, -10373, -10436,  -5333,
-   22790,  29483,  31832,  32678,
-   32766,  32275,  30978,  27191,
-   11007,  -9066, -17031, -18674,
-  -19078, -18983, -18485, -17247,
-  -12516,    567,   7496,  21480,
-   24871,  25158,  24487,  22943,
-   19613,   8618,  -5114, -11001,
-  -19197, -30109, -32334, -32766,
-  -32384, -30448, -20514, -15778,
-  -14289, -12290,  -4160,   1761,
-    2603,   2221,   -691, -10332,
-  -12560, -13217, -13809, -15638,
-  -23372, -25446, -23990, -16884,
-   -6112,  -1682,    431,   1633,
-    2746,   5671,  12362,  12627,
-    5587,   1779,   1039,    705,
-     445,    126,   -569,  -3982,
-   -6676,    103,   1690,   1937,
-    1930,   1812,   1601,   1280,
-     908,    601,  -5174,  -8594,
-  -10470, -11358, -11800, -12005,
-  -12002, -11455,  -7218,  -8214,
-   -8974,  -9080,  -9100,  -9117,
-   -9181,  -9429, -10729, -16339,
-  -16164, -12940, -12203, -11871,
-  -11547, -11084, -10182,  -6931,
-    -656,   2001,   1708,    463,
-     484,    514,    385,   -253,
-   -4284,  -7173,  -7458,  -6989,
-   -4467,  -3288,  -2968,  -2644,
-   -1577,   3111,   4459,   4569,
-    4330,   3418,    931,     -4,
-    -807,  -3136,  -8096, -10363,
-  -12203, -13103, -13291, -12373,
-  -10657,  -9879,  -6836,  -4232,
-   -3833,  -3755,  -3789,  -3922,
-   -4289,  -5829,  -7557, -11359,
-  -12642, -12834, -12812, -12691,
-  -12477, -12110, -11275,  -8342,
-   -4037,  -2351,   -773,    270,
-     721,    864,    791,    345,
-   -2235,  -5556,  -6153,  -6301,
-   -6333,  -6308,  -6230,  -6046,
-   -5448,  -2574,   -868,     45,
-     182,    152,     44,   -146,
-    -502,  -1609,  -4570,  -5824,
-   -7647,  -9053,  -9628,  -9843,
-   -9863,  -9639,  -8165,  -6317,
-   -5969,  -5690,  -4993,  -4803,
-   -4805,  -4905,  -5282,  -7289,
-   -8221,  -8385,  -8457,  -8683,
-   -9119,  -9092,  -8880,  -8163,
-   -6006,  -5240,  -4545,  -3698,
-   -3112,  -2558,  -2201,  -2280,
-   -3232,  -4664,  -4896,  -4963,
-   -4992,  -5015,  -5072,  -5359,
-   -5268,  -3925,  -3199,  -3098,
-   -3094,  -3121,  -3169,  -3232,
-   -3286,  -3446,  -4859,  -5354,
-   -5723,  -6251,  -6699,  -6903,
-   -6963,  -6913,  -6470,  -5672,
-   -5547,  -5516,  -5506,  -5506,
-   -5516,  -5547,  -5658,  -6324,
-   -6576,  -6460,  -6310,  -5333,
-       0,  11679,  18132,  23016,
-   26729,  29423,  31203,  32176,
-   32466,  32218,  31595,  30770,
-   29913,  29175,  28673,  28474,
-   28591,  28986,  29579,  30272,
-   30962,  31561,  32003,  32251,
-   32300,  32172,  31912,  31583,
-   31253,  30984,  30827,  30811,
-   30939,  31192,  31529,  31899,
-   32248,  32530,  32709,  32766,
-   32702,  32536,  32297,  32029,
-   31773,  31569,  31447,  31419,
-   31483,  31620,  31800,  31985,
-   32139,  32228,  32232,  32142,
-   31963,  31712,  31417,  31110,
-   30825,  30589,  30422,  30328,
-   30300,  30319,  30359,  30388,
-   30376,  30301,  30147,  29912,
-   29604,  29243,  28853,  28465,
-   28105,  27796,  27548,  27364,
-   27231,  27129,  27033,  26912,
-   26743,  26507,  26194,  25805,
-   25354,  24860,  24349,  23850,
-   23387,  22978,  22630,  22341,
-   22094,  21866,  21630,  21358,
-   21024,  20615,  20123,  19555,
-   18925,  18258,  17582,  16927,
-   16318,  15771,  15290,  14866,
-   14479,  14099,  13692,  13224,
-   12668,  12007,  11232,  10349,
-    9374,   8329,   7246,   6152,
-    5072,   4015,   2961,   1828,
-       0,  -1828,  -2961,  -4015,
-   -5072,  -6152,  -7246,  -8329,
-   -9374, -10349, -11232, -12007,
-  -12668, -13224, -13692, -14099,
-  -14479, -14866, -15290, -15771,
-  -16318, -16927, -17582, -18258,
-  -18925, -19555, -20123, -20615,
-  -21024, -21358, -21630, -21866,
-  -22094, -22341, -22630, -22978,
-  -23387, -23850, -24349, -24860,
-  -25354, -25805, -26194, -26507,
-  -26743, -26912, -27033, -27129,
-  -27231, -27364, -27548, -27796,
-  -28105, -28465, -28853, -29243,
-  -29604, -29912, -30147, -30301,
-  -30376, -30388, -30359, -30319,
-  -30300, -30328, -30422, -30589,
-  -30825, -31110, -31417, -31712,
-  -31963, -32142, -32232, -32228,
-  -32139, -31985, -31800, -31620,
-  -31483, -31419, -31447, -31569,
-  -31773, -32029, -32297, -32536,
-  -32702, -32766, -32709, -32530,
-  -32248, -31899, -31529, -31192,
-  -30939, -30811, -30827, -30984,
-  -31253, -31583, -31912, -32172,
-  -32300, -32251, -32003, -31561,
-  -30962, -30272, -29579, -28986,
-  -28591, -28474, -28673, -29175,
-  -29913, -30770, -31595, -32218,
-  -32466, -32176, -31203, -29423,
-  -26729, -23016, -18132, -11679,
-       0,      0,   3063,   8415,
-   14556,  20523,  25589,  29287,
-   31427,  32081,  31520,  30138,
-   28361,  26579,  25097,  24115,
-   23732,  23957,  24724,  25902,
-   27317,  28769,  30063,  31039,
-   31595,  31705,  31416,  30838,
-   30113,  29393,  28816,  28482,
-   28448,  28721,  29262,  29993,
-   30808,  31589,  32226,  32634,
-   32766,  32620,  32239,  31699,
-   31096,  30529,  30082,  29814,
-   29754,  29893,  30193,  30589,
-   31000,  31343,  31544,  31553,
-   31351,  30950,  30395,  29749,
-   29086,  28477,  27980,  27628,
-   27432,  27375,  27416,  27498,
-   27558,  27534,  27376,  27058,
-   26576,  25952,  25230,  24465,
-   23715,  23032,  22454,  21997,
-   21660,  21419,  21236,  21063,
-   20848,  20548,  20133,  19591,
-   18930,  18178,  17374,  16565,
-   15795,  15099,  14500,  14001,
-   13593,  13250,  12939,  12620,
-   12258,  11823,  11300,  10691,
-   10009,   9284,   8550,   7840,
-    7185,   6605,   6107,   5688,
-    5332,   5019,   4721,   4414,
-    4075,   3692,   3264,   2800,
-    2320,   1848,   1409,   1023,
-     702,    451,    264,    131,
-      43,      0,    -43,   -131,
-    -264,   -451,   -702,  -1023,
-   -1409,  -1848,  -2320,  -2800,
-   -3264,  -3692,  -4075,  -4414,
-   -4721,  -5019,  -5332,  -5688,
-   -6107,  -6605,  -7185,  -7840,
-   -8550,  -9284, -10009, -10691,
-  -11300, -11823, -12258, -12620,
-  -12939, -13250, -13593, -14001,
-  -14500, -15099, -15795, -16565,
-  -17374, -18178, -18930, -19591,
-  -20133, -20548, -20848, -21063,
-  -21236, -21419, -21660, -21997,
-  -22454, -23032, -23715, -24465,
-  -25230, -25952, -26576, -27058,
-  -27376, -27534, -27558, -27498,
-  -27416, -27375, -27432, -27628,
-  -27980, -28477, -29086, -29749,
-  -30395, -30950, -31351, -31553,
-  -31544, -31343, -31000, -30589,
-  -30193, -29893, -29754, -29814,
-  -30082, -30529, -31096, -31699,
-  -32239, -32620, -32766, -32634,
-  -32226, -31589, -30808, -29993,
-  -29262, -28721, -28448, -28482,
-  -28816, -29393, -30113, -30838,
-  -31416, -31705, -31595, -31039,
-  -30063, -28769, -27317, -25902,
-  -24724, -23957, -23732, -24115,
-  -25097, -26579, -28361, -30138,
-  -31520, -32081, -31427, -29287,
-  -25589, -20523, -14556,  -8415,
-   -3063,      0,      0,    142,
-    1442,   5080,  11185,  18567,
-   25317,  29771,  31213,  29975,
-   27040,  23517,  20260,  17757,
-   16202,  15617,  15959,  17157,
-   19093,  21574,  24301,  26886,
-   28933,  30137,  30379,  29748,
-   28504,  26988,  25530,  24392,
-   23747,  23682,  24207,  25268,
-   26742,  28440,  30124,  31539,
-   32464,  32766,  32432,  31568,
-   30367,  29057,  27853,  26924,
-   26377,  26254,  26538,  27154,
-   27979,  28850,  29587,  30025,
-   30046,  29605,  28743,  27572,
-   26244,  24921,  23739,  22796,
-   22144,  21785,  21680,  21754,
-   21905,  22015,  21970,  21683,
-   21108,  20253,  19178,  17975,
-   16747,  15591,  14579,  13751,
-   13117,  12660,  12339,  12098,
-   11872,  11596,  11217,  10703,
-   10052,   9290,   8463,   7628,
-    6837,   6129,   5526,   5035,
-    4646,   4341,   4093,   3876,
-    3660,   3423,   3150,   2840,
-    2500,   2149,   1808,   1496,
-    1226,   1003,    827,    691,
-     587,    506,    440,    382,
-     328,    273,    217,    164,
-     115,     75,     44,     24,
-      11,      5,      2,      1,
-       0,      0,      0,      0,
-       0,     -1,     -2,     -5,
-     -11,    -24,    -44,    -75,
-    -115,   -164,   -217,   -273,
-    -328,   -382,   -440,   -506,
-    -587,   -691,   -827,  -1003,
-   -1226,  -1496,  -1808,  -2149,
-   -2500,  -2840,  -3150,  -3423,
-   -3660,  -3876,  -4093,  -4341,
-   -4646,  -5035,  -5526,  -6129,
-   -6837,  -7628,  -8463,  -9290,
-  -10052, -10703, -11217, -11596,
-  -11872, -12098, -12339, -12660,
-  -13117, -13751, -14579, -15591,
-  -16747, -17975, -19178, -20253,
-  -21108, -21683, -21970, -22015,
-  -21905, -21754, -21680, -21785,
-  -22144, -22796, -23739, -24921,
-  -26244, -27572, -28743, -29605,
-  -30046, -30025, -29587, -28850,
-  -27979, -27154, -26538, -26254,
-  -26377, -26924, -27853, -29057,
-  -30367, -31568, -32432, -32766,
-  -32464, -31539, -30124, -28440,
-  -26742, -25268, -24207, -23682,
-  -23747, -24392, -25530, -26988,
-  -28504, -29748, -30379, -30137,
-  -28933, -26886, -24301, -21574,
-  -19093, -17157, -15959, -15617,
-  -16202, -17757, -20260, -23517,
-  -27040, -29975, -31213, -29771,
-  -25317, -18567, -11185,  -5080,
-   -1442,   -142,      0,      0,
-       0,     25,    452,   2773,
-    8886,  18118,  26290,  29308,
-   26704,  21076,  15294,  10858,
-    8021,   6497,   5971,   6276,
-    7411,   9475,  12545,  16490,
-   20801,  24620,  27039,  27539,
-   26243,  23790,  20982,  18469,
-   16632,  15639,  15540,  16344,
-   18036,  20545,  23667,  27012,
-   30016,  32077,  32766,  32003,
-   30078,  27514,  24863,  22559,
-   20868,  19907,  19695,  20188,
-   21281,  22796,  24459,  25919,
-   26808,  26850,  25954,  24251,
-   22041,  19678,  17472,  15626,
-   14238,  13319,  12828,  12687,
-   12787,  12991,  13141,  13080,
-   12690,  11930,  10850,   9572,
-    8248,   7011,   5949,   5098,
-    4458,   4000,   3686,   3475,
-    3321,   3181,   3013,   2792,
-    2507,   2170,   1811,   1462,
-    1151,    895,    696,    549,
-     443,    368,    315,    275,
-     243,    213,    183,    151,
-     119,     89,     63,     42,
-      27,     17,     11,      7,
-       5,      3,      2,      2,
-       1,      1,      1,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -1,     -1,     -2,
-      -2,     -3,     -5,     -7,
-     -11,    -17,    -27,    -42,
-     -63,    -89,   -119,   -151,
-    -183,   -213,   -243,   -275,
-    -315,   -368,   -443,   -549,
-    -696,   -895,  -1151,  -1462,
-   -1811,  -2170,  -2507,  -2792,
-   -3013,  -3181,  -3321,  -3475,
-   -3686,  -4000,  -4458,  -5098,
-   -5949,  -7011,  -8248,  -9572,
-  -10850, -11930, -12690, -13080,
-  -13141, -12991, -12787, -12687,
-  -12828, -13319, -14238, -15626,
-  -17472, -19678, -22041, -24251,
-  -25954, -26850, -26808, -25919,
-  -24459, -22796, -21281, -20188,
-  -19695, -19907, -20868, -22559,
-  -24863, -27514, -30078, -32003,
-  -32766, -32077, -30016, -27012,
-  -23667, -20545, -18036, -16344,
-  -15540, -15639, -16632, -18469,
-  -20982, -23790, -26243, -27539,
-  -27039, -24620, -20801, -16490,
-  -12545,  -9475,  -7411,  -6276,
-   -5971,  -6497,  -8021, -10858,
-  -15294, -21076, -26704, -29308,
-  -26290, -18118,  -8886,  -2773,
-    -452,    -25,      0,      0,
-       0,      0,      0,      2,
-     113,   1635,   8400,  19758,
-   25360,  20480,  11890,   5691,
-    2591,   1292,    796,    656,
-     735,   1077,   1894,   3610,
-    6766,  11537,  16992,  21073,
-   21979,  19675,  15705,  11769,
-    8778,   6901,   5991,   5904,
-    6629,   8313,  11213,  15519,
-   21026,  26789,  31204,  32766,
-   31040,  26917,  21934,  17379,
-   13900,  11622,  10429,  10175,
-   10770,  12157,  14237,  16737,
-   19121,  20663,  20737,  19181,
-   16413,  13177,  10155,   7728,
-    5979,   4829,   4142,   3800,
-    3705,   3772,   3912,   4017,
-    3974,   3707,   3217,   2586,
-    1939,   1377,    948,    650,
-     456,    335,    261,    217,
-     189,    170,    154,    136,
-     114,     89,     64,     42,
-      26,     15,      8,      5,
-       3,      2,      1,      1,
-       1,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -1,     -1,     -2,
-      -3,     -5,     -8,    -15,
-     -26,    -42,    -64,    -89,
-    -114,   -136,   -154,   -170,
-    -189,   -217,   -261,   -335,
-    -456,   -650,   -948,  -1377,
-   -1939,  -2586,  -3217,  -3707,
-   -3974,  -4017,  -3912,  -3772,
-   -3705,  -3800,  -4142,  -4829,
-   -5979,  -7728, -10155, -13177,
-  -16413, -19181, -20737, -20663,
-  -19121, -16737, -14237, -12157,
-  -10770, -10175, -10429, -11622,
-  -13900, -17379, -21934, -26917,
-  -31040, -32766, -31204, -26789,
-  -21026, -15519, -11213,  -8313,
-   -6629,  -5904,  -5991,  -6901,
-   -8778, -11769, -15705, -19675,
-  -21979, -21073, -16992, -11537,
-   -6766,  -3610,  -1894,  -1077,
-    -735,   -656,   -796,  -1292,
-   -2591,  -5691, -11890, -20480,
-  -25360, -19758,  -8400,  -1635,
-    -113,     -2,      0,      0,
-       0,      0,      0,      0,
-       0,      0,     33,   1436,
-   10250,  18189,  11131,   3192,
-     587,     96,     19,      6,
-       4,      5,     13,     47,
-     206,    874,   2978,   7249,
-   11886,  13093,  10151,   6049,
-    3117,   1589,    914,    661,
-     639,    834,   1403,   2789,
-    5885,  11825,  20629,  29288,
-   32766,  28936,  20857,  13030,
-    7633,   4570,   3029,   2361,
-    2232,   2543,   3359,   4828,
-    7001,   9507,  11361,  11454,
-    9575,   6693,   4042,   2222,
-    1186,    658,    403,    283,
-     232,    219,    228,    248,
-     264,    257,    219,    158,
-      96,     50,     23,     10,
-       4,      2,      1,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -2,     -4,    -10,
-     -23,    -50,    -96,   -158,
-    -219,   -257,   -264,   -248,
-    -228,   -219,   -232,   -283,
-    -403,   -658,  -1186,  -2222,
-   -4042,  -6693,  -9575, -11454,
-  -11361,  -9507,  -7001,  -4828,
-   -3359,  -2543,  -2232,  -2361,
-   -3029,  -4570,  -7633, -13030,
-  -20857, -28936, -32766, -29288,
-  -20629, -11825,  -5885,  -2789,
-   -1403,   -834,   -639,   -661,
-    -914,  -1589,  -3117,  -6049,
-  -10151, -13093, -11886,  -7249,
-   -2978,   -874,   -206,    -47,
-     -13,     -5,     -4,     -6,
-     -19,    -96,   -587,  -3192,
-  -11131, -18189, -10250,  -1436,
-     -33,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      1,     30,    448,
-    3585,  14460,  29511,  32766,
-   22481,  11236,   4897,   2207,
-    1177,    805,    715,    783,
-     949,   1108,   1074,    756,
-     348,     98,     17,      2,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,     -2,    -17,    -98,
-    -348,   -756,  -1074,  -1108,
-    -949,   -783,   -715,   -805,
-   -1177,  -2207,  -4897, -11236,
-  -22481, -32766, -29511, -14460,
-   -3585,   -448,    -30,     -1,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       2,    203,   5003,  25765,
-   32766,  13789,   2803,    416,
-      67,     16,      7,      5,
-       6,     10,     14,     13,
-       6,      1,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,     -1,     -6,    -13,
-     -14,    -10,     -6,     -5,
-      -7,    -16,    -67,   -416,
-   -2803, -13789, -32766, -25765,
-   -5003,   -203,     -2,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    5925,   7696,   9104,  10369,
-   11562,  12690,  13936,  15484,
-   17199,  18774,  20109,  21288,
-   22299,  23101,  23867,  24803,
-   25788,  26484,  26820,  27059,
-   27398,  27744,  27893,  27712,
-   27130,  26207,  25209,  24386,
-   23641,  22624,  21183,  19497,
-   17736,  15824,  13667,  11388,
-    9146,   6851,   4273,   1434,
-   -1321,  -3729,  -5925,  -8226,
-  -10715, -13264, -15857, -18571,
-  -21183, -23189, -24446, -25471,
-  -26820, -28410, -29814, -30933,
-  -31919, -32634, -32767, -32448,
-  -32188, -32147, -31961, -31381,
-  -30577, -29720, -28740, -27685,
-  -26820, -26141, -25251, -23944,
-  -22525, -21297, -20151, -18913,
-  -17694, -16570, -15320, -13811,
-  -12325, -11166, -10220,  -9249,
-   -8299,  -7500,  -6731,  -5863,
-   -5078,  -4599,  -4315,  -4005,
-   -3736,  -3688,  -3778,  -3793,
-   -3736,  -3740,  -3778,  -3753,
-   -3736,  -3854,  -4047,  -4184,
-   -4273,  -4346,  -4315,  -4150,
-   -4005,  -3945,  -3778,  -3376,
-   -2931,  -2655,  -2436,  -2070,
-   -1589,  -1104,   -557,     67,
-     557,    798,   1052,   1567,
-    2168,   2583,   2931,   3459,
-    4047,   4447,   4810,   5444,
-    6194,   6608,   6689,   6925,
-    7536,   8185,   8568,   8819,
-    9146,   9468,   9641,   9752,
-    9952,  10216,  10447,  10633,
-   10757,  10707,  10447,  10133,
-    9952,   9914,   9910,   9844,
-    9683,   9472,   9373,   9552,
-    9952,  10305,  10447,  10517,
-   10757,  11216,  11789,  12428,
-   13173,  13981,  14741,  15475,
-   16393,  17631,  19036,  20345,
-   21493,  22577,  23599,  24466,
-   25251,  26197,  27356,  28458,
-   29277,  29919,  30577,  31212,
-   31693,  32071,  32456,  32750,
-   32767,  32523,  32188,  31828,
-   31424,  30965,  30309,  29148,
-   27398,  25427,  23599,  21821,
-   19883,  17927,  16083,  13938,
-   11025,   7701,   4810,   2532,
-     289,  -2202,  -4583,  -6729,
-   -9104, -11898, -14515, -16430,
-  -17962, -19670, -21493, -23009,
-  -24135, -25063, -25788, -26230,
-  -26551, -26912, -27130, -26969,
-  -26551, -26098, -25519, -24635,
-  -23599, -22669, -21762, -20623,
-  -19304, -18067, -16930, -15676,
-  -14204, -12566, -10757,  -8804,
-   -6957,  -5481,  -4315,  -3170,
-   -1857,   -302,   1589,   3777,
-    5925,   8089,  11729,  14765,
-   17048,  18973,  21167,  23894,
-   26799,  29155,  30394,  30565,
-   30360,  30560,  31369,  32321,
-   32767,  32315,  30906,  28810,
-   26621,  24942,  23850,  22841,
-   21378,  19324,  16819,  14063,
-   11379,   9142,   7379,   5637,
-    3502,   1067,  -1318,  -3491,
-   -5419,  -7007,  -8324,  -9811,
-  -11819, -14030, -15765, -16833,
-  -17654, -18594, -19625, -20695,
-  -21976, -23509, -24959, -25962,
-  -26544, -27020, -27631, -28419,
-  -29312, -30180, -30927, -31579,
-  -32187, -32638, -32767, -32633,
-  -32465, -32287, -31886, -31228,
-  -30603, -30180, -29690, -28770,
-  -27432, -25967, -24554, -23153,
-  -21659, -19998, -18195, -16482,
-  -15129, -14030, -12692, -10864,
-   -8924,  -7359,  -6123,  -4895,
-   -3767,  -3145,  -3007,  -2789,
-   -2145,  -1390,   -997,  -1033,
-   -1305,  -1741,  -2308,  -2789,
-   -3001,  -3145,  -3627,  -4544,
-   -5564,  -6305,  -6704,  -7002,
-   -7518,  -8412,  -9535, -10513,
-  -11062, -11221, -11218, -11215,
-  -11295, -11572, -12093, -12620,
-  -12738, -12274, -11501, -10864,
-  -10577, -10519, -10437, -10162,
-   -9687,  -9114,  -8552,  -8055,
-   -7648,  -7359,  -7176,  -7002,
-   -6718,  -6305,  -5872,  -5598,
-   -5630,  -5954,  -6297,  -6300,
-   -5928,  -5603,  -5755,  -6300,
-   -6789,  -7007,  -7146,  -7353,
-   -7464,  -7359,  -7315,  -7704,
-   -8455,  -9114,  -9399,  -9460,
-   -9571,  -9816, -10141, -10513,
-  -10905, -11221, -11401, -11566,
-  -11946, -12625, -13413, -14024,
-  -14388, -14732, -15312, -16131,
-  -17010, -17892, -18886, -19993,
-  -20991, -21754, -22499, -23504,
-  -24668, -25616, -26203, -26664,
-  -27210, -27723, -27993, -28068,
-  -28181, -28425, -28671, -28770,
-  -28680, -28425, -28065, -27717,
-  -27492, -27371, -27230, -27015,
-  -26806, -26669, -26533, -26313,
-  -26077, -25967, -25977, -25962,
-  -25898, -25967, -26279, -26664,
-  -26893, -27020, -27281, -27717,
-  -28130, -28425, -28734, -29122,
-  -29409, -29478, -29533, -29824,
-  -30254, -30531, -30639, -30877,
-  -31398, -31936, -32118, -31930,
-  -31749, -31936, -32412, -32633,
-  -32026, -30531, -28660, -27015,
-  -25821, -24914, -23946, -22451,
-  -19970, -16487, -12690,  -9460,
-   -7042,  -4901,  -2386,    721,
-    4295,   8089,   9195,  13300,
-   16725,  18988,  20602,  22494,
-   24924,  27502,  29870,  31776,
-   32767,  32503,  31296,  29836,
-   28489,  27217,  25949,  24512,
-   22429,  19354,  15611,  11832,
-    8170,   4400,    640,  -2643,
-   -5375,  -8061, -11123, -14482,
-  -17851, -20992, -23599, -25374,
-  -26406, -27145, -27877, -28569,
-  -29258, -30146, -31085, -31419,
-  -30684, -29238, -27877, -26991,
-  -26406, -25883, -25382, -24812,
-  -23911, -22570, -21104, -19972,
-  -19277, -18697, -17896, -16844,
-  -15712, -14625, -13618, -12700,
-  -11791, -10705,  -9340,  -7845,
-   -6444,  -5186,  -3993,  -2861,
-   -1810,   -702,    640,   2149,
-    3536,   4588,   5274,   5616,
-    5675,   5631,   5630,   5585,
-    5318,   4838,   4204,   3250,
-    1754,   -173,  -2211,  -4270,
-   -6444,  -8586, -10410, -12029,
-  -13930, -16329, -18965, -21542,
-  -23911, -25775, -26807, -27246,
-  -27832, -28901, -30016, -30709,
-  -31041, -31129, -30729, -29720,
-  -28545, -27641, -26807, -25645,
-  -24268, -23029, -21817, -20208,
-  -18208, -16280, -14687, -13252,
-  -11791, -10354,  -8984,  -7579,
-   -6088,  -4615,  -3280,  -2112,
-   -1097,   -199,    640,   1425,
-    2110,   2749,   3491,   4318,
-    4962,   5236,   5274,   5299,
-    5318,   5206,   4917,   4477,
-    3892,   3200,   2422,   1409,
-     -28,  -1740,  -3280,  -4490,
-   -5731,  -7370,  -9340, -11421,
-  -13574, -15723, -17539, -18848,
-  -19990, -21378, -22886, -24099,
-  -24981, -25856, -26807, -27533,
-  -27832, -27870, -27877, -27885,
-  -27832, -27711, -27520, -27217,
-  -26763, -26145, -25382, -24580,
-  -23911, -23410, -22886, -22181,
-  -21416, -20820, -20391, -19910,
-  -19277, -18657, -18252, -18050,
-  -17851, -17524, -17183, -17047,
-  -17138, -17228, -17183, -17198,
-  -17495, -17942, -18252, -18471,
-  -18921, -19662, -20391, -20917,
-  -21416, -22088, -22886, -23719,
-  -24624, -25586, -26451, -27163,
-  -27832, -28471, -28946, -29334,
-  -29971, -30942, -31798, -32050,
-  -31753, -31412, -31442, -31885,
-  -32466, -32767, -32511, -31813,
-  -31041, -30432, -30016, -29847,
-  -29971, -30094, -29659, -28431,
-  -26763, -25194, -23956, -22866,
-  -21416, -19044, -15757, -12435,
-  -10009,  -8286,  -6132,  -2886,
-    1041,   5078,   9195,   5291,
-    5439,   5112,   5437,   6625,
-    8053,   9113,   9759,  10359,
-   11214,  12314,  13479,  14627,
-   15827,  17116,  18320,  19162,
-   19655,  20317,  21756,  23964,
-   26171,  27519,  27772,  27431,
-   27329,  28052,  29437,  30632,
-   30989,  30720,  30289,  29565,
-   28512,  28319,  30200,  32767,
-   32553,  28319,  23296,  21563,
-   23313,  25385,  25458,  23697,
-   21031,  18183,  16253,  15961,
-   15996,  14181,  10616,   7692,
-    6546,   5645,   3660,   1556,
-     542,   -222,  -2209,  -5112,
-   -7506,  -9025, -10467, -12314,
-  -14307, -15961, -16717, -16315,
-  -15776, -17028, -20513, -24051,
-  -25188, -23964, -22369, -21917,
-  -22845, -24764, -26666, -26985,
-  -25179, -22897, -22203, -22984,
-  -23458, -22897, -22220, -21917,
-  -21057, -18895, -16231, -14448,
-  -13958, -14094, -13943, -12847,
-  -10610,  -7692,  -5008,  -3244,
-   -2385,  -1823,   -763,   1290,
-    4078,   6712,   8505,   9559,
-   10375,  11247,  12367,  14094,
-   16524,  18983,  20494,  20763,
-   20404,  20317,  21061,  22630,
-   24477,  25918,  26680,  26898,
-   26590,  25652,  24532,  24230,
-   25157,  26452,  26849,  25831,
-   23734,  21384,  19995,  20496,
-   22131,  22451,  19790,  15427,
-   12258,  11514,  11771,  11159,
-    9431,   7512,   5897,   4224,
-    2114,   -222,  -2314,  -4045,
-   -5694,  -7425,  -9044, -10447,
-  -11948, -13827, -15837, -17649,
-  -19386, -21029, -21807, -21384,
-  -21343, -23697, -27586, -29386,
-  -27245, -23964, -23769, -27252,
-  -31214, -32767, -31737, -29386,
-  -26865, -25297, -25595, -27252,
-  -28378, -27698, -25866, -24318,
-  -23570, -23163, -22602, -21650,
-  -20136, -18095, -15955, -14181,
-  -12885, -11960, -11314, -10713,
-   -9738,  -8225,  -6540,  -5112,
-   -3945,  -2890,  -2082,  -1644,
-   -1137,     43,   1606,   2357,
-    1721,    844,   1450,   3690,
-    5811,   6179,   5045,   3957,
-    3905,   4578,   5114,   5024,
-    4521,   4311,   4854,   5558,
-    5223,   3778,   2860,   3690,
-    4959,   4311,   1808,    222,
-    1343,   3511,   3883,   2090,
-     321,    310,   1483,   2090,
-    1268,   -222,   -885,    -43,
-    1333,   1644,    667,    -43,
-     750,   2177,   2417,   1290,
-     570,   1644,   3799,   5291,
-    3993,   5339,   5830,   5741,
-    5577,   5666,   6147,   6902,
-    7479,   7435,   6781,   5870,
-    4944,   4053,   3295,   2832,
-    2725,   2922,   3295,   3611,
-    3676,   3649,   3929,   4584,
-    5261,   5792,   6464,   7391,
-    8113,   8226,   8048,   8186,
-    8746,   9397,   9950,  10461,
-   10965,  11439,  11851,  11990,
-   11599,  10960,  10900,  11779,
-   12866,  13267,  13119,  13290,
-   14134,  15182,  15971,  16578,
-   17303,  18270,  19457,  20835,
-   22373,  23945,  25161,  25410,
-   24591,  23859,  24844,  27591,
-   29979,  30078,  28647,  28249,
-   29979,  32187,  32767,  31752,
-   30929,  31361,  32133,  31659,
-   29662,  27459,  26428,  26627,
-   27127,  27328,  27379,  27409,
-   27127,  26482,  26112,  26559,
-   27444,  27980,  28013,  27848,
-   27127,  24614,  19457,  12398,
-    5577,   1148,   -190,     87,
-   -1076,  -6409, -16035, -26585,
-  -32767, -30750, -21106,  -8847,
-    -126,   1935,  -1141,  -5100,
-   -6147,  -2872,   3612,  10612,
-   15401,  16902,  16288,  15814,
-   16986,  19785,  23259,  26384,
-   28394,  28738,  27062,  23379,
-   18253,  12661,   7414,   2730,
-   -1393,  -4445,  -5577,  -4796,
-   -3612,  -4084,  -7162, -11950,
-  -16288, -17972, -16035, -11532,
-   -7098,  -5179,  -6211,  -8311,
-   -8682,  -5546,    760,   8130,
-   14134,  17489,  18506,  18448,
-   18570,  19445,  20724,  21483,
-   21106,  19932,  18823,  18122,
-   17303,  15623,  12802,   9121,
-    5261,   2086,    126,   -939,
-   -2027,  -3792,  -6211,  -8881,
-  -11217, -12375, -11599,  -9025,
-   -5830,  -3337,  -2092,  -1744,
-   -1393,      2,   2978,   6971,
-   10648,  13068,  14386,  15395,
-   16669,  18196,  19457,  19773,
-   18887,  17284,  15654,  14105,
-   12232,   9843,   7098,   4070,
-     824,  -2142,  -4310,  -6114,
-   -8682, -12231, -15401, -16614,
-  -15654, -13639, -11915, -11204,
-  -11217, -10762,  -8746,  -5453,
-   -2344,   -351,   1076,   2929,
-    5261,   7346,   8682,   9342,
-    9697,  10172,  10900,  11340,
-   10648,   8733,   6464,   4587,
-    3042,   1603,    443,   -449,
-   -1710,  -3736,  -5894,  -7260,
-   -7731,  -7769,  -7479,  -6671,
-   -5513,  -4400,  -3359,  -2206,
-   -1076,   -183,    760,   2214,
-    3993,  11636,  19174,  22048,
-   19199,  11636,   2690,  -3062,
-   -2253,   5205,  16195,  26336,
-   32216,  32767,  29435,  25111,
-   22251,  21436,  21337,  19905,
-   15881,   9799,   3882,    612,
-     839,   3062,   4569,   3368,
-    -651,  -5818,  -9723, -10718,
-   -9106,  -7043,  -7044, -10411,
-  -16718, -24192, -30328, -32767,
-  -30499, -24498, -16994, -10105,
-   -5203,  -3062,  -3836,  -6737,
-  -10223, -12861, -13912, -13168,
-  -10661,  -6737,  -2113,   2449,
-    6491,   9799,  12188,  13474,
-   13576,  12555,  10684,   8574,
-    7063,   6737,   7437,   8268,
-    8126,   6430,   3596,    918,
-    -182,    918,   3586,   6124,
-    6502,   3368,  -3020, -10718,
-  -17193, -20823, -21518, -20211,
-  -18104, -16230, -15145, -14699,
-  -14316, -13780, -13639, -14699,
-  -17198, -20517, -23472, -24804,
-  -23742, -20517, -16324, -12555,
-   -9975,  -8574,  -7905,  -7349,
-   -6311,  -4593,  -2644,  -1224,
-    -782,  -1224,  -2158,  -3062,
-   -3321,  -2449,   -457,   2143,
-    4716,   6737,   7737,   7349,
-    5612,   3062,    353,  -2143,
-   -4330,  -6124,  -7376,  -7962,
-   -7833,  -7043,  -5869,  -4899,
-   -4841,  -6124,  -8613, -11636,
-  -14303, -15924, -16337, -15924,
-  -15313, -15005, -15113, -15311,
-  -15014, -13780, -11671,  -9187,
-   -6741,  -4287,  -1621,    918,
-    2339,   1837,   -239,  -2449,
-   -3305,  -2143,    885,   5205,
-    9855,  13474,  14868,  13780,
-   10936,   7349,   3862,   1224,
-     -12,      0,    426,    612,
-     679,    918,    947,      0,
-   -2074,  -4593,  -6770,  -8268,
-   -9097,  -9493,  -9968, -11024,
-  -12601, -14086, -14940, -15005,
-  -14226, -12555, -10369,  -8574,
-   -8005,  -8880, -10897, -13474,
-  -15749, -16842, -16511, -15311,
-  -13859, -12249, -10451,  -8880,
-   -8110,  -8268,  -9104, -10411,
-  -11946, -13168, -13565, -13168,
-  -12352, -11330, -10234,  -9493,
-   -9526, -10105, -10578, -10718,
-  -10877, -11330, -12052, -13168,
-  -14954, -17149, -18822, -19292,
-  -18796, -18067, -17640, -17761,
-  -18498, -19598, -20607, -21436,
-  -22472, -23886, -25231, -26029,
-  -26329, -26336, -25942, -25111,
-  -24342, -24192, -24585, -25111,
-  -25688, -26336, -26509, -25417,
-  -22901, -19292, -14381,  -7349,
-    1876,  11636,  10149,  10506,
-    6253,  -1243,  -8535,  -9911,
-   -2504,   9604,  19199,  22818,
-   21727,  17990,  13068,   9584,
-   10632,  16195,  22411,  25470,
-   24938,  22811,  20951,  20375,
-   21727,  24918,  28542,  30629,
-   30193,  27692,  24162,  20493,
-   17639,  16886,  19199,  24143,
-   29609,  32767,  31461,  25357,
-   16471,   8627,   5478,   8148,
-   14428,  20247,  22119,  18931,
-   12384,   5936,   2558,   2793,
-    4794,   6101,   5186,   1856,
-   -2796,  -6690,  -7951,  -6405,
-   -3672,  -1785,  -2112,  -5181,
-  -10387, -15744, -19045, -19717,
-  -18853, -17419, -15542, -13724,
-  -13306, -15032, -18169, -21592,
-  -24692, -26729, -26636, -24475,
-  -22065, -21158, -21672, -22416,
-  -22649, -22197, -21089, -20078,
-  -20605, -23069, -25760, -26484,
-  -24692, -21285, -17293, -13835,
-  -12430, -13819, -16709, -18851,
-  -19145, -17934, -15833, -13409,
-  -11555, -10846, -10578,  -9493,
-   -7467,  -5654,  -5031,  -5608,
-   -6883,  -8173,  -8535,  -7298,
-   -4840,  -2230,    -68,   1724,
-    3042,   3307,   2266,    509,
-   -1044,  -1758,  -1236,    803,
-    4210,   8069,  11025,  12041,
-   10924,   8278,   5186,   2996,
-    3042,   5877,  10441,  14347,
-   15596,  14130,  11609,   9871,
-    9757,  10915,  12193,  12436,
-   11508,  10525,  10733,  12257,
-   14136,  15284,  15112,  13643,
-   11508,   9548,   8105,   7045,
-    6545,   7098,   8397,   9158,
-    8589,   7174,   5478,   3298,
-     706,  -1339,  -2404,  -3340,
-   -4548,  -4906,  -3864,  -3189,
-   -4840,  -8231, -11454, -14047,
-  -16518, -18279, -18461, -18005,
-  -18561, -19861, -20505, -20749,
-  -22065, -24392, -26344, -27732,
-  -29363, -30705, -30431, -29080,
-  -28488, -28785, -28679, -28454,
-  -29655, -31842, -32767, -32016,
-  -31407, -31521, -31015, -29706,
-  -29072, -29167, -28387, -26925,
-  -27028, -28968, -30139, -29115,
-  -27320, -25868, -24300, -23203,
-  -24108, -25723, -24592, -20967,
-  -19437, -21833, -24300, -23832,
-  -22649, -22908, -22256, -18931,
-  -16518, -18398, -21381, -20613,
-  -17686, -17731, -20797, -22447,
-  -21481, -20635, -20213, -17410,
-  -12430,  -9448, -10286, -12079,
-  -12430, -12327, -12622, -12149,
-  -10971, -11219, -12622, -11087,
-   -4256,   4550,  10149,  14763,
-   17793,  13977,   7115,   2761,
-    5130,  14549,  25952,  31623,
-   28007,  19407,  13519,  14192,
-   19754,  26551,  31558,  32767,
-   30213,  26837,  26070,  28194,
-   30553,  31123,  30239,  29052,
-   28183,  27980,  28457,  28766,
-   28040,  26837,  26551,  27337,
-   27672,  25980,  22006,  17049,
-   13613,  13977,  17743,  21336,
-   21201,  17121,  11497,   6476,
-    3239,   2832,   5199,   7619,
-    6516,   1404,  -4394,  -7240,
-   -6254,  -3168,   -802,  -1810,
-   -7063, -14313, -19439, -19814,
-  -16276, -12027, -10255, -12384,
-  -17244, -21743, -23362, -22386,
-  -21179, -21457, -22995, -24672,
-  -25635, -25458, -24260, -22957,
-  -22584, -23172, -23907, -24386,
-  -24943, -25743, -26318, -26101,
-  -24805, -22314, -19025, -16385,
-  -16152, -18599, -21827, -23243,
-  -21607, -17742, -13735, -11526,
-  -11712, -13170, -13867, -12384,
-   -9037,  -5740,  -4585,  -6097,
-   -8650,  -9740,  -7957,  -3811,
-     917,   4261,   4981,   3332,
-    1103,    260,   1328,   3332,
-    5127,   6262,   6835,   7333,
-    8500,  10548,  12536,  13334,
-   13097,  12834,  12695,  11905,
-   10572,  10262,  12238,  15906,
-   19325,  20550,  18616,  14477,
-   11237,  11977,  16501,  21050,
-   21971,  19121,  15425,  13906,
-   15470,  18550,  20280,  18764,
-   14862,  11405,  10422,  11620,
-   13434,  14549,  14205,  12191,
-    9202,   6547,   5021,   4476,
-    4514,   4833,   4793,   3618,
-    1379,   -882,  -2301,  -2953,
-   -3485,  -4597,  -6782,  -9812,
-  -12511, -13741, -13568, -12955,
-  -12724, -13455, -15719, -19242,
-  -22351, -23457, -22854, -22100,
-  -22116, -22886, -24269, -25815,
-  -26447, -25743, -24962, -25529,
-  -27213, -28887, -29997, -30101,
-  -28566, -26315, -25858, -27529,
-  -28118, -26029, -24973, -28387,
-  -32767, -32030, -27023, -24386,
-  -26293, -28030, -26716, -25529,
-  -26806, -27458, -25055, -22957,
-  -24731, -27744, -27228, -23529,
-  -20625, -20028, -20595, -22100,
-  -24444, -25172, -22405, -18956,
-  -19036, -21743, -22329, -19528,
-  -17158, -18028, -20300, -20957,
-  -19552, -17170, -14292, -11241,
-   -9048,  -8597,  -9824, -12098,
-  -14275, -14313, -10409,  -3239,
-    3706,   6547,   3900,  -1810,
-   -5411,  -2596,   6017,  14763,
-    -694,  -1763,  -2004,  -1786,
-   -1482,  -1042,   -427,     39,
-      94,    -75,   -164,   -165,
-    -168,    -44,    361,    933,
-    1408,   1609,   1413,    754,
-    -168,   -967,  -1478,  -1824,
-   -2008,  -1852,  -1478,  -1372,
-   -1745,  -2291,  -2793,  -3471,
-   -4374,  -4980,  -4896,  -4506,
-   -4374,  -4353,  -3844,  -2679,
-   -1220,    201,   1413,   2193,
-    2460,   2527,   2727,   2951,
-    2986,   3062,   3516,   4112,
-    4300,   4035,   3779,   3799,
-    4037,   4583,   5619,   6837,
-    7455,   6941,   5356,   3021,
-     357,  -1977,  -3319,  -3502,
-   -2797,  -1476,     98,   1139,
-     883,   -549,  -2267,  -3595,
-   -4374,  -4395,  -3319,  -1357,
-     620,   1916,   2464,   2422,
-    1934,   1418,   1413,   1925,
-    2460,   2780,   2990,   2865,
-    1934,    394,   -953,  -1940,
-   -3323,  -5483,  -7788,  -9642,
-  -11209, -12505, -12783, -11591,
-   -9632,  -7778,  -5947,  -3671,
-    -957,   2210,   6407,  11840,
-   17445,  21707,  23758,  23162,
-   19811,  15034,  11665,  11753,
-   15079,  20608,  27439,  32767,
-   31641,  22313,  10351,   3119,
-     357,  -5213, -16989, -28840,
-  -32767, -28378, -21458, -16108,
-  -12524, -10862, -12520, -17096,
-  -21462, -22950, -21458, -17961,
-  -13050,  -7612,  -3056,    108,
-    2723,   5457,   7985,  10033,
-   11924,  13547,  14031,  13048,
-   11398,   9776,   7985,   5885,
-    4037,   2740,   1413,   -313,
-   -1745,  -2126,  -1741,  -1310,
-    -957,   -549,   -427,   -955,
-   -1745,  -2026,  -1478,   -207,
-    1671,   3802,   5356,   5658,
-    4826,   3382,   1675,    137,
-    -431,    447,   2201,   3760,
-    4563,   4542,   3516,   1342,
-   -1482,  -4029,  -5685,  -6318,
-   -5952,  -4821,  -3581,  -2891,
-   -2797,  -2921,  -3056,  -3167,
-   -3060,  -2578,  -2004,  -1747,
-   -1745,  -1660,  -1478,  -1395,
-   -1220,   -479,    887,   2436,
-    3774,   4777,   5356,   5522,
-    5615,   5930,   6145,   5670,
-    4563,   3531,   2990,   2708,
-    2460,   2429,   2727,   3032,
-    2986,   2583,   1938,   1063,
-      94,   -579,   -690,   -370,
-      94,    546,    887,    995,
-     883,    718,    624,    640,
-     883,   1459,   2201,   2764,
-    2986,   2855,   2201,    885,
-    -694,   1994,   -175,  -1958,
-   -2977,  -3704,  -4245,  -4238,
-   -3710,  -3134,  -2746,  -2528,
-   -2623,  -3134,  -3773,  -4238,
-   -4596,  -4843,  -4675,  -4238,
-   -4383,  -5413,  -6287,  -5947,
-   -4767,  -3704,  -2744,  -1389,
-     -68,    284,   -249,   -819,
-   -1259,  -1994,  -2698,  -2528,
-   -1709,  -1424,  -1906,  -1958,
-    -697,   1424,   3694,   6019,
-    8202,   9402,   8968,   7158,
-    4643,   1994,    -70,   -819,
-    -262,    854,   2018,   3169,
-    3936,   3704,   2705,   2030,
-    2183,   2564,   2645,   2599,
-    2393,   1424,   -349,  -1958,
-   -2643,  -2564,  -1866,   -249,
-    1897,   3134,   2581,    890,
-   -1043,  -3134,  -5125,  -5947,
-   -5220,  -4273,  -4548,  -5947,
-   -7767,  -9972, -12304, -13356,
-  -12098,  -9402,  -6715,  -4238,
-   -1716,    284,   1604,   3739,
-    7920,  12821,  15946,  16276,
-   13929,   8832,   2136,  -2528,
-   -2007,   3134,  10629,  19695,
-   28799,  32767,  27792,  18556,
-   14089,  15671,  14928,   6019,
-   -6199, -13391, -13847, -11076,
-   -6742,   -284,   6999,  12287,
-   14118,  11682,   3875,  -7087,
-  -14338, -13961, -11717, -16205,
-  -26493, -32767, -29145, -19624,
-  -10560,  -3704,    986,   1460,
-   -3433, -10542, -15559, -17345,
-  -16778, -13961,  -9250,  -4808,
-   -2352,   -854,   1436,   4309,
-    6836,   9402,  12304,  13997,
-   13047,  10542,   8494,   7158,
-    5927,   5413,   6290,   7158,
-    6013,   3134,    421,  -1389,
-   -2723,  -3134,  -1682,    890,
-    2554,   2564,   1835,    890,
-    -668,  -2564,  -3548,  -3098,
-   -2076,  -1424,  -1369,  -1958,
-   -3161,  -4273,  -4297,  -3098,
-   -1390,    284,   1649,   2030,
-     721,  -1994,  -5054,  -7657,
-   -9324,  -9402,  -7607,  -4808,
-   -2251,   -284,   1258,   2030,
-    1775,   1424,   2074,   3169,
-    3198,   1994,    824,    320,
-     -28,   -284,    353,   2030,
-    3751,   4843,   5572,   6019,
-    5715,   4843,   4446,   4879,
-    5236,   4843,   4171,   3739,
-    3266,   2564,   2206,   2599,
-    3273,   3704,   4018,   4309,
-    4112,   3134,   1752,    320,
-   -1205,  -2564,  -3042,  -2528,
-   -1822,  -1424,   -953,   -249,
-      54,   -284,   -415,    320,
-    1360,   1994,   2490,   3169,
-    3285,   1994,  -2398,  -3669,
-   -4728,  -5395,  -5579,  -5224,
-   -4330,  -3026,  -1603,   -390,
-     440,    931,   1180,   1244,
-    1236,   1407,   1975,   2848,
-    3621,   3895,   3566,   2839,
-    2031,   1406,   1180,   1527,
-    2429,   3468,   3963,   3460,
-    2031,      3,  -2398,  -4869,
-   -6716,  -7213,  -6374,  -5017,
-   -3932,  -3265,  -2795,  -2458,
-   -2342,  -2402,  -2398,  -2042,
-   -1149,    194,   1577,   2592,
-    3224,   3687,   3963,   3885,
-    3621,   3612,   3963,   4396,
-    4814,   5390,   5951,   5881,
-    4814,   2925,    385,  -2817,
-   -6318,  -9282, -11146, -11894,
-  -11487,  -9830,  -7567,  -5965,
-   -5523,  -5433,  -4784,  -3411,
-   -1149,   2628,   7939,  13460,
-   17538,  19261,  18278,  14861,
-   10779,   8719,   9928,  13501,
-   18334,  23684,  27026,  24428,
-   15550,   5769,    -12,  -3905,
-  -11487, -22801, -31425, -32767,
-  -28983, -24497, -20689, -17182,
-  -15066, -15694, -17905, -18906,
-  -17054, -12313,  -5181,   3195,
-   10779,  15902,  18278,  18326,
-   16743,  15225,  15892,  19141,
-   23503,  27900,  31797,  32767,
-   27479,  16982,   7542,   3160,
-      43,  -7660, -18701, -25798,
-  -25007, -19558, -14327, -10878,
-   -9102,  -9784, -13134, -17063,
-  -19042, -18374, -15520, -10813,
-   -5125,   -322,   2373,   3573,
-    4417,   5173,   5951,   7478,
-    9984,  12295,  13109,  12409,
-   10779,   8234,   4758,   1183,
-   -1547,  -3415,  -4784,  -5443,
-   -5125,  -4384,  -3988,  -3867,
-   -3535,  -3144,  -3193,  -3530,
-   -3535,  -3065,  -2398,  -1453,
-      43,   1725,   2770,   2955,
-    2826,   2797,   2770,   2764,
-    3224,   4417,   5951,   7155,
-    7598,   7092,   5554,   3151,
-     440,  -1852,  -3193,  -3414,
-   -2740,  -1687,   -807,   -452,
-    -751,  -1649,  -2795,  -3574,
-   -3535,  -2823,  -2000,  -1453,
-   -1149,   -933,   -807,   -806,
-    -751,   -298,    782,   2370,
-    4019,   5268,   5951,   6180,
-    6007,   5282,   3963,   2430,
-    1236,    606,    385,    444,
-     838,   1481,   1975,   1989,
-    1633,   1214,    782,    209,
-    -354,   -477,    -12,    612,
-     838,    542,    -12,   -598,
-   -1149,  -1549,  -1603,  -1269,
-    -751,   -293,    -12,     12,
-    -354,  -1197,  -2398,   5823,
-    5227,   4102,   3082,   2451,
-    1896,   1292,   1142,   1889,
-    3249,   4664,   5931,   6947,
-    7247,   6350,   4365,   1889,
-    -451,  -2080,  -2559,  -2045,
-   -1315,   -956,   -864,   -920,
-   -1582,  -3204,  -5194,  -6541,
-   -6908,  -6576,  -5682,  -4293,
-   -3016,  -2642,  -3147,  -3731,
-   -3876,  -3766,  -3609,  -3169,
-   -2101,   -394,   1555,   3013,
-    3287,   2416,   1217,    203,
-   -1103,  -3204,  -5518,  -7103,
-   -8003,  -8824,  -9349,  -8789,
-   -7222,  -5452,  -3461,   -358,
-    3986,   8598,  12878,  17064,
-   20896,  23212,  23318,  21561,
-   18358,  14219,  10946,  10882,
-   14303,  19277,  24352,  28867,
-   30147,  24336,  12432,   1889,
-   -1783,  -2642,  -8893, -21154,
-  -31190, -32431, -26813, -20030,
-  -14741, -11073, -10041, -12724,
-  -17627, -21752, -23497, -22841,
-  -19962, -15569, -11536,  -9351,
-   -8520,  -7700,  -6475,  -4855,
-   -2295,   1292,   4589,   6385,
-    7172,   8036,   9088,  10320,
-   12753,  17029,  21689,  24371,
-   24021,  20963,  16115,  11444,
-    9689,  11971,  16835,  22685,
-   28844,  32767,  29784,  19312,
-    8423,   4102,   3467,  -2607,
-  -16272, -29058, -32767, -28461,
-  -22152, -16693, -11970,  -9351,
-  -10908, -15569, -19927, -22278,
-  -23085, -22314, -19220, -14410,
-   -9608,  -5452,  -1404,   2451,
-    5383,   7474,   9386,  10882,
-   11144,  10284,   9066,   7509,
-    5270,   2978,   1595,    765,
-    -564,  -2080,  -2322,   -920,
-     954,   2416,   3639,   4699,
-    5081,   4664,   4032,   3575,
-    3298,   3540,   4733,   6385,
-    7396,   7474,   7140,   6385,
-    4672,   2416,   1074,   1327,
-    2292,   2978,   3366,   3575,
-    3043,   1292,  -1247,  -3731,
-   -5628,  -6576,  -6247,  -4855,
-   -3247,  -2080,  -1355,   -920,
-    -818,   -956,  -1115,  -1483,
-   -2460,  -3766,  -4493,  -4293,
-   -3732,  -3204,  -2348,   -920,
-     617,   1854,   2986,   4137,
-    4912,   5226,   5778,   6947,
-    7873,   7474,   5895,   4137,
-    2669,   1292,     99,   -358,
-      51,    730,   1030,    765,
-     -62,  -1518,  -3487,  -5417,
-   -6572,  -6576,  -5745,  -4855,
-   -4452,  -4328,  -3822,  -2607,
-    -954,    730,   2269,   3575,
-    4545,   5226,   5717,   5823,
-    5272,   2714,     90,  -2257,
-   -4005,  -4694,  -4085,  -2619,
-   -1221,   -587,   -837,  -1771,
-   -3077,  -4225,  -4548,  -3737,
-   -2149,   -438,   1017,   2177,
-    2953,   3066,   2409,   1379,
-     633,    461,    553,    479,
-     169,   -243,   -837,  -1801,
-   -3077,  -4535,  -6404,  -8985,
-  -11891, -14145, -15218, -15433,
-  -15138, -14088, -11971,  -9048,
-   -5860,  -2668,    553,   3997,
-    8056,  12899,  17718,  21010,
-   21972,  21067,  19109,  16647,
-   14550,  14181,  16326,  20545,
-   25684,  29972,  30707,  25938,
-   17333,   9231,   3337,  -3526,
-  -14211, -25636, -31455, -29402,
-  -23025, -16654, -11971,  -9683,
-  -10963, -15570, -20785, -23823,
-  -23952, -21499, -16610, -10120,
-   -4005,    356,   3337,   5740,
-    7592,   9004,  10759,  13002,
-   14550,  14437,  13079,  11139,
-    8519,   5306,   2409,    227,
-   -2149,  -5402,  -8724, -11038,
-  -12355, -12957, -12435, -10654,
-   -8644,  -7367,  -6404,  -4778,
-   -2149,   1636,   7048,  13790,
-   20117,  24148,  25140,  23041,
-   18261,  12689,   9367,  10023,
-   14086,  20470,  27923,  32767,
-   29859,  18733,   6120,  -1379,
-   -5397, -12444, -23568, -32192,
-  -32767, -27146, -20785, -16386,
-  -13747, -12996, -14754, -18170,
-  -21169, -22330, -21249, -17875,
-  -12819,  -7655,  -3621,   -404,
-    2953,   6546,   9831,  12643,
-   15014,  16529,  16790,  16122,
-   15014,  13310,  10759,   7936,
-    5736,   4238,   2873,   1519,
-     633,    420,    553,    685,
-     633,    165,   -837,  -1979,
-   -2613,  -2494,  -1765,   -435,
-    1561,   3758,   5192,   5284,
-    4344,   3083,   1945,   1165,
-    1097,   2060,   3801,   5378,
-    5736,   4450,   1945,   -937,
-   -3541,  -5579,  -6868,  -7143,
-   -6324,  -4876,  -3621,  -3073,
-   -3077,  -3178,  -3157,  -3011,
-   -2613,  -1799,   -837,   -385,
-    -758,  -1552,  -2229,  -2718,
-   -3077,  -2913,  -1765,     45,
-    1561,   2254,   2409,   2370,
-    2025,   1296,    553,    109,
-    -294,  -1006,  -1765,  -1922,
-   -1221,     39,   1481,   2859,
-    3880,   4216,   3801,   2928,
-    2025,   1460,   1481,   2090,
-    2953,   3602,   3801,   3649,
-    3417,   3384,   3801,   4795,
-    6200,   7490,   7976,   7206,
-    5272,   2730,   4808,   5930,
-    5569,   3822,   1720,    469,
-     412,   1092,   2089,   3199,
-    3964,   3822,   2821,   1561,
-     337,  -1092,  -2808,  -4445,
-   -5790,  -7099,  -8565,  -9906,
-  -10733, -10922, -10477,  -9360,
-   -7634,  -5461,  -2831,    469,
-    4555,   9283,  14228,  18491,
-   20767,  20206,  17292,  13576,
-   10576,   9283,  10467,  14668,
-   21397,  28398,  32154,  29959,
-   22329,  13106,   5942,    469,
-   -6656, -16383, -24697, -26836,
-  -22713, -16383, -11290,  -8268,
-   -7469,  -9283, -12765, -15368,
-  -15334, -13106,  -9953,  -6630,
-   -3804,  -2184,  -1415,    -76,
-    2594,   6007,   9520,  13030,
-   15818,  16383,  14267,  10845,
-    7617,   4915,   2861,   2107,
-    2666,   3276,   2942,   2107,
-    1519,   1092,    720,   1015,
-    2196,   3276,   3332,   2653,
-    1880,   1092,    546,   1015,
-    2320,   2730,    961,  -2261,
-   -5595,  -8737, -11506, -12637,
-  -11084,  -7645,  -3936,   -622,
-    2155,   3822,   4378,   5384,
-    8303,  12560,  16469,  19037,
-   19643,  17475,  13178,   9753,
-    9820,  13106,  18276,  25044,
-   31652,  32767,  24702,  11937,
-    3134,      0,  -4678, -15914,
-  -28348, -32767, -27322, -18098,
-  -10817,  -6553,  -4805,  -6084,
-  -10177, -14745, -17260, -17006,
-  -14508, -10376,  -5393,   -622,
-    3323,   6553,   9246,  11391,
-   13167,  14745,  15655,  15214,
-   13664,  12014,  10681,   9207,
-    7454,   6007,   5022,   3746,
-    1783,      0,   -576,    -76,
-     727,   1638,   2819,   3746,
-    3409,   1638,   -495,  -1715,
-   -1490,      0,   2203,   4292,
-    5465,   5461,   4579,   3199,
-    1650,    546,    648,   2107,
-    4194,   6007,   7063,   7022,
-    5412,   2184,  -1738,  -4991,
-   -6777,  -7099,  -6328,  -4991,
-   -3792,  -3276,  -3426,  -3899,
-   -4569,  -5461,  -6302,  -6630,
-   -6390,  -6007,  -5777,  -5537,
-   -4954,  -3822,  -2019,    469,
-    3337,   6007,   8010,   9207,
-    9712,   9830,   9962,  10299,
-   10574,  10376,   9643,   8661,
-    7722,   7099,   7164,   8114,
-    9603,  10922,  11482,  10845,
-    8622,   4915,    795,  -2261,
-   -3527,  -3276,  -2016,    -76,
-    1995,   3276,   3088,   1561,
-    -516,  -2184,  -2674,  -1715,
-     326,   2730,   -938,  -1563,
-   -2859,  -5098,  -8059, -11199,
-  -13778, -15049, -14705, -13114,
-  -10929,  -8562,  -6160,  -3825,
-   -1435,   1573,   5707,  10617,
-   15180,  18422,  19949,  19530,
-   17078,  13417,  10455,   9950,
-   12331,  16814,  21848,  24918,
-   23250,  16387,   7606,    865,
-   -3808, -10011, -19452, -28691,
-  -32767, -30678, -25623, -20890,
-  -17575, -15864, -16129, -18018,
-  -19949, -20395, -18977, -16005,
-  -11879,  -7330,  -3311,   -106,
-    2837,   5852,   8556,  10639,
-   12331,  13689,  14252,  13897,
-   13281,  12900,  12353,  11057,
-    9008,   6337,   2859,  -1221,
-   -4758,  -6589,  -6634,  -5540,
-   -3808,  -1955,   -938,  -1512,
-   -3334,  -5325,  -6634,  -6754,
-   -5233,  -2141,   1435,   4096,
-    5210,   4876,   3334,   1145,
-    -485,   -506,    960,   2960,
-    4736,   5751,   5233,   2743,
-    -960,  -4570,  -7584, -10223,
-  -12353, -13585, -14230, -14986,
-  -15676, -15448, -14230, -12812,
-  -11404,  -9382,  -6634,  -3824,
-    -960,   2918,   8081,  13273,
-   17078,  19026,  19000,  17012,
-   14230,  12788,  13778,  16718,
-   21351,  27619,  32767,  31546,
-   22300,  10732,   3808,    905,
-   -4758, -15763, -26098, -28803,
-  -24221, -17985, -13755, -11461,
-  -10929, -13119, -17553, -21525,
-  -22797, -21342, -18028, -13352,
-   -8081,  -3562,   -463,   1874,
-    4261,   6709,   9030,  11320,
-   13281,  13962,  12828,  10430,
-    7584,   4623,   1910,    155,
-    -485,   -911,  -1887,  -2971,
-   -3334,  -3069,  -2837,  -2725,
-   -2384,  -1951,  -1887,  -2072,
-   -1910,  -1254,   -463,    370,
-    1413,   2332,   2384,   1397,
-     -11,  -1292,  -2362,  -3033,
-   -2859,  -1883,   -938,   -788,
-   -1435,  -2578,  -4261,  -6572,
-   -9030, -10709, -10907,  -9541,
-   -7131,  -4606,  -2837,  -2071,
-   -1910,  -1895,  -1887,  -1807,
-   -1435,   -718,     11,    398,
-     463,    445,    485,    705,
-    1413,   2935,   5233,   7729,
-    9483,   9645,   8081,   5603,
-    3311,   1664,    485,   -203,
-     -11,    998,   1910,   1861,
-     938,   -244,  -1413,  -2557,
-   -3334,  -3246,  -2362,  -1298,
-    -485,     96,    485,    574,
-     463,    532,    960,   1507,
-    1887,   2038,   1910,   1358,
-     463,   -377,   -938,   3682,
-    9249,  15541,  21265,  25214,
-   26261,  23616,  18042,  12295,
-    9214,   9620,  12908,  18754,
-   26246,  31690,  30268,  21446,
-   10711,   3699,   -303,  -6544,
-  -16966, -26982, -30878, -28076,
-  -22547, -17831, -14919, -14080,
-  -15940, -19985, -23865, -25384,
-  -24319, -21599, -17724, -13004,
-   -8521,  -5451,  -3604,  -1700,
-     913,   3699,   6047,   7988,
-    9631,  10697,  10987,  10680,
-    9897,   8544,   6817,   5297,
-    4212,   3161,   1919,    991,
-     929,   1546,   2213,   2606,
-    2736,   2622,   2415,   2606,
-    3629,   5314,   6989,   7988,
-    7857,   6390,   3848,    991,
-   -1370,  -2759,  -2911,  -1700,
-     490,   2622,   3636,   3144,
-    1390,  -1145,  -3848,  -6006,
-   -7112,  -7066,  -6028,  -4391,
-   -2896,  -2221,  -2246,  -2238,
-   -1917,  -1683,  -1615,  -1161,
-    -301,    -68,  -1148,  -2776,
-   -3936,  -4913,  -6573,  -8697,
-  -10238, -10834, -10867, -10312,
-   -8775,  -6527,  -4317,  -2238,
-     125,   2622,   4864,   7450,
-   11453,  16618,  21390,  24675,
-   26169,  25230,  21458,  16601,
-   13808,  14465,  17620,  22522,
-   28683,  32767,  29553,  18754,
-    7507,   2084,   -551,  -8159,
-  -21370, -31827, -32767, -26461,
-  -19305, -14063, -10241,  -8697,
-  -11353, -17293, -22718, -24846,
-  -23634, -19985, -14604,  -8697,
-   -3742,    -68,   3043,   5835,
-    7941,   9620,  11558,  13371,
-   13840,  12850,  11621,  10680,
-    9120,   6390,   3382,    991,
-   -1102,  -3298,  -4858,  -4929,
-   -4008,  -3298,  -3182,  -3315,
-   -3752,  -4913,  -6540,  -7621,
-   -7407,  -5989,  -3906,  -1700,
-     192,   1546,   2361,   2606,
-    2209,   1546,   1502,   2606,
-    4362,   5852,   6682,   6912,
-    6386,   4776,   2204,   -623,
-   -2862,  -3836,  -3181,  -1161,
-    1282,   3161,   4008,   3682,
-    2063,   -606,  -3429,  -5468,
-   -6459,  -6527,  -5622,  -3853,
-   -2041,  -1145,  -1249,  -1700,
-   -2054,  -2221,  -1889,   -623,
-    1443,   3699,   5763,   7450,
-    8201,   7467,   5718,   4220,
-    3652,   3699,   4044,   4759,
-    5490,   5314,   3917,   2067,
-     355,  -1683,  -4542,  -7621,
-   -9936, -11372, -12404, -13004,
-  -12681, -11372,  -9561,  -7621,
-   -5575,  -3298,   -421,   3682,
-    -223,    483,   1338,   2243,
-    3160,   4084,   4983,   5862,
-    6805,   7852,   8888,   9762,
-   10450,  11020,  11491,  11868,
-   12272,  12905,  13834,  14909,
-   15917,  16759,  17479,  18202,
-   19041,  19986,  20864,  21500,
-   21905,  22208,  22426,  22475,
-   22426,  22588,  23207,  24200,
-   25290,  26286,  27112,  27670,
-   27893,  27894,  27893,  27995,
-   28153,  28354,  28674,  29147,
-   29716,  30340,  31017,  31651,
-   32059,  32164,  32059,  31839,
-   31538,  31279,  31278,  31552,
-   31798,  31753,  31538,  31451,
-   31538,  31649,  31798,  32140,
-   32579,  32767,  32579,  32283,
-   32059,  31700,  31017,  30294,
-   29976,  30077,  30236,  30306,
-   30497,  30907,  31278,  31321,
-   31017,  30421,  29455,  28142,
-   26852,  26041,  25810,  25905,
-   26071,  26176,  26071,  25592,
-   24769,  23831,  22947,  22121,
-   21384,  20872,  20603,  20340,
-   19822,  19064,  18260,  17497,
-   16698,  15857,  15136,  14671,
-   14355,  13895,  13053,  11833,
-   10450,   9160,   8107,   7319,
-    6805,   6577,   6545,   6454,
-    6024,   5149,   3941,   2606,
-    1338,    290,   -484,  -1099,
-   -1785,  -2711,  -3868,  -5105,
-   -6211,  -6970,  -7253,  -7152,
-   -6992,  -7136,  -7773,  -8899,
-  -10377, -11946, -13241, -13995,
-  -14282, -14453, -14803, -15370,
-  -16104, -17092, -18447, -20006,
-  -21311, -21993, -22092, -21948,
-  -21832, -21799, -21832, -21990,
-  -22353, -22922, -23654, -24525,
-  -25477, -26361, -27039, -27550,
-  -28080, -28728, -29382, -29870,
-  -30163, -30342, -30423, -30352,
-  -30163, -30048, -30163, -30442,
-  -30684, -30807, -30944, -31256,
-  -31725, -32184, -32506, -32690,
-  -32766, -32712, -32506, -32219,
-  -31985, -31902, -31985, -32209,
-  -32506, -32745, -32767, -32495,
-  -31985, -31350, -30684, -30078,
-  -29642, -29430, -29382, -29388,
-  -29382, -29323, -29122, -28690,
-  -28080, -27483, -27039, -26689,
-  -26258, -25656, -24956, -24279,
-  -23654, -23023, -22353, -21733,
-  -21311, -21134, -21051, -20814,
-  -20270, -19440, -18447, -17406,
-  -16365, -15324, -14282, -13294,
-  -12460, -11793, -11158, -10409,
-   -9596,  -8892,  -8294,  -7548,
-   -6472,  -5225,  -4128,  -3287,
-   -2566,  -1872,  -1265,   -761,
-    -223,  -1367,    530,   2497,
-    4532,   6611,   8552,  10218,
-   11786,  13560,  15544,  17425,
-   19023,  20509,  22071,  23602,
-   24882,  25914,  26906,  27977,
-   29058,  30032,  30866,  31580,
-   32178,  32606,  32767,  32610,
-   32236,  31834,  31479,  31066,
-   30486,  29775,  28974,  27977,
-   26664,  25142,  23666,  22315,
-   20898,  19222,  17323,  15366,
-   13432,  11501,   9565,   7644,
-    5727,   3780,   1827,    -76,
-   -1962,  -3940,  -6029,  -8054,
-   -9830, -11404, -13011, -14746,
-  -16426, -17839, -19024, -20151,
-  -21198, -21957, -22381, -22725,
-  -23220, -23758, -24051, -24012,
-  -23797, -23501, -23005, -22210,
-  -21261, -20412, -19702, -18864,
-  -17629, -16037, -14400, -12945,
-  -11586, -10117,  -8535,  -7025,
-   -5646,  -4198,  -2486,   -591,
-    1266,   3008,   4705,   6358,
-    7858,   9185,  10455,  11762,
-   13074,  14332,  15532,  16653,
-   17625,  18450,  19228,  19998,
-   20639,  21024,  21199,  21285,
-   21267,  21024,  20550,  19998,
-   19487,  18965,  18301,  17425,
-   16347,  15104,  13737,  12277,
-   10748,   9185,   7640,   6100,
-    4424,   2493,    402,  -1620,
-   -3523,  -5485,  -7582,  -9599,
-  -11333, -12949, -14770, -16805,
-  -18745, -20412, -21950, -23497,
-  -24976, -26332, -27707, -29159,
-  -30426, -31222, -31640, -31990,
-  -32340, -32509, -32485, -32505,
-  -32672, -32767, -32546, -31990,
-  -31139, -29935, -28414, -26843,
-  -25477, -24273, -23035, -21695,
-  -20261, -18611, -16628, -14489,
-  -12549, -10890,  -9217,  -7282,
-   -5188,  -3168,  -1249,    695,
-    2673,   4552,   6272,   7902,
-    9482,  10986,  12468,  14079,
-   15827,  17421,  18536,  19226,
-   19886,  20767,  21679,  22315,
-   22695,  23083,  23495,  23602,
-   23204,  22568,  22092,  21800,
-   21404,  20767,  20019,  19226,
-   18225,  16906,  15442,  14079,
-   12822,  11501,  10023,   8417,
-    6687,   4809,   2852,    953,
-    -853,  -2654,  -4485,  -6253,
-   -7865,  -9345, -10768, -12172,
-  -13580, -15008, -16393, -17577,
-  -18459, -19126, -19753, -20408,
-  -21009, -21442, -21662, -21695,
-  -21606, -21442, -21162, -20666,
-  -19944, -19126, -18293, -17320,
-  -16035, -14493, -12921, -11400,
-   -9800,  -8058,  -6321,  -4709,
-   -3113,  -1367,   1109,    111,
-    -948,  -1636,  -1709,  -1276,
-    -692,   -342,   -428,   -920,
-   -1717,  -2784,  -4016,  -5064,
-   -5562,  -5573,  -5554,  -5785,
-   -6075,  -6153,  -6067,  -6022,
-   -6075,  -6269,  -6836,  -7954,
-   -9407, -10796, -11963, -12917,
-  -13509, -13596, -13501, -13838,
-  -14790, -15926, -16833, -17535,
-  -18123, -18425, -18371, -18364,
-  -18892, -19906, -20934, -21682,
-  -22224, -22704, -23241, -24102,
-  -25556, -27438, -29137, -30191,
-  -30683, -30960, -31188, -31346,
-  -31452, -31566, -31700, -31888,
-  -32221, -32619, -32726, -32311,
-  -31708, -31535, -31957, -32508,
-  -32734, -32705, -32726, -32767,
-  -32477, -31652, -30419, -29009,
-  -27607, -26449, -25805, -25705,
-  -25813, -25711, -25292, -24757,
-  -24275, -23753, -22985, -21963,
-  -20942, -20133, -19396, -18397,
-  -17097, -15924, -15295, -15133,
-  -15047, -14886, -14782, -14642,
-  -14021, -12715, -11194, -10135,
-   -9664,  -9357,  -8887,  -8293,
-   -7613,  -6645,  -5298,  -3920,
-   -2999,  -2632,  -2478,  -2198,
-   -1717,  -1103,   -428,    149,
-     332,    -85,   -940,  -1734,
-   -1974,  -1481,   -428,    817,
-    1870,   2438,   2391,   1829,
-    1101,    676,    853,   1545,
-    2383,   3042,   3416,   3521,
-    3408,   3262,   3416,   4054,
-    4946,   5652,   5980,   6091,
-    6228,   6554,   7261,   8504,
-   10073,  11361,  11875,  11701,
-   11355,  11324,  11875,  13064,
-   14687,  16298,  17515,  18289,
-   18788,  19153,  19565,  20338,
-   21608,  23006,  23923,  24084,
-   23658,  22953,  22385,  22625,
-   24171,  26615,  28793,  29938,
-   30323,  30585,  30844,  30886,
-   30836,  31074,  31613,  32045,
-   32117,  31938,  31613,  31104,
-   30579,  30501,  31100,  32007,
-   32630,  32767,  32638,  32441,
-   32117,  31566,  30844,  30081,
-   29298,  28430,  27511,  26728,
-   26222,  25890,  25461,  24779,
-   23915,  22960,  21872,  20650,
-   19557,  18939,  18796,  18710,
-   18276,  17463,  16489,  15525,
-   14687,  14139,  13926,  13696,
-   12893,  11356,   9568,   8149,
-    7253,   6650,   6236,   6124,
-    6228,   6112,   5467,   4503,
-    3665,   3099,   2647,   2219,
-    1870,   1553,   1109,    592,
-     332,    558,   1109,   1629,
-    1870,   1719,   1109,  -2410,
-   -1054,    483,   1907,   3607,
-    6034,   8857,  11364,  13289,
-   14646,  15138,  14519,  13289,
-   12200,  11212,   9769,   8056,
-    7118,   7549,   8860,  10411,
-   12237,  14614,  17380,  20093,
-   22410,  24035,  24755,  24803,
-   24716,  24558,  23787,  22187,
-   20385,  19063,  18182,  17476,
-   17196,  17754,  18980,  20355,
-   21729,  23250,  24799,  26112,
-   27269,  28483,  29495,  29775,
-   29283,  28483,  27638,  26635,
-   25512,  24558,  23847,  23233,
-   22929,  23511,  25128,  27159,
-   28925,  30315,  31493,  32392,
-   32767,  32409,  31102,  28729,
-   25666,  22726,  20445,  18785,
-   17741,  17754,  19123,  21402,
-   23849,  26128,  28091,  29252,
-   29134,  27960,  26370,  24542,
-   22218,  19586,  17422,  16168,
-   15423,  14614,  13763,  13289,
-   13384,  13829,  14245,  14336,
-   14095,  13829,  13795,  13813,
-   13577,  13306,  13566,  14336,
-   14797,  14353,  13366,  12504,
-   11772,  10689,   9145,   7532,
-    6155,   4932,   3672,   2299,
-     883,   -301,   -883,   -840,
-    -673,   -824,  -1106,  -1102,
-    -926,  -1086,  -1649,  -2149,
-   -2403,  -2917,  -4205,  -6074,
-   -7874,  -9198, -10055, -10523,
-  -10525,  -9983,  -9056,  -8167,
-   -7748,  -7889,  -8300,  -8691,
-   -9151,  -9983, -11237, -12616,
-  -13849, -14955, -16056, -17065,
-  -17657, -17572, -16944, -16280,
-  -15953, -15740, -15086, -13924,
-  -12898, -12600, -12953, -13663,
-  -14905, -17048, -19906, -22822,
-  -25427, -27777, -29800, -31195,
-  -31970, -32488, -32767, -32242,
-  -30530, -28039, -25523, -23345,
-  -21515, -20188, -19711, -20205,
-  -21385, -22805, -24179, -25438,
-  -26533, -27254, -27417, -27270,
-  -27411, -28039, -28602, -28579,
-  -28327, -28562, -29185, -29364,
-  -28794, -28039, -27437, -26485,
-  -24766, -22805, -21466, -20990,
-  -21174, -22020, -23570, -25438,
-  -27124, -28562, -29803, -30410,
-  -29797, -28039, -25767, -23345,
-  -20773, -18357, -16817, -16541,
-  -17213, -18357, -19818, -21513,
-  -23086, -24114, -24446, -24130,
-  -23161, -21497, -19217, -16541,
-  -13770, -11291,  -9520,  -8691,
-   -8694,  -9198,  -9926, -10784,
-  -11687, -12338, -12380, -11831,
-  -11127, -10506,  -9580,  -7906,
-   -5834,  -4226,  -3304,  -2410,
-    3606,   6038,   8484,  10488,
-   12198,  13979,  15644,  16627,
-   16780,  16415,  15644,  14245,
-   12198,   9826,   7338,   4718,
-    2174,    202,   -967,  -1583,
-   -1835,  -1509,   -394,   1324,
-    3319,   5453,   7624,   9608,
-   11339,  13095,  15071,  16993,
-   18499,  19713,  21085,  22770,
-   24513,  26067,  27386,  28428,
-   29096,  29401,  29391,  28897,
-   27664,  25776,  23663,  21571,
-   19358,  16966,  14784,  13227,
-   12198,  11351,  10775,  10986,
-   12198,  14000,  15930,  18023,
-   20504,  23202,  25668,  27756,
-   29669,  31403,  32542,  32767,
-   32246,  31303,  29964,  28124,
-   25945,  23755,  21658,  19584,
-   17640,  16056,  14784,  13515,
-   12198,  11198,  10775,  10721,
-   10766,  11052,  11920,  13370,
-   15062,  16769,  18508,  20270,
-   21936,  23500,  25095,  26679,
-   27950,  28758,  29391,  30216,
-   31101,  31493,  31109,  30319,
-   29669,  29162,  28245,  26519,
-   24227,  21891,  19653,  17238,
-   14489,  11650,   9056,   6831,
-    5038,   3902,   3615,   4068,
-    5038,   6546,   8770,  11635,
-   14776,  17926,  21085,  24229,
-   27091,  29346,  30823,  31440,
-   31101,  29799,  27673,  24846,
-   21363,  17348,  13066,   8687,
-    4179,   -400,  -4690,  -8325,
-  -11286, -13731, -15573, -16513,
-  -16441, -15565, -14141, -12302,
-  -10141,  -7767,  -5263,  -2734,
-    -403,   1523,   3042,   4237,
-    5038,   5296,   5047,   4466,
-    3606,   2428,   1037,   -382,
-   -1835,  -3412,  -4976,  -6316,
-   -7563,  -9047, -10704, -12128,
-  -13291, -14669, -16433, -18097,
-  -19306, -20422, -21874, -23388,
-  -24461, -25229, -26170, -27177,
-  -27611, -27240, -26457, -25570,
-  -24461, -23058, -21588, -20184,
-  -18733, -17273, -16146, -15545,
-  -15296, -15260, -15573, -16314,
-  -17301, -18430, -19869, -21681,
-  -23602, -25432, -27316, -29320,
-  -31048, -32065, -32471, -32682,
-  -32767, -32382, -31326, -29811,
-  -28184, -26601, -25025, -23367,
-  -21597, -19812, -18151, -16557,
-  -14723, -12427,  -9845,  -7386,
-   -5272,  -3442,  -1826,   -547,
-     169,    202,   -394,  -1487,
-   -2981,  -4790,  -6695,  -8348,
-   -9568, -10497, -11277, -11666,
-  -11286, -10169,  -8700,  -7029,
-   -4985,  -2629,   -394,   1553,
-    3606,   1937,   2655,   3017,
-    2368,   1387,   1375,   2466,
-    3062,   1387,  -2593,  -7167,
-  -10772, -13477, -16358, -19829,
-  -23116, -25313, -26358, -26711,
-  -26469, -25313, -23324, -21481,
-  -20980, -22010, -23391, -23683,
-  -22668, -21459, -21021, -20930,
-  -20037, -18156, -16413, -15700,
-  -15375, -14027, -11274,  -8268,
-   -6499,  -6595,  -8264, -10745,
-  -12992, -14027, -13875, -14049,
-  -16360, -20909, -25643, -28362,
-  -29000, -29442, -31027, -32767,
-  -32553, -29992, -27269, -26711,
-  -27860, -27790, -24501, -19279,
-  -15149, -13477, -12949, -11847,
-  -10326,  -9898, -11171, -12948,
-  -13698, -13477, -13927, -16251,
-  -19422, -20909, -19377, -16251,
-  -14135, -14027, -14800, -15150,
-  -14965, -14578, -13803, -12397,
-  -10575,  -8247,  -4527,    815,
-    5922,   8268,   7643,   6595,
-    7485,   9920,  11574,  10999,
-    9137,   8268,   9658,  12100,
-   12963,  11021,   7904,   6045,
-    5523,   4139,    669,  -3313,
-   -5575,  -6045,  -6439,  -7718,
-   -9168,  -9898, -10157, -10745,
-  -11667, -11825, -10094,  -6617,
-   -2889,   -264,   1570,   4118,
-    8013,  12122,  15044,  16780,
-   18223,  19554,  20087,  19532,
-   18459,  17352,  15886,  13477,
-   10151,   6617,   3625,   1365,
-    -606,  -2741,  -4706,  -5516,
-   -4756,  -3292,  -2227,  -1387,
-     497,   4139,   8869,  13477,
-   17179,  19554,  20263,  19532,
-   18607,  19003,  21005,  23111,
-   23367,  21481,  19440,  19532,
-   21635,  23132,  22036,  19532,
-   18378,  19003,  18594,  14578,
-    7998,   2488,    400,    815,
-    1128,   -264,  -2969,  -5516,
-   -6855,  -7146,  -7360,  -8268,
-   -9977, -12376, -15444, -18728,
-  -20956, -20909, -18606, -15150,
-  -11620,  -8797,  -7653,  -8819,
-  -11117, -11825,  -9504,  -6066,
-   -4991,  -7696, -12577, -17352,
-  -20936, -22560, -20365, -12397,
-     717,  14599,  23072,  22010,
-   12337,   -264,  -9278, -11847,
-   -9623,  -5494,   -541,   5219,
-   10426,  12672,  11439,   9348,
-    9805,  14049,  20756,  27515,
-   32011,  32767,  30111,  26414,
-   24392,  24784,  25970,  25863,
-   23804,  20655,  17601,  15128,
-   13006,  11021,   9497,   8797,
-    8320,   6617,   3073,   -836,
-   -2748,  -1916,     93,   1365,
-    1645,   1937, -10209,  -2528,
-    1899,    107,  -5587,  -9588,
-   -8371,  -3271,   1859,   4274,
-    3183,  -1025,  -6357,  -8746,
-   -4776,   3900,  10334,   8431,
-    -411,  -7793,  -6100,   4044,
-   13969,  14714,   5454,  -5212,
-   -7087,   1394,  11104,  11733,
-    3183,  -4495,  -3019,   4797,
-    9603,   7294,   2630,   1444,
-    3440,   4784,   4684,   5562,
-    7549,   6908,   1603,  -4128,
-   -3749,   3177,   9050,   6216,
-   -4006, -12054, -10209,   -723,
-    6779,   4995,  -4816, -14881,
-  -17359,  -9962,   1603,   6425,
-   -2465, -18998, -26900, -16205,
-    3440,  10751,  -3789, -25931,
-  -32767, -18317,    319,   3044,
-  -11196, -25639, -26387, -16529,
-   -8628,  -8400, -10979, -11505,
-  -12480, -17555, -22792, -20341,
-  -10426,  -3846,  -9439, -22162,
-  -27887, -19726,  -6100,  -1136,
-   -9142, -20873, -24589, -18368,
-  -10426,  -8835, -13290, -17362,
-  -16845, -13829, -12777, -14574,
-  -15818, -13550,  -9439,  -8376,
-  -12737, -18600, -18940, -11424,
-   -2208,   -143,  -6871, -14430,
-  -14021,  -5876,   1603,   2041,
-   -2208,  -4444,  -2248,    911,
-    1899,   2376,   5454,  10020,
-   11401,   7915,   4171,   6002,
-   13198,  19478,  19835,  15928,
-   13198,  14336,  17524,  20208,
-   21929,  22958,  22660,  20963,
-   19875,  21290,  23944,  24813,
-   23470,  22695,  24200,  26127,
-   26295,  25839,  27025,  28437,
-   25781,  18548,  13158,  16488,
-   26552,  32583,  26511,  13276,
-    6779,  14435,  28052,  32767,
-   23984,  11839,   8279,  13710,
-   19105,  18144,  12645,   7020,
-    2670,   -514,  -1221,   1263,
-    3954,   2445,  -3789, -10532,
-  -13507, -12546, -10979, -12154,
-  -16845, -23041, -27671, -29018,
-  -27887, -26491, -26387, -27640,
-  -29428, -30790, -31009, -30027,
-  -28658, -27984, -28441, -29648,
-  -30969, -31864, -31779, -30086,
-  -26347, -20792, -14831, -10939,
-  -11196, -15306, -20481, -23859,
-  -24806, -24447, -23562, -21945,
-  -19670, -17860, -17656, -18936,
-  -20440, -20917, -19967, -18106,
-  -16332, -15493, -15858, -17168,
-  -18900, -20218, -19967, -17554,
-  -14277, -13102, -15858, -20325,
-  -21211, -15501,  -6871,  -3223,
-   -8628, -18315, -23049, -18482,
-   -9142,  -3182,  -4559, -10659,
-  -15818, -15812, -10209,  -1467,
-  -10104,  -6211,   6508,  10173,
-   -1903, -14046,  -8448,  11068,
-   24007,  18190,   1511,  -9975,
-   -7850,   5206,  19923,  25172,
-   14599,  -5539, -17953,  -9975,
-   11561,  25354,  17839,  -1915,
-  -12107,  -1957,  17363,  25844,
-   15615,  -2853, -12824,  -6393,
-   10787,  25354,  26389,  13979,
-    -100,  -2629,   8200,  21590,
-   26136,  19981,   8424,  -3258,
-  -10515,  -7554,   7616,  25844,
-   31288,  17519,  -3175, -10422,
-    3597,  25354,  32767,  17337,
-   -6648, -16061,  -2344,  20247,
-   29931,  18638,  -2788, -17138,
-  -15526,  -2181,  10729,  13083,
-    5008,  -4196,  -6779,  -4602,
-   -3894,  -4868,  -2631,   2113,
-    1107,  -9121, -18977, -16243,
-   -2485,   7221,   1679, -13557,
-  -22566, -16061,   -289,   9949,
-    5716,  -8226, -18593, -16019,
-   -3183,   8116,   7787,  -3482,
-  -15295, -18300, -13514,  -9079,
-   -8593,  -7554,  -3260,  -1915,
-   -9630, -20539, -22600, -14004,
-   -4680,  -1062,    440,   2113,
-   -1421, -11360, -16810,  -9303,
-    2166,   2967,  -5199,  -8184,
-   -3085,  -1957,  -9212, -11766,
-    -398,  12370,   8915,  -6840,
-  -13954,  -3300,  11499,  13979,
-    4782,  -3300,  -3064,    770,
-     358,  -4868,  -7231,    323,
-   14247,  21548,  14236,    770,
-   -2509,   8564,  20828,  20695,
-    9909,    281,  -1795,    770,
-    3974,   7221,   9793,   9277,
-    5262,    281,  -4042,  -7512,
-   -7333,    281,  11439,  13979,
-    2114, -12479, -12871,    770,
-   10367,   3862,  -9228, -12437,
-   -5091,   -390,  -3966,  -6393,
-     170,   8116,   4698,  -9079,
-  -18379, -12927,    642,   6591,
-   -2843, -19643, -28222, -21392,
-   -8243,  -4196, -12827, -22064,
-  -21320, -16509, -20308, -31019,
-  -32767, -19195,  -5618,  -9303,
-  -24958, -31284, -20096,  -7064,
-   -9620, -23449, -29375, -19601,
-   -7198,  -7554, -18299, -24079,
-  -17590,  -7554,  -4785,  -8184,
-   -9675,  -7554,  -7073,  -9751,
-  -10647,  -7554,  -5222,  -7064,
-   -9198,  -7554,  -5324,  -7064,
-   -9742,  -7554,  -3486,  -7064,
-  -19295, -27926, -22155,  -7064,
-    1736,  -4196, -17855, -25422,
-  -20141,  -7554,    801,  -1915,
-  -12233, -20091, -17920,  -7064,
-    3362,   4310,  -4350, -12437,
-   -9839,    728,   5724,  -1467,
-     757,   2658,   4339,   5842,
-    7041,   7799,   8229,   8563,
-    8836,   8926,   8827,   8679,
-    8537,   8361,   8229,   8352,
-    8836,   9608,  10623,  11961,
-   13624,  15372,  16907,  18167,
-   19310,  20429,  21395,  22019,
-   22302,  22449,  22592,  22612,
-   22302,  21694,  21096,  20792,
-   20806,  21018,  21395,  22011,
-   22901,  24015,  25285,  26647,
-   27988,  29166,  30073,  30672,
-   30980,  31056,  30971,  30755,
-   30382,  29836,  29176,  28523,
-   27988,  27613,  27380,  27279,
-   27389,  27830,  28577,  29401,
-   30083,  30651,  31270,  31944,
-   32477,  32736,  32767,  32608,
-   32177,  31407,  30373,  29203,
-   27988,  26834,  25884,  25190,
-   24696,  24398,  24388,  24652,
-   24996,  25277,  25585,  26026,
-   26492,  26767,  26782,  26590,
-   26193,  25551,  24687,  23625,
-   22302,  20699,  19001,  17495,
-   16318,  15437,  14812,  14425,
-   14223,  14152,  14213,  14379,
-   14522,  14549,  14513,  14453,
-   14223,  13637,  12717,  11607,
-   10333,   8864,   7331,   5929,
-    4647,   3317,   1945,    746,
-    -140,   -746,  -1047,   -926,
-    -439,    109,    448,    490,
-     158,   -674,  -1945,  -3336,
-   -4628,  -5917,  -7331,  -8751,
-  -10015, -11196, -12418, -13520,
-  -14204, -14449, -14513, -14552,
-  -14503, -14346, -14213, -14190,
-  -14204, -14246, -14513, -15205,
-  -16299, -17607, -19001, -20467,
-  -21984, -23445, -24687, -25591,
-  -26174, -26551, -26782, -26779,
-  -26473, -25998, -25585, -25287,
-  -24977, -24622, -24388, -24414,
-  -24678, -25146, -25884, -26884,
-  -27969, -29009, -30073, -31201,
-  -32159, -32669, -32767, -32681,
-  -32458, -31970, -31270, -30611,
-  -30064, -29419, -28577, -27795,
-  -27371, -27294, -27380, -27580,
-  -27969, -28538, -29176, -29802,
-  -30363, -30770, -30971, -31021,
-  -30962, -30690, -30073, -29128,
-  -27969, -26668, -25285, -23971,
-  -22882, -22041, -21395, -20959,
-  -20787, -20855, -21096, -21489,
-  -21984, -22408, -22592, -22530,
-  -22284, -21821, -21096, -20212,
-  -19291, -18249, -16907, -15286,
-  -13606, -12030, -10623,  -9509,
-   -8818,  -8462,  -8229,  -8097,
-   -8219,  -8559,  -8827,  -8867,
-   -8818,  -8771,  -8528,  -7847,
-   -6723,  -5251,  -3441,  -1354,
-     757,    812,   4224,   7263,
-    9800,  11788,  13263,  14365,
-   15249,  15985,  16622,  17271,
-   18026,  18890,  19883,  21145,
-   22786,  24701,  26667,  28570,
-   30353,  31803,  32622,  32767,
-   32521,  32126,  31509,  30507,
-   29213,  27929,  26853,  25987,
-   25339,  25024,  25087,  25341,
-   25490,  25347,  24874,  24050,
-   22812,  21150,  19158,  16948,
-   14575,  12111,   9719,   7586,
-    5802,   4363,   3250,   2421,
-    1760,   1134,    498,   -161,
-    -963,  -2093,  -3593,  -5326,
-   -7185,  -9195, -11339, -13397,
-  -15089, -16297, -17032, -17271,
-  -16985, -16297, -15462, -14688,
-  -14076, -13715, -13702, -14043,
-  -14621, -15329, -16126, -16948,
-  -17618, -17911, -17689, -16948,
-  -15791, -14360, -12782, -11137,
-   -9484,  -7904,  -6491,  -5326,
-   -4480,  -4030,  -4015,  -4358,
-   -4869,  -5321,  -5516,  -5326,
-   -4712,  -3707,  -2377,   -807,
-     855,   2426,   3803,   5003,
-    6006,   6623,   6620,   5972,
-    4905,   3717,   2626,   1775,
-    1267,   1134,   1329,   1775,
-    2389,   3071,   3740,   4358,
-    4846,   5008,   4636,   3712,
-    2396,    812,   -976,  -2744,
-   -4071,  -4675,  -4673,  -4358,
-   -3835,  -3061,  -2160,  -1452,
-   -1134,  -1124,  -1314,  -1775,
-   -2610,  -3707,  -4791,  -5649,
-   -6181,  -6290,  -5884,  -5003,
-   -3807,  -2416,   -856,    807,
-    2392,   3717,   4703,   5326,
-    5537,   5331,   4856,   4358,
-    4041,   4040,   4457,   5326,
-    6535,   7914,   9424,  11137,
-   12987,  14693,  16009,  16948,
-   17615,  17921,  17679,  16948,
-   16081,  15339,  14682,  14043,
-   13629,  13725,  14294,  15011,
-   15668,  16307,  16924,  17271,
-   17077,  16307,  15065,  13397,
-   11368,   9205,   7169,   5326,
-    3616,   2103,    951,    161,
-    -477,  -1124,  -1771,  -2421,
-   -3229,  -4353,  -5812,  -7586,
-   -9699, -12100, -14585, -16948,
-  -19139, -21140, -22821, -24050,
-  -24856, -25336, -25497, -25341,
-  -25073, -25014, -25335, -25987,
-  -26868, -27919, -29060, -30184,
-  -31226, -32116, -32688, -32767,
-  -32329, -31470, -30221, -28570,
-  -26645, -24691, -22851, -21145,
-  -19658, -18557, -17841, -17271,
-  -16645, -15974, -15276, -14365,
-  -13006, -11132,  -8788,  -5972,
-   -2701,    812,    585,   2988,
-    5279,   7387,   9191,  10679,
-   11929,  12989,  13885,  14687,
-   15450,  16119,  16623,  17014,
-   17406,  17817,  18188,  18537,
-   18970,  19531,  20144,  20738,
-   21318,  21906,  22491,  23071,
-   23665,  24264,  24838,  25401,
-   26012,  26653,  27185,  27478,
-   27576,  27685,  27968,  28384,
-   28750,  28965,  29141,  29459,
-   29923,  30368,  30706,  31045,
-   31488,  31946,  32271,  32478,
-   32662,  32767,  32662,  32416,
-   32271,  32291,  32271,  32077,
-   31879,  31858,  31879,  31721,
-   31488,  31521,  31879,  32218,
-   32271,  32191,  32271,  32504,
-   32662,  32669,  32662,  32699,
-   32662,  32484,  32271,  32100,
-   31879,  31521,  31097,  30707,
-   30315,  29884,  29532,  29347,
-   29141,  28654,  27968,  27438,
-   27185,  26923,  26403,  25760,
-   25229,  24744,  24056,  23118,
-   22100,  21109,  20144,  19266,
-   18579,  18025,  17406,  16644,
-   15841,  15068,  14276,  13456,
-   12712,  12098,  11538,  10954,
-   10365,   9789,   9191,   8579,
-    8017,   7482,   6844,   6069,
-    5279,   4534,   3714,   2741,
-    1759,    937,    194,   -692,
-   -1761,  -2820,  -3717,  -4498,
-   -5282,  -6091,  -6846,  -7479,
-   -8020,  -8573,  -9193,  -9816,
-  -10367, -10908, -11540, -12193,
-  -12714, -13183, -13888, -14885,
-  -15843, -16495, -17017, -17721,
-  -18582, -19382, -20146, -21070,
-  -22102, -22981, -23667, -24394,
-  -25232, -25949, -26405, -26762,
-  -27188, -27619, -27970, -28322,
-  -28752, -29180, -29535, -29894,
-  -30317, -30733, -31099, -31486,
-  -31882, -32148, -32273, -32431,
-  -32664, -32767, -32664, -32590,
-  -32664, -32623, -32273, -31909,
-  -31882, -32009, -31882, -31567,
-  -31491, -31718, -31882, -31846,
-  -31882, -32110, -32273, -32243,
-  -32273, -32508, -32664, -32509,
-  -32273, -32247, -32273, -32010,
-  -31491, -31027, -30708, -30362,
-  -29926, -29511, -29144, -28747,
-  -28361, -28112, -27970, -27795,
-  -27579, -27407, -27188, -26716,
-  -26014, -25348, -24841, -24323,
-  -23667, -23009, -22493, -22000,
-  -21320, -20488, -19755, -19282,
-  -18973, -18634, -18191, -17745,
-  -17408, -17109, -16626, -15874,
-  -15061, -14427, -13888, -13112,
-  -11932, -10463,  -8802,  -6841,
-   -4499,  -1940,    585,   1552,
-    8079,  14004,  19128,  23322,
-   26578,  29035,  30866,  32133,
-   32767,  32664,  31807,  30319,
-   28436,  26444,  24593,  23062,
-   21951,  21260,  20855,  20471,
-   19853,  18928,  17842,  16842,
-   16135,  15818,  15858,  16065,
-   16136,  15818,  15057,  13992,
-   12817,  11671,  10605,   9586,
-    8560,   7525,   6547,   5698,
-    5034,   4674,   4798,   5439,
-    6320,   7006,   7231,   6994,
-    6386,   5451,   4241,   2848,
-    1296,   -508,  -2635,  -4926,
-   -7020,  -8542,  -9301,  -9332,
-   -8826,  -8024,  -7164,  -6481,
-   -6117,  -5951,  -5589,  -4667,
-   -3197,  -1545,    -81,   1033,
-    1763,   2082,   2083,   2070,
-    2387,   3119,   4010,   4662,
-    4805,   4415,   3671,   2848,
-    2236,   2082,   2497,   3366,
-    4379,   5192,   5578,   5439,
-    4768,   3637,   2178,    515,
-   -1224,  -2841,  -4103,  -4926,
-   -5417,  -5692,  -5764,  -5704,
-   -5729,  -5951,  -6146,  -5963,
-   -5314,  -4396,  -3432,  -2594,
-   -2090,  -2063,  -2356,  -2594,
-   -2511,  -2063,  -1277,   -261,
-     650,   1046,    822,    256,
-    -327,   -768,   -946,   -780,
-    -426,   -249,   -429,   -780,
-   -1023,  -1027,   -713,     -2,
-     972,   1823,   2258,   2329,
-    2233,   2082,   2025,   2329,
-    3119,   4156,   5073,   5698,
-    6005,   5970,   5686,   5439,
-    5419,   5451,   5229,   4662,
-    3802,   2601,   1008,   -780,
-   -2453,  -3877,  -5022,  -5704,
-   -5718,  -5173,  -4414,  -3630,
-   -2860,  -2322,  -2393,  -3112,
-   -4030,  -4655,  -4847,  -4667,
-   -4137,  -3359,  -2658,  -2335,
-   -2336,  -2322,  -2008,  -1298,
-    -181,   1305,   2957,   4403,
-    5324,   5711,   5878,   6217,
-    6898,   7784,   8588,   9068,
-    9035,   8302,   6781,   4662,
-    2369,    268,  -1535,  -3112,
-   -4507,  -5692,  -6625,  -7259,
-   -7497,  -7247,  -6558,  -5704,
-   -5067,  -4914,  -5266,  -5963,
-   -6832,  -7765,  -8692,  -9591,
-  -10537, -11652, -12949, -14256,
-  -15341, -16058, -16370, -16329,
-  -16125, -16058, -16375, -17107,
-  -18105, -19168, -20096, -20735,
-  -21116, -21501, -22196, -23327,
-  -24848, -26684, -28701, -30583,
-  -31951, -32645, -32767, -32398,
-  -31397, -29535, -26686, -22809,
-  -17864, -11912,  -5269,   1552,
-    3623,  10829,  15675,  17326,
-   16339,  14384,  13333,  14161,
-   16339,  18092,  17348,  12795,
-    4627,  -5143, -13102, -15781,
-  -11434,  -1012,  12329,  24559,
-   32067,  32767,  27053,  17927,
-    9646,   5602,   6975,  12733,
-   20355,  26739,  29395,  27558,
-   22363,  15836,   9652,   4530,
-     277,  -3841,  -8418, -13169,
-  -16789, -17655, -14776,  -8325,
-     277,   8717,  14671,  16951,
-   16004,  13368,  10656,   8807,
-    7639,   5751,   1286,  -6556,
-  -16454, -25399, -30169, -28681,
-  -20804,  -8705,   3628,  12061,
-   14331,  11018,   4967,   -145,
-   -1395,   2078,   8648,  15099,
-   18347,  16818,  10990,   3231,
-   -3069,  -5142,  -2394,   3393,
-    9312,  12780,  12329,   7957,
-    1281,  -4995,  -8418,  -7951,
-   -4073,   1941,   8648,  14701,
-   19016,  20900,  20025,  16364,
-   10316,   2887,  -4402,  -9916,
-  -12438, -11662,  -8418,  -4343,
-   -1061,    611,    951,   1071,
-    2285,   5258,   9317,  12527,
-   12658,   8427,    282,  -9500,
-  -17458, -20388, -17118,  -9389,
-   -1061,   3784,   2624,  -4491,
-  -14781, -23661, -26822, -22453,
-  -12104,    290,  10321,  14882,
-   13327,   7743,   1955,   -466,
-    1950,   8012,  14671,  18525,
-   17343,  11088,   1955,  -6720,
-  -12104, -13073, -10425,  -6170,
-   -2399,   -295,    282,    480,
-    1615,   4296,   7979,  11197,
-   12324,  10357,   5301,  -1921,
-   -9761, -16434, -20464, -21183,
-  -18796, -14020,  -7748,  -1075,
-    4627,   7957,   7979,   4639,
-   -1061,  -7191, -11429, -12032,
-   -8757,  -3105,   2290,   4796,
-    2954,  -2770, -10091, -15920,
-  -17792, -14959,  -8752,  -2131,
-    1615,    618,  -4402, -10439,
-  -13777, -11730,  -3733,   8342,
-   20689,  29058,  30734,  25777,
-   16674,   6815,  -1056,  -5750,
-   -7753,  -8661, -10091, -12633,
-  -15450, -16741, -14776,  -8965,
-    -392,   8565,  15340,  18314,
-   17343,  13556,   8648,   3988,
-     -57,  -4116,  -9087, -15245,
-  -21808, -27094, -29165, -26802,
-  -20470, -12542,  -6410,  -4926,
-   -9092, -17528, -26822, -32767,
-  -32182, -24440, -11764,   1794,
-   11989,  15913,  12998,   5114,
-   -4407, -12335, -16783, -17616,
-  -16119, -14219, -13437, -14011,
-  -14781, -13991, -10425,  -4122,
-    3623,   3306,   9758,  14045,
-   15692,  15189,  13744,  12895,
-   13721,  15955,  17902,  17495,
-   13626,   6756,  -1283,  -7803,
-  -10027,  -6276,   2928,  14811,
-   25577,  32055,  32767,  28228,
-   20739,  13656,  10061,  11362,
-   16708,  23622,  29279,  31677,
-   30261,  25922,  20380,  15195,
-   11010,   7522,   4063,    245,
-   -3659,  -6659,  -7365,  -4737,
-    1097,   8672,  15875,  20945,
-   23067,  22472,  20248,  17878,
-   16388,  15572,  14036,  10212,
-    3586,  -4743, -12398, -16620,
-  -15414,  -8576,   1905,  12512,
-   19741,  21705,  18876,  13662,
-    9180,   7906,  10680,  16345,
-   22173,  25155,  23635,  18261,
-   11540,   6372,   4676,   6762,
-   11399,  16339,  19224,  18645,
-   14749,   9056,   3710,    629,
-     821,   4073,   9213,  14811,
-   19736,  23238,  24784,  24011,
-   20837,  15572,   9031,   2545,
-   -2385,  -4743,  -4408,  -2054,
-    1199,   4073,   5567,   5612,
-    5274,   5989,   8385,  11745,
-   14384,  14422,  10637,   3312,
-   -5428, -12409, -14997, -12403,
-   -6033,   1006,   5071,   3695,
-   -2946, -12026, -19580, -22369,
-  -19026, -10493,    117,   8678,
-   12146,  10206,   5146,    245,
-   -1876,   -143,   4685,  10212,
-   13392,  12122,   6418,  -1670,
-   -9239, -13942, -14894, -12786,
-   -9320,  -6276,  -4662,  -4353,
-   -4367,  -3593,  -1527,   1395,
-    3988,   4839,   2971,  -1670,
-   -8176, -15092, -20969, -24669,
-  -25528, -23525, -19321, -13936,
-   -8367,  -3593,   -765,   -904,
-   -4139,  -9343, -14621, -18153,
-  -18760, -16242, -11632,  -7037,
-   -4785,  -6276, -11243, -17770,
-  -23041, -24675, -22038, -16620,
-  -11153,  -8193,  -9033, -13170,
-  -18309, -21225, -19396, -12403,
-   -2105,   8289,  15451,  17111,
-   13045,   5223,  -3314, -10103,
-  -14160, -15859, -16441, -17386,
-  -19471, -21992, -23113, -21219,
-  -16016,  -8576,   -794,   5229,
-    7949,   7139,   3922,   -137,
-   -4002,  -7426, -10762, -14703,
-  -19759, -25442, -30037, -31569,
-  -29152, -23525, -16681, -11253,
-   -9716, -13176, -20388, -28119,
-  -32767, -31958, -25275, -14320,
-   -2362,   6756,  10315,   7912,
-    1315,  -6659, -13332, -17003,
-  -17450, -15859, -14007, -13170,
-  -13472, -13942, -13082,  -9720,
-   -3825,   3306,   2318,   7825,
-   11627,  13101,  12888,  12204,
-   12049,  12897,  14579,  16175,
-   16277,  13857,   9083,   3408,
-   -1057,  -2353,    627,   7595,
-   16700,  25107,  30223,  30875,
-   27693,  22611,  17962,  15674,
-   16700,  20673,  25995,  30559,
-   32767,  32169,  29377,  25539,
-   21774,  18713,  16271,  13892,
-   11204,   8486,   6546,   6264,
-    8244,  12549,  18385,  24136,
-   28116,  29564,  28955,  27423,
-   26002,  25183,  24727,  23685,
-   20928,  16051,   9929,   4412,
-    1479,   2441,   7392,  14951,
-   22619,  27872,  29377,  27498,
-   23888,  20676,  19653,  21543,
-   25579,  29767,  31914,  30815,
-   26847,  21702,  17539,  16017,
-   17546,  21092,  24727,  26646,
-   26002,  23050,  18807,  14665,
-   12049,  11899,  14157,  17841,
-   21774,  25195,  27686,  28808,
-   28116,  25505,  21344,  16295,
-   11204,   7084,   4855,   4846,
-    6553,   8899,  10774,  11514,
-   11204,  10630,  10774,  12100,
-   14163,  15752,  15425,  12261,
-    6553,    -57,  -5291,  -7352,
-   -5707,  -1314,   3587,   6259,
-    4862,   -400,  -7405, -13332,
-  -15854, -13832,  -7828,   -241,
-    5707,   7843,   6123,   2159,
-   -1902,  -4081,  -3177,    387,
-    4439,   6369,   4855,    340,
-   -5707, -11526, -15438, -16468,
-  -15009, -12605, -10788, -10147,
-  -10358, -10680, -10365,  -9022,
-   -6976,  -5219,  -4868,  -6585,
-  -10358, -15524, -20935, -25389,
-  -28116, -28872, -27700, -24845,
-  -20928, -16913, -13747, -12116,
-  -12472, -14911, -18821, -22864,
-  -25579, -26075, -24317, -21110,
-  -17968, -16596, -17975, -21745,
-  -26424, -30173, -31505, -29856,
-  -26002, -21898, -19666, -20364,
-  -23465, -27216, -29391, -28171,
-  -23042, -15265,  -7405,  -2133,
-   -1056,  -4163,  -9942, -16149,
-  -20928, -23626, -24740, -25248,
-  -26002, -27372, -28968, -29633,
-  -28116, -24068, -18398, -12662,
-   -8244,  -5988,  -6137,  -8229,
-  -11204, -14005, -16284, -18502,
-  -21351, -25037, -28968, -31953,
-  -32767, -30795, -26431, -21063,
-  -16700, -15252, -17552, -22656,
-  -28116, -31215, -30236, -24988,
-  -16700,  -7679,   -640,   2402,
-    1057,  -3456,  -9096, -13837,
-  -16277, -16179, -14593, -13078,
-  -12472, -12427, -12056, -10662,
-   -7821,  -3345,   2318,   1341,
-    4453,   6712,   7856,   8239,
-    8494,   9012,   9846,  10922,
-   11989,  12461,  11717,   9772,
-    7473,   5946,   5975,   7856,
-   11417,  15910,  20098,  22802,
-   23494,  22425,  20417,  18587,
-   17963,  18976,  21247,  23952,
-   26321,  27790,  28004,  27018,
-   25425,  23958,  22900,  22036,
-   21111,  20126,  19220,  18587,
-   18604,  19742,  22098,  25102,
-   27851,  29707,  30517,  30467,
-   29917,  29323,  29021,  28934,
-   28569,  27407,  25343,  22802,
-   20542,  19359,  19825,  22036,
-   25440,  28940,  31351,  32000,
-   31049,  29323,  27846,  27401,
-   28271,  30090,  31934,  32767,
-   32056,  30090,  27726,  25868,
-   25086,  25491,  26748,  28168,
-   28951,  28557,  26970,  24718,
-   22598,  21275,  21006,  21653,
-   22883,  24341,  25686,  26635,
-   26999,  26641,  25393,  23186,
-   20313,  17443,  15237,  13988,
-   13643,  13994,  14670,  15137,
-   15003,  14377,  13772,  13605,
-   13898,  14377,  14598,  13988,
-   12088,   9012,   5578,   2874,
-    1665,   2113,   3751,   5556,
-    6297,   5179,   2326,  -1341,
-   -4588,  -6317,  -5922,  -3640,
-    -595,   1730,   2293,    958,
-   -1545,  -4018,  -5367,  -5173,
-   -3886,  -2485,  -1942,  -2874,
-   -5319,  -8616, -11661, -13605,
-  -14362, -14365, -14017, -13605,
-  -13503, -13982, -14761, -15137,
-  -14746, -13982, -13575, -13988,
-  -15307, -17431, -20087, -22802,
-  -25085, -26629, -27294, -27018,
-  -25907, -24329, -22776, -21653,
-  -21225, -21647, -22899, -24718,
-  -26653, -28162, -28740, -28168,
-  -26797, -25479, -25051, -25868,
-  -27738, -30078, -32038, -32767,
-  -31936, -30078, -28260, -27401,
-  -27841, -29311, -31047, -32000,
-  -31332, -28928, -25472, -22036,
-  -19633, -18964, -20201, -22802,
-  -25673, -27778, -28746, -28934,
-  -28983, -29311, -29914, -30467,
-  -30524, -29695, -27816, -25102,
-  -22156, -19730, -18371, -18203,
-  -18952, -20114, -21205, -22036,
-  -22826, -23946, -25476, -27018,
-  -27947, -27778, -26364, -23952,
-  -21192, -18964, -18010, -18587,
-  -20350, -22413, -23570, -22802,
-  -19874, -15515, -10987,  -7473,
-   -5726,  -5934,  -7615,  -9772,
-  -11416, -12066, -11789, -10922,
-   -9869,  -9000,  -8428,  -7856,
-   -6760,  -4784,  -1954,   1341,
-    2831,    561,  -1752,  -3865,
-   -5528,  -6726,  -7686,  -8595,
-   -9304,  -9471,  -9034,  -8341,
-   -7686,  -6925,  -5798,  -4462,
-   -3371,  -2708,  -2292,  -2023,
-   -2022,  -2278,  -2562,  -2837,
-   -3371,  -4220,  -4989,  -5358,
-   -5528,  -5803,  -6067,  -6045,
-   -5798,  -5506,  -4989,  -3948,
-   -2562,  -1286,   -134,   1304,
-    3101,   4786,   6067,   7216,
-    8495,   9669,  10382,  10649,
-   10652,  10341,   9573,   8444,
-    7146,   5670,   3910,   1926,
-    -134,  -2213,  -4180,  -5710,
-   -6607,  -7088,  -7416,  -7393,
-   -6607,  -5099,  -3371,  -1699,
-     134,   2340,   4719,   6957,
-    9034,  11093,  13079,  14763,
-   16046,  17052,  17934,  18704,
-   19282,  19630,  19822,  19972,
-   20091,  20061,  19822,  19503,
-   19282,  19155,  19012,  18900,
-   19012,  19392,  19822,  20112,
-   20361,  20797,  21440,  22027,
-   22249,  22006,  21440,  20725,
-   19822,  18486,  16585,  14319,
-   12001,   9678,   7146,   4336,
-    1483,  -1168,  -3640,  -6084,
-   -8495, -10694, -12540, -14030,
-  -15237, -16195, -16855, -17148,
-  -17125, -16985, -16855, -16605,
-  -16046, -15293, -14697, -14397,
-  -14158, -13770, -13349, -13115,
-  -13079, -13148, -13349, -13733,
-  -14158, -14405, -14428, -14283,
-  -13888, -13056, -11731, -10010,
-   -7955,  -5555,  -2831,    152,
-    3371,   6754,  10113,  13287,
-   16316,  19261,  21979,  24289,
-   26294,  28239,  30070,  31445,
-   32227,  32622,  32767,  32495,
-   31688,  30540,  29261,  27735,
-   25755,  23396,  20900,  18307,
-   15507,  12591,   9843,   7368,
-    4989,   2601,    404,  -1372,
-   -2831,  -4325,  -6067,  -7965,
-   -9843, -11698, -13619, -15566,
-  -17394, -19107, -20900, -22841,
-  -24676, -26145, -27373, -28677,
-  -30070, -31223, -31957, -32433,
-  -32767, -32764, -32227, -31262,
-  -30070, -28629, -26833, -24754,
-  -22518, -20085, -17394, -14625,
-  -12001,  -9469,  -6877,  -4376,
-   -2292,   -621,    943,   2468,
-    3640,   4299,   4719,   5166,
-    5528,   5654,   5798,   6373,
-    7416,   8622,   9843,  11219,
-   12810,  14400,  15776,  16990,
-   18203,  19397,  20361,  20941,
-   21170,  21153,  20900,  20308,
-   19282,  17835,  16046,  13987,
-   11731,   9404,   7146,   4991,
-    2831,  -7217,  -3713,   -521,
-    2043,   4322,   6810,   9479,
-   11633,  12528,  12139,  11274,
-   10876,  11246,  11980,  12556,
-   12878,  13297,  14302,  16146,
-   18515,  20478,  21122,  20506,
-   19683,  19452,  19273,  17941,
-   15264,  12528,  11151,  11274,
-   11888,  12015,  11558,  11274,
-   12119,  14323,  16874,  18198,
-   17648,  16118,  14925,  14351,
-   13606,  12015,   9786,   7684,
-    6339,   5861,   5745,   5119,
-    3467,   1245,   -533,  -1547,
-   -2747,  -5422,  -9765, -14625,
-  -18663, -21577, -24097, -26934,
-  -29903, -32091, -32767, -32063,
-  -30850, -30039, -29921, -30011,
-  -29535, -28244, -26803, -26165,
-  -26425, -26449, -24887, -21549,
-  -17573, -14140, -11212,  -7701,
-   -2851,   2783,   7805,  11274,
-   13410,  15092,  16901,  18711,
-   20008,  20478,  20385,  20506,
-   21556,  23555,  25772,  27429,
-   28401,  29196,  30343,  31789,
-   32767,  32274,  30006,  26916,
-   24457,  23042,  21636,  19223,
-   16295,  14323,  13955,  14351,
-   14274,  13297,  11883,  10761,
-   10327,  10220,   9414,   7171,
-    4043,   1501,    415,    247,
-     -99,  -1062,  -2202,  -2829,
-   -2598,  -1831,  -1456,  -2316,
-   -4306,  -6447,  -8043,  -9496,
-  -11759, -15166, -19003, -22062,
-  -23582, -23885, -24128, -25139,
-  -26472, -26962, -26229, -25139,
-  -24721, -25167, -26059, -26934,
-  -27338, -26962, -26149, -25652,
-  -25358, -23885, -20194, -15138,
-  -10578,  -7217,  -4165,   -521,
-    3512,   7143,   9800,  11274,
-   11754,  12015,  12913,  14351,
-   15272,  15092,  14633,  15120,
-   16597,  17913,  18133,  17428,
-   16583,  16118,  15972,  15633,
-   14417,  12015,   9073,   6914,
-    6262,   6374,   5906,   4607,
-    3593,   3809,   4750,   5119,
-    4320,   2783,   1141,   -265,
-   -1238,  -1831,  -2622,  -4111,
-   -5684,  -5934,  -4405,  -2316,
-   -1055,   -549,    205,   1529,
-    2763,   3296,   3053,   2042,
-     262,  -1831,  -3503,  -4624,
-   -5786,  -7217,  -8183,  -7958,
-   -7016,  -6704,  -7788,  -9753,
-  -11567, -12858, -14205, -16420,
-  -19648, -23116, -25727, -26934,
-  -27083, -26962, -27014, -26934,
-  -26003, -23885, -21166, -18985,
-  -17992, -17730, -17186, -15907,
-  -14396, -13371, -12847, -12061,
-  -10216,  -7217,  -1551,   3862,
-    8962,  13646,  17999,  22101,
-   25887,  28926,  30547,  30550,
-   29681,  29051,  29088,  29366,
-   29389,  29180,  29088,  29406,
-   30265,  31521,  32590,  32767,
-   32015,  31140,  30839,  30827,
-   30265,  28946,  27629,  27168,
-   27638,  28407,  28796,  28606,
-   28222,  28297,  29088,  29946,
-   29681,  27653,  24419,  21116,
-   18300,  15596,  12455,   9006,
-    6044,   4272,   3700,   3724,
-    3709,   3492,   3408,   3878,
-    4877,   5773,   5743,   4490,
-    2542,    728,   -676,  -2192,
-   -4460,  -7426, -10306, -12340,
-  -13507, -14516, -16142, -18528,
-  -21094, -23145, -24605, -26077,
-  -28097, -30379, -31900, -31799,
-  -30140, -27780, -25480, -23178,
-  -20218, -16301, -12057,  -8532,
-   -6211,  -4752,  -3594,  -2510,
-   -1542,   -786,   -384,   -382,
-    -375,    345,   1949,   3657,
-    4585,   4807,   5159,   6098,
-    7211,   7793,   7494,   6437,
-    5168,   4494,   4868,   5842,
-    6628,   7307,   8953,  12209,
-   16257,  19638,  21793,  23339,
-   25012,  26772,  27921,  27760,
-   26179,  23852,  21793,  20487,
-   19467,  17929,  15665,  13227,
-   11297,  10136,   9537,   9009,
-    8087,   6733,   5451,   4711,
-    4293,   3476,   1949,    277,
-    -667,   -552,    198,    882,
-    1083,    908,    782,    945,
-    1083,    500,  -1260,  -3956,
-   -6795,  -9055, -10598, -11800,
-  -12923, -13570, -12932, -10665,
-   -7379,  -4084,  -1260,   1379,
-    4293,   7536,  10704,  13233,
-   14798,  15650,  16540,  18016,
-   19759,  20918,  21209,  21336,
-   22094,  23330,  24127,  23855,
-   22677,  21109,  19458,  17775,
-   15966,  13774,  10996,   7995,
-    5752,   4957,   5159,   5258,
-    4877,   4785,   5743,   7385,
-    8670,   9141,   9245,   9539,
-   10129,  10872,  11579,  11857,
-   11297,  10130,   9245,   9148,
-    9254,   8636,   7202,   5626,
-    4293,   2900,   1074,  -1154,
-   -3585,  -6056,  -8263,  -9800,
-  -10589, -10928, -10889, -10064,
-   -8254,  -6129,  -4761,  -4620,
-   -5336,  -6381,  -7680,  -9553,
-  -12339, -16055, -20228, -24054,
-  -26930, -28899, -30441, -31824,
-  -32767, -32759, -31608, -29703,
-  -27806, -26466, -25480, -24050,
-  -21678, -18784, -16142, -13786,
-  -10880,  -6728,  -1551,  -1348,
-    3675,   9117,  14800,  20090,
-   24487,  27942,  30525,  32117,
-   32692,  32648,  32560,  32640,
-   32711,  32648,  32591,  32640,
-   32591,  32125,  31189,  30026,
-   28906,  27942,  27162,  26627,
-   26429,  26635,  27252,  28195,
-   29279,  30295,  31148,  31856,
-   32400,  32648,  32473,  31856,
-   30766,  28988,  26229,  22443,
-   17963,  13301,   8874,   4926,
-    1582,  -1078,  -2968,  -3963,
-   -3993,  -3170,  -1726,    220,
-    2718,   5718,   8870,  11724,
-   14069,  15915,  17203,  17737,
-   17432,  16438,  14954,  13031,
-   10642,   7810,   4587,   1004,
-   -2854,  -6830, -10839, -14944,
-  -19171, -23302, -26960, -29847,
-  -31796, -32715, -32658, -31938,
-  -30992, -30100, -29346, -28801,
-  -28591, -28793, -29400, -30370,
-  -31523, -32453, -32767, -32461,
-  -31854, -31146, -30335, -29585,
-  -29292, -29577, -30052, -30370,
-  -30713, -31407, -32258, -32723,
-  -32617, -32192, -31495, -30108,
-  -27637, -24086, -19596, -14159,
-   -7892,  -1340,   4793,  10155,
-   14745,  18530,  21308,  22966,
-   23681,  23759,  23367,  22443,
-   20841,  18530,  15670,  12508,
-    9226,   5980,   3035,    743,
-    -694,  -1340,  -1361,   -825,
-     256,   1797,   3642,   5710,
-    8036,  10686,  13676,  16953,
-   20382,  23759,  26862,  29503,
-   31501,  32648,  32767,  31856,
-   30188,  28204,  26266,  24535,
-   23103,  22190,  22057,  22705,
-   23812,  25066,  26426,  27934,
-   29414,  30557,  31240,  31594,
-   31779,  31864,  31896,  31856,
-   31562,  30818,  29693,  28457,
-   27179,  25589,  23404,  20613,
-   17337,  13562,   9168,   4142,
-   -1314,  -6830, -11991, -16512,
-  -20353, -23564, -26075, -27755,
-  -28662, -29054, -29108, -28801,
-  -28083, -26963, -25396, -23310,
-  -20797, -18073, -15232, -12329,
-   -9754,  -8138,  -7721,  -8146,
-   -9098, -10752, -13276, -16251,
-  -19080, -21733, -24566, -27494,
-  -29903, -31407, -32191, -32461,
-  -31978, -30361, -27561, -23833,
-  -19497, -14936, -10658,  -7100,
-   -4430,  -2647,  -1778,  -1871,
-   -2894,  -4739,  -7256, -10238,
-  -13456, -16766, -20050, -23049,
-  -25408, -26963, -27849, -28278,
-  -28330, -28008, -27313, -26186,
-  -24554, -22518, -20289, -17820,
-  -14723, -10752,  -6161,  -1348,
-   -2628,   3322,   8778,  13332,
-   16448,  17979,  18174,  17246,
-   15309,  12681,   9917,   7429,
-    5343,   3741,   2798,   2605,
-    3065,   4036,   5361,   6753,
-    7906,   8798,   9632,  10394,
-   10753,  10526,   9917,   9099,
-    7906,   6235,   4507,   3312,
-    2781,   2695,   3083,   4197,
-    5913,   7660,   9062,  10194,
-   11038,  11156,  10201,   8401,
-    6197,   3690,    805,  -2210,
-   -4906,  -7103,  -8874, -10126,
-  -10600, -10284,  -9444,  -8237,
-   -6614,  -4697,  -2895,  -1539,
-    -635,   -112,    -48,   -526,
-   -1489,  -2909,  -4888,  -7437,
-  -10316, -13272, -16277, -19348,
-  -22274, -24719, -26527, -27726,
-  -28254, -27890, -26527, -24402,
-  -21990, -19700, -17701, -16037,
-  -14871, -14509, -15138, -16609,
-  -18573, -20782, -23111, -25338,
-  -27115, -28235, -28805, -29058,
-  -29108, -28934, -28520, -27901,
-  -27115, -26180, -25104, -23885,
-  -22559, -21224, -19979, -18831,
-  -17719, -16595, -15423, -14120,
-  -12594, -10831,  -8874,  -6727,
-   -4336,  -1643,   1375,   4641,
-    7906,  10854,  13333,  15344,
-   16732,  17146,  16465,  15057,
-   13316,  11186,   8493,   5567,
-    3065,   1206,   -332,  -1716,
-   -2628,  -2788,  -2326,  -1390,
-     218,   2720,   5930,   9490,
-   13316,  17500,  21875,  25955,
-   29260,  31534,  32695,  32767,
-   31823,  29943,  27285,  24231,
-   21288,  18775,  16750,  15264,
-   14454,  14287,  14472,  14791,
-   15309,  16107,  17035,  17904,
-   18725,  19533,  20167,  20451,
-   20434,  20199,  19597,  18418,
-   16732,  14813,  12764,  10471,
-    7906,   5265,   2798,    637,
-   -1204,  -2759,  -4034,  -4963,
-   -5475,  -5659,  -5742,  -5871,
-   -6045,  -6321,  -6881,  -7796,
-   -8892, -10002, -11152, -12365,
-  -13448, -14179, -14569, -14771,
-  -14871, -14944, -15138, -15528,
-  -16010, -16511, -17131, -17899,
-  -18573, -18937, -19124, -19385,
-  -19712, -19974, -20263, -20773,
-  -21420, -21884, -21972, -21657,
-  -20851, -19470, -17701, -15861,
-  -14017, -12036, -10013,  -8319,
-   -7184,  -6540,  -6312,  -6544,
-   -7184,  -8055,  -9159, -10732,
-  -12878, -15381, -17986, -20653,
-  -23413, -26183, -28805, -31054,
-  -32524, -32767, -31652, -29368,
-  -25976, -21299, -15423,  -8968,
-   -2628,   2326,   8553,  13618,
-   17317,  19383,  19919,  19391,
-   18101,  15972,  13017,   9682,
-    6533,   3901,   2035,   1285,
-    1731,   2851,   3915,   4696,
-    5490,   6525,   7666,   8632,
-    9149,   8886,   7565,   5221,
-    2157,  -1347,  -4986,  -8162,
-  -10216, -11056, -11158, -10786,
-   -9624,  -7382,  -4365,  -1076,
-    2327,   5737,   8534,   9944,
-    9919,   9149,   8198,   7058,
-    5587,   3901,   2176,    497,
-    -907,  -1609,  -1410,   -551,
-     689,   2326,   4328,   6270,
-    7689,   8624,   9443,  10207,
-   10514,   9936,   8324,   5746,
-    2447,  -1084,  -4329,  -7112,
-   -9595, -11844, -13673, -14984,
-  -15939, -16567, -16469, -15247,
-  -13165, -11056,  -9556,  -8686,
-   -8226,  -8170,  -8622,  -9474,
-  -10520, -11844, -13758, -16296,
-  -18948, -21028, -22163, -22332,
-  -21637, -20241, -18438, -16559,
-  -14742, -12893, -10835,  -8424,
-   -5628,  -2659,    -18,   1809,
-    2749,   3113,   3205,   3121,
-    2943,   2851,   2896,   2859,
-    2575,   2326,   2676,   3909,
-    5781,   7837,   9794,  11519,
-   12797,  13348,  13103,  12306,
-   11195,   9674,   7483,   4696,
-    1843,   -560,  -2438,  -3963,
-   -5135,  -5808,  -6042,  -6062,
-   -5797,  -4758,  -2539,    760,
-    4746,   9149,  13801,  18342,
-   22283,  25419,  27957,  30151,
-   31891,  32767,  32490,  31200,
-   29375,  27518,  25963,  24902,
-   24420,  24369,  24322,  23852,
-   22944,  22007,  21478,  21491,
-   21918,  22532,  23028,  23065,
-   22492,  21483,  20329,  19129,
-   17738,  15972,  13733,  10994,
-    7812,   4425,   1291,  -1076,
-   -2370,  -2659,  -2294,  -1601,
-    -677,    489,   1809,   3121,
-    4359,   5475,   6223,   6270,
-    5618,   4688,   3863,   3121,
-    2257,   1276,    344,   -551,
-   -1621,  -2921,  -4135,  -4750,
-   -4457,  -3446,  -2325,  -1601,
-   -1187,   -560,    545,   1809,
-    2787,   3376,   3582,   3121,
-    1672,   -560,  -2929,  -5013,
-   -6874,  -8695, -10464, -12098,
-  -13509, -14468, -14689, -14197,
-  -13390, -12631, -12010, -11573,
-  -11449, -11581, -11650, -11573,
-  -11862, -13156, -15508, -18396,
-  -21329, -24177, -26926, -29417,
-  -31385, -32575, -32767, -31779,
-  -29434, -25489, -19784, -12623,
-   -4913,   2326,   1368,   4961,
-    7395,   9025,  10396,  12067,
-   14235,  16477,  18057,  18594,
-   18339,  17829,  17510,  17701,
-   18612,  20075,  21340,  21448,
-   19980,  17421,  14774,  12795,
-   11499,  10287,   8481,   5766,
-    2197,  -1975,  -6291,  -9989,
-  -12301, -13056, -12857, -12500,
-  -12301, -12065, -11489, -10401,
-   -8745,  -6678,  -4650,  -3129,
-   -2179,  -1450,   -546,    789,
-    2745,   5342,   8208,  10722,
-   12594,  14130,  15868,  18105,
-   20801,  23674,  26264,  28147,
-   29282,  30015,  30641,  31158,
-   31471,  31503,  30915,  29080,
-   25726,  21437,  17236,  13785,
-   11226,   9472,   8208,   6734,
-    4386,   1237,  -1914,  -4350,
-   -6009,  -7310,  -8753, -10741,
-  -13396, -16348, -18876, -20402,
-  -20783, -20218, -19150, -18238,
-  -18047, -18517, -18876, -18172,
-  -15858, -12020,  -7386,  -3088,
-       9,   1964,   3557,   5426,
-    7669,  10186,  12859,  15206,
-   16424,  16219,  15321,  14787,
-   15056,  15952,  17236,  18611,
-   19433,  19049,  17510,  15535,
-   13688,  11906,   9849,   7344,
-    4386,   1041,  -2461,  -5732,
-   -8471, -10676, -12584, -14513,
-  -16679, -18951, -20791, -21628,
-  -21330, -20243, -18876, -17729,
-  -17226, -17381, -17508, -16657,
-  -14490, -11517,  -8480,  -5833,
-   -3820,  -2497,  -1367,    556,
-    3839,   7935,  11764,  14803,
-   17244,  19317,  21066,  22813,
-   25178,  28267,  31189,  32767,
-   32565,  31002,  28726,  26304,
-   24358,  23400,  23255,  22968,
-   21622,  19186,  16415,  14053,
-   12320,  11031,   9849,   8336,
-    6028,   2759,  -1093,  -4787,
-   -7651,  -9389, -10121, -10274,
-  -10386, -10816, -11489, -11956,
-  -11754, -10777,  -9301,  -7722,
-   -6283,  -4969,  -3555,  -1702,
-     830,   3884,   6840,   9003,
-   10131,  10524,  10670,  11014,
-   12046,  14185,  17236,  20224,
-   22169,  23025,  23528,  24203,
-   24905,  25290,  25170,  24217,
-   21895,  18168,  13953,  10376,
-    7669,   5158,   2189,  -1379,
-   -5462,  -9910, -14225, -17615,
-  -19688, -20914, -22159, -23899,
-  -25981, -27925, -29272, -29819,
-  -29811, -29839, -30366, -31329,
-  -32273, -32767, -32555, -31481,
-  -29537, -27051, -24621, -22723,
-  -21330, -19863, -17508, -13739,
-   -8745,  -3382,   1368,  -5550,
-   -1281,   5350,  13282,  18638,
-   18322,  12960,   6407,   2331,
-    1186,    458,  -2104,  -5550,
-   -6140,   -900,   9112,  19182,
-   24822,  25463,  24271,  24346,
-   25311,  23832,  17333,   6951,
-   -3168,  -9326, -11095, -10986,
-  -11430, -12044, -10013,  -3376,
-    6162,  14047,  16714,  14561,
-   11074,   9155,   8435,   6136,
-     473,  -6880, -11798, -11258,
-   -5926,    730,   5763,   9126,
-   12946,  18668,  24904,  28151,
-   25897,  19212,  12011,   7495,
-    5428,   3176,   -824,  -5007,
-   -5990,  -1715,   6482,  14561,
-   18775,  18668,  17125,  17007,
-   17769,  15950,   9118,  -1202,
-  -10723, -16120, -17485, -17509,
-  -18450, -19654, -18138, -12073,
-   -3625,   2360,   2806,   -930,
-   -5012,  -7151,  -8360, -11258,
-  -17127, -24274, -28871, -27837,
-  -21472, -13131,  -5948,   -114,
-    6319,  14319,  22119,  26520,
-   25637,  20571,  14661,  10756,
-    8768,   6166,   1367,  -3648,
-   -4811,    -85,   8367,  16192,
-   20569,  21929,  22554,  23802,
-   24502,  21929,  14639,   4505,
-   -4315,  -8782,  -9387,  -9084,
-   -9843, -10413,  -7684,   -386,
-    8747,  14863,  15245,  11572,
-    7779,   5894,   4229,   -386,
-   -8858, -18295, -24102, -23760,
-  -18810, -13131,  -9148,  -5822,
-    -529,   7253,  14543,  17279,
-   14074,   7524,   1836,   -930,
-   -2329,  -5249, -10177, -13976,
-  -12643,  -5249,   4985,  13474,
-   17983,  19755,  21301,  23259,
-   23470,  19212,  10356,    156,
-   -7344, -10685, -11692, -12889,
-  -14413, -13674,  -8146,   1515,
-   11262,  16765,  16923,  14290,
-   12113,  11058,   8871,   3146,
-   -5615, -13674, -16942, -14519,
-   -9377,  -5249,  -2857,    428,
-    7073,  15950,  22764,  23802,
-   19148,  12417,   7452,   5049,
-    2699,  -2259,  -9123, -13704,
-  -12042,  -4162,   5966,  14018,
-   18705,  21929,  25977,  30597,
-   32767,  29540,  21289,  11843,
-    5122,   1817,   -348,  -3376,
-   -6500,  -6880,  -2482,   5592,
-   13361,  16765,  14890,  10484,
-    6915,   4535,    542,  -7453,
-  -18213, -27536, -31880, -31099,
-  -27874, -24818, -22101, -17781,
-  -10568,  -2259,   3037,   2602,
-   -2139,  -7151, -10162, -12889,
-  -18373, -26449, -32767, -32730,
-  -26050, -16936,  -9858,  -5550,
-  -32767, -32767, -32483, -32483,
-  -31915, -31915, -31632, -31632,
-  -31348, -31348, -30781, -30781,
-  -30497, -30497, -30213, -30213,
-  -29930, -29930, -29362, -29362,
-  -29078, -29078, -28795, -28795,
-  -28227, -28227, -27944, -27944,
-  -27660, -27660, -27093, -27093,
-  -26809, -26809, -26241, -26241,
-  -25958, -25958, -25674, -25674,
-  -25107, -25107, -24823, -24823,
-  -24256, -24256, -23972, -23972,
-  -23405, -23405, -23121, -23121,
-  -22553, -22553, -22270, -22270,
-  -21702, -21702, -21419, -21419,
-  -20851, -20851, -20568, -20568,
-  -20000, -20000, -19716, -19716,
-  -19149, -19149, -18865, -18865,
-  -18298, -18298, -18014, -18014,
-  -17447, -17447, -16879, -16879,
-  -16596, -16596, -16028, -16028,
-  -15745, -15745, -15177, -15177,
-  -14610, -14610, -14326, -14326,
-  -13759, -13759, -13191, -13191,
-  -12908, -12908, -12340, -12340,
-  -11773, -11773, -11489, -11489,
-  -10922, -10922, -10354, -10354,
-  -10071, -10071,  -9503,  -9503,
-   -8936,  -8936,  -8369,  -8369,
-   -8085,  -8085,  -7517,  -7517,
-   -6950,  -6950,  -6383,  -6383,
-   -5815,  -5815,  -5532,  -5532,
-   -4964,  -4964,  -4397,  -4397,
-   -3829,  -3829,  -3262,  -3262,
-   -2695,  -2695,  -2411,  -2411,
-   -1844,  -1844,  -1276,  -1276,
-    -709,   -709,   -141,   -141,
-     425,    425,    992,    992,
-    1560,   1560,   2127,   2127,
-    2695,   2695,   3262,   3262,
-    3829,   3829,   4113,   4113,
-    4681,   4681,   5248,   5248,
-    5815,   5815,   6383,   6383,
-    6950,   6950,   7801,   7801,
-    8369,   8369,   8936,   8936,
-    9503,   9503,  10071,  10071,
-   10638,  10638,  11206,  11206,
-   11773,  11773,  12340,  12340,
-   12908,  12908,  13475,  13475,
-   14043,  14043,  14894,  14894,
-   15461,  15461,  16028,  16028,
-   16596,  16596,  17163,  17163,
-   17731,  17731,  18582,  18582,
-   19149,  19149,  19716,  19716,
-   20284,  20284,  20851,  20851,
-   21702,  21702,  22270,  22270,
-   22837,  22837,  23405,  23405,
-   24256,  24256,  24823,  24823,
-   25390,  25390,  26241,  26241,
-   26809,  26809,  27376,  27376,
-   27944,  27944,  28795,  28795,
-   29362,  29362,  29930,  29930,
-   30781,  30781,  31348,  31348,
-   32199,  32199,  32767,  32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -129,   -129,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767, -32767, -32767,
-  -31212, -31212, -29399, -29399,
-  -27845, -27845, -26291, -26291,
-  -24737, -24737, -22923, -22923,
-  -21369, -21369, -19815, -19815,
-  -18520, -18520, -16966, -16966,
-  -15412, -15412, -14117, -14117,
-  -12821, -12821, -11526, -11526,
-  -10231, -10231,  -8936,  -8936,
-   -7900,  -7900,  -6864,  -6864,
-   -5828,  -5828,  -4792,  -4792,
-   -4014,  -4014,  -3237,  -3237,
-   -2460,  -2460,  -1683,  -1683,
-   -1165,  -1165,   -647,   -647,
-    -129,   -129,    129,    129,
-     388,    388,    647,    647,
-     647,    647,    906,    906,
-     647,    647,    647,    647,
-     388,    388,    129,    129,
-    -129,   -129,   -647,   -647,
-   -1165,  -1165,  -1683,  -1683,
-   -2460,  -2460,  -3237,  -3237,
-   -4014,  -4014,  -4792,  -4792,
-   -5828,  -5828,  -6864,  -6864,
-   -7900,  -7900,  -8936,  -8936,
-  -10231, -10231, -11526, -11526,
-  -12821, -12821, -14117, -14117,
-  -15412, -15412, -16966, -16966,
-  -18520, -18520, -19815, -19815,
-  -21369, -21369, -22923, -22923,
-  -24737, -24737, -26291, -26291,
-  -27845, -27845, -29399, -29399,
-  -31212, -31212, -32767, -32767,
-   32767,  32767,  30953,  30953,
-   29399,  29399,  27845,  27845,
-   26291,  26291,  24478,  24478,
-   22923,  22923,  21369,  21369,
-   20074,  20074,  18520,  18520,
-   16966,  16966,  15671,  15671,
-   14376,  14376,  13080,  13080,
-   11785,  11785,  10490,  10490,
-    9454,   9454,   8418,   8418,
-    7382,   7382,   6346,   6346,
-    5569,   5569,   4792,   4792,
-    4014,   4014,   3237,   3237,
-    2719,   2719,   2201,   2201,
-    1683,   1683,   1424,   1424,
-    1165,   1165,    906,    906,
-     906,    906,    906,    906,
-     906,    906,    906,    906,
-    1165,   1165,   1424,   1424,
-    1683,   1683,   2201,   2201,
-    2719,   2719,   3237,   3237,
-    4014,   4014,   4792,   4792,
-    5569,   5569,   6346,   6346,
-    7382,   7382,   8418,   8418,
-    9454,   9454,  10490,  10490,
-   11785,  11785,  13080,  13080,
-   14376,  14376,  15671,  15671,
-   16966,  16966,  18520,  18520,
-   20074,  20074,  21369,  21369,
-   22923,  22923,  24478,  24478,
-   26291,  26291,  27845,  27845,
-   29399,  29399,  30953,  30953,
-   32767,  32767, -32767,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464,    128,
-    -128,   -128,   1670,   1670,
-    3212,   3212,   4754,   4754,
-    6296,   6296,   7838,   7838,
-    9637,   9637,  10922,  10922,
-   12464,  12464,  14006,  14006,
-   15548,  15548,  16833,  16833,
-   18118,  18118,  19403,  19403,
-   20688,  20688,  21973,  21973,
-   23258,  23258,  24286,  24286,
-   25314,  25314,  26342,  26342,
-   27370,  27370,  28141,  28141,
-   28912,  28912,  29683,  29683,
-   30197,  30197,  30968,  30968,
-   31482,  31482,  31739,  31739,
-   32253,  32253,  32510,  32510,
-   32510,  32510,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32510,  32510,  32510,  32510,
-   32253,  32253,  31739,  31739,
-   31482,  31482,  30968,  30968,
-   30197,  30197,  29683,  29683,
-   28912,  28912,  28141,  28141,
-   27370,  27370,  26342,  26342,
-   25314,  25314,  24286,  24286,
-   23258,  23258,  21973,  21973,
-   20688,  20688,  19403,  19403,
-   18118,  18118,  16833,  16833,
-   15548,  15548,  14006,  14006,
-   12464,  12464,  10922,  10922,
-    9637,   9637,   7838,   7838,
-    6296,   6296,   4754,   4754,
-    3212,   3212,   1670,   1670,
-     128,    128,  -1670,  -1670,
-   -3212,  -3212,  -4754,  -4754,
-   -6296,  -6296,  -7838,  -7838,
-   -9637,  -9637, -10922, -10922,
-  -12464, -12464, -14006, -14006,
-  -15548, -15548, -16833, -16833,
-  -18118, -18118, -19403, -19403,
-  -20688, -20688, -21973, -21973,
-  -23258, -23258, -24286, -24286,
-  -25314, -25314, -26342, -26342,
-  -27370, -27370, -28141, -28141,
-  -28912, -28912, -29683, -29683,
-  -30197, -30197, -30968, -30968,
-  -31482, -31482, -31739, -31739,
-  -32253, -32253, -32510, -32510,
-  -32510, -32510, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32510, -32510, -32510, -32510,
-  -32253, -32253, -31739, -31739,
-  -31482, -31482, -30968, -30968,
-  -30197, -30197, -29683, -29683,
-  -28912, -28912, -28141, -28141,
-  -27370, -27370, -26342, -26342,
-  -25314, -25314, -24286, -24286,
-  -23258, -23258, -21973, -21973,
-  -20688, -20688, -19403, -19403,
-  -18118, -18118, -16833, -16833,
-  -15548, -15548, -14006, -14006,
-  -12464, -12464, -10922, -10922,
-   -9637,  -9637,  -7838,  -7838,
-   -6296,  -6296,  -4754,  -4754,
-   -3212,  -3212,  -1670,  -1670,
-    -128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    385,
-     385,    899,    899,   1156,
-    1156,   1927,   1927,   2441,
-    2441,   3469,   3469,   4497,
-    4497,   5525,   5525,   6810,
-    6810,   8352,   8352,   9894,
-    9894,  11693,  11693,  13235,
-   13235,  15034,  15034,  17090,
-   17090,  18889,  18889,  20688,
-   20688,  22487,  22487,  24286,
-   24286,  25828,  25828,  27370,
-   27370,  28655,  28655,  29940,
-   29940,  30968,  30968,  31739,
-   31739,  32253,  32253,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32253,  32253,  31739,
-   31739,  30968,  30968,  29940,
-   29940,  28655,  28655,  27370,
-   27370,  25828,  25828,  24286,
-   24286,  22487,  22487,  20688,
-   20688,  18889,  18889,  17090,
-   17090,  15034,  15034,  13235,
-   13235,  11693,  11693,   9894,
-    9894,   8352,   8352,   6810,
-    6810,   5525,   5525,   4497,
-    4497,   3469,   3469,   2441,
-    2441,   1927,   1927,   1156,
-    1156,    899,    899,    385,
-     385,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -385,
-    -385,   -899,   -899,  -1156,
-   -1156,  -1927,  -1927,  -2441,
-   -2441,  -3469,  -3469,  -4497,
-   -4497,  -5525,  -5525,  -6810,
-   -6810,  -8352,  -8352,  -9894,
-   -9894, -11693, -11693, -13235,
-  -13235, -15034, -15034, -17090,
-  -17090, -18889, -18889, -20688,
-  -20688, -22487, -22487, -24286,
-  -24286, -25828, -25828, -27370,
-  -27370, -28655, -28655, -29940,
-  -29940, -30968, -30968, -31739,
-  -31739, -32253, -32253, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32253, -32253, -31739,
-  -31739, -30968, -30968, -29940,
-  -29940, -28655, -28655, -27370,
-  -27370, -25828, -25828, -24286,
-  -24286, -22487, -22487, -20688,
-  -20688, -18889, -18889, -17090,
-  -17090, -15034, -15034, -13235,
-  -13235, -11693, -11693,  -9894,
-   -9894,  -8352,  -8352,  -6810,
-   -6810,  -5525,  -5525,  -4497,
-   -4497,  -3469,  -3469,  -2441,
-   -2441,  -1927,  -1927,  -1156,
-   -1156,   -899,   -899,   -385,
-    -385,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    385,    385,
-     385,    385,    642,    642,
-    1156,   1156,   1670,   1670,
-    2441,   2441,   3469,   3469,
-    4497,   4497,   5782,   5782,
-    7324,   7324,   9123,   9123,
-   10922,  10922,  12978,  12978,
-   15291,  15291,  17604,  17604,
-   19660,  19660,  21973,  21973,
-   24286,  24286,  26342,  26342,
-   28141,  28141,  29683,  29683,
-   30968,  30968,  31996,  31996,
-   32510,  32510,  32767,  32767,
-   32510,  32510,  31996,  31996,
-   30968,  30968,  29683,  29683,
-   28141,  28141,  26342,  26342,
-   24286,  24286,  21973,  21973,
-   19660,  19660,  17604,  17604,
-   15291,  15291,  12978,  12978,
-   10922,  10922,   9123,   9123,
-    7324,   7324,   5782,   5782,
-    4497,   4497,   3469,   3469,
-    2441,   2441,   1670,   1670,
-    1156,   1156,    642,    642,
-     385,    385,    385,    385,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -385,   -385,
-    -385,   -385,   -642,   -642,
-   -1156,  -1156,  -1670,  -1670,
-   -2441,  -2441,  -3469,  -3469,
-   -4497,  -4497,  -5782,  -5782,
-   -7324,  -7324,  -9123,  -9123,
-  -10922, -10922, -12978, -12978,
-  -15291, -15291, -17604, -17604,
-  -19660, -19660, -21973, -21973,
-  -24286, -24286, -26342, -26342,
-  -28141, -28141, -29683, -29683,
-  -30968, -30968, -31996, -31996,
-  -32510, -32510, -32767, -32767,
-  -32510, -32510, -31996, -31996,
-  -30968, -30968, -29683, -29683,
-  -28141, -28141, -26342, -26342,
-  -24286, -24286, -21973, -21973,
-  -19660, -19660, -17604, -17604,
-  -15291, -15291, -12978, -12978,
-  -10922, -10922,  -9123,  -9123,
-   -7324,  -7324,  -5782,  -5782,
-   -4497,  -4497,  -3469,  -3469,
-   -2441,  -2441,  -1670,  -1670,
-   -1156,  -1156,   -642,   -642,
-    -385,   -385,   -385,   -385,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,    128, -32767,
-  -32767, -31739, -31739, -30711,
-  -30711, -29683, -29683, -28655,
-  -28655, -27627, -27627, -26599,
-  -26599, -25571, -25571, -24543,
-  -24543, -23515, -23515, -22487,
-  -22487, -21202, -21202, -20174,
-  -20174, -19146, -19146, -18118,
-  -18118, -17090, -17090, -16062,
-  -16062, -15034, -15034, -14006,
-  -14006, -12978, -12978, -11950,
-  -11950, -10922, -10922,  -9894,
-   -9894,  -8866,  -8866,  -7838,
-   -7838,  -6810,  -6810,  -5782,
-   -5782,  -4754,  -4754,  -3726,
-   -3726,  -2698,  -2698,  -1670,
-   -1670,   -642,   -642,    642,
-     642,   1670,   1670,   2698,
-    2698,   3726,   3726,   4754,
-    4754,   5782,   5782,   6810,
-    6810,   7838,   7838,   8866,
-    8866,   9894,   9894,  10922,
-   10922,  11950,  11950,  12978,
-   12978,  14006,  14006,  15034,
-   15034,  16062,  16062,  17090,
-   17090,  18118,  18118,  19146,
-   19146,  20174,  20174,  21202,
-   21202,  22487,  22487,  23515,
-   23515,  24543,  24543,  25571,
-   25571,  26599,  26599,  27627,
-   27627,  28655,  28655,  29683,
-   29683,  30711,  30711,  31739,
-   31739,  32767,  32767,  32767,
-   32767,  31739,  31739,  30711,
-   30711,  29683,  29683,  28655,
-   28655,  27627,  27627,  26599,
-   26599,  25571,  25571,  24543,
-   24543,  23515,  23515,  22487,
-   22487,  21202,  21202,  20174,
-   20174,  19146,  19146,  18118,
-   18118,  17090,  17090,  16062,
-   16062,  15034,  15034,  14006,
-   14006,  12978,  12978,  11950,
-   11950,  10922,  10922,   9894,
-    9894,   8866,   8866,   7838,
-    7838,   6810,   6810,   5782,
-    5782,   4754,   4754,   3726,
-    3726,   2698,   2698,   1670,
-    1670,    642,    642,   -642,
-    -642,  -1670,  -1670,  -2698,
-   -2698,  -3726,  -3726,  -4754,
-   -4754,  -5782,  -5782,  -6810,
-   -6810,  -7838,  -7838,  -8866,
-   -8866,  -9894,  -9894, -10922,
-  -10922, -11950, -11950, -12978,
-  -12978, -14006, -14006, -15034,
-  -15034, -16062, -16062, -17090,
-  -17090, -18118, -18118, -19146,
-  -19146, -20174, -20174, -21202,
-  -21202, -22487, -22487, -23515,
-  -23515, -24543, -24543, -25571,
-  -25571, -26599, -26599, -27627,
-  -27627, -28655, -28655, -29683,
-  -29683, -30711, -30711, -31739,
-  -31739, -32767, -32767, -32767,
-  -32767, -32767, -32199, -32199,
-  -31348, -31348, -30497, -30497,
-  -29930, -29930, -29078, -29078,
-  -28227, -28227, -27660, -27660,
-  -26809, -26809, -25958, -25958,
-  -25107, -25107, -24256, -24256,
-  -23405, -23405, -22553, -22553,
-  -21702, -21702, -20851, -20851,
-  -20000, -20000, -19149, -19149,
-  -18298, -18298, -17447, -17447,
-  -16596, -16596, -15461, -15461,
-  -14610, -14610, -13759, -13759,
-  -12624, -12624, -11773, -11773,
-  -10638, -10638,  -9787,  -9787,
-   -8652,  -8652,  -7801,  -7801,
-   -6666,  -6666,  -5815,  -5815,
-   -4681,  -4681,  -3546,  -3546,
-   -2411,  -2411,  -1560,  -1560,
-    -425,   -425,    709,    709,
-    1844,   1844,   2978,   2978,
-    4113,   4113,   5248,   5248,
-    6383,   6383,   7517,   7517,
-    8652,   8652,   9787,   9787,
-   10922,  10922,  12057,  12057,
-   13475,  13475,  14610,  14610,
-   15745,  15745,  17163,  17163,
-   18298,  18298,  19716,  19716,
-   20851,  20851,  22270,  22270,
-   23405,  23405,  24823,  24823,
-   25958,  25958,  27376,  27376,
-   28795,  28795,  29930,  29930,
-   31348,  31348,  32767,  32767,
-  -32767, -32767, -32199, -32199,
-  -31348, -31348, -30497, -30497,
-  -29930, -29930, -29078, -29078,
-  -28227, -28227, -27660, -27660,
-  -26809, -26809, -25958, -25958,
-  -25107, -25107, -24256, -24256,
-  -23405, -23405, -22553, -22553,
-  -21702, -21702, -20851, -20851,
-  -20000, -20000, -19149, -19149,
-  -18298, -18298, -17447, -17447,
-  -16596, -16596, -15461, -15461,
-  -14610, -14610, -13759, -13759,
-  -12624, -12624, -11773, -11773,
-  -10638, -10638,  -9787,  -9787,
-   -8652,  -8652,  -7801,  -7801,
-   -6666,  -6666,  -5815,  -5815,
-   -4681,  -4681,  -3546,  -3546,
-   -2411,  -2411,  -1560,  -1560,
-    -425,   -425,    709,    709,
-    1844,   1844,   2978,   2978,
-    4113,   4113,   5248,   5248,
-    6383,   6383,   7517,   7517,
-    8652,   8652,   9787,   9787,
-   10922,  10922,  12057,  12057,
-   13475,  13475,  14610,  14610,
-   15745,  15745,  17163,  17163,
-   18298,  18298,  19716,  19716,
-   20851,  20851,  22270,  22270,
-   23405,  23405,  24823,  24823,
-   25958,  25958,  27376,  27376,
-   28795,  28795,  29930,  29930,
-   31348,  31348,  32767,  32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -130,   -130,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -130,   -130,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767,
-};
-
-
-
-const int16_t* wavetable_table[] = {
-  wt_waves,
-};
-
-const int16_t ws_smooth_bipolar_fold[] IN_RAM = {
-  -32767, -32704, -32641, -32577,
-  -32512, -32447, -32381, -32314,
-  -32246, -32178, -32109, -32039,
-  -31969, -31898, -31826, -31753,
-  -31680, -31606, -31531, -31455,
-  -31378, -31301, -31223, -31145,
-  -31065, -30985, -30904, -30822,
-  -30739, -30656, -30572, -30487,
-  -30401, -30314, -30227, -30139,
-  -30050, -29960, -29870, -29778,
-  -29686, -29594, -29500, -29406,
-  -29310, -29214, -29118, -29020,
-  -28922, -28823, -28723, -28622,
-  -28521, -28419, -28316, -28212,
-  -28108, -28003, -27897, -27790,
-  -27683, -27575, -27466, -27356,
-  -27246, -27135, -27023, -26911,
-  -26798, -26684, -26570, -26455,
-  -26339, -26223, -26106, -25988,
-  -25870, -25751, -25632, -25511,
-  -25391, -25270, -25148, -25026,
-  -24903, -24779, -24655, -24531,
-  -24406, -24281, -24155, -24029,
-  -23902, -23775, -23647, -23519,
-  -23391, -23262, -23133, -23004,
-  -22874, -22744, -22614, -22483,
-  -22352, -22221, -22090, -21959,
-  -21827, -21695, -21563, -21431,
-  -21299, -21167, -21035, -20902,
-  -20770, -20637, -20505, -20373,
-  -20240, -20108, -19976, -19844,
-  -19712, -19581, -19449, -19318,
-  -19187, -19056, -18925, -18795,
-  -18665, -18536, -18407, -18278,
-  -18150, -18022, -17894, -17768,
-  -17641, -17515, -17390, -17266,
-  -17142, -17018, -16895, -16774,
-  -16652, -16532, -16412, -16293,
-  -16175, -16058, -15942, -15826,
-  -15712, -15598, -15486, -15375,
-  -15264, -15155, -15047, -14939,
-  -14833, -14729, -14625, -14523,
-  -14422, -14322, -14224, -14126,
-  -14031, -13936, -13843, -13752,
-  -13662, -13573, -13486, -13401,
-  -13317, -13234, -13154, -13075,
-  -12997, -12921, -12847, -12775,
-  -12705, -12636, -12569, -12504,
-  -12441, -12379, -12320, -12262,
-  -12206, -12153, -12101, -12051,
-  -12003, -11958, -11914, -11872,
-  -11833, -11795, -11760, -11727,
-  -11696, -11667, -11640, -11616,
-  -11594, -11574, -11556, -11540,
-  -11527, -11516, -11507, -11501,
-  -11496, -11495, -11495, -11498,
-  -11503, -11510, -11520, -11532,
-  -11547, -11564, -11583, -11604,
-  -11628, -11655, -11683, -11714,
-  -11748, -11784, -11822, -11862,
-  -11905, -11950, -11998, -12048,
-  -12100, -12155, -12212, -12271,
-  -12333, -12397, -12463, -12531,
-  -12602, -12675, -12750, -12828,
-  -12907, -12989, -13073, -13159,
-  -13248, -13338, -13431, -13525,
-  -13622, -13721, -13821, -13924,
-  -14029, -14136, -14244, -14355,
-  -14467, -14581, -14697, -14815,
-  -14934, -15056, -15179, -15303,
-  -15429, -15557, -15686, -15817,
-  -15950, -16083, -16219, -16355,
-  -16493, -16632, -16773, -16914,
-  -17057, -17201, -17346, -17492,
-  -17639, -17787, -17936, -18086,
-  -18236, -18388, -18540, -18692,
-  -18846, -19000, -19154, -19309,
-  -19464, -19620, -19776, -19932,
-  -20089, -20245, -20402, -20559,
-  -20716, -20873, -21029, -21186,
-  -21342, -21498, -21654, -21809,
-  -21964, -22118, -22272, -22425,
-  -22578, -22730, -22881, -23031,
-  -23180, -23328, -23476, -23622,
-  -23767, -23911, -24053, -24195,
-  -24335, -24473, -24610, -24746,
-  -24880, -25012, -25142, -25271,
-  -25398, -25523, -25646, -25767,
-  -25886, -26003, -26118, -26231,
-  -26341, -26449, -26554, -26657,
-  -26758, -26856, -26951, -27044,
-  -27134, -27221, -27306, -27387,
-  -27466, -27542, -27615, -27684,
-  -27751, -27814, -27874, -27931,
-  -27985, -28035, -28082, -28126,
-  -28166, -28202, -28235, -28265,
-  -28290, -28312, -28331, -28346,
-  -28356, -28363, -28367, -28366,
-  -28361, -28353, -28340, -28324,
-  -28304, -28279, -28250, -28218,
-  -28181, -28140, -28095, -28045,
-  -27992, -27934, -27872, -27805,
-  -27735, -27660, -27580, -27497,
-  -27409, -27317, -27220, -27119,
-  -27014, -26904, -26790, -26672,
-  -26549, -26422, -26290, -26154,
-  -26014, -25869, -25720, -25567,
-  -25409, -25247, -25080, -24910,
-  -24735, -24555, -24372, -24184,
-  -23992, -23796, -23595, -23390,
-  -23182, -22969, -22752, -22531,
-  -22305, -22076, -21843, -21606,
-  -21365, -21120, -20871, -20618,
-  -20362, -20102, -19838, -19570,
-  -19299, -19024, -18746, -18464,
-  -18179, -17890, -17598, -17303,
-  -17004, -16702, -16397, -16089,
-  -15778, -15464, -15146, -14826,
-  -14504, -14178, -13850, -13519,
-  -13185, -12849, -12510, -12169,
-  -11826, -11480, -11132, -10782,
-  -10430, -10075,  -9719,  -9361,
-   -9001,  -8639,  -8276,  -7911,
-   -7545,  -7177,  -6807,  -6436,
-   -6064,  -5691,  -5317,  -4941,
-   -4565,  -4188,  -3810,  -3431,
-   -3051,  -2671,  -2291,  -1910,
-   -1528,  -1146,   -764,   -382,
-       0,    382,    764,   1146,
-    1528,   1910,   2291,   2671,
-    3051,   3431,   3810,   4188,
-    4565,   4941,   5317,   5691,
-    6064,   6436,   6807,   7177,
-    7545,   7911,   8276,   8639,
-    9001,   9361,   9719,  10075,
-   10430,  10782,  11132,  11480,
-   11826,  12169,  12510,  12849,
-   13185,  13519,  13850,  14178,
-   14504,  14826,  15146,  15464,
-   15778,  16089,  16397,  16702,
-   17004,  17303,  17598,  17890,
-   18179,  18464,  18746,  19024,
-   19299,  19570,  19838,  20102,
-   20362,  20618,  20871,  21120,
-   21365,  21606,  21843,  22076,
-   22305,  22531,  22752,  22969,
-   23182,  23390,  23595,  23796,
-   23992,  24184,  24372,  24555,
-   24735,  24910,  25080,  25247,
-   25409,  25567,  25720,  25869,
-   26014,  26154,  26290,  26422,
-   26549,  26672,  26790,  26904,
-   27014,  27119,  27220,  27317,
-   27409,  27497,  27580,  27660,
-   27735,  27805,  27872,  27934,
-   27992,  28045,  28095,  28140,
-   28181,  28218,  28250,  28279,
-   28304,  28324,  28340,  28353,
-   28361,  28366,  28367,  28363,
-   28356,  28346,  28331,  28312,
-   28290,  28265,  28235,  28202,
-   28166,  28126,  28082,  28035,
-   27985,  27931,  27874,  27814,
-   27751,  27684,  27615,  27542,
-   27466,  27387,  27306,  27221,
-   27134,  27044,  26951,  26856,
-   26758,  26657,  26554,  26449,
-   26341,  26231,  26118,  26003,
-   25886,  25767,  25646,  25523,
-   25398,  25271,  25142,  25012,
-   24880,  24746,  24610,  24473,
-   24335,  24195,  24053,  23911,
-   23767,  23622,  23476,  23328,
-   23180,  23031,  22881,  22730,
-   22578,  22425,  22272,  22118,
-   21964,  21809,  21654,  21498,
-   21342,  21186,  21029,  20873,
-   20716,  20559,  20402,  20245,
-   20089,  19932,  19776,  19620,
-   19464,  19309,  19154,  19000,
-   18846,  18692,  18540,  18388,
-   18236,  18086,  17936,  17787,
-   17639,  17492,  17346,  17201,
-   17057,  16914,  16773,  16632,
-   16493,  16355,  16219,  16083,
-   15950,  15817,  15686,  15557,
-   15429,  15303,  15179,  15056,
-   14934,  14815,  14697,  14581,
-   14467,  14355,  14244,  14136,
-   14029,  13924,  13821,  13721,
-   13622,  13525,  13431,  13338,
-   13248,  13159,  13073,  12989,
-   12907,  12828,  12750,  12675,
-   12602,  12531,  12463,  12397,
-   12333,  12271,  12212,  12155,
-   12100,  12048,  11998,  11950,
-   11905,  11862,  11822,  11784,
-   11748,  11714,  11683,  11655,
-   11628,  11604,  11583,  11564,
-   11547,  11532,  11520,  11510,
-   11503,  11498,  11495,  11495,
-   11496,  11501,  11507,  11516,
-   11527,  11540,  11556,  11574,
-   11594,  11616,  11640,  11667,
-   11696,  11727,  11760,  11795,
-   11833,  11872,  11914,  11958,
-   12003,  12051,  12101,  12153,
-   12206,  12262,  12320,  12379,
-   12441,  12504,  12569,  12636,
-   12705,  12775,  12847,  12921,
-   12997,  13075,  13154,  13234,
-   13317,  13401,  13486,  13573,
-   13662,  13752,  13843,  13936,
-   14031,  14126,  14224,  14322,
-   14422,  14523,  14625,  14729,
-   14833,  14939,  15047,  15155,
-   15264,  15375,  15486,  15598,
-   15712,  15826,  15942,  16058,
-   16175,  16293,  16412,  16532,
-   16652,  16774,  16895,  17018,
-   17142,  17266,  17390,  17515,
-   17641,  17768,  17894,  18022,
-   18150,  18278,  18407,  18536,
-   18665,  18795,  18925,  19056,
-   19187,  19318,  19449,  19581,
-   19712,  19844,  19976,  20108,
-   20240,  20373,  20505,  20637,
-   20770,  20902,  21035,  21167,
-   21299,  21431,  21563,  21695,
-   21827,  21959,  22090,  22221,
-   22352,  22483,  22614,  22744,
-   22874,  23004,  23133,  23262,
-   23391,  23519,  23647,  23775,
-   23902,  24029,  24155,  24281,
-   24406,  24531,  24655,  24779,
-   24903,  25026,  25148,  25270,
-   25391,  25511,  25632,  25751,
-   25870,  25988,  26106,  26223,
-   26339,  26455,  26570,  26684,
-   26798,  26911,  27023,  27135,
-   27246,  27356,  27466,  27575,
-   27683,  27790,  27897,  28003,
-   28108,  28212,  28316,  28419,
-   28521,  28622,  28723,  28823,
-   28922,  29020,  29118,  29214,
-   29310,  29406,  29500,  29594,
-   29686,  29778,  29870,  29960,
-   30050,  30139,  30227,  30314,
-   30401,  30487,  30572,  30656,
-   30739,  30822,  30904,  30985,
-   31065,  31145,  31223,  31301,
-   31378,  31455,  31531,  31606,
-   31680,  31753,  31826,  31898,
-   31969,  32039,  32109,  32178,
-   32246,  32314,  32381,  32447,
-   32512,  32577,  32641,  32704,
-   32704,
-};
-
-
-
-const int16_t* waveshaper_table[] = {
-  ws_smooth_bipolar_fold,
-};
-
+}  // namespace parasites
 
 }  // namespace tides
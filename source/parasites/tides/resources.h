@@ -46,8 +46,6 @@ extern const uint16_t* lookup_table_table[];
 
 extern const uint32_t* lookup_table_32_table[];
 
-extern const int16_t* waveform_table[];
-
 extern const int16_t* wavetable_table[];
 
 extern const int16_t* waveshaper_table[];
@@ -56,6 +54,21 @@ extern const uint16_t lut_attenuverter_curve[];
 extern const uint16_t lut_slope_compression[];
 extern const uint32_t lut_increments[];
 extern const uint32_t lut_cutoff[];
+extern const int16_t wav_inverse_tan_audio[];
+extern const int16_t wav_inverse_sin_audio[];
+extern const int16_t wav_linear_audio[];
+extern const int16_t wav_sin_audio[];
+extern const int16_t wav_tan_audio[];
+extern const int16_t wav_bipolar_fold[];
+extern const int16_t wav_unipolar_fold[];
+extern const int16_t wt_waves[];
+extern const int16_t ws_smooth_bipolar_fold[] IN_RAM;
+
+// vb: the tables above are the ones of the original tides, defined by
+// mutableSources32/tides/resources.cc. These differ or only exist here.
+inline namespace parasites {
+
+extern const int16_t* waveform_table[];
 extern const int16_t wav_sine1024[];
 extern const int16_t wav_sine128[];
 extern const int16_t wav_sine64[];
@@ -76,11 +89,6 @@ extern const int16_t wav_bandlimited_parabola_12[];
 extern const int16_t wav_bandlimited_parabola_13[];
 extern const int16_t wav_bandlimited_parabola_14[];
 extern const int16_t wav_bandlimited_parabola_15[];
-extern const int16_t wav_inverse_tan_audio[];
-extern const int16_t wav_inverse_sin_audio[];
-extern const int16_t wav_linear_audio[];
-extern const int16_t wav_sin_audio[];
-extern const int16_t wav_tan_audio[];
 extern const int16_t wav_reversed_control[];
 extern const int16_t wav_spiky_exp_control[];
 extern const int16_t wav_spiky_control[];
@@ -88,10 +96,9 @@ extern const int16_t wav_linear_control[];
 extern const int16_t wav_bump_control[];
 extern const int16_t wav_bump_exp_control[];
 extern const int16_t wav_normal_control[];
-extern const int16_t wav_bipolar_fold[];
-extern const int16_t wav_unipolar_fold[];
-extern const int16_t wt_waves[];
-extern const int16_t ws_smooth_bipolar_fold[] IN_RAM;
+
+}  // namespace parasites
+
 #define LUT_ATTENUVERTER_CURVE 0
 #define LUT_ATTENUVERTER_CURVE_SIZE 257
 #define LUT_SLOPE_COMPRESSION 1
@@ -41,10 +41,11 @@
 #include "braids/signature_waveshaper.h"
 #include "braids/quantizer_scales.h"
 #include "braids/vco_jitter_source.h"
+#include "stmlib/dsp/polyphase_resampler.h"
+#include "stmlib/utils/random.h"
+#include "denormals.h"
+#include "vector_ops.h"
 
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
 #include "samplerate.h"
 
 
@@ -108,11 +109,17 @@ struct t_myObj {
     long            sigvs;
     double          last_in;
     
-    // resampler
+    // resampler, polyphase for the usual host rates, libsamplerate otherwise
+    stmlib::PolyphaseResampler  *resampler;
+    bool            polyphase;
+    float           resampled[kAudioBlockSize * 6];
+    long            num_resampled;
     SRC_STATE       *src_state;
     PROCESS_CB_DATA pd;
     float           *samples;
     double          ratio;
+    uint32_t        rng_state;
+    stmlib::PendingSeed seed;
     
 };
 
@@ -139,6 +146,7 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
         }
 
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         self->ratio = self->sr / kSampleRate;
         
         self->pd.osc = new braids::MacroOscillator;
@@ -190,6 +198,10 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
         
         self->samples = (float *)sysmem_newptrclear(1024 * sizeof(float));
         
+        self->resampler = new stmlib::PolyphaseResampler;
+        self->polyphase = self->resampler->Init((double)kSampleRate, self->sr);
+        self->num_resampled = 0;
+        
         
         // process attributes
         attr_args_process(self, argc, argv);
@@ -346,10 +358,38 @@ src_input_callback(void *cb_data, float **audio)
 
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
+// renders blocks at 96 kHz until one block at the host rate is ready, like
+// src_callback_read() does, so the parameters change at the same points
+static void resample_polyphase(t_myObj *self, float *output)
+{
+    float   *resampled = self->resampled;
+    long    n = self->num_resampled;
+    
+    while(n < kAudioBlockSize) {
+        float *audio;
+        long input_frames = src_input_callback(&self->pd, &audio);
+        n += self->resampler->Process(audio, resampled + n, input_frames);
+    }
+    
+    std::copy(resampled, resampled + kAudioBlockSize, output);
+    std::copy(resampled + kAudioBlockSize, resampled + n, resampled);
+    self->num_resampled = n - kAudioBlockSize;
+}
+
+
+
 #pragma mark -------- DSP Loop ----------
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *pitch_cv = ins[0];     // V/OCT
     double  *timbre_cv = ins[1];    // timber CV
     double  *color_cv = ins[2];     // color CV
@@ -367,6 +407,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     ratio = self->ratio;
     timbre_pot = self->timbre_pot;
@@ -384,6 +426,7 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     braids::Quantizer *quantizer = self->quantizer;
     braids::VcoJitterSource *jitter_source = &self->jitter_source;
     SRC_STATE   *src_state = self->src_state;
+    bool        polyphase = self->polyphase;
     
     for(count = 0; count < vs; count += kAudioBlockSize) {
         output = samples + count;
@@ -412,13 +455,7 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         
         // detect trigger
         if(trig_connected) {
-            double sum = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(trigger_cv+count, 1, &sum, kAudioBlockSize);
-#else
-            for(int i=0; i<kAudioBlockSize; ++i)
-                sum += trigger_cv[i+count];
-#endif
+            double sum = vbmi::vec::Sum(trigger_cv+count, kAudioBlockSize);
             bool trigger = sum != 0.0;
             trigger_flag |= (trigger && (!self->last_trig));
             self->last_trig = trigger;
@@ -429,17 +466,14 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         }
         
         // render
-        src_callback_read(src_state, ratio, kAudioBlockSize, output);
+        if(polyphase)
+            resample_polyphase(self, output);
+        else
+            src_callback_read(src_state, ratio, kAudioBlockSize, output);
     }
     
     // copy and type cast output samples from 'float' to 'double'
-#ifdef __APPLE__
-    vDSP_vspdp(samples, 1, outs[0], 1, vs);
-#else
-    for(int i=0; i<vs; ++i) {
-        outs[0][i] = (double)samples[i];
-    }
-#endif
+    vbmi::vec::Convert(samples, outs[0], vs);
     
     self->trigger_flag = trigger_flag;
     
@@ -448,6 +482,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
 
 void myObj_perform64_no_resamp(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *pitch_cv = ins[0];     // V/OCT
     double  *timbre_cv = ins[1];    // timber CV
     double  *color_cv = ins[2];     // color CV
@@ -460,6 +496,8 @@ void myObj_perform64_no_resamp(t_myObj* self, t_object* dsp64, double** ins, lon
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     float       *samples;
     int16_t     timbre, color, count;
@@ -524,13 +562,7 @@ void myObj_perform64_no_resamp(t_myObj* self, t_object* dsp64, double** ins, lon
         
         // detect trigger
         if(trig_connected) {
-            double sum = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(trigger_cv+count, 1, &sum, kAudioBlockSize);
-#else
-            for(int i=0; i<kAudioBlockSize; ++i)
-                sum += trigger_cv[i+count];
-#endif
+            double sum = vbmi::vec::Sum(trigger_cv+count, kAudioBlockSize);
             bool trigger = sum != 0.0;
             trigger_flag |= (trigger && (!self->last_trig));
             self->last_trig = trigger;
@@ -568,6 +600,8 @@ void myObj_perform64OLD(t_myObj* self, t_object* dsp64, double** ins, long numin
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     int16_t     *buffer = self->buffer;
     uint8_t     *sync_buffer = self->sync_buffer;
@@ -635,7 +669,8 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
     if(samplerate != self->sr) {
         self->sr = samplerate;
         self->ratio = self->sr / kSampleRate;
-        
+        self->polyphase = self->resampler->Init((double)kSampleRate, self->sr);
+        self->num_resampled = 0;
     }
     
     if(self->resamp) {
@@ -657,6 +692,7 @@ void myObj_free(t_myObj* self)
     dsp_free((t_pxobject*)self);
     delete self->pd.osc;
     delete self->quantizer;
+    delete self->resampler;
     
     if(self->samples)
         sysmem_freeptr(self->samples);
@@ -709,6 +745,7 @@ void ext_main(void* r) {
 //    class_addmethod(this_class, (method)myObj_shape,    "model",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_bang,     "bang",  0);
     class_addmethod(this_class, (method)myObj_float,    "float",    A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,     "seed",     A_LONG, 0);
 
     
 //    class_addmethod(this_class, (method)myObj_set_sampleRate,    "sr",      A_LONG, 0);
@@ -32,15 +32,19 @@
 
 #include "c74_msp.h"
 
+#include <atomic>
+
 #include "clouds/dsp/granular_processor.h"
 #include "clouds/resources.h"
 #include "clouds/dsp/audio_buffer.h"
 #include "clouds/dsp/mu_law.h"
 #include "clouds/dsp/sample_rate_converter.h"
+#include "clouds/dsp/snapshot.h"
+#include "stmlib/utils/random.h"
+#include "denormals.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
 
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
 
 // original sample rate is 32 kHz
 
@@ -63,6 +67,7 @@ enum ModParams {
 };
 
 static t_class* this_class = nullptr;
+t_symbol *ps_sleep;
 
 
 struct t_myObj {
@@ -95,19 +100,49 @@ struct t_myObj {
     
     t_buffer_ref *buf_ref;
     t_symbol    buf_name;
+    t_buffer_ref *source_ref;   // buffer~ the grains play from
+    bool        use_source;
+    
+    // snapshots are opened in the main thread and restored in perform
+    clouds::Snapshot    *snapshot;
+    std::atomic<bool>   snapshot_pending;
+    bool        snapshot_restored;
+    t_qelem     *snapshot_qelem;
     
     clouds::SampleRateConverter<-clouds::kDownsamplingFactor, 45, clouds::src_filter_1x_2_45> src_down_;
     clouds::SampleRateConverter<+clouds::kDownsamplingFactor, 45, clouds::src_filter_1x_2_45> src_up_;
+    uint32_t    rng_state;
+    stmlib::PendingSeed seed;
+    
+    // sleep mode
+    vbmi::SleepDetector sleep_detector;
+    char        sleep;
+    double      sleep_threshold;
+    double      sleep_time;
+    long        buffer_size;    // size of the recording buffer in bytes
+    void        *info_out;
+    t_qelem     *sleep_qelem;
     
 };
 
 
-void* myObj_new(long size_in_ms) {
+void myObj_restored(t_myObj *self);
+void myObj_sleep_report(t_myObj *self);
+void update_sleep_time(t_myObj *self);
+
+
+void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
 	t_myObj* self = (t_myObj*)object_alloc(this_class);
 	
     if(self)
     {
+        // buffer size in ms (optional), followed by attributes
+        long size_in_ms = 0;
+        if(attr_args_offset(argc, argv) > 0)
+            size_in_ms = atom_getlong(argv);
+        
         dsp_setup((t_pxobject*)self, 10);
+        self->info_out = outlet_new((t_object *)self, NULL);
         outlet_new(self, "signal");
         outlet_new(self, "signal");
         
@@ -122,6 +157,7 @@ void* myObj_new(long size_in_ms) {
         }
 
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         self->bypass = false;
         
         int largeBufSize = 118784;
@@ -144,6 +180,9 @@ void* myObj_new(long size_in_ms) {
         self->processor->set_low_fidelity(false);
         self->processor->set_playback_mode(clouds::PLAYBACK_MODE_GRANULAR);
         
+        self->snapshot = new clouds::Snapshot;
+        self->snapshot_qelem = qelem_new(self, (method)myObj_restored);
+        
         // init values
         self->pot_value_[PARAM_PITCH] = self->smoothed_value_[PARAM_PITCH] = 0.f;
         self->pot_value_[PARAM_POSITION] = self->smoothed_value_[PARAM_POSITION] = 0.f;
@@ -163,8 +202,15 @@ void* myObj_new(long size_in_ms) {
         self->src_down_.Init();
         self->src_up_.Init();
         
+        self->buffer_size = largeBufSize;
+        self->sleep_detector.Init(self->sr > 0.0 ? self->sr : 48000.0);
+        self->sleep_threshold = vbmi::kDefaultSleepThreshold;
+        self->sleep_time = vbmi::kDefaultSleepTime;
+        update_sleep_time(self);
+        self->sleep_qelem = qelem_new(self, (method)myObj_sleep_report);
+        
         // process attributes
-        //attr_args_process(self, argc, argv);
+        attr_args_process(self, argc, argv);
         
     }
     else {
@@ -301,6 +347,12 @@ void myObj_lofi(t_myObj *self, long m) {
     self->processor->set_low_fidelity(m != 0);
 }
 
+// maximum number of grains, 0 = as many as the module (32 - 57)
+void myObj_grains(t_myObj *self, long n) {
+    CONSTRAIN(n, 0, clouds::kMaxNumGrains);
+    self->processor->set_max_num_grains(n);
+}
+
 void myObj_bypass(t_myObj *self, long n) {
 //    self->processor->set_bypass(n != 0);
     self->bypass = n != 0;
@@ -315,6 +367,8 @@ void myObj_coef(t_myObj *self, double m) {
 
 t_max_err myObj_notify(t_myObj *self, t_symbol *s, t_symbol *msg, void *sender, void *data)
 {
+    if (self->source_ref)
+        buffer_ref_notify(self->source_ref, s, msg, sender, data);
     return buffer_ref_notify(self->buf_ref, s, msg, sender, data);
 }
 
@@ -341,10 +395,169 @@ void myObj_info(t_myObj *self) {
 }
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
+#pragma mark -------- sleep mode ----------
+
+t_max_err sleep_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep = atom_getlong(av) != 0;
+        self->sleep_detector.set_enabled(self->sleep);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_threshold_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_threshold = CLAMP(atom_getfloat(av), -140., 0.);
+        self->sleep_detector.set_threshold(self->sleep_threshold);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_time_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_time = CLAMP(atom_getfloat(av), 10., 60000.);
+        update_sleep_time(self);
+    }
+    return MAX_ERR_NONE;
+}
+
+// the grains keep playing what is in the recording buffer, so clds~ only
+// sleeps once the whole buffer has been filled with silence. In lofi mode
+// it holds one mu-law byte per channel at half the sample rate, the longest
+// of all resolutions: buffer_size / 2 samples at sr / 2.
+void update_sleep_time(t_myObj *self) {
+    double sr = self->sr > 0.0 ? self->sr : 48000.0;
+    double buffer_ms = self->buffer_size * 1000.0 / sr;
+    self->sleep_detector.set_hang_time(std::max(self->sleep_time, buffer_ms));
+}
+
+// 'sleep 1' when clds~ fell asleep, 'sleep 0' when it woke up
+void myObj_sleep_report(t_myObj *self) {
+    t_atom a;
+    atom_setlong(&a, self->sleep_detector.sleeping());
+    outlet_anything(self->info_out, ps_sleep, 1, &a);
+}
+
+
+
+#pragma mark -------- snapshots ----------
+
+// write the recording buffers (the spectral buffers in spectral mode),
+// playback mode and parameters to a file, to be recalled with 'read'.
+// 'write' without a file name opens a dialog, 'mulaw' stores 16 bit
+// buffers as 8 bit mu-law, at half the size.
+void myObj_dowrite(t_myObj *self, t_symbol *s, long argc, t_atom *argv) {
+    t_symbol *name = gensym("");
+    clouds::SnapshotEncoding encoding = clouds::SNAPSHOT_ENCODING_PCM;
+    for (long i = 0; i < argc; i++) {
+        t_symbol *arg = atom_getsym(argv + i);
+        if (arg == gensym("mulaw"))
+            encoding = clouds::SNAPSHOT_ENCODING_MU_LAW;
+        else if (arg != gensym(""))
+            name = arg;
+    }
+    
+    char filename[MAX_FILENAME_CHARS];
+    short path = 0;
+    t_fourcc type = 'CLDS';
+    t_fourcc outtype;
+    
+    if (name == gensym("")) {
+        strncpy_zero(filename, "clouds.clds", MAX_FILENAME_CHARS);
+        if (saveasdialog_extended(filename, &path, &outtype, &type, 1))
+            return;     // canceled
+    }
+    else if (path_frompotentialpathname(name->s_name, &path, filename)) {
+        // no full path, use the default folder
+        strncpy_zero(filename, name->s_name, MAX_FILENAME_CHARS);
+        path = path_getdefault();
+    }
+    
+    char fullpath[MAX_PATH_CHARS];
+    char nativepath[MAX_PATH_CHARS];
+    path_toabsolutesystempath(path, filename, fullpath);
+    path_nameconform(fullpath, nativepath, PATH_STYLE_NATIVE, PATH_TYPE_ABSOLUTE);
+    
+    int32_t written = clouds::WriteSnapshot(self->processor, nativepath, encoding);
+    if (written < 0)
+        object_error((t_object*)self, "can't write %s", nativepath);
+    else if (written != encoding)
+        object_warn((t_object*)self, "lofi and spectral buffers are written as they are");
+}
+
+void myObj_write(t_myObj *self, t_symbol *s, long argc, t_atom *argv) {
+    defer_low(self, (method)myObj_dowrite, s, argc, argv);
+}
+
+
+// restore a snapshot, freezes the buffer. it has to come from an object
+// with the same buffer size (size argument and sample rate).
+void myObj_doread(t_myObj *self, t_symbol *name, long argc, t_atom *argv) {
+    if (self->snapshot_pending) {
+        object_error((t_object*)self, "still restoring the last snapshot");
+        return;
+    }
+    
+    char filename[MAX_FILENAME_CHARS];
+    short path = 0;
+    t_fourcc type = 'CLDS';
+    t_fourcc outtype;
+    
+    if (name == gensym("")) {
+        if (open_dialog(filename, &path, &outtype, &type, 1))
+            return;     // canceled
+    }
+    else {
+        strncpy_zero(filename, name->s_name, MAX_FILENAME_CHARS);
+        if (locatefile_extended(filename, &path, &outtype, NULL, 0)) {
+            object_error((t_object*)self, "can't find %s", name->s_name);
+            return;
+        }
+    }
+    
+    char fullpath[MAX_PATH_CHARS];
+    char nativepath[MAX_PATH_CHARS];
+    path_toabsolutesystempath(path, filename, fullpath);
+    path_nameconform(fullpath, nativepath, PATH_STYLE_NATIVE, PATH_TYPE_ABSOLUTE);
+    
+    if (!self->snapshot->Open(nativepath)) {
+        object_error((t_object*)self, "%s is not a clouds snapshot", filename);
+        return;
+    }
+    // picked up at the start of the next signal vector
+    self->snapshot_pending = true;
+}
+
+void myObj_read(t_myObj *self, t_symbol *name) {
+    defer_low(self, (method)myObj_doread, name, 0, NULL);
+}
+
+void myObj_restored(t_myObj *self) {
+    if (!self->snapshot_restored)
+        object_error((t_object*)self, "snapshot doesn't match the buffer size of this object");
+    // a read that came in before the qelem fired has opened the next
+    // snapshot already, perform may be restoring from it
+    if (!self->snapshot_pending)
+        self->snapshot->Close();
+}
+
+
+
 #pragma mark -------- DSP Loop ----------
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *inL = ins[0];      // audio in L
     double  *inR = ins[1];      // audio in R
     double  *gate_in = ins[8];  // freeze input (inlet 8)
@@ -357,6 +570,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     if (self->bypass) {
         std::copy(&inL[0], &inL[vs], &outL[0]);
@@ -379,6 +594,35 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     clouds::GranularProcessor   *gp = self->processor;
     clouds::Parameters   *p = gp->mutable_parameters();
     
+    if (self->snapshot_pending) {
+        self->snapshot_restored = clouds::RestoreSnapshot(gp, *self->snapshot);
+        if (self->snapshot_restored) {
+            pot_value[PARAM_PITCH] = smoothed_value[PARAM_PITCH] = p->pitch;
+            pot_value[PARAM_POSITION] = smoothed_value[PARAM_POSITION] = p->position;
+            pot_value[PARAM_SIZE] = smoothed_value[PARAM_SIZE] = p->size;
+            pot_value[PARAM_DENSITY] = smoothed_value[PARAM_DENSITY] = p->density;
+            pot_value[PARAM_TEXTURE] = smoothed_value[PARAM_TEXTURE] = p->texture;
+            pot_value[PARAM_DRYWET] = smoothed_value[PARAM_DRYWET] = p->dry_wet;
+            self->freeze = true;
+        }
+        self->snapshot_pending = false;
+        qelem_set(self->snapshot_qelem);
+    }
+    
+    // the grains read straight from the buffer~, it stays locked for the
+    // whole vector
+    t_buffer_obj *source = NULL;
+    float       *source_samples = NULL;
+    if (self->use_source && self->source_ref) {
+        source = buffer_ref_getobject(self->source_ref);
+        if (source)
+            source_samples = buffer_locksamples(source);
+    }
+    if (source_samples)
+        gp->set_external_buffer(source_samples, buffer_getframecount(source), buffer_getchannelcount(source));
+    else
+        gp->set_external_buffer(NULL, 0, 0);
+    
     
     for(count = 0; count < vs; count += kAudioBlockSize) {
         
@@ -409,14 +653,7 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         
         // gate & trigger
         if(gate_connected) {
-            double gate_sum = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(gate_in+count, 1, &gate_sum, kAudioBlockSize);
-#else
-            for(int i=0; i<kAudioBlockSize; ++i) {
-                gate_sum = gate_in[i+count];
-            }
-#endif
+            double gate_sum = vbmi::vec::Sum(gate_in+count, kAudioBlockSize);
             p->freeze = (gate_sum != 0.0) || self->freeze;
         }
         else {
@@ -424,19 +661,21 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         }
         
         if(trig_connected) {
-            double trig_sum = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(trig_in+count, 1, &trig_sum, kAudioBlockSize);
-#else
-            for(int i=0; i<kAudioBlockSize; ++i) {
-                trig_sum = trig_in[i+count];
-            }
-#endif
+            double trig_sum = vbmi::vec::Sum(trig_in+count, kAudioBlockSize);
             bool trigger = trig_sum != 0.0;
             p->trigger = (trigger && !self->previous_trig);
             self->previous_trig = trigger;
         }
         
+        // a frozen buffer or a buffer~ as source keep the grains playing
+        double in_peak = std::max(vbmi::vec::MaxAbs(inL+count, kAudioBlockSize),
+                                  vbmi::vec::MaxAbs(inR+count, kAudioBlockSize)) * in_gain;
+        bool active = p->trigger || p->freeze || source_samples != NULL;
+        if(!self->sleep_detector.Awake(in_peak, active)) {
+            memset(outL + count, 0, kAudioBlockSize * sizeof(double));
+            memset(outR + count, 0, kAudioBlockSize * sizeof(double));
+            continue;
+        }
         
         gp->Process(input, output, kAudioBlockSize);
         gp->Prepare();      // muss immer hier sein?
@@ -444,12 +683,20 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         if(p->trigger)
             p->trigger = false;
         
+        float out_peak = 0.f;
         for(auto i=0; i<kAudioBlockSize; ++i) {
             outL[i + count] = output[i].l;
             outR[i + count] = output[i].r;
+            out_peak = std::max(out_peak, std::max(fabsf(output[i].l), fabsf(output[i].r)));
         }
+        self->sleep_detector.Update(out_peak, kAudioBlockSize);
     }
     
+    if (source_samples)
+        buffer_unlocksamples(source);
+    
+    if (self->sleep_detector.changed())
+        qelem_set(self->sleep_qelem);
 }
 
 
@@ -468,6 +715,8 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
     if(samplerate != self->sr) {
         self->sr = samplerate;
         self->processor->set_sample_rate(samplerate);
+        self->sleep_detector.set_sample_rate(samplerate);
+        update_sleep_time(self);
     }
     
         object_method_direct(void, (t_object*, t_object*, t_perfroutine64, long, void*),
@@ -534,81 +783,42 @@ void myObj_copyTo(t_myObj *self, t_symbol *name) {
         }
     }
     else if (resolution == 8) {
+        // lofi buffers hold mu-law samples at half the sample rate
         clouds::AudioBuffer<clouds::RESOLUTION_8_BIT_MU_LAW>* ab = self->processor->GetAudioBuf8();
         int32_t size = ab->size();
         object_post((t_object*)self, "ab-size: %d -- 8 bit!", size);
-        object_warn(NULL, "not supported, yet!");
-        
-//        int8_t factor = clouds::kDownsamplingFactor;
-//        int32_t block_size = 4096;
-//        size_t upsampled_size = block_size * factor;
-//        clouds::FloatFrame block[block_size];
-//        clouds::FloatFrame block_out[upsampled_size];
-//        
-//        if(size*factor > frames) {
-//            // make sure, our msp buffer is large enough
-//            // otherwise only copy part of the internal buffer
-//            size = (frames / factor);
-//        }
-//        
-//        int8_t *ab_chns[2];
-//        ab_chns[0] = ab[0].get_buf8();
-//        ab_chns[1] = ab[1].get_buf8();
-//        
-//        
-//        int32_t limit = size - block_size;
-//        int i = 0;
-//        while(i < limit) {
-//            for(int b=0; b<block_size; b++) {
-//                int16_t pcm_left = clouds::MuLaw2Lin(ab_chns[0][i+b]);
-//                int16_t pcm_right = clouds::MuLaw2Lin(ab_chns[1][i+b]);
-//                block[b].l = pcm_left / 32768.0f;
-//                block[b].r = pcm_right / 32768.0f;
-//            }
-//            
-//            // up sampling to orginal SR
-//            self->src_up_.Process(block, block_out, block_size);
-//            
-//            if(copy_chans==2) {     // our destination buffer is stereo
-//                for(int b=0; b<upsampled_size; b++) {
-//                    int32_t index = (i*factor*nchns)+b*nchns;
-//                    tab[index] = block_out[b].l;
-//                    tab[index+1] = block_out[b].r;
-//                }
-//            } else {                // our destination buffer is mono, only copy left channel
-//                for(int b=0; b<upsampled_size; b++) {
-//                    int32_t index = (i*factor*nchns)+b*nchns;
-//                    tab[index] = block_out[b].l;
-//                }
-//            }
-//            i+=block_size;
-//        }
-//        
-//        // rest.......
-//        int32_t rest = frames - (i * factor);
-//        int32_t rest_in = rest >> 1;
-//        
-//        for(int b=0; b<rest_in; b++) {
-//            int16_t pcm_left = clouds::MuLaw2Lin(ab_chns[0][i+b]);
-//            int16_t pcm_right = clouds::MuLaw2Lin(ab_chns[1][i+b]);
-//            block[b].l = pcm_left / 32768.0f;
-//            block[b].r = pcm_right / 32768.0f;
-//        }
-//        self->src_up_.Process(block, block_out, rest_in);
-//        
-//        int32_t index = (i*factor*nchns);
-//        if(copy_chans==2) {     // our destination buffer is stereo
-//            for(int b=0; b<rest; b++) {
-//                tab[index+(b*nchns)] = block_out[b].l;
-//                tab[index+(b*nchns)+1] = block_out[b].r;
-//            }
-//        } else {                // our destination buffer is mono, only copy left channel
-//            for(int b=0; b<rest; b++) {
-//                int32_t index = (i*factor*nchns)+b*nchns;
-//                tab[index+b] = block_out[b].l;
-//            }
-//        }
         
+        const int32_t factor = clouds::kDownsamplingFactor;
+        if(size * factor > frames) {
+            // make sure, our msp buffer is large enough
+            // otherwise only copy part of the internal buffer
+            size = frames / factor;
+        }
+        
+        int8_t *ab_chns[2];
+        ab_chns[0] = ab[0].get_buf8();
+        ab_chns[1] = ab[1].get_buf8();
+        
+        clouds::FloatFrame block[kAudioBlockSize];
+        clouds::FloatFrame block_up[kAudioBlockSize * factor];
+        self->src_up_.Init();
+        
+        for(int32_t i=0; i<size; i+=kAudioBlockSize) {
+            int32_t n = std::min<int32_t>(kAudioBlockSize, size - i);
+            for(int b=0; b<n; b++) {
+                block[b].l = clouds::MuLaw2Lin(ab_chns[0][i+b]) / 32768.0f;
+                block[b].r = clouds::MuLaw2Lin(ab_chns[1][i+b]) / 32768.0f;
+            }
+            // up sampling to the original SR
+            self->src_up_.Process(block, block_up, n);
+            
+            for(int b=0; b<n*factor; b++) {
+                long index = (long)(i*factor + b) * nchns;
+                tab[index] = block_up[b].l;
+                if(copy_chans == 2)
+                    tab[index+1] = block_up[b].r;
+            }
+        }
     }
     else {
         object_error(NULL, "bad resolution!");
@@ -683,80 +893,44 @@ void myObj_copyFrom(t_myObj *self, t_symbol *name) {
         clouds::AudioBuffer<clouds::RESOLUTION_8_BIT_MU_LAW>* ab = self->processor->GetAudioBuf8();
         int32_t size = ab->size();
         object_post((t_object*)self, "ab-size: %d -- 8 bit!", size);
-        object_warn(NULL, "not supported, yet!");
         
-//        int8_t factor = clouds::kDownsamplingFactor;
-//        int32_t block_size = 4096;
-//        size_t downsampled_size = block_size / factor;
-//        clouds::FloatFrame block[block_size];
-//        clouds::FloatFrame block_out[downsampled_size];
-//
-//        // audio samples in internal buffer are downsampled
-//        // so we can fit in twice as many input samples
-//        if(frames > (size*factor)) {
-//            // make sure, our internal buffer is large enough
-//            // otherwise only copy part of the msp buffer
-//            frames = (size*factor);
-//        }
-//
-//        int8_t *ab_chns[2];
-//        ab_chns[0] = ab[0].get_buf8();
-//        ab_chns[1] = ab[1].get_buf8();
-//
-//
-//        int32_t limit = frames - block_size;
-//        int i = 0;
-//        while(i < limit) {
-//            if(copy_chans == 2) {
-//                for(int b=0; b<block_size; b++) {
-//                    block[b].l = tab[(i+b)*nchns]; //clouds::MuLaw2Lin(ab_chns[0][i+b]);
-//                    block[b].r = tab[(i+b)*nchns+1];
-//                }
-//            } else {
-//                for(int b=0; b<block_size; b++)
-//                    block[b].l = block[b].r = tab[i+b];
-//            }
-//
-//            // down sampling to half the original SR
-//            self->src_down_.Process(block, block_out, block_size);
-//
-//            for(int b=0; b<downsampled_size; b++) {
-//                int32_t index = (i/factor) + b; // TODO: fix this
-//                ab_chns[0][index] = clouds::Lin2MuLaw((int16_t)(block_out[b].l  * 32767.0f));
-//                ab_chns[1][index] = clouds::Lin2MuLaw((int16_t)(block_out[b].r  * 32767.0f));
-//            }
-//
-//            i+=block_size;
-//        }
-//        /*
-//         // rest.......
-//         int32_t rest = frames - (i * factor);
-//         int32_t rest_in = rest >> 1;
-//
-//         for(int b=0; b<rest_in; b++) {
-//         int16_t pcm_left = clouds::MuLaw2Lin(ab_chns[0][i+b]);
-//         int16_t pcm_right = clouds::MuLaw2Lin(ab_chns[1][i+b]);
-//         block[b].l = pcm_left / 32768.0f;
-//         block[b].r = pcm_right / 32768.0f;
-//         }
-//         self->src_up_.Process(block, block_out, rest_in);
-//
-//         int32_t index = (i*factor*nchns);
-//         if(copy_chans==2) {     // our destination buffer is stereo
-//         for(int b=0; b<rest; b++) {
-//         tab[index+(b*nchns)] = block_out[b].l;
-//         tab[index+(b*nchns)+1] = block_out[b].r;
-//         }
-//         } else {                // our destination buffer is mono, only copy left channel
-//         for(int b=0; b<rest; b++) {
-//         int32_t index = (i*factor*nchns)+b*nchns;
-//         tab[index+b] = block_out[b].l;
-//         }
-//         }
-//         */
-//
-//        ab[0].Resync(0);
-//        ab[1].Resync(0);
+        // audio samples in internal buffer are downsampled
+        // so we can fit in twice as many input samples
+        const int32_t factor = clouds::kDownsamplingFactor;
+        if(frames > size * factor) {
+            // make sure, the internal buffer is large enough
+            // otherwise only copy part of the msp buffer
+            frames = size * factor;
+        }
+        frames -= frames % factor;
+        
+        int8_t *ab_chns[2];
+        ab_chns[0] = ab[0].get_buf8();
+        ab_chns[1] = ab[1].get_buf8();
+        
+        clouds::FloatFrame block[kAudioBlockSize * factor];
+        clouds::FloatFrame block_down[kAudioBlockSize];
+        self->src_down_.Init();
+        
+        for(long i=0; i<frames; i+=kAudioBlockSize*factor) {
+            int32_t n = std::min<long>(kAudioBlockSize * factor, frames - i);
+            for(int b=0; b<n; b++) {
+                block[b].l = tab[(i+b)*nchns];
+                block[b].r = tab[(i+b)*nchns + copy_chans - 1];
+            }
+            // down sampling to half the original SR
+            self->src_down_.Process(block, block_down, n);
+            
+            for(int b=0; b<n/factor; b++) {
+                long index = i/factor + b;
+                ab_chns[0][index] = clouds::Lin2MuLaw(stmlib::Clip16(static_cast<int32_t>(block_down[b].l * 32768.0f)));
+                if(copy_chans == 2)
+                    ab_chns[1][index] = clouds::Lin2MuLaw(stmlib::Clip16(static_cast<int32_t>(block_down[b].r * 32768.0f)));
+            }
+        }
+        
+        ab[0].Resync(0);
+        ab[1].Resync(0);
     }
     else {
         object_error(NULL, "bad resolution!");
@@ -766,6 +940,29 @@ void myObj_copyFrom(t_myObj *self, t_symbol *name) {
 }
 
 
+// play grains directly from a buffer~ (any length and number of channels,
+// only the first two are used) instead of the recording buffer, without
+// copying. 'buffer' without a name goes back to the recording buffer.
+// Granular mode only.
+void myObj_buffer(t_myObj *self, t_symbol *name) {
+    
+    if (name == gensym("")) {
+        self->use_source = false;
+        return;
+    }
+    
+    if (!self->source_ref)
+        self->source_ref = buffer_ref_new((t_object *)self, name);
+    else
+        buffer_ref_set(self->source_ref, name);
+    
+    if (!buffer_ref_exists(self->source_ref))
+        object_warn((t_object*)self, "no buffer %s found (yet)", name->s_name);
+    
+    self->use_source = true;
+}
+
+
 void myObj_free(t_myObj* self)
 {
     dsp_free((t_pxobject*)self);
@@ -778,6 +975,14 @@ void myObj_free(t_myObj* self)
         sysmem_freeptr(self->small_buffer);
     
     object_free(self->buf_ref);
+    object_free(self->source_ref);
+    
+    if (self->snapshot_qelem)
+        qelem_free(self->snapshot_qelem);
+    delete self->snapshot;
+    
+    if (self->sleep_qelem)
+        qelem_free(self->sleep_qelem);
     
 }
 
@@ -815,19 +1020,23 @@ void myObj_assist(t_myObj* self, void* unused, t_assist_function io, long index,
             case 1:
                 strncpy(string_dest,"(signal) OUT R", ASSIST_STRING_MAXSIZE);
                 break;
+            case 2:
+                strncpy(string_dest,"(list) sleep 0/1", ASSIST_STRING_MAXSIZE);
+                break;
 		}
 	}
 }
 
 
 void ext_main(void* r) {
-	this_class = class_new("vb.mi.clds~", (method)myObj_new, (method)myObj_free, sizeof(t_myObj), 0, A_DEFLONG, 0);
+	this_class = class_new("vb.mi.clds~", (method)myObj_new, (method)myObj_free, sizeof(t_myObj), 0, A_GIMME, 0);
 
 	class_addmethod(this_class, (method)myObj_assist,	"assist",	A_CANT,		0);
 	class_addmethod(this_class, (method)myObj_dsp64,	"dsp64",	A_CANT,		0);
 
     class_addmethod(this_class, (method)myObj_bang,    "bang", 0);
     class_addmethod(this_class, (method)myObj_float,    "float", A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,     "seed",  A_LONG, 0);
     class_addmethod(this_class, (method)myObj_int,    "int", A_LONG, 0);
     class_addmethod(this_class, (method)myObj_position,    "position", A_FLOAT, 0);
     class_addmethod(this_class, (method)myObj_size,     "size",        A_FLOAT, 0);
@@ -842,22 +1051,38 @@ void ext_main(void* r) {
     class_addmethod(this_class, (method)myObj_mode,     "mode",  A_LONG, 0);
     class_addmethod(this_class, (method)myObj_freeze,   "freeze",  A_LONG, 0);
     class_addmethod(this_class, (method)myObj_lofi,   "lofi",  A_LONG, 0);
+    class_addmethod(this_class, (method)myObj_grains, "grains", A_LONG, 0);
     class_addmethod(this_class, (method)myObj_bypass,   "bypass",  A_LONG, 0);
     class_addmethod(this_class, (method)myObj_info,   "info", 0);
     class_addmethod(this_class, (method)myObj_coef,    "smooth",  A_FLOAT, 0);
     class_addmethod(this_class, (method)myObj_copyTo,    "copyTo", A_SYM, 0);
     class_addmethod(this_class, (method)myObj_copyFrom,  "copyFrom", A_SYM, 0);
+    class_addmethod(this_class, (method)myObj_buffer,  "buffer", A_DEFSYM, 0);
+    class_addmethod(this_class, (method)myObj_write,  "write", A_GIMME, 0);
+    class_addmethod(this_class, (method)myObj_read,  "read", A_DEFSYM, 0);
     class_addmethod(this_class, (method)myObj_notify, "notify", A_CANT, 0);
 	
 	class_dspinit(this_class);
 	class_register(CLASS_BOX, this_class);
     
-    /*
     // attributes ====
-    CLASS_ATTR_CHAR(this_class,"drift", 0, t_myObj, drift);
-    CLASS_ATTR_SAVE(this_class, "drift", 0);
-    CLASS_ATTR_FILTER_CLIP(this_class, "drift", 0, 15);
-    */
+    // skip the granular processor when input and output are silent
+    CLASS_ATTR_CHAR(this_class, "sleep", 0, t_myObj, sleep);
+    CLASS_ATTR_STYLE_LABEL(this_class, "sleep", 0, "onoff", "sleep when silent");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep", NULL, (method)sleep_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_threshold", 0, t_myObj, sleep_threshold);
+    CLASS_ATTR_LABEL(this_class, "sleep_threshold", 0, "sleep threshold (dB)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_threshold", NULL, (method)sleep_threshold_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_threshold", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_time", 0, t_myObj, sleep_time);
+    CLASS_ATTR_LABEL(this_class, "sleep_time", 0, "silence before sleeping (ms)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_time", NULL, (method)sleep_time_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_time", 0);
+    
+    ps_sleep = gensym("sleep");
     
     object_post(NULL, "vb.mi.clds~ by volker böhm -- https://vboehm.net");
     object_post(NULL, "based on mutable instruments' 'clouds' module");
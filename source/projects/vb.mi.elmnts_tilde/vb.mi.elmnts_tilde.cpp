@@ -36,21 +36,19 @@
 
 #include "elements/dsp/dsp.h"
 #include "elements/dsp/part.h"
+#include "stmlib/utils/random.h"
 #include "read_inputs.hpp"
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
+#include "denormals.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
 
 
 using namespace c74::max;
 
 const size_t kBlockSize = elements::kMaxBlockSize;
 
-double elements::Dsp::kSampleRate = 32000.0;
-double elements::Dsp::kSrFactor = 32000.0 / kSampleRate;
-double elements::Dsp::kIntervalCorrection = log(kSrFactor)/log(2.0)*12.0;
-
 static t_class* this_class = nullptr;
+t_symbol *ps_sleep;
 
 
 struct t_myObj {
@@ -66,14 +64,30 @@ struct t_myObj {
     uint16_t            *reverb_buffer;
     void                *info_out;
     //double              *out, *aux;     // output buffers
+    real_t              blow[kBlockSize];     // core in/out, float or double
+    real_t              strike[kBlockSize];
+    real_t              out[kBlockSize];
+    real_t              aux[kBlockSize];
     double              sr;
     long                sigvs;
     bool                gate_connected;
     short               blockCount;
+    uint32_t            rng_state;
+    stmlib::PendingSeed seed;
+    
+    // sleep mode
+    vbmi::SleepDetector sleep_detector;
+    char                sleep;
+    double              sleep_threshold;
+    double              sleep_time;
+    t_qelem             *sleep_qelem;
 };
 
 
-void* myObj_new(void) {
+void myObj_sleep_report(t_myObj *self);
+
+
+void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
     t_myObj* self = (t_myObj*)object_alloc(this_class);
     
     if(self)
@@ -116,20 +130,28 @@ void* myObj_new(void) {
         
 
         self->read_inputs.Init();
+        self->rng_state = stmlib::Random::InstanceSeed();
         
         
         // Init and seed the random parameters and generators with the serial number.
         self->part = new elements::Part;
         memset(self->part, 0, sizeof(*t_myObj::part));
-        self->part->Init(self->reverb_buffer);
+        self->part->Init(self->reverb_buffer, elements::Dsp());
         //self->part->Seed((uint32_t*)(0x1fff7a10), 3);
-        uint32_t mySeed = 0x1fff7a10;
-        self->part->Seed(&mySeed, 3);
+        uint32_t mySeed[3] = { 0x1fff7a10, 0, 0 };
+        self->part->Seed(mySeed, 3);
         
         self->part->set_easter_egg(false);
         
         self->blockCount = 0;
-
+        
+        double sr = sys_getsr();
+        self->sleep_detector.Init(sr > 0.0 ? sr : 48000.0);
+        self->sleep_threshold = vbmi::kDefaultSleepThreshold;
+        self->sleep_time = vbmi::kDefaultSleepTime;
+        self->sleep_qelem = qelem_new(self, (method)myObj_sleep_report);
+        
+        attr_args_process(self, argc, argv);
     }
     else {
         object_free(self);
@@ -439,10 +461,56 @@ inline void SoftLimit_block(t_myObj *self, double *inout, size_t size)
 }
 
 
+#pragma mark ----- sleep mode -----
+
+t_max_err sleep_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep = atom_getlong(av) != 0;
+        self->sleep_detector.set_enabled(self->sleep);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_threshold_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_threshold = CLAMP(atom_getfloat(av), -140., 0.);
+        self->sleep_detector.set_threshold(self->sleep_threshold);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_time_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_time = CLAMP(atom_getfloat(av), 10., 60000.);
+        self->sleep_detector.set_hang_time(self->sleep_time);
+    }
+    return MAX_ERR_NONE;
+}
+
+// 'sleep 1' when the voice fell asleep, 'sleep 0' when it woke up
+void myObj_sleep_report(t_myObj *self) {
+    t_atom a;
+    atom_setlong(&a, self->sleep_detector.sleeping());
+    outlet_anything(self->info_out, ps_sleep, 1, &a);
+}
+
+
+
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark ----- dsp loop -----
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double *blow_in = ins[0];       // red input
     double *strike_in = ins[1];     // green input
     double *outL = outs[0];
@@ -455,6 +523,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
 
     double *cvinputs = self->read_inputs.cv_floats;    //self->cvinputs;
@@ -524,26 +594,40 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
         }
         
         if(gate_connected) {        // check if gate signal is connected
-            double trigger = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(gate_in+count, 1, &trigger, size);   // calc sum of input block
-#else
-            for(int i=0; i<size; ++i) {
-                trigger += gate_in[i+count];
-            }
-#endif
+            double trigger = vbmi::vec::Sum(gate_in+count, size);   // calc sum of input block
             ps->gate |= trigger != 0.0;
         }
 
         
         self->read_inputs.Read(self->part->mutable_patch(), ps);
         
-        self->part->Process(*ps, blow_in+count, strike_in+count, outL+count, outR+count, size);
+        // a held gate keeps the voice awake
+        double in_peak = std::max(vbmi::vec::MaxAbs(blow_in+count, size),
+                                  vbmi::vec::MaxAbs(strike_in+count, size));
+        if(!self->sleep_detector.Awake(in_peak, ps->gate)) {
+            memset(outL+count, 0, size*sizeof(double));
+            memset(outR+count, 0, size*sizeof(double));
+            continue;
+        }
+        
+        vbmi::vec::Convert(blow_in+count, self->blow, size);
+        vbmi::vec::Convert(strike_in+count, self->strike, size);
+        
+        self->part->Process(*ps, self->blow, self->strike, self->out, self->aux, size);
         
+        vbmi::vec::Convert(self->out, outL+count, size);
+        vbmi::vec::Convert(self->aux, outR+count, size);
+        
+        double out_peak = std::max(vbmi::vec::MaxAbs(outL+count, size),
+                                   vbmi::vec::MaxAbs(outR+count, size));
+        self->sleep_detector.Update(out_peak, size);
     }
     
     SoftLimit_block(self, outL, vs);
     SoftLimit_block(self, outR, vs);
+    
+    if(self->sleep_detector.changed())
+        qelem_set(self->sleep_qelem);
 }
 
 
@@ -557,13 +641,13 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
         object_error((t_object*)self, "sigvs can't be smaller than %d samples, sorry!", kBlockSize);
         return;
     }
-    if(samplerate != elements::Dsp::getSr()) {
-        elements::Dsp::setSr(samplerate);
+    if(samplerate != self->part->dsp().getSr()) {
         self->sr = samplerate;
         
-        self->part->Init(self->reverb_buffer);
-        object_post((t_object *)self, "Re-Init() after change of SR: %f", elements::Dsp::getSr());
+        self->part->Init(self->reverb_buffer, elements::Dsp(samplerate));
+        object_post((t_object *)self, "Re-Init() after change of SR: %f", self->part->dsp().getSr());
     }
+    self->sleep_detector.set_sample_rate(samplerate);
     
     object_method_direct(void, (t_object*, t_object*, t_perfroutine64, long, void*),
                          dsp64, gensym("dsp_add64"), (t_object*)self, (t_perfroutine64)myObj_perform64, 0, NULL);
@@ -581,6 +665,8 @@ void myObj_free(t_myObj* self)
 
     if(self->reverb_buffer)
         sysmem_freeptr(self->reverb_buffer);
+    if(self->sleep_qelem)
+        qelem_free(self->sleep_qelem);
 //    if(self->out)
 //        sysmem_freeptr(self->out);
 //    if(self->aux)
@@ -650,7 +736,7 @@ void myObj_assist(t_myObj* self, void* unused, t_assist_function io, long index,
                 strncpy(string_dest,"(signal) AUX", ASSIST_STRING_MAXSIZE);
                 break;
             case 2:
-                strncpy(string_dest,"info outlet", ASSIST_STRING_MAXSIZE);
+                strncpy(string_dest,"info outlet, sleep 0/1", ASSIST_STRING_MAXSIZE);
                 break;
         }
     }
@@ -695,6 +781,7 @@ void ext_main(void* r) {
     class_addmethod(this_class, (method)myObj_bypass,  "bypass",    A_LONG, 0);
     class_addmethod(this_class, (method)myObj_int,  "int",          A_LONG, 0);
     class_addmethod(this_class, (method)myObj_float,  "float",      A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,   "seed",       A_LONG, 0);
     class_addmethod(this_class, (method)myObj_easter,  "easteregg",          A_LONG, 0);
     class_addmethod(this_class, (method)myObj_info,	"info", 0);
     class_addmethod(this_class, (method)myObj_bang,    "bang", 0);
@@ -702,6 +789,25 @@ void ext_main(void* r) {
     class_dspinit(this_class);
     class_register(CLASS_BOX, this_class);
     
+    // ATTRIBUTES ..............
+    // skip the voice when input and output are silent and the gate is low
+    CLASS_ATTR_CHAR(this_class, "sleep", 0, t_myObj, sleep);
+    CLASS_ATTR_STYLE_LABEL(this_class, "sleep", 0, "onoff", "sleep when silent");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep", NULL, (method)sleep_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_threshold", 0, t_myObj, sleep_threshold);
+    CLASS_ATTR_LABEL(this_class, "sleep_threshold", 0, "sleep threshold (dB)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_threshold", NULL, (method)sleep_threshold_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_threshold", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_time", 0, t_myObj, sleep_time);
+    CLASS_ATTR_LABEL(this_class, "sleep_time", 0, "silence before sleeping (ms)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_time", NULL, (method)sleep_time_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_time", 0);
+    
+    ps_sleep = gensym("sleep");
+    
     object_post(NULL, "vb.mi.elmnts~ by volker böhm --> https://vboehm.net");
     object_post(NULL, "a clone of mutable instruments' 'elements' module");
 }
@@ -38,6 +38,7 @@
 #include "avrlib/op.h"
 #include "grids/clock.h"
 #include "grids/pattern_generator.h"
+#include "denormals.h"
 
 #include <cstdio>
 
@@ -319,6 +320,7 @@ t_max_err gate_setter(t_myObj *self, void *attr, long ac, t_atom *av)
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
     
     double      *clock_input = ins[0];
     double      *reset_input = ins[7];
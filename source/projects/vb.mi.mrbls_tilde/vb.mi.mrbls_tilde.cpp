@@ -52,10 +52,9 @@
 #include "stmlib/dsp/hysteresis_quantizer.h"
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/gate_flags.h"
+#include "denormals.h"
+#include "vector_ops.h"
 
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
 
 //#include <iostream>
 
@@ -753,26 +752,14 @@ void dsp_loop(t_myObj* self, double** ins, double** outs, long blockSize, long o
     double vectorsum, *clock_input;
     
     if(self->clock_connected[0] && block->input_patched[0]) {
-        vectorsum = 0.0;
         clock_input = ins[0]+offset;
-#ifdef __APPLE__
-        vDSP_sveD(clock_input, 1, &vectorsum, size);
-#else
-        for(int i=0; i<size; ++i)
-            vectorsum += clock_input[i];
-#endif
+        vectorsum = vbmi::vec::Sum(clock_input, size);
         if(vectorsum > 0.5) inClocks[0] = 255;
     }
     if(self->clock_connected[1] && block->input_patched[1]) {
         xy_clock_source = CLOCK_SOURCE_EXTERNAL;
-        vectorsum = 0.0;
         clock_input = ins[ADC_CHANNEL_LAST+1]+offset;
-#ifdef __APPLE__
-        vDSP_sveD(clock_input, 1, &vectorsum, size);
-#else
-        for(int i=0; i<size; ++i)
-            vectorsum += clock_input[i];
-#endif
+        vectorsum = vbmi::vec::Sum(clock_input, size);
         if(vectorsum > 0.5) {
             inClocks[1] = 255;
             //object_post(NULL, "ping! - clockSrc: %d", xy_clock_source);
@@ -923,6 +910,8 @@ void dsp_loop(t_myObj* self, double** ins, double** outs, long blockSize, long o
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     if (self->obj.z_disabled)
         return;
 
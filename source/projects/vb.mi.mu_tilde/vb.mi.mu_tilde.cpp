@@ -32,6 +32,7 @@
 
 
 #include "c74_msp.h"
+#include "denormals.h"
 
 
 using namespace c74::max;
@@ -169,6 +170,7 @@ inline void SoftClip_block(double *inout, size_t size) {
 // 64 bit signal input version
 void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
                      double **outs, long numouts, long sampleframes, long flags, void *userparam){
+    vbmi::ScopedFlushDenormals flush_denormals;
     
     double *in = ins[0];
     double *input_gain = ins[1];
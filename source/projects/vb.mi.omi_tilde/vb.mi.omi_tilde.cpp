@@ -35,9 +35,8 @@
 
 #include "c74_msp.h"
 #include "omi/dsp/part.h"
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
+#include "denormals.h"
+#include "vector_ops.h"
 
 
 using namespace c74::max;
@@ -88,8 +87,8 @@ void* myObj_new(void) {
         self->part = new omi::Part;
         self->part->Init(self->sr);
 
-        uint32_t mySeed = 0x1fff7a10;
-        self->part->Seed(&mySeed, 3);
+        uint32_t mySeed[3] = { 0x1fff7a10, 0, 0 };
+        self->part->Seed(mySeed, 3);
         
 
     }
@@ -237,6 +236,8 @@ inline void SoftLimit_block(t_myObj *self, double *inout, size_t size)
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double *audio_in = ins[0];
     double *gate = ins[1];
     double *outL = outs[0];
@@ -255,13 +256,7 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     for(int count=0; count<vs; count+=size) {
         
         if(self->gate_connected) {
-            double trigger = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(gate+count, 1, &trigger, size);   // calc sum of input vector
-#else
-            for(int i=0; i<size; ++i)
-                trigger += gate[i+count];
-#endif
+            double trigger = vbmi::vec::Sum(gate+count, size);   // calc sum of input vector
             ps->gate |= trigger > 0.0;
         }
         
@@ -34,9 +34,10 @@
 
 #include "plaits/dsp/dsp.h"
 #include "plaits/dsp/voice.h"
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
+#include "plaits/dsp/poly_voice.h"
+#include "stmlib/utils/random.h"
+#include "denormals.h"
+#include "vector_ops.h"
 
 
 //#define ENABLE_LFO_MODE
@@ -47,9 +48,11 @@ using namespace c74::max;
 
 
 const size_t kBlockSize = plaits::kBlockSize;
+const size_t kSharedBufferSize = 32768;
+// poly mode: engine object and RAM per voice, the inharmonic string engine
+// needs twice as much and plays half the voices
+const size_t kPoolSizePerVoice = 17408;  // 17 kB
 
-double kSampleRate = 48000.0;
-double a0 = (440.0 / 8.0) / kSampleRate;
 
 static t_class* this_class = nullptr;
 
@@ -57,6 +60,10 @@ struct t_myObj {
     t_pxobject	obj;
 
     plaits::Voice       *voice_;
+    plaits::PolyVoice   *poly_;         // poly mode only
+    plaits::Voice       *poly_voices;
+    long                num_voices;
+    size_t              pool_size;
     plaits::Modulations modulations;
     plaits::Patch       patch;
     double              transposition_;
@@ -71,8 +78,13 @@ struct t_myObj {
     char                *shared_buffer;
     void                *info_out;
 
+    real_t              out[plaits::kBlockSize];
+    real_t              aux[plaits::kBlockSize];
+
     double              sr;
     int                 sigvs;
+    uint32_t            rng_state;
+    stmlib::PendingSeed seed;
 };
 
 
@@ -102,9 +114,7 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
         if(self->sr <= 0)
             self->sr = 44100.0;
 
-
-        kSampleRate = self->sr;
-        a0 = (440.0f / 8.0f) / kSampleRate;
+        self->rng_state = stmlib::Random::InstanceSeed();
 
         // init some params
         self->transposition_ = 0.;
@@ -124,8 +134,19 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
         self->timb_pot = 0.0;
 
 
+        // args: number of voices (poly mode if > 1), engine pool size in kB
+        self->num_voices = 1;
+        long offset = attr_args_offset(argc, argv);
+        if(offset > 0)
+            self->num_voices = CLAMP(atom_getlong(argv), 1L, (long)plaits::kMaxPolyphony);
+        self->pool_size = std::max(kSharedBufferSize, (size_t)self->num_voices * kPoolSizePerVoice);
+        if(offset > 1)
+            self->pool_size = std::max(kSharedBufferSize, (size_t)atom_getlong(argv + 1) * 1024);
+        if(self->num_voices == 1)
+            self->pool_size = kSharedBufferSize;
+
         // allocate memory
-        self->shared_buffer = sysmem_newptrclear(32768);
+        self->shared_buffer = sysmem_newptrclear(self->pool_size);
 
         if(self->shared_buffer == NULL) {
             object_post((t_object*)self, "mem alloc failed!");
@@ -133,10 +154,20 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
             self = NULL;
             return self;
         }
-        stmlib::BufferAllocator allocator(self->shared_buffer, 32768);
 
-        self->voice_ = new plaits::Voice;
-        self->voice_->Init(&allocator);
+        if(self->num_voices > 1) {
+            self->voice_ = NULL;
+            self->poly_voices = new plaits::Voice[self->num_voices];
+            self->poly_ = new plaits::PolyVoice;
+            self->poly_->Init(self->poly_voices, self->num_voices, self->shared_buffer, self->pool_size, plaits::Dsp(self->sr));
+        }
+        else {
+            self->poly_ = NULL;
+            self->poly_voices = NULL;
+            stmlib::BufferAllocator allocator(self->shared_buffer, kSharedBufferSize);
+            self->voice_ = new plaits::Voice;
+            self->voice_->Init(&allocator, plaits::Dsp(self->sr));
+        }
 
         // process attributes
         attr_args_process(self, argc, argv);
@@ -292,12 +323,52 @@ t_max_err engine_setter(t_myObj *self, void *attr, long ac, t_atom *av)
 void myObj_get_engine(t_myObj* self) {
 
     t_atom argv;
-    atom_setlong(&argv, self->voice_->active_engine());
+    if(self->poly_)
+        atom_setlong(&argv, self->poly_->active_engine());
+    else
+        atom_setlong(&argv, self->voice_->active_engine());
     outlet_anything(self->info_out, gensym("active_engine"), 1, &argv);
 
 }
 
 
+#pragma mark ----- poly mode -----
+
+// midinote <pitch> <velocity>, velocity 0 is a note off
+void myObj_midinote(t_myObj* self, double pitch, double velocity) {
+    if(!self->poly_) {
+        object_warn((t_object*)self, "midinote needs poly mode, create the object with a voice count > 1");
+        return;
+    }
+    if(velocity > 0.)
+        self->poly_->NoteOn(pitch, CLAMP(velocity, 0., 127.) / 127.);
+    else
+        self->poly_->NoteOff(pitch);
+}
+
+void myObj_flush(t_myObj* self) {
+    if(self->poly_)
+        self->poly_->AllNotesOff();
+}
+
+// voices that fit into the engine pool with the active engine
+void myObj_get_voices(t_myObj* self) {
+    t_atom argv;
+    atom_setlong(&argv, self->poly_ ? self->poly_->num_playing_voices() : 1);
+    outlet_anything(self->info_out, gensym("voices"), 1, &argv);
+}
+
+// bytes held by the voice(s) and the active engine(s)
+void myObj_get_footprint(t_myObj* self) {
+    t_atom argv;
+    if(self->poly_)
+        atom_setlong(&argv, (t_atom_long)self->poly_->footprint());
+    else
+        atom_setlong(&argv, (t_atom_long)self->voice_->footprint());
+    outlet_anything(self->info_out, gensym("footprint"), 1, &argv);
+}
+
+
 #pragma mark ----- main pots -----
 // main pots
 
@@ -356,10 +427,18 @@ void myObj_note(t_myObj* self, double n) {
 
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark ----- dsp loop -----
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double *out = outs[0];
     double *aux = outs[1];
     double *trig_input = ins[6];
@@ -375,9 +454,11 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     if (self->obj.z_disabled)
         return;
 
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
+
 
     // copy first value of signal inlets into corresponding params
-    double* destination = &self->modulations.engine;
+    real_t* destination = &self->modulations.engine;
 
     for(count=0; count < vs; count += size) {
         
@@ -392,17 +473,17 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
 
         if(self->modulations.trigger_patched) {
             // calc sum of trigger input
-            double vectorsum = 0.0;
-#ifdef __APPLE__
-            vDSP_sveD(trig_input+count, 1, &vectorsum, size);
-#else
-            for(int i=0; i<size; ++i)
-                vectorsum += trig_input[i+count];
-#endif
+            double vectorsum = vbmi::vec::Sum(trig_input+count, size);
             self->modulations.trigger = vectorsum;
         }
 
-        self->voice_->Render(*p, self->modulations, out+count, aux+count, size);
+        if(self->poly_)
+            self->poly_->Render(*p, self->modulations, self->out, self->aux, size);
+        else
+            self->voice_->Render(*p, self->modulations, self->out, self->aux, size);
+
+        vbmi::vec::Convert(self->out, out+count, size);
+        vbmi::vec::Convert(self->aux, aux+count, size);
     }
 
 }
@@ -422,8 +503,14 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
 
     if(samplerate != self->sr) {
         self->sr = samplerate;
-        kSampleRate = self->sr;
-        a0 = (440.0f / 8.0f) / kSampleRate;
+        // engines compute their coefficients in Init()
+        if(self->poly_) {
+            self->poly_->Init(self->poly_voices, self->num_voices, self->shared_buffer, self->pool_size, plaits::Dsp(self->sr));
+        }
+        else {
+            stmlib::BufferAllocator allocator(self->shared_buffer, kSharedBufferSize);
+            self->voice_->Init(&allocator, plaits::Dsp(self->sr));
+        }
     }
 
     object_method_direct(void, (t_object*, t_object*, t_perfroutine64, long, void*),
@@ -436,8 +523,9 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
 
 void myObj_free(t_myObj* self) {
     dsp_free((t_pxobject*)self);
-    self->voice_->plaits::Voice::~Voice();
     delete self->voice_;
+    delete self->poly_;
+    delete[] self->poly_voices;
     if(self->shared_buffer)
         sysmem_freeptr(self->shared_buffer);
 }
@@ -514,8 +602,15 @@ void ext_main(void* r) {
 
 //    class_addmethod(this_class, (method)myObj_choose_engine,      "engine",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_get_engine,      "get_engine", 0);
+
+    // poly mode
+    class_addmethod(this_class, (method)myObj_midinote,     "midinote",     A_FLOAT, A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_flush,        "flush", 0);
+    class_addmethod(this_class, (method)myObj_get_voices,   "get_voices", 0);
+    class_addmethod(this_class, (method)myObj_get_footprint, "get_footprint", 0);
     class_addmethod(this_class, (method)myObj_int,  "int",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_float,  "float",      A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,   "seed",       A_LONG, 0);
 //    class_addmethod(this_class, (method)myObj_info,    "info", 0);
 
     class_dspinit(this_class);
@@ -43,6 +43,8 @@
 #include "clouds/dsp/sample_rate_converter.h"
 
 #include "stmlib/dsp/dsp.h"
+#include "stmlib/utils/random.h"
+#include "denormals.h"
 
 
 
@@ -82,6 +84,8 @@ struct t_myObj {
     
     clouds::SampleRateConverter<-clouds::kDownsamplingFactor, 45, clouds::src_filter_1x_2_45> src_down_;
     clouds::SampleRateConverter<+clouds::kDownsamplingFactor, 45, clouds::src_filter_1x_2_45> src_up_;
+    uint32_t    rng_state;
+    stmlib::PendingSeed seed;
     
 };
 
@@ -105,6 +109,7 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
         }
 
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         
         int largeBufSize = 118784;
         int smallBufSize = 65536-128;
@@ -241,10 +246,18 @@ void myObj_info(t_myObj *self) {
 }
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark -------- DSP Loop ----------
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *inL = ins[0];      // audio in L
     double  *inR = ins[1];      // audio in R
     
@@ -255,6 +268,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     
     clouds::FloatFrame  *input = self->input;
@@ -395,6 +410,7 @@ void ext_main(void* r) {
     //class_addmethod(this_class, (method)myObj_lofi,   "lofi",  A_LONG, 0);
     //class_addmethod(this_class, (method)myObj_bypass,   "bypass",  A_LONG, 0);
     class_addmethod(this_class, (method)myObj_info,   "info", 0);
+    class_addmethod(this_class, (method)myObj_seed,   "seed", A_LONG, 0);
 
 	
 	class_dspinit(this_class);
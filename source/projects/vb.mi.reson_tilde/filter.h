@@ -34,8 +34,8 @@
 // Zero-delay-feedback filters (one pole and SVF).
 // Naive SVF.
 
-#ifndef STMLIB_DSP_FILTER_H_
-#define STMLIB_DSP_FILTER_H_
+#ifndef VB_MI_RESON_FILTER_H_
+#define VB_MI_RESON_FILTER_H_
 
 #include "stmlib/stmlib.h"
 #include "stmlib/dsp/delay_line.h"
@@ -847,5 +847,5 @@ enum FrequencyApproximation {
     };
 
 
-#endif  // STMLIB_DSP_FILTER_H_
+#endif  // VB_MI_RESON_FILTER_H_
 
@@ -30,6 +30,7 @@
 
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/cosine_oscillator.h"
+#include "stmlib/dsp/simd.h"
 
 #include "elements/dsp/dsp.h"
 #include "elements/resources.h"
@@ -47,14 +48,16 @@ void Resonator::Init(double sr) {
     sample_rate_ = sr;
     r_sr_ = 1.0 / sr;
     
+    f_.Init();
     for (size_t i = 0; i < kMaxModes; ++i) {
-        f_[i].Init();
+        gain_[i] = 1.0;
         active_[i] = i;      // map of active filters
         
     }
 
+    f_bow_.Init();
     for (size_t i = 0; i < kMaxBowedModes; ++i) {
-        f_bow_[i].Init();
+        bow_gain_[i] = 1.0;
         d_bow_[i].Init();
     }
   
@@ -103,13 +106,14 @@ size_t Resonator::ComputeFilters(double *freqs, double *qs, double *gains) {
         qs[i] = 1.0 + partial_frequency * q;
         
 
-        f_[i].set_f_q_g<FREQUENCY_FAST>(partial_frequency, qs[i], gains[i]);
+        f_.set_f_q<FREQUENCY_FAST>(i, partial_frequency, qs[i]);
+        gain_[i] = gains[i];
         
         if (i < kMaxBowedModes) {
             size_t period = 1.0 / partial_frequency;
             while (period >= kMaxDelayLineSize) period >>= 1;
             d_bow_[i].set_delay(period);
-            f_bow_[i].set_g_q(f_[i].g(), 1.0 + partial_frequency * 1500.0);
+            f_bow_.set_g_q(i, f_.g(i), 1.0 + partial_frequency * 1500.0);
           }
 
         stretch_factor += stiffness;
@@ -144,13 +148,15 @@ size_t Resonator::ComputeFilters(double *freqs, double *qs, double *gains) {
                 num_modes ++;
             }
 
-            f_[i].set_f_q_g<FREQUENCY_FAST>(partial_frequency, qs[i], gains[i]);
+            f_.set_f_q<FREQUENCY_FAST>(i, partial_frequency, qs[i]);
+            gain_[i] = gains[i];
             if (i < kMaxBowedModes) {
                 size_t period = 1.0 / partial_frequency;
                 while (period >= kMaxDelayLineSize) period >>= 1;
                 d_bow_[i].set_delay(period);
 //                f_bow_[i].set_g_q(f_[i].g(), 1.0 + partial_frequency * 1500.0);
-                f_bow_[i].set_g_q_g(f_[i].g(), 1.0 + partial_frequency * 1500.0, gains[i] * 8.0);
+                f_bow_.set_g_q(i, f_.g(i), 1.0 + partial_frequency * 1500.0);
+                bow_gain_[i] = gains[i] * 8.0;
                 
 //                printf("[%zu]: period: %zu -- freq: %f\n", i, period, partial_frequency);
             }
@@ -190,11 +196,25 @@ void Resonator::Process(
     amplitudes.Start();
     aux_amplitudes.Start();
     
+    // Only the active filters are processed, they are moved to the front of
+    // the banks for the duration of the block.
     if(calc_res) {
         for (size_t i = 0; i < num_modes; i++) {
             uint8_t a = active_[i];
-            f_[a].Process_bp_block(in, center, sides, size, amplitudes.Next()*res_gain_, aux_amplitudes.Next()*res_gain_);
+            center_weight_[i] = amplitudes.Next() * res_gain_ * gain_[a];
+            side_weight_[i] = aux_amplitudes.Next() * res_gain_ * gain_[a];
         }
+        
+        f_.Gather(active_, num_modes);
+        for (size_t i = 0; i < size; ++i) {
+            double sum_center, sum_side;
+            f_.Process<FILTER_MODE_BAND_PASS>(in[i], band_pass_, num_modes);
+            simd::DotProduct2(band_pass_, center_weight_, side_weight_,
+                              num_modes, &sum_center, &sum_side);
+            center[i] += sum_center;
+            sides[i] += sum_side;
+        }
+        f_.Scatter(active_, num_modes);
 
         for (size_t i=0; i<size; ++i)
             sides[i] -= center[i];
@@ -202,12 +222,29 @@ void Resonator::Process(
         
     if(calc_wg) {
         amplitudes.Start();
+        size_t num_bowed = 0;
         for (size_t i = 0; i < num_banded_wg; ++i) {
             uint8_t a = active_[i];
-            if (a < kMaxBowedModes)
-                f_bow_[a].Process_bp_norm_block(in, center, size, &d_bow_[a], amplitudes.Next()*wg_gain_);
-           // sum_center += s * amplitudes.Next() * 8.0;
+            if (a < kMaxBowedModes) {
+                bow_active_[num_bowed] = a;
+                bow_weight_[num_bowed] = amplitudes.Next() * wg_gain_ * bow_gain_[a];
+                num_bowed++;
+            }
+        }
+        
+        f_bow_.Gather(bow_active_, num_bowed);
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = 0; j < num_bowed; ++j)
+                bow_input_[j] = 0.99 * d_bow_[bow_active_[j]].Read() + in[i];
+            f_bow_.Process<FILTER_MODE_BAND_PASS_NORMALIZED>(bow_input_, band_pass_, num_bowed);
+            double sum = 0.0;
+            for (size_t j = 0; j < num_bowed; ++j) {
+                d_bow_[bow_active_[j]].Write(band_pass_[j]);
+                sum += band_pass_[j] * bow_weight_[j];
+            }
+            center[i] += sum;
         }
+        f_bow_.Scatter(bow_active_, num_bowed);
     }
 }
 
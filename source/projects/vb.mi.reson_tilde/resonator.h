@@ -35,8 +35,8 @@
 #include <algorithm>
 
 #include "elements/dsp/dsp.h"
-#include "filter.h"
 #include "stmlib/dsp/delay_line.h"
+#include "stmlib/dsp/svf_bank.h"
 
 //namespace elements {
 
@@ -121,9 +121,20 @@ class Resonator {
   
     size_t resolution_;
   
-    Svf f_[kMaxModes];
-    Svf f_bow_[kMaxBowedModes];
+    // Modes and bowed modes are stored as structures of arrays and
+    // processed several at a time, one sample after the other.
+    stmlib::SvfBank<kMaxModes> f_;
+    stmlib::SvfBank<kMaxBowedModes> f_bow_;
+    double gain_[kMaxModes];
+    double bow_gain_[kMaxBowedModes];
     uint8_t active_[kMaxModes];
+    uint8_t bow_active_[kMaxBowedModes];
+    
+    double center_weight_[kMaxModes];
+    double side_weight_[kMaxModes];
+    double bow_weight_[kMaxBowedModes];
+    double band_pass_[kMaxModes];
+    double bow_input_[kMaxBowedModes];
     
     //stmlib::DelayLine<double, kMaxDelayLineSize> d_bow_[kMaxBowedModes];
     stmlib::DelayLine<double, 1024> d_bow_[kMaxBowedModes];
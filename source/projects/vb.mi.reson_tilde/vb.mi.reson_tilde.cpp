@@ -33,6 +33,9 @@
 
 #include "dsp.h"
 #include "resonator.h"
+#include "denormals.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
 
 //#include "Accelerate/Accelerate.h"
 
@@ -47,6 +50,7 @@ using namespace c74::max;
 static t_class* this_class = nullptr;
 t_symbol *ps_freqs;
 t_symbol *ps_qs;
+t_symbol *ps_sleep;
 
 struct t_myObj {
     t_pxobject  x_obj;
@@ -70,11 +74,20 @@ struct t_myObj {
     // last coeffs calculation method
     bool        filter_calc_elements;
     void        *info_out;
+    
+    // sleep mode
+    vbmi::SleepDetector sleep_detector;
+    char        sleep;
+    double      sleep_threshold;
+    double      sleep_time;
+    t_qelem     *sleep_qelem;
 };
 
 
+void myObj_sleep_report(t_myObj *self);
+
 
-void* myObj_new(void) {
+void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
     t_myObj* self = (t_myObj*)object_alloc(this_class);
     
     if(self)
@@ -119,6 +132,13 @@ void* myObj_new(void) {
         self->resonator.set_frequency(100.0);
         self->resonator.ComputeFilters(self->freqs, self->qs, self->gains);
         self->filter_calc_elements = true;
+        
+        self->sleep_detector.Init(self->sr);
+        self->sleep_threshold = vbmi::kDefaultSleepThreshold;
+        self->sleep_time = vbmi::kDefaultSleepTime;
+        self->sleep_qelem = qelem_new(self, (method)myObj_sleep_report);
+        
+        attr_args_process(self, argc, argv);
 
     }
     else {
@@ -267,6 +287,43 @@ void myObj_xf_resonators(t_myObj *self, double f)
     self->resonator.xf_resonators(f);
 }
 
+#pragma mark ----------- sleep mode -------------
+
+t_max_err sleep_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep = atom_getlong(av) != 0;
+        self->sleep_detector.set_enabled(self->sleep);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_threshold_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_threshold = CLAMP(atom_getfloat(av), -140., 0.);
+        self->sleep_detector.set_threshold(self->sleep_threshold);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_time_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_time = CLAMP(atom_getfloat(av), 10., 60000.);
+        self->sleep_detector.set_hang_time(self->sleep_time);
+    }
+    return MAX_ERR_NONE;
+}
+
+// 'sleep 1' when the resonator fell asleep, 'sleep 0' when it woke up
+void myObj_sleep_report(t_myObj *self) {
+    t_atom a;
+    atom_setlong(&a, self->sleep_detector.sleeping());
+    outlet_anything(self->info_out, ps_sleep, 1, &a);
+}
+
+
 inline void SoftLimit_block(double *inout, size_t size) {
     while(size--) {
         double x2 = (*inout)*(*inout);
@@ -281,6 +338,7 @@ inline void SoftLimit_block(double *inout, size_t size) {
 // 64 bit signal input version
 void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
                      double **outs, long numouts, long sampleframes, long flags, void *userparam){
+    vbmi::ScopedFlushDenormals flush_denormals;
     
     double *in = ins[0];
     double *outL = outs[0];
@@ -300,6 +358,12 @@ void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
         return;
     }
     
+    if(!self->sleep_detector.Awake(vbmi::vec::MaxAbs(in, sampleframes), false)) {
+        memset(outL, 0, sampleframes*sizeof(double));
+        memset(outR, 0, sampleframes*sizeof(double));
+        return;
+    }
+    
     memset(center, 0, vs*sizeof(double));
     memset(side, 0, vs*sizeof(double));
     
@@ -313,6 +377,12 @@ void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
     
     SoftLimit_block(outL, sampleframes);
     SoftLimit_block(outR, sampleframes);
+    
+    double out_peak = std::max(vbmi::vec::MaxAbs(outL, sampleframes),
+                               vbmi::vec::MaxAbs(outR, sampleframes));
+    self->sleep_detector.Update(out_peak, sampleframes);
+    if(self->sleep_detector.changed())
+        qelem_set(self->sleep_qelem);
 }
 
 
@@ -320,6 +390,7 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
 {
     self->sr = samplerate;
     if(self->sr<=0) self->sr = 44100.0;
+    self->sleep_detector.set_sample_rate(self->sr);
 
     object_method_direct(void, (t_object*, t_object*, t_perfroutine64, long, void*),
                          dsp64, gensym("dsp_add64"), (t_object*)self, (t_perfroutine64)myObj_perform64, 0, NULL);
@@ -341,6 +412,7 @@ void myObj_free(t_myObj* self)
     
     if(self->center) sysmem_freeptr(self->center);
     if(self->side) sysmem_freeptr(self->side);
+    if(self->sleep_qelem) qelem_free(self->sleep_qelem);
 }
 
 
@@ -362,6 +434,9 @@ void myObj_assist(t_myObj* self, void* unused, t_assist_function io, long index,
             case 1:
                 strncpy(string_dest,"(signal) OUT R", ASSIST_STRING_MAXSIZE);
                 break;
+            case 2:
+                strncpy(string_dest,"(list) freqs, qs, sleep 0/1", ASSIST_STRING_MAXSIZE);
+                break;
         }
     }
 }
@@ -389,8 +464,26 @@ void ext_main(void* r) {
     class_dspinit(this_class);
     class_register(CLASS_BOX, this_class);
     
+    // attributes ====
+    // skip the resonator when input and output are silent
+    CLASS_ATTR_CHAR(this_class, "sleep", 0, t_myObj, sleep);
+    CLASS_ATTR_STYLE_LABEL(this_class, "sleep", 0, "onoff", "sleep when silent");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep", NULL, (method)sleep_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_threshold", 0, t_myObj, sleep_threshold);
+    CLASS_ATTR_LABEL(this_class, "sleep_threshold", 0, "sleep threshold (dB)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_threshold", NULL, (method)sleep_threshold_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_threshold", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_time", 0, t_myObj, sleep_time);
+    CLASS_ATTR_LABEL(this_class, "sleep_time", 0, "silence before sleeping (ms)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_time", NULL, (method)sleep_time_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_time", 0);
+    
     ps_freqs = gensym("freqs");
     ps_qs = gensym("qs");
+    ps_sleep = gensym("sleep");
     
     object_post(NULL, "vb.mi.reson~ by volker böhm --> https://vboehm.net");
     object_post(NULL, "resonator of the 'elements' module by mutable instruments");
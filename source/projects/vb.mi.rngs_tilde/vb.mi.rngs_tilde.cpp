@@ -32,26 +32,26 @@
 #include "c74_msp.h"
 
 #include "read_inputs.h"
+#include "control_inputs.h"
+#include "denormals.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
 
 #include "rings/dsp/part.h"
 #include "rings/dsp/strummer.h"
 #include "rings/dsp/string_synth_part.h"
 #include "rings/dsp/dsp.h"
+#include "stmlib/utils/random.h"
 
-#ifdef __APPLE__
-#include "Accelerate/Accelerate.h"
-#endif
 
 
 using namespace c74::max;
 
 
 static t_class* this_class = nullptr;
+t_symbol *ps_sleep;
 
 
-double rings::Dsp::sr = 48000.0;
-double rings::Dsp::a3 = 440.0 / 48000.0;
-
 const int kBlockSize = rings::kMaxBlockSize;
 
 
@@ -62,11 +62,17 @@ struct t_myObj {
     rings::StringSynthPart  string_synth;
     rings::Strummer         strummer;
     rings::ReadInputs       read_inputs;
+    vbmi::ControlInputs<6>  controls;       // fm, 4 cv, v/oct
+    vbmi::SleepDetector     sleep_detector;
 
     double                  in_level;
     
     uint16_t                *reverb_buffer;
     
+    real_t                  in[kBlockSize];
+    real_t                  out[kBlockSize];
+    real_t                  aux[kBlockSize];
+    
     rings::PerformanceState performance_state;
     rings::Patch            patch;
     
@@ -76,17 +82,31 @@ struct t_myObj {
     short                   strum_connected;
     short                   fm_patched;
     bool                    easter_egg;
+    char                    cvrate;
+    uint32_t                rng_state;
+    stmlib::PendingSeed     seed;
+    
+    // sleep mode attributes
+    char                    sleep;
+    double                  sleep_threshold;
+    double                  sleep_time;
+    void                    *info_out;
+    t_qelem                 *sleep_qelem;
 };
 
 
+void myObj_sleep_report(t_myObj *self);
+
+
 
-void* myObj_new(void) {
+void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
     t_myObj* self = (t_myObj*)object_alloc(this_class);
     
     if(self)
     {
         dsp_setup((t_pxobject*)self, 8);        // 8 signal inlets
         
+        self->info_out = outlet_new((t_object *)self, NULL);
         outlet_new(self, "signal"); // 'out' output
         outlet_new(self, "signal"); // 'aux' output
         
@@ -102,12 +122,13 @@ void* myObj_new(void) {
         
         
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         if(self->sr <= 0.0)
             self->sr = 48000.0;
         
         
         // set actual Sampling Rate
-        rings::Dsp::setSr(self->sr);
+        rings::Dsp dsp(self->sr);
         
 
         self->in_level = 0.0;
@@ -138,11 +159,13 @@ void* myObj_new(void) {
         memset(&self->string_synth, 0, sizeof(self->string_synth));
         
 
-        self->strummer.Init(0.01, rings::Dsp::getSr() / kBlockSize);
-        self->part.Init(self->reverb_buffer);
-        self->string_synth.Init(self->reverb_buffer);
+        self->strummer.Init(0.01, dsp.getSr() / kBlockSize, dsp);
+        self->part.Init(self->reverb_buffer, dsp);
+        self->string_synth.Init(self->reverb_buffer, dsp);
         
         self->read_inputs.Init();
+        self->cvrate = vbmi::CONTROL_RATE_BLOCK;
+        self->controls.Init(vbmi::ControlRate(self->cvrate));
 
         self->part.set_polyphony(1);
         self->part.set_model(rings::RESONATOR_MODEL_MODAL);
@@ -151,8 +174,15 @@ void* myObj_new(void) {
         
         self->easter_egg = false;
         
+        self->sleep_detector.Init(self->sr);
+        self->sleep_threshold = vbmi::kDefaultSleepThreshold;
+        self->sleep_time = vbmi::kDefaultSleepTime;
+        self->sleep_qelem = qelem_new(self, (method)myObj_sleep_report);
+        
         // seems like we need this...
         self->obj.z_misc = Z_NO_INPLACE;
+        
+        attr_args_process(self, argc, argv);
     }
     else {
         object_free(self);
@@ -296,21 +326,67 @@ void myObj_model(t_myObj* self, long n) {
     self->string_synth.set_fx(static_cast<rings::FxType>(n));
 }
 
+t_max_err cvrate_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->cvrate = CLAMP(atom_getlong(av), 0, vbmi::CONTROL_RATE_LAST - 1);
+        self->controls.set_rate(vbmi::ControlRate(self->cvrate));
+    }
+    return MAX_ERR_NONE;
+}
+
 void myObj_bypass(t_myObj* self, long n) {
     self->part.set_bypass(n != 0);
 }
 
 
+#pragma mark ----- sleep mode -----
+
+t_max_err sleep_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep = atom_getlong(av) != 0;
+        self->sleep_detector.set_enabled(self->sleep);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_threshold_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_threshold = CLAMP(atom_getfloat(av), -140., 0.);
+        self->sleep_detector.set_threshold(self->sleep_threshold);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_time_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_time = CLAMP(atom_getfloat(av), 10., 60000.);
+        self->sleep_detector.set_hang_time(self->sleep_time);
+    }
+    return MAX_ERR_NONE;
+}
+
+// 'sleep 1' when the resonator fell asleep, 'sleep 0' when it woke up
+void myObj_sleep_report(t_myObj *self) {
+    t_atom a;
+    atom_setlong(&a, self->sleep_detector.sleeping());
+    outlet_anything(self->info_out, ps_sleep, 1, &a);
+}
+
+
 
 // change the sample rate and or blockSize and reinit
 void reinit(t_myObj* self, double newSR)
 {
-    rings::Dsp::setSr(newSR);
+    rings::Dsp dsp(newSR);
     
-    self->strummer.Init(0.01, rings::Dsp::getSr() / kBlockSize);
+    self->strummer.Init(0.01, dsp.getSr() / kBlockSize, dsp);
     
-    self->part.Init(self->reverb_buffer);
-    self->string_synth.Init(self->reverb_buffer);
+    self->part.Init(self->reverb_buffer, dsp);
+    self->string_synth.Init(self->reverb_buffer, dsp);
 }
 
 
@@ -323,10 +399,18 @@ void myObj_reset(t_myObj *self) {
 
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark ----- dsp loop -----
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double *in = ins[0];
     double *out = outs[0];
     double *out2 = outs[1];
@@ -338,60 +422,81 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     if (self->obj.z_disabled)
         return;
 
-    // FM input
-    cvinputs[0] = CLAMP(ins[1][0], -48., 48.);
-    
-    // read 'cv' input signals, store first value of a sig vector
-    for(int i=1; i<5; i++) {
-        // cv inputs are expected in -1. to 1. range
-        cvinputs[i] = CLAMP(ins[i+1][0], -1., 1.);  // leave out first inlet (which is audio in)
-    }
-    // if fm_cv is not patched, set it to a halftone constant (?)
-    // so fm_attenuverter can be used as pitch fine control
-    //if(!self->fm_patched)
-      //  cvinputs[0] = 0.0125;
-    
-    // v/oct input, no limits on range
-    cvinputs[5] = ins[6][0];
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
+
+    // fm, structure, brightness, damping, position and v/oct cv inlets
+    self->controls.Start(ins + 1);
     
     // 8 signal inlets, last one is strum input
     double *strum = ins[7];
-    double trigger = 0.;
+    bool strum_in = self->strum_connected && !self->performance_state.internal_strum;
+    bool vector_rate = self->controls.rate() == vbmi::CONTROL_RATE_VECTOR;
     
     // will not be used, if internal exciter is off
     // TODO: should we check for internal_exciter?
-    if(self->strum_connected && !self->performance_state.internal_strum) {
-#ifdef __APPLE__
-        vDSP_sveD(strum, 1, &trigger, vs);  // calc sum of trigger input
-#else
-        for(int i=0; i<vs; ++i)
-            trigger += strum[i];
-#endif
+    if(vector_rate) {
+        double trigger = 0.;
+        if(strum_in) {
+            trigger = vbmi::vec::Sum(strum, vs);  // calc sum of trigger input
+        }
+        cvinputs[16] = trigger;         // cvinputs[16] => ADC_CHANNEL_LAST,
     }
     
-    cvinputs[16] = trigger;         // cvinputs[16] => ADC_CHANNEL_LAST,
-    
-    
+    for(int count=0; count<vs; count+=size) {
         
-    if(self->easter_egg) {
-        for(int count=0; count<vs; count+=size) {
-            
-            self->read_inputs.Read(&self->patch, &self->performance_state, cvinputs);
-            
-            self->strummer.Process(NULL, size, &self->performance_state);
-            self->string_synth.Process(self->performance_state, self->patch, in+count, out+count, out2+count, size);
+        // read 'cv' input signals once per block
+        self->controls.Read(count, size);
+        
+        // FM input
+        cvinputs[0] = CLAMP(self->controls.value(0), -48., 48.);
+        for(int i=1; i<5; i++) {
+            // cv inputs are expected in -1. to 1. range
+            cvinputs[i] = CLAMP(self->controls.value(i), -1., 1.);
         }
-    }
-    else {
-        for(int count=0; count<vs; count+=size) {
-            
-            self->read_inputs.Read(&self->patch, &self->performance_state, cvinputs);
-            
-            self->strummer.Process(in+count, size, &self->performance_state);
-            self->part.Process(self->performance_state, self->patch, in+count, out+count, out2+count, size);
+        // v/oct input, no limits on range
+        cvinputs[5] = self->controls.value(5);
+        
+        if(!vector_rate) {
+            double trigger = 0.;
+            if(strum_in) {
+                trigger = vbmi::vec::Sum(strum + count, size);
+            }
+            cvinputs[16] = trigger;
+        }
+        
+        self->read_inputs.Read(&self->patch, &self->performance_state, cvinputs);
+        
+        vbmi::vec::Convert(in+count, self->in, size);
+        
+        // the strummer keeps running while the resonator sleeps,
+        // a strum wakes it up
+        if(self->easter_egg)
+            self->strummer.Process(NULL, size, &self->performance_state);
+        else
+            self->strummer.Process(self->in, size, &self->performance_state);
+        
+        double in_peak = vbmi::vec::MaxAbs(in+count, size);
+        if(!self->sleep_detector.Awake(in_peak, self->performance_state.strum)) {
+            memset(out+count, 0, size*sizeof(double));
+            memset(out2+count, 0, size*sizeof(double));
+            continue;
         }
+        
+        if(self->easter_egg)
+            self->string_synth.Process(self->performance_state, self->patch, self->in, self->out, self->aux, size);
+        else
+            self->part.Process(self->performance_state, self->patch, self->in, self->out, self->aux, size);
+        
+        vbmi::vec::Convert(self->out, out+count, size);
+        vbmi::vec::Convert(self->aux, out2+count, size);
+        
+        double out_peak = std::max(vbmi::vec::MaxAbs(out+count, size),
+                                   vbmi::vec::MaxAbs(out2+count, size));
+        self->sleep_detector.Update(out_peak, size);
     }
     
+    if(self->sleep_detector.changed())
+        qelem_set(self->sleep_qelem);
 }
 
 
@@ -404,6 +509,7 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
         self->sigvs = maxvectorsize;
         
         reinit(self, samplerate);
+        self->sleep_detector.set_sample_rate(samplerate);
     }
     
     if(self->sigvs < kBlockSize)
@@ -422,6 +528,8 @@ void myObj_free(t_myObj* self) {
     dsp_free((t_pxobject*)self);
     if(self->reverb_buffer)
         sysmem_freeptr(self->reverb_buffer);
+    if(self->sleep_qelem)
+        qelem_free(self->sleep_qelem);
 }
 
 
@@ -462,6 +570,9 @@ void myObj_assist(t_myObj* self, void* unused, t_assist_function io, long index,
             case 1:
                 strncpy(string_dest,"(signal) AUX", ASSIST_STRING_MAXSIZE);
                 break;
+            case 2:
+                strncpy(string_dest,"(list) sleep 0/1", ASSIST_STRING_MAXSIZE);
+                break;
         }
     }
 }
@@ -492,6 +603,7 @@ void ext_main(void* r) {
     class_addmethod(this_class, (method)myObj_reset,    "reset", 0);
     class_addmethod(this_class, (method)myObj_int,      "int",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_float,    "float",    A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,     "seed",     A_LONG, 0);
     class_addmethod(this_class, (method)myObj_info,     "info", 0);
     
     class_addmethod(this_class, (method)myObj_easter,     "easter", A_LONG, 0);
@@ -499,6 +611,33 @@ void ext_main(void* r) {
     class_dspinit(this_class);
     class_register(CLASS_BOX, this_class);
     
+    // ATTRIBUTES ..............
+    // how the cv inlets are sampled
+    CLASS_ATTR_CHAR(this_class, "cvrate", 0, t_myObj, cvrate);
+    CLASS_ATTR_ENUMINDEX(this_class, "cvrate", 0, "vector block average");
+    CLASS_ATTR_LABEL(this_class, "cvrate", 0, "cv input rate");
+    CLASS_ATTR_FILTER_CLIP(this_class, "cvrate", 0, 2);
+    CLASS_ATTR_ACCESSORS(this_class, "cvrate", NULL, (method)cvrate_setter);
+    CLASS_ATTR_SAVE(this_class, "cvrate", 0);
+    
+    // skip the resonator when input and output are silent
+    CLASS_ATTR_CHAR(this_class, "sleep", 0, t_myObj, sleep);
+    CLASS_ATTR_STYLE_LABEL(this_class, "sleep", 0, "onoff", "sleep when silent");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep", NULL, (method)sleep_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_threshold", 0, t_myObj, sleep_threshold);
+    CLASS_ATTR_LABEL(this_class, "sleep_threshold", 0, "sleep threshold (dB)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_threshold", NULL, (method)sleep_threshold_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_threshold", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_time", 0, t_myObj, sleep_time);
+    CLASS_ATTR_LABEL(this_class, "sleep_time", 0, "silence before sleeping (ms)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_time", NULL, (method)sleep_time_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_time", 0);
+    
+    ps_sleep = gensym("sleep");
+    
     object_post(NULL, "vb.mi.rngs~ by volker böhm --> vboehm.net");
     object_post(NULL, "a clone of mutable instruments' 'Rings' module");
 }
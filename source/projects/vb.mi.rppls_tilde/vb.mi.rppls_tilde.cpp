@@ -28,6 +28,7 @@
 #include "c74_msp.h"
 
 #include "ripples.hpp"
+#include "denormals.h"
 
 
 
@@ -135,6 +136,8 @@ inline void SoftLimit_block(double *inout, double drive, size_t size) {
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double *in = ins[0];
     double *freq_in = ins[1];
     double *res_in = ins[2];
@@ -1,3970 +0,0 @@
-// Copyright 2017 Emilie Gillet.
-//
-// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-// 
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-// 
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-// 
-// See http://creativecommons.org/licenses/MIT/ for more information.
-//
-// -----------------------------------------------------------------------------
-//
-// Resources definitions.
-//
-// Automatically generated with:
-// make resources
-
-
-#include "tides2/resources.h"
-
-namespace tides {
-
-const float lut_sine[] = {
-   0.000000000e+00,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-   2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-   4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-   7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-   9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-   1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-   1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-   1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-   1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-   2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-   2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-   2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-   2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-   3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-   3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-   3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-   3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-   4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-   4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-   4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-   4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-   4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-   5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-   5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-   5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-   5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-   5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-   6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-   6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-   6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-   6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-   6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-   7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-   7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-   7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-   7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-   7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-   7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-   8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-   8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-   8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-   8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-   8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-   8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-   8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-   8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-   9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-   9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-   9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-   9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-   9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-   9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-   9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-   9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-   9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-   9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-   9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-   9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-   9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-   9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-   9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-   9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-   9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-   9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-   1.000000000e+00,  9.999811753e-01,  9.999247018e-01,  9.998305818e-01,
-   9.996988187e-01,  9.995294175e-01,  9.993223846e-01,  9.990777278e-01,
-   9.987954562e-01,  9.984755806e-01,  9.981181129e-01,  9.977230666e-01,
-   9.972904567e-01,  9.968202993e-01,  9.963126122e-01,  9.957674145e-01,
-   9.951847267e-01,  9.945645707e-01,  9.939069700e-01,  9.932119492e-01,
-   9.924795346e-01,  9.917097537e-01,  9.909026354e-01,  9.900582103e-01,
-   9.891765100e-01,  9.882575677e-01,  9.873014182e-01,  9.863080972e-01,
-   9.852776424e-01,  9.842100924e-01,  9.831054874e-01,  9.819638691e-01,
-   9.807852804e-01,  9.795697657e-01,  9.783173707e-01,  9.770281427e-01,
-   9.757021300e-01,  9.743393828e-01,  9.729399522e-01,  9.715038910e-01,
-   9.700312532e-01,  9.685220943e-01,  9.669764710e-01,  9.653944417e-01,
-   9.637760658e-01,  9.621214043e-01,  9.604305194e-01,  9.587034749e-01,
-   9.569403357e-01,  9.551411683e-01,  9.533060404e-01,  9.514350210e-01,
-   9.495281806e-01,  9.475855910e-01,  9.456073254e-01,  9.435934582e-01,
-   9.415440652e-01,  9.394592236e-01,  9.373390119e-01,  9.351835099e-01,
-   9.329927988e-01,  9.307669611e-01,  9.285060805e-01,  9.262102421e-01,
-   9.238795325e-01,  9.215140393e-01,  9.191138517e-01,  9.166790599e-01,
-   9.142097557e-01,  9.117060320e-01,  9.091679831e-01,  9.065957045e-01,
-   9.039892931e-01,  9.013488470e-01,  8.986744657e-01,  8.959662498e-01,
-   8.932243012e-01,  8.904487232e-01,  8.876396204e-01,  8.847970984e-01,
-   8.819212643e-01,  8.790122264e-01,  8.760700942e-01,  8.730949784e-01,
-   8.700869911e-01,  8.670462455e-01,  8.639728561e-01,  8.608669386e-01,
-   8.577286100e-01,  8.545579884e-01,  8.513551931e-01,  8.481203448e-01,
-   8.448535652e-01,  8.415549774e-01,  8.382247056e-01,  8.348628750e-01,
-   8.314696123e-01,  8.280450453e-01,  8.245893028e-01,  8.211025150e-01,
-   8.175848132e-01,  8.140363297e-01,  8.104571983e-01,  8.068475535e-01,
-   8.032075315e-01,  7.995372691e-01,  7.958369046e-01,  7.921065773e-01,
-   7.883464276e-01,  7.845565972e-01,  7.807372286e-01,  7.768884657e-01,
-   7.730104534e-01,  7.691033376e-01,  7.651672656e-01,  7.612023855e-01,
-   7.572088465e-01,  7.531867990e-01,  7.491363945e-01,  7.450577854e-01,
-   7.409511254e-01,  7.368165689e-01,  7.326542717e-01,  7.284643904e-01,
-   7.242470830e-01,  7.200025080e-01,  7.157308253e-01,  7.114321957e-01,
-   7.071067812e-01,  7.027547445e-01,  6.983762494e-01,  6.939714609e-01,
-   6.895405447e-01,  6.850836678e-01,  6.806009978e-01,  6.760927036e-01,
-   6.715589548e-01,  6.669999223e-01,  6.624157776e-01,  6.578066933e-01,
-   6.531728430e-01,  6.485144010e-01,  6.438315429e-01,  6.391244449e-01,
-   6.343932842e-01,  6.296382389e-01,  6.248594881e-01,  6.200572118e-01,
-   6.152315906e-01,  6.103828063e-01,  6.055110414e-01,  6.006164794e-01,
-   5.956993045e-01,  5.907597019e-01,  5.857978575e-01,  5.808139581e-01,
-   5.758081914e-01,  5.707807459e-01,  5.657318108e-01,  5.606615762e-01,
-   5.555702330e-01,  5.504579729e-01,  5.453249884e-01,  5.401714727e-01,
-   5.349976199e-01,  5.298036247e-01,  5.245896827e-01,  5.193559902e-01,
-   5.141027442e-01,  5.088301425e-01,  5.035383837e-01,  4.982276670e-01,
-   4.928981922e-01,  4.875501601e-01,  4.821837721e-01,  4.767992301e-01,
-   4.713967368e-01,  4.659764958e-01,  4.605387110e-01,  4.550835871e-01,
-   4.496113297e-01,  4.441221446e-01,  4.386162385e-01,  4.330938189e-01,
-   4.275550934e-01,  4.220002708e-01,  4.164295601e-01,  4.108431711e-01,
-   4.052413140e-01,  3.996241998e-01,  3.939920401e-01,  3.883450467e-01,
-   3.826834324e-01,  3.770074102e-01,  3.713171940e-01,  3.656129978e-01,
-   3.598950365e-01,  3.541635254e-01,  3.484186802e-01,  3.426607173e-01,
-   3.368898534e-01,  3.311063058e-01,  3.253102922e-01,  3.195020308e-01,
-   3.136817404e-01,  3.078496400e-01,  3.020059493e-01,  2.961508882e-01,
-   2.902846773e-01,  2.844075372e-01,  2.785196894e-01,  2.726213554e-01,
-   2.667127575e-01,  2.607941179e-01,  2.548656596e-01,  2.489276057e-01,
-   2.429801799e-01,  2.370236060e-01,  2.310581083e-01,  2.250839114e-01,
-   2.191012402e-01,  2.131103199e-01,  2.071113762e-01,  2.011046348e-01,
-   1.950903220e-01,  1.890686641e-01,  1.830398880e-01,  1.770042204e-01,
-   1.709618888e-01,  1.649131205e-01,  1.588581433e-01,  1.527971853e-01,
-   1.467304745e-01,  1.406582393e-01,  1.345807085e-01,  1.284981108e-01,
-   1.224106752e-01,  1.163186309e-01,  1.102222073e-01,  1.041216339e-01,
-   9.801714033e-02,  9.190895650e-02,  8.579731234e-02,  7.968243797e-02,
-   7.356456360e-02,  6.744391956e-02,  6.132073630e-02,  5.519524435e-02,
-   4.906767433e-02,  4.293825693e-02,  3.680722294e-02,  3.067480318e-02,
-   2.454122852e-02,  1.840672991e-02,  1.227153829e-02,  6.135884649e-03,
-   1.224646799e-16, -6.135884649e-03, -1.227153829e-02, -1.840672991e-02,
-  -2.454122852e-02, -3.067480318e-02, -3.680722294e-02, -4.293825693e-02,
-  -4.906767433e-02, -5.519524435e-02, -6.132073630e-02, -6.744391956e-02,
-  -7.356456360e-02, -7.968243797e-02, -8.579731234e-02, -9.190895650e-02,
-  -9.801714033e-02, -1.041216339e-01, -1.102222073e-01, -1.163186309e-01,
-  -1.224106752e-01, -1.284981108e-01, -1.345807085e-01, -1.406582393e-01,
-  -1.467304745e-01, -1.527971853e-01, -1.588581433e-01, -1.649131205e-01,
-  -1.709618888e-01, -1.770042204e-01, -1.830398880e-01, -1.890686641e-01,
-  -1.950903220e-01, -2.011046348e-01, -2.071113762e-01, -2.131103199e-01,
-  -2.191012402e-01, -2.250839114e-01, -2.310581083e-01, -2.370236060e-01,
-  -2.429801799e-01, -2.489276057e-01, -2.548656596e-01, -2.607941179e-01,
-  -2.667127575e-01, -2.726213554e-01, -2.785196894e-01, -2.844075372e-01,
-  -2.902846773e-01, -2.961508882e-01, -3.020059493e-01, -3.078496400e-01,
-  -3.136817404e-01, -3.195020308e-01, -3.253102922e-01, -3.311063058e-01,
-  -3.368898534e-01, -3.426607173e-01, -3.484186802e-01, -3.541635254e-01,
-  -3.598950365e-01, -3.656129978e-01, -3.713171940e-01, -3.770074102e-01,
-  -3.826834324e-01, -3.883450467e-01, -3.939920401e-01, -3.996241998e-01,
-  -4.052413140e-01, -4.108431711e-01, -4.164295601e-01, -4.220002708e-01,
-  -4.275550934e-01, -4.330938189e-01, -4.386162385e-01, -4.441221446e-01,
-  -4.496113297e-01, -4.550835871e-01, -4.605387110e-01, -4.659764958e-01,
-  -4.713967368e-01, -4.767992301e-01, -4.821837721e-01, -4.875501601e-01,
-  -4.928981922e-01, -4.982276670e-01, -5.035383837e-01, -5.088301425e-01,
-  -5.141027442e-01, -5.193559902e-01, -5.245896827e-01, -5.298036247e-01,
-  -5.349976199e-01, -5.401714727e-01, -5.453249884e-01, -5.504579729e-01,
-  -5.555702330e-01, -5.606615762e-01, -5.657318108e-01, -5.707807459e-01,
-  -5.758081914e-01, -5.808139581e-01, -5.857978575e-01, -5.907597019e-01,
-  -5.956993045e-01, -6.006164794e-01, -6.055110414e-01, -6.103828063e-01,
-  -6.152315906e-01, -6.200572118e-01, -6.248594881e-01, -6.296382389e-01,
-  -6.343932842e-01, -6.391244449e-01, -6.438315429e-01, -6.485144010e-01,
-  -6.531728430e-01, -6.578066933e-01, -6.624157776e-01, -6.669999223e-01,
-  -6.715589548e-01, -6.760927036e-01, -6.806009978e-01, -6.850836678e-01,
-  -6.895405447e-01, -6.939714609e-01, -6.983762494e-01, -7.027547445e-01,
-  -7.071067812e-01, -7.114321957e-01, -7.157308253e-01, -7.200025080e-01,
-  -7.242470830e-01, -7.284643904e-01, -7.326542717e-01, -7.368165689e-01,
-  -7.409511254e-01, -7.450577854e-01, -7.491363945e-01, -7.531867990e-01,
-  -7.572088465e-01, -7.612023855e-01, -7.651672656e-01, -7.691033376e-01,
-  -7.730104534e-01, -7.768884657e-01, -7.807372286e-01, -7.845565972e-01,
-  -7.883464276e-01, -7.921065773e-01, -7.958369046e-01, -7.995372691e-01,
-  -8.032075315e-01, -8.068475535e-01, -8.104571983e-01, -8.140363297e-01,
-  -8.175848132e-01, -8.211025150e-01, -8.245893028e-01, -8.280450453e-01,
-  -8.314696123e-01, -8.348628750e-01, -8.382247056e-01, -8.415549774e-01,
-  -8.448535652e-01, -8.481203448e-01, -8.513551931e-01, -8.545579884e-01,
-  -8.577286100e-01, -8.608669386e-01, -8.639728561e-01, -8.670462455e-01,
-  -8.700869911e-01, -8.730949784e-01, -8.760700942e-01, -8.790122264e-01,
-  -8.819212643e-01, -8.847970984e-01, -8.876396204e-01, -8.904487232e-01,
-  -8.932243012e-01, -8.959662498e-01, -8.986744657e-01, -9.013488470e-01,
-  -9.039892931e-01, -9.065957045e-01, -9.091679831e-01, -9.117060320e-01,
-  -9.142097557e-01, -9.166790599e-01, -9.191138517e-01, -9.215140393e-01,
-  -9.238795325e-01, -9.262102421e-01, -9.285060805e-01, -9.307669611e-01,
-  -9.329927988e-01, -9.351835099e-01, -9.373390119e-01, -9.394592236e-01,
-  -9.415440652e-01, -9.435934582e-01, -9.456073254e-01, -9.475855910e-01,
-  -9.495281806e-01, -9.514350210e-01, -9.533060404e-01, -9.551411683e-01,
-  -9.569403357e-01, -9.587034749e-01, -9.604305194e-01, -9.621214043e-01,
-  -9.637760658e-01, -9.653944417e-01, -9.669764710e-01, -9.685220943e-01,
-  -9.700312532e-01, -9.715038910e-01, -9.729399522e-01, -9.743393828e-01,
-  -9.757021300e-01, -9.770281427e-01, -9.783173707e-01, -9.795697657e-01,
-  -9.807852804e-01, -9.819638691e-01, -9.831054874e-01, -9.842100924e-01,
-  -9.852776424e-01, -9.863080972e-01, -9.873014182e-01, -9.882575677e-01,
-  -9.891765100e-01, -9.900582103e-01, -9.909026354e-01, -9.917097537e-01,
-  -9.924795346e-01, -9.932119492e-01, -9.939069700e-01, -9.945645707e-01,
-  -9.951847267e-01, -9.957674145e-01, -9.963126122e-01, -9.968202993e-01,
-  -9.972904567e-01, -9.977230666e-01, -9.981181129e-01, -9.984755806e-01,
-  -9.987954562e-01, -9.990777278e-01, -9.993223846e-01, -9.995294175e-01,
-  -9.996988187e-01, -9.998305818e-01, -9.999247018e-01, -9.999811753e-01,
-  -1.000000000e+00, -9.999811753e-01, -9.999247018e-01, -9.998305818e-01,
-  -9.996988187e-01, -9.995294175e-01, -9.993223846e-01, -9.990777278e-01,
-  -9.987954562e-01, -9.984755806e-01, -9.981181129e-01, -9.977230666e-01,
-  -9.972904567e-01, -9.968202993e-01, -9.963126122e-01, -9.957674145e-01,
-  -9.951847267e-01, -9.945645707e-01, -9.939069700e-01, -9.932119492e-01,
-  -9.924795346e-01, -9.917097537e-01, -9.909026354e-01, -9.900582103e-01,
-  -9.891765100e-01, -9.882575677e-01, -9.873014182e-01, -9.863080972e-01,
-  -9.852776424e-01, -9.842100924e-01, -9.831054874e-01, -9.819638691e-01,
-  -9.807852804e-01, -9.795697657e-01, -9.783173707e-01, -9.770281427e-01,
-  -9.757021300e-01, -9.743393828e-01, -9.729399522e-01, -9.715038910e-01,
-  -9.700312532e-01, -9.685220943e-01, -9.669764710e-01, -9.653944417e-01,
-  -9.637760658e-01, -9.621214043e-01, -9.604305194e-01, -9.587034749e-01,
-  -9.569403357e-01, -9.551411683e-01, -9.533060404e-01, -9.514350210e-01,
-  -9.495281806e-01, -9.475855910e-01, -9.456073254e-01, -9.435934582e-01,
-  -9.415440652e-01, -9.394592236e-01, -9.373390119e-01, -9.351835099e-01,
-  -9.329927988e-01, -9.307669611e-01, -9.285060805e-01, -9.262102421e-01,
-  -9.238795325e-01, -9.215140393e-01, -9.191138517e-01, -9.166790599e-01,
-  -9.142097557e-01, -9.117060320e-01, -9.091679831e-01, -9.065957045e-01,
-  -9.039892931e-01, -9.013488470e-01, -8.986744657e-01, -8.959662498e-01,
-  -8.932243012e-01, -8.904487232e-01, -8.876396204e-01, -8.847970984e-01,
-  -8.819212643e-01, -8.790122264e-01, -8.760700942e-01, -8.730949784e-01,
-  -8.700869911e-01, -8.670462455e-01, -8.639728561e-01, -8.608669386e-01,
-  -8.577286100e-01, -8.545579884e-01, -8.513551931e-01, -8.481203448e-01,
-  -8.448535652e-01, -8.415549774e-01, -8.382247056e-01, -8.348628750e-01,
-  -8.314696123e-01, -8.280450453e-01, -8.245893028e-01, -8.211025150e-01,
-  -8.175848132e-01, -8.140363297e-01, -8.104571983e-01, -8.068475535e-01,
-  -8.032075315e-01, -7.995372691e-01, -7.958369046e-01, -7.921065773e-01,
-  -7.883464276e-01, -7.845565972e-01, -7.807372286e-01, -7.768884657e-01,
-  -7.730104534e-01, -7.691033376e-01, -7.651672656e-01, -7.612023855e-01,
-  -7.572088465e-01, -7.531867990e-01, -7.491363945e-01, -7.450577854e-01,
-  -7.409511254e-01, -7.368165689e-01, -7.326542717e-01, -7.284643904e-01,
-  -7.242470830e-01, -7.200025080e-01, -7.157308253e-01, -7.114321957e-01,
-  -7.071067812e-01, -7.027547445e-01, -6.983762494e-01, -6.939714609e-01,
-  -6.895405447e-01, -6.850836678e-01, -6.806009978e-01, -6.760927036e-01,
-  -6.715589548e-01, -6.669999223e-01, -6.624157776e-01, -6.578066933e-01,
-  -6.531728430e-01, -6.485144010e-01, -6.438315429e-01, -6.391244449e-01,
-  -6.343932842e-01, -6.296382389e-01, -6.248594881e-01, -6.200572118e-01,
-  -6.152315906e-01, -6.103828063e-01, -6.055110414e-01, -6.006164794e-01,
-  -5.956993045e-01, -5.907597019e-01, -5.857978575e-01, -5.808139581e-01,
-  -5.758081914e-01, -5.707807459e-01, -5.657318108e-01, -5.606615762e-01,
-  -5.555702330e-01, -5.504579729e-01, -5.453249884e-01, -5.401714727e-01,
-  -5.349976199e-01, -5.298036247e-01, -5.245896827e-01, -5.193559902e-01,
-  -5.141027442e-01, -5.088301425e-01, -5.035383837e-01, -4.982276670e-01,
-  -4.928981922e-01, -4.875501601e-01, -4.821837721e-01, -4.767992301e-01,
-  -4.713967368e-01, -4.659764958e-01, -4.605387110e-01, -4.550835871e-01,
-  -4.496113297e-01, -4.441221446e-01, -4.386162385e-01, -4.330938189e-01,
-  -4.275550934e-01, -4.220002708e-01, -4.164295601e-01, -4.108431711e-01,
-  -4.052413140e-01, -3.996241998e-01, -3.939920401e-01, -3.883450467e-01,
-  -3.826834324e-01, -3.770074102e-01, -3.713171940e-01, -3.656129978e-01,
-  -3.598950365e-01, -3.541635254e-01, -3.484186802e-01, -3.426607173e-01,
-  -3.368898534e-01, -3.311063058e-01, -3.253102922e-01, -3.195020308e-01,
-  -3.136817404e-01, -3.078496400e-01, -3.020059493e-01, -2.961508882e-01,
-  -2.902846773e-01, -2.844075372e-01, -2.785196894e-01, -2.726213554e-01,
-  -2.667127575e-01, -2.607941179e-01, -2.548656596e-01, -2.489276057e-01,
-  -2.429801799e-01, -2.370236060e-01, -2.310581083e-01, -2.250839114e-01,
-  -2.191012402e-01, -2.131103199e-01, -2.071113762e-01, -2.011046348e-01,
-  -1.950903220e-01, -1.890686641e-01, -1.830398880e-01, -1.770042204e-01,
-  -1.709618888e-01, -1.649131205e-01, -1.588581433e-01, -1.527971853e-01,
-  -1.467304745e-01, -1.406582393e-01, -1.345807085e-01, -1.284981108e-01,
-  -1.224106752e-01, -1.163186309e-01, -1.102222073e-01, -1.041216339e-01,
-  -9.801714033e-02, -9.190895650e-02, -8.579731234e-02, -7.968243797e-02,
-  -7.356456360e-02, -6.744391956e-02, -6.132073630e-02, -5.519524435e-02,
-  -4.906767433e-02, -4.293825693e-02, -3.680722294e-02, -3.067480318e-02,
-  -2.454122852e-02, -1.840672991e-02, -1.227153829e-02, -6.135884649e-03,
-  -2.449293598e-16,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-   2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-   4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-   7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-   9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-   1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-   1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-   1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-   1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-   2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-   2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-   2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-   2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-   3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-   3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-   3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-   3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-   4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-   4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-   4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-   4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-   4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-   5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-   5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-   5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-   5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-   5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-   6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-   6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-   6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-   6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-   6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-   7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-   7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-   7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-   7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-   7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-   7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-   8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-   8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-   8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-   8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-   8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-   8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-   8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-   8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-   9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-   9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-   9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-   9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-   9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-   9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-   9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-   9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-   9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-   9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-   9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-   9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-   9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-   9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-   9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-   9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-   9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-   9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-   1.000000000e+00,
-};
-const float lut_bipolar_fold[] = {
-  -9.990209063e-01, -9.985272185e-01, -9.980307434e-01, -9.975314641e-01,
-  -9.970293667e-01, -9.965244401e-01, -9.960166762e-01, -9.955060704e-01,
-  -9.949926213e-01, -9.944763312e-01, -9.939572061e-01, -9.934352558e-01,
-  -9.929104943e-01, -9.923829397e-01, -9.918526141e-01, -9.913195444e-01,
-  -9.907837617e-01, -9.902453018e-01, -9.897042051e-01, -9.891605167e-01,
-  -9.886142867e-01, -9.880655696e-01, -9.875144250e-01, -9.869609173e-01,
-  -9.864051156e-01, -9.858470938e-01, -9.852869306e-01, -9.847247091e-01,
-  -9.841605170e-01, -9.835944466e-01, -9.830265939e-01, -9.824570595e-01,
-  -9.818859474e-01, -9.813133655e-01, -9.807394248e-01, -9.801642395e-01,
-  -9.795879264e-01, -9.790106049e-01, -9.784323961e-01, -9.778534229e-01,
-  -9.772738093e-01, -9.766936799e-01, -9.761131597e-01, -9.755323731e-01,
-  -9.749514439e-01, -9.743704941e-01, -9.737896439e-01, -9.732090107e-01,
-  -9.726287084e-01, -9.720488469e-01, -9.714695313e-01, -9.708908612e-01,
-  -9.703129298e-01, -9.697358234e-01, -9.691596203e-01, -9.685843901e-01,
-  -9.680101930e-01, -9.674370787e-01, -9.668650859e-01, -9.662942412e-01,
-  -9.657245580e-01, -9.651560365e-01, -9.645886617e-01, -9.640224036e-01,
-  -9.634572155e-01, -9.628930339e-01, -9.623297772e-01, -9.617673451e-01,
-  -9.612056177e-01, -9.606444549e-01, -9.600836958e-01, -9.595231577e-01,
-  -9.589626357e-01, -9.584019021e-01, -9.578407059e-01, -9.572787721e-01,
-  -9.567158015e-01, -9.561514702e-01, -9.555854297e-01, -9.550173059e-01,
-  -9.544466996e-01, -9.538731865e-01, -9.532963166e-01, -9.527156148e-01,
-  -9.521305812e-01, -9.515406908e-01, -9.509453946e-01, -9.503441195e-01,
-  -9.497362696e-01, -9.491212260e-01, -9.484983486e-01, -9.478669763e-01,
-  -9.472264285e-01, -9.465760059e-01, -9.459149925e-01, -9.452426560e-01,
-  -9.445582503e-01, -9.438610166e-01, -9.431501856e-01, -9.424249788e-01,
-  -9.416846113e-01, -9.409282933e-01, -9.401552328e-01, -9.393646378e-01,
-  -9.385557187e-01, -9.377276914e-01, -9.368797791e-01, -9.360112161e-01,
-  -9.351212500e-01, -9.342091451e-01, -9.332741852e-01, -9.323156768e-01,
-  -9.313329523e-01, -9.303253737e-01, -9.292923350e-01, -9.282332663e-01,
-  -9.271476372e-01, -9.260349594e-01, -9.248947912e-01, -9.237267401e-01,
-  -9.225304663e-01, -9.213056865e-01, -9.200521765e-01, -9.187697753e-01,
-  -9.174583874e-01, -9.161179865e-01, -9.147486183e-01, -9.133504035e-01,
-  -9.119235402e-01, -9.104683068e-01, -9.089850646e-01, -9.074742595e-01,
-  -9.059364246e-01, -9.043721820e-01, -9.027822442e-01, -9.011674155e-01,
-  -8.995285935e-01, -8.978667696e-01, -8.961830298e-01, -8.944785549e-01,
-  -8.927546207e-01, -8.910125973e-01, -8.892539485e-01, -8.874802312e-01,
-  -8.856930935e-01, -8.838942730e-01, -8.820855950e-01, -8.802689696e-01,
-  -8.784463889e-01, -8.766199238e-01, -8.747917201e-01, -8.729639942e-01,
-  -8.711390290e-01, -8.693191684e-01, -8.675068121e-01, -8.657044099e-01,
-  -8.639144554e-01, -8.621394792e-01, -8.603820420e-01, -8.586447272e-01,
-  -8.569301329e-01, -8.552408642e-01, -8.535795238e-01, -8.519487040e-01,
-  -8.503509769e-01, -8.487888851e-01, -8.472649320e-01, -8.457815715e-01,
-  -8.443411977e-01, -8.429461344e-01, -8.415986247e-01, -8.403008196e-01,
-  -8.390547674e-01, -8.378624022e-01, -8.367255334e-01, -8.356458339e-01,
-  -8.346248290e-01, -8.336638857e-01, -8.327642013e-01, -8.319267927e-01,
-  -8.311524856e-01, -8.304419040e-01, -8.297954599e-01, -8.292133438e-01,
-  -8.286955144e-01, -8.282416900e-01, -8.278513398e-01, -8.275236752e-01,
-  -8.272576425e-01, -8.270519156e-01, -8.269048895e-01, -8.268146748e-01,
-  -8.267790921e-01, -8.267956680e-01, -8.268616315e-01, -8.269739115e-01,
-  -8.271291345e-01, -8.273236242e-01, -8.275534016e-01, -8.278141856e-01,
-  -8.281013956e-01, -8.284101546e-01, -8.287352932e-01, -8.290713550e-01,
-  -8.294126033e-01, -8.297530287e-01, -8.300863577e-01, -8.304060626e-01,
-  -8.307053731e-01, -8.309772881e-01, -8.312145896e-01, -8.314098570e-01,
-  -8.315554836e-01, -8.316436927e-01, -8.316665566e-01, -8.316160155e-01,
-  -8.314838978e-01, -8.312619418e-01, -8.309418179e-01, -8.305151522e-01,
-  -8.299735508e-01, -8.293086251e-01, -8.285120180e-01, -8.275754309e-01,
-  -8.264906507e-01, -8.252495789e-01, -8.238442599e-01, -8.222669104e-01,
-  -8.205099493e-01, -8.185660277e-01, -8.164280591e-01, -8.140892500e-01,
-  -8.115431306e-01, -8.087835849e-01, -8.058048812e-01, -8.026017024e-01,
-  -7.991691755e-01, -7.955029008e-01, -7.915989809e-01, -7.874540483e-01,
-  -7.830652929e-01, -7.784304883e-01, -7.735480166e-01, -7.684168932e-01,
-  -7.630367889e-01, -7.574080519e-01, -7.515317276e-01, -7.454095770e-01,
-  -7.390440930e-01, -7.324385162e-01, -7.255968467e-01, -7.185238558e-01,
-  -7.112250947e-01, -7.037069010e-01, -6.959764029e-01, -6.880415217e-01,
-  -6.799109706e-01, -6.715942525e-01, -6.631016539e-01, -6.544442367e-01,
-  -6.456338278e-01, -6.366830052e-01, -6.276050814e-01, -6.184140850e-01,
-  -6.091247382e-01, -5.997524321e-01, -5.903131996e-01, -5.808236846e-01,
-  -5.713011093e-01, -5.617632384e-01, -5.522283402e-01, -5.427151459e-01,
-  -5.332428056e-01, -5.238308421e-01, -5.144991023e-01, -5.052677061e-01,
-  -4.961569934e-01, -4.871874683e-01, -4.783797420e-01, -4.697544734e-01,
-  -4.613323086e-01, -4.531338176e-01, -4.451794310e-01, -4.374893745e-01,
-  -4.300836025e-01, -4.229817315e-01, -4.162029716e-01, -4.097660587e-01,
-  -4.036891858e-01, -3.979899341e-01, -3.926852048e-01, -3.877911509e-01,
-  -3.833231098e-01, -3.792955365e-01, -3.757219381e-01, -3.726148096e-01,
-  -3.699855711e-01, -3.678445071e-01, -3.662007073e-01, -3.650620105e-01,
-  -3.644349501e-01, -3.643247028e-01, -3.647350406e-01, -3.656682852e-01,
-  -3.671252667e-01, -3.691052848e-01, -3.716060755e-01, -3.746237802e-01,
-  -3.781529196e-01, -3.821863729e-01, -3.867153600e-01, -3.917294296e-01,
-  -3.972164520e-01, -4.031626164e-01, -4.095524340e-01, -4.163687460e-01,
-  -4.235927369e-01, -4.312039536e-01, -4.391803293e-01, -4.474982137e-01,
-  -4.561324083e-01, -4.650562072e-01, -4.742414438e-01, -4.836585427e-01,
-  -4.932765770e-01, -5.030633315e-01, -5.129853708e-01, -5.230081128e-01,
-  -5.330959069e-01, -5.432121179e-01, -5.533192138e-01, -5.633788592e-01,
-  -5.733520121e-01, -5.831990256e-01, -5.928797533e-01, -6.023536582e-01,
-  -6.115799256e-01, -6.205175784e-01, -6.291255958e-01, -6.373630346e-01,
-  -6.451891516e-01, -6.525635295e-01, -6.594462031e-01, -6.657977866e-01,
-  -6.715796027e-01, -6.767538105e-01, -6.812835345e-01, -6.851329927e-01,
-  -6.882676240e-01, -6.906542137e-01, -6.922610181e-01, -6.930578867e-01,
-  -6.930163810e-01, -6.921098918e-01, -6.903137519e-01, -6.876053450e-01,
-  -6.839642116e-01, -6.793721483e-01, -6.738133039e-01, -6.672742687e-01,
-  -6.597441589e-01, -6.512146944e-01, -6.416802697e-01, -6.311380191e-01,
-  -6.195878733e-01, -6.070326095e-01, -5.934778934e-01, -5.789323131e-01,
-  -5.634074050e-01, -5.469176707e-01, -5.294805861e-01, -5.111166005e-01,
-  -4.918491279e-01, -4.717045283e-01, -4.507120802e-01, -4.289039440e-01,
-  -4.063151158e-01, -3.829833719e-01, -3.589492048e-01, -3.342557486e-01,
-  -3.089486971e-01, -2.830762113e-01, -2.566888190e-01, -2.298393057e-01,
-  -2.025825967e-01, -1.749756314e-01, -1.470772293e-01, -1.189479491e-01,
-  -9.064993978e-02, -6.224678508e-02, -3.380334156e-02, -5.385570449e-03,
-   2.293963622e-02,  5.110463455e-02,  7.904121257e-02,  1.066807781e-01,
-   1.339545506e-01,  1.607937554e-01,  1.871298217e-01,  2.128945814e-01,
-   2.380204701e-01,  2.624407285e-01,  2.860896040e-01,  3.089025522e-01,
-   3.308164370e-01,  3.517697290e-01,  3.717027015e-01,  3.905576241e-01,
-   4.082789520e-01,  4.248135111e-01,  4.401106789e-01,  4.541225590e-01,
-   4.668041504e-01,  4.781135093e-01,  4.880119047e-01,  4.964639646e-01,
-   5.034378156e-01,  5.089052126e-01,  5.128416591e-01,  5.152265182e-01,
-   5.160431128e-01,  5.152788154e-01,  5.129251269e-01,  5.089777434e-01,
-   5.034366117e-01,  4.963059728e-01,  4.875943927e-01,  4.773147808e-01,
-   4.654843960e-01,  4.521248393e-01,  4.372620336e-01,  4.209261911e-01,
-   4.031517670e-01,  3.839774002e-01,  3.634458414e-01,  3.416038684e-01,
-   3.185021884e-01,  2.941953279e-01,  2.687415102e-01,  2.422025218e-01,
-   2.146435655e-01,  1.861331038e-01,  1.567426904e-01,  1.265467913e-01,
-   9.562259641e-02,  6.404982094e-02,  3.191049830e-02, -7.112357308e-04,
-  -3.372936645e-02, -6.705623103e-02, -1.006027557e-01, -1.342786990e-01,
-  -1.679928999e-01, -2.016535305e-01, -2.351683525e-01, -2.684449763e-01,
-  -3.013911225e-01, -3.339148846e-01, -3.659249924e-01, -3.973310747e-01,
-  -4.280439217e-01, -4.579757448e-01, -4.870404337e-01, -5.151538111e-01,
-  -5.422338815e-01, -5.682010760e-01, -5.929784912e-01, -6.164921207e-01,
-  -6.386710803e-01, -6.594478241e-01, -6.787583525e-01, -6.965424106e-01,
-  -7.127436760e-01, -7.273099363e-01, -7.401932555e-01, -7.513501274e-01,
-  -7.607416181e-01, -7.683334940e-01, -7.740963379e-01, -7.780056499e-01,
-  -7.800419355e-01, -7.801907786e-01, -7.784428990e-01, -7.747941968e-01,
-  -7.692457799e-01, -7.618039768e-01, -7.524803347e-01, -7.412916009e-01,
-  -7.282596899e-01, -7.134116345e-01, -6.967795221e-01, -6.784004154e-01,
-  -6.583162586e-01, -6.365737691e-01, -6.132243142e-01, -5.883237746e-01,
-  -5.619323936e-01, -5.341146138e-01, -5.049389003e-01, -4.744775528e-01,
-  -4.428065050e-01, -4.100051132e-01, -3.761559356e-01, -3.413445000e-01,
-  -3.056590643e-01, -2.691903671e-01, -2.320313720e-01, -1.942770045e-01,
-  -1.560238828e-01, -1.173700437e-01, -7.841466449e-02, -3.925778029e-02,
-   0.000000000e+00,  3.925778029e-02,  7.841466449e-02,  1.173700437e-01,
-   1.560238828e-01,  1.942770045e-01,  2.320313720e-01,  2.691903671e-01,
-   3.056590643e-01,  3.413445000e-01,  3.761559356e-01,  4.100051132e-01,
-   4.428065050e-01,  4.744775528e-01,  5.049389003e-01,  5.341146138e-01,
-   5.619323936e-01,  5.883237746e-01,  6.132243142e-01,  6.365737691e-01,
-   6.583162586e-01,  6.784004154e-01,  6.967795221e-01,  7.134116345e-01,
-   7.282596899e-01,  7.412916009e-01,  7.524803347e-01,  7.618039768e-01,
-   7.692457799e-01,  7.747941968e-01,  7.784428990e-01,  7.801907786e-01,
-   7.800419355e-01,  7.780056499e-01,  7.740963379e-01,  7.683334940e-01,
-   7.607416181e-01,  7.513501274e-01,  7.401932555e-01,  7.273099363e-01,
-   7.127436760e-01,  6.965424106e-01,  6.787583525e-01,  6.594478241e-01,
-   6.386710803e-01,  6.164921207e-01,  5.929784912e-01,  5.682010760e-01,
-   5.422338815e-01,  5.151538111e-01,  4.870404337e-01,  4.579757448e-01,
-   4.280439217e-01,  3.973310747e-01,  3.659249924e-01,  3.339148846e-01,
-   3.013911225e-01,  2.684449763e-01,  2.351683525e-01,  2.016535305e-01,
-   1.679928999e-01,  1.342786990e-01,  1.006027557e-01,  6.705623103e-02,
-   3.372936645e-02,  7.112357308e-04, -3.191049830e-02, -6.404982094e-02,
-  -9.562259641e-02, -1.265467913e-01, -1.567426904e-01, -1.861331038e-01,
-  -2.146435655e-01, -2.422025218e-01, -2.687415102e-01, -2.941953279e-01,
-  -3.185021884e-01, -3.416038684e-01, -3.634458414e-01, -3.839774002e-01,
-  -4.031517670e-01, -4.209261911e-01, -4.372620336e-01, -4.521248393e-01,
-  -4.654843960e-01, -4.773147808e-01, -4.875943927e-01, -4.963059728e-01,
-  -5.034366117e-01, -5.089777434e-01, -5.129251269e-01, -5.152788154e-01,
-  -5.160431128e-01, -5.152265182e-01, -5.128416591e-01, -5.089052126e-01,
-  -5.034378156e-01, -4.964639646e-01, -4.880119047e-01, -4.781135093e-01,
-  -4.668041504e-01, -4.541225590e-01, -4.401106789e-01, -4.248135111e-01,
-  -4.082789520e-01, -3.905576241e-01, -3.717027015e-01, -3.517697290e-01,
-  -3.308164370e-01, -3.089025522e-01, -2.860896040e-01, -2.624407285e-01,
-  -2.380204701e-01, -2.128945814e-01, -1.871298217e-01, -1.607937554e-01,
-  -1.339545506e-01, -1.066807781e-01, -7.904121257e-02, -5.110463455e-02,
-  -2.293963622e-02,  5.385570449e-03,  3.380334156e-02,  6.224678508e-02,
-   9.064993978e-02,  1.189479491e-01,  1.470772293e-01,  1.749756314e-01,
-   2.025825967e-01,  2.298393057e-01,  2.566888190e-01,  2.830762113e-01,
-   3.089486971e-01,  3.342557486e-01,  3.589492048e-01,  3.829833719e-01,
-   4.063151158e-01,  4.289039440e-01,  4.507120802e-01,  4.717045283e-01,
-   4.918491279e-01,  5.111166005e-01,  5.294805861e-01,  5.469176707e-01,
-   5.634074050e-01,  5.789323131e-01,  5.934778934e-01,  6.070326095e-01,
-   6.195878733e-01,  6.311380191e-01,  6.416802697e-01,  6.512146944e-01,
-   6.597441589e-01,  6.672742687e-01,  6.738133039e-01,  6.793721483e-01,
-   6.839642116e-01,  6.876053450e-01,  6.903137519e-01,  6.921098918e-01,
-   6.930163810e-01,  6.930578867e-01,  6.922610181e-01,  6.906542137e-01,
-   6.882676240e-01,  6.851329927e-01,  6.812835345e-01,  6.767538105e-01,
-   6.715796027e-01,  6.657977866e-01,  6.594462031e-01,  6.525635295e-01,
-   6.451891516e-01,  6.373630346e-01,  6.291255958e-01,  6.205175784e-01,
-   6.115799256e-01,  6.023536582e-01,  5.928797533e-01,  5.831990256e-01,
-   5.733520121e-01,  5.633788592e-01,  5.533192138e-01,  5.432121179e-01,
-   5.330959069e-01,  5.230081128e-01,  5.129853708e-01,  5.030633315e-01,
-   4.932765770e-01,  4.836585427e-01,  4.742414438e-01,  4.650562072e-01,
-   4.561324083e-01,  4.474982137e-01,  4.391803293e-01,  4.312039536e-01,
-   4.235927369e-01,  4.163687460e-01,  4.095524340e-01,  4.031626164e-01,
-   3.972164520e-01,  3.917294296e-01,  3.867153600e-01,  3.821863729e-01,
-   3.781529196e-01,  3.746237802e-01,  3.716060755e-01,  3.691052848e-01,
-   3.671252667e-01,  3.656682852e-01,  3.647350406e-01,  3.643247028e-01,
-   3.644349501e-01,  3.650620105e-01,  3.662007073e-01,  3.678445071e-01,
-   3.699855711e-01,  3.726148096e-01,  3.757219381e-01,  3.792955365e-01,
-   3.833231098e-01,  3.877911509e-01,  3.926852048e-01,  3.979899341e-01,
-   4.036891858e-01,  4.097660587e-01,  4.162029716e-01,  4.229817315e-01,
-   4.300836025e-01,  4.374893745e-01,  4.451794310e-01,  4.531338176e-01,
-   4.613323086e-01,  4.697544734e-01,  4.783797420e-01,  4.871874683e-01,
-   4.961569934e-01,  5.052677061e-01,  5.144991023e-01,  5.238308421e-01,
-   5.332428056e-01,  5.427151459e-01,  5.522283402e-01,  5.617632384e-01,
-   5.713011093e-01,  5.808236846e-01,  5.903131996e-01,  5.997524321e-01,
-   6.091247382e-01,  6.184140850e-01,  6.276050814e-01,  6.366830052e-01,
-   6.456338278e-01,  6.544442367e-01,  6.631016539e-01,  6.715942525e-01,
-   6.799109706e-01,  6.880415217e-01,  6.959764029e-01,  7.037069010e-01,
-   7.112250947e-01,  7.185238558e-01,  7.255968467e-01,  7.324385162e-01,
-   7.390440930e-01,  7.454095770e-01,  7.515317276e-01,  7.574080519e-01,
-   7.630367889e-01,  7.684168932e-01,  7.735480166e-01,  7.784304883e-01,
-   7.830652929e-01,  7.874540483e-01,  7.915989809e-01,  7.955029008e-01,
-   7.991691755e-01,  8.026017024e-01,  8.058048812e-01,  8.087835849e-01,
-   8.115431306e-01,  8.140892500e-01,  8.164280591e-01,  8.185660277e-01,
-   8.205099493e-01,  8.222669104e-01,  8.238442599e-01,  8.252495789e-01,
-   8.264906507e-01,  8.275754309e-01,  8.285120180e-01,  8.293086251e-01,
-   8.299735508e-01,  8.305151522e-01,  8.309418179e-01,  8.312619418e-01,
-   8.314838978e-01,  8.316160155e-01,  8.316665566e-01,  8.316436927e-01,
-   8.315554836e-01,  8.314098570e-01,  8.312145896e-01,  8.309772881e-01,
-   8.307053731e-01,  8.304060626e-01,  8.300863577e-01,  8.297530287e-01,
-   8.294126033e-01,  8.290713550e-01,  8.287352932e-01,  8.284101546e-01,
-   8.281013956e-01,  8.278141856e-01,  8.275534016e-01,  8.273236242e-01,
-   8.271291345e-01,  8.269739115e-01,  8.268616315e-01,  8.267956680e-01,
-   8.267790921e-01,  8.268146748e-01,  8.269048895e-01,  8.270519156e-01,
-   8.272576425e-01,  8.275236752e-01,  8.278513398e-01,  8.282416900e-01,
-   8.286955144e-01,  8.292133438e-01,  8.297954599e-01,  8.304419040e-01,
-   8.311524856e-01,  8.319267927e-01,  8.327642013e-01,  8.336638857e-01,
-   8.346248290e-01,  8.356458339e-01,  8.367255334e-01,  8.378624022e-01,
-   8.390547674e-01,  8.403008196e-01,  8.415986247e-01,  8.429461344e-01,
-   8.443411977e-01,  8.457815715e-01,  8.472649320e-01,  8.487888851e-01,
-   8.503509769e-01,  8.519487040e-01,  8.535795238e-01,  8.552408642e-01,
-   8.569301329e-01,  8.586447272e-01,  8.603820420e-01,  8.621394792e-01,
-   8.639144554e-01,  8.657044099e-01,  8.675068121e-01,  8.693191684e-01,
-   8.711390290e-01,  8.729639942e-01,  8.747917201e-01,  8.766199238e-01,
-   8.784463889e-01,  8.802689696e-01,  8.820855950e-01,  8.838942730e-01,
-   8.856930935e-01,  8.874802312e-01,  8.892539485e-01,  8.910125973e-01,
-   8.927546207e-01,  8.944785549e-01,  8.961830298e-01,  8.978667696e-01,
-   8.995285935e-01,  9.011674155e-01,  9.027822442e-01,  9.043721820e-01,
-   9.059364246e-01,  9.074742595e-01,  9.089850646e-01,  9.104683068e-01,
-   9.119235402e-01,  9.133504035e-01,  9.147486183e-01,  9.161179865e-01,
-   9.174583874e-01,  9.187697753e-01,  9.200521765e-01,  9.213056865e-01,
-   9.225304663e-01,  9.237267401e-01,  9.248947912e-01,  9.260349594e-01,
-   9.271476372e-01,  9.282332663e-01,  9.292923350e-01,  9.303253737e-01,
-   9.313329523e-01,  9.323156768e-01,  9.332741852e-01,  9.342091451e-01,
-   9.351212500e-01,  9.360112161e-01,  9.368797791e-01,  9.377276914e-01,
-   9.385557187e-01,  9.393646378e-01,  9.401552328e-01,  9.409282933e-01,
-   9.416846113e-01,  9.424249788e-01,  9.431501856e-01,  9.438610166e-01,
-   9.445582503e-01,  9.452426560e-01,  9.459149925e-01,  9.465760059e-01,
-   9.472264285e-01,  9.478669763e-01,  9.484983486e-01,  9.491212260e-01,
-   9.497362696e-01,  9.503441195e-01,  9.509453946e-01,  9.515406908e-01,
-   9.521305812e-01,  9.527156148e-01,  9.532963166e-01,  9.538731865e-01,
-   9.544466996e-01,  9.550173059e-01,  9.555854297e-01,  9.561514702e-01,
-   9.567158015e-01,  9.572787721e-01,  9.578407059e-01,  9.584019021e-01,
-   9.589626357e-01,  9.595231577e-01,  9.600836958e-01,  9.606444549e-01,
-   9.612056177e-01,  9.617673451e-01,  9.623297772e-01,  9.628930339e-01,
-   9.634572155e-01,  9.640224036e-01,  9.645886617e-01,  9.651560365e-01,
-   9.657245580e-01,  9.662942412e-01,  9.668650859e-01,  9.674370787e-01,
-   9.680101930e-01,  9.685843901e-01,  9.691596203e-01,  9.697358234e-01,
-   9.703129298e-01,  9.708908612e-01,  9.714695313e-01,  9.720488469e-01,
-   9.726287084e-01,  9.732090107e-01,  9.737896439e-01,  9.743704941e-01,
-   9.749514439e-01,  9.755323731e-01,  9.761131597e-01,  9.766936799e-01,
-   9.772738093e-01,  9.778534229e-01,  9.784323961e-01,  9.790106049e-01,
-   9.795879264e-01,  9.801642395e-01,  9.807394248e-01,  9.813133655e-01,
-   9.818859474e-01,  9.824570595e-01,  9.830265939e-01,  9.835944466e-01,
-   9.841605170e-01,  9.847247091e-01,  9.852869306e-01,  9.858470938e-01,
-   9.864051156e-01,  9.869609173e-01,  9.875144250e-01,  9.880655696e-01,
-   9.886142867e-01,  9.891605167e-01,  9.897042051e-01,  9.902453018e-01,
-   9.907837617e-01,  9.913195444e-01,  9.918526141e-01,  9.923829397e-01,
-   9.929104943e-01,  9.934352558e-01,  9.939572061e-01,  9.944763312e-01,
-   9.949926213e-01,  9.955060704e-01,  9.960166762e-01,  9.965244401e-01,
-   9.970293667e-01,  9.975314641e-01,  9.980307434e-01,  9.985272185e-01,
-   9.990209063e-01,  9.995118262e-01,  1.000000000e+00,  1.000000000e+00,
-};
-const float lut_unipolar_fold[] = {
-   0.000000000e+00,  1.699538921e-02,  3.395628448e-02,  5.084827861e-02,
-   6.763713768e-02,  8.428888711e-02,  1.007698971e-01,  1.170469670e-01,
-   1.330874092e-01,  1.488591304e-01,  1.643307130e-01,  1.794714934e-01,
-   1.942516393e-01,  2.086422239e-01,  2.226152990e-01,  2.361439642e-01,
-   2.492024346e-01,  2.617661051e-01,  2.738116113e-01,  2.853168883e-01,
-   2.962612248e-01,  3.066253149e-01,  3.163913055e-01,  3.255428405e-01,
-   3.340651010e-01,  3.419448410e-01,  3.491704202e-01,  3.557318317e-01,
-   3.616207262e-01,  3.668304312e-01,  3.713559667e-01,  3.751940564e-01,
-   3.783431337e-01,  3.808033451e-01,  3.825765472e-01,  3.836663011e-01,
-   3.840778610e-01,  3.838181599e-01,  3.828957900e-01,  3.813209791e-01,
-   3.791055634e-01,  3.762629555e-01,  3.728081092e-01,  3.687574794e-01,
-   3.641289795e-01,  3.589419340e-01,  3.532170282e-01,  3.469762542e-01,
-   3.402428542e-01,  3.330412599e-01,  3.253970292e-01,  3.173367811e-01,
-   3.088881259e-01,  3.000795956e-01,  2.909405696e-01,  2.815012000e-01,
-   2.717923345e-01,  2.618454377e-01,  2.516925105e-01,  2.413660094e-01,
-   2.308987633e-01,  2.203238910e-01,  2.096747168e-01,  1.989846866e-01,
-   1.882872836e-01,  1.776159437e-01,  1.670039717e-01,  1.564844578e-01,
-   1.460901946e-01,  1.358535954e-01,  1.258066132e-01,  1.159806615e-01,
-   1.064065363e-01,  9.711433972e-02,  8.813340608e-02,  7.949222953e-02,
-   7.121839426e-02,  6.333850715e-02,  5.587813298e-02,  4.886173249e-02,
-   4.231260337e-02,  3.625282439e-02,  3.070320266e-02,  2.568322435e-02,
-   2.121100884e-02,  1.730326645e-02,  1.397525989e-02,  1.124076945e-02,
-   9.112062082e-03,  7.599864379e-03,  6.713339565e-03,  6.460068500e-03,
-   6.846034775e-03,  7.875613898e-03,  9.551566605e-03,  1.187503629e-02,
-   1.484555056e-02,  1.846102688e-02,  2.271778232e-02,  2.761054734e-02,
-   3.313248354e-02,  3.927520535e-02,  4.602880569e-02,  5.338188523e-02,
-   6.132158556e-02,  6.983362582e-02,  7.890234294e-02,  8.851073515e-02,
-   9.864050892e-02,  1.092721289e-01,  1.203848708e-01,  1.319568776e-01,
-   1.439652175e-01,  1.563859455e-01,  1.691941667e-01,  1.823641018e-01,
-   1.958691552e-01,  2.096819838e-01,  2.237745691e-01,  2.381182892e-01,
-   2.526839929e-01,  2.674420750e-01,  2.823625517e-01,  2.974151378e-01,
-   3.125693235e-01,  3.277944517e-01,  3.430597958e-01,  3.583346366e-01,
-   3.735883399e-01,  3.887904327e-01,  4.039106792e-01,  4.189191559e-01,
-   4.337863251e-01,  4.484831079e-01,  4.629809551e-01,  4.772519170e-01,
-   4.912687110e-01,  5.050047874e-01,  5.184343929e-01,  5.315326322e-01,
-   5.442755269e-01,  5.566400715e-01,  5.686042876e-01,  5.801472743e-01,
-   5.912492563e-01,  6.018916284e-01,  6.120569974e-01,  6.217292204e-01,
-   6.308934396e-01,  6.395361142e-01,  6.476450484e-01,  6.552094158e-01,
-   6.622197804e-01,  6.686681144e-01,  6.745478109e-01,  6.798536951e-01,
-   6.845820294e-01,  6.887305172e-01,  6.922983007e-01,  6.952859570e-01,
-   6.976954895e-01,  6.995303160e-01,  7.007952529e-01,  7.014964969e-01,
-   7.016416019e-01,  7.012394539e-01,  7.003002414e-01,  6.988354238e-01,
-   6.968576958e-01,  6.943809493e-01,  6.914202324e-01,  6.879917055e-01,
-   6.841125948e-01,  6.798011437e-01,  6.750765612e-01,  6.699589687e-01,
-   6.644693447e-01,  6.586294669e-01,  6.524618535e-01,  6.459897026e-01,
-   6.392368298e-01,  6.322276051e-01,  6.249868882e-01,  6.175399637e-01,
-   6.099124745e-01,  6.021303556e-01,  5.942197670e-01,  5.862070264e-01,
-   5.781185424e-01,  5.699807469e-01,  5.618200286e-01,  5.536626667e-01,
-   5.455347655e-01,  5.374621893e-01,  5.294704985e-01,  5.215848872e-01,
-   5.138301219e-01,  5.062304810e-01,  4.988096971e-01,  4.915908999e-01,
-   4.845965615e-01,  4.778484439e-01,  4.713675482e-01,  4.651740662e-01,
-   4.592873341e-01,  4.537257894e-01,  4.485069296e-01,  4.436472735e-01,
-   4.391623261e-01,  4.350665454e-01,  4.313733123e-01,  4.280949037e-01,
-   4.252424685e-01,  4.228260063e-01,  4.208543494e-01,  4.193351481e-01,
-   4.182748586e-01,  4.176787344e-01,  4.175508210e-01,  4.178939529e-01,
-   4.187097547e-01,  4.199986446e-01,  4.217598410e-01,  4.239913727e-01,
-   4.266900913e-01,  4.298516870e-01,  4.334707070e-01,  4.375405768e-01,
-   4.420536246e-01,  4.470011074e-01,  4.523732404e-01,  4.581592290e-01,
-   4.643473022e-01,  4.709247495e-01,  4.778779588e-01,  4.851924572e-01,
-   4.928529533e-01,  5.008433813e-01,  5.091469468e-01,  5.177461744e-01,
-   5.266229560e-01,  5.357586014e-01,  5.451338890e-01,  5.547291184e-01,
-   5.645241631e-01,  5.744985240e-01,  5.846313843e-01,  5.949016638e-01,
-   6.052880738e-01,  6.157691724e-01,  6.263234195e-01,  6.369292319e-01,
-   6.475650376e-01,  6.582093303e-01,  6.688407229e-01,  6.794380006e-01,
-   6.899801726e-01,  7.004465239e-01,  7.108166647e-01,  7.210705795e-01,
-   7.311886748e-01,  7.411518249e-01,  7.509414164e-01,  7.605393914e-01,
-   7.699282883e-01,  7.790912815e-01,  7.880122182e-01,  7.966756543e-01,
-   8.050668873e-01,  8.131719877e-01,  8.209778277e-01,  8.284721081e-01,
-   8.356433822e-01,  8.424810783e-01,  8.489755186e-01,  8.551179368e-01,
-   8.609004927e-01,  8.663162841e-01,  8.713593565e-01,  8.760247105e-01,
-   8.803083065e-01,  8.842070665e-01,  8.877188743e-01,  8.908425725e-01,
-   8.935779573e-01,  8.959257712e-01,  8.978876931e-01,  8.994663257e-01,
-   9.006651818e-01,  9.014886669e-01,  9.019420608e-01,  9.020314969e-01,
-   9.017639390e-01,  9.011471568e-01,  9.001896991e-01,  8.989008657e-01,
-   8.972906772e-01,  8.953698433e-01,  8.931497299e-01,  8.906423246e-01,
-   8.878602008e-01,  8.848164809e-01,  8.815247984e-01,  8.779992586e-01,
-   8.742543992e-01,  8.703051493e-01,  8.661667887e-01,  8.618549056e-01,
-   8.573853549e-01,  8.527742156e-01,  8.480377482e-01,  8.431923521e-01,
-   8.382545228e-01,  8.332408095e-01,  8.281677727e-01,  8.230519427e-01,
-   8.179097777e-01,  8.127576234e-01,  8.076116723e-01,  8.024879249e-01,
-   7.974021507e-01,  7.923698508e-01,  7.874062214e-01,  7.825261183e-01,
-   7.777440225e-01,  7.730740078e-01,  7.685297085e-01,  7.641242901e-01,
-   7.598704198e-01,  7.557802401e-01,  7.518653429e-01,  7.481367457e-01,
-   7.446048697e-01,  7.412795191e-01,  7.381698625e-01,  7.352844166e-01,
-   7.326310304e-01,  7.302168728e-01,  7.280484208e-01,  7.261314507e-01,
-   7.244710300e-01,  7.230715123e-01,  7.219365333e-01,  7.210690091e-01,
-   7.204711362e-01,  7.201443932e-01,  7.200895448e-01,  7.203066469e-01,
-   7.207950542e-01,  7.215534287e-01,  7.225797509e-01,  7.238713314e-01,
-   7.254248252e-01,  7.272362471e-01,  7.293009883e-01,  7.316138347e-01,
-   7.341689869e-01,  7.369600806e-01,  7.399802091e-01,  7.432219467e-01,
-   7.466773726e-01,  7.503380970e-01,  7.541952866e-01,  7.582396927e-01,
-   7.624616784e-01,  7.668512477e-01,  7.713980744e-01,  7.760915323e-01,
-   7.809207253e-01,  7.858745178e-01,  7.909415656e-01,  7.961103476e-01,
-   8.013691959e-01,  8.067063281e-01,  8.121098779e-01,  8.175679262e-01,
-   8.230685321e-01,  8.285997632e-01,  8.341497263e-01,  8.397065966e-01,
-   8.452586472e-01,  8.507942779e-01,  8.563020431e-01,  8.617706789e-01,
-   8.671891301e-01,  8.725465757e-01,  8.778324535e-01,  8.830364844e-01,
-   8.881486949e-01,  8.931594393e-01,  8.980594200e-01,  9.028397074e-01,
-   9.074917586e-01,  9.120074339e-01,  9.163790135e-01,  9.205992121e-01,
-   9.246611921e-01,  9.285585760e-01,  9.322854572e-01,  9.358364094e-01,
-   9.392064948e-01,  9.423912712e-01,  9.453867969e-01,  9.481896354e-01,
-   9.507968576e-01,  9.532060439e-01,  9.554152837e-01,  9.574231746e-01,
-   9.592288197e-01,  9.608318240e-01,  9.622322893e-01,  9.634308081e-01,
-   9.644284561e-01,  9.652267838e-01,  9.658278068e-01,  9.662339950e-01,
-   9.664482609e-01,  9.664739469e-01,  9.663148115e-01,  9.659750149e-01,
-   9.654591032e-01,  9.647719926e-01,  9.639189520e-01,  9.629055856e-01,
-   9.617378146e-01,  9.604218579e-01,  9.589642130e-01,  9.573716363e-01,
-   9.556511221e-01,  9.538098827e-01,  9.518553267e-01,  9.497950384e-01,
-   9.476367560e-01,  9.453883504e-01,  9.430578032e-01,  9.406531856e-01,
-   9.381826364e-01,  9.356543409e-01,  9.330765095e-01,  9.304573565e-01,
-   9.278050796e-01,  9.251278389e-01,  9.224337373e-01,  9.197308005e-01,
-   9.170269577e-01,  9.143300229e-01,  9.116476768e-01,  9.089874488e-01,
-   9.063567004e-01,  9.037626085e-01,  9.012121499e-01,  8.987120862e-01,
-   8.962689498e-01,  8.938890304e-01,  8.915783621e-01,  8.893427121e-01,
-   8.871875693e-01,  8.851181345e-01,  8.831393111e-01,  8.812556967e-01,
-   8.794715757e-01,  8.777909129e-01,  8.762173476e-01,  8.747541894e-01,
-   8.734044140e-01,  8.721706603e-01,  8.710552288e-01,  8.700600802e-01,
-   8.691868353e-01,  8.684367757e-01,  8.678108456e-01,  8.673096536e-01,
-   8.669334768e-01,  8.666822638e-01,  8.665556407e-01,  8.665529155e-01,
-   8.666730855e-01,  8.669148435e-01,  8.672765862e-01,  8.677564220e-01,
-   8.683521805e-01,  8.690614217e-01,  8.698814466e-01,  8.708093073e-01,
-   8.718418186e-01,  8.729755695e-01,  8.742069353e-01,  8.755320898e-01,
-   8.769470183e-01,  8.784475305e-01,  8.800292738e-01,  8.816877470e-01,
-   8.834183137e-01,  8.852162168e-01,  8.870765918e-01,  8.889944811e-01,
-   8.909648484e-01,  8.929825923e-01,  8.950425608e-01,  8.971395649e-01,
-   8.992683927e-01,  9.014238230e-01,  9.036006389e-01,  9.057936411e-01,
-   9.079976611e-01,  9.102075739e-01,  9.124183104e-01,  9.146248698e-01,
-   9.168223312e-01,  9.190058653e-01,  9.211707453e-01,  9.233123571e-01,
-   9.254262103e-01,  9.275079472e-01,  9.295533520e-01,  9.315583599e-01,
-   9.335190649e-01,  9.354317275e-01,  9.372927818e-01,  9.390988420e-01,
-   9.408467085e-01,  9.425333729e-01,  9.441560234e-01,  9.457120483e-01,
-   9.471990403e-01,  9.486147991e-01,  9.499573340e-01,  9.512248661e-01,
-   9.524158290e-01,  9.535288702e-01,  9.545628506e-01,  9.555168450e-01,
-   9.563901401e-01,  9.571822341e-01,  9.578928340e-01,  9.585218533e-01,
-   9.590694093e-01,  9.595358191e-01,  9.599215962e-01,  9.602274458e-01,
-   9.604542601e-01,  9.606031132e-01,  9.606752553e-01,  9.606721068e-01,
-   9.605952522e-01,  9.604464330e-01,  9.602275414e-01,  9.599406126e-01,
-   9.595878176e-01,  9.591714551e-01,  9.586939443e-01,  9.581578162e-01,
-   9.575657055e-01,  9.569203425e-01,  9.562245443e-01,  9.554812062e-01,
-   9.546932934e-01,  9.538638318e-01,  9.529959000e-01,  9.520926199e-01,
-   9.511571485e-01,  9.501926691e-01,  9.492023828e-01,  9.481895000e-01,
-   9.471572324e-01,  9.461087844e-01,  9.450473451e-01,  9.439760807e-01,
-   9.428981268e-01,  9.418165805e-01,  9.407344939e-01,  9.396548664e-01,
-   9.385806383e-01,  9.375146842e-01,  9.364598069e-01,  9.354187315e-01,
-   9.343940996e-01,  9.333884642e-01,  9.324042846e-01,  9.314439218e-01,
-   9.305096342e-01,  9.296035735e-01,  9.287277813e-01,  9.278841853e-01,
-   9.270745973e-01,  9.263007095e-01,  9.255640930e-01,  9.248661958e-01,
-   9.242083410e-01,  9.235917261e-01,  9.230174215e-01,  9.224863708e-01,
-   9.219993899e-01,  9.215571676e-01,  9.211602661e-01,  9.208091218e-01,
-   9.205040462e-01,  9.202452277e-01,  9.200327331e-01,  9.198665097e-01,
-   9.197463876e-01,  9.196720823e-01,  9.196431973e-01,  9.196592275e-01,
-   9.197195621e-01,  9.198234884e-01,  9.199701954e-01,  9.201587776e-01,
-   9.203882391e-01,  9.206574980e-01,  9.209653904e-01,  9.213106753e-01,
-   9.216920390e-01,  9.221080999e-01,  9.225574132e-01,  9.230384760e-01,
-   9.235497321e-01,  9.240895772e-01,  9.246563635e-01,  9.252484054e-01,
-   9.258639840e-01,  9.265013525e-01,  9.271587412e-01,  9.278343621e-01,
-   9.285264147e-01,  9.292330901e-01,  9.299525760e-01,  9.306830620e-01,
-   9.314227436e-01,  9.321698270e-01,  9.329225337e-01,  9.336791046e-01,
-   9.344378042e-01,  9.351969248e-01,  9.359547905e-01,  9.367097605e-01,
-   9.374602332e-01,  9.382046491e-01,  9.389414947e-01,  9.396693050e-01,
-   9.403866664e-01,  9.410922197e-01,  9.417846627e-01,  9.424627517e-01,
-   9.431253047e-01,  9.437712024e-01,  9.443993903e-01,  9.450088802e-01,
-   9.455987516e-01,  9.461681523e-01,  9.467163000e-01,  9.472424823e-01,
-   9.477460579e-01,  9.482264562e-01,  9.486831780e-01,  9.491157951e-01,
-   9.495239500e-01,  9.499073559e-01,  9.502657954e-01,  9.505991204e-01,
-   9.509072506e-01,  9.511901727e-01,  9.514479393e-01,  9.516806668e-01,
-   9.518885347e-01,  9.520717833e-01,  9.522307121e-01,  9.523656780e-01,
-   9.524770931e-01,  9.525654226e-01,  9.526311823e-01,  9.526749368e-01,
-   9.526972967e-01,  9.526989161e-01,  9.526804904e-01,  9.526427530e-01,
-   9.525864736e-01,  9.525124547e-01,  9.524215291e-01,  9.523145572e-01,
-   9.521924246e-01,  9.520560383e-01,  9.519063251e-01,  9.517442280e-01,
-   9.515707036e-01,  9.513867198e-01,  9.511932523e-01,  9.509912828e-01,
-   9.507817954e-01,  9.505657748e-01,  9.503442034e-01,  9.501180587e-01,
-   9.498883111e-01,  9.496559214e-01,  9.494218386e-01,  9.491869977e-01,
-   9.489523172e-01,  9.487186977e-01,  9.484870194e-01,  9.482581405e-01,
-   9.480328955e-01,  9.478120932e-01,  9.475965155e-01,  9.473869155e-01,
-   9.471840169e-01,  9.469885117e-01,  9.468010600e-01,  9.466222886e-01,
-   9.464527897e-01,  9.462931208e-01,  9.461438033e-01,  9.460053225e-01,
-   9.458781267e-01,  9.457626270e-01,  9.456591967e-01,  9.455681718e-01,
-   9.454898500e-01,  9.454244918e-01,  9.453723195e-01,  9.453335183e-01,
-   9.453082363e-01,  9.452965847e-01,  9.452986386e-01,  9.453144374e-01,
-   9.453439857e-01,  9.453872535e-01,  9.454441777e-01,  9.455146625e-01,
-   9.455985805e-01,  9.456957737e-01,  9.458060545e-01,  9.459292071e-01,
-   9.460649882e-01,  9.462131286e-01,  9.463733344e-01,  9.465452882e-01,
-   9.467286504e-01,  9.469230607e-01,  9.471281394e-01,  9.473434889e-01,
-   9.475686950e-01,  9.478033283e-01,  9.480469460e-01,  9.482990927e-01,
-   9.485593026e-01,  9.488271004e-01,  9.491020028e-01,  9.493835204e-01,
-   9.496711584e-01,  9.499644185e-01,  9.502628002e-01,  9.505658020e-01,
-   9.508729227e-01,  9.511836630e-01,  9.514975264e-01,  9.518140206e-01,
-   9.521326588e-01,  9.524529604e-01,  9.527744527e-01,  9.530966716e-01,
-   9.534191624e-01,  9.537414815e-01,  9.540631964e-01,  9.543838874e-01,
-   9.547031475e-01,  9.550205843e-01,  9.553358196e-01,  9.556484907e-01,
-   9.559582508e-01,  9.562647695e-01,  9.565677334e-01,  9.568668465e-01,
-   9.571618304e-01,  9.574524248e-01,  9.577383877e-01,  9.580194956e-01,
-   9.582955437e-01,  9.585663459e-01,  9.588317351e-01,  9.590915626e-01,
-   9.593456988e-01,  9.595940327e-01,  9.598364716e-01,  9.600729415e-01,
-   9.603033859e-01,  9.605277667e-01,  9.607460628e-01,  9.609582705e-01,
-   9.611644025e-01,  9.613644882e-01,  9.615585725e-01,  9.617467157e-01,
-   9.619289928e-01,  9.621054933e-01,  9.622763202e-01,  9.624415895e-01,
-   9.626014298e-01,  9.627559813e-01,  9.629053956e-01,  9.630498346e-01,
-   9.631894701e-01,  9.633244830e-01,  9.634550626e-01,  9.635814058e-01,
-   9.637037166e-01,  9.638222054e-01,  9.639370880e-01,  9.640485852e-01,
-   9.641569218e-01,  9.642623262e-01,  9.643650296e-01,  9.644652652e-01,
-   9.645632676e-01,  9.646592724e-01,  9.647535150e-01,  9.648462305e-01,
-   9.649376528e-01,  9.650280141e-01,  9.651175443e-01,  9.652064704e-01,
-   9.652950160e-01,  9.653834009e-01,  9.654718404e-01,  9.655605450e-01,
-   9.656497199e-01,  9.657395644e-01,  9.658302719e-01,  9.659220293e-01,
-   9.660150164e-01,  9.661094062e-01,  9.662053641e-01,  9.663030477e-01,
-   9.664026069e-01,  9.665041833e-01,  9.666079102e-01,  9.667139125e-01,
-   9.668223064e-01,  9.669331995e-01,  9.670466905e-01,  9.671628695e-01,
-   9.672818173e-01,  9.674036064e-01,  9.675283000e-01,  9.676559527e-01,
-   9.677866105e-01,  9.679203104e-01,  9.680570813e-01,  9.681969434e-01,
-   9.683399087e-01,  9.684859813e-01,  9.686351571e-01,  9.687874245e-01,
-   9.689427645e-01,  9.691011505e-01,  9.692625493e-01,  9.694269207e-01,
-   9.695942181e-01,  9.697643886e-01,  9.699373736e-01,  9.701131086e-01,
-   9.702915240e-01,  9.704725452e-01,  9.706560927e-01,  9.708420829e-01,
-   9.710304279e-01,  9.712210364e-01,  9.714138134e-01,  9.716086611e-01,
-   9.718054788e-01,  9.720041636e-01,  9.722046101e-01,  9.724067118e-01,
-   9.726103602e-01,  9.728154460e-01,  9.730218590e-01,  9.732294886e-01,
-   9.734382238e-01,  9.736479538e-01,  9.738585684e-01,  9.740699576e-01,
-   9.742820128e-01,  9.744946262e-01,  9.747076916e-01,  9.749211045e-01,
-   9.751347621e-01,  9.753485639e-01,  9.755624116e-01,  9.757762094e-01,
-   9.759898643e-01,  9.762032860e-01,  9.764163873e-01,  9.766290841e-01,
-   9.768412956e-01,  9.770529445e-01,  9.772639568e-01,  9.774742624e-01,
-   9.776837946e-01,  9.778924908e-01,  9.781002919e-01,  9.783071429e-01,
-   9.785129926e-01,  9.787177938e-01,  9.789215033e-01,  9.791240817e-01,
-   9.793254937e-01,  9.795257078e-01,  9.797246967e-01,  9.799224365e-01,
-   9.801189075e-01,  9.803140936e-01,  9.805079825e-01,  9.807005654e-01,
-   9.808918371e-01,  9.810817959e-01,  9.812704435e-01,  9.814577848e-01,
-   9.816438277e-01,  9.818285835e-01,  9.820120661e-01,  9.821942925e-01,
-   9.823752820e-01,  9.825550569e-01,  9.827336415e-01,  9.829110626e-01,
-   9.830873492e-01,  9.832625321e-01,  9.834366441e-01,  9.836097197e-01,
-   9.837817949e-01,  9.839529072e-01,  9.841230953e-01,  9.842923991e-01,
-   9.844608596e-01,  9.846285184e-01,  9.847954181e-01,  9.849616016e-01,
-   9.851271124e-01,  9.852919943e-01,  9.854562913e-01,  9.856200474e-01,
-   9.857833066e-01,  9.859461125e-01,  9.861085087e-01,  9.862705382e-01,
-   9.864322434e-01,  9.865936663e-01,  9.867548480e-01,  9.869158287e-01,
-   9.870766480e-01,  9.872373443e-01,  9.873979548e-01,  9.875585157e-01,
-   9.877190622e-01,  9.878796277e-01,  9.880402448e-01,  9.882009443e-01,
-   9.883617559e-01,  9.885227075e-01,  9.886838257e-01,  9.888451355e-01,
-   9.890066602e-01,  9.891684218e-01,  9.893304403e-01,  9.894927345e-01,
-   9.896553211e-01,  9.898182156e-01,  9.899814315e-01,  9.901449810e-01,
-   9.903088744e-01,  9.904731207e-01,  9.906377269e-01,  9.908026989e-01,
-   9.909680408e-01,  9.911337552e-01,  9.912998434e-01,  9.914663049e-01,
-   9.916331383e-01,  9.918003405e-01,  9.919679072e-01,  9.921358328e-01,
-   9.923041105e-01,  9.924727324e-01,  9.926416894e-01,  9.928109714e-01,
-   9.929805672e-01,  9.931504648e-01,  9.933206511e-01,  9.934911125e-01,
-   9.936618343e-01,  9.938328013e-01,  9.940039975e-01,  9.941754063e-01,
-   9.943470108e-01,  9.945187933e-01,  9.946907360e-01,  9.948628204e-01,
-   9.950350279e-01,  9.952073398e-01,  9.953797369e-01,  9.955522000e-01,
-   9.957247099e-01,  9.958972472e-01,  9.960697927e-01,  9.962423272e-01,
-   9.964148315e-01,  9.965872868e-01,  9.967596743e-01,  9.969319755e-01,
-   9.971041723e-01,  9.972762468e-01,  9.974481815e-01,  9.976199593e-01,
-   9.977915637e-01,  9.979629783e-01,  9.981341875e-01,  9.983051761e-01,
-   9.984759295e-01,  9.986464336e-01,  9.988166748e-01,  9.989866403e-01,
-   9.991563179e-01,  9.993256958e-01,  9.994947629e-01,  9.996635091e-01,
-   9.998319245e-01,  1.000000000e+00,  1.000000000e+00,  1.000000000e+00,
-};
-
-
-const float* lookup_table_table[] = {
-  lut_sine,
-  lut_bipolar_fold,
-  lut_unipolar_fold,
-};
-
-const int16_t lut_wavetable[] = {
-       0,   2214,   3103,   3766,
-    4311,   4778,   5190,   5560,
-    5895,   6203,   6487,   6751,
-    6998,   7229,   7446,   7652,
-    7846,   8031,   8206,   8373,
-    8533,   8685,   8832,   8972,
-    9106,   9235,   9360,   9479,
-    9595,   9706,   9814,   9918,
-   10019,  10116,  10210,  10302,
-   10390,  10476,  10560,  10641,
-   10720,  10797,  10871,  10944,
-   11015,  11084,  11151,  11217,
-   11281,  11343,  11404,  11463,
-   11521,  11578,  11634,  11688,
-   11741,  11793,  11844,  11894,
-   11942,  11990,  12037,  12083,
-   12127,  12171,  12215,  12257,
-   12299,  12339,  12379,  12419,
-   12457,  12495,  12532,  12569,
-   12605,  12640,  12675,  12709,
-   12742,  12775,  12808,  12840,
-   12871,  12902,  12933,  12962,
-   12992,  13021,  13050,  13078,
-   13106,  13133,  13160,  13186,
-   13213,  13238,  13264,  13289,
-   13314,  13338,  13362,  13386,
-   13409,  13433,  13455,  13478,
-   13500,  13522,  13544,  13565,
-   13586,  13607,  13628,  13648,
-   13668,  13688,  13708,  13727,
-   13746,  13765,  13784,  13802,
-   13821,  13839,  13856,  13874,
-   13892,  13909,  13926,  13943,
-   13960,  13976,  13993,  14009,
-   14025,  14041,  14056,  14072,
-   14087,  14102,  14118,  14132,
-   14147,  14162,  14176,  14191,
-   14205,  14219,  14233,  14247,
-   14260,  14274,  14287,  14300,
-   14314,  14327,  14340,  14352,
-   14365,  14378,  14390,  14403,
-   14415,  14427,  14439,  14451,
-   14463,  14474,  14486,  14498,
-   14509,  14520,  14532,  14543,
-   14554,  14565,  14576,  14587,
-   14597,  14608,  14619,  14629,
-   14639,  14650,  14660,  14670,
-   14680,  14690,  14700,  14710,
-   14720,  14730,  14739,  14749,
-   14758,  14768,  14777,  14786,
-   14796,  14805,  14814,  14823,
-   14832,  14841,  14850,  14859,
-   14867,  14876,  14885,  14893,
-   14902,  14910,  14919,  14927,
-   14935,  14944,  14952,  14960,
-   14968,  14976,  14984,  14992,
-   15000,  15008,  15016,  15023,
-   15031,  15039,  15046,  15054,
-   15061,  15069,  15076,  15084,
-   15091,  15098,  15106,  15113,
-   15120,  15127,  15134,  15142,
-   15149,  15156,  15163,  15169,
-   15176,  15183,  15190,  15197,
-   15204,  15210,  15217,  15224,
-   15230,  15237,  15243,  15250,
-   15256,  15263,  15269,  15276,
-   15282,  15288,  15295,  15301,
-   15307,  15313,  15319,  15326,
-   15332,  15338,  15344,  15350,
-   15356,  15362,  15368,  15374,
-   15380,  15386,  15391,  15397,
-   15403,  15409,  15415,  15420,
-   15426,  15432,  15437,  15443,
-   15448,  15454,  15460,  15465,
-   15471,  15476,  15482,  15487,
-   15493,  15498,  15503,  15509,
-   15514,  15519,  15525,  15530,
-   15535,  15540,  15546,  15551,
-   15556,  15561,  15566,  15572,
-   15577,  15582,  15587,  15592,
-   15597,  15602,  15607,  15612,
-   15617,  15622,  15627,  15632,
-   15637,  15642,  15646,  15651,
-   15656,  15661,  15666,  15671,
-   15675,  15680,  15685,  15690,
-   15694,  15699,  15704,  15709,
-   15713,  15718,  15722,  15727,
-   15732,  15736,  15741,  15746,
-   15750,  15755,  15759,  15764,
-   15768,  15773,  15777,  15782,
-   15786,  15791,  15795,  15800,
-   15804,  15808,  15813,  15817,
-   15822,  15826,  15830,  15835,
-   15839,  15843,  15848,  15852,
-   15856,  15860,  15865,  15869,
-   15873,  15877,  15882,  15886,
-   15890,  15894,  15899,  15903,
-   15907,  15911,  15915,  15919,
-   15924,  15928,  15932,  15936,
-   15940,  15944,  15948,  15952,
-   15957,  15961,  15965,  15969,
-   15973,  15977,  15981,  15985,
-   15989,  15993,  15997,  16001,
-   16005,  16009,  16013,  16017,
-   16021,  16025,  16029,  16033,
-   16037,  16041,  16045,  16049,
-   16052,  16056,  16060,  16064,
-   16068,  16072,  16076,  16080,
-   16084,  16088,  16091,  16095,
-   16099,  16103,  16107,  16111,
-   16115,  16118,  16122,  16126,
-   16130,  16134,  16138,  16141,
-   16145,  16149,  16153,  16157,
-   16160,  16164,  16168,  16172,
-   16175,  16179,  16183,  16187,
-   16191,  16194,  16198,  16202,
-   16206,  16209,  16213,  16217,
-   16221,  16224,  16228,  16232,
-   16236,  16239,  16243,  16247,
-   16250,  16254,  16258,  16262,
-   16265,  16269,  16273,  16276,
-   16280,  16284,  16288,  16291,
-   16295,  16299,  16302,  16306,
-   16310,  16313,  16317,  16321,
-   16325,  16328,  16332,  16336,
-   16339,  16343,  16347,  16350,
-   16354,  16358,  16361,  16365,
-   16369,  16372,  16376,  16380,
-   16384,  16387,  16391,  16395,
-   16398,  16402,  16406,  16409,
-   16413,  16417,  16420,  16424,
-   16428,  16431,  16435,  16439,
-   16442,  16446,  16450,  16454,
-   16457,  16461,  16465,  16468,
-   16472,  16476,  16479,  16483,
-   16487,  16491,  16494,  16498,
-   16502,  16505,  16509,  16513,
-   16517,  16520,  16524,  16528,
-   16531,  16535,  16539,  16543,
-   16546,  16550,  16554,  16558,
-   16561,  16565,  16569,  16573,
-   16576,  16580,  16584,  16588,
-   16592,  16595,  16599,  16603,
-   16607,  16610,  16614,  16618,
-   16622,  16626,  16629,  16633,
-   16637,  16641,  16645,  16649,
-   16652,  16656,  16660,  16664,
-   16668,  16672,  16676,  16679,
-   16683,  16687,  16691,  16695,
-   16699,  16703,  16707,  16711,
-   16715,  16718,  16722,  16726,
-   16730,  16734,  16738,  16742,
-   16746,  16750,  16754,  16758,
-   16762,  16766,  16770,  16774,
-   16778,  16782,  16786,  16790,
-   16794,  16798,  16802,  16806,
-   16810,  16815,  16819,  16823,
-   16827,  16831,  16835,  16839,
-   16843,  16848,  16852,  16856,
-   16860,  16864,  16868,  16873,
-   16877,  16881,  16885,  16890,
-   16894,  16898,  16902,  16907,
-   16911,  16915,  16919,  16924,
-   16928,  16932,  16937,  16941,
-   16945,  16950,  16954,  16959,
-   16963,  16967,  16972,  16976,
-   16981,  16985,  16990,  16994,
-   16999,  17003,  17008,  17012,
-   17017,  17021,  17026,  17031,
-   17035,  17040,  17045,  17049,
-   17054,  17058,  17063,  17068,
-   17073,  17077,  17082,  17087,
-   17092,  17096,  17101,  17106,
-   17111,  17116,  17121,  17125,
-   17130,  17135,  17140,  17145,
-   17150,  17155,  17160,  17165,
-   17170,  17175,  17180,  17185,
-   17190,  17195,  17201,  17206,
-   17211,  17216,  17221,  17227,
-   17232,  17237,  17242,  17248,
-   17253,  17258,  17264,  17269,
-   17274,  17280,  17285,  17291,
-   17296,  17302,  17307,  17313,
-   17319,  17324,  17330,  17335,
-   17341,  17347,  17352,  17358,
-   17364,  17370,  17376,  17381,
-   17387,  17393,  17399,  17405,
-   17411,  17417,  17423,  17429,
-   17435,  17441,  17448,  17454,
-   17460,  17466,  17472,  17479,
-   17485,  17491,  17498,  17504,
-   17511,  17517,  17524,  17530,
-   17537,  17543,  17550,  17557,
-   17563,  17570,  17577,  17584,
-   17591,  17598,  17604,  17611,
-   17618,  17625,  17633,  17640,
-   17647,  17654,  17661,  17669,
-   17676,  17683,  17691,  17698,
-   17706,  17713,  17721,  17728,
-   17736,  17744,  17751,  17759,
-   17767,  17775,  17783,  17791,
-   17799,  17807,  17815,  17823,
-   17832,  17840,  17848,  17857,
-   17865,  17874,  17882,  17891,
-   17900,  17908,  17917,  17926,
-   17935,  17944,  17953,  17962,
-   17971,  17981,  17990,  17999,
-   18009,  18018,  18028,  18037,
-   18047,  18057,  18067,  18077,
-   18087,  18097,  18107,  18117,
-   18128,  18138,  18148,  18159,
-   18170,  18180,  18191,  18202,
-   18213,  18224,  18235,  18247,
-   18258,  18269,  18281,  18293,
-   18304,  18316,  18328,  18340,
-   18352,  18364,  18377,  18389,
-   18402,  18415,  18427,  18440,
-   18453,  18467,  18480,  18493,
-   18507,  18520,  18534,  18548,
-   18562,  18576,  18591,  18605,
-   18620,  18635,  18649,  18665,
-   18680,  18695,  18711,  18726,
-   18742,  18758,  18774,  18791,
-   18807,  18824,  18841,  18858,
-   18875,  18893,  18911,  18928,
-   18946,  18965,  18983,  19002,
-   19021,  19040,  19059,  19079,
-   19099,  19119,  19139,  19160,
-   19181,  19202,  19223,  19245,
-   19267,  19289,  19312,  19334,
-   19358,  19381,  19405,  19429,
-   19453,  19478,  19503,  19529,
-   19554,  19581,  19607,  19634,
-   19661,  19689,  19717,  19746,
-   19775,  19805,  19834,  19865,
-   19896,  19927,  19959,  19992,
-   20025,  20058,  20092,  20127,
-   20162,  20198,  20235,  20272,
-   20310,  20348,  20388,  20428,
-   20468,  20510,  20552,  20596,
-   20640,  20684,  20730,  20777,
-   20825,  20873,  20923,  20974,
-   21026,  21079,  21133,  21189,
-   21246,  21304,  21363,  21424,
-   21486,  21550,  21616,  21683,
-   21752,  21823,  21896,  21970,
-   22047,  22126,  22207,  22291,
-   22377,  22465,  22557,  22651,
-   22748,  22849,  22953,  23061,
-   23172,  23288,  23407,  23532,
-   23661,  23795,  23935,  24082,
-   24234,  24394,  24561,  24736,
-   24921,  25115,  25321,  25538,
-   25769,  26016,  26280,  26564,
-   26872,  27207,  27577,  27989,
-   28456,  29001,  29664,  30553,
-   30553,      0,    652,    922,
-    1130,   1305,   1459,   1598,
-    1727,   1846,   1959,   2065,
-    2166,   2263,   2355,   2445,
-    2531,   2614,   2695,   2774,
-    2850,   2925,   2998,   3069,
-    3138,   3206,   3273,   3338,
-    3402,   3465,   3527,   3588,
-    3648,   3707,   3765,   3822,
-    3879,   3935,   3989,   4044,
-    4097,   4150,   4202,   4254,
-    4305,   4356,   4406,   4455,
-    4504,   4552,   4600,   4648,
-    4695,   4741,   4788,   4833,
-    4879,   4924,   4968,   5013,
-    5057,   5100,   5143,   5186,
-    5229,   5271,   5313,   5354,
-    5396,   5437,   5478,   5518,
-    5558,   5598,   5638,   5678,
-    5717,   5756,   5794,   5833,
-    5871,   5909,   5947,   5985,
-    6022,   6059,   6096,   6133,
-    6170,   6206,   6243,   6279,
-    6315,   6350,   6386,   6421,
-    6456,   6491,   6526,   6561,
-    6595,   6630,   6664,   6698,
-    6732,   6766,   6800,   6833,
-    6866,   6900,   6933,   6966,
-    6999,   7031,   7064,   7096,
-    7129,   7161,   7193,   7225,
-    7257,   7288,   7320,   7351,
-    7383,   7414,   7445,   7476,
-    7507,   7538,   7569,   7600,
-    7630,   7661,   7691,   7721,
-    7751,   7781,   7811,   7841,
-    7871,   7901,   7930,   7960,
-    7989,   8019,   8048,   8077,
-    8106,   8135,   8164,   8193,
-    8222,   8250,   8279,   8307,
-    8336,   8364,   8393,   8421,
-    8449,   8477,   8505,   8533,
-    8561,   8589,   8616,   8644,
-    8672,   8699,   8727,   8754,
-    8782,   8809,   8836,   8863,
-    8890,   8917,   8944,   8971,
-    8998,   9025,   9052,   9078,
-    9105,   9131,   9158,   9184,
-    9211,   9237,   9263,   9290,
-    9316,   9342,   9368,   9394,
-    9420,   9446,   9472,   9497,
-    9523,   9549,   9575,   9600,
-    9626,   9651,   9677,   9702,
-    9728,   9753,   9778,   9804,
-    9829,   9854,   9879,   9904,
-    9929,   9954,   9979,  10004,
-   10029,  10054,  10078,  10103,
-   10128,  10153,  10177,  10202,
-   10226,  10251,  10275,  10300,
-   10324,  10348,  10373,  10397,
-   10421,  10445,  10470,  10494,
-   10518,  10542,  10566,  10590,
-   10614,  10638,  10662,  10686,
-   10709,  10733,  10757,  10781,
-   10804,  10828,  10852,  10875,
-   10899,  10922,  10946,  10969,
-   10993,  11016,  11040,  11063,
-   11086,  11110,  11133,  11156,
-   11179,  11202,  11226,  11249,
-   11272,  11295,  11318,  11341,
-   11364,  11387,  11410,  11433,
-   11456,  11479,  11501,  11524,
-   11547,  11570,  11593,  11615,
-   11638,  11661,  11683,  11706,
-   11728,  11751,  11774,  11796,
-   11819,  11841,  11864,  11886,
-   11908,  11931,  11953,  11975,
-   11998,  12020,  12042,  12065,
-   12087,  12109,  12131,  12154,
-   12176,  12198,  12220,  12242,
-   12264,  12286,  12308,  12330,
-   12352,  12374,  12396,  12418,
-   12440,  12462,  12484,  12506,
-   12528,  12549,  12571,  12593,
-   12615,  12637,  12658,  12680,
-   12702,  12724,  12745,  12767,
-   12789,  12810,  12832,  12853,
-   12875,  12897,  12918,  12940,
-   12961,  12983,  13004,  13026,
-   13047,  13069,  13090,  13111,
-   13133,  13154,  13176,  13197,
-   13218,  13240,  13261,  13282,
-   13304,  13325,  13346,  13367,
-   13389,  13410,  13431,  13452,
-   13474,  13495,  13516,  13537,
-   13558,  13579,  13600,  13622,
-   13643,  13664,  13685,  13706,
-   13727,  13748,  13769,  13790,
-   13811,  13832,  13853,  13874,
-   13895,  13916,  13937,  13958,
-   13979,  14000,  14021,  14042,
-   14062,  14083,  14104,  14125,
-   14146,  14167,  14188,  14208,
-   14229,  14250,  14271,  14292,
-   14312,  14333,  14354,  14375,
-   14395,  14416,  14437,  14458,
-   14478,  14499,  14520,  14541,
-   14561,  14582,  14603,  14623,
-   14644,  14665,  14685,  14706,
-   14726,  14747,  14768,  14788,
-   14809,  14830,  14850,  14871,
-   14891,  14912,  14932,  14953,
-   14974,  14994,  15015,  15035,
-   15056,  15076,  15097,  15117,
-   15138,  15158,  15179,  15199,
-   15220,  15240,  15261,  15281,
-   15302,  15322,  15343,  15363,
-   15384,  15404,  15425,  15445,
-   15466,  15486,  15507,  15527,
-   15547,  15568,  15588,  15609,
-   15629,  15650,  15670,  15690,
-   15711,  15731,  15752,  15772,
-   15792,  15813,  15833,  15854,
-   15874,  15894,  15915,  15935,
-   15956,  15976,  15996,  16017,
-   16037,  16058,  16078,  16098,
-   16119,  16139,  16159,  16180,
-   16200,  16221,  16241,  16261,
-   16282,  16302,  16322,  16343,
-   16363,  16384,  16404,  16424,
-   16445,  16465,  16485,  16506,
-   16526,  16546,  16567,  16587,
-   16608,  16628,  16648,  16669,
-   16689,  16709,  16730,  16750,
-   16771,  16791,  16811,  16832,
-   16852,  16873,  16893,  16913,
-   16934,  16954,  16975,  16995,
-   17015,  17036,  17056,  17077,
-   17097,  17117,  17138,  17158,
-   17179,  17199,  17220,  17240,
-   17260,  17281,  17301,  17322,
-   17342,  17363,  17383,  17404,
-   17424,  17445,  17465,  17486,
-   17506,  17527,  17547,  17568,
-   17588,  17609,  17629,  17650,
-   17670,  17691,  17711,  17732,
-   17752,  17773,  17793,  17814,
-   17835,  17855,  17876,  17896,
-   17917,  17937,  17958,  17979,
-   17999,  18020,  18041,  18061,
-   18082,  18102,  18123,  18144,
-   18164,  18185,  18206,  18226,
-   18247,  18268,  18289,  18309,
-   18330,  18351,  18372,  18392,
-   18413,  18434,  18455,  18475,
-   18496,  18517,  18538,  18559,
-   18579,  18600,  18621,  18642,
-   18663,  18684,  18705,  18725,
-   18746,  18767,  18788,  18809,
-   18830,  18851,  18872,  18893,
-   18914,  18935,  18956,  18977,
-   18998,  19019,  19040,  19061,
-   19082,  19103,  19124,  19145,
-   19167,  19188,  19209,  19230,
-   19251,  19272,  19293,  19315,
-   19336,  19357,  19378,  19400,
-   19421,  19442,  19463,  19485,
-   19506,  19527,  19549,  19570,
-   19591,  19613,  19634,  19656,
-   19677,  19698,  19720,  19741,
-   19763,  19784,  19806,  19827,
-   19849,  19870,  19892,  19914,
-   19935,  19957,  19978,  20000,
-   20022,  20043,  20065,  20087,
-   20109,  20130,  20152,  20174,
-   20196,  20218,  20239,  20261,
-   20283,  20305,  20327,  20349,
-   20371,  20393,  20415,  20437,
-   20459,  20481,  20503,  20525,
-   20547,  20569,  20591,  20613,
-   20636,  20658,  20680,  20702,
-   20725,  20747,  20769,  20792,
-   20814,  20836,  20859,  20881,
-   20903,  20926,  20948,  20971,
-   20993,  21016,  21039,  21061,
-   21084,  21106,  21129,  21152,
-   21174,  21197,  21220,  21243,
-   21266,  21288,  21311,  21334,
-   21357,  21380,  21403,  21426,
-   21449,  21472,  21495,  21518,
-   21541,  21565,  21588,  21611,
-   21634,  21657,  21681,  21704,
-   21727,  21751,  21774,  21798,
-   21821,  21845,  21868,  21892,
-   21915,  21939,  21963,  21986,
-   22010,  22034,  22058,  22081,
-   22105,  22129,  22153,  22177,
-   22201,  22225,  22249,  22273,
-   22297,  22322,  22346,  22370,
-   22394,  22419,  22443,  22467,
-   22492,  22516,  22541,  22565,
-   22590,  22614,  22639,  22664,
-   22689,  22713,  22738,  22763,
-   22788,  22813,  22838,  22863,
-   22888,  22913,  22938,  22963,
-   22989,  23014,  23039,  23065,
-   23090,  23116,  23141,  23167,
-   23192,  23218,  23244,  23270,
-   23295,  23321,  23347,  23373,
-   23399,  23425,  23451,  23477,
-   23504,  23530,  23556,  23583,
-   23609,  23636,  23662,  23689,
-   23715,  23742,  23769,  23796,
-   23823,  23850,  23877,  23904,
-   23931,  23958,  23985,  24013,
-   24040,  24068,  24095,  24123,
-   24151,  24178,  24206,  24234,
-   24262,  24290,  24318,  24346,
-   24374,  24403,  24431,  24460,
-   24488,  24517,  24545,  24574,
-   24603,  24632,  24661,  24690,
-   24719,  24748,  24778,  24807,
-   24837,  24866,  24896,  24926,
-   24956,  24986,  25016,  25046,
-   25076,  25106,  25137,  25167,
-   25198,  25229,  25260,  25291,
-   25322,  25353,  25384,  25416,
-   25447,  25479,  25510,  25542,
-   25574,  25606,  25638,  25671,
-   25703,  25736,  25768,  25801,
-   25834,  25867,  25901,  25934,
-   25967,  26001,  26035,  26069,
-   26103,  26137,  26172,  26206,
-   26241,  26276,  26311,  26346,
-   26381,  26417,  26452,  26488,
-   26524,  26561,  26597,  26634,
-   26671,  26708,  26745,  26782,
-   26820,  26858,  26896,  26934,
-   26973,  27011,  27050,  27089,
-   27129,  27169,  27209,  27249,
-   27289,  27330,  27371,  27413,
-   27454,  27496,  27538,  27581,
-   27624,  27667,  27710,  27754,
-   27799,  27843,  27888,  27934,
-   27979,  28026,  28072,  28119,
-   28167,  28215,  28263,  28312,
-   28361,  28411,  28462,  28513,
-   28565,  28617,  28670,  28723,
-   28778,  28832,  28888,  28945,
-   29002,  29060,  29119,  29179,
-   29240,  29302,  29365,  29429,
-   29494,  29561,  29629,  29698,
-   29769,  29842,  29917,  29993,
-   30072,  30153,  30236,  30322,
-   30412,  30504,  30601,  30702,
-   30808,  30921,  31040,  31169,
-   31308,  31462,  31637,  31845,
-   32115,  32115,      0,     32,
-      64,     96,    128,    160,
-     192,    224,    256,    288,
-     320,    352,    384,    416,
-     448,    480,    512,    544,
-     576,    608,    640,    672,
-     704,    736,    768,    800,
-     832,    864,    896,    928,
-     960,    992,   1024,   1056,
-    1088,   1120,   1152,   1184,
-    1216,   1248,   1280,   1312,
-    1344,   1376,   1408,   1440,
-    1472,   1504,   1536,   1568,
-    1600,   1632,   1664,   1696,
-    1728,   1760,   1792,   1824,
-    1856,   1888,   1920,   1952,
-    1984,   2016,   2048,   2080,
-    2112,   2144,   2176,   2208,
-    2240,   2272,   2304,   2336,
-    2368,   2400,   2432,   2464,
-    2496,   2528,   2560,   2592,
-    2624,   2656,   2688,   2720,
-    2752,   2784,   2816,   2848,
-    2880,   2912,   2944,   2976,
-    3008,   3040,   3072,   3104,
-    3136,   3168,   3200,   3232,
-    3264,   3296,   3328,   3360,
-    3392,   3424,   3456,   3488,
-    3520,   3552,   3584,   3616,
-    3648,   3680,   3712,   3744,
-    3776,   3808,   3840,   3872,
-    3904,   3936,   3968,   4000,
-    4032,   4064,   4096,   4128,
-    4160,   4192,   4224,   4256,
-    4288,   4320,   4352,   4384,
-    4416,   4448,   4480,   4512,
-    4544,   4576,   4608,   4640,
-    4672,   4704,   4736,   4768,
-    4800,   4832,   4864,   4896,
-    4928,   4960,   4992,   5024,
-    5056,   5088,   5120,   5152,
-    5184,   5216,   5248,   5280,
-    5312,   5344,   5376,   5408,
-    5440,   5472,   5504,   5536,
-    5568,   5600,   5632,   5664,
-    5696,   5728,   5760,   5792,
-    5824,   5856,   5888,   5920,
-    5952,   5984,   6016,   6048,
-    6080,   6112,   6144,   6176,
-    6208,   6240,   6272,   6304,
-    6336,   6368,   6400,   6432,
-    6464,   6496,   6528,   6560,
-    6592,   6624,   6656,   6688,
-    6720,   6752,   6784,   6816,
-    6848,   6880,   6912,   6944,
-    6976,   7008,   7040,   7072,
-    7104,   7136,   7168,   7200,
-    7232,   7264,   7296,   7328,
-    7360,   7392,   7424,   7456,
-    7488,   7520,   7552,   7584,
-    7616,   7648,   7680,   7712,
-    7744,   7776,   7808,   7840,
-    7872,   7904,   7936,   7968,
-    8000,   8032,   8064,   8096,
-    8128,   8160,   8192,   8224,
-    8256,   8288,   8320,   8352,
-    8384,   8416,   8448,   8480,
-    8512,   8544,   8576,   8608,
-    8640,   8672,   8704,   8736,
-    8768,   8800,   8832,   8864,
-    8896,   8928,   8960,   8992,
-    9024,   9056,   9088,   9120,
-    9152,   9184,   9216,   9248,
-    9280,   9312,   9344,   9376,
-    9408,   9440,   9472,   9504,
-    9536,   9568,   9600,   9632,
-    9664,   9696,   9728,   9760,
-    9792,   9824,   9856,   9888,
-    9920,   9952,   9984,  10016,
-   10048,  10080,  10112,  10144,
-   10176,  10208,  10240,  10272,
-   10304,  10336,  10368,  10400,
-   10432,  10464,  10496,  10528,
-   10560,  10592,  10624,  10656,
-   10688,  10720,  10752,  10784,
-   10816,  10848,  10880,  10912,
-   10944,  10976,  11008,  11040,
-   11072,  11104,  11136,  11168,
-   11200,  11232,  11264,  11296,
-   11328,  11360,  11392,  11424,
-   11456,  11488,  11520,  11552,
-   11584,  11616,  11648,  11680,
-   11712,  11744,  11776,  11808,
-   11840,  11872,  11904,  11936,
-   11968,  12000,  12032,  12064,
-   12096,  12128,  12160,  12192,
-   12224,  12256,  12288,  12320,
-   12352,  12384,  12416,  12448,
-   12480,  12512,  12544,  12576,
-   12608,  12640,  12672,  12704,
-   12736,  12768,  12800,  12832,
-   12864,  12896,  12928,  12960,
-   12992,  13024,  13056,  13088,
-   13120,  13152,  13184,  13216,
-   13248,  13280,  13312,  13344,
-   13376,  13408,  13440,  13472,
-   13504,  13536,  13568,  13600,
-   13632,  13664,  13696,  13728,
-   13760,  13792,  13824,  13856,
-   13888,  13920,  13952,  13984,
-   14016,  14048,  14080,  14112,
-   14144,  14176,  14208,  14240,
-   14272,  14304,  14336,  14368,
-   14400,  14432,  14464,  14496,
-   14528,  14560,  14592,  14624,
-   14656,  14688,  14720,  14752,
-   14784,  14816,  14848,  14880,
-   14912,  14944,  14976,  15008,
-   15040,  15072,  15104,  15136,
-   15168,  15200,  15232,  15264,
-   15296,  15328,  15360,  15392,
-   15424,  15456,  15488,  15520,
-   15552,  15584,  15616,  15648,
-   15680,  15712,  15744,  15776,
-   15808,  15840,  15872,  15904,
-   15936,  15968,  16000,  16032,
-   16064,  16096,  16128,  16160,
-   16192,  16224,  16256,  16288,
-   16320,  16352,  16384,  16415,
-   16447,  16479,  16511,  16543,
-   16575,  16607,  16639,  16671,
-   16703,  16735,  16767,  16799,
-   16831,  16863,  16895,  16927,
-   16959,  16991,  17023,  17055,
-   17087,  17119,  17151,  17183,
-   17215,  17247,  17279,  17311,
-   17343,  17375,  17407,  17439,
-   17471,  17503,  17535,  17567,
-   17599,  17631,  17663,  17695,
-   17727,  17759,  17791,  17823,
-   17855,  17887,  17919,  17951,
-   17983,  18015,  18047,  18079,
-   18111,  18143,  18175,  18207,
-   18239,  18271,  18303,  18335,
-   18367,  18399,  18431,  18463,
-   18495,  18527,  18559,  18591,
-   18623,  18655,  18687,  18719,
-   18751,  18783,  18815,  18847,
-   18879,  18911,  18943,  18975,
-   19007,  19039,  19071,  19103,
-   19135,  19167,  19199,  19231,
-   19263,  19295,  19327,  19359,
-   19391,  19423,  19455,  19487,
-   19519,  19551,  19583,  19615,
-   19647,  19679,  19711,  19743,
-   19775,  19807,  19839,  19871,
-   19903,  19935,  19967,  19999,
-   20031,  20063,  20095,  20127,
-   20159,  20191,  20223,  20255,
-   20287,  20319,  20351,  20383,
-   20415,  20447,  20479,  20511,
-   20543,  20575,  20607,  20639,
-   20671,  20703,  20735,  20767,
-   20799,  20831,  20863,  20895,
-   20927,  20959,  20991,  21023,
-   21055,  21087,  21119,  21151,
-   21183,  21215,  21247,  21279,
-   21311,  21343,  21375,  21407,
-   21439,  21471,  21503,  21535,
-   21567,  21599,  21631,  21663,
-   21695,  21727,  21759,  21791,
-   21823,  21855,  21887,  21919,
-   21951,  21983,  22015,  22047,
-   22079,  22111,  22143,  22175,
-   22207,  22239,  22271,  22303,
-   22335,  22367,  22399,  22431,
-   22463,  22495,  22527,  22559,
-   22591,  22623,  22655,  22687,
-   22719,  22751,  22783,  22815,
-   22847,  22879,  22911,  22943,
-   22975,  23007,  23039,  23071,
-   23103,  23135,  23167,  23199,
-   23231,  23263,  23295,  23327,
-   23359,  23391,  23423,  23455,
-   23487,  23519,  23551,  23583,
-   23615,  23647,  23679,  23711,
-   23743,  23775,  23807,  23839,
-   23871,  23903,  23935,  23967,
-   23999,  24031,  24063,  24095,
-   24127,  24159,  24191,  24223,
-   24255,  24287,  24319,  24351,
-   24383,  24415,  24447,  24479,
-   24511,  24543,  24575,  24607,
-   24639,  24671,  24703,  24735,
-   24767,  24799,  24831,  24863,
-   24895,  24927,  24959,  24991,
-   25023,  25055,  25087,  25119,
-   25151,  25183,  25215,  25247,
-   25279,  25311,  25343,  25375,
-   25407,  25439,  25471,  25503,
-   25535,  25567,  25599,  25631,
-   25663,  25695,  25727,  25759,
-   25791,  25823,  25855,  25887,
-   25919,  25951,  25983,  26015,
-   26047,  26079,  26111,  26143,
-   26175,  26207,  26239,  26271,
-   26303,  26335,  26367,  26399,
-   26431,  26463,  26495,  26527,
-   26559,  26591,  26623,  26655,
-   26687,  26719,  26751,  26783,
-   26815,  26847,  26879,  26911,
-   26943,  26975,  27007,  27039,
-   27071,  27103,  27135,  27167,
-   27199,  27231,  27263,  27295,
-   27327,  27359,  27391,  27423,
-   27455,  27487,  27519,  27551,
-   27583,  27615,  27647,  27679,
-   27711,  27743,  27775,  27807,
-   27839,  27871,  27903,  27935,
-   27967,  27999,  28031,  28063,
-   28095,  28127,  28159,  28191,
-   28223,  28255,  28287,  28319,
-   28351,  28383,  28415,  28447,
-   28479,  28511,  28543,  28575,
-   28607,  28639,  28671,  28703,
-   28735,  28767,  28799,  28831,
-   28863,  28895,  28927,  28959,
-   28991,  29023,  29055,  29087,
-   29119,  29151,  29183,  29215,
-   29247,  29279,  29311,  29343,
-   29375,  29407,  29439,  29471,
-   29503,  29535,  29567,  29599,
-   29631,  29663,  29695,  29727,
-   29759,  29791,  29823,  29855,
-   29887,  29919,  29951,  29983,
-   30015,  30047,  30079,  30111,
-   30143,  30175,  30207,  30239,
-   30271,  30303,  30335,  30367,
-   30399,  30431,  30463,  30495,
-   30527,  30559,  30591,  30623,
-   30655,  30687,  30719,  30751,
-   30783,  30815,  30847,  30879,
-   30911,  30943,  30975,  31007,
-   31039,  31071,  31103,  31135,
-   31167,  31199,  31231,  31263,
-   31295,  31327,  31359,  31391,
-   31423,  31455,  31487,  31519,
-   31551,  31583,  31615,  31647,
-   31679,  31711,  31743,  31775,
-   31807,  31839,  31871,  31903,
-   31935,  31967,  31999,  32031,
-   32063,  32095,  32127,  32159,
-   32191,  32223,  32255,  32287,
-   32319,  32351,  32383,  32415,
-   32447,  32479,  32511,  32543,
-   32575,  32607,  32639,  32671,
-   32703,  32735,  32735,      0,
-       0,      0,      1,      1,
-       2,      3,      4,      5,
-       6,      8,      9,     11,
-      13,     15,     17,     20,
-      22,     25,     28,     31,
-      34,     37,     41,     44,
-      48,     52,     56,     60,
-      65,     69,     74,     79,
-      84,     89,     94,    100,
-     105,    111,    117,    123,
-     129,    136,    142,    149,
-     156,    163,    170,    177,
-     185,    192,    200,    208,
-     216,    224,    233,    241,
-     250,    259,    268,    277,
-     286,    295,    305,    315,
-     325,    335,    345,    355,
-     366,    376,    387,    398,
-     409,    420,    432,    443,
-     455,    467,    479,    491,
-     503,    516,    528,    541,
-     554,    567,    580,    593,
-     607,    621,    634,    648,
-     662,    677,    691,    705,
-     720,    735,    750,    765,
-     780,    796,    811,    827,
-     843,    859,    875,    891,
-     908,    924,    941,    958,
-     975,    992,   1009,   1027,
-    1044,   1062,   1080,   1098,
-    1116,   1134,   1153,   1171,
-    1190,   1209,   1228,   1247,
-    1266,   1286,   1305,   1325,
-    1345,   1365,   1385,   1406,
-    1426,   1447,   1467,   1488,
-    1509,   1530,   1552,   1573,
-    1595,   1616,   1638,   1660,
-    1682,   1704,   1727,   1749,
-    1772,   1795,   1818,   1841,
-    1864,   1887,   1911,   1935,
-    1958,   1982,   2006,   2030,
-    2055,   2079,   2104,   2128,
-    2153,   2178,   2203,   2229,
-    2254,   2279,   2305,   2331,
-    2357,   2383,   2409,   2435,
-    2462,   2488,   2515,   2542,
-    2569,   2596,   2623,   2650,
-    2678,   2706,   2733,   2761,
-    2789,   2817,   2845,   2874,
-    2902,   2931,   2960,   2989,
-    3018,   3047,   3076,   3105,
-    3135,   3165,   3194,   3224,
-    3254,   3284,   3315,   3345,
-    3375,   3406,   3437,   3468,
-    3499,   3530,   3561,   3592,
-    3624,   3655,   3687,   3719,
-    3751,   3783,   3815,   3847,
-    3880,   3912,   3945,   3978,
-    4011,   4044,   4077,   4110,
-    4143,   4177,   4210,   4244,
-    4278,   4312,   4346,   4380,
-    4414,   4449,   4483,   4518,
-    4553,   4587,   4622,   4657,
-    4692,   4728,   4763,   4799,
-    4834,   4870,   4906,   4942,
-    4978,   5014,   5050,   5086,
-    5123,   5159,   5196,   5233,
-    5270,   5307,   5344,   5381,
-    5418,   5456,   5493,   5531,
-    5569,   5606,   5644,   5682,
-    5720,   5759,   5797,   5835,
-    5874,   5912,   5951,   5990,
-    6029,   6068,   6107,   6146,
-    6185,   6225,   6264,   6304,
-    6344,   6383,   6423,   6463,
-    6503,   6543,   6584,   6624,
-    6664,   6705,   6745,   6786,
-    6827,   6868,   6909,   6950,
-    6991,   7032,   7073,   7115,
-    7156,   7198,   7240,   7281,
-    7323,   7365,   7407,   7449,
-    7491,   7534,   7576,   7618,
-    7661,   7703,   7746,   7789,
-    7832,   7875,   7918,   7961,
-    8004,   8047,   8090,   8134,
-    8177,   8221,   8264,   8308,
-    8352,   8396,   8440,   8484,
-    8528,   8572,   8616,   8660,
-    8705,   8749,   8794,   8838,
-    8883,   8928,   8972,   9017,
-    9062,   9107,   9152,   9197,
-    9243,   9288,   9333,   9379,
-    9424,   9470,   9515,   9561,
-    9607,   9652,   9698,   9744,
-    9790,   9836,   9882,   9929,
-    9975,  10021,  10067,  10114,
-   10160,  10207,  10253,  10300,
-   10347,  10393,  10440,  10487,
-   10534,  10581,  10628,  10675,
-   10722,  10770,  10817,  10864,
-   10911,  10959,  11006,  11054,
-   11101,  11149,  11197,  11244,
-   11292,  11340,  11388,  11436,
-   11484,  11532,  11580,  11628,
-   11676,  11724,  11772,  11820,
-   11869,  11917,  11965,  12014,
-   12062,  12111,  12159,  12208,
-   12257,  12305,  12354,  12403,
-   12451,  12500,  12549,  12598,
-   12647,  12696,  12745,  12794,
-   12843,  12892,  12941,  12990,
-   13039,  13089,  13138,  13187,
-   13237,  13286,  13335,  13385,
-   13434,  13484,  13533,  13583,
-   13632,  13682,  13731,  13781,
-   13830,  13880,  13930,  13980,
-   14029,  14079,  14129,  14179,
-   14228,  14278,  14328,  14378,
-   14428,  14478,  14528,  14578,
-   14628,  14678,  14728,  14778,
-   14828,  14878,  14928,  14978,
-   15028,  15078,  15128,  15178,
-   15228,  15279,  15329,  15379,
-   15429,  15479,  15529,  15580,
-   15630,  15680,  15730,  15780,
-   15831,  15881,  15931,  15981,
-   16032,  16082,  16132,  16182,
-   16233,  16283,  16333,  16383,
-   16434,  16484,  16534,  16585,
-   16635,  16685,  16735,  16786,
-   16836,  16886,  16936,  16987,
-   17037,  17087,  17137,  17187,
-   17238,  17288,  17338,  17388,
-   17438,  17488,  17539,  17589,
-   17639,  17689,  17739,  17789,
-   17839,  17889,  17939,  17989,
-   18039,  18089,  18139,  18189,
-   18239,  18289,  18339,  18389,
-   18439,  18489,  18539,  18588,
-   18638,  18688,  18738,  18787,
-   18837,  18887,  18937,  18986,
-   19036,  19085,  19135,  19184,
-   19234,  19283,  19333,  19382,
-   19432,  19481,  19530,  19580,
-   19629,  19678,  19728,  19777,
-   19826,  19875,  19924,  19973,
-   20022,  20071,  20120,  20169,
-   20218,  20267,  20316,  20364,
-   20413,  20462,  20510,  20559,
-   20608,  20656,  20705,  20753,
-   20802,  20850,  20898,  20947,
-   20995,  21043,  21091,  21139,
-   21187,  21235,  21283,  21331,
-   21379,  21427,  21475,  21523,
-   21570,  21618,  21666,  21713,
-   21761,  21808,  21856,  21903,
-   21950,  21997,  22045,  22092,
-   22139,  22186,  22233,  22280,
-   22327,  22374,  22420,  22467,
-   22514,  22560,  22607,  22653,
-   22700,  22746,  22792,  22838,
-   22885,  22931,  22977,  23023,
-   23069,  23115,  23160,  23206,
-   23252,  23297,  23343,  23388,
-   23434,  23479,  23524,  23570,
-   23615,  23660,  23705,  23750,
-   23795,  23839,  23884,  23929,
-   23973,  24018,  24062,  24107,
-   24151,  24195,  24239,  24283,
-   24327,  24371,  24415,  24459,
-   24503,  24546,  24590,  24633,
-   24677,  24720,  24763,  24806,
-   24849,  24892,  24935,  24978,
-   25021,  25064,  25106,  25149,
-   25191,  25233,  25276,  25318,
-   25360,  25402,  25444,  25486,
-   25527,  25569,  25611,  25652,
-   25694,  25735,  25776,  25817,
-   25858,  25899,  25940,  25981,
-   26022,  26062,  26103,  26143,
-   26183,  26224,  26264,  26304,
-   26344,  26384,  26423,  26463,
-   26503,  26542,  26582,  26621,
-   26660,  26699,  26738,  26777,
-   26816,  26855,  26893,  26932,
-   26970,  27008,  27047,  27085,
-   27123,  27161,  27198,  27236,
-   27274,  27311,  27349,  27386,
-   27423,  27460,  27497,  27534,
-   27571,  27608,  27644,  27681,
-   27717,  27753,  27789,  27825,
-   27861,  27897,  27933,  27968,
-   28004,  28039,  28075,  28110,
-   28145,  28180,  28214,  28249,
-   28284,  28318,  28353,  28387,
-   28421,  28455,  28489,  28523,
-   28557,  28590,  28624,  28657,
-   28690,  28723,  28756,  28789,
-   28822,  28855,  28887,  28920,
-   28952,  28984,  29016,  29048,
-   29080,  29112,  29143,  29175,
-   29206,  29237,  29268,  29299,
-   29330,  29361,  29392,  29422,
-   29452,  29483,  29513,  29543,
-   29573,  29602,  29632,  29662,
-   29691,  29720,  29749,  29778,
-   29807,  29836,  29865,  29893,
-   29922,  29950,  29978,  30006,
-   30034,  30061,  30089,  30117,
-   30144,  30171,  30198,  30225,
-   30252,  30279,  30305,  30332,
-   30358,  30384,  30410,  30436,
-   30462,  30488,  30513,  30538,
-   30564,  30589,  30614,  30639,
-   30663,  30688,  30712,  30737,
-   30761,  30785,  30809,  30832,
-   30856,  30880,  30903,  30926,
-   30949,  30972,  30995,  31018,
-   31040,  31063,  31085,  31107,
-   31129,  31151,  31172,  31194,
-   31215,  31237,  31258,  31279,
-   31300,  31320,  31341,  31361,
-   31382,  31402,  31422,  31442,
-   31462,  31481,  31501,  31520,
-   31539,  31558,  31577,  31596,
-   31614,  31633,  31651,  31669,
-   31687,  31705,  31723,  31740,
-   31758,  31775,  31792,  31809,
-   31826,  31843,  31859,  31876,
-   31892,  31908,  31924,  31940,
-   31956,  31971,  31987,  32002,
-   32017,  32032,  32047,  32062,
-   32076,  32090,  32105,  32119,
-   32133,  32146,  32160,  32174,
-   32187,  32200,  32213,  32226,
-   32239,  32251,  32264,  32276,
-   32288,  32300,  32312,  32324,
-   32335,  32347,  32358,  32369,
-   32380,  32391,  32401,  32412,
-   32422,  32432,  32442,  32452,
-   32462,  32472,  32481,  32490,
-   32499,  32508,  32517,  32526,
-   32534,  32543,  32551,  32559,
-   32567,  32575,  32582,  32590,
-   32597,  32604,  32611,  32618,
-   32625,  32631,  32638,  32644,
-   32650,  32656,  32662,  32667,
-   32673,  32678,  32683,  32688,
-   32693,  32698,  32702,  32707,
-   32711,  32715,  32719,  32723,
-   32726,  32730,  32733,  32736,
-   32739,  32742,  32745,  32747,
-   32750,  32752,  32754,  32756,
-   32758,  32759,  32761,  32762,
-   32763,  32764,  32765,  32766,
-   32766,  32767,  32767,  32767,
-       0,      0,      1,      1,
-       2,      4,      6,      8,
-      10,     12,     15,     19,
-      22,     26,     30,     35,
-      39,     45,     50,     56,
-      62,     68,     75,     81,
-      89,     96,    104,    112,
-     121,    129,    139,    148,
-     158,    168,    178,    188,
-     199,    211,    222,    234,
-     246,    258,    271,    284,
-     298,    311,    325,    339,
-     354,    369,    384,    399,
-     415,    431,    447,    464,
-     481,    498,    516,    534,
-     552,    570,    589,    608,
-     627,    647,    667,    687,
-     707,    728,    749,    770,
-     792,    814,    836,    859,
-     882,    905,    928,    952,
-     976,   1000,   1025,   1049,
-    1075,   1100,   1126,   1152,
-    1178,   1205,   1231,   1258,
-    1286,   1314,   1341,   1370,
-    1398,   1427,   1456,   1485,
-    1515,   1545,   1575,   1606,
-    1636,   1667,   1699,   1730,
-    1762,   1794,   1826,   1859,
-    1892,   1925,   1959,   1992,
-    2026,   2060,   2095,   2130,
-    2165,   2200,   2236,   2271,
-    2307,   2344,   2380,   2417,
-    2454,   2492,   2529,   2567,
-    2605,   2644,   2682,   2721,
-    2760,   2800,   2839,   2879,
-    2919,   2960,   3000,   3041,
-    3082,   3124,   3165,   3207,
-    3249,   3292,   3334,   3377,
-    3420,   3463,   3507,   3550,
-    3594,   3639,   3683,   3728,
-    3773,   3818,   3863,   3909,
-    3954,   4000,   4047,   4093,
-    4140,   4187,   4234,   4281,
-    4329,   4377,   4425,   4473,
-    4521,   4570,   4619,   4668,
-    4717,   4767,   4816,   4866,
-    4916,   4967,   5017,   5068,
-    5119,   5170,   5221,   5273,
-    5324,   5376,   5428,   5481,
-    5533,   5586,   5639,   5692,
-    5745,   5798,   5852,   5906,
-    5960,   6014,   6068,   6123,
-    6178,   6232,   6287,   6343,
-    6398,   6454,   6509,   6565,
-    6621,   6678,   6734,   6791,
-    6848,   6904,   6962,   7019,
-    7076,   7134,   7191,   7249,
-    7307,   7366,   7424,   7482,
-    7541,   7600,   7659,   7718,
-    7777,   7836,   7896,   7956,
-    8015,   8075,   8135,   8196,
-    8256,   8316,   8377,   8438,
-    8499,   8560,   8621,   8682,
-    8743,   8805,   8866,   8928,
-    8990,   9052,   9114,   9176,
-    9239,   9301,   9364,   9426,
-    9489,   9552,   9615,   9678,
-    9741,   9804,   9868,   9931,
-    9995,  10059,  10122,  10186,
-   10250,  10314,  10378,  10443,
-   10507,  10571,  10636,  10700,
-   10765,  10830,  10895,  10960,
-   11025,  11090,  11155,  11220,
-   11285,  11351,  11416,  11481,
-   11547,  11613,  11678,  11744,
-   11810,  11876,  11941,  12007,
-   12073,  12139,  12206,  12272,
-   12338,  12404,  12470,  12537,
-   12603,  12670,  12736,  12803,
-   12869,  12936,  13002,  13069,
-   13136,  13202,  13269,  13336,
-   13403,  13470,  13536,  13603,
-   13670,  13737,  13804,  13871,
-   13938,  14005,  14072,  14139,
-   14206,  14273,  14340,  14407,
-   14474,  14541,  14608,  14675,
-   14742,  14809,  14876,  14943,
-   15010,  15077,  15144,  15211,
-   15278,  15345,  15412,  15478,
-   15545,  15612,  15679,  15746,
-   15813,  15879,  15946,  16013,
-   16079,  16146,  16213,  16279,
-   16346,  16412,  16479,  16545,
-   16612,  16678,  16744,  16810,
-   16877,  16943,  17009,  17075,
-   17141,  17207,  17273,  17338,
-   17404,  17470,  17536,  17601,
-   17667,  17732,  17797,  17863,
-   17928,  17993,  18058,  18123,
-   18188,  18253,  18318,  18383,
-   18447,  18512,  18576,  18641,
-   18705,  18769,  18833,  18897,
-   18961,  19025,  19089,  19152,
-   19216,  19280,  19343,  19406,
-   19469,  19532,  19595,  19658,
-   19721,  19783,  19846,  19908,
-   19971,  20033,  20095,  20157,
-   20219,  20280,  20342,  20403,
-   20465,  20526,  20587,  20648,
-   20709,  20769,  20830,  20890,
-   20951,  21011,  21071,  21131,
-   21191,  21250,  21310,  21369,
-   21428,  21487,  21546,  21605,
-   21663,  21722,  21780,  21838,
-   21896,  21954,  22012,  22069,
-   22127,  22184,  22241,  22298,
-   22354,  22411,  22467,  22523,
-   22579,  22635,  22691,  22747,
-   22802,  22857,  22912,  22967,
-   23022,  23076,  23130,  23184,
-   23238,  23292,  23346,  23399,
-   23452,  23505,  23558,  23611,
-   23663,  23715,  23767,  23819,
-   23871,  23922,  23973,  24024,
-   24075,  24126,  24176,  24227,
-   24277,  24327,  24376,  24426,
-   24475,  24524,  24573,  24621,
-   24669,  24718,  24766,  24813,
-   24861,  24908,  24955,  25002,
-   25049,  25095,  25141,  25187,
-   25233,  25278,  25324,  25369,
-   25413,  25458,  25502,  25547,
-   25590,  25634,  25678,  25721,
-   25764,  25806,  25849,  25891,
-   25933,  25975,  26016,  26058,
-   26099,  26139,  26180,  26220,
-   26260,  26300,  26340,  26379,
-   26418,  26457,  26495,  26534,
-   26572,  26609,  26647,  26684,
-   26721,  26758,  26795,  26831,
-   26867,  26903,  26938,  26973,
-   27008,  27043,  27077,  27111,
-   27145,  27179,  27212,  27245,
-   27278,  27311,  27343,  27375,
-   27407,  27438,  27469,  27500,
-   27531,  27561,  27591,  27621,
-   27651,  27680,  27709,  27738,
-   27766,  27794,  27822,  27850,
-   27877,  27904,  27931,  27957,
-   27983,  28009,  28035,  28060,
-   28085,  28110,  28134,  28158,
-   28182,  28206,  28229,  28252,
-   28275,  28297,  28319,  28341,
-   28363,  28384,  28405,  28426,
-   28446,  28466,  28486,  28506,
-   28525,  28544,  28562,  28581,
-   28599,  28616,  28634,  28651,
-   28668,  28684,  28701,  28717,
-   28732,  28747,  28763,  28777,
-   28792,  28806,  28820,  28833,
-   28846,  28859,  28872,  28884,
-   28896,  28908,  28919,  28930,
-   28941,  28952,  28962,  28972,
-   28981,  28991,  29000,  29008,
-   29017,  29025,  29032,  29040,
-   29047,  29054,  29060,  29067,
-   29073,  29078,  29083,  29088,
-   29093,  29097,  29101,  29105,
-   29109,  29112,  29115,  29117,
-   29119,  29121,  29123,  29124,
-   29125,  29126,  29126,  29126,
-   29126,  29125,  29125,  29123,
-   29122,  29120,  29118,  29116,
-   29113,  29110,  29106,  29103,
-   29099,  29095,  29090,  29085,
-   29080,  29074,  29069,  29063,
-   29056,  29049,  29042,  29035,
-   29027,  29019,  29011,  29003,
-   28994,  28985,  28975,  28965,
-   28955,  28945,  28934,  28923,
-   28912,  28900,  28888,  28876,
-   28864,  28851,  28838,  28824,
-   28810,  28796,  28782,  28767,
-   28753,  28737,  28722,  28706,
-   28690,  28673,  28657,  28640,
-   28622,  28605,  28587,  28568,
-   28550,  28531,  28512,  28493,
-   28473,  28453,  28433,  28412,
-   28391,  28370,  28349,  28327,
-   28305,  28282,  28260,  28237,
-   28214,  28190,  28166,  28142,
-   28118,  28093,  28068,  28043,
-   28018,  27991,  27962,  27930,
-   27896,  27860,  27821,  27780,
-   27736,  27691,  27643,  27592,
-   27540,  27485,  27428,  27368,
-   27306,  27242,  27176,  27108,
-   27037,  26964,  26890,  26812,
-   26733,  26652,  26568,  26483,
-   26395,  26306,  26214,  26120,
-   26025,  25927,  25827,  25726,
-   25622,  25517,  25410,  25301,
-   25190,  25077,  24963,  24846,
-   24728,  24609,  24487,  24364,
-   24239,  24113,  23985,  23855,
-   23724,  23592,  23457,  23322,
-   23185,  23046,  22906,  22765,
-   22623,  22479,  22333,  22187,
-   22039,  21890,  21740,  21589,
-   21437,  21283,  21129,  20973,
-   20816,  20659,  20500,  20341,
-   20180,  20019,  19857,  19694,
-   19530,  19366,  19201,  19035,
-   18869,  18701,  18534,  18365,
-   18197,  18027,  17857,  17687,
-   17516,  17345,  17173,  17002,
-   16829,  16657,  16484,  16311,
-   16138,  15965,  15791,  15618,
-   15444,  15271,  15097,  14923,
-   14750,  14576,  14403,  14229,
-   14056,  13883,  13710,  13537,
-   13365,  13193,  13021,  12850,
-   12679,  12508,  12338,  12168,
-   11999,  11830,  11662,  11494,
-   11327,  11160,  10994,  10829,
-   10665,  10501,  10337,  10175,
-   10013,   9852,   9692,   9533,
-    9375,   9217,   9060,   8905,
-    8750,   8596,   8443,   8291,
-    8141,   7991,   7842,   7694,
-    7548,   7402,   7258,   7115,
-    6973,   6832,   6692,   6554,
-    6417,   6281,   6146,   6013,
-    5881,   5750,   5621,   5492,
-    5366,   5240,   5116,   4993,
-    4872,   4752,   4634,   4516,
-    4401,   4287,   4174,   4063,
-    3953,   3844,   3737,   3632,
-    3528,   3426,   3325,   3226,
-    3128,   3032,   2937,   2844,
-    2752,   2662,   2573,   2486,
-    2401,   2317,   2234,   2153,
-    2074,   1996,   1920,   1846,
-    1773,   1701,   1631,   1563,
-    1496,   1431,   1367,   1305,
-    1244,   1185,   1128,   1072,
-    1017,    964,    913,    863,
-     814,    767,    722,    678,
-     636,    595,    555,    517,
-     480,    445,    411,    379,
-     348,    319,    290,    264,
-     238,    214,    192,    170,
-     150,    132,    114,     98,
-      83,     70,     57,     46,
-      36,     28,     20,     14,
-       9,      5,      2,      1,
-       1,      0,     13,     25,
-      38,     51,     64,     77,
-      90,    102,    115,    128,
-     141,    154,    167,    180,
-     194,    207,    220,    233,
-     246,    259,    273,    286,
-     299,    312,    326,    339,
-     353,    366,    379,    393,
-     406,    420,    434,    447,
-     461,    474,    488,    502,
-     516,    529,    543,    557,
-     571,    585,    599,    613,
-     627,    641,    655,    669,
-     683,    697,    711,    725,
-     739,    754,    768,    782,
-     797,    811,    825,    840,
-     854,    869,    883,    898,
-     912,    927,    942,    956,
-     971,    986,   1001,   1015,
-    1030,   1045,   1060,   1075,
-    1090,   1105,   1120,   1135,
-    1150,   1166,   1181,   1196,
-    1211,   1227,   1242,   1257,
-    1273,   1288,   1304,   1319,
-    1335,   1350,   1366,   1382,
-    1397,   1413,   1429,   1445,
-    1461,   1477,   1493,   1509,
-    1525,   1541,   1557,   1573,
-    1589,   1605,   1622,   1638,
-    1654,   1671,   1687,   1703,
-    1720,   1737,   1753,   1770,
-    1786,   1803,   1820,   1837,
-    1854,   1870,   1887,   1904,
-    1921,   1938,   1956,   1973,
-    1990,   2007,   2024,   2042,
-    2059,   2077,   2094,   2112,
-    2129,   2147,   2164,   2182,
-    2200,   2218,   2236,   2253,
-    2271,   2289,   2307,   2326,
-    2344,   2362,   2380,   2399,
-    2417,   2435,   2454,   2472,
-    2491,   2509,   2528,   2547,
-    2566,   2584,   2603,   2622,
-    2641,   2660,   2679,   2699,
-    2718,   2737,   2756,   2776,
-    2795,   2815,   2834,   2854,
-    2874,   2893,   2913,   2933,
-    2953,   2973,   2993,   3013,
-    3033,   3053,   3074,   3094,
-    3114,   3135,   3155,   3176,
-    3197,   3218,   3238,   3259,
-    3280,   3301,   3322,   3343,
-    3365,   3386,   3407,   3429,
-    3450,   3472,   3493,   3515,
-    3537,   3559,   3580,   3602,
-    3625,   3647,   3669,   3691,
-    3714,   3736,   3759,   3781,
-    3804,   3827,   3849,   3872,
-    3895,   3918,   3942,   3965,
-    3988,   4011,   4035,   4059,
-    4082,   4106,   4130,   4154,
-    4178,   4202,   4226,   4250,
-    4275,   4299,   4324,   4348,
-    4373,   4398,   4423,   4448,
-    4473,   4498,   4523,   4549,
-    4574,   4600,   4626,   4651,
-    4677,   4703,   4729,   4756,
-    4782,   4808,   4835,   4861,
-    4888,   4915,   4942,   4969,
-    4996,   5024,   5051,   5079,
-    5106,   5134,   5162,   5190,
-    5218,   5246,   5275,   5303,
-    5332,   5360,   5389,   5418,
-    5447,   5477,   5506,   5536,
-    5565,   5595,   5625,   5655,
-    5685,   5716,   5746,   5777,
-    5807,   5838,   5869,   5901,
-    5932,   5963,   5995,   6027,
-    6059,   6091,   6123,   6156,
-    6188,   6221,   6254,   6287,
-    6320,   6354,   6387,   6421,
-    6455,   6489,   6524,   6558,
-    6593,   6628,   6663,   6698,
-    6733,   6769,   6805,   6841,
-    6877,   6913,   6950,   6987,
-    7024,   7061,   7099,   7136,
-    7174,   7212,   7251,   7289,
-    7328,   7367,   7406,   7446,
-    7485,   7525,   7565,   7606,
-    7647,   7688,   7729,   7770,
-    7812,   7854,   7896,   7939,
-    7982,   8025,   8068,   8112,
-    8156,   8200,   8245,   8290,
-    8335,   8380,   8426,   8472,
-    8519,   8566,   8613,   8660,
-    8708,   8756,   8805,   8854,
-    8903,   8953,   9003,   9053,
-    9104,   9155,   9207,   9259,
-    9311,   9364,   9417,   9471,
-    9525,   9580,   9635,   9690,
-    9746,   9803,   9860,   9917,
-    9975,  10034,  10093,  10152,
-   10212,  10273,  10334,  10396,
-   10459,  10522,  10585,  10649,
-   10714,  10780,  10846,  10913,
-   10980,  11049,  11118,  11187,
-   11258,  11329,  11401,  11474,
-   11548,  11622,  11697,  11773,
-   11851,  11929,  12008,  12087,
-   12168,  12250,  12333,  12417,
-   12502,  12589,  12676,  12764,
-   12854,  12945,  13038,  13131,
-   13226,  13322,  13420,  13520,
-   13620,  13723,  13827,  13932,
-   14040,  14149,  14260,  14373,
-   14488,  14605,  14724,  14846,
-   14969,  15095,  15224,  15355,
-   15489,  15625,  15764,  15907,
-   16053,  16201,  16354,  16510,
-   16670,  16833,  17001,  17174,
-   17351,  17533,  17720,  17913,
-   18111,  18316,  18528,  18746,
-   18972,  19206,  19449,  19701,
-   19963,  20236,  20521,  20818,
-   21131,  21458,  21803,  22167,
-   22552,  22962,  23399,  23867,
-   24371,  24917,  25513,  26168,
-   26896,  27716,  28653,  29746,
-   31059,  32767,  32767,  32754,
-   32742,  32729,  32716,  32703,
-   32690,  32677,  32665,  32652,
-   32639,  32626,  32613,  32600,
-   32587,  32573,  32560,  32547,
-   32534,  32521,  32508,  32494,
-   32481,  32468,  32455,  32441,
-   32428,  32414,  32401,  32388,
-   32374,  32361,  32347,  32333,
-   32320,  32306,  32293,  32279,
-   32265,  32251,  32238,  32224,
-   32210,  32196,  32182,  32168,
-   32154,  32140,  32126,  32112,
-   32098,  32084,  32070,  32056,
-   32042,  32028,  32013,  31999,
-   31985,  31970,  31956,  31942,
-   31927,  31913,  31898,  31884,
-   31869,  31855,  31840,  31825,
-   31811,  31796,  31781,  31766,
-   31752,  31737,  31722,  31707,
-   31692,  31677,  31662,  31647,
-   31632,  31617,  31601,  31586,
-   31571,  31556,  31540,  31525,
-   31510,  31494,  31479,  31463,
-   31448,  31432,  31417,  31401,
-   31385,  31370,  31354,  31338,
-   31322,  31306,  31290,  31274,
-   31258,  31242,  31226,  31210,
-   31194,  31178,  31162,  31145,
-   31129,  31113,  31096,  31080,
-   31064,  31047,  31030,  31014,
-   30997,  30981,  30964,  30947,
-   30930,  30913,  30897,  30880,
-   30863,  30846,  30829,  30811,
-   30794,  30777,  30760,  30743,
-   30725,  30708,  30690,  30673,
-   30655,  30638,  30620,  30603,
-   30585,  30567,  30549,  30531,
-   30514,  30496,  30478,  30460,
-   30441,  30423,  30405,  30387,
-   30368,  30350,  30332,  30313,
-   30295,  30276,  30258,  30239,
-   30220,  30201,  30183,  30164,
-   30145,  30126,  30107,  30088,
-   30068,  30049,  30030,  30011,
-   29991,  29972,  29952,  29933,
-   29913,  29893,  29874,  29854,
-   29834,  29814,  29794,  29774,
-   29754,  29734,  29714,  29693,
-   29673,  29653,  29632,  29612,
-   29591,  29570,  29549,  29529,
-   29508,  29487,  29466,  29445,
-   29424,  29402,  29381,  29360,
-   29338,  29317,  29295,  29274,
-   29252,  29230,  29208,  29187,
-   29165,  29142,  29120,  29098,
-   29076,  29053,  29031,  29008,
-   28986,  28963,  28940,  28918,
-   28895,  28872,  28849,  28825,
-   28802,  28779,  28756,  28732,
-   28708,  28685,  28661,  28637,
-   28613,  28589,  28565,  28541,
-   28517,  28492,  28468,  28443,
-   28419,  28394,  28369,  28344,
-   28319,  28294,  28269,  28244,
-   28218,  28193,  28167,  28141,
-   28116,  28090,  28064,  28038,
-   28011,  27985,  27959,  27932,
-   27906,  27879,  27852,  27825,
-   27798,  27771,  27743,  27716,
-   27688,  27661,  27633,  27605,
-   27577,  27549,  27521,  27492,
-   27464,  27435,  27407,  27378,
-   27349,  27320,  27290,  27261,
-   27231,  27202,  27172,  27142,
-   27112,  27082,  27051,  27021,
-   26990,  26960,  26929,  26898,
-   26866,  26835,  26804,  26772,
-   26740,  26708,  26676,  26644,
-   26611,  26579,  26546,  26513,
-   26480,  26447,  26413,  26380,
-   26346,  26312,  26278,  26243,
-   26209,  26174,  26139,  26104,
-   26069,  26034,  25998,  25962,
-   25926,  25890,  25854,  25817,
-   25780,  25743,  25706,  25668,
-   25631,  25593,  25555,  25516,
-   25478,  25439,  25400,  25361,
-   25321,  25282,  25242,  25202,
-   25161,  25120,  25079,  25038,
-   24997,  24955,  24913,  24871,
-   24828,  24785,  24742,  24699,
-   24655,  24611,  24567,  24522,
-   24477,  24432,  24387,  24341,
-   24295,  24248,  24201,  24154,
-   24107,  24059,  24011,  23962,
-   23913,  23864,  23814,  23764,
-   23714,  23663,  23612,  23560,
-   23508,  23456,  23403,  23350,
-   23296,  23242,  23187,  23132,
-   23077,  23021,  22964,  22907,
-   22850,  22792,  22733,  22674,
-   22615,  22555,  22494,  22433,
-   22371,  22308,  22245,  22182,
-   22118,  22053,  21987,  21921,
-   21854,  21787,  21718,  21649,
-   21580,  21509,  21438,  21366,
-   21293,  21219,  21145,  21070,
-   20994,  20916,  20838,  20759,
-   20680,  20599,  20517,  20434,
-   20350,  20265,  20178,  20091,
-   20003,  19913,  19822,  19729,
-   19636,  19541,  19445,  19347,
-   19247,  19147,  19044,  18940,
-   18835,  18727,  18618,  18507,
-   18394,  18279,  18162,  18043,
-   17921,  17798,  17672,  17543,
-   17412,  17278,  17142,  17003,
-   16860,  16714,  16566,  16413,
-   16257,  16097,  15934,  15766,
-   15593,  15416,  15234,  15047,
-   14854,  14656,  14451,  14239,
-   14021,  13795,  13561,  13318,
-   13066,  12804,  12531,  12246,
-   11949,  11636,  11309,  10964,
-   10600,  10215,   9805,   9368,
-    8900,   8396,   7850,   7254,
-    6599,   5871,   5051,   4114,
-    3021,   1708,      0,     13,
-      25,     38,     51,     64,
-      77,     90,    102,    115,
-     128,    141,    154,    167,
-     180,    194,    207,    220,
-     233,    246,    259,    273,
-     286,    299,    312,    326,
-     339,    353,    366,    379,
-     393,    406,    420,    434,
-     447,    461,    474,    488,
-     502,    516,    529,    543,
-     557,    571,    585,    599,
-     613,    627,    641,    655,
-     669,    683,    697,    711,
-     725,    739,    754,    768,
-     782,    797,    811,    825,
-     840,    854,    869,    883,
-     898,    912,    927,    942,
-     956,    971,    986,   1001,
-    1015,   1030,   1045,   1060,
-    1075,   1090,   1105,   1120,
-    1135,   1150,   1166,   1181,
-    1196,   1211,   1227,   1242,
-    1257,   1273,   1288,   1304,
-    1319,   1335,   1350,   1366,
-    1382,   1397,   1413,   1429,
-    1445,   1461,   1477,   1493,
-    1509,   1525,   1541,   1557,
-    1573,   1589,   1605,   1622,
-    1638,   1654,   1671,   1687,
-    1703,   1720,   1737,   1753,
-    1770,   1786,   1803,   1820,
-    1837,   1854,   1870,   1887,
-    1904,   1921,   1938,   1956,
-    1973,   1990,   2007,   2024,
-    2042,   2059,   2077,   2094,
-    2112,   2129,   2147,   2164,
-    2182,   2200,   2218,   2236,
-    2253,   2271,   2289,   2307,
-    2326,   2344,   2362,   2380,
-    2399,   2417,   2435,   2454,
-    2472,   2491,   2509,   2528,
-    2547,   2566,   2584,   2603,
-    2622,   2641,   2660,   2679,
-    2699,   2718,   2737,   2756,
-    2776,   2795,   2815,   2834,
-    2854,   2874,   2893,   2913,
-    2933,   2953,   2973,   2993,
-    3013,   3033,   3053,   3074,
-    3094,   3114,   3135,   3155,
-    3176,   3197,   3218,   3238,
-    3259,   3280,   3301,   3322,
-    3343,   3365,   3386,   3407,
-    3429,   3450,   3472,   3493,
-    3515,   3537,   3559,   3580,
-    3602,   3625,   3647,   3669,
-    3691,   3714,   3736,   3759,
-    3781,   3804,   3827,   3849,
-    3872,   3895,   3918,   3942,
-    3965,   3988,   4011,   4035,
-    4059,   4082,   4106,   4130,
-    4154,   4178,   4202,   4226,
-    4250,   4275,   4299,   4324,
-    4348,   4373,   4398,   4423,
-    4448,   4473,   4498,   4523,
-    4549,   4574,   4600,   4626,
-    4651,   4677,   4703,   4729,
-    4756,   4782,   4808,   4835,
-    4861,   4888,   4915,   4942,
-    4969,   4996,   5024,   5051,
-    5079,   5106,   5134,   5162,
-    5190,   5218,   5246,   5275,
-    5303,   5332,   5360,   5389,
-    5418,   5447,   5477,   5506,
-    5536,   5565,   5595,   5625,
-    5655,   5685,   5716,   5746,
-    5777,   5807,   5838,   5869,
-    5901,   5932,   5963,   5995,
-    6027,   6059,   6091,   6123,
-    6156,   6188,   6221,   6254,
-    6287,   6320,   6354,   6387,
-    6421,   6455,   6489,   6524,
-    6558,   6593,   6628,   6663,
-    6698,   6733,   6769,   6805,
-    6841,   6877,   6913,   6950,
-    6987,   7024,   7061,   7099,
-    7136,   7174,   7212,   7251,
-    7289,   7328,   7367,   7406,
-    7446,   7485,   7525,   7565,
-    7606,   7647,   7688,   7729,
-    7770,   7812,   7854,   7896,
-    7939,   7982,   8025,   8068,
-    8112,   8156,   8200,   8245,
-    8290,   8335,   8380,   8426,
-    8472,   8519,   8566,   8613,
-    8660,   8708,   8756,   8805,
-    8854,   8903,   8953,   9003,
-    9053,   9104,   9155,   9207,
-    9259,   9311,   9364,   9417,
-    9471,   9525,   9580,   9635,
-    9690,   9746,   9803,   9860,
-    9917,   9975,  10034,  10093,
-   10152,  10212,  10273,  10334,
-   10396,  10459,  10522,  10585,
-   10649,  10714,  10780,  10846,
-   10913,  10980,  11049,  11118,
-   11187,  11258,  11329,  11401,
-   11474,  11548,  11622,  11697,
-   11773,  11851,  11929,  12008,
-   12087,  12168,  12250,  12333,
-   12417,  12502,  12589,  12676,
-   12764,  12854,  12945,  13038,
-   13131,  13226,  13322,  13420,
-   13520,  13620,  13723,  13827,
-   13932,  14040,  14149,  14260,
-   14373,  14488,  14605,  14724,
-   14846,  14969,  15095,  15224,
-   15355,  15489,  15625,  15764,
-   15907,  16053,  16201,  16354,
-   16510,  16670,  16833,  17001,
-   17174,  17351,  17533,  17720,
-   17913,  18111,  18316,  18528,
-   18746,  18972,  19206,  19449,
-   19701,  19963,  20236,  20521,
-   20818,  21131,  21458,  21803,
-   22167,  22552,  22962,  23399,
-   23867,  24371,  24917,  25513,
-   26168,  26896,  27716,  28653,
-   29746,  31059,  32767,  31059,
-   29746,  28653,  27716,  26896,
-   26168,  25513,  24917,  24371,
-   23867,  23399,  22962,  22552,
-   22167,  21803,  21458,  21131,
-   20818,  20521,  20236,  19963,
-   19701,  19449,  19206,  18972,
-   18746,  18528,  18316,  18111,
-   17913,  17720,  17533,  17351,
-   17174,  17001,  16833,  16670,
-   16510,  16354,  16201,  16053,
-   15907,  15764,  15625,  15489,
-   15355,  15224,  15095,  14969,
-   14846,  14724,  14605,  14488,
-   14373,  14260,  14149,  14040,
-   13932,  13827,  13723,  13620,
-   13520,  13420,  13322,  13226,
-   13131,  13038,  12945,  12854,
-   12764,  12676,  12589,  12502,
-   12417,  12333,  12250,  12168,
-   12087,  12008,  11929,  11851,
-   11773,  11697,  11622,  11548,
-   11474,  11401,  11329,  11258,
-   11187,  11118,  11049,  10980,
-   10913,  10846,  10780,  10714,
-   10649,  10585,  10522,  10459,
-   10396,  10334,  10273,  10212,
-   10152,  10093,  10034,   9975,
-    9917,   9860,   9803,   9746,
-    9690,   9635,   9580,   9525,
-    9471,   9417,   9364,   9311,
-    9259,   9207,   9155,   9104,
-    9053,   9003,   8953,   8903,
-    8854,   8805,   8756,   8708,
-    8660,   8613,   8566,   8519,
-    8472,   8426,   8380,   8335,
-    8290,   8245,   8200,   8156,
-    8112,   8068,   8025,   7982,
-    7939,   7896,   7854,   7812,
-    7770,   7729,   7688,   7647,
-    7606,   7565,   7525,   7485,
-    7446,   7406,   7367,   7328,
-    7289,   7251,   7212,   7174,
-    7136,   7099,   7061,   7024,
-    6987,   6950,   6913,   6877,
-    6841,   6805,   6769,   6733,
-    6698,   6663,   6628,   6593,
-    6558,   6524,   6489,   6455,
-    6421,   6387,   6354,   6320,
-    6287,   6254,   6221,   6188,
-    6156,   6123,   6091,   6059,
-    6027,   5995,   5963,   5932,
-    5901,   5869,   5838,   5807,
-    5777,   5746,   5716,   5685,
-    5655,   5625,   5595,   5565,
-    5536,   5506,   5477,   5447,
-    5418,   5389,   5360,   5332,
-    5303,   5275,   5246,   5218,
-    5190,   5162,   5134,   5106,
-    5079,   5051,   5024,   4996,
-    4969,   4942,   4915,   4888,
-    4861,   4835,   4808,   4782,
-    4756,   4729,   4703,   4677,
-    4651,   4626,   4600,   4574,
-    4549,   4523,   4498,   4473,
-    4448,   4423,   4398,   4373,
-    4348,   4324,   4299,   4275,
-    4250,   4226,   4202,   4178,
-    4154,   4130,   4106,   4082,
-    4059,   4035,   4011,   3988,
-    3965,   3942,   3918,   3895,
-    3872,   3849,   3827,   3804,
-    3781,   3759,   3736,   3714,
-    3691,   3669,   3647,   3625,
-    3602,   3580,   3559,   3537,
-    3515,   3493,   3472,   3450,
-    3429,   3407,   3386,   3365,
-    3343,   3322,   3301,   3280,
-    3259,   3238,   3218,   3197,
-    3176,   3155,   3135,   3114,
-    3094,   3074,   3053,   3033,
-    3013,   2993,   2973,   2953,
-    2933,   2913,   2893,   2874,
-    2854,   2834,   2815,   2795,
-    2776,   2756,   2737,   2718,
-    2699,   2679,   2660,   2641,
-    2622,   2603,   2584,   2566,
-    2547,   2528,   2509,   2491,
-    2472,   2454,   2435,   2417,
-    2399,   2380,   2362,   2344,
-    2326,   2307,   2289,   2271,
-    2253,   2236,   2218,   2200,
-    2182,   2164,   2147,   2129,
-    2112,   2094,   2077,   2059,
-    2042,   2024,   2007,   1990,
-    1973,   1956,   1938,   1921,
-    1904,   1887,   1870,   1854,
-    1837,   1820,   1803,   1786,
-    1770,   1753,   1737,   1720,
-    1703,   1687,   1671,   1654,
-    1638,   1622,   1605,   1589,
-    1573,   1557,   1541,   1525,
-    1509,   1493,   1477,   1461,
-    1445,   1429,   1413,   1397,
-    1382,   1366,   1350,   1335,
-    1319,   1304,   1288,   1273,
-    1257,   1242,   1227,   1211,
-    1196,   1181,   1166,   1150,
-    1135,   1120,   1105,   1090,
-    1075,   1060,   1045,   1030,
-    1015,   1001,    986,    971,
-     956,    942,    927,    912,
-     898,    883,    869,    854,
-     840,    825,    811,    797,
-     782,    768,    754,    739,
-     725,    711,    697,    683,
-     669,    655,    641,    627,
-     613,    599,    585,    571,
-     557,    543,    529,    516,
-     502,    488,    474,    461,
-     447,    434,    420,    406,
-     393,    379,    366,    353,
-     339,    326,    312,    299,
-     286,    273,    259,    246,
-     233,    220,    207,    194,
-     180,    167,    154,    141,
-     128,    115,    102,     90,
-      77,     64,     51,     38,
-      25,     13,      0,      0,
-     922,   1305,   1598,   1846,
-    2065,   2263,   2445,   2614,
-    2774,   2925,   3069,   3206,
-    3338,   3465,   3588,   3707,
-    3822,   3935,   4044,   4150,
-    4254,   4356,   4455,   4552,
-    4648,   4741,   4833,   4924,
-    5013,   5100,   5186,   5271,
-    5354,   5437,   5518,   5598,
-    5678,   5756,   5833,   5909,
-    5985,   6059,   6133,   6206,
-    6279,   6350,   6421,   6491,
-    6561,   6630,   6698,   6766,
-    6833,   6900,   6966,   7031,
-    7096,   7161,   7225,   7288,
-    7351,   7414,   7476,   7538,
-    7600,   7661,   7721,   7781,
-    7841,   7901,   7960,   8019,
-    8077,   8135,   8193,   8250,
-    8307,   8364,   8421,   8477,
-    8533,   8589,   8644,   8699,
-    8754,   8809,   8863,   8917,
-    8971,   9025,   9078,   9131,
-    9184,   9237,   9290,   9342,
-    9394,   9446,   9497,   9549,
-    9600,   9651,   9702,   9753,
-    9804,   9854,   9904,   9954,
-   10004,  10054,  10103,  10153,
-   10202,  10251,  10300,  10348,
-   10397,  10445,  10494,  10542,
-   10590,  10638,  10686,  10733,
-   10781,  10828,  10875,  10922,
-   10969,  11016,  11063,  11110,
-   11156,  11202,  11249,  11295,
-   11341,  11387,  11433,  11479,
-   11524,  11570,  11615,  11661,
-   11706,  11751,  11796,  11841,
-   11886,  11931,  11975,  12020,
-   12065,  12109,  12154,  12198,
-   12242,  12286,  12330,  12374,
-   12418,  12462,  12506,  12549,
-   12593,  12637,  12680,  12724,
-   12767,  12810,  12853,  12897,
-   12940,  12983,  13026,  13069,
-   13111,  13154,  13197,  13240,
-   13282,  13325,  13367,  13410,
-   13452,  13495,  13537,  13579,
-   13622,  13664,  13706,  13748,
-   13790,  13832,  13874,  13916,
-   13958,  14000,  14042,  14083,
-   14125,  14167,  14208,  14250,
-   14292,  14333,  14375,  14416,
-   14458,  14499,  14541,  14582,
-   14623,  14665,  14706,  14747,
-   14788,  14830,  14871,  14912,
-   14953,  14994,  15035,  15076,
-   15117,  15158,  15199,  15240,
-   15281,  15322,  15363,  15404,
-   15445,  15486,  15527,  15568,
-   15609,  15650,  15690,  15731,
-   15772,  15813,  15854,  15894,
-   15935,  15976,  16017,  16058,
-   16098,  16139,  16180,  16221,
-   16261,  16302,  16343,  16384,
-   16424,  16465,  16506,  16546,
-   16587,  16628,  16669,  16709,
-   16750,  16791,  16832,  16873,
-   16913,  16954,  16995,  17036,
-   17077,  17117,  17158,  17199,
-   17240,  17281,  17322,  17363,
-   17404,  17445,  17486,  17527,
-   17568,  17609,  17650,  17691,
-   17732,  17773,  17814,  17855,
-   17896,  17937,  17979,  18020,
-   18061,  18102,  18144,  18185,
-   18226,  18268,  18309,  18351,
-   18392,  18434,  18475,  18517,
-   18559,  18600,  18642,  18684,
-   18725,  18767,  18809,  18851,
-   18893,  18935,  18977,  19019,
-   19061,  19103,  19145,  19188,
-   19230,  19272,  19315,  19357,
-   19400,  19442,  19485,  19527,
-   19570,  19613,  19656,  19698,
-   19741,  19784,  19827,  19870,
-   19914,  19957,  20000,  20043,
-   20087,  20130,  20174,  20218,
-   20261,  20305,  20349,  20393,
-   20437,  20481,  20525,  20569,
-   20613,  20658,  20702,  20747,
-   20792,  20836,  20881,  20926,
-   20971,  21016,  21061,  21106,
-   21152,  21197,  21243,  21288,
-   21334,  21380,  21426,  21472,
-   21518,  21565,  21611,  21657,
-   21704,  21751,  21798,  21845,
-   21892,  21939,  21986,  22034,
-   22081,  22129,  22177,  22225,
-   22273,  22322,  22370,  22419,
-   22467,  22516,  22565,  22614,
-   22664,  22713,  22763,  22813,
-   22863,  22913,  22963,  23014,
-   23065,  23116,  23167,  23218,
-   23270,  23321,  23373,  23425,
-   23477,  23530,  23583,  23636,
-   23689,  23742,  23796,  23850,
-   23904,  23958,  24013,  24068,
-   24123,  24178,  24234,  24290,
-   24346,  24403,  24460,  24517,
-   24574,  24632,  24690,  24748,
-   24807,  24866,  24926,  24986,
-   25046,  25106,  25167,  25229,
-   25291,  25353,  25416,  25479,
-   25542,  25606,  25671,  25736,
-   25801,  25867,  25934,  26001,
-   26069,  26137,  26206,  26276,
-   26346,  26417,  26488,  26561,
-   26634,  26708,  26782,  26858,
-   26934,  27011,  27089,  27169,
-   27249,  27330,  27413,  27496,
-   27581,  27667,  27754,  27843,
-   27934,  28026,  28119,  28215,
-   28312,  28411,  28513,  28617,
-   28723,  28832,  28945,  29060,
-   29179,  29302,  29429,  29561,
-   29698,  29842,  29993,  30153,
-   30322,  30504,  30702,  30921,
-   31169,  31462,  31845,  32767,
-   32767,  31845,  31462,  31169,
-   30921,  30702,  30504,  30322,
-   30153,  29993,  29842,  29698,
-   29561,  29429,  29302,  29179,
-   29060,  28945,  28832,  28723,
-   28617,  28513,  28411,  28312,
-   28215,  28119,  28026,  27934,
-   27843,  27754,  27667,  27581,
-   27496,  27413,  27330,  27249,
-   27169,  27089,  27011,  26934,
-   26858,  26782,  26708,  26634,
-   26561,  26488,  26417,  26346,
-   26276,  26206,  26137,  26069,
-   26001,  25934,  25867,  25801,
-   25736,  25671,  25606,  25542,
-   25479,  25416,  25353,  25291,
-   25229,  25167,  25106,  25046,
-   24986,  24926,  24866,  24807,
-   24748,  24690,  24632,  24574,
-   24517,  24460,  24403,  24346,
-   24290,  24234,  24178,  24123,
-   24068,  24013,  23958,  23904,
-   23850,  23796,  23742,  23689,
-   23636,  23583,  23530,  23477,
-   23425,  23373,  23321,  23270,
-   23218,  23167,  23116,  23065,
-   23014,  22963,  22913,  22863,
-   22813,  22763,  22713,  22664,
-   22614,  22565,  22516,  22467,
-   22419,  22370,  22322,  22273,
-   22225,  22177,  22129,  22081,
-   22034,  21986,  21939,  21892,
-   21845,  21798,  21751,  21704,
-   21657,  21611,  21565,  21518,
-   21472,  21426,  21380,  21334,
-   21288,  21243,  21197,  21152,
-   21106,  21061,  21016,  20971,
-   20926,  20881,  20836,  20792,
-   20747,  20702,  20658,  20613,
-   20569,  20525,  20481,  20437,
-   20393,  20349,  20305,  20261,
-   20218,  20174,  20130,  20087,
-   20043,  20000,  19957,  19914,
-   19870,  19827,  19784,  19741,
-   19698,  19656,  19613,  19570,
-   19527,  19485,  19442,  19400,
-   19357,  19315,  19272,  19230,
-   19188,  19145,  19103,  19061,
-   19019,  18977,  18935,  18893,
-   18851,  18809,  18767,  18725,
-   18684,  18642,  18600,  18559,
-   18517,  18475,  18434,  18392,
-   18351,  18309,  18268,  18226,
-   18185,  18144,  18102,  18061,
-   18020,  17979,  17937,  17896,
-   17855,  17814,  17773,  17732,
-   17691,  17650,  17609,  17568,
-   17527,  17486,  17445,  17404,
-   17363,  17322,  17281,  17240,
-   17199,  17158,  17117,  17077,
-   17036,  16995,  16954,  16913,
-   16873,  16832,  16791,  16750,
-   16709,  16669,  16628,  16587,
-   16546,  16506,  16465,  16424,
-   16384,  16343,  16302,  16261,
-   16221,  16180,  16139,  16098,
-   16058,  16017,  15976,  15935,
-   15894,  15854,  15813,  15772,
-   15731,  15690,  15650,  15609,
-   15568,  15527,  15486,  15445,
-   15404,  15363,  15322,  15281,
-   15240,  15199,  15158,  15117,
-   15076,  15035,  14994,  14953,
-   14912,  14871,  14830,  14788,
-   14747,  14706,  14665,  14623,
-   14582,  14541,  14499,  14458,
-   14416,  14375,  14333,  14292,
-   14250,  14208,  14167,  14125,
-   14083,  14042,  14000,  13958,
-   13916,  13874,  13832,  13790,
-   13748,  13706,  13664,  13622,
-   13579,  13537,  13495,  13452,
-   13410,  13367,  13325,  13282,
-   13240,  13197,  13154,  13111,
-   13069,  13026,  12983,  12940,
-   12897,  12853,  12810,  12767,
-   12724,  12680,  12637,  12593,
-   12549,  12506,  12462,  12418,
-   12374,  12330,  12286,  12242,
-   12198,  12154,  12109,  12065,
-   12020,  11975,  11931,  11886,
-   11841,  11796,  11751,  11706,
-   11661,  11615,  11570,  11524,
-   11479,  11433,  11387,  11341,
-   11295,  11249,  11202,  11156,
-   11110,  11063,  11016,  10969,
-   10922,  10875,  10828,  10781,
-   10733,  10686,  10638,  10590,
-   10542,  10494,  10445,  10397,
-   10348,  10300,  10251,  10202,
-   10153,  10103,  10054,  10004,
-    9954,   9904,   9854,   9804,
-    9753,   9702,   9651,   9600,
-    9549,   9497,   9446,   9394,
-    9342,   9290,   9237,   9184,
-    9131,   9078,   9025,   8971,
-    8917,   8863,   8809,   8754,
-    8699,   8644,   8589,   8533,
-    8477,   8421,   8364,   8307,
-    8250,   8193,   8135,   8077,
-    8019,   7960,   7901,   7841,
-    7781,   7721,   7661,   7600,
-    7538,   7476,   7414,   7351,
-    7288,   7225,   7161,   7096,
-    7031,   6966,   6900,   6833,
-    6766,   6698,   6630,   6561,
-    6491,   6421,   6350,   6279,
-    6206,   6133,   6059,   5985,
-    5909,   5833,   5756,   5678,
-    5598,   5518,   5437,   5354,
-    5271,   5186,   5100,   5013,
-    4924,   4833,   4741,   4648,
-    4552,   4455,   4356,   4254,
-    4150,   4044,   3935,   3822,
-    3707,   3588,   3465,   3338,
-    3206,   3069,   2925,   2774,
-    2614,   2445,   2263,   2065,
-    1846,   1598,   1305,    922,
-       0,     64,    128,    192,
-     256,    320,    384,    448,
-     512,    576,    640,    704,
-     768,    832,    896,    960,
-    1024,   1088,   1152,   1216,
-    1280,   1344,   1408,   1472,
-    1536,   1600,   1664,   1728,
-    1792,   1856,   1920,   1984,
-    2048,   2112,   2176,   2240,
-    2304,   2368,   2432,   2496,
-    2560,   2624,   2688,   2752,
-    2816,   2880,   2944,   3008,
-    3072,   3136,   3200,   3264,
-    3328,   3392,   3456,   3520,
-    3584,   3648,   3712,   3776,
-    3840,   3904,   3968,   4032,
-    4096,   4160,   4224,   4288,
-    4352,   4416,   4480,   4544,
-    4608,   4672,   4736,   4800,
-    4864,   4928,   4992,   5056,
-    5120,   5184,   5248,   5312,
-    5376,   5440,   5504,   5568,
-    5632,   5696,   5760,   5824,
-    5888,   5952,   6016,   6080,
-    6144,   6208,   6272,   6336,
-    6400,   6464,   6528,   6592,
-    6656,   6720,   6784,   6848,
-    6912,   6976,   7040,   7104,
-    7168,   7232,   7296,   7360,
-    7424,   7488,   7552,   7616,
-    7680,   7744,   7808,   7872,
-    7936,   8000,   8064,   8128,
-    8192,   8256,   8320,   8384,
-    8448,   8512,   8576,   8640,
-    8704,   8768,   8832,   8896,
-    8960,   9024,   9088,   9152,
-    9216,   9280,   9344,   9408,
-    9472,   9536,   9600,   9664,
-    9728,   9792,   9856,   9920,
-    9984,  10048,  10112,  10176,
-   10240,  10304,  10368,  10432,
-   10496,  10560,  10624,  10688,
-   10752,  10816,  10880,  10944,
-   11008,  11072,  11136,  11200,
-   11264,  11328,  11392,  11456,
-   11520,  11584,  11648,  11712,
-   11776,  11840,  11904,  11968,
-   12032,  12096,  12160,  12224,
-   12288,  12352,  12416,  12480,
-   12544,  12608,  12672,  12736,
-   12800,  12864,  12928,  12992,
-   13056,  13120,  13184,  13248,
-   13312,  13376,  13440,  13504,
-   13568,  13632,  13696,  13760,
-   13824,  13888,  13952,  14016,
-   14080,  14144,  14208,  14272,
-   14336,  14400,  14464,  14528,
-   14592,  14656,  14720,  14784,
-   14848,  14912,  14976,  15040,
-   15104,  15168,  15232,  15296,
-   15360,  15424,  15488,  15552,
-   15616,  15680,  15744,  15808,
-   15872,  15936,  16000,  16064,
-   16128,  16192,  16256,  16320,
-   16384,  16447,  16511,  16575,
-   16639,  16703,  16767,  16831,
-   16895,  16959,  17023,  17087,
-   17151,  17215,  17279,  17343,
-   17407,  17471,  17535,  17599,
-   17663,  17727,  17791,  17855,
-   17919,  17983,  18047,  18111,
-   18175,  18239,  18303,  18367,
-   18431,  18495,  18559,  18623,
-   18687,  18751,  18815,  18879,
-   18943,  19007,  19071,  19135,
-   19199,  19263,  19327,  19391,
-   19455,  19519,  19583,  19647,
-   19711,  19775,  19839,  19903,
-   19967,  20031,  20095,  20159,
-   20223,  20287,  20351,  20415,
-   20479,  20543,  20607,  20671,
-   20735,  20799,  20863,  20927,
-   20991,  21055,  21119,  21183,
-   21247,  21311,  21375,  21439,
-   21503,  21567,  21631,  21695,
-   21759,  21823,  21887,  21951,
-   22015,  22079,  22143,  22207,
-   22271,  22335,  22399,  22463,
-   22527,  22591,  22655,  22719,
-   22783,  22847,  22911,  22975,
-   23039,  23103,  23167,  23231,
-   23295,  23359,  23423,  23487,
-   23551,  23615,  23679,  23743,
-   23807,  23871,  23935,  23999,
-   24063,  24127,  24191,  24255,
-   24319,  24383,  24447,  24511,
-   24575,  24639,  24703,  24767,
-   24831,  24895,  24959,  25023,
-   25087,  25151,  25215,  25279,
-   25343,  25407,  25471,  25535,
-   25599,  25663,  25727,  25791,
-   25855,  25919,  25983,  26047,
-   26111,  26175,  26239,  26303,
-   26367,  26431,  26495,  26559,
-   26623,  26687,  26751,  26815,
-   26879,  26943,  27007,  27071,
-   27135,  27199,  27263,  27327,
-   27391,  27455,  27519,  27583,
-   27647,  27711,  27775,  27839,
-   27903,  27967,  28031,  28095,
-   28159,  28223,  28287,  28351,
-   28415,  28479,  28543,  28607,
-   28671,  28735,  28799,  28863,
-   28927,  28991,  29055,  29119,
-   29183,  29247,  29311,  29375,
-   29439,  29503,  29567,  29631,
-   29695,  29759,  29823,  29887,
-   29951,  30015,  30079,  30143,
-   30207,  30271,  30335,  30399,
-   30463,  30527,  30591,  30655,
-   30719,  30783,  30847,  30911,
-   30975,  31039,  31103,  31167,
-   31231,  31295,  31359,  31423,
-   31487,  31551,  31615,  31679,
-   31743,  31807,  31871,  31935,
-   31999,  32063,  32127,  32191,
-   32255,  32319,  32383,  32447,
-   32511,  32575,  32639,  32703,
-   32767,  32767,  32703,  32639,
-   32575,  32511,  32447,  32383,
-   32319,  32255,  32191,  32127,
-   32063,  31999,  31935,  31871,
-   31807,  31743,  31679,  31615,
-   31551,  31487,  31423,  31359,
-   31295,  31231,  31167,  31103,
-   31039,  30975,  30911,  30847,
-   30783,  30719,  30655,  30591,
-   30527,  30463,  30399,  30335,
-   30271,  30207,  30143,  30079,
-   30015,  29951,  29887,  29823,
-   29759,  29695,  29631,  29567,
-   29503,  29439,  29375,  29311,
-   29247,  29183,  29119,  29055,
-   28991,  28927,  28863,  28799,
-   28735,  28671,  28607,  28543,
-   28479,  28415,  28351,  28287,
-   28223,  28159,  28095,  28031,
-   27967,  27903,  27839,  27775,
-   27711,  27647,  27583,  27519,
-   27455,  27391,  27327,  27263,
-   27199,  27135,  27071,  27007,
-   26943,  26879,  26815,  26751,
-   26687,  26623,  26559,  26495,
-   26431,  26367,  26303,  26239,
-   26175,  26111,  26047,  25983,
-   25919,  25855,  25791,  25727,
-   25663,  25599,  25535,  25471,
-   25407,  25343,  25279,  25215,
-   25151,  25087,  25023,  24959,
-   24895,  24831,  24767,  24703,
-   24639,  24575,  24511,  24447,
-   24383,  24319,  24255,  24191,
-   24127,  24063,  23999,  23935,
-   23871,  23807,  23743,  23679,
-   23615,  23551,  23487,  23423,
-   23359,  23295,  23231,  23167,
-   23103,  23039,  22975,  22911,
-   22847,  22783,  22719,  22655,
-   22591,  22527,  22463,  22399,
-   22335,  22271,  22207,  22143,
-   22079,  22015,  21951,  21887,
-   21823,  21759,  21695,  21631,
-   21567,  21503,  21439,  21375,
-   21311,  21247,  21183,  21119,
-   21055,  20991,  20927,  20863,
-   20799,  20735,  20671,  20607,
-   20543,  20479,  20415,  20351,
-   20287,  20223,  20159,  20095,
-   20031,  19967,  19903,  19839,
-   19775,  19711,  19647,  19583,
-   19519,  19455,  19391,  19327,
-   19263,  19199,  19135,  19071,
-   19007,  18943,  18879,  18815,
-   18751,  18687,  18623,  18559,
-   18495,  18431,  18367,  18303,
-   18239,  18175,  18111,  18047,
-   17983,  17919,  17855,  17791,
-   17727,  17663,  17599,  17535,
-   17471,  17407,  17343,  17279,
-   17215,  17151,  17087,  17023,
-   16959,  16895,  16831,  16767,
-   16703,  16639,  16575,  16511,
-   16447,  16384,  16320,  16256,
-   16192,  16128,  16064,  16000,
-   15936,  15872,  15808,  15744,
-   15680,  15616,  15552,  15488,
-   15424,  15360,  15296,  15232,
-   15168,  15104,  15040,  14976,
-   14912,  14848,  14784,  14720,
-   14656,  14592,  14528,  14464,
-   14400,  14336,  14272,  14208,
-   14144,  14080,  14016,  13952,
-   13888,  13824,  13760,  13696,
-   13632,  13568,  13504,  13440,
-   13376,  13312,  13248,  13184,
-   13120,  13056,  12992,  12928,
-   12864,  12800,  12736,  12672,
-   12608,  12544,  12480,  12416,
-   12352,  12288,  12224,  12160,
-   12096,  12032,  11968,  11904,
-   11840,  11776,  11712,  11648,
-   11584,  11520,  11456,  11392,
-   11328,  11264,  11200,  11136,
-   11072,  11008,  10944,  10880,
-   10816,  10752,  10688,  10624,
-   10560,  10496,  10432,  10368,
-   10304,  10240,  10176,  10112,
-   10048,   9984,   9920,   9856,
-    9792,   9728,   9664,   9600,
-    9536,   9472,   9408,   9344,
-    9280,   9216,   9152,   9088,
-    9024,   8960,   8896,   8832,
-    8768,   8704,   8640,   8576,
-    8512,   8448,   8384,   8320,
-    8256,   8192,   8128,   8064,
-    8000,   7936,   7872,   7808,
-    7744,   7680,   7616,   7552,
-    7488,   7424,   7360,   7296,
-    7232,   7168,   7104,   7040,
-    6976,   6912,   6848,   6784,
-    6720,   6656,   6592,   6528,
-    6464,   6400,   6336,   6272,
-    6208,   6144,   6080,   6016,
-    5952,   5888,   5824,   5760,
-    5696,   5632,   5568,   5504,
-    5440,   5376,   5312,   5248,
-    5184,   5120,   5056,   4992,
-    4928,   4864,   4800,   4736,
-    4672,   4608,   4544,   4480,
-    4416,   4352,   4288,   4224,
-    4160,   4096,   4032,   3968,
-    3904,   3840,   3776,   3712,
-    3648,   3584,   3520,   3456,
-    3392,   3328,   3264,   3200,
-    3136,   3072,   3008,   2944,
-    2880,   2816,   2752,   2688,
-    2624,   2560,   2496,   2432,
-    2368,   2304,   2240,   2176,
-    2112,   2048,   1984,   1920,
-    1856,   1792,   1728,   1664,
-    1600,   1536,   1472,   1408,
-    1344,   1280,   1216,   1152,
-    1088,   1024,    960,    896,
-     832,    768,    704,    640,
-     576,    512,    448,    384,
-     320,    256,    192,    128,
-      64,      0,      0,      1,
-       3,      5,      8,     11,
-      15,     20,     25,     31,
-      37,     44,     52,     60,
-      69,     79,     89,    100,
-     111,    123,    136,    149,
-     163,    177,    192,    208,
-     224,    241,    259,    277,
-     295,    315,    335,    355,
-     376,    398,    420,    443,
-     467,    491,    516,    541,
-     567,    593,    621,    648,
-     677,    705,    735,    765,
-     796,    827,    859,    891,
-     924,    958,    992,   1027,
-    1062,   1098,   1134,   1171,
-    1209,   1247,   1286,   1325,
-    1365,   1406,   1447,   1488,
-    1530,   1573,   1616,   1660,
-    1704,   1749,   1795,   1841,
-    1887,   1935,   1982,   2030,
-    2079,   2128,   2178,   2229,
-    2279,   2331,   2383,   2435,
-    2488,   2542,   2596,   2650,
-    2706,   2761,   2817,   2874,
-    2931,   2989,   3047,   3105,
-    3165,   3224,   3284,   3345,
-    3406,   3468,   3530,   3592,
-    3655,   3719,   3783,   3847,
-    3912,   3978,   4044,   4110,
-    4177,   4244,   4312,   4380,
-    4449,   4518,   4587,   4657,
-    4728,   4799,   4870,   4942,
-    5014,   5086,   5159,   5233,
-    5307,   5381,   5456,   5531,
-    5606,   5682,   5759,   5835,
-    5912,   5990,   6068,   6146,
-    6225,   6304,   6383,   6463,
-    6543,   6624,   6705,   6786,
-    6868,   6950,   7032,   7115,
-    7198,   7281,   7365,   7449,
-    7534,   7618,   7703,   7789,
-    7875,   7961,   8047,   8134,
-    8221,   8308,   8396,   8484,
-    8572,   8660,   8749,   8838,
-    8928,   9017,   9107,   9197,
-    9288,   9379,   9470,   9561,
-    9652,   9744,   9836,   9929,
-   10021,  10114,  10207,  10300,
-   10393,  10487,  10581,  10675,
-   10770,  10864,  10959,  11054,
-   11149,  11244,  11340,  11436,
-   11532,  11628,  11724,  11820,
-   11917,  12014,  12111,  12208,
-   12305,  12403,  12500,  12598,
-   12696,  12794,  12892,  12990,
-   13089,  13187,  13286,  13385,
-   13484,  13583,  13682,  13781,
-   13880,  13980,  14079,  14179,
-   14278,  14378,  14478,  14578,
-   14678,  14778,  14878,  14978,
-   15078,  15178,  15279,  15379,
-   15479,  15580,  15680,  15780,
-   15881,  15981,  16082,  16182,
-   16283,  16383,  16484,  16585,
-   16685,  16786,  16886,  16987,
-   17087,  17187,  17288,  17388,
-   17488,  17589,  17689,  17789,
-   17889,  17989,  18089,  18189,
-   18289,  18389,  18489,  18588,
-   18688,  18787,  18887,  18986,
-   19085,  19184,  19283,  19382,
-   19481,  19580,  19678,  19777,
-   19875,  19973,  20071,  20169,
-   20267,  20364,  20462,  20559,
-   20656,  20753,  20850,  20947,
-   21043,  21139,  21235,  21331,
-   21427,  21523,  21618,  21713,
-   21808,  21903,  21997,  22092,
-   22186,  22280,  22374,  22467,
-   22560,  22653,  22746,  22838,
-   22931,  23023,  23115,  23206,
-   23297,  23388,  23479,  23570,
-   23660,  23750,  23839,  23929,
-   24018,  24107,  24195,  24283,
-   24371,  24459,  24546,  24633,
-   24720,  24806,  24892,  24978,
-   25064,  25149,  25233,  25318,
-   25402,  25486,  25569,  25652,
-   25735,  25817,  25899,  25981,
-   26062,  26143,  26224,  26304,
-   26384,  26463,  26542,  26621,
-   26699,  26777,  26855,  26932,
-   27008,  27085,  27161,  27236,
-   27311,  27386,  27460,  27534,
-   27608,  27681,  27753,  27825,
-   27897,  27968,  28039,  28110,
-   28180,  28249,  28318,  28387,
-   28455,  28523,  28590,  28657,
-   28723,  28789,  28855,  28920,
-   28984,  29048,  29112,  29175,
-   29237,  29299,  29361,  29422,
-   29483,  29543,  29602,  29662,
-   29720,  29778,  29836,  29893,
-   29950,  30006,  30061,  30117,
-   30171,  30225,  30279,  30332,
-   30384,  30436,  30488,  30538,
-   30589,  30639,  30688,  30737,
-   30785,  30832,  30880,  30926,
-   30972,  31018,  31063,  31107,
-   31151,  31194,  31237,  31279,
-   31320,  31361,  31402,  31442,
-   31481,  31520,  31558,  31596,
-   31633,  31669,  31705,  31740,
-   31775,  31809,  31843,  31876,
-   31908,  31940,  31971,  32002,
-   32032,  32062,  32090,  32119,
-   32146,  32174,  32200,  32226,
-   32251,  32276,  32300,  32324,
-   32347,  32369,  32391,  32412,
-   32432,  32452,  32472,  32490,
-   32508,  32526,  32543,  32559,
-   32575,  32590,  32604,  32618,
-   32631,  32644,  32656,  32667,
-   32678,  32688,  32698,  32707,
-   32715,  32723,  32730,  32736,
-   32742,  32747,  32752,  32756,
-   32759,  32762,  32764,  32766,
-   32767,  32767,  32767,  32767,
-   32766,  32764,  32762,  32759,
-   32756,  32752,  32747,  32742,
-   32736,  32730,  32723,  32715,
-   32707,  32698,  32688,  32678,
-   32667,  32656,  32644,  32631,
-   32618,  32604,  32590,  32575,
-   32559,  32543,  32526,  32508,
-   32490,  32472,  32452,  32432,
-   32412,  32391,  32369,  32347,
-   32324,  32300,  32276,  32251,
-   32226,  32200,  32174,  32146,
-   32119,  32090,  32062,  32032,
-   32002,  31971,  31940,  31908,
-   31876,  31843,  31809,  31775,
-   31740,  31705,  31669,  31633,
-   31596,  31558,  31520,  31481,
-   31442,  31402,  31361,  31320,
-   31279,  31237,  31194,  31151,
-   31107,  31063,  31018,  30972,
-   30926,  30880,  30832,  30785,
-   30737,  30688,  30639,  30589,
-   30538,  30488,  30436,  30384,
-   30332,  30279,  30225,  30171,
-   30117,  30061,  30006,  29950,
-   29893,  29836,  29778,  29720,
-   29662,  29602,  29543,  29483,
-   29422,  29361,  29299,  29237,
-   29175,  29112,  29048,  28984,
-   28920,  28855,  28789,  28723,
-   28657,  28590,  28523,  28455,
-   28387,  28318,  28249,  28180,
-   28110,  28039,  27968,  27897,
-   27825,  27753,  27681,  27608,
-   27534,  27460,  27386,  27311,
-   27236,  27161,  27085,  27008,
-   26932,  26855,  26777,  26699,
-   26621,  26542,  26463,  26384,
-   26304,  26224,  26143,  26062,
-   25981,  25899,  25817,  25735,
-   25652,  25569,  25486,  25402,
-   25318,  25233,  25149,  25064,
-   24978,  24892,  24806,  24720,
-   24633,  24546,  24459,  24371,
-   24283,  24195,  24107,  24018,
-   23929,  23839,  23750,  23660,
-   23570,  23479,  23388,  23297,
-   23206,  23115,  23023,  22931,
-   22838,  22746,  22653,  22560,
-   22467,  22374,  22280,  22186,
-   22092,  21997,  21903,  21808,
-   21713,  21618,  21523,  21427,
-   21331,  21235,  21139,  21043,
-   20947,  20850,  20753,  20656,
-   20559,  20462,  20364,  20267,
-   20169,  20071,  19973,  19875,
-   19777,  19678,  19580,  19481,
-   19382,  19283,  19184,  19085,
-   18986,  18887,  18787,  18688,
-   18588,  18489,  18389,  18289,
-   18189,  18089,  17989,  17889,
-   17789,  17689,  17589,  17488,
-   17388,  17288,  17187,  17087,
-   16987,  16886,  16786,  16685,
-   16585,  16484,  16384,  16283,
-   16182,  16082,  15981,  15881,
-   15780,  15680,  15580,  15479,
-   15379,  15279,  15178,  15078,
-   14978,  14878,  14778,  14678,
-   14578,  14478,  14378,  14278,
-   14179,  14079,  13980,  13880,
-   13781,  13682,  13583,  13484,
-   13385,  13286,  13187,  13089,
-   12990,  12892,  12794,  12696,
-   12598,  12500,  12403,  12305,
-   12208,  12111,  12014,  11917,
-   11820,  11724,  11628,  11532,
-   11436,  11340,  11244,  11149,
-   11054,  10959,  10864,  10770,
-   10675,  10581,  10487,  10393,
-   10300,  10207,  10114,  10021,
-    9929,   9836,   9744,   9652,
-    9561,   9470,   9379,   9288,
-    9197,   9107,   9017,   8928,
-    8838,   8749,   8660,   8572,
-    8484,   8396,   8308,   8221,
-    8134,   8047,   7961,   7875,
-    7789,   7703,   7618,   7534,
-    7449,   7365,   7281,   7198,
-    7115,   7032,   6950,   6868,
-    6786,   6705,   6624,   6543,
-    6463,   6383,   6304,   6225,
-    6146,   6068,   5990,   5912,
-    5835,   5759,   5682,   5606,
-    5531,   5456,   5381,   5307,
-    5233,   5159,   5086,   5014,
-    4942,   4870,   4799,   4728,
-    4657,   4587,   4518,   4449,
-    4380,   4312,   4244,   4177,
-    4110,   4044,   3978,   3912,
-    3847,   3783,   3719,   3655,
-    3592,   3530,   3468,   3406,
-    3345,   3284,   3224,   3165,
-    3105,   3047,   2989,   2931,
-    2874,   2817,   2761,   2706,
-    2650,   2596,   2542,   2488,
-    2435,   2383,   2331,   2279,
-    2229,   2178,   2128,   2079,
-    2030,   1982,   1935,   1887,
-    1841,   1795,   1749,   1704,
-    1660,   1616,   1573,   1530,
-    1488,   1447,   1406,   1365,
-    1325,   1286,   1247,   1209,
-    1171,   1134,   1098,   1062,
-    1027,    992,    958,    924,
-     891,    859,    827,    796,
-     765,    735,    705,    677,
-     648,    621,    593,    567,
-     541,    516,    491,    467,
-     443,    420,    398,    376,
-     355,    335,    315,    295,
-     277,    259,    241,    224,
-     208,    192,    177,    163,
-     149,    136,    123,    111,
-     100,     89,     79,     69,
-      60,     52,     44,     37,
-      31,     25,     20,     15,
-      11,      8,      5,      3,
-       1,      0,      0,    321,
-     638,    953,   1264,   1572,
-    1878,   2180,   2479,   2776,
-    3070,   3360,   3648,   3933,
-    4216,   4495,   4772,   5047,
-    5318,   5587,   5853,   6117,
-    6378,   6637,   6893,   7147,
-    7398,   7647,   7893,   8137,
-    8378,   8618,   8854,   9089,
-    9321,   9551,   9779,  10005,
-   10228,  10449,  10668,  10885,
-   11100,  11313,  11524,  11732,
-   11939,  12143,  12346,  12547,
-   12745,  12942,  13137,  13330,
-   13521,  13710,  13897,  14083,
-   14267,  14449,  14629,  14807,
-   14984,  15159,  15332,  15504,
-   15674,  15842,  16009,  16174,
-   16337,  16499,  16660,  16818,
-   16975,  17131,  17285,  17438,
-   17589,  17739,  17887,  18034,
-   18179,  18323,  18466,  18607,
-   18746,  18885,  19022,  19158,
-   19292,  19425,  19557,  19688,
-   19817,  19945,  20072,  20197,
-   20322,  20445,  20567,  20688,
-   20807,  20925,  21043,  21159,
-   21274,  21388,  21501,  21612,
-   21723,  21832,  21941,  22048,
-   22154,  22260,  22364,  22467,
-   22570,  22671,  22771,  22871,
-   22969,  23066,  23163,  23258,
-   23353,  23447,  23539,  23631,
-   23722,  23812,  23901,  23990,
-   24077,  24164,  24250,  24335,
-   24419,  24502,  24585,  24666,
-   24747,  24827,  24907,  24985,
-   25063,  25140,  25216,  25292,
-   25367,  25441,  25514,  25587,
-   25659,  25730,  25801,  25870,
-   25940,  26008,  26076,  26143,
-   26210,  26276,  26341,  26406,
-   26470,  26533,  26596,  26658,
-   26719,  26780,  26841,  26901,
-   26960,  27018,  27076,  27134,
-   27191,  27247,  27303,  27358,
-   27413,  27467,  27521,  27574,
-   27627,  27679,  27731,  27782,
-   27832,  27882,  27932,  27981,
-   28030,  28078,  28126,  28173,
-   28220,  28266,  28312,  28358,
-   28403,  28447,  28492,  28535,
-   28579,  28621,  28664,  28706,
-   28748,  28789,  28830,  28870,
-   28910,  28950,  28989,  29028,
-   29067,  29105,  29142,  29180,
-   29217,  29254,  29290,  29326,
-   29362,  29397,  29432,  29466,
-   29501,  29535,  29568,  29601,
-   29634,  29667,  29699,  29731,
-   29763,  29794,  29825,  29856,
-   29887,  29917,  29947,  29976,
-   30006,  30035,  30063,  30092,
-   30120,  30148,  30175,  30203,
-   30230,  30257,  30283,  30310,
-   30336,  30362,  30387,  30412,
-   30437,  30462,  30487,  30511,
-   30535,  30559,  30583,  30606,
-   30629,  30652,  30675,  30698,
-   30720,  30742,  30764,  30785,
-   30807,  30828,  30849,  30870,
-   30891,  30911,  30931,  30951,
-   30971,  30991,  31010,  31029,
-   31049,  31067,  31086,  31105,
-   31123,  31141,  31159,  31177,
-   31195,  31212,  31229,  31246,
-   31263,  31280,  31297,  31313,
-   31330,  31346,  31362,  31378,
-   31393,  31409,  31424,  31439,
-   31454,  31469,  31484,  31499,
-   31513,  31528,  31542,  31556,
-   31570,  31584,  31597,  31611,
-   31624,  31638,  31651,  31664,
-   31677,  31690,  31702,  31715,
-   31727,  31739,  31752,  31764,
-   31776,  31787,  31799,  31811,
-   31822,  31834,  31845,  31856,
-   31867,  31878,  31889,  31899,
-   31910,  31921,  31931,  31941,
-   31951,  31962,  31972,  31982,
-   31991,  32001,  32011,  32020,
-   32030,  32039,  32048,  32057,
-   32066,  32075,  32084,  32093,
-   32102,  32111,  32119,  32128,
-   32136,  32144,  32153,  32161,
-   32169,  32177,  32185,  32193,
-   32200,  32208,  32216,  32223,
-   32231,  32238,  32245,  32253,
-   32260,  32267,  32274,  32281,
-   32288,  32295,  32301,  32308,
-   32315,  32321,  32328,  32334,
-   32341,  32347,  32353,  32359,
-   32366,  32372,  32378,  32384,
-   32390,  32395,  32401,  32407,
-   32413,  32418,  32424,  32429,
-   32435,  32440,  32446,  32451,
-   32456,  32461,  32466,  32472,
-   32477,  32482,  32487,  32492,
-   32496,  32501,  32506,  32511,
-   32515,  32520,  32525,  32529,
-   32534,  32538,  32542,  32547,
-   32551,  32555,  32560,  32564,
-   32568,  32572,  32576,  32580,
-   32584,  32588,  32592,  32596,
-   32600,  32604,  32607,  32611,
-   32615,  32618,  32622,  32626,
-   32629,  32633,  32636,  32640,
-   32643,  32647,  32650,  32653,
-   32656,  32660,  32663,  32666,
-   32669,  32672,  32676,  32679,
-   32682,  32685,  32688,  32691,
-   32694,  32696,  32699,  32702,
-   32705,  32708,  32710,  32713,
-   32716,  32719,  32721,  32724,
-   32726,  32729,  32732,  32734,
-   32737,  32739,  32742,  32744,
-   32746,  32749,  32751,  32753,
-   32756,  32758,  32760,  32763,
-   32765,  32767,  32767,  32767,
-   32765,  32763,  32760,  32758,
-   32756,  32753,  32751,  32749,
-   32746,  32744,  32742,  32739,
-   32737,  32734,  32732,  32729,
-   32726,  32724,  32721,  32719,
-   32716,  32713,  32710,  32708,
-   32705,  32702,  32699,  32696,
-   32694,  32691,  32688,  32685,
-   32682,  32679,  32676,  32672,
-   32669,  32666,  32663,  32660,
-   32656,  32653,  32650,  32647,
-   32643,  32640,  32636,  32633,
-   32629,  32626,  32622,  32618,
-   32615,  32611,  32607,  32604,
-   32600,  32596,  32592,  32588,
-   32584,  32580,  32576,  32572,
-   32568,  32564,  32560,  32555,
-   32551,  32547,  32542,  32538,
-   32534,  32529,  32525,  32520,
-   32515,  32511,  32506,  32501,
-   32496,  32492,  32487,  32482,
-   32477,  32472,  32466,  32461,
-   32456,  32451,  32446,  32440,
-   32435,  32429,  32424,  32418,
-   32413,  32407,  32401,  32395,
-   32390,  32384,  32378,  32372,
-   32366,  32359,  32353,  32347,
-   32341,  32334,  32328,  32321,
-   32315,  32308,  32301,  32295,
-   32288,  32281,  32274,  32267,
-   32260,  32253,  32245,  32238,
-   32231,  32223,  32216,  32208,
-   32200,  32193,  32185,  32177,
-   32169,  32161,  32153,  32144,
-   32136,  32128,  32119,  32111,
-   32102,  32093,  32084,  32075,
-   32066,  32057,  32048,  32039,
-   32030,  32020,  32011,  32001,
-   31991,  31982,  31972,  31962,
-   31951,  31941,  31931,  31921,
-   31910,  31899,  31889,  31878,
-   31867,  31856,  31845,  31834,
-   31822,  31811,  31799,  31787,
-   31776,  31764,  31752,  31739,
-   31727,  31715,  31702,  31690,
-   31677,  31664,  31651,  31638,
-   31624,  31611,  31597,  31584,
-   31570,  31556,  31542,  31528,
-   31513,  31499,  31484,  31469,
-   31454,  31439,  31424,  31409,
-   31393,  31378,  31362,  31346,
-   31330,  31313,  31297,  31280,
-   31263,  31246,  31229,  31212,
-   31195,  31177,  31159,  31141,
-   31123,  31105,  31086,  31067,
-   31049,  31029,  31010,  30991,
-   30971,  30951,  30931,  30911,
-   30891,  30870,  30849,  30828,
-   30807,  30785,  30764,  30742,
-   30720,  30698,  30675,  30652,
-   30629,  30606,  30583,  30559,
-   30535,  30511,  30487,  30462,
-   30437,  30412,  30387,  30362,
-   30336,  30310,  30283,  30257,
-   30230,  30203,  30175,  30148,
-   30120,  30092,  30063,  30035,
-   30006,  29976,  29947,  29917,
-   29887,  29856,  29825,  29794,
-   29763,  29731,  29699,  29667,
-   29634,  29601,  29568,  29535,
-   29501,  29466,  29432,  29397,
-   29362,  29326,  29290,  29254,
-   29217,  29180,  29142,  29105,
-   29067,  29028,  28989,  28950,
-   28910,  28870,  28830,  28789,
-   28748,  28706,  28664,  28621,
-   28579,  28535,  28492,  28447,
-   28403,  28358,  28312,  28266,
-   28220,  28173,  28126,  28078,
-   28030,  27981,  27932,  27882,
-   27832,  27782,  27731,  27679,
-   27627,  27574,  27521,  27467,
-   27413,  27358,  27303,  27247,
-   27191,  27134,  27076,  27018,
-   26960,  26901,  26841,  26780,
-   26719,  26658,  26596,  26533,
-   26470,  26406,  26341,  26276,
-   26210,  26143,  26076,  26008,
-   25940,  25870,  25801,  25730,
-   25659,  25587,  25514,  25441,
-   25367,  25292,  25216,  25140,
-   25063,  24985,  24907,  24827,
-   24747,  24666,  24585,  24502,
-   24419,  24335,  24250,  24164,
-   24077,  23990,  23901,  23812,
-   23722,  23631,  23539,  23447,
-   23353,  23258,  23163,  23066,
-   22969,  22871,  22771,  22671,
-   22570,  22467,  22364,  22260,
-   22154,  22048,  21941,  21832,
-   21723,  21612,  21501,  21388,
-   21274,  21159,  21043,  20925,
-   20807,  20688,  20567,  20445,
-   20322,  20197,  20072,  19945,
-   19817,  19688,  19557,  19425,
-   19292,  19158,  19022,  18885,
-   18746,  18607,  18466,  18323,
-   18179,  18034,  17887,  17739,
-   17589,  17438,  17285,  17131,
-   16975,  16818,  16660,  16499,
-   16337,  16174,  16009,  15842,
-   15674,  15504,  15332,  15159,
-   14984,  14807,  14629,  14449,
-   14267,  14083,  13897,  13710,
-   13521,  13330,  13137,  12942,
-   12745,  12547,  12346,  12143,
-   11939,  11732,  11524,  11313,
-   11100,  10885,  10668,  10449,
-   10228,  10005,   9779,   9551,
-    9321,   9089,   8854,   8618,
-    8378,   8137,   7893,   7647,
-    7398,   7147,   6893,   6637,
-    6378,   6117,   5853,   5587,
-    5318,   5047,   4772,   4495,
-    4216,   3933,   3648,   3360,
-    3070,   2776,   2479,   2180,
-    1878,   1572,   1264,    953,
-     638,    321,      0,      0,
-     321,    638,    953,   1264,
-    1572,   1878,   2180,   2479,
-    2776,   3070,   3360,   3648,
-    3933,   4216,   4495,   4772,
-    5047,   5318,   5587,   5853,
-    6117,   6378,   6637,   6893,
-    7147,   7398,   7647,   7893,
-    8137,   8378,   8618,   8854,
-    9089,   9321,   9551,   9779,
-   10005,  10228,  10449,  10668,
-   10885,  11100,  11313,  11524,
-   11732,  11939,  12143,  12346,
-   12547,  12745,  12942,  13137,
-   13330,  13521,  13710,  13897,
-   14083,  14267,  14449,  14629,
-   14807,  14984,  15159,  15332,
-   15504,  15674,  15842,  16009,
-   16174,  16337,  16499,  16660,
-   16818,  16975,  17131,  17285,
-   17438,  17589,  17739,  17887,
-   18034,  18179,  18323,  18466,
-   18607,  18746,  18885,  19022,
-   19158,  19292,  19425,  19557,
-   19688,  19817,  19945,  20072,
-   20197,  20322,  20445,  20567,
-   20688,  20807,  20925,  21043,
-   21159,  21274,  21388,  21501,
-   21612,  21723,  21832,  21941,
-   22048,  22154,  22260,  22364,
-   22467,  22570,  22671,  22771,
-   22871,  22969,  23066,  23163,
-   23258,  23353,  23447,  23539,
-   23631,  23722,  23812,  23901,
-   23990,  24077,  24164,  24250,
-   24335,  24419,  24502,  24585,
-   24666,  24747,  24827,  24907,
-   24985,  25063,  25140,  25216,
-   25292,  25367,  25441,  25514,
-   25587,  25659,  25730,  25801,
-   25870,  25940,  26008,  26076,
-   26143,  26210,  26276,  26341,
-   26406,  26470,  26533,  26596,
-   26658,  26719,  26780,  26841,
-   26901,  26960,  27018,  27076,
-   27134,  27191,  27247,  27303,
-   27358,  27413,  27467,  27521,
-   27574,  27627,  27679,  27731,
-   27782,  27832,  27882,  27932,
-   27981,  28030,  28078,  28126,
-   28173,  28220,  28266,  28312,
-   28358,  28403,  28447,  28492,
-   28535,  28579,  28621,  28664,
-   28706,  28748,  28789,  28830,
-   28870,  28910,  28950,  28989,
-   29028,  29067,  29105,  29142,
-   29180,  29217,  29254,  29290,
-   29326,  29362,  29397,  29432,
-   29466,  29501,  29535,  29568,
-   29601,  29634,  29667,  29699,
-   29731,  29763,  29794,  29825,
-   29856,  29887,  29917,  29947,
-   29976,  30006,  30035,  30063,
-   30092,  30120,  30148,  30175,
-   30203,  30230,  30257,  30283,
-   30310,  30336,  30362,  30387,
-   30412,  30437,  30462,  30487,
-   30511,  30535,  30559,  30583,
-   30606,  30629,  30652,  30675,
-   30698,  30720,  30742,  30764,
-   30785,  30807,  30828,  30849,
-   30870,  30891,  30911,  30931,
-   30951,  30971,  30991,  31010,
-   31029,  31049,  31067,  31086,
-   31105,  31123,  31141,  31159,
-   31177,  31195,  31212,  31229,
-   31246,  31263,  31280,  31297,
-   31313,  31330,  31346,  31362,
-   31378,  31393,  31409,  31424,
-   31439,  31454,  31469,  31484,
-   31499,  31513,  31528,  31542,
-   31556,  31570,  31584,  31597,
-   31611,  31624,  31638,  31651,
-   31664,  31677,  31690,  31702,
-   31715,  31727,  31739,  31752,
-   31764,  31776,  31787,  31799,
-   31811,  31822,  31834,  31845,
-   31856,  31867,  31878,  31889,
-   31899,  31910,  31921,  31931,
-   31941,  31951,  31962,  31972,
-   31982,  31991,  32001,  32011,
-   32020,  32030,  32039,  32048,
-   32057,  32066,  32075,  32084,
-   32093,  32102,  32111,  32119,
-   32128,  32136,  32144,  32153,
-   32161,  32169,  32177,  32185,
-   32193,  32200,  32208,  32216,
-   32223,  32231,  32238,  32245,
-   32253,  32260,  32267,  32274,
-   32281,  32288,  32295,  32301,
-   32308,  32315,  32321,  32328,
-   32334,  32341,  32347,  32353,
-   32359,  32366,  32372,  32378,
-   32384,  32390,  32395,  32401,
-   32407,  32413,  32418,  32424,
-   32429,  32435,  32440,  32446,
-   32451,  32456,  32461,  32466,
-   32472,  32477,  32482,  32487,
-   32492,  32496,  32501,  32506,
-   32511,  32515,  32520,  32525,
-   32529,  32534,  32538,  32542,
-   32547,  32551,  32555,  32560,
-   32564,  32568,  32572,  32576,
-   32580,  32584,  32588,  32592,
-   32596,  32600,  32604,  32607,
-   32611,  32615,  32618,  32622,
-   32626,  32629,  32633,  32636,
-   32640,  32643,  32647,  32650,
-   32653,  32656,  32660,  32663,
-   32666,  32669,  32672,  32676,
-   32679,  32682,  32685,  32688,
-   32691,  32694,  32696,  32699,
-   32702,  32705,  32708,  32710,
-   32713,  32716,  32719,  32721,
-   32724,  32726,  32729,  32732,
-   32734,  32737,  32739,  32742,
-   32744,  32746,  32749,  32751,
-   32753,  32756,  32758,  32760,
-   32763,  32765,  32767,  32767,
-   32767,  32446,  32129,  31814,
-   31503,  31195,  30889,  30587,
-   30288,  29991,  29697,  29407,
-   29119,  28834,  28551,  28272,
-   27995,  27720,  27449,  27180,
-   26914,  26650,  26389,  26130,
-   25874,  25620,  25369,  25120,
-   24874,  24630,  24389,  24149,
-   23913,  23678,  23446,  23216,
-   22988,  22762,  22539,  22318,
-   22099,  21882,  21667,  21454,
-   21243,  21035,  20828,  20624,
-   20421,  20220,  20022,  19825,
-   19630,  19437,  19246,  19057,
-   18870,  18684,  18500,  18318,
-   18138,  17960,  17783,  17608,
-   17435,  17263,  17093,  16925,
-   16758,  16593,  16430,  16268,
-   16107,  15949,  15792,  15636,
-   15482,  15329,  15178,  15028,
-   14880,  14733,  14588,  14444,
-   14301,  14160,  14021,  13882,
-   13745,  13609,  13475,  13342,
-   13210,  13079,  12950,  12822,
-   12695,  12570,  12445,  12322,
-   12200,  12079,  11960,  11842,
-   11724,  11608,  11493,  11379,
-   11266,  11155,  11044,  10935,
-   10826,  10719,  10613,  10507,
-   10403,  10300,  10197,  10096,
-    9996,   9896,   9798,   9701,
-    9604,   9509,   9414,   9320,
-    9228,   9136,   9045,   8955,
-    8866,   8777,   8690,   8603,
-    8517,   8432,   8348,   8265,
-    8182,   8101,   8020,   7940,
-    7860,   7782,   7704,   7627,
-    7551,   7475,   7400,   7326,
-    7253,   7180,   7108,   7037,
-    6966,   6897,   6827,   6759,
-    6691,   6624,   6557,   6491,
-    6426,   6361,   6297,   6234,
-    6171,   6109,   6048,   5987,
-    5926,   5866,   5807,   5749,
-    5691,   5633,   5576,   5520,
-    5464,   5409,   5354,   5300,
-    5246,   5193,   5140,   5088,
-    5036,   4985,   4935,   4885,
-    4835,   4786,   4737,   4689,
-    4641,   4594,   4547,   4501,
-    4455,   4409,   4364,   4320,
-    4275,   4232,   4188,   4146,
-    4103,   4061,   4019,   3978,
-    3937,   3897,   3857,   3817,
-    3778,   3739,   3700,   3662,
-    3625,   3587,   3550,   3513,
-    3477,   3441,   3405,   3370,
-    3335,   3301,   3266,   3232,
-    3199,   3166,   3133,   3100,
-    3068,   3036,   3004,   2973,
-    2942,   2911,   2880,   2850,
-    2820,   2791,   2761,   2732,
-    2704,   2675,   2647,   2619,
-    2592,   2564,   2537,   2510,
-    2484,   2457,   2431,   2405,
-    2380,   2355,   2330,   2305,
-    2280,   2256,   2232,   2208,
-    2184,   2161,   2138,   2115,
-    2092,   2069,   2047,   2025,
-    2003,   1982,   1960,   1939,
-    1918,   1897,   1876,   1856,
-    1836,   1816,   1796,   1776,
-    1757,   1738,   1718,   1700,
-    1681,   1662,   1644,   1626,
-    1608,   1590,   1572,   1555,
-    1538,   1521,   1504,   1487,
-    1470,   1454,   1437,   1421,
-    1405,   1389,   1374,   1358,
-    1343,   1328,   1313,   1298,
-    1283,   1268,   1254,   1239,
-    1225,   1211,   1197,   1183,
-    1170,   1156,   1143,   1129,
-    1116,   1103,   1090,   1077,
-    1065,   1052,   1040,   1028,
-    1015,   1003,    991,    980,
-     968,    956,    945,    933,
-     922,    911,    900,    889,
-     878,    868,    857,    846,
-     836,    826,    816,    805,
-     795,    785,    776,    766,
-     756,    747,    737,    728,
-     719,    710,    701,    692,
-     683,    674,    665,    656,
-     648,    639,    631,    623,
-     614,    606,    598,    590,
-     582,    574,    567,    559,
-     551,    544,    536,    529,
-     522,    514,    507,    500,
-     493,    486,    479,    472,
-     466,    459,    452,    446,
-     439,    433,    426,    420,
-     414,    408,    401,    395,
-     389,    383,    377,    372,
-     366,    360,    354,    349,
-     343,    338,    332,    327,
-     321,    316,    311,    306,
-     301,    295,    290,    285,
-     280,    275,    271,    266,
-     261,    256,    252,    247,
-     242,    238,    233,    229,
-     225,    220,    216,    212,
-     207,    203,    199,    195,
-     191,    187,    183,    179,
-     175,    171,    167,    163,
-     160,    156,    152,    149,
-     145,    141,    138,    134,
-     131,    127,    124,    120,
-     117,    114,    111,    107,
-     104,    101,     98,     95,
-      91,     88,     85,     82,
-      79,     76,     73,     71,
-      68,     65,     62,     59,
-      57,     54,     51,     48,
-      46,     43,     41,     38,
-      35,     33,     30,     28,
-      25,     23,     21,     18,
-      16,     14,     11,      9,
-       7,      4,      2,      0,
-};
-
-
-const int16_t* lookup_table_i16_table[] = {
-  lut_wavetable,
-};
-
-
-}  // namespace tides
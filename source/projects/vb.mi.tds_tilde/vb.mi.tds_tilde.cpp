@@ -35,6 +35,7 @@
 
 #include "tides2/poly_slope_generator.h"
 #include "tides2/ramp_extractor.h"
+#include "denormals.h"
 
 
 
@@ -297,6 +298,8 @@ t_max_err range_setter(t_myObj *self, void *attr, long ac, t_atom *av)
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *freq_in = ins[0];
     double  *shape_in = ins[1];
     double  *slope_in = ins[2];
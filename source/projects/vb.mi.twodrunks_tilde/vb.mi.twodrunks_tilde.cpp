@@ -38,6 +38,8 @@
 
 
 #include "tides/generator.h"
+#include "stmlib/utils/random.h"
+#include "denormals.h"
 
 
 
@@ -69,6 +71,8 @@ struct t_myObj {
     double      sr;
     uint16_t    sr_pitch_correction;
     long        sigvs;
+    uint32_t    rng_state;
+    stmlib::PendingSeed seed;
     
 };
 
@@ -121,6 +125,7 @@ void* myObj_new(t_symbol *s, long argc, t_atom *argv)
         }
 
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         self->sr_pitch_correction = log2(kSampleRate / self->sr) * 12.0 * 128.0;
         memset(&self->generator, 0, sizeof(self->generator));
         self->generator.Init();
@@ -251,10 +256,18 @@ t_max_err range_setter(t_myObj *self, void *attr, long ac, t_atom *av)
 }
 
 
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark -------- DSP Loop ----------
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     double  *freq_in = ins[0];
     double  *shape_in = ins[1];
     double  *slope_in = ins[2];
@@ -266,6 +279,8 @@ void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins,
     if (self->obj.z_disabled)
         return;
 
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
+
     
     tides::Generator *generator = &self->generator;
     uint8_t prev_state = self->previous_state_;
@@ -432,6 +447,7 @@ void ext_main(void* r) {
 
     class_addmethod(this_class, (method)myObj_int,      "int",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_float,    "float",    A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,     "seed",     A_LONG, 0);
     class_addmethod(this_class, (method)myObj_freq,     "freq",     A_FLOAT, 0);
     class_addmethod(this_class, (method)myObj_shape,    "shape",    A_FLOAT, 0);
     class_addmethod(this_class, (method)myObj_slope,    "slope",    A_FLOAT, 0);
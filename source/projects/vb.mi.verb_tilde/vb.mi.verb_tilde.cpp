@@ -32,12 +32,16 @@
 
 #include "c74_msp.h"
 #include "reverb.h"
+#include "denormals.h"
+#include "sleep_detector.h"
+#include "vector_ops.h"
 
 
 using namespace c74::max;
 
 
 static t_class* this_class = nullptr;
+t_symbol *ps_sleep;
 
 
 struct t_myObj {
@@ -54,16 +58,28 @@ struct t_myObj {
     double      space;
     double      input_gain;
     bool        freeze;
+    
+    // sleep mode
+    vbmi::SleepDetector sleep_detector;
+    char        sleep;
+    double      sleep_threshold;
+    double      sleep_time;
+    void        *info_out;
+    t_qelem     *sleep_qelem;
 };
 
 
+void myObj_sleep_report(t_myObj *self);
+
+
 
-void* myObj_new(void) {
+void* myObj_new(t_symbol *s, long argc, t_atom *argv) {
     t_myObj* self = (t_myObj*)object_alloc(this_class);
     
     if(self)
     {
         dsp_setup((t_pxobject*)self, 2);
+        self->info_out = outlet_new((t_object *)self, NULL);
         outlet_new(self, "signal");
         outlet_new(self, "signal");
         
@@ -102,6 +118,11 @@ void* myObj_new(void) {
         self->reverb_->set_hp(0.995);
         
         self->freeze = false;
+        
+        self->sleep_detector.Init(self->sr);
+        self->sleep_threshold = vbmi::kDefaultSleepThreshold;
+        self->sleep_time = vbmi::kDefaultSleepTime;
+        self->sleep_qelem = qelem_new(self, (method)myObj_sleep_report);
 
     }
     else {
@@ -111,6 +132,8 @@ void* myObj_new(void) {
     
     self->x_obj.z_misc = Z_NO_INPLACE;
     
+    attr_args_process(self, argc, argv);
+    
     return self;
 }
 
@@ -212,6 +235,43 @@ void myObj_info(t_myObj *self)
     object_post((t_object*)self, "<-----------------------");
 }
 
+#pragma mark ----------- sleep mode -------------
+
+t_max_err sleep_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep = atom_getlong(av) != 0;
+        self->sleep_detector.set_enabled(self->sleep);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_threshold_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_threshold = CLAMP(atom_getfloat(av), -140., 0.);
+        self->sleep_detector.set_threshold(self->sleep_threshold);
+    }
+    return MAX_ERR_NONE;
+}
+
+t_max_err sleep_time_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->sleep_time = CLAMP(atom_getfloat(av), 10., 60000.);
+        self->sleep_detector.set_hang_time(self->sleep_time);
+    }
+    return MAX_ERR_NONE;
+}
+
+// 'sleep 1' when the reverb fell asleep, 'sleep 0' when it woke up
+void myObj_sleep_report(t_myObj *self) {
+    t_atom a;
+    atom_setlong(&a, self->sleep_detector.sleeping());
+    outlet_anything(self->info_out, ps_sleep, 1, &a);
+}
+
+
 inline void SoftLimit_block(double *inout, size_t size) {
     while(size--) {
         double x2 = (*inout)*(*inout);
@@ -226,6 +286,7 @@ inline void SoftLimit_block(double *inout, size_t size) {
 // 64 bit signal input version
 void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
                      double **outs, long numouts, long sampleframes, long flags, void *userparam){
+    vbmi::ScopedFlushDenormals flush_denormals;
     
     double *inL = ins[0];
     double *inR = ins[1];
@@ -247,6 +308,15 @@ void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
     if(self->bypass)
         return;
     
+    // input below the threshold, and the tail has died away
+    double in_peak = std::max(vbmi::vec::MaxAbs(inL, size),
+                              vbmi::vec::MaxAbs(inR, size));
+    if(!self->sleep_detector.Awake(in_peak, false)) {
+        memset(outL, 0, size*sizeof(double));
+        memset(outR, 0, size*sizeof(double));
+        return;
+    }
+    
     /*
     // if 'freeze' is on, we want no direct signal
     if(self->freeze) {
@@ -258,7 +328,12 @@ void myObj_perform64(t_myObj *self, t_object *dsp64, double **ins, long numins,
     
     SoftLimit_block(outL, size);
     SoftLimit_block(outR, size);
-
+    
+    double out_peak = std::max(vbmi::vec::MaxAbs(outL, size),
+                               vbmi::vec::MaxAbs(outR, size));
+    self->sleep_detector.Update(out_peak, size);
+    if(self->sleep_detector.changed())
+        qelem_set(self->sleep_qelem);
 }
 
 
@@ -266,6 +341,7 @@ void myObj_dsp64(t_myObj* self, t_object* dsp64, short* count, double samplerate
 {
     self->sr = samplerate;
     if(self->sr<=0) self->sr = 44100.0;
+    self->sleep_detector.set_sample_rate(self->sr);
 
     object_method_direct(void, (t_object*, t_object*, t_perfroutine64, long, void*),
                          dsp64, gensym("dsp_add64"), (t_object*)self, (t_perfroutine64)myObj_perform64, 0, NULL);
@@ -280,6 +356,7 @@ void myObj_free(t_myObj* self)
     dsp_free((t_pxobject*)self);
     if(self->reverb_) delete self->reverb_;
     if(self->reverb_buffer) sysmem_freeptr(self->reverb_buffer);
+    if(self->sleep_qelem) qelem_free(self->sleep_qelem);
     
 }
 
@@ -305,6 +382,9 @@ void myObj_assist(t_myObj* self, void* unused, t_assist_function io, long index,
             case 1:
                 strncpy(string_dest,"(signal) OUTR", ASSIST_STRING_MAXSIZE);
                 break;
+            case 2:
+                strncpy(string_dest,"(list) sleep 0/1", ASSIST_STRING_MAXSIZE);
+                break;
         }
     }
 }
@@ -330,6 +410,25 @@ void ext_main(void* r) {
     class_dspinit(this_class);
     class_register(CLASS_BOX, this_class);
     
+    // attributes ====
+    // skip the reverb when input and output are silent
+    CLASS_ATTR_CHAR(this_class, "sleep", 0, t_myObj, sleep);
+    CLASS_ATTR_STYLE_LABEL(this_class, "sleep", 0, "onoff", "sleep when silent");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep", NULL, (method)sleep_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_threshold", 0, t_myObj, sleep_threshold);
+    CLASS_ATTR_LABEL(this_class, "sleep_threshold", 0, "sleep threshold (dB)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_threshold", NULL, (method)sleep_threshold_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_threshold", 0);
+    
+    CLASS_ATTR_DOUBLE(this_class, "sleep_time", 0, t_myObj, sleep_time);
+    CLASS_ATTR_LABEL(this_class, "sleep_time", 0, "silence before sleeping (ms)");
+    CLASS_ATTR_ACCESSORS(this_class, "sleep_time", NULL, (method)sleep_time_setter);
+    CLASS_ATTR_SAVE(this_class, "sleep_time", 0);
+    
+    ps_sleep = gensym("sleep");
+    
     object_post(NULL, "vb.mi.verb~ by volker böhm --> https://vboehm.net");
     object_post(NULL, "reverb generator of the 'elements' module by mutable instruments");
 }
@@ -35,17 +35,22 @@
 
 #include "warps/dsp/modulator.h"
 #include "warps/dsp/oscillator.h"
+#include "stmlib/utils/random.h"
 #include "read_inputs.hpp"
+#include "control_inputs.h"
+#include "denormals.h"
 
 
 
 using namespace c74::max;
 
 
-// TODO: work on block size and SR, use libsamplerate for downsampling?
 // original SR: 96 kHz, block size: 60
 
-const size_t kBlockSize = 60; //96;       // has to stay like that TODO: why?
+// the signal vector is processed in chunks of (at most) kBlockSize samples,
+// without buffering. Only the vocoder needs multiples of 12 samples (its filter
+// bank decimates by 12), it adds a latency of 11 samples at other sizes.
+const size_t kBlockSize = 64;       // <= warps::kMaxBlockSize
 
 static t_class* this_class = nullptr;
 
@@ -54,19 +59,24 @@ struct t_myObj {
     
     warps::Modulator    *modulator;
     warps::ReadInputs   *read_inputs;
+    vbmi::ControlInputs<4> controls;        // level1, level2, algo, timbre cv
 
     double              adc_inputs[warps::ADC_LAST];
     short               patched[2];
     short               easterEgg;
     uint8_t             carrier_shape;
     double              pre_gain;
+    char                cvrate;
+    long                oversampling;
+    long                bands;
     
     warps::FloatFrame   *input;
     warps::FloatFrame   *output;
     
-    long                count;
     double              sr;
     int                 sigvs;
+    uint32_t            rng_state;
+    stmlib::PendingSeed seed;
 };
 
 
@@ -82,12 +92,12 @@ void* myObj_new(void) {
         outlet_new(self, "signal");         // 'aux' output
         
         self->sr = sys_getsr();
+        self->rng_state = stmlib::Random::InstanceSeed();
         if(self->sr <= 0)
             self->sr = 44100.0;
 
         
         // init some params
-        self->count = 0;
         self->easterEgg = 0;
         self->patched[0] = self->patched[1] = 0;
         self->carrier_shape = 1;
@@ -100,12 +110,16 @@ void* myObj_new(void) {
         
         self->read_inputs = new warps::ReadInputs;
         self->read_inputs->Init();
+        
+        self->cvrate = vbmi::CONTROL_RATE_BLOCK;
+        self->controls.Init(vbmi::ControlRate(self->cvrate));
+        self->oversampling = self->modulator->oversampling();
+        self->bands = self->modulator->vocoder_bands();
 
         
         for(int i=0; i<warps::ADC_LAST; i++)
             self->adc_inputs[i] = 0.0;
 
-        // TODO: check memory size: should it be warps::kMaxBlockSize?
         self->input = (warps::FloatFrame*)sysmem_newptr(kBlockSize*sizeof(warps::FloatFrame));
         self->output = (warps::FloatFrame*)sysmem_newptrclear(kBlockSize*sizeof(warps::FloatFrame));
     }
@@ -261,47 +275,99 @@ t_max_err gain_setter(t_myObj *self, void *attr, long ac, t_atom *av)
 }
 
 
+t_max_err cvrate_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->cvrate = CLAMP(atom_getlong(av), 0, vbmi::CONTROL_RATE_LAST - 1);
+        self->controls.set_rate(vbmi::ControlRate(self->cvrate));
+    }
+    return MAX_ERR_NONE;
+}
+
+
+// oversampling ratio of the cross-modulation algorithms: 1, 2, 4 or 6,
+// 0 picks the ratio from the algorithm and timbre
+t_max_err oversampling_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->modulator->set_oversampling(atom_getlong(av));
+        self->oversampling = self->modulator->oversampling();
+    }
+    return MAX_ERR_NONE;
+}
+
+
+// number of vocoder bands: 20 (third octaves, like the module) or 39 (sixth
+// octaves)
+t_max_err bands_setter(t_myObj *self, void *attr, long ac, t_atom *av)
+{
+    if (ac && av) {
+        self->modulator->set_vocoder_bands(atom_getlong(av));
+        self->bands = self->modulator->vocoder_bands();
+    }
+    return MAX_ERR_NONE;
+}
+
+
+void myObj_seed(t_myObj* self, long seed) {
+    self->seed.Post((uint32_t)seed);
+}
+
+
+
 #pragma mark ----- dsp loop ------
 
 void myObj_perform64(t_myObj* self, t_object* dsp64, double** ins, long numins, double** outs, long numouts, long sampleframes, long flags, void* userparam)
 {
+    vbmi::ScopedFlushDenormals flush_denormals;
+    
     warps::FloatFrame  *input = self->input;
     warps::FloatFrame  *output = self->output;
 
     long    vs = sampleframes;
-    long    count = self->count;
     double  *adc_inputs = self->adc_inputs;
     
     if (self->obj.z_disabled)
         return;
+
+    stmlib::RandomScope random_scope(&self->rng_state, &self->seed);
     
     
-    // read 'cv' input signals, store first value of a sig vector
-    for(int k=0; k<4; k++) {
-        // cv inputs are expected in 0. to 1. range
-        // leave out first two inlets (which are the audio inputs)
-        adc_inputs[k] = ins[k+2][0];
-    }
-    self->read_inputs->Read(self->modulator->mutable_parameters(), adc_inputs, self->patched);
+    // cv inputs are expected in 0. to 1. range
+    // leave out first two inlets (which are the audio inputs)
+    self->controls.Start(ins + 2);
     
+    bool vector_rate = self->controls.rate() == vbmi::CONTROL_RATE_VECTOR;
+    if(vector_rate) {
+        for(int k=0; k<4; k++)
+            adc_inputs[k] = self->controls.value(k);
+        self->read_inputs->Read(self->modulator->mutable_parameters(), adc_inputs, self->patched);
+    }
     
-    for (int i=0; i<vs; ++i) {
-
-        input[count].l = ins[0][i];
-        input[count].r = ins[1][i];
+    for(long count=0; count<vs; count+=kBlockSize) {
+        long size = std::min<long>(kBlockSize, vs - count);
+        
+        if(!vector_rate) {
+            // read 'cv' input signals once per block
+            self->controls.Read(count, size);
+            for(int k=0; k<4; k++)
+                adc_inputs[k] = self->controls.value(k);
+            self->read_inputs->Read(self->modulator->mutable_parameters(), adc_inputs, self->patched);
+        }
         
-        count++;
-        if(count >= kBlockSize) {
-            self->modulator->Processf(input, output, kBlockSize);
-            count = 0;
+        for(long i=0; i<size; ++i) {
+            input[i].l = ins[0][count + i];
+            input[i].r = ins[1][count + i];
         }
         
-        outs[0][i] = output[count].l;
-        outs[1][i] = output[count].r;
+        self->modulator->Processf(input, output, size);
+        
+        for(long i=0; i<size; ++i) {
+            outs[0][count + i] = output[i].l;
+            outs[1][count + i] = output[i].r;
+        }
     }
     
-    self->count = count;
-    
 }
 
 
@@ -388,6 +454,7 @@ void ext_main(void* r)
     
     class_addmethod(this_class, (method)myObj_int,                  "int",      A_LONG, 0);
     class_addmethod(this_class, (method)myObj_float,                "float",    A_FLOAT, 0);
+    class_addmethod(this_class, (method)myObj_seed,                 "seed",     A_LONG, 0);
     class_addmethod(this_class, (method)myObj_info,	                "info", 0);
     
     class_dspinit(this_class);
@@ -400,6 +467,26 @@ void ext_main(void* r)
     CLASS_ATTR_ACCESSORS(this_class, "pre_gain", NULL, (method)gain_setter);
     CLASS_ATTR_SAVE(this_class, "pre_gain", 0);
     
+    // how the cv inlets are sampled
+    CLASS_ATTR_CHAR(this_class, "cvrate", 0, t_myObj, cvrate);
+    CLASS_ATTR_ENUMINDEX(this_class, "cvrate", 0, "vector block average");
+    CLASS_ATTR_LABEL(this_class, "cvrate", 0, "cv input rate");
+    CLASS_ATTR_FILTER_CLIP(this_class, "cvrate", 0, 2);
+    CLASS_ATTR_ACCESSORS(this_class, "cvrate", NULL, (method)cvrate_setter);
+    CLASS_ATTR_SAVE(this_class, "cvrate", 0);
+    
+    CLASS_ATTR_LONG(this_class, "oversampling", 0, t_myObj, oversampling);
+    CLASS_ATTR_LABEL(this_class, "oversampling", 0, "xmod oversampling (0 = auto)");
+    CLASS_ATTR_FILTER_CLIP(this_class, "oversampling", 0, 6);
+    CLASS_ATTR_ACCESSORS(this_class, "oversampling", NULL, (method)oversampling_setter);
+    CLASS_ATTR_SAVE(this_class, "oversampling", 0);
+    
+    CLASS_ATTR_LONG(this_class, "bands", 0, t_myObj, bands);
+    CLASS_ATTR_LABEL(this_class, "bands", 0, "vocoder bands (20 or 39)");
+    CLASS_ATTR_FILTER_CLIP(this_class, "bands", 20, 39);
+    CLASS_ATTR_ACCESSORS(this_class, "bands", NULL, (method)bands_setter);
+    CLASS_ATTR_SAVE(this_class, "bands", 0);
+    
     object_post(NULL, "vb.mi.wrps~ by volker böhm --> https://vboehm.net");
     object_post(NULL, "a clone of mutable instruments' 'warps' module");
 }
@@ -0,0 +1,157 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Signal inlets used as control (cv) inputs.
+//
+// The modules read their cv inputs once per internal block (32 samples for
+// rings, 60 for warps), just like the hardware reads its ADCs. A Max signal
+// vector usually holds several of those blocks, so taking ins[k][0] once per
+// vector holds the cv for the whole vector. ControlInputs hands out one value
+// per internal block instead; the cores then ramp their parameters across
+// the block as before.
+//
+// Only rngs~ and wrps~ use it. The other externals with cv inlets (plts~,
+// elmnts~, clds~, brds~, the tides based objects) already read them at the
+// first sample of every internal block, ins[k][count], and reson~ reads them
+// per sample.
+
+
+#ifndef VBMI_CONTROL_INPUTS_H_
+#define VBMI_CONTROL_INPUTS_H_
+
+#include <cstddef>
+
+namespace vbmi {
+
+enum ControlRate {
+  // first sample of the signal vector (the old behaviour)
+  CONTROL_RATE_VECTOR,
+  // last sample of each internal block
+  CONTROL_RATE_BLOCK,
+  // mean of each internal block, lets audio rate modulation through
+  // without aliasing into the control rate
+  CONTROL_RATE_AVERAGE,
+  CONTROL_RATE_LAST
+};
+
+template<size_t num_inputs>
+class ControlInputs {
+ public:
+  ControlInputs() { }
+  ~ControlInputs() { }
+
+  void Init(ControlRate rate = CONTROL_RATE_BLOCK) {
+    rate_ = rate;
+    count_ = 0;
+    for (size_t i = 0; i < num_inputs; ++i) {
+      ins_[i] = NULL;
+      sum_[i] = 0.0;
+      value_[i] = 0.0;
+    }
+  }
+
+  inline void set_rate(ControlRate rate) {
+    if (rate >= CONTROL_RATE_LAST) {
+      rate = CONTROL_RATE_BLOCK;
+    }
+    rate_ = rate;
+    count_ = 0;
+    for (size_t i = 0; i < num_inputs; ++i) {
+      sum_[i] = 0.0;
+    }
+  }
+
+  inline ControlRate rate() const { return rate_; }
+
+  // Call at the start of every signal vector, ins points to the signal
+  // vectors of the control inlets.
+  inline void Start(double* const* ins) {
+    for (size_t i = 0; i < num_inputs; ++i) {
+      ins_[i] = ins[i];
+    }
+    if (rate_ == CONTROL_RATE_VECTOR) {
+      for (size_t i = 0; i < num_inputs; ++i) {
+        value_[i] = ins[i][0];
+      }
+    }
+  }
+
+  // Samples [offset, offset + size) of the current vector belong to the
+  // internal block that is about to be processed. Blocks that straddle two
+  // signal vectors are added piecewise.
+  inline void Add(size_t offset, size_t size) {
+    if (!size) {
+      return;
+    }
+    if (rate_ == CONTROL_RATE_BLOCK) {
+      for (size_t i = 0; i < num_inputs; ++i) {
+        value_[i] = ins_[i][offset + size - 1];
+      }
+    } else if (rate_ == CONTROL_RATE_AVERAGE) {
+      for (size_t i = 0; i < num_inputs; ++i) {
+        const double* in = ins_[i] + offset;
+        double sum = 0.0;
+        for (size_t j = 0; j < size; ++j) {
+          sum += in[j];
+        }
+        sum_[i] += sum;
+      }
+      count_ += size;
+    }
+  }
+
+  // Closes the current block, value(i) then holds its control values.
+  inline void Update() {
+    if (rate_ == CONTROL_RATE_AVERAGE && count_) {
+      double scale = 1.0 / static_cast<double>(count_);
+      for (size_t i = 0; i < num_inputs; ++i) {
+        value_[i] = sum_[i] * scale;
+        sum_[i] = 0.0;
+      }
+      count_ = 0;
+    }
+  }
+
+  // Add() and Update() for a block that lies within the current vector.
+  inline void Read(size_t offset, size_t size) {
+    Add(offset, size);
+    Update();
+  }
+
+  inline double value(size_t i) const { return value_[i]; }
+
+ private:
+  ControlRate rate_;
+  const double* ins_[num_inputs];
+  double sum_[num_inputs];
+  double value_[num_inputs];
+  size_t count_;
+
+  ControlInputs(const ControlInputs&);
+  void operator=(const ControlInputs&);
+};
+
+}  // namespace vbmi
+
+#endif  // VBMI_CONTROL_INPUTS_H_
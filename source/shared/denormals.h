@@ -0,0 +1,124 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+
+// Flush-to-zero for the perform routines.
+//
+// Resonators, string models and reverbs ringing out into silence end up with
+// subnormal numbers in their state variables, and on most cpus every
+// operation on them costs 10 to 100 times more. The float cores get there
+// much sooner than the double ones. A ScopedFlushDenormals at the top of a
+// perform routine makes the cpu treat them as zero until the routine
+// returns, and then restores whatever the host had set:
+//
+//   vbmi::ScopedFlushDenormals flush_denormals;
+//
+// x86 sets FTZ and DAZ in the MXCSR (SSE, float and double), ARM sets the FZ
+// bit of the FPCR / FPSCR. Elsewhere it does nothing.
+
+
+#ifndef VBMI_DENORMALS_H_
+#define VBMI_DENORMALS_H_
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define VBMI_DENORMALS_SSE
+#include <xmmintrin.h>
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__VFP_FP__) && !defined(__SOFTFP__))
+#define VBMI_DENORMALS_ARM
+#endif
+
+#include <cstdint>
+
+namespace vbmi {
+
+class ScopedFlushDenormals {
+ public:
+  ScopedFlushDenormals() {
+    state_ = get_state();
+    set_state(state_ | kFlushBits);
+  }
+
+  ~ScopedFlushDenormals() {
+    set_state(state_);
+  }
+
+  // false where the cpu's flush-to-zero mode can't be set
+  static bool supported() {
+#if defined(VBMI_DENORMALS_SSE) || defined(VBMI_DENORMALS_ARM)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+ private:
+#if defined(VBMI_DENORMALS_SSE)
+  // flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+  static const uintptr_t kFlushBits = 0x8040;
+
+  static uintptr_t get_state() { return _mm_getcsr(); }
+  static void set_state(uintptr_t state) {
+    _mm_setcsr(static_cast<unsigned int>(state));
+  }
+#elif defined(VBMI_DENORMALS_ARM)
+  // FZ, bit 24 of the FPCR (64 bit) or FPSCR (32 bit)
+  static const uintptr_t kFlushBits = 1 << 24;
+
+#if defined(__aarch64__)
+  static uintptr_t get_state() {
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    return fpcr;
+  }
+  static void set_state(uintptr_t state) {
+    uint64_t fpcr = state;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+  }
+#else
+  static uintptr_t get_state() {
+    uint32_t fpscr;
+    __asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+    return fpscr;
+  }
+  static void set_state(uintptr_t state) {
+    uint32_t fpscr = state;
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr));
+  }
+#endif
+#else
+  static const uintptr_t kFlushBits = 0;
+
+  static uintptr_t get_state() { return 0; }
+  static void set_state(uintptr_t state) { }
+#endif
+
+  uintptr_t state_;
+
+  ScopedFlushDenormals(const ScopedFlushDenormals&);
+  void operator=(const ScopedFlushDenormals&);
+};
+
+}  // namespace vbmi
+
+#endif  // VBMI_DENORMALS_H_
@@ -0,0 +1,186 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Sleep mode of the resonators, reverbs and the granular processor.
+//
+// Once input and output of a module have stayed below the threshold for the
+// hang time, there is nothing left to hear and the module goes to sleep: the
+// perform routine skips the core and writes zeros. The state of the core is
+// left untouched, so when input above the threshold, a trigger or a gate
+// arrives, it wakes up and carries on exactly where it stopped.
+//
+// The perform routines call Awake() at the start of each block, with the
+// input level and whatever else makes the module sound, and Update() with
+// the output level after processing it.
+//
+// The setters are called from the main thread (attributes, dsp64) while
+// perform runs. They only post the new settings, Awake() applies them at the
+// start of the next block, so the state perform works with is only ever
+// written by perform itself and no wake-up or report gets lost.
+
+
+#ifndef VBMI_SLEEP_DETECTOR_H_
+#define VBMI_SLEEP_DETECTOR_H_
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+
+namespace vbmi {
+
+// below the noise floor of a 16 bit converter
+const double kDefaultSleepThreshold = -90.0;    // dB
+const double kDefaultSleepTime = 500.0;         // ms
+
+class SleepDetector {
+ public:
+  SleepDetector() { }
+  ~SleepDetector() { }
+
+  // Before perform runs.
+  void Init(double sample_rate) {
+    enabled_ = false;
+    sleeping_ = false;
+    changed_ = false;
+    active_ = false;
+    quiet_ = 0.0;
+    pending_enabled_ = false;
+    pending_sample_rate_ = sample_rate;
+    set_threshold(kDefaultSleepThreshold);
+    set_hang_time(kDefaultSleepTime);
+    Apply();
+  }
+
+  inline void set_enabled(bool enabled) {
+    pending_enabled_.store(enabled, std::memory_order_relaxed);
+    pending_.store(true, std::memory_order_release);
+  }
+
+  inline void set_threshold(double decibels) {
+    pending_threshold_.store(
+        pow(10.0, decibels / 20.0), std::memory_order_relaxed);
+    pending_.store(true, std::memory_order_release);
+  }
+
+  inline void set_hang_time(double milliseconds) {
+    pending_hang_time_.store(milliseconds, std::memory_order_relaxed);
+    pending_.store(true, std::memory_order_release);
+  }
+
+  inline void set_sample_rate(double sample_rate) {
+    pending_sample_rate_.store(sample_rate, std::memory_order_relaxed);
+    pending_.store(true, std::memory_order_release);
+  }
+
+  // Can be read from any thread.
+  inline bool sleeping() const {
+    return sleeping_.load(std::memory_order_relaxed);
+  }
+
+  // Start of a block. input_peak is the peak level of its input, trigger
+  // anything else that makes the module sound (a gate, a strum, freeze).
+  // Returns false if the module sleeps and the block can be skipped.
+  inline bool Awake(double input_peak, bool trigger) {
+    if (pending_.load(std::memory_order_relaxed) &&
+        pending_.exchange(false, std::memory_order_acquire)) {
+      Apply();
+    }
+    if (!enabled_) {
+      return true;
+    }
+    active_ = trigger || input_peak > threshold_;
+    if (active_ && sleeping()) {
+      set_sleeping(false);
+    }
+    return !sleeping();
+  }
+
+  // End of a processed block of 'size' samples.
+  inline void Update(double output_peak, size_t size) {
+    if (!enabled_) {
+      return;
+    }
+    if (active_ || output_peak > threshold_) {
+      quiet_ = 0.0;
+      return;
+    }
+    quiet_ += static_cast<double>(size);
+    if (quiet_ >= hang_samples_) {
+      quiet_ = 0.0;
+      set_sleeping(true);
+    }
+  }
+
+  // True once after the module fell asleep or woke up, the perform routines
+  // use it to report the new state from the main thread.
+  inline bool changed() {
+    bool changed = changed_;
+    changed_ = false;
+    return changed;
+  }
+
+ private:
+  inline void set_sleeping(bool sleeping) {
+    sleeping_.store(sleeping, std::memory_order_relaxed);
+    changed_ = true;
+  }
+
+  // On the audio thread, or before it runs.
+  void Apply() {
+    bool enabled = pending_enabled_.load(std::memory_order_relaxed);
+    if (enabled != enabled_) {
+      enabled_ = enabled;
+      quiet_ = 0.0;
+      if (!enabled && sleeping()) {
+        set_sleeping(false);
+      }
+    }
+    threshold_ = pending_threshold_.load(std::memory_order_relaxed);
+    hang_samples_ = pending_hang_time_.load(std::memory_order_relaxed) *
+        0.001 * pending_sample_rate_.load(std::memory_order_relaxed);
+  }
+
+  // Settings posted by the main thread.
+  std::atomic<bool> pending_;
+  std::atomic<bool> pending_enabled_;
+  std::atomic<double> pending_threshold_;
+  std::atomic<double> pending_hang_time_;
+  std::atomic<double> pending_sample_rate_;
+
+  // Used by perform.
+  double threshold_;
+  double hang_samples_;
+  double quiet_;
+  bool enabled_;
+  bool changed_;
+  bool active_;
+  std::atomic<bool> sleeping_;
+
+  SleepDetector(const SleepDetector&);
+  void operator=(const SleepDetector&);
+};
+
+}  // namespace vbmi
+
+#endif  // VBMI_SLEEP_DETECTOR_H_
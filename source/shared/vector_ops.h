@@ -0,0 +1,564 @@
+//
+// Copyright 2021 Volker Böhm.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+
+// Vector operations on signal vectors, for the perform routines.
+//
+// They replace the vDSP calls (and their scalar stand-ins on the other
+// platforms) with the same code everywhere: SSE2 on x86-64, NEON on arm64,
+// and AVX2 when the cpu running the external has it. The kernels are picked
+// once, when the external (or library) is loaded, so the perform routines
+// never run the cpu detection; set_isa() switches them, for benchmarks.
+//
+// Sum() and MaxAbs() add up several lanes at once, so the last bits of the
+// sum can differ from a plain loop (as they do with vDSP_sveD). Everything
+// else gives exactly the results of the scalar code.
+
+
+#ifndef VBMI_VECTOR_OPS_H_
+#define VBMI_VECTOR_OPS_H_
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+  #endif
+  #define VBMI_VECTOR_OPS_SSE2
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #define VBMI_TARGET_AVX2
+  #else
+    #define VBMI_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  #include <arm_neon.h>
+  #define VBMI_VECTOR_OPS_NEON
+#endif
+
+namespace vbmi {
+
+namespace vec {
+
+enum Isa {
+  ISA_SCALAR,
+  ISA_SSE2,
+  ISA_NEON,
+  ISA_AVX2,
+  ISA_LAST
+};
+
+namespace detail {
+
+struct Kernels {
+  double (*sum)(const double* in, size_t size);
+  double (*max_abs)(const double* in, size_t size);
+  void (*float_to_double)(const float* in, double* out, size_t size);
+  void (*double_to_float)(const double* in, float* out, size_t size);
+  void (*scale_add)(const double* in, double gain, double* out, size_t size);
+  void (*clamp)(const double* in, double lo, double hi, double* out,
+                size_t size);
+  void (*crossfade)(const double* a, const double* b, double amount,
+                    double* out, size_t size);
+};
+
+// The scalar loops, also used for the last samples of the vector kernels.
+// The comparisons are written the way maxpd / minpd work, so that clamping
+// gives the same results everywhere, NaN included (it becomes lo).
+
+inline double SumScalar(const double* in, size_t size) {
+  double sum = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += in[i];
+  }
+  return sum;
+}
+
+inline double MaxAbsScalar(const double* in, size_t size) {
+  double peak = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    double x = in[i] < 0.0 ? -in[i] : in[i];
+    peak = x > peak ? x : peak;
+  }
+  return peak;
+}
+
+inline void FloatToDoubleScalar(const float* in, double* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = static_cast<double>(in[i]);
+  }
+}
+
+inline void DoubleToFloatScalar(const double* in, float* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = static_cast<float>(in[i]);
+  }
+}
+
+inline void ScaleAddScalar(
+    const double* in, double gain, double* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] += in[i] * gain;
+  }
+}
+
+inline void ClampScalar(
+    const double* in, double lo, double hi, double* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    double x = in[i] > lo ? in[i] : lo;
+    out[i] = x < hi ? x : hi;
+  }
+}
+
+inline void CrossfadeScalar(
+    const double* a, const double* b, double amount, double* out,
+    size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = a[i] + (b[i] - a[i]) * amount;
+  }
+}
+
+inline const Kernels& ScalarKernels() {
+  static const Kernels kernels = {
+    SumScalar, MaxAbsScalar, FloatToDoubleScalar, DoubleToFloatScalar,
+    ScaleAddScalar, ClampScalar, CrossfadeScalar
+  };
+  return kernels;
+}
+
+#if defined(VBMI_VECTOR_OPS_SSE2) || defined(VBMI_VECTOR_OPS_NEON)
+
+// Two doubles per vector, with SSE2 or NEON.
+
+#if defined(VBMI_VECTOR_OPS_SSE2)
+
+typedef __m128d Vector;
+
+inline Vector Load(const double* p) { return _mm_loadu_pd(p); }
+inline void Store(double* p, Vector v) { _mm_storeu_pd(p, v); }
+inline Vector Splat(double x) { return _mm_set1_pd(x); }
+inline Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+inline Vector Sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+inline Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+inline Vector Max(Vector a, Vector b) { return _mm_max_pd(a, b); }
+inline Vector Min(Vector a, Vector b) { return _mm_min_pd(a, b); }
+inline Vector Abs(Vector a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+inline Vector LoadFloat(const float* p) {
+  return _mm_cvtps_pd(_mm_castsi128_ps(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+inline void StoreFloat(float* p, Vector v) {
+  _mm_storel_epi64(
+      reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(v)));
+}
+inline double SumLanes(Vector v) {
+  return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+inline double MaxLanes(Vector v) {
+  return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+#else
+
+typedef float64x2_t Vector;
+
+inline Vector Load(const double* p) { return vld1q_f64(p); }
+inline void Store(double* p, Vector v) { vst1q_f64(p, v); }
+inline Vector Splat(double x) { return vdupq_n_f64(x); }
+inline Vector Add(Vector a, Vector b) { return vaddq_f64(a, b); }
+inline Vector Sub(Vector a, Vector b) { return vsubq_f64(a, b); }
+inline Vector Mul(Vector a, Vector b) { return vmulq_f64(a, b); }
+inline Vector Max(Vector a, Vector b) { return vmaxnmq_f64(a, b); }
+inline Vector Min(Vector a, Vector b) { return vminnmq_f64(a, b); }
+inline Vector Abs(Vector a) { return vabsq_f64(a); }
+inline Vector LoadFloat(const float* p) { return vcvt_f64_f32(vld1_f32(p)); }
+inline void StoreFloat(float* p, Vector v) { vst1_f32(p, vcvt_f32_f64(v)); }
+inline double SumLanes(Vector v) {
+  return vgetq_lane_f64(v, 0) + vgetq_lane_f64(v, 1);
+}
+inline double MaxLanes(Vector v) { return vmaxnmvq_f64(v); }
+
+#endif  // VBMI_VECTOR_OPS_SSE2
+
+const size_t kWidth = 2;
+
+inline double SumSimd(const double* in, size_t size) {
+  Vector a = Splat(0.0);
+  Vector b = Splat(0.0);
+  size_t i = 0;
+  for (; i + 2 * kWidth <= size; i += 2 * kWidth) {
+    a = Add(a, Load(in + i));
+    b = Add(b, Load(in + i + kWidth));
+  }
+  return SumLanes(Add(a, b)) + SumScalar(in + i, size - i);
+}
+
+inline double MaxAbsSimd(const double* in, size_t size) {
+  Vector a = Splat(0.0);
+  Vector b = Splat(0.0);
+  size_t i = 0;
+  for (; i + 2 * kWidth <= size; i += 2 * kWidth) {
+    a = Max(Abs(Load(in + i)), a);
+    b = Max(Abs(Load(in + i + kWidth)), b);
+  }
+  double peak = MaxLanes(Max(a, b));
+  double tail = MaxAbsScalar(in + i, size - i);
+  return tail > peak ? tail : peak;
+}
+
+inline void FloatToDoubleSimd(const float* in, double* out, size_t size) {
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    Store(out + i, LoadFloat(in + i));
+  }
+  FloatToDoubleScalar(in + i, out + i, size - i);
+}
+
+inline void DoubleToFloatSimd(const double* in, float* out, size_t size) {
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    StoreFloat(out + i, Load(in + i));
+  }
+  DoubleToFloatScalar(in + i, out + i, size - i);
+}
+
+inline void ScaleAddSimd(
+    const double* in, double gain, double* out, size_t size) {
+  const Vector g = Splat(gain);
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    Store(out + i, Add(Load(out + i), Mul(Load(in + i), g)));
+  }
+  ScaleAddScalar(in + i, gain, out + i, size - i);
+}
+
+inline void ClampSimd(
+    const double* in, double lo, double hi, double* out, size_t size) {
+  const Vector l = Splat(lo);
+  const Vector h = Splat(hi);
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    Store(out + i, Min(Max(Load(in + i), l), h));
+  }
+  ClampScalar(in + i, lo, hi, out + i, size - i);
+}
+
+inline void CrossfadeSimd(
+    const double* a, const double* b, double amount, double* out,
+    size_t size) {
+  const Vector x = Splat(amount);
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    Vector a_i = Load(a + i);
+    Store(out + i, Add(a_i, Mul(Sub(Load(b + i), a_i), x)));
+  }
+  CrossfadeScalar(a + i, b + i, amount, out + i, size - i);
+}
+
+inline const Kernels& SimdKernels() {
+  static const Kernels kernels = {
+    SumSimd, MaxAbsSimd, FloatToDoubleSimd, DoubleToFloatSimd,
+    ScaleAddSimd, ClampSimd, CrossfadeSimd
+  };
+  return kernels;
+}
+
+#endif  // VBMI_VECTOR_OPS_SSE2 || VBMI_VECTOR_OPS_NEON
+
+#if defined(VBMI_VECTOR_OPS_SSE2)
+
+// Four doubles per vector. These are compiled for AVX2 whatever the flags of
+// the project, and only called after checking the cpu.
+
+VBMI_TARGET_AVX2 inline double SumAvx2(const double* in, size_t size) {
+  __m256d a = _mm256_setzero_pd();
+  __m256d b = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    a = _mm256_add_pd(a, _mm256_loadu_pd(in + i));
+    b = _mm256_add_pd(b, _mm256_loadu_pd(in + i + 4));
+  }
+  a = _mm256_add_pd(a, b);
+  __m128d s = _mm_add_pd(
+      _mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+  s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+  return _mm_cvtsd_f64(s) + SumScalar(in + i, size - i);
+}
+
+VBMI_TARGET_AVX2 inline double MaxAbsAvx2(const double* in, size_t size) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d a = _mm256_setzero_pd();
+  __m256d b = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    a = _mm256_max_pd(_mm256_andnot_pd(sign, _mm256_loadu_pd(in + i)), a);
+    b = _mm256_max_pd(_mm256_andnot_pd(sign, _mm256_loadu_pd(in + i + 4)), b);
+  }
+  a = _mm256_max_pd(a, b);
+  __m128d m = _mm_max_pd(
+      _mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+  double peak = _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+  double tail = MaxAbsScalar(in + i, size - i);
+  return tail > peak ? tail : peak;
+}
+
+VBMI_TARGET_AVX2 inline void FloatToDoubleAvx2(
+    const float* in, double* out, size_t size) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_loadu_ps(in + i)));
+  }
+  FloatToDoubleScalar(in + i, out + i, size - i);
+}
+
+VBMI_TARGET_AVX2 inline void DoubleToFloatAvx2(
+    const double* in, float* out, size_t size) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm_storeu_ps(out + i, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+  }
+  DoubleToFloatScalar(in + i, out + i, size - i);
+}
+
+VBMI_TARGET_AVX2 inline void ScaleAddAvx2(
+    const double* in, double gain, double* out, size_t size) {
+  const __m256d g = _mm256_set1_pd(gain);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(out + i, _mm256_add_pd(
+        _mm256_loadu_pd(out + i),
+        _mm256_mul_pd(_mm256_loadu_pd(in + i), g)));
+  }
+  ScaleAddScalar(in + i, gain, out + i, size - i);
+}
+
+VBMI_TARGET_AVX2 inline void ClampAvx2(
+    const double* in, double lo, double hi, double* out, size_t size) {
+  const __m256d l = _mm256_set1_pd(lo);
+  const __m256d h = _mm256_set1_pd(hi);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(out + i, _mm256_min_pd(
+        _mm256_max_pd(_mm256_loadu_pd(in + i), l), h));
+  }
+  ClampScalar(in + i, lo, hi, out + i, size - i);
+}
+
+VBMI_TARGET_AVX2 inline void CrossfadeAvx2(
+    const double* a, const double* b, double amount, double* out,
+    size_t size) {
+  const __m256d x = _mm256_set1_pd(amount);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d a_i = _mm256_loadu_pd(a + i);
+    __m256d d = _mm256_sub_pd(_mm256_loadu_pd(b + i), a_i);
+    _mm256_storeu_pd(out + i, _mm256_add_pd(a_i, _mm256_mul_pd(d, x)));
+  }
+  CrossfadeScalar(a + i, b + i, amount, out + i, size - i);
+}
+
+inline const Kernels& Avx2Kernels() {
+  static const Kernels kernels = {
+    SumAvx2, MaxAbsAvx2, FloatToDoubleAvx2, DoubleToFloatAvx2,
+    ScaleAddAvx2, ClampAvx2, CrossfadeAvx2
+  };
+  return kernels;
+}
+
+inline bool CpuHasAvx2() {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  // avx and osxsave, then the os has to save the ymm registers.
+  __cpuid(info, 1);
+  if ((info[2] & 0x18000000) != 0x18000000 || (_xgetbv(0) & 6) != 6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & 0x20) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // VBMI_VECTOR_OPS_SSE2
+
+inline bool Supported(Isa isa) {
+  switch (isa) {
+    case ISA_SCALAR:
+      return true;
+#if defined(VBMI_VECTOR_OPS_SSE2)
+    case ISA_SSE2:
+      return true;
+    case ISA_AVX2:
+      {
+        static const bool avx2 = CpuHasAvx2();
+        return avx2;
+      }
+#elif defined(VBMI_VECTOR_OPS_NEON)
+    case ISA_NEON:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+inline const Kernels& KernelsFor(Isa isa) {
+  switch (isa) {
+#if defined(VBMI_VECTOR_OPS_SSE2)
+    case ISA_SSE2:
+      return SimdKernels();
+    case ISA_AVX2:
+      return Avx2Kernels();
+#elif defined(VBMI_VECTOR_OPS_NEON)
+    case ISA_NEON:
+      return SimdKernels();
+#endif
+    default:
+      return ScalarKernels();
+  }
+}
+
+inline Isa BestIsa() {
+  for (int isa = ISA_LAST - 1; isa > ISA_SCALAR; --isa) {
+    if (Supported(static_cast<Isa>(isa))) {
+      return static_cast<Isa>(isa);
+    }
+  }
+  return ISA_SCALAR;
+}
+
+struct Dispatch {
+  Dispatch() : isa(BestIsa()), kernels(&KernelsFor(isa)) { }
+  Isa isa;
+  const Kernels* kernels;
+};
+
+// A static member of a class template has a single definition across all
+// translation units and is initialized when the binary is loaded, unlike a
+// function-local static, which would be set up by the first call, from a
+// perform routine.
+template<typename T = void>
+struct DispatchHolder {
+  static Dispatch d;
+};
+
+template<typename T>
+Dispatch DispatchHolder<T>::d;
+
+inline Dispatch& dispatch() {
+  return DispatchHolder<>::d;
+}
+
+}  // namespace detail
+
+// Instruction set the operations run with.
+inline Isa isa() {
+  return detail::dispatch().isa;
+}
+
+inline bool supported(Isa isa) {
+  return detail::Supported(isa);
+}
+
+// Returns false, and changes nothing, when the cpu cannot run it. Only meant
+// for benchmarks: it is not thread-safe, nothing may be processing while
+// the kernels are switched.
+inline bool set_isa(Isa isa) {
+  if (!detail::Supported(isa)) {
+    return false;
+  }
+  detail::dispatch().isa = isa;
+  detail::dispatch().kernels = &detail::KernelsFor(isa);
+  return true;
+}
+
+inline const char* isa_name(Isa isa) {
+  static const char* const names[] = { "scalar", "sse2", "neon", "avx2" };
+  return isa < ISA_LAST ? names[isa] : "";
+}
+
+// Sum of in[0] .. in[size - 1], like vDSP_sveD.
+inline double Sum(const double* in, size_t size) {
+  return detail::dispatch().kernels->sum(in, size);
+}
+
+// Largest absolute value, 0 for an empty vector.
+inline double MaxAbs(const double* in, size_t size) {
+  return detail::dispatch().kernels->max_abs(in, size);
+}
+
+// Like vDSP_vspdp.
+inline void Convert(const float* in, double* out, size_t size) {
+  detail::dispatch().kernels->float_to_double(in, out, size);
+}
+
+// Like vDSP_vdpsp.
+inline void Convert(const double* in, float* out, size_t size) {
+  detail::dispatch().kernels->double_to_float(in, out, size);
+}
+
+// Plain copies, so code written against a configurable sample type (real_t
+// in the mutableSources64 cores) converts the same way in both builds.
+inline void Convert(const double* in, double* out, size_t size) {
+  if (in != out) {
+    memmove(out, in, size * sizeof(double));
+  }
+}
+
+inline void Convert(const float* in, float* out, size_t size) {
+  if (in != out) {
+    memmove(out, in, size * sizeof(float));
+  }
+}
+
+// out[i] += in[i] * gain.
+inline void ScaleAdd(const double* in, double gain, double* out, size_t size) {
+  detail::dispatch().kernels->scale_add(in, gain, out, size);
+}
+
+// out[i] = in[i] limited to [lo, hi]. in and out can be the same vector.
+inline void Clamp(
+    const double* in, double lo, double hi, double* out, size_t size) {
+  detail::dispatch().kernels->clamp(in, lo, hi, out, size);
+}
+
+// out[i] = a[i] + (b[i] - a[i]) * amount, from a (0) to b (1). out can be
+// a or b.
+inline void Crossfade(
+    const double* a, const double* b, double amount, double* out,
+    size_t size) {
+  detail::dispatch().kernels->crossfade(a, b, amount, out, size);
+}
+
+}  // namespace vec
+
+}  // namespace vbmi
+
+#endif  // VBMI_VECTOR_OPS_H_